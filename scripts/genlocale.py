@@ -77,14 +77,26 @@ def tochar(fromstring):
         return '"%s\\0"' % fromstring
     return 'nullptr'
 
-def tochararray(fromstringlist):
+# locale strings are stored once in UTF-16 pool and referenced by index, index 0 is the null string
+def tolocalestring(fromstring):
+    if not fromstring:
+        return '0'
+    if not fromstring in localestringsmap:
+        localestringsmap[fromstring] = len(localestringslist)
+        localestringslist.append(fromstring)
+    return '%d' % localestringsmap[fromstring]
+
+def tolocalestringarray(fromstringlist):
     result = '{ '
     for string in fromstringlist:
-        result = '%s%s, ' % (result, tochar(string))
+        result = '%s%s, ' % (result, tolocalestring(string))
     result = '%s }' % result
     result = result.replace(',  }', ' }')
     return result
 
+def toutf16size(fromstring):
+    return len(fromstring.encode('utf-16-le')) // 2
+
 def todayenum(day):
     if day == 'mon':
         return 'Qt::Monday'
@@ -333,6 +345,29 @@ def printtable(frommap, prefix):
     print('};')
     print('static const qint16 %sTblSize = sizeof(%sTbl) / sizeof(%sTblData);\n' % (lowerprefix, lowerprefix, lowerprefix))
 
+    # the table index is the enum value, aliases share the value of the entry with the same code
+    tablecodes = []
+    for key in frommap.keys():
+        if key in ('Any%s' % prefix, 'C'):
+            tablecodes.append(frommap[key]['code'])
+    for key in sorted(frommap.keys()):
+        if key in ('Any%s' % prefix, 'C'):
+            continue
+        code = frommap[key]['code']
+        if not code in tablecodes:
+            tablecodes.append(code)
+    for key in frommap.keys():
+        enumvaluesmap['QLocale::%s::%s' % (prefix, key)] = tablecodes.index(frommap[key]['code'])
+
+    # table indexes sorted by code for binary search, entries without code are not searchable
+    codeindexes = [i for i in range(len(tablecodes)) if tablecodes[i]]
+    codeindexes.sort(key=lambda i: tablecodes[i].encode('utf-8'))
+    print('static const qint16 %sCodeTbl[] = {' % lowerprefix)
+    for i in range(0, len(codeindexes), 16):
+        print('    %s,' % ', '.join('%d' % index for index in codeindexes[i:i + 16]))
+    print('};')
+    print('static const qint16 %sCodeTblSize = sizeof(%sCodeTbl) / sizeof(qint16);\n' % (lowerprefix, lowerprefix))
+
 def printlocaledata(frommap, key):
     value = frommap[key]
     # skip table entries without country (non-territory), unless it is artificial, this is done to
@@ -347,6 +382,7 @@ def printlocaledata(frommap, key):
     # HACK: skip table entries with and without specifiec script
     if key == 'ha_Arab_NG':
         return
+    localelanguages.append(enumvaluesmap[value['language']])
     print('''    {
         %s, %s, %s,
         %s, %s, %s,
@@ -381,30 +417,31 @@ def printlocaledata(frommap, key):
             touint(value['plus']),
             touint(value['exponential']),
             touint(value['zero']),
-            tochar(value['language_endonym']),
-            tochar(value['country_endonym']),
-            tochar(value['short_date_format']),
-            tochar(value['long_date_format']),
-            tochar(value['short_time_format']),
-            tochar(value['long_time_format']),
-            tochar(value['am']),
-            tochar(value['pm']),
-            tochararray(value['standalone_short_month_names']),
-            tochararray(value['standalone_long_month_names']),
-            tochararray(value['standalone_narrow_month_names']),
-            tochararray(value['short_month_names']),
-            tochararray(value['long_month_names']),
-            tochararray(value['narrow_month_names']),
-            tochararray(value['standalone_short_day_names']),
-            tochararray(value['standalone_long_day_names']),
-            tochararray(value['standalone_narrow_day_names']),
-            tochararray(value['short_day_names']),
-            tochararray(value['long_day_names']),
-            tochararray(value['narrow_day_names']),
+            tolocalestring(value['language_endonym']),
+            tolocalestring(value['country_endonym']),
+            tolocalestring(value['short_date_format']),
+            tolocalestring(value['long_date_format']),
+            tolocalestring(value['short_time_format']),
+            tolocalestring(value['long_time_format']),
+            tolocalestring(value['am']),
+            tolocalestring(value['pm']),
+            tolocalestringarray(value['standalone_short_month_names']),
+            tolocalestringarray(value['standalone_long_month_names']),
+            tolocalestringarray(value['standalone_narrow_month_names']),
+            tolocalestringarray(value['short_month_names']),
+            tolocalestringarray(value['long_month_names']),
+            tolocalestringarray(value['narrow_month_names']),
+            tolocalestringarray(value['standalone_short_day_names']),
+            tolocalestringarray(value['standalone_long_day_names']),
+            tolocalestringarray(value['standalone_narrow_day_names']),
+            tolocalestringarray(value['short_day_names']),
+            tolocalestringarray(value['long_day_names']),
+            tolocalestringarray(value['narrow_day_names']),
             key,
         )
     )
 
+# alias tables are sorted by the original code for binary search
 def printaliastable(frommap, prefix):
     print('''static const struct %sAliasTblData {
     const char* original;
@@ -421,6 +458,10 @@ def printaliastable(frommap, prefix):
     print('static const qint16 %sAliasTblSize = sizeof(%sAliasTbl) / sizeof(%sAliasTblData);\n' % (prefix, prefix, prefix))
 
 # main maps
+enumvaluesmap = {}
+localestringsmap = {}
+localestringslist = ['']
+localelanguages = []
 languagemap = {}
 countrymap = {}
 scriptmap = {}
@@ -540,6 +581,7 @@ elif printdocsandexit:
     printdoc(languagemap, 'Language')
 else:
     printtable(languagemap, 'Language')
+    languagecount = len(set(enumvaluesmap.values()))
 
 # country parsing
 for country in root.findall('./localeDisplayNames/territories/territory'):
@@ -902,6 +944,44 @@ for key in sorted(localemap.keys()):
 print('};')
 print('static const qint16 localeTblSize = sizeof(localeTbl) / sizeof(QLocalePrivate);\n')
 
+print('static const char16_t localeStrings[] =')
+localestringsoffsets = []
+localestringsoffset = 0
+for string in localestringslist:
+    localestringsoffsets.append(localestringsoffset)
+    localestringsoffset += toutf16size(string) + 1
+    print('    u"%s\\0"' % string)
+print(''';
+
+static const struct localeStringTblData {
+    const quint32 offset;
+    const quint16 size;
+} localeStringTbl[] = {''')
+for i in range(0, len(localestringslist), 8):
+    entries = []
+    for j in range(i, min(i + 8, len(localestringslist))):
+        entries.append('{ %d, %d }' % (localestringsoffsets[j], toutf16size(localestringslist[j])))
+    print('    %s,' % ', '.join(entries))
+print('};\n')
+
+# the entries of each language are next to each other because the table is sorted by locale code
+# (except for C which is first), the index is the language enum value
+print('''static const struct localeIndexTblData {
+    const qint16 first;
+    const qint16 count;
+} localeIndexTbl[] = {''')
+for language in range(languagecount):
+    if not language in localelanguages:
+        print('    { 0, 0 },')
+        continue
+    first = localelanguages.index(language)
+    count = localelanguages.count(language)
+    if localelanguages[first:first + count] != [language] * count:
+        print('Locale entries for language %d are not contiguous' % language)
+        sys.exit(1)
+    print('    { %d, %d },' % (first, count))
+print('};\n')
+
 # likely subtags parsing
 tree = ET.parse('common/supplemental/likelySubtags.xml')
 root = tree.getroot()
@@ -962,7 +1042,16 @@ print('''static const struct subtagAliasTblData {
     const QLocale::Country tocountry;
 } subtagAliasTbl[] = {''')
 
-for key in sorted(likelysubtagsmap):
+# sorted by the enum values for binary search
+def subtagaliaskey(key):
+    value = likelysubtagsmap[key]
+    return (
+        enumvaluesmap[value['fromlanguage']],
+        enumvaluesmap[value['fromscript']],
+        enumvaluesmap[value['fromcountry']],
+    )
+
+for key in sorted(sorted(likelysubtagsmap), key=subtagaliaskey):
     value = likelysubtagsmap[key]
     print('''    {
         %s, %s, %s,
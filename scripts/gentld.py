@@ -10,14 +10,67 @@ content = content.decode('utf-8')
 for line in content.splitlines():
     if line.startswith('//') or not line:
         continue
-    tldlist.append(line)
+    tldlist.append(line.encode('utf-8'))
 
 tldcount = len(tldlist)
+if len(set(tldlist)) != tldcount:
+    raise Exception('duplicate entries')
 
-print('''static const char* TLDTbl[%d] = {''' % tldcount)
+# minimal perfect hash, the entries are split into buckets by a first hash
+# and every bucket gets a seed for a second hash that puts its entries into
+# free slots, largest buckets first. keep in sync with qt_tld_hash()
+def tldhash(seed, data):
+    h = (0x811c9dc5 ^ seed) & 0xffffffff
+    for c in data:
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & 0xffffffff
+    h ^= h >> 16
+    return h
 
+seedcount = (tldcount + 3) // 4
+buckets = [[] for i in range(seedcount)]
 for tld in tldlist:
-    print('    "%s",' % tld)
+    buckets[tldhash(0, tld) % seedcount].append(tld)
 
+seeds = [0] * seedcount
+slots = [None] * tldcount
+for bucket in sorted(range(seedcount), key=lambda b: -len(buckets[b])):
+    if not buckets[bucket]:
+        break
+    seed = 1
+    while True:
+        positions = [tldhash(seed, tld) % tldcount for tld in buckets[bucket]]
+        if len(set(positions)) == len(positions) \
+            and all(slots[p] is None for p in positions):
+            break
+        seed += 1
+    if seed > 0xffff:
+        raise Exception('seed out of range')
+    seeds[bucket] = seed
+    for p, tld in zip(positions, buckets[bucket]):
+        slots[p] = tld
+
+offsets = []
+offset = 0
+print('''static const char TLDStrings[] =''')
+for tld in slots:
+    offsets.append(offset)
+    offset += len(tld) + 1
+    print('    "%s\\0"' % tld.decode('utf-8'))
+print(''';
+
+static const quint32 TLDOffsets[%d] = {''' % tldcount)
+for i in range(0, tldcount, 8):
+    print('    %s,' % ', '.join(str(o) for o in offsets[i:i + 8]))
+print('''};
+static const quint32 TLDTblSize = %d;
+
+static const quint16 TLDSeeds[%d] = {''' % (tldcount, seedcount))
+for i in range(0, seedcount, 12):
+    print('    %s,' % ', '.join(str(s) for s in seeds[i:i + 12]))
 print('''};
-static const qint16 TLDTblSize = %d;''' % tldcount)
+static const quint32 TLDSeedsSize = %d;
+static const int TLDMaxLength = %d;''' % (seedcount, max(len(tld) for tld in tldlist)))
@@ -27,6 +27,8 @@ incmap = {
         'QHashNode': 'qhash.h',
         'QIncompatibleFlag': 'qglobal.h',
         'QInternal': 'qnamespace.h',
+        'QJsonStreamReader': 'qjsonstream.h',
+        'QJsonStreamWriter': 'qjsonstream.h',
         'QLatin1Char': 'qchar.h',
         'QLatin1String': 'qstring.h',
         'QLineF': 'qline.h',
@@ -59,6 +61,7 @@ incmap = {
         'QPersistentModelIndex': 'qabstractitemmodel.h',
         'QPointF': 'qpoint.h',
         'QProcessEnvironment': 'qprocess.h',
+        'QReadLocker': 'qreadwritelock.h',
         'QRectF': 'qrect.h',
         'QReturnArgument': 'qobjectdefs.h',
         'QScopedPointerPodDeleter': 'qscopedpointer.h',
@@ -79,6 +82,7 @@ incmap = {
         'QVectorIterator': 'qvector.h',
         'QVectorTypedData': 'qvector.h',
         'QWeakPointer': 'qsharedpointer.h',
+        'QWriteLocker': 'qreadwritelock.h',
         'Q_PID': 'qprocess.h',
         'Qt': 'qnamespace.h',
         'QtAlgorithms': 'qalgorithms.h',
@@ -174,6 +174,7 @@ classlist = [
     "QFontMetricsF",
     "QFormLayout",
     "QFrame",
+    "QFuture",
     "QGenericArgument",
     "QGenericMatrix",
     "QGenericReturnArgument",
@@ -251,6 +252,8 @@ classlist = [
     "QItemSelectionModel",
     "QItemSelectionRange",
     "QJsonDocument",
+    "QJsonStreamReader",
+    "QJsonStreamWriter",
     "QKeyEvent",
     "QKeySequence",
     "QLCDNumber",
@@ -361,6 +364,7 @@ classlist = [
     "QProcessEnvironment",
     "QProgressBar",
     "QProgressDialog",
+    "QPromise",
     "QPropertyAnimation",
     "QProxyModel",
     "QProxyStyle",
@@ -368,6 +372,8 @@ classlist = [
     "QQueue",
     "QRadialGradient",
     "QRadioButton",
+    "QReadLocker",
+    "QReadWriteLock",
     "QRect",
     "QRectF",
     "QRegExp",
@@ -607,6 +613,7 @@ classlist = [
     "QWindowsStyle",
     "QWizard",
     "QWizardPage",
+    "QWriteLocker",
     "QX11EmbedContainer",
     "QX11EmbedWidget",
     "QX11Info",
@@ -640,6 +647,7 @@ classlist = [
     "Qt",
     "QtAlgorithms",
     "QtCleanUpFunction",
+    "QtConcurrent",
     "QtConfig",
     "QtContainerFwd",
     "QtCore",
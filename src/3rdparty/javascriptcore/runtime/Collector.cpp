@@ -379,8 +379,31 @@ void Heap::markConservatively(MarkStack& markStack, void* start, void* end)
     }
 }
 
+#if defined(QT_HAVE_PTHREAD_GETATTR_NP)
+static void* currentThreadStackBase()
+{
+    static thread_local void* stackBase = 0;
+    if (!stackBase) {
+        pthread_attr_t attr;
+        void* stackAddress = 0;
+        size_t stackSize = 0;
+        pthread_getattr_np(pthread_self(), &attr);
+        pthread_attr_getstack(&attr, &stackAddress, &stackSize);
+        pthread_attr_destroy(&attr);
+        stackBase = static_cast<char*>(stackAddress) + stackSize;
+    }
+    return stackBase;
+}
+#endif
+
 void NEVER_INLINE Heap::markCurrentThreadConservativelyInternal(MarkStack& markStack)
 {
+#if defined(QT_HAVE_PTHREAD_GETATTR_NP)
+    // scan the frames of the callers, from here up to the base of the stack
+    void* dummy = 0;
+    void* stackPointer = &dummy;
+    void* stackBase = currentThreadStackBase();
+#else
     // pointer size must be pointer aligned
 #if defined(PTHREAD_STACK_MIN) && defined(_SC_THREAD_ATTR_STACKSIZE)
     static long stackPointerSize = sysconf(_SC_THREAD_ATTR_STACKSIZE) * QT_POINTER_SIZE;
@@ -393,6 +416,7 @@ void NEVER_INLINE Heap::markCurrentThreadConservativelyInternal(MarkStack& markS
     enum { stackPointerSize = USHRT_MAX * QT_POINTER_SIZE};
     static thread_local char stackPointer[stackPointerSize];
     static thread_local char* stackBase = stackPointer + stackPointerSize;
+#endif
 #endif
     markConservatively(markStack, stackPointer, stackBase);
 }
@@ -21,16 +21,8 @@
 
 #include "Platform.h"
 #include "RegExp.h"
-#include "Lexer.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
+#include "RegExpEngine.h"
 #include <wtf/Assertions.h>
-#include <QStringList>
-#include <QDebug>
-
-// for reference:
-// https://en.cppreference.com/w/cpp/regex/basic_regex
 
 namespace JSC {
 
@@ -90,65 +82,39 @@ void RegExp::compile()
     m_constructionError.clear();
     m_numSubpatterns = 0;
 
-    if (multiline()) {
-        m_constructionError = "Multi-line not implemented";
-        return;
-    }
-    Qt::CaseSensitivity regexOptions = Qt::CaseSensitive;
-    if (ignoreCase()) {
-        regexOptions = Qt::CaseInsensitive;
-    }
-    m_regExp = QRegExp(QString(m_pattern), regexOptions);
-    if (!m_regExp.isValid()) {
-        m_constructionError = m_regExp.errorString().toLatin1();
+    const char* error = 0;
+    m_program.set(RegExpProgram::create(m_pattern, ignoreCase(), multiline(), &error));
+    if (!m_program) {
+        m_constructionError = error;
         return;
     }
-    m_numSubpatterns = m_regExp.captureCount();
+    m_numSubpatterns = m_program->numSubpatterns();
 }
 
 int RegExp::match(const UString& s, int startOffset, Vector<int, 32>* ovector)
 {
-    if (!ovector) {
-        return -1;
-    }
-    if (startOffset < 0) {
+    if (startOffset < 0)
         startOffset = 0;
-    }
-    ovector->clear();
+    if (ovector)
+        ovector->clear();
 
-    if (startOffset > s.size() || s.isNull())
+    if (!m_program || startOffset > s.size() || s.isNull())
         return -1;
 
-    if (isValid()) {
-        const QString qstring(s);
-        const bool didmatch = (m_regExp.indexIn(qstring, startOffset) != -1);
-
-        if (!didmatch) {
-#ifndef QT_NO_DEBUG
-            fprintf(stderr, "jsRegExpExecute failed with result\n");
-#endif
-            return -1;
-        }
-
-        const int capsize = m_regExp.capturedTexts().size();
-
-        // Set up the offset vector for the result.
-        // First 2/3 used for result, the last third unused but there for compatibility.
-        ovector->resize((capsize + 1) * 3);
-        int* offsetVector= ovector->data();
-
-        size_t nummatches = 0;
-        for (int i = 0; i < capsize; i++) {
-            offsetVector[nummatches] = m_regExp.pos(i);
-            offsetVector[nummatches + 1] = m_regExp.cap(i).length();
-            offsetVector[nummatches + 2] = 0;
-            nummatches++;
-        }
-
-        return offsetVector[0];
+    // Set up the offset vector for the result.
+    // First 2/3 used for result, the last third unused but there for compatibility.
+    Vector<int, 32> localVector;
+    if (!ovector)
+        ovector = &localVector;
+    ovector->resize((m_numSubpatterns + 1) * 3);
+    int* offsetVector = ovector->data();
+
+    const int result = m_program->match(s.data(), s.size(), startOffset, offsetVector);
+    if (result < 0) {
+        ovector->clear();
+        return -1;
     }
-
-    return -1;
+    return offsetVector[0];
 }
 
 } // namespace JSC
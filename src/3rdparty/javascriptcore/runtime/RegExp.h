@@ -24,12 +24,13 @@
 
 #include "UString.h"
 #include <wtf/Forward.h>
+#include <wtf/OwnPtr.h>
 #include <wtf/RefCounted.h>
 
-#include <QRegExp>
-
 namespace JSC {
 
+    class RegExpProgram;
+
     class RegExp : public RefCounted<RegExp> {
     public:
         static PassRefPtr<RegExp> create(const UString& pattern);
@@ -59,7 +60,7 @@ namespace JSC {
         UString m_pattern; // FIXME: Just decompile m_regExp instead of storing this.
         int m_flagBits;
         unsigned m_numSubpatterns;
-        QRegExp m_regExp;
+        OwnPtr<RegExpProgram> m_program;
         QByteArray m_constructionError;
     };
 
@@ -0,0 +1,1565 @@
+/*
+ *  Copyright (C) 2022 Ivailo Monev
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "Platform.h"
+#include "RegExpEngine.h"
+
+#include <wtf/ASCIICType.h>
+#include <wtf/Assertions.h>
+#include <wtf/unicode/Unicode.h>
+
+#include <algorithm>
+#include <string.h>
+
+// for reference:
+// https://262.ecma-international.org/5.1/#sec-15.10
+// https://swtch.com/~rsc/regexp/regexp2.html
+
+namespace JSC {
+
+static const int s_maxProgramSize = 100000;
+// the Pike VM keeps 2^depth states per instruction for nested optional
+// iterations, deeper nesting is left to the backtracking matcher
+static const int s_maxLoopDepth = 4;
+static const int s_maxNestingDepth = 1000;
+static const int s_maxQuantifier = 65535;
+static const int s_maxBacktrackSteps = 10000000;
+static const size_t s_maxPrefixLength = 8;
+
+static inline bool isLineTerminator(UChar c)
+{
+    return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+static inline bool isWordCharacter(UChar c)
+{
+    return c == '_' || isASCIIAlphanumeric(c);
+}
+
+// ECMA-262 15.10.2.8 Canonicalize
+static inline UChar canonicalize(UChar c)
+{
+    if (c < 128)
+        return isASCIILower(c) ? toASCIIUpper(c) : c;
+    const uint upper = QChar::toUpper(uint(c));
+    if (upper < 128 || upper > 0xFFFF)
+        return c;
+    return upper;
+}
+
+static const RegExpProgram::CharacterRange s_digitRanges[] = {
+    { '0', '9' }
+};
+
+static const RegExpProgram::CharacterRange s_spaceRanges[] = {
+    { 0x0009, 0x000D }, { 0x0020, 0x0020 }, { 0x00A0, 0x00A0 }, { 0x1680, 0x1680 },
+    { 0x180E, 0x180E }, { 0x2000, 0x200A }, { 0x2028, 0x2029 }, { 0x202F, 0x202F },
+    { 0x205F, 0x205F }, { 0x3000, 0x3000 }, { 0xFEFF, 0xFEFF }
+};
+
+static const RegExpProgram::CharacterRange s_wordRanges[] = {
+    { '0', '9' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' }
+};
+
+struct RegExpNode {
+    enum Type {
+        Empty,
+        Character,      // value: character
+        Any,
+        Class,          // value: character class
+        Group,          // value: subpattern, -1 if not capturing
+        Concatenation,
+        Alternation,
+        Repeat,
+        Assertion,      // value: opcode
+        BackReference,  // value: subpattern
+        Lookahead       // value: negated
+    };
+
+    Type type;
+    int value;
+    int min;
+    int max;            // -1 for no upper bound
+    bool greedy;
+    unsigned firstSubpattern;
+    unsigned endSubpattern;
+    Vector<int> children;
+};
+
+class RegExpCompiler {
+public:
+    RegExpCompiler(RegExpProgram* program, const UString& pattern)
+        : m_program(program)
+        , m_pattern(pattern.data())
+        , m_length(pattern.size())
+        , m_position(0)
+        , m_depth(0)
+        , m_loop(-1)
+        , m_totalSubpatterns(0)
+        , m_error(0)
+    {
+    }
+
+    const char* compile();
+
+private:
+    int addNode(RegExpNode::Type type, int value = 0);
+
+    void countSubpatterns();
+    int parseDisjunction();
+    int parseAlternative();
+    bool parseTerm(int concatenation);
+    bool parseQuantifier(int& min, int& max);
+    int parseAtomEscape();
+    bool parseClass(RegExpProgram::CharacterClass& characterClass);
+    int parseCharacterEscape();
+    int parseHex(int digits);
+
+    void addRanges(RegExpProgram::CharacterClass& characterClass, const RegExpProgram::CharacterRange* ranges, int count, bool negated);
+    bool addClassEscape(RegExpProgram::CharacterClass& characterClass, UChar escape);
+    int addClass(RegExpProgram::CharacterClass& characterClass);
+    static void normalizeClass(RegExpProgram::CharacterClass& characterClass);
+
+    bool isNullable(int node) const;
+    bool isAnchored(int node) const;
+    int fixedLength(int node) const;
+    void addCharacters(RegExpProgram::CharacterSet& set, int node) const;
+    void computePrefix(int node, Vector<RegExpProgram::CharacterSet>& prefix) const;
+
+    bool generate(int node);
+    int appendInstruction(RegExpProgram::OpCode op, int a = 0, int b = 0);
+    bool generateRepeat(const RegExpNode& node, int child);
+    bool generateIteration(const RegExpNode& node, int child, bool nullable);
+
+    bool atEnd() const { return m_position >= m_length; }
+    UChar peek() const { return m_pattern[m_position]; }
+    bool fail(const char* error)
+    {
+        if (!m_error)
+            m_error = error;
+        return false;
+    }
+
+    RegExpProgram* m_program;
+    const UChar* m_pattern;
+    int m_length;
+    int m_position;
+    int m_depth;
+    int m_loop;
+    unsigned m_totalSubpatterns;
+    const char* m_error;
+    Vector<RegExpNode> m_nodes;
+};
+
+int RegExpCompiler::addNode(RegExpNode::Type type, int value)
+{
+    RegExpNode node;
+    node.type = type;
+    node.value = value;
+    node.min = 0;
+    node.max = 0;
+    node.greedy = true;
+    node.firstSubpattern = 0;
+    node.endSubpattern = 0;
+    m_nodes.append(node);
+    return m_nodes.size() - 1;
+}
+
+const char* RegExpCompiler::compile()
+{
+    countSubpatterns();
+
+    const int root = parseDisjunction();
+    if (m_error)
+        return m_error;
+    if (!atEnd())
+        return "unmatched parentheses";
+
+    RegExpProgram* program = m_program;
+    program->m_numSlots = (program->m_numSubpatterns + 1) * 2;
+    program->m_anchored = !program->m_multiline && isAnchored(root);
+
+    if (!program->m_anchored)
+        computePrefix(root, program->m_prefix);
+
+    appendInstruction(RegExpProgram::OpSave, 0);
+    if (!generate(root))
+        return m_error;
+    appendInstruction(RegExpProgram::OpSave, 1);
+    appendInstruction(RegExpProgram::OpMatch);
+    if (program->m_program.size() > s_maxProgramSize)
+        return "regular expression too large";
+    if (program->m_loopDepth > s_maxLoopDepth)
+        program->m_backtracking = true;
+    return 0;
+}
+
+// Backreferences may refer to subpatterns which are opened later in the
+// pattern, the total is needed to tell them apart from octal escapes
+void RegExpCompiler::countSubpatterns()
+{
+    bool inClass = false;
+    for (int i = 0; i < m_length; i++) {
+        switch (m_pattern[i]) {
+        case '\\':
+            i++;
+            break;
+        case '[':
+            inClass = true;
+            break;
+        case ']':
+            inClass = false;
+            break;
+        case '(':
+            if (!inClass && (i + 1 >= m_length || m_pattern[i + 1] != '?'))
+                m_totalSubpatterns++;
+            break;
+        }
+    }
+}
+
+int RegExpCompiler::parseDisjunction()
+{
+    if (++m_depth > s_maxNestingDepth) {
+        fail("parentheses are too deeply nested");
+        return -1;
+    }
+
+    int result = parseAlternative();
+    if (!atEnd() && peek() == '|') {
+        const int alternation = addNode(RegExpNode::Alternation);
+        m_nodes[alternation].children.append(result);
+        while (!m_error && !atEnd() && peek() == '|') {
+            m_position++;
+            const int alternative = parseAlternative();
+            m_nodes[alternation].children.append(alternative);
+        }
+        result = alternation;
+    }
+
+    m_depth--;
+    return result;
+}
+
+int RegExpCompiler::parseAlternative()
+{
+    const int concatenation = addNode(RegExpNode::Concatenation);
+    while (!atEnd() && peek() != '|' && peek() != ')') {
+        if (!parseTerm(concatenation))
+            break;
+    }
+    return concatenation;
+}
+
+bool RegExpCompiler::parseQuantifier(int& min, int& max)
+{
+    switch (peek()) {
+    case '*':
+        m_position++;
+        min = 0;
+        max = -1;
+        return true;
+    case '+':
+        m_position++;
+        min = 1;
+        max = -1;
+        return true;
+    case '?':
+        m_position++;
+        min = 0;
+        max = 1;
+        return true;
+    case '{':
+        break;
+    default:
+        return false;
+    }
+
+    // a brace which does not start a valid quantifier is a literal
+    int position = m_position + 1;
+    if (position >= m_length || !isASCIIDigit(m_pattern[position]))
+        return false;
+    long long low = 0;
+    while (position < m_length && isASCIIDigit(m_pattern[position])) {
+        if (low <= s_maxQuantifier)
+            low = low * 10 + (m_pattern[position] - '0');
+        position++;
+    }
+    long long high = low;
+    if (position < m_length && m_pattern[position] == ',') {
+        position++;
+        high = -1;
+        if (position < m_length && isASCIIDigit(m_pattern[position])) {
+            high = 0;
+            while (position < m_length && isASCIIDigit(m_pattern[position])) {
+                if (high <= s_maxQuantifier)
+                    high = high * 10 + (m_pattern[position] - '0');
+                position++;
+            }
+        }
+    }
+    if (position >= m_length || m_pattern[position] != '}')
+        return false;
+    m_position = position + 1;
+
+    if (low > s_maxQuantifier || high > s_maxQuantifier)
+        return fail("number too big in {} quantifier");
+    if (high != -1 && high < low)
+        return fail("numbers out of order in {} quantifier");
+    min = low;
+    max = high;
+    return true;
+}
+
+bool RegExpCompiler::parseTerm(int concatenation)
+{
+    const unsigned firstSubpattern = m_program->m_numSubpatterns;
+    int atom = -1;
+    bool quantifiable = true;
+
+    switch (peek()) {
+    case '^':
+        m_position++;
+        atom = addNode(RegExpNode::Assertion, RegExpProgram::OpAssertBOL);
+        quantifiable = false;
+        break;
+    case '$':
+        m_position++;
+        atom = addNode(RegExpNode::Assertion, RegExpProgram::OpAssertEOL);
+        quantifiable = false;
+        break;
+    case '.':
+        m_position++;
+        atom = addNode(RegExpNode::Any);
+        break;
+    case '*':
+    case '+':
+    case '?':
+        return fail("nothing to repeat");
+    case '{': {
+        int min, max;
+        if (parseQuantifier(min, max))
+            return fail("nothing to repeat");
+        if (m_error)
+            return false;
+        m_position++;
+        atom = addNode(RegExpNode::Character, '{');
+        break;
+    }
+    case '[': {
+        m_position++;
+        RegExpProgram::CharacterClass characterClass;
+        if (!parseClass(characterClass))
+            return false;
+        atom = addNode(RegExpNode::Class, addClass(characterClass));
+        break;
+    }
+    case '(': {
+        m_position++;
+        int subpattern = -1;
+        bool lookahead = false;
+        bool negated = false;
+        if (!atEnd() && peek() == '?') {
+            m_position++;
+            if (atEnd())
+                return fail("unrecognized character after (?");
+            switch (peek()) {
+            case ':':
+                break;
+            case '=':
+                lookahead = true;
+                break;
+            case '!':
+                lookahead = true;
+                negated = true;
+                break;
+            default:
+                return fail("unrecognized character after (?");
+            }
+            m_position++;
+        } else {
+            subpattern = ++m_program->m_numSubpatterns;
+        }
+
+        const int child = parseDisjunction();
+        if (m_error)
+            return false;
+        if (atEnd() || peek() != ')')
+            return fail("missing )");
+        m_position++;
+
+        if (lookahead) {
+            atom = addNode(RegExpNode::Lookahead, negated);
+            m_program->m_backtracking = true;
+            quantifiable = false;
+        } else {
+            atom = addNode(RegExpNode::Group, subpattern);
+        }
+        m_nodes[atom].children.append(child);
+        break;
+    }
+    case '\\':
+        m_position++;
+        if (atEnd())
+            return fail("\\ at end of pattern");
+        if (peek() == 'b' || peek() == 'B') {
+            const bool boundary = (peek() == 'b');
+            m_position++;
+            atom = addNode(RegExpNode::Assertion, boundary ? RegExpProgram::OpWordBoundary : RegExpProgram::OpNotWordBoundary);
+            quantifiable = false;
+            break;
+        }
+        atom = parseAtomEscape();
+        if (atom < 0)
+            return false;
+        break;
+    default:
+        atom = addNode(RegExpNode::Character, peek());
+        m_position++;
+        break;
+    }
+
+    if (!atEnd()) {
+        int min, max;
+        if (parseQuantifier(min, max)) {
+            if (!quantifiable)
+                return fail("nothing to repeat");
+            bool greedy = true;
+            if (!atEnd() && peek() == '?') {
+                m_position++;
+                greedy = false;
+            }
+            const int repeat = addNode(RegExpNode::Repeat);
+            RegExpNode& node = m_nodes[repeat];
+            node.min = min;
+            node.max = max;
+            node.greedy = greedy;
+            node.firstSubpattern = firstSubpattern + 1;
+            node.endSubpattern = m_program->m_numSubpatterns + 1;
+            node.children.append(atom);
+            atom = repeat;
+            if (!atEnd() && (peek() == '*' || peek() == '+' || peek() == '?'))
+                return fail("nothing to repeat");
+        } else if (m_error) {
+            return false;
+        }
+    }
+
+    m_nodes[concatenation].children.append(atom);
+    return true;
+}
+
+int RegExpCompiler::parseHex(int digits)
+{
+    if (m_position + digits > m_length)
+        return -1;
+    int value = 0;
+    for (int i = 0; i < digits; i++) {
+        const UChar c = m_pattern[m_position + i];
+        if (!isASCIIHexDigit(c))
+            return -1;
+        value = (value << 4) | toASCIIHexValue(c);
+    }
+    m_position += digits;
+    return value;
+}
+
+// Parses the escape after the backslash which is not a class escape nor a
+// backreference, shared between atoms and character classes
+int RegExpCompiler::parseCharacterEscape()
+{
+    const UChar c = peek();
+    m_position++;
+    switch (c) {
+    case 'f':
+        return '\f';
+    case 'n':
+        return '\n';
+    case 'r':
+        return '\r';
+    case 't':
+        return '\t';
+    case 'v':
+        return '\v';
+    case 'c':
+        if (!atEnd() && isASCIIAlpha(peek())) {
+            const UChar control = peek();
+            m_position++;
+            return control % 32;
+        }
+        // not a control escape, the backslash is a literal
+        m_position--;
+        return '\\';
+    case 'x': {
+        const int value = parseHex(2);
+        return value < 0 ? 'x' : value;
+    }
+    case 'u': {
+        const int value = parseHex(4);
+        return value < 0 ? 'u' : value;
+    }
+    case '0': case '1': case '2': case '3':
+    case '4': case '5': case '6': case '7': {
+        int value = c - '0';
+        const int maxDigits = (c <= '3') ? 2 : 1;
+        for (int i = 0; i < maxDigits && !atEnd() && peek() >= '0' && peek() <= '7'; i++) {
+            value = value * 8 + (peek() - '0');
+            m_position++;
+        }
+        return value;
+    }
+    default:
+        return c;
+    }
+}
+
+int RegExpCompiler::parseAtomEscape()
+{
+    const UChar c = peek();
+    switch (c) {
+    case 'd':
+    case 'D':
+    case 's':
+    case 'S':
+    case 'w':
+    case 'W': {
+        m_position++;
+        RegExpProgram::CharacterClass characterClass;
+        characterClass.negated = false;
+        addClassEscape(characterClass, c);
+        return addNode(RegExpNode::Class, addClass(characterClass));
+    }
+    case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9': {
+        int position = m_position;
+        unsigned subpattern = 0;
+        while (position < m_length && isASCIIDigit(m_pattern[position]) && subpattern <= m_totalSubpatterns) {
+            subpattern = subpattern * 10 + (m_pattern[position] - '0');
+            position++;
+        }
+        if (subpattern <= m_totalSubpatterns) {
+            m_position = position;
+            m_program->m_backtracking = true;
+            return addNode(RegExpNode::BackReference, subpattern);
+        }
+        if (c >= '8') {
+            m_position++;
+            return addNode(RegExpNode::Character, c);
+        }
+        break;
+    }
+    }
+    return addNode(RegExpNode::Character, parseCharacterEscape());
+}
+
+void RegExpCompiler::addRanges(RegExpProgram::CharacterClass& characterClass, const RegExpProgram::CharacterRange* ranges, int count, bool negated)
+{
+    if (!negated) {
+        for (int i = 0; i < count; i++)
+            characterClass.ranges.append(ranges[i]);
+        return;
+    }
+
+    // the ranges are sorted, add the gaps between them
+    int begin = 0;
+    for (int i = 0; i < count; i++) {
+        if (ranges[i].begin > begin) {
+            RegExpProgram::CharacterRange range = { UChar(begin), UChar(ranges[i].begin - 1) };
+            characterClass.ranges.append(range);
+        }
+        begin = ranges[i].end + 1;
+    }
+    if (begin <= 0xFFFF) {
+        RegExpProgram::CharacterRange range = { UChar(begin), 0xFFFF };
+        characterClass.ranges.append(range);
+    }
+}
+
+bool RegExpCompiler::addClassEscape(RegExpProgram::CharacterClass& characterClass, UChar escape)
+{
+    switch (escape) {
+    case 'd':
+    case 'D':
+        addRanges(characterClass, s_digitRanges, sizeof(s_digitRanges) / sizeof(s_digitRanges[0]), escape == 'D');
+        return true;
+    case 's':
+    case 'S':
+        addRanges(characterClass, s_spaceRanges, sizeof(s_spaceRanges) / sizeof(s_spaceRanges[0]), escape == 'S');
+        return true;
+    case 'w':
+    case 'W':
+        addRanges(characterClass, s_wordRanges, sizeof(s_wordRanges) / sizeof(s_wordRanges[0]), escape == 'W');
+        return true;
+    }
+    return false;
+}
+
+bool RegExpCompiler::parseClass(RegExpProgram::CharacterClass& characterClass)
+{
+    characterClass.negated = false;
+    if (!atEnd() && peek() == '^') {
+        characterClass.negated = true;
+        m_position++;
+    }
+
+    int pending = -1; // character which may start a range
+    bool range = false;
+    for (;;) {
+        if (atEnd())
+            return fail("missing terminating ] for character class");
+
+        UChar c = peek();
+        if (c == ']') {
+            m_position++;
+            break;
+        }
+
+        int character = -1;
+        m_position++;
+        if (c == '\\') {
+            if (atEnd())
+                return fail("\\ at end of pattern");
+            c = peek();
+            if (addClassEscape(characterClass, c)) {
+                m_position++;
+                // a class escape can not be a range end point, the dash is literal
+                if (range) {
+                    RegExpProgram::CharacterRange dash = { '-', '-' };
+                    characterClass.ranges.append(dash);
+                    range = false;
+                }
+                if (pending >= 0) {
+                    RegExpProgram::CharacterRange single = { UChar(pending), UChar(pending) };
+                    characterClass.ranges.append(single);
+                    pending = -1;
+                }
+                continue;
+            }
+            if (c == 'b') {
+                m_position++;
+                character = '\b';
+            } else if (c == '8' || c == '9') {
+                m_position++;
+                character = c;
+            } else {
+                character = parseCharacterEscape();
+            }
+        } else if (c == '-' && pending >= 0 && !range) {
+            range = true;
+            continue;
+        } else {
+            character = c;
+        }
+
+        if (range) {
+            if (character < pending)
+                return fail("range out of order in character class");
+            RegExpProgram::CharacterRange characterRange = { UChar(pending), UChar(character) };
+            characterClass.ranges.append(characterRange);
+            pending = -1;
+            range = false;
+            continue;
+        }
+
+        if (pending >= 0) {
+            RegExpProgram::CharacterRange single = { UChar(pending), UChar(pending) };
+            characterClass.ranges.append(single);
+        }
+        pending = character;
+    }
+
+    if (pending >= 0) {
+        RegExpProgram::CharacterRange single = { UChar(pending), UChar(pending) };
+        characterClass.ranges.append(single);
+    }
+    if (range) {
+        RegExpProgram::CharacterRange dash = { '-', '-' };
+        characterClass.ranges.append(dash);
+    }
+    return true;
+}
+
+static int compareRanges(const void* left, const void* right)
+{
+    const RegExpProgram::CharacterRange* first = static_cast<const RegExpProgram::CharacterRange*>(left);
+    const RegExpProgram::CharacterRange* second = static_cast<const RegExpProgram::CharacterRange*>(right);
+    if (first->begin != second->begin)
+        return first->begin < second->begin ? -1 : 1;
+    return first->end < second->end ? -1 : (first->end > second->end ? 1 : 0);
+}
+
+// Sorts the ranges and merges overlapping and adjacent ones so that lookups
+// can do a binary search
+void RegExpCompiler::normalizeClass(RegExpProgram::CharacterClass& characterClass)
+{
+    Vector<RegExpProgram::CharacterRange>& ranges = characterClass.ranges;
+    if (ranges.size() < 2)
+        return;
+    qsort(ranges.data(), ranges.size(), sizeof(RegExpProgram::CharacterRange), compareRanges);
+    size_t last = 0;
+    for (size_t i = 1; i < ranges.size(); i++) {
+        if (int(ranges[i].begin) <= int(ranges[last].end) + 1) {
+            if (ranges[i].end > ranges[last].end)
+                ranges[last].end = ranges[i].end;
+        } else {
+            ranges[++last] = ranges[i];
+        }
+    }
+    ranges.shrink(last + 1);
+}
+
+int RegExpCompiler::addClass(RegExpProgram::CharacterClass& characterClass)
+{
+    normalizeClass(characterClass);
+    m_program->m_classes.append(characterClass);
+    return m_program->m_classes.size() - 1;
+}
+
+bool RegExpCompiler::isNullable(int index) const
+{
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Character:
+    case RegExpNode::Any:
+    case RegExpNode::Class:
+        return false;
+    case RegExpNode::Group:
+        return isNullable(node.children[0]);
+    case RegExpNode::Concatenation:
+        for (size_t i = 0; i < node.children.size(); i++) {
+            if (!isNullable(node.children[i]))
+                return false;
+        }
+        return true;
+    case RegExpNode::Alternation:
+        for (size_t i = 0; i < node.children.size(); i++) {
+            if (isNullable(node.children[i]))
+                return true;
+        }
+        return false;
+    case RegExpNode::Repeat:
+        return node.min == 0 || isNullable(node.children[0]);
+    default:
+        return true;
+    }
+}
+
+bool RegExpCompiler::isAnchored(int index) const
+{
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Assertion:
+        return node.value == RegExpProgram::OpAssertBOL;
+    case RegExpNode::Group:
+        return isAnchored(node.children[0]);
+    case RegExpNode::Concatenation:
+        return !node.children.isEmpty() && isAnchored(node.children[0]);
+    case RegExpNode::Alternation:
+        for (size_t i = 0; i < node.children.size(); i++) {
+            if (!isAnchored(node.children[i]))
+                return false;
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns the length of every match of the node, -1 if it varies
+int RegExpCompiler::fixedLength(int index) const
+{
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Character:
+    case RegExpNode::Any:
+    case RegExpNode::Class:
+        return 1;
+    case RegExpNode::Group:
+        return fixedLength(node.children[0]);
+    case RegExpNode::Concatenation: {
+        int length = 0;
+        for (size_t i = 0; i < node.children.size(); i++) {
+            const int childLength = fixedLength(node.children[i]);
+            if (childLength < 0)
+                return -1;
+            length += childLength;
+        }
+        return length;
+    }
+    case RegExpNode::Alternation: {
+        const int length = fixedLength(node.children[0]);
+        for (size_t i = 1; i < node.children.size(); i++) {
+            if (fixedLength(node.children[i]) != length)
+                return -1;
+        }
+        return length;
+    }
+    case RegExpNode::Repeat: {
+        if (node.min != node.max)
+            return -1;
+        const int childLength = fixedLength(node.children[0]);
+        if (childLength < 0 || childLength > s_maxProgramSize)
+            return -1;
+        return node.min * childLength;
+    }
+    case RegExpNode::BackReference:
+        return -1;
+    default:
+        return 0;
+    }
+}
+
+// Adds the characters matched by a single character node
+void RegExpCompiler::addCharacters(RegExpProgram::CharacterSet& set, int index) const
+{
+    const RegExpProgram* program = m_program;
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Character:
+        if (program->m_ignoreCase) {
+            const UChar canonical = canonicalize(node.value);
+            for (int c = 0; c < 256; c++) {
+                if (canonicalize(c) == canonical)
+                    set.latin1[c] = true;
+            }
+            // only non-ASCII characters canonicalize to non-ASCII ones
+            if (canonical >= 128)
+                set.aboveLatin1 = true;
+        } else if (node.value < 256) {
+            set.latin1[node.value] = true;
+        } else {
+            set.aboveLatin1 = true;
+        }
+        break;
+    case RegExpNode::Class: {
+        const RegExpProgram::CharacterClass& characterClass = program->m_classes[node.value];
+        for (int c = 0; c < 256; c++) {
+            if (program->classContains(characterClass, c))
+                set.latin1[c] = true;
+        }
+        if (characterClass.negated || program->m_ignoreCase
+            || (!characterClass.ranges.isEmpty() && characterClass.ranges.last().end > 255))
+            set.aboveLatin1 = true;
+        break;
+    }
+    default:
+        for (int c = 0; c < 256; c++)
+            set.latin1[c] = !isLineTerminator(c);
+        set.aboveLatin1 = true;
+        break;
+    }
+}
+
+// Computes the characters possible at each of the leading offsets of every
+// match of the node. The prefix is empty if the node may match the empty
+// string
+void RegExpCompiler::computePrefix(int index, Vector<RegExpProgram::CharacterSet>& prefix) const
+{
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Character:
+    case RegExpNode::Any:
+    case RegExpNode::Class: {
+        RegExpProgram::CharacterSet set;
+        memset(&set, 0, sizeof(set));
+        addCharacters(set, index);
+        prefix.append(set);
+        break;
+    }
+    case RegExpNode::Group:
+        computePrefix(node.children[0], prefix);
+        break;
+    case RegExpNode::Repeat:
+        if (node.min > 0)
+            computePrefix(node.children[0], prefix);
+        break;
+    case RegExpNode::Concatenation:
+        for (size_t i = 0; i < node.children.size() && prefix.size() < s_maxPrefixLength; i++) {
+            const int child = node.children[i];
+            const size_t size = prefix.size();
+            computePrefix(child, prefix);
+            // the offsets of the following nodes are only known if the
+            // length of this one is
+            if (fixedLength(child) != int(prefix.size() - size))
+                break;
+        }
+        break;
+    case RegExpNode::Alternation: {
+        Vector<RegExpProgram::CharacterSet> alternative;
+        computePrefix(node.children[0], alternative);
+        for (size_t i = 1; i < node.children.size() && !alternative.isEmpty(); i++) {
+            Vector<RegExpProgram::CharacterSet> other;
+            computePrefix(node.children[i], other);
+            if (other.size() < alternative.size())
+                alternative.shrink(other.size());
+            for (size_t j = 0; j < alternative.size(); j++) {
+                for (int c = 0; c < 256; c++)
+                    alternative[j].latin1[c] |= other[j].latin1[c];
+                alternative[j].aboveLatin1 |= other[j].aboveLatin1;
+            }
+        }
+        prefix.append(alternative.data(), alternative.size());
+        break;
+    }
+    default:
+        // zero-width assertions add nothing, backreferences may be empty
+        break;
+    }
+    if (prefix.size() > s_maxPrefixLength)
+        prefix.shrink(s_maxPrefixLength);
+}
+
+int RegExpCompiler::appendInstruction(RegExpProgram::OpCode op, int a, int b)
+{
+    RegExpProgram::Instruction instruction;
+    instruction.op = op;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.loop = m_loop;
+    m_program->m_program.append(instruction);
+    return m_program->m_program.size() - 1;
+}
+
+bool RegExpCompiler::generate(int index)
+{
+    Vector<RegExpProgram::Instruction>& instructions = m_program->m_program;
+    if (instructions.size() > s_maxProgramSize)
+        return fail("regular expression too large");
+
+    const RegExpNode& node = m_nodes[index];
+    switch (node.type) {
+    case RegExpNode::Empty:
+        return true;
+    case RegExpNode::Character:
+        appendInstruction(RegExpProgram::OpChar, m_program->m_ignoreCase ? canonicalize(node.value) : node.value);
+        return true;
+    case RegExpNode::Any:
+        appendInstruction(RegExpProgram::OpAny);
+        return true;
+    case RegExpNode::Class:
+        appendInstruction(RegExpProgram::OpClass, node.value);
+        return true;
+    case RegExpNode::Group:
+        if (node.value < 0)
+            return generate(node.children[0]);
+        appendInstruction(RegExpProgram::OpSave, node.value * 2);
+        if (!generate(node.children[0]))
+            return false;
+        appendInstruction(RegExpProgram::OpSave, node.value * 2 + 1);
+        return true;
+    case RegExpNode::Concatenation:
+        for (size_t i = 0; i < node.children.size(); i++) {
+            if (!generate(node.children[i]))
+                return false;
+        }
+        return true;
+    case RegExpNode::Alternation: {
+        Vector<int> jumps;
+        const size_t last = node.children.size() - 1;
+        for (size_t i = 0; i < last; i++) {
+            const int split = appendInstruction(RegExpProgram::OpSplit, instructions.size() + 1);
+            if (!generate(node.children[i]))
+                return false;
+            jumps.append(appendInstruction(RegExpProgram::OpJump));
+            instructions[split].b = instructions.size();
+        }
+        if (!generate(node.children[last]))
+            return false;
+        for (size_t i = 0; i < jumps.size(); i++)
+            instructions[jumps[i]].a = instructions.size();
+        return true;
+    }
+    case RegExpNode::Repeat:
+        return generateRepeat(node, node.children[0]);
+    case RegExpNode::Assertion:
+        appendInstruction(RegExpProgram::OpCode(node.value));
+        return true;
+    case RegExpNode::BackReference:
+        appendInstruction(RegExpProgram::OpBackReference, node.value);
+        return true;
+    case RegExpNode::Lookahead: {
+        const int lookahead = appendInstruction(RegExpProgram::OpLookahead, 0, node.value);
+        if (!generate(node.children[0]))
+            return false;
+        appendInstruction(RegExpProgram::OpLookaheadEnd);
+        instructions[lookahead].a = instructions.size();
+        return true;
+    }
+    }
+    Q_ASSERT(false);
+    return false;
+}
+
+// Emits a single iteration, resetting the captures of the previous one
+bool RegExpCompiler::generateIteration(const RegExpNode& node, int child, bool nullable)
+{
+    if (node.endSubpattern > node.firstSubpattern)
+        appendInstruction(RegExpProgram::OpReset, node.firstSubpattern * 2, node.endSubpattern * 2);
+    if (!nullable)
+        return generate(child);
+
+    // an optional iteration must not match the empty string (ECMA-262
+    // 15.10.2.5 RepeatMatcher), that also breaks infinite loops
+    const int slot = m_program->m_numSlots++;
+    appendInstruction(RegExpProgram::OpMark, slot);
+
+    RegExpProgram::Loop loop;
+    loop.slot = slot;
+    loop.parent = m_loop;
+    m_loop = m_program->m_loops.size();
+    m_program->m_loops.append(loop);
+    int depth = 0;
+    for (int i = m_loop; i >= 0; i = m_program->m_loops[i].parent)
+        depth++;
+    m_program->m_loopDepth = std::max(m_program->m_loopDepth, depth);
+
+    if (!generate(child))
+        return false;
+    appendInstruction(RegExpProgram::OpCheck, slot);
+    m_loop = loop.parent;
+    return true;
+}
+
+bool RegExpCompiler::generateRepeat(const RegExpNode& node, int child)
+{
+    Vector<RegExpProgram::Instruction>& instructions = m_program->m_program;
+    const bool hasSubpatterns = node.endSubpattern > node.firstSubpattern;
+    for (int i = 0; i < node.min; i++) {
+        if (hasSubpatterns)
+            appendInstruction(RegExpProgram::OpReset, node.firstSubpattern * 2, node.endSubpattern * 2);
+        if (!generate(child))
+            return false;
+        if (instructions.size() > s_maxProgramSize)
+            return fail("regular expression too large");
+    }
+
+    const bool nullable = isNullable(child);
+    if (node.max == -1) {
+        const int loop = appendInstruction(RegExpProgram::OpSplit);
+        if (!generateIteration(node, child, nullable))
+            return false;
+        appendInstruction(RegExpProgram::OpJump, loop);
+        if (node.greedy) {
+            instructions[loop].a = loop + 1;
+            instructions[loop].b = instructions.size();
+        } else {
+            instructions[loop].a = instructions.size();
+            instructions[loop].b = loop + 1;
+        }
+        return true;
+    }
+
+    Vector<int> splits;
+    for (int i = node.min; i < node.max; i++) {
+        splits.append(appendInstruction(RegExpProgram::OpSplit));
+        if (!generateIteration(node, child, nullable))
+            return false;
+        if (instructions.size() > s_maxProgramSize)
+            return fail("regular expression too large");
+    }
+    const int exit = instructions.size();
+    for (size_t i = 0; i < splits.size(); i++) {
+        RegExpProgram::Instruction& split = instructions[splits[i]];
+        if (node.greedy) {
+            split.a = splits[i] + 1;
+            split.b = exit;
+        } else {
+            split.a = exit;
+            split.b = splits[i] + 1;
+        }
+    }
+    return true;
+}
+
+RegExpProgram::RegExpProgram()
+    : m_numSubpatterns(0)
+    , m_numSlots(2)
+    , m_loopDepth(0)
+    , m_ignoreCase(false)
+    , m_multiline(false)
+    , m_anchored(false)
+    , m_backtracking(false)
+{
+}
+
+RegExpProgram* RegExpProgram::create(const UString& pattern, bool ignoreCase, bool multiline, const char** error)
+{
+    RegExpProgram* program = new RegExpProgram();
+    program->m_ignoreCase = ignoreCase;
+    program->m_multiline = multiline;
+
+    RegExpCompiler compiler(program, pattern);
+    const char* compileError = compiler.compile();
+    if (compileError) {
+        delete program;
+        if (error)
+            *error = compileError;
+        return 0;
+    }
+    if (error)
+        *error = 0;
+    return program;
+}
+
+inline bool RegExpProgram::prefixMatches(const UChar* subject, int length, int position) const
+{
+    const CharacterSet* prefix = m_prefix.data();
+    const int prefixLength = m_prefix.size();
+    if (position + prefixLength > length)
+        return false;
+    for (int offset = 0; offset < prefixLength; offset++) {
+        const UChar c = subject[position + offset];
+        if (!(c < 256 ? prefix[offset].latin1[c] : prefix[offset].aboveLatin1))
+            return false;
+    }
+    return true;
+}
+
+// Returns the first position from position on where the prefix matches,
+// -1 if there is none
+int RegExpProgram::nextCandidate(const UChar* subject, int length, int position) const
+{
+    const int last = length - int(m_prefix.size());
+    for (; position <= last; position++) {
+        if (prefixMatches(subject, length, position))
+            return position;
+    }
+    return -1;
+}
+
+static bool rangesContain(const RegExpProgram::CharacterClass& characterClass, UChar c)
+{
+    const RegExpProgram::CharacterRange* ranges = characterClass.ranges.data();
+    int low = 0;
+    int high = characterClass.ranges.size() - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        if (c < ranges[middle].begin)
+            high = middle - 1;
+        else if (c > ranges[middle].end)
+            low = middle + 1;
+        else
+            return true;
+    }
+    return false;
+}
+
+bool RegExpProgram::classContains(const CharacterClass& characterClass, UChar c) const
+{
+    bool found = rangesContain(characterClass, c);
+    if (!found && m_ignoreCase) {
+        found = rangesContain(characterClass, QChar::toLower(uint(c)))
+            || rangesContain(characterClass, QChar::toUpper(uint(c)));
+    }
+    return found != characterClass.negated;
+}
+
+inline bool RegExpProgram::matchesCharacter(const Instruction& instruction, UChar c) const
+{
+    switch (instruction.op) {
+    case OpChar:
+        return (m_ignoreCase ? canonicalize(c) : c) == instruction.a;
+    case OpAny:
+        return !isLineTerminator(c);
+    case OpClass:
+        return classContains(m_classes[instruction.a], c);
+    default:
+        return false;
+    }
+}
+
+bool RegExpProgram::assertionHolds(OpCode op, const UChar* subject, int length, int position) const
+{
+    switch (op) {
+    case OpAssertBOL:
+        return position == 0 || (m_multiline && isLineTerminator(subject[position - 1]));
+    case OpAssertEOL:
+        return position == length || (m_multiline && isLineTerminator(subject[position]));
+    case OpWordBoundary:
+    case OpNotWordBoundary: {
+        const bool before = position > 0 && isWordCharacter(subject[position - 1]);
+        const bool after = position < length && isWordCharacter(subject[position]);
+        return (before != after) == (op == OpWordBoundary);
+    }
+    default:
+        return false;
+    }
+}
+
+// Whether an OpCheck fails depends on whether the iterations enclosing pc
+// have consumed characters yet, so threads reaching the same pc are only
+// equivalent if they agree on that for every one of them
+unsigned RegExpProgram::threadState(int pc, const int* registers, int position) const
+{
+    unsigned state = pc << m_loopDepth;
+    int bit = 1;
+    for (int loop = m_program[pc].loop; loop >= 0; loop = m_loops[loop].parent) {
+        if (registers[m_loops[loop].slot] == position)
+            state |= bit;
+        bit <<= 1;
+    }
+    return state;
+}
+
+struct RegExpProgram::PikeThreads {
+    Vector<int, 32> pcs;
+    Vector<int, 256> registers;
+
+    void clear()
+    {
+        pcs.shrink(0);
+        registers.shrink(0);
+    }
+};
+
+// Follows the instructions which do not consume characters from pc and
+// queues a thread for each instruction which does, in priority order. The
+// stack holds pairs of either -1 and a pc to continue from or a slot and
+// the value to restore before that
+void RegExpProgram::addThread(PikeThreads& threads, unsigned* visited, unsigned generation, Vector<int>& stack,
+                              int pc, const UChar* subject, int length, int position, int* registers) const
+{
+    stack.shrink(0);
+    stack.append(-1);
+    stack.append(pc);
+    while (!stack.isEmpty()) {
+        const int value = stack.last();
+        stack.removeLast();
+        const int slot = stack.last();
+        stack.removeLast();
+        if (slot >= 0) {
+            registers[slot] = value;
+            continue;
+        }
+
+        pc = value;
+        for (;;) {
+            const unsigned state = threadState(pc, registers, position);
+            if (visited[state] == generation)
+                break;
+            visited[state] = generation;
+
+            const Instruction& instruction = m_program[pc];
+            bool alive = true;
+            switch (instruction.op) {
+            case OpJump:
+                pc = instruction.a;
+                continue;
+            case OpSplit:
+                stack.append(-1);
+                stack.append(instruction.b);
+                pc = instruction.a;
+                continue;
+            case OpSave:
+            case OpMark:
+                stack.append(instruction.a);
+                stack.append(registers[instruction.a]);
+                registers[instruction.a] = position;
+                pc++;
+                continue;
+            case OpReset:
+                for (int i = instruction.a; i < instruction.b; i++) {
+                    stack.append(i);
+                    stack.append(registers[i]);
+                    registers[i] = -1;
+                }
+                pc++;
+                continue;
+            case OpCheck:
+                alive = registers[instruction.a] != position;
+                break;
+            case OpAssertBOL:
+            case OpAssertEOL:
+            case OpWordBoundary:
+            case OpNotWordBoundary:
+                alive = assertionHolds(instruction.op, subject, length, position);
+                break;
+            case OpChar:
+            case OpAny:
+            case OpClass:
+            case OpMatch:
+                threads.pcs.append(pc);
+                threads.registers.append(registers, m_numSlots);
+                alive = false;
+                break;
+            default:
+                // backreferences and lookahead are never simulated
+                Q_ASSERT(false);
+                alive = false;
+                break;
+            }
+            if (!alive)
+                break;
+            pc++;
+        }
+    }
+}
+
+int RegExpProgram::matchPike(const UChar* subject, int length, int startOffset, int* ovector) const
+{
+    const int numSlots = m_numSlots;
+    const int numCaptureSlots = (m_numSubpatterns + 1) * 2;
+
+    Vector<unsigned, 64> visited;
+    visited.fill(0, m_program.size() << m_loopDepth);
+    unsigned generation = 1;
+
+    PikeThreads first;
+    PikeThreads second;
+    PikeThreads* current = &first;
+    PikeThreads* next = &second;
+    Vector<int> stack;
+    Vector<int, 32> registers;
+    registers.fill(-1, numSlots);
+    bool matched = false;
+
+    int position = startOffset;
+    for (;;) {
+        bool start = !matched && (!m_anchored || position == 0);
+        if (start && !m_prefix.isEmpty()) {
+            if (current->pcs.isEmpty()) {
+                position = nextCandidate(subject, length, position);
+                if (position < 0)
+                    break;
+                generation++;
+            } else {
+                start = prefixMatches(subject, length, position);
+            }
+        }
+        if (start) {
+            for (int i = 0; i < numSlots; i++)
+                registers[i] = -1;
+            addThread(*current, visited.data(), generation, stack, 0, subject, length, position, registers.data());
+        }
+        if (current->pcs.isEmpty()) {
+            if (matched || m_anchored || position >= length)
+                break;
+            generation++;
+            position++;
+            continue;
+        }
+
+        const unsigned nextGeneration = ++generation;
+        next->clear();
+        const UChar c = position < length ? subject[position] : 0;
+        for (size_t i = 0; i < current->pcs.size(); i++) {
+            const int pc = current->pcs[i];
+            const Instruction& instruction = m_program[pc];
+            const int* threadRegisters = current->registers.data() + i * numSlots;
+            if (instruction.op == OpMatch) {
+                // threads after this one have lower priority
+                memcpy(ovector, threadRegisters, numCaptureSlots * sizeof(int));
+                matched = true;
+                break;
+            }
+            if (position < length && matchesCharacter(instruction, c)) {
+                memcpy(registers.data(), threadRegisters, numSlots * sizeof(int));
+                addThread(*next, visited.data(), nextGeneration, stack, pc + 1, subject, length, position + 1, registers.data());
+            }
+        }
+
+        if (position >= length)
+            break;
+        std::swap(current, next);
+        position++;
+    }
+
+    return matched ? ovector[0] : -1;
+}
+
+// Runs the program from pc until it matches, returning the end position,
+// or fails returning -1 with the registers restored. Returns -2 if the step
+// limit was hit
+int RegExpProgram::runBacktracking(const UChar* subject, int length, int pc, int position, int* registers, int& steps) const
+{
+    struct BacktrackEntry {
+        int slot; // -1 for a choice point
+        int value; // slot value or pc
+        int position;
+    };
+    Vector<BacktrackEntry, 32> stack;
+
+    for (;;) {
+        if (++steps > s_maxBacktrackSteps)
+            return -2;
+
+        const Instruction& instruction = m_program[pc];
+        bool failed = false;
+        switch (instruction.op) {
+        case OpChar:
+        case OpAny:
+        case OpClass:
+            if (position < length && matchesCharacter(instruction, subject[position])) {
+                position++;
+                pc++;
+            } else {
+                failed = true;
+            }
+            break;
+        case OpSplit: {
+            BacktrackEntry entry = { -1, instruction.b, position };
+            stack.append(entry);
+            pc = instruction.a;
+            break;
+        }
+        case OpJump:
+            pc = instruction.a;
+            break;
+        case OpSave:
+        case OpMark: {
+            BacktrackEntry entry = { instruction.a, registers[instruction.a], 0 };
+            stack.append(entry);
+            registers[instruction.a] = position;
+            pc++;
+            break;
+        }
+        case OpReset:
+            for (int i = instruction.a; i < instruction.b; i++) {
+                BacktrackEntry entry = { i, registers[i], 0 };
+                stack.append(entry);
+                registers[i] = -1;
+            }
+            pc++;
+            break;
+        case OpCheck:
+            if (registers[instruction.a] == position)
+                failed = true;
+            else
+                pc++;
+            break;
+        case OpAssertBOL:
+        case OpAssertEOL:
+        case OpWordBoundary:
+        case OpNotWordBoundary:
+            if (assertionHolds(instruction.op, subject, length, position))
+                pc++;
+            else
+                failed = true;
+            break;
+        case OpBackReference: {
+            const int start = registers[instruction.a * 2];
+            const int end = registers[instruction.a * 2 + 1];
+            // a backreference to a subpattern which did not participate
+            // matches the empty string
+            if (start < 0 || end < 0) {
+                pc++;
+                break;
+            }
+            const int referenceLength = end - start;
+            if (position + referenceLength > length) {
+                failed = true;
+                break;
+            }
+            for (int i = 0; i < referenceLength; i++) {
+                const UChar left = subject[start + i];
+                const UChar right = subject[position + i];
+                if (left != right && (!m_ignoreCase || canonicalize(left) != canonicalize(right))) {
+                    failed = true;
+                    break;
+                }
+            }
+            if (!failed) {
+                position += referenceLength;
+                pc++;
+            }
+            break;
+        }
+        case OpLookahead: {
+            // lookahead is atomic, run it on its own stack
+            Vector<int, 32> saved;
+            saved.append(registers, m_numSlots);
+            const int result = runBacktracking(subject, length, pc + 1, position, registers, steps);
+            if (result == -2)
+                return -2;
+            if (instruction.b) {
+                memcpy(registers, saved.data(), m_numSlots * sizeof(int));
+                failed = (result >= 0);
+            } else if (result < 0) {
+                failed = true;
+            } else {
+                for (int i = 0; i < m_numSlots; i++) {
+                    if (registers[i] != saved[i]) {
+                        BacktrackEntry entry = { i, saved[i], 0 };
+                        stack.append(entry);
+                    }
+                }
+            }
+            if (!failed)
+                pc = instruction.a;
+            break;
+        }
+        case OpLookaheadEnd:
+        case OpMatch:
+            return position;
+        }
+
+        if (!failed)
+            continue;
+        for (;;) {
+            if (stack.isEmpty())
+                return -1;
+            const BacktrackEntry entry = stack.last();
+            stack.removeLast();
+            if (entry.slot < 0) {
+                pc = entry.value;
+                position = entry.position;
+                break;
+            }
+            registers[entry.slot] = entry.value;
+        }
+    }
+}
+
+int RegExpProgram::matchBacktracking(const UChar* subject, int length, int startOffset, int* ovector) const
+{
+    Vector<int, 32> registers;
+    registers.fill(-1, m_numSlots);
+    int steps = 0;
+
+    for (int position = startOffset; position <= length; position++) {
+        if (m_anchored && position > 0)
+            break;
+        if (!m_prefix.isEmpty()) {
+            position = nextCandidate(subject, length, position);
+            if (position < 0)
+                break;
+        }
+
+        const int end = runBacktracking(subject, length, 0, position, registers.data(), steps);
+        if (end == -2)
+            break;
+        if (end >= 0) {
+            memcpy(ovector, registers.data(), (m_numSubpatterns + 1) * 2 * sizeof(int));
+            return ovector[0];
+        }
+    }
+    return -1;
+}
+
+int RegExpProgram::match(const UChar* subject, int length, int startOffset, int* ovector) const
+{
+    Q_ASSERT(startOffset >= 0 && startOffset <= length);
+    if (m_anchored && startOffset > 0)
+        return -1;
+    if (m_backtracking)
+        return matchBacktracking(subject, length, startOffset, ovector);
+    return matchPike(subject, length, startOffset, ovector);
+}
+
+} // namespace JSC
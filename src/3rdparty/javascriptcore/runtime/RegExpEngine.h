@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2022 Ivailo Monev
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef RegExpEngine_h
+#define RegExpEngine_h
+
+#include "UString.h"
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+
+namespace JSC {
+
+    // Compiled ECMAScript regular expression. The pattern is compiled to a
+    // small program which is executed by simulating the NFA in lock-step
+    // (Pike VM), taking time linear to the length of the subject. Patterns
+    // using backreferences or lookahead assertions cannot be simulated that
+    // way and run the same program on a backtracking matcher instead.
+    class RegExpProgram : public Noncopyable {
+    public:
+        // Returns 0 and sets error if the pattern is invalid
+        static RegExpProgram* create(const UString& pattern, bool ignoreCase, bool multiline, const char** error);
+
+        unsigned numSubpatterns() const { return m_numSubpatterns; }
+        bool isBacktracking() const { return m_backtracking; }
+
+        // ovector receives start and end offset pairs for the match and
+        // each subpattern, -1 for subpatterns which did not participate
+        int match(const UChar* subject, int length, int startOffset, int* ovector) const;
+
+        enum OpCode {
+            OpChar,             // a: character, canonicalized when ignoring case
+            OpAny,              // any character but line terminators
+            OpClass,            // a: index of the character class
+            OpSplit,            // a: preferred target, b: other target
+            OpJump,             // a: target
+            OpSave,             // a: capture slot
+            OpReset,            // a: first capture slot, b: end capture slot
+            OpAssertBOL,
+            OpAssertEOL,
+            OpWordBoundary,
+            OpNotWordBoundary,
+            OpBackReference,    // a: subpattern
+            OpLookahead,        // a: instruction after the assertion, b: negated
+            OpLookaheadEnd,
+            OpMark,             // a: register, position at start of loop iteration
+            OpCheck,            // a: register, fails if iteration matched empty
+            OpMatch
+        };
+
+        struct Instruction {
+            OpCode op;
+            int a;
+            int b;
+            int loop;   // innermost optional iteration, -1 if none
+        };
+
+        // Optional iteration which must not match the empty string
+        struct Loop {
+            int slot;   // register set by OpMark
+            int parent; // enclosing optional iteration, -1 if none
+        };
+
+        struct CharacterRange {
+            UChar begin;
+            UChar end;
+        };
+
+        struct CharacterClass {
+            Vector<CharacterRange> ranges;
+            bool negated;
+        };
+
+        struct CharacterSet {
+            bool latin1[256];
+            bool aboveLatin1;
+        };
+
+    private:
+        RegExpProgram();
+
+        bool prefixMatches(const UChar* subject, int length, int position) const;
+        int nextCandidate(const UChar* subject, int length, int position) const;
+        bool matchesCharacter(const Instruction& instruction, UChar c) const;
+        bool classContains(const CharacterClass& characterClass, UChar c) const;
+        bool assertionHolds(OpCode op, const UChar* subject, int length, int position) const;
+
+        unsigned threadState(int pc, const int* registers, int position) const;
+        int matchPike(const UChar* subject, int length, int startOffset, int* ovector) const;
+        int matchBacktracking(const UChar* subject, int length, int startOffset, int* ovector) const;
+
+        struct PikeThreads;
+        void addThread(PikeThreads& threads, unsigned* visited, unsigned generation, Vector<int>& stack,
+                       int pc, const UChar* subject, int length, int position, int* registers) const;
+        int runBacktracking(const UChar* subject, int length, int pc, int position, int* registers, int& steps) const;
+
+        friend class RegExpCompiler;
+
+        Vector<Instruction> m_program;
+        Vector<CharacterClass> m_classes;
+        Vector<Loop> m_loops;
+        // deepest nesting of optional iterations
+        int m_loopDepth;
+        unsigned m_numSubpatterns;
+        // capture slots followed by the loop registers
+        int m_numSlots;
+        // characters at the leading offsets of every match, used to skip
+        // positions where no match can start
+        Vector<CharacterSet> m_prefix;
+        bool m_ignoreCase;
+        bool m_multiline;
+        bool m_anchored;
+        bool m_backtracking;
+    };
+
+} // namespace JSC
+
+#endif // RegExpEngine_h
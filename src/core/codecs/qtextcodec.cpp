@@ -28,7 +28,7 @@
 #include "qlocale.h"
 #include "qlocale_tools_p.h"
 #include "qtextcodec_p.h"
-#include "qmutex.h"
+#include "qreadwritelock.h"
 #include "qhash.h"
 #include "qstdcontainers_p.h"
 #include "qcorecommon_p.h"
@@ -41,6 +41,10 @@
 #include <unicode/ucsdet.h>
 #include <unicode/uclean.h>
 
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
 QT_BEGIN_NAMESPACE
 
 // generated via genmib.py
@@ -943,23 +947,23 @@ static const UChar questionmarkchar[1] = { 0x3f };
 
 static QByteArray localecodec;
 
-static inline bool nameMatch(const QByteArray &name, const QByteArray &name2)
+static inline bool nameMatch(const char* const name, const char* const name2)
 {
-    if (ucnv_compareNames(name.constData(), name2.constData()) == 0) {
+    if (ucnv_compareNames(name, name2) == 0) {
         return true;
     }
     UErrorCode error = U_ZERO_ERROR;
-    const char *iana = ucnv_getStandardName(name.constData(), "IANA", &error);
+    const char *iana = ucnv_getStandardName(name, "IANA", &error);
     if (Q_UNLIKELY(U_FAILURE(error) || !iana)) {
         return false;
     }
-    return (ucnv_compareNames(iana, name2.constData()) == 0);
+    return (ucnv_compareNames(iana, name2) == 0);
 }
 
 static QByteArray checkForCodec(const QByteArray &name)
 {
     foreach(const QByteArray &codec, QTextCodecPrivate::allCodecs()) {
-        if (nameMatch(name, codec)) {
+        if (nameMatch(name.constData(), codec.constData())) {
             return name;
         }
     }
@@ -967,7 +971,7 @@ static QByteArray checkForCodec(const QByteArray &name)
     if (index != -1) {
         const QByteArray namepart = name.left(index);
         foreach(const QByteArray &codec, QTextCodecPrivate::allCodecs()) {
-            if (nameMatch(namepart, codec)) {
+            if (nameMatch(namepart.constData(), codec.constData())) {
                 return namepart;
             }
         }
@@ -1017,20 +1021,24 @@ QByteArray qt_locale_codec()
 
 
 QTextCodecPrivate::QTextCodecPrivate(const QByteArray &aname)
-    : name(aname)
+    : name(aname),
+    native(nativeCodec(aname.constData()))
 {
 }
 
 QTextCodecPrivate::QTextCodecPrivate(const int mib)
+    : native(NoNativeCodec)
 {
     for (qint16 i = 0; i < MIBTblSize; i++) {
         if (mib == MIBTbl[i].mib) {
             name = MIBTbl[i].name;
+            native = nativeCodec(name.constData());
             return;
         }
     }
 
     name = "latin1";
+    native = Latin1Codec;
 }
 
 QList<QByteArray> QTextCodecPrivate::allCodecs()
@@ -1079,53 +1087,532 @@ QList<int> QTextCodecPrivate::allMibs()
     return allmibs;
 }
 
-QString QTextCodecPrivate::convertTo(const char *data, int length, const char* const codec)
+/*
+    Converters opened for the stateless conversions, ICU converters can not
+    be shared between threads and opening one costs far more than resetting
+    it so each thread keeps the most recently used ones around. The buffers
+    are scratch space for the output which is then copied into a result of
+    the exact size. The native codecs never get here
+*/
+class QIcuConverterCache
+{
+public:
+    struct Converter {
+        QByteArray name;
+        UConverter *conv;
+    };
+
+    QIcuConverterCache();
+    ~QIcuConverterCache();
+
+    UConverter* converter(const char* const name);
+
+    QString toUnicode(UConverter *conv, const char *data, int length);
+    QByteArray fromUnicode(UConverter *conv, const QChar *unicode, int length);
+
+    static QIcuConverterCache* instance();
+
+private:
+    Q_DISABLE_COPY(QIcuConverterCache);
+
+    // most recently used first
+    Converter converters[8];
+    int count;
+    QStdVector<UChar> unicodebuffer;
+    QStdVector<char> bytebuffer;
+};
+
+// larger conversions are done directly into the result instead of keeping
+// that much scratch space around
+static const int QIcuConverterCacheBufferSize = 32768;
+
+// the pointer and the flag are trivially destructible so they can be checked
+// from destructors that run after the cache of the thread is destroyed
+static thread_local QIcuConverterCache *icuconvertercache = nullptr;
+static thread_local bool icuconvertercachedestroyed = false;
+
+struct QIcuConverterCacheCleanup
+{
+    ~QIcuConverterCacheCleanup()
+    {
+        delete icuconvertercache;
+        icuconvertercache = nullptr;
+        icuconvertercachedestroyed = true;
+    }
+};
+static thread_local QIcuConverterCacheCleanup icuconvertercachecleanup;
+
+QIcuConverterCache::QIcuConverterCache()
+    : count(0)
+{
+}
+
+QIcuConverterCache::~QIcuConverterCache()
+{
+    for (int i = 0; i < count; i++) {
+        ucnv_close(converters[i].conv);
+    }
+    count = 0;
+}
+
+/*
+    Returns the cache of the calling thread or null if it was already
+    destroyed, in which case a temporary cache must be used
+*/
+QIcuConverterCache* QIcuConverterCache::instance()
+{
+    if (Q_UNLIKELY(!icuconvertercache)) {
+        if (icuconvertercachedestroyed) {
+            return nullptr;
+        }
+        // using the cleanup object registers its destructor for the thread
+        Q_UNUSED(&icuconvertercachecleanup);
+        icuconvertercache = new QIcuConverterCache();
+    }
+    return icuconvertercache;
+}
+
+UConverter* QIcuConverterCache::converter(const char* const name)
 {
+    // aliases of the same codec share the converter
     UErrorCode error = U_ZERO_ERROR;
-    UConverter *conv = ucnv_open(codec, &error);
-    if (Q_UNLIKELY(U_FAILURE(error))) {
-        return QString();
+    const char *canonical = ucnv_getAlias(name, 0, &error);
+    if (U_FAILURE(error) || !canonical) {
+        canonical = name;
     }
 
-    error = U_ZERO_ERROR;
-    ucnv_setSubstString(conv, questionmarkchar, 1, &error);
+    int index = 0;
+    while (index < count && qstrcmp(converters[index].name.constData(), canonical) != 0) {
+        index++;
+    }
 
-    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
-    QStdVector<UChar> result(maxbytes);
-    error = U_ZERO_ERROR;
-    const int convresult = ucnv_toUChars(conv, result.data(), maxbytes, data, length, &error);
-    ucnv_close(conv);
+    if (index == count) {
+        Converter converter;
+        converter.name = canonical;
+        error = U_ZERO_ERROR;
+        converter.conv = ucnv_open(name, &error);
+        if (Q_UNLIKELY(U_FAILURE(error))) {
+            return nullptr;
+        }
+        error = U_ZERO_ERROR;
+        ucnv_setSubstString(converter.conv, questionmarkchar, 1, &error);
+
+        const int maxconverters = sizeof(converters) / sizeof(Converter);
+        if (count == maxconverters) {
+            index = count - 1;
+            ucnv_close(converters[index].conv);
+        } else {
+            index = count;
+            count++;
+        }
+        converters[index] = converter;
+    } else {
+        ucnv_reset(converters[index].conv);
+    }
 
-    if (Q_LIKELY(U_SUCCESS(error))) {
-        return QString(reinterpret_cast<const QChar*>(result.constData()), convresult);
+    for (; index > 0; index--) {
+        qSwap(converters[index], converters[index - 1]);
     }
+    return converters[0].conv;
+}
 
-    return QString();
+QString QIcuConverterCache::toUnicode(UConverter *conv, const char *data, int length)
+{
+    // codecs producing more UTF-16 characters than there are bytes are rare,
+    // for those the conversion is done again with the size ICU reports
+    int capacity = length;
+    UErrorCode error = U_ZERO_ERROR;
+    if (capacity < QIcuConverterCacheBufferSize) {
+        if (unicodebuffer.size() <= capacity) {
+            unicodebuffer.resize(capacity + 1);
+        }
+        const int convresult = ucnv_toUChars(conv, unicodebuffer.data(), capacity, data, length, &error);
+        if (Q_LIKELY(U_SUCCESS(error))) {
+            return QString(reinterpret_cast<const QChar*>(unicodebuffer.constData()), convresult);
+        } else if (error != U_BUFFER_OVERFLOW_ERROR) {
+            return QString();
+        }
+        capacity = convresult;
+        error = U_ZERO_ERROR;
+    }
+
+    QString result(capacity, Qt::Uninitialized);
+    int convresult = ucnv_toUChars(conv, reinterpret_cast<UChar*>(result.data()), capacity, data, length, &error);
+    if (error == U_BUFFER_OVERFLOW_ERROR) {
+        result = QString(convresult, Qt::Uninitialized);
+        error = U_ZERO_ERROR;
+        convresult = ucnv_toUChars(conv, reinterpret_cast<UChar*>(result.data()), convresult, data, length, &error);
+    }
+    if (Q_UNLIKELY(U_FAILURE(error))) {
+        return QString();
+    }
+    result.resize(convresult);
+    return result;
 }
 
-QByteArray QTextCodecPrivate::convertFrom(const QChar *unicode, int length, const char* const codec)
+QByteArray QIcuConverterCache::fromUnicode(UConverter *conv, const QChar *unicode, int length)
 {
+    const int capacity = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
     UErrorCode error = U_ZERO_ERROR;
-    UConverter *conv = ucnv_open(codec, &error);
+    if (capacity < QIcuConverterCacheBufferSize) {
+        if (bytebuffer.size() < capacity) {
+            bytebuffer.resize(capacity);
+        }
+        const int convresult = ucnv_fromUChars(conv, bytebuffer.data(), capacity,
+            reinterpret_cast<const UChar *>(unicode), length, &error);
+        if (Q_LIKELY(U_SUCCESS(error))) {
+            return QByteArray(bytebuffer.constData(), convresult);
+        }
+        return QByteArray();
+    }
+
+    QByteArray result(capacity, Qt::Uninitialized);
+    const int convresult = ucnv_fromUChars(conv, result.data(), capacity,
+        reinterpret_cast<const UChar *>(unicode), length, &error);
     if (Q_UNLIKELY(U_FAILURE(error))) {
         return QByteArray();
     }
+    result.resize(convresult);
+    return result;
+}
 
-    error = U_ZERO_ERROR;
-    ucnv_setSubstString(conv, questionmarkchar, 1, &error);
+QString QTextCodecPrivate::convertTo(const char *data, int length, const char* const codec)
+{
+    switch (nativeCodec(codec)) {
+        case Utf8Codec: {
+            return fromUtf8(data, length);
+        }
+        case Latin1Codec: {
+            QString result(length, Qt::Uninitialized);
+            fromLatin1(reinterpret_cast<ushort*>(result.data()), data, length);
+            return result;
+        }
+        case NoNativeCodec: {
+            break;
+        }
+    }
 
-    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
-    QStdVector<char> result(maxbytes);
-    error = U_ZERO_ERROR;
-    const int convresult = ucnv_fromUChars(conv, result.data(), maxbytes,
-        reinterpret_cast<const UChar *>(unicode), length, &error);
-    ucnv_close(conv);
+    QIcuConverterCache *cache = QIcuConverterCache::instance();
+    if (Q_UNLIKELY(!cache)) {
+        QIcuConverterCache exitcache;
+        UConverter *conv = exitcache.converter(codec);
+        return conv ? exitcache.toUnicode(conv, data, length) : QString();
+    }
+    UConverter *conv = cache->converter(codec);
+    return conv ? cache->toUnicode(conv, data, length) : QString();
+}
 
-    if (Q_LIKELY(U_SUCCESS(error))) {
-        return QByteArray(result.constData(), convresult);
+QByteArray QTextCodecPrivate::convertFrom(const QChar *unicode, int length, const char* const codec)
+{
+    switch (nativeCodec(codec)) {
+        case Utf8Codec: {
+            return toUtf8(unicode, length);
+        }
+        case Latin1Codec: {
+            return toLatin1(unicode, length);
+        }
+        case NoNativeCodec: {
+            break;
+        }
     }
 
-    return QByteArray();
+    QIcuConverterCache *cache = QIcuConverterCache::instance();
+    if (Q_UNLIKELY(!cache)) {
+        QIcuConverterCache exitcache;
+        UConverter *conv = exitcache.converter(codec);
+        return conv ? exitcache.fromUnicode(conv, unicode, length) : QByteArray();
+    }
+    UConverter *conv = cache->converter(codec);
+    return conv ? cache->fromUnicode(conv, unicode, length) : QByteArray();
+}
+
+QTextCodecPrivate::NativeCodec QTextCodecPrivate::nativeCodec(const char* const name)
+{
+    if (nameMatch(name, "UTF-8")) {
+        return Utf8Codec;
+    } else if (nameMatch(name, "ISO_8859-1:1987")) {
+        return Latin1Codec;
+    }
+    return NoNativeCodec;
+}
+
+// Widens the leading ASCII characters of src to UTF-16, 16 at a time where
+// possible. dst must have room for as many characters as there are in src
+static inline void asciiToUtf16(const uchar* &src, const uchar* const end, ushort* &dst)
+{
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    while (end - src >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+        const int nonascii = _mm_movemask_epi8(chunk);
+        if (nonascii) {
+            const int count = __builtin_ctz(nonascii);
+            src += count;
+            dst += count;
+            return;
+        }
+        src += 16;
+        dst += 16;
+    }
+#else
+    while (end - src >= 8) {
+        quint64 chunk;
+        ::memcpy(&chunk, src, sizeof(chunk));
+        if (chunk & Q_UINT64_C(0x8080808080808080)) {
+            break;
+        }
+        for (int i = 0; i < 8; i++) {
+            dst[i] = src[i];
+        }
+        src += 8;
+        dst += 8;
+    }
+#endif
+    while (src < end && *src < 0x80) {
+        *dst++ = *src++;
+    }
+}
+
+// Narrows the leading characters of src which are not greater than limit
+// (either 0x7f or 0xff), 8 at a time where possible. dst must have room for
+// at least 8 characters while there are 8 or more left in src
+static inline void utf16ToNarrow(const ushort* &src, const ushort* const end, uchar* &dst, const ushort limit)
+{
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi16(short(~limit));
+    while (end - src >= 8) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(chunk, chunk));
+        // two bits per character which fits in the limit
+        const int narrow = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, mask), zero));
+        if (narrow != 0xffff) {
+            const int count = __builtin_ctz(~narrow) / 2;
+            src += count;
+            dst += count;
+            return;
+        }
+        src += 8;
+        dst += 8;
+    }
+#endif
+    while (src < end && *src <= limit) {
+        *dst++ = uchar(*src++);
+    }
+}
+
+/*
+    Decodes UTF-8, each maximal subpart of an ill-formed sequence is replaced
+    with U+FFFD just like ICU does it
+*/
+QString QTextCodecPrivate::fromUtf8(const char *data, int length, int *invalidchars)
+{
+    // every byte produces at most one UTF-16 character
+    QString result(length, Qt::Uninitialized);
+    ushort *const begin = reinterpret_cast<ushort*>(result.data());
+    ushort *dst = begin;
+    const uchar *src = reinterpret_cast<const uchar*>(data);
+    const uchar *const end = src + length;
+    int invalid = 0;
+
+    while (src < end) {
+        if (*src < 0x80) {
+            asciiToUtf16(src, end, dst);
+            if (src >= end) {
+                break;
+            }
+        }
+
+        const uchar lead = *src++;
+        int needed = 0;
+        uint ucs4 = 0;
+        // the second byte has narrower range for some leading bytes to
+        // reject overlong forms, surrogates and values above U+10FFFF
+        uchar lower = 0x80;
+        uchar upper = 0xbf;
+        if (lead >= 0xc2 && lead <= 0xdf) {
+            needed = 1;
+            ucs4 = (lead & 0x1f);
+        } else if (lead >= 0xe0 && lead <= 0xef) {
+            needed = 2;
+            ucs4 = (lead & 0x0f);
+            if (lead == 0xe0) {
+                lower = 0xa0;
+            } else if (lead == 0xed) {
+                upper = 0x9f;
+            }
+        } else if (lead >= 0xf0 && lead <= 0xf4) {
+            needed = 3;
+            ucs4 = (lead & 0x07);
+            if (lead == 0xf0) {
+                lower = 0x90;
+            } else if (lead == 0xf4) {
+                upper = 0x8f;
+            }
+        } else {
+            *dst++ = QChar::ReplacementCharacter;
+            invalid++;
+            continue;
+        }
+
+        int consumed = 0;
+        while (consumed < needed && src < end && *src >= lower && *src <= upper) {
+            ucs4 = (ucs4 << 6) | (*src++ & 0x3f);
+            lower = 0x80;
+            upper = 0xbf;
+            consumed++;
+        }
+        if (Q_UNLIKELY(consumed != needed)) {
+            *dst++ = QChar::ReplacementCharacter;
+            invalid += consumed + 1;
+        } else if (QChar::requiresSurrogates(ucs4)) {
+            *dst++ = QChar::highSurrogate(ucs4);
+            *dst++ = QChar::lowSurrogate(ucs4);
+        } else {
+            *dst++ = ushort(ucs4);
+        }
+    }
+
+    if (invalidchars) {
+        *invalidchars += invalid;
+    }
+    result.resize(dst - begin);
+    return result;
+}
+
+static inline void appendInvalid(uchar* &dst, const bool invalidtonull)
+{
+    if (invalidtonull) {
+        *dst++ = '\\';
+        *dst++ = '0';
+    } else {
+        *dst++ = '?';
+    }
+}
+
+/*
+    Encodes UTF-8, unpaired surrogates are replaced with question mark or
+    "\0" depending on invalidtonull just like ICU does it
+*/
+QByteArray QTextCodecPrivate::toUtf8(const QChar *unicode, int length, const bool invalidtonull, int *invalidchars)
+{
+    // every UTF-16 character produces at most three bytes
+    QByteArray result(length * 3, Qt::Uninitialized);
+    uchar *const begin = reinterpret_cast<uchar*>(result.data());
+    uchar *dst = begin;
+    const ushort *src = reinterpret_cast<const ushort*>(unicode);
+    const ushort *const end = src + length;
+    int invalid = 0;
+
+    while (src < end) {
+        if (*src < 0x80) {
+            utf16ToNarrow(src, end, dst, 0x7f);
+            if (src >= end) {
+                break;
+            }
+        }
+
+        const ushort ucs = *src++;
+        if (ucs < 0x800) {
+            *dst++ = 0xc0 | uchar(ucs >> 6);
+            *dst++ = 0x80 | uchar(ucs & 0x3f);
+        } else if ((ucs & 0xf800) != 0xd800) {
+            *dst++ = 0xe0 | uchar(ucs >> 12);
+            *dst++ = 0x80 | uchar((ucs >> 6) & 0x3f);
+            *dst++ = 0x80 | uchar(ucs & 0x3f);
+        } else if (QChar::isHighSurrogate(ucs) && src < end && QChar::isLowSurrogate(*src)) {
+            const uint ucs4 = QChar::surrogateToUcs4(ucs, *src++);
+            *dst++ = 0xf0 | uchar(ucs4 >> 18);
+            *dst++ = 0x80 | uchar((ucs4 >> 12) & 0x3f);
+            *dst++ = 0x80 | uchar((ucs4 >> 6) & 0x3f);
+            *dst++ = 0x80 | uchar(ucs4 & 0x3f);
+        } else {
+            appendInvalid(dst, invalidtonull);
+            invalid++;
+        }
+    }
+
+    if (invalidchars) {
+        *invalidchars += invalid;
+    }
+    result.resize(dst - begin);
+    return result;
+}
+
+/*
+    Widens Latin-1, dst must have room for len characters
+*/
+void QTextCodecPrivate::fromLatin1(ushort *dst, const char *data, int length)
+{
+    const uchar *src = reinterpret_cast<const uchar*>(data);
+    const uchar *const end = src + length;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    while (end - src >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+        src += 16;
+        dst += 16;
+    }
+#endif
+    while (src < end) {
+        *dst++ = *src++;
+    }
+}
+
+// ICU skips these instead of substituting them when they can not be encoded,
+// see IS_DEFAULT_IGNORABLE_CODE_POINT() in ucnv_err.cpp
+static inline bool isDefaultIgnorable(const uint ucs4)
+{
+    return (ucs4 == 0x034F || ucs4 == 0x061C || ucs4 == 0x115F || ucs4 == 0x1160
+        || (ucs4 >= 0x17B4 && ucs4 <= 0x17B5) || (ucs4 >= 0x180B && ucs4 <= 0x180F)
+        || (ucs4 >= 0x200B && ucs4 <= 0x200F) || (ucs4 >= 0x202A && ucs4 <= 0x202E)
+        || (ucs4 >= 0x2060 && ucs4 <= 0x206F) || ucs4 == 0x3164
+        || (ucs4 >= 0xFE00 && ucs4 <= 0xFE0F) || ucs4 == 0xFEFF || ucs4 == 0xFFA0
+        || (ucs4 >= 0xFFF0 && ucs4 <= 0xFFF8) || (ucs4 >= 0x1BCA0 && ucs4 <= 0x1BCA3)
+        || (ucs4 >= 0x1D173 && ucs4 <= 0x1D17A) || (ucs4 >= 0xE0000 && ucs4 <= 0xE0FFF));
+}
+
+/*
+    Encodes Latin-1, code points above U+00FF are replaced with question mark
+    or "\0" depending on invalidtonull, or skipped if they are default
+    ignorable, just like ICU does it
+*/
+QByteArray QTextCodecPrivate::toLatin1(const QChar *unicode, int length, const bool invalidtonull, int *invalidchars)
+{
+    QByteArray result(invalidtonull ? length * 2 : length, Qt::Uninitialized);
+    uchar *const begin = reinterpret_cast<uchar*>(result.data());
+    uchar *dst = begin;
+    const ushort *src = reinterpret_cast<const ushort*>(unicode);
+    const ushort *const end = src + length;
+    int invalid = 0;
+
+    while (src < end) {
+        utf16ToNarrow(src, end, dst, 0xff);
+        if (src >= end) {
+            break;
+        }
+
+        // a surrogate pair is replaced as one character
+        uint ucs4 = *src++;
+        if (QChar::isHighSurrogate(ucs4) && src < end && QChar::isLowSurrogate(*src)) {
+            ucs4 = QChar::surrogateToUcs4(ushort(ucs4), *src++);
+            invalid++;
+        }
+        if (!isDefaultIgnorable(ucs4)) {
+            appendInvalid(dst, invalidtonull);
+        }
+        invalid++;
+    }
+
+    if (invalidchars) {
+        *invalidchars += invalid;
+    }
+    result.resize(dst - begin);
+    return result;
 }
 
 #ifndef QT_NO_TEXTCODEC
@@ -1165,6 +1652,7 @@ static void icu_to_callback (
 
 QTextConverterPrivate::QTextConverterPrivate(const QByteArray &aname)
     : name(aname),
+    native(QTextCodecPrivate::nativeCodec(aname.constData())),
     flags(QTextConverter::DefaultConversion),
     conv(nullptr),
     invalidchars(0)
@@ -1172,18 +1660,21 @@ QTextConverterPrivate::QTextConverterPrivate(const QByteArray &aname)
 }
 
 QTextConverterPrivate::QTextConverterPrivate(const int mib)
-    : flags(QTextConverter::DefaultConversion),
+    : native(QTextCodecPrivate::NoNativeCodec),
+    flags(QTextConverter::DefaultConversion),
     conv(nullptr),
     invalidchars(0)
 {
     for (qint16 i = 0; i < MIBTblSize; i++) {
         if (mib == MIBTbl[i].mib) {
             name = MIBTbl[i].name;
+            native = QTextCodecPrivate::nativeCodec(name.constData());
             return;
         }
     }
 
     name = "latin1";
+    native = QTextCodecPrivate::Latin1Codec;
 }
 
 QTextConverterPrivate::~QTextConverterPrivate()
@@ -1227,7 +1718,7 @@ void QTextConverterPrivate::invalidChars(int length) const
 
 
 #ifndef QT_NO_THREAD
-Q_GLOBAL_STATIC(QMutex, textCodecsMutex)
+Q_GLOBAL_STATIC(QReadWriteLock, textCodecsLock)
 #endif
 
 class QTextCodecCleanup : public QList<QTextCodec*>
@@ -1253,6 +1744,34 @@ QTextCodecCleanup::~QTextCodecCleanup()
 }
 Q_GLOBAL_STATIC(QTextCodecCleanup, qGlobalQTextCodec)
 
+// the cache must be locked by the caller
+static QTextCodec *cachedCodecForName(const QByteArray &name)
+{
+    for (int i = 0; i < qGlobalQTextCodec()->size(); ++i) {
+        QTextCodec *cursor = qGlobalQTextCodec()->at(i);
+        if (nameMatch(name, cursor->name())) {
+            return cursor;
+        }
+        foreach (const QByteArray &alias, cursor->aliases()) {
+            if (nameMatch(name, alias)) {
+                return cursor;
+            }
+        }
+    }
+    return nullptr;
+}
+
+static QTextCodec *cachedCodecForMib(int mib)
+{
+    for (int i = 0; i < qGlobalQTextCodec()->size(); ++i) {
+        QTextCodec *cursor = qGlobalQTextCodec()->at(i);
+        if (cursor->mibEnum() == mib) {
+            return cursor;
+        }
+    }
+    return nullptr;
+}
+
 /*!
     \class QTextCodec
     \brief The QTextCodec class provides conversions between text encodings.
@@ -1435,26 +1954,24 @@ QTextCodec *QTextCodec::codecForName(const QByteArray &name)
 
     {
 #ifndef QT_NO_THREAD
-        QMutexLocker locker(textCodecsMutex());
+        QReadLocker locker(textCodecsLock());
 #endif
-        for (int i = 0; i < qGlobalQTextCodec()->size(); ++i) {
-            QTextCodec *cursor = qGlobalQTextCodec()->at(i);
-            if (nameMatch(name, cursor->name())) {
-                return cursor;
-            }
-            foreach (const QByteArray &alias, cursor->aliases()) {
-                if (nameMatch(name, alias)) {
-                    return cursor;
-                }
-            }
+        QTextCodec *cached = cachedCodecForName(name);
+        if (cached) {
+            return cached;
         }
     }
 
     foreach(const QByteArray &codec, QTextCodec::availableCodecs()) {
         if (nameMatch(name, codec)) {
 #ifndef QT_NO_THREAD
-            QMutexLocker locker(textCodecsMutex());
+            QWriteLocker locker(textCodecsLock());
 #endif
+            // another thread may have created the codec in the meantime
+            QTextCodec *cached = cachedCodecForName(name);
+            if (cached) {
+                return cached;
+            }
             QTextCodec* newcodec = new QTextCodec(codec);
             qGlobalQTextCodec()->append(newcodec);
             return newcodec;
@@ -1473,21 +1990,24 @@ QTextCodec* QTextCodec::codecForMib(int mib)
 {
     {
 #ifndef QT_NO_THREAD
-        QMutexLocker locker(textCodecsMutex());
+        QReadLocker locker(textCodecsLock());
 #endif
-        for (int i = 0; i < qGlobalQTextCodec()->size(); ++i) {
-            QTextCodec *cursor = qGlobalQTextCodec()->at(i);
-            if (cursor->mibEnum() == mib) {
-                return cursor;
-            }
+        QTextCodec *cached = cachedCodecForMib(mib);
+        if (cached) {
+            return cached;
         }
     }
 
     foreach(const int codec, QTextCodec::availableMibs()) {
         if (mib == codec) {
 #ifndef QT_NO_THREAD
-            QMutexLocker locker(textCodecsMutex());
+            QWriteLocker locker(textCodecsLock());
 #endif
+            // another thread may have created the codec in the meantime
+            QTextCodec *cached = cachedCodecForMib(mib);
+            if (cached) {
+                return cached;
+            }
             QTextCodec* newcodec = new QTextCodec(codec);
             qGlobalQTextCodec()->append(newcodec);
             return newcodec;
@@ -1619,6 +2139,17 @@ QList<QByteArray> QTextCodec::aliases() const
 */
 QByteArray QTextCodec::fromUnicode(const QChar *data, int length) const
 {
+    switch (d_ptr->native) {
+        case QTextCodecPrivate::Utf8Codec: {
+            return QTextCodecPrivate::toUtf8(data, length);
+        }
+        case QTextCodecPrivate::Latin1Codec: {
+            return QTextCodecPrivate::toLatin1(data, length);
+        }
+        case QTextCodecPrivate::NoNativeCodec: {
+            break;
+        }
+    }
     return QTextCodecPrivate::convertFrom(data, length, d_ptr->name.constData());
 }
 
@@ -1629,6 +2160,19 @@ QByteArray QTextCodec::fromUnicode(const QChar *data, int length) const
 */
 QString QTextCodec::toUnicode(const char *data, int length) const
 {
+    switch (d_ptr->native) {
+        case QTextCodecPrivate::Utf8Codec: {
+            return QTextCodecPrivate::fromUtf8(data, length);
+        }
+        case QTextCodecPrivate::Latin1Codec: {
+            QString result(length, Qt::Uninitialized);
+            QTextCodecPrivate::fromLatin1(reinterpret_cast<ushort*>(result.data()), data, length);
+            return result;
+        }
+        case QTextCodecPrivate::NoNativeCodec: {
+            break;
+        }
+    }
     return QTextCodecPrivate::convertTo(data, length, d_ptr->name.constData());
 }
 
@@ -1853,6 +2397,7 @@ QTextConverter::QTextConverter()
     Constructs a QTextConverter copy of \a other.
 */
 QTextConverter::QTextConverter(const QTextConverter &other)
+    : d_ptr(new QTextConverterPrivate(other.d_ptr->name))
 {
     operator=(other);
 }
@@ -1942,6 +2487,7 @@ QTextConverter& QTextConverter::operator=(const QTextConverter &other)
         }
     }
     d_ptr->name = other.d_ptr->name;
+    d_ptr->native = other.d_ptr->native;
     d_ptr->flags = other.d_ptr->flags;
     d_ptr->invalidchars = other.d_ptr->invalidchars;
     return *this;
@@ -1954,17 +2500,29 @@ QTextConverter& QTextConverter::operator=(const QTextConverter &other)
 */
 QByteArray QTextConverter::fromUnicode(const QChar *data, int length) const
 {
+    const bool invalidtonull = (d_ptr->flags & QTextConverter::ConvertInvalidToNull);
+    switch (d_ptr->native) {
+        case QTextCodecPrivate::Utf8Codec: {
+            return QTextCodecPrivate::toUtf8(data, length, invalidtonull, &d_ptr->invalidchars);
+        }
+        case QTextCodecPrivate::Latin1Codec: {
+            return QTextCodecPrivate::toLatin1(data, length, invalidtonull, &d_ptr->invalidchars);
+        }
+        case QTextCodecPrivate::NoNativeCodec: {
+            break;
+        }
+    }
+
     UConverter *conv = d_ptr->getConverter();
     if (!conv) {
         return QByteArray();
     }
-
-    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
-    QStdVector<char> result(maxbytes);
-    UErrorCode error = U_ZERO_ERROR;
-    const int convresult = ucnv_fromUChars(conv, result.data(), maxbytes,
-        reinterpret_cast<const UChar *>(data), length, &error);
-    return QByteArray(result.constData(), convresult);
+    QIcuConverterCache *cache = QIcuConverterCache::instance();
+    if (Q_UNLIKELY(!cache)) {
+        QIcuConverterCache exitcache;
+        return exitcache.fromUnicode(conv, data, length);
+    }
+    return cache->fromUnicode(conv, data, length);
 }
 
 /*!
@@ -1974,34 +2532,49 @@ QByteArray QTextConverter::fromUnicode(const QChar *data, int length) const
 */
 QString QTextConverter::toUnicode(const char *data, int length) const
 {
+    switch (d_ptr->native) {
+        case QTextCodecPrivate::Utf8Codec: {
+            return QTextCodecPrivate::fromUtf8(data, length, &d_ptr->invalidchars);
+        }
+        case QTextCodecPrivate::Latin1Codec: {
+            QString result(length, Qt::Uninitialized);
+            QTextCodecPrivate::fromLatin1(reinterpret_cast<ushort*>(result.data()), data, length);
+            return result;
+        }
+        case QTextCodecPrivate::NoNativeCodec: {
+            break;
+        }
+    }
+
     UConverter *conv = d_ptr->getConverter();
     if (!conv) {
         return QString();
     }
 
-    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(length, ucnv_getMaxCharSize(conv));
-    QStdVector<UChar> result(maxbytes);
-    UErrorCode error = U_ZERO_ERROR;
-    const int convresult = ucnv_toUChars(conv, result.data(), maxbytes, data, length, &error);
+    QIcuConverterCache *cache = QIcuConverterCache::instance();
+    QString result;
+    if (Q_UNLIKELY(!cache)) {
+        QIcuConverterCache exitcache;
+        result = exitcache.toUnicode(conv, data, length);
+    } else {
+        result = cache->toUnicode(conv, data, length);
+    }
     // regardless if the data has BOM or not, BOMs shall be generated explicitly only by QTextStream
-    if (convresult >= 4 && qstrnicmp("UTF-32", d_ptr->name.constData(), 6) == 0) {
-        const uchar* resultuchar = reinterpret_cast<const uchar*>(result.constData());
+    const uchar* resultuchar = reinterpret_cast<const uchar*>(result.constData());
+    if (result.size() >= 4 && qstrnicmp("UTF-32", d_ptr->name.constData(), 6) == 0) {
         Q_ASSERT(sizeof(qt_utf32le_bom) == sizeof(qt_utf32be_bom));
         if (::memcmp(resultuchar, qt_utf32le_bom, sizeof(qt_utf32le_bom)) == 0
             || ::memcmp(resultuchar, qt_utf32be_bom, sizeof(qt_utf32be_bom)) == 0) {
-            const int bomoffset = (sizeof(qt_utf32le_bom) / sizeof(QChar));
-            return QString(reinterpret_cast<const QChar*>(result.constData()) + bomoffset, convresult - bomoffset);
+            result.remove(0, sizeof(qt_utf32le_bom) / sizeof(QChar));
         }
-    } else if (convresult >= 2 && qstrnicmp("UTF-16", d_ptr->name.constData(), 6) == 0) {
-        const uchar* resultuchar = reinterpret_cast<const uchar*>(result.constData());
+    } else if (result.size() >= 2 && qstrnicmp("UTF-16", d_ptr->name.constData(), 6) == 0) {
         Q_ASSERT(sizeof(qt_utf16le_bom) == sizeof(qt_utf16be_bom));
         if (::memcmp(resultuchar, qt_utf16le_bom, sizeof(qt_utf16le_bom)) == 0
             || ::memcmp(resultuchar, qt_utf16be_bom, sizeof(qt_utf16be_bom)) == 0) {
-            const int bomoffset = (sizeof(qt_utf16le_bom) / sizeof(QChar));
-            return QString(reinterpret_cast<const QChar*>(result.constData()) + bomoffset, convresult - bomoffset);
+            result.remove(0, sizeof(qt_utf16le_bom) / sizeof(QChar));
         }
     }
-    return QString(reinterpret_cast<const QChar*>(result.constData()), convresult);
+    return result;
 }
 
 #endif // QT_NO_TEXTCODEC
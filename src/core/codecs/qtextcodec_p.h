@@ -57,7 +57,21 @@ public:
     static QString convertTo(const char *data, int len, const char* const codec);
     static QByteArray convertFrom(const QChar *unicode, int len, const char* const codec);
 
+    // native conversions for the most common codecs, ICU is not involved
+    enum NativeCodec {
+        NoNativeCodec,
+        Utf8Codec,
+        Latin1Codec
+    };
+    static NativeCodec nativeCodec(const char* const name);
+
+    static QString fromUtf8(const char *data, int len, int *invalidchars = nullptr);
+    static QByteArray toUtf8(const QChar *unicode, int len, const bool invalidtonull = false, int *invalidchars = nullptr);
+    static void fromLatin1(ushort *dst, const char *data, int len);
+    static QByteArray toLatin1(const QChar *unicode, int len, const bool invalidtonull = false, int *invalidchars = nullptr);
+
     QByteArray name;
+    NativeCodec native;
 private:
     Q_DISABLE_COPY(QTextCodecPrivate);
 };
@@ -74,6 +88,7 @@ public:
     void invalidChars(int length) const;
 
     QByteArray name;
+    QTextCodecPrivate::NativeCodec native;
     QTextConverter::ConversionFlags flags;
     UConverter* conv;
     mutable int invalidchars;
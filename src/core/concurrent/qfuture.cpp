@@ -0,0 +1,229 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qfuture.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QFuture
+    \brief The QFuture class represents the result of an asynchronous
+    computation.
+    \since 4.14
+
+    \ingroup thread
+
+    A QFuture is returned by the functions in the QtConcurrent namespace
+    and by QPromise::future(). It can be used to wait for the computation
+    to finish, to query its progress, to cancel it and to get its result.
+    Copies of a QFuture refer to the same computation.
+
+    Unlike the future of Qt 4, a QFuture holds a single result. Functions
+    that produce many values, such as QtConcurrent::mapped(), return a
+    future holding the whole container.
+
+    Cancellation is cooperative, the computation checks isCanceled() and
+    stops early. The result of a canceled computation is undefined.
+
+    \sa QPromise, QtConcurrent
+*/
+
+/*!
+    \fn QFuture::QFuture()
+
+    Constructs a future that is finished and canceled.
+*/
+
+/*!
+    \fn void QFuture::cancel()
+
+    Requests the computation to stop as soon as possible.
+
+    \sa isCanceled()
+*/
+
+/*!
+    \fn bool QFuture::isCanceled() const
+
+    Returns true if cancel() was called, otherwise returns false.
+*/
+
+/*!
+    \fn bool QFuture::isStarted() const
+
+    Returns true if the computation was started, otherwise returns false.
+*/
+
+/*!
+    \fn bool QFuture::isRunning() const
+
+    Returns true if the computation was started and is not yet finished,
+    otherwise returns false.
+*/
+
+/*!
+    \fn bool QFuture::isFinished() const
+
+    Returns true if the computation is finished, otherwise returns false.
+*/
+
+/*!
+    \fn int QFuture::progressValue() const
+
+    Returns the progress of the computation, between progressMinimum() and
+    progressMaximum().
+*/
+
+/*!
+    \fn void QFuture::waitForFinished()
+
+    Blocks until the computation is finished.
+*/
+
+/*!
+    \fn T QFuture::result() const
+
+    Waits for the computation to finish and returns its result.
+*/
+
+/*!
+    \class QPromise
+    \brief The QPromise class provides the producer side of a QFuture.
+    \since 4.14
+
+    \ingroup thread
+
+    Call start() when the computation starts, setResult() to store the
+    result and finish() once it is done. The computation can check
+    isCanceled() to stop early and report its progress with
+    setProgressRange() and setProgressValue().
+
+    A promise that is destroyed before finish() is called cancels and
+    finishes its future, so that threads waiting for it do not block
+    forever.
+
+    QPromise<void> has no setResult(), its future only reports that the
+    computation is finished.
+
+    \sa QFuture
+*/
+
+QFutureState::QFutureState()
+    : state(0),
+    progressMin(0),
+    progressMax(0),
+    progress(0)
+{
+}
+
+QFutureState::~QFutureState()
+{
+}
+
+void QFutureState::reportStarted()
+{
+    QMutexLocker locker(&mutex);
+    state.store(state.load() | Started);
+}
+
+void QFutureState::reportFinished()
+{
+    QMutexLocker locker(&mutex);
+    state.store(state.load() | Started | Finished);
+    finished.wakeAll();
+}
+
+void QFutureState::cancel()
+{
+    QMutexLocker locker(&mutex);
+    state.store(state.load() | Canceled);
+}
+
+bool QFutureState::isStarted() const
+{
+    return (state.load() & Started);
+}
+
+bool QFutureState::isRunning() const
+{
+    return ((state.load() & (Started | Finished)) == Started);
+}
+
+bool QFutureState::isFinished() const
+{
+    return (state.load() & Finished);
+}
+
+bool QFutureState::isCanceled() const
+{
+    return (state.load() & Canceled);
+}
+
+void QFutureState::setProgressRange(int minimum, int maximum)
+{
+    progressMin.store(minimum);
+    progressMax.store(qMax(minimum, maximum));
+    progress.store(minimum);
+}
+
+/*!
+    \internal
+    Sets the progress to \a value, the progress never goes backwards so
+    values reported out of order by concurrent workers are ignored.
+*/
+void QFutureState::setProgressValue(int value)
+{
+    int current = progress.load();
+    while (value > current) {
+        if (progress.testAndSetOrdered(current, value)) {
+            break;
+        }
+        current = progress.load();
+    }
+}
+
+int QFutureState::progressMinimum() const
+{
+    return progressMin.load();
+}
+
+int QFutureState::progressMaximum() const
+{
+    return progressMax.load();
+}
+
+int QFutureState::progressValue() const
+{
+    return progress.load();
+}
+
+void QFutureState::waitForFinished()
+{
+    QMutexLocker locker(&mutex);
+    while (!(state.load() & Finished)) {
+        finished.wait(&mutex);
+    }
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
@@ -0,0 +1,169 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QFUTURE_H
+#define QFUTURE_H
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qwaitcondition.h>
+#include <QtCore/qshareddata.h>
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QFutureState : public QSharedData
+{
+public:
+    QFutureState();
+    virtual ~QFutureState();
+
+    void reportStarted();
+    void reportFinished();
+    void cancel();
+
+    bool isStarted() const;
+    bool isRunning() const;
+    bool isFinished() const;
+    bool isCanceled() const;
+
+    void setProgressRange(int minimum, int maximum);
+    void setProgressValue(int value);
+    int progressMinimum() const;
+    int progressMaximum() const;
+    int progressValue() const;
+
+    void waitForFinished();
+
+private:
+    Q_DISABLE_COPY(QFutureState)
+
+    enum State {
+        Started = 0x1,
+        Finished = 0x2,
+        Canceled = 0x4
+    };
+
+    QMutex mutex;
+    QWaitCondition finished;
+    QAtomicInt state;
+    QAtomicInt progressMin;
+    QAtomicInt progressMax;
+    QAtomicInt progress;
+};
+
+template <typename T>
+class QFutureData : public QFutureState
+{
+public:
+    T value;
+};
+
+template <>
+class QFutureData<void> : public QFutureState
+{
+};
+
+template <typename T>
+class QFuture
+{
+public:
+    inline QFuture() : d(new QFutureData<T>) { d->cancel(); d->reportFinished(); }
+    inline explicit QFuture(QFutureData<T> *data) : d(data) { }
+
+    inline bool operator==(const QFuture &other) const { return d == other.d; }
+    inline bool operator!=(const QFuture &other) const { return d != other.d; }
+
+    inline void cancel() { d->cancel(); }
+    inline bool isCanceled() const { return d->isCanceled(); }
+
+    inline bool isStarted() const { return d->isStarted(); }
+    inline bool isRunning() const { return d->isRunning(); }
+    inline bool isFinished() const { return d->isFinished(); }
+
+    inline int progressMinimum() const { return d->progressMinimum(); }
+    inline int progressMaximum() const { return d->progressMaximum(); }
+    inline int progressValue() const { return d->progressValue(); }
+
+    inline void waitForFinished() { d->waitForFinished(); }
+    inline T result() const { d->waitForFinished(); return d->value; }
+
+private:
+    QExplicitlySharedDataPointer<QFutureData<T> > d;
+};
+
+template <typename T>
+class QPromiseBase
+{
+public:
+    inline QPromiseBase() : d(new QFutureData<T>) { }
+    inline ~QPromiseBase()
+    {
+        // a promise that is never fulfilled is canceled so that waiters return
+        if (!d->isFinished()) {
+            d->cancel();
+            d->reportFinished();
+        }
+    }
+
+    inline QFuture<T> future() const { return QFuture<T>(d.data()); }
+
+    inline void start() { d->reportStarted(); }
+    inline void finish() { d->reportFinished(); }
+
+    inline bool isCanceled() const { return d->isCanceled(); }
+
+    inline void setProgressRange(int minimum, int maximum) { d->setProgressRange(minimum, maximum); }
+    inline void setProgressValue(int value) { d->setProgressValue(value); }
+
+protected:
+    QExplicitlySharedDataPointer<QFutureData<T> > d;
+
+private:
+    Q_DISABLE_COPY(QPromiseBase)
+};
+
+template <typename T>
+class QPromise : public QPromiseBase<T>
+{
+public:
+    inline QPromise() { }
+
+    inline void setResult(const T &value) { this->d->value = value; }
+
+private:
+    Q_DISABLE_COPY(QPromise)
+};
+
+template <>
+class QPromise<void> : public QPromiseBase<void>
+{
+public:
+    inline QPromise() { }
+
+private:
+    Q_DISABLE_COPY(QPromise)
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
+
+#endif // QFUTURE_H
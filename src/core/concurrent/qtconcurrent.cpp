@@ -0,0 +1,192 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qtconcurrent.h"
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \namespace QtConcurrent
+    \brief The QtConcurrent namespace provides high-level APIs that make it
+    possible to write multi-threaded programs without using low-level
+    threading primitives.
+    \since 4.14
+
+    \ingroup thread
+
+    The functions split the work over a sequence into blocks that are run
+    on the QThreadPool::globalInstance() threads. The thread that calls
+    them takes part in the work, so calling them from a pool thread does
+    not dead-lock when the pool is busy.
+
+    \list
+    \o blockingMap() and map() call a function for each item of a
+       sequence, modifying the items in place.
+    \o blockingMapped() and mapped() return a new sequence holding the
+       values returned by the function for each item.
+    \o blockingFilter(), filter(), blockingFiltered() and filtered()
+       keep the items for which a function returns true.
+    \o blockingMappedReduced() and mappedReduced() map the items and
+       combine the mapped values into a single result. The reduce function
+       is called from one thread in the order of the sequence.
+    \o run() calls a function in a pool thread.
+    \endlist
+
+    The non-blocking variants return a QFuture that can be used to wait
+    for the result, follow the progress and cancel the work. Sequences
+    passed by reference to map() and filter() must stay alive until the
+    future is finished, the other variants work on a copy.
+
+    The functions work with Qt containers that provide random access
+    iterators, such as QList and QVector.
+
+    \sa QFuture, QThreadPool, qParallelSort()
+*/
+
+namespace QtConcurrent {
+
+// blocks shared by the thread calling runBlocks() and the helper tasks, a
+// helper that starts after all blocks were taken does not touch the kernel
+class BlockShared
+{
+public:
+    BlockShared(BlockKernel *kernel, int count, int blockSize, QFutureState *state, int helpers)
+        : ref(helpers + 1), next(0), done(0),
+        kernel(kernel), count(count), blockSize(blockSize), state(state)
+    { }
+
+    void work()
+    {
+        for (;;) {
+            const int begin = next.fetchAndAddOrdered(blockSize);
+            if (begin >= count) {
+                break;
+            }
+            const int end = qMin(begin + blockSize, count);
+            if (!state || !state->isCanceled()) {
+                kernel->runBlock(begin, end);
+            }
+            const int finished = done.fetchAndAddOrdered(end - begin) + (end - begin);
+            if (state) {
+                state->setProgressValue(finished);
+            }
+            if (finished == count) {
+                QMutexLocker locker(&mutex);
+                allDone.wakeAll();
+            }
+        }
+    }
+
+    void wait()
+    {
+        QMutexLocker locker(&mutex);
+        while (done.load() != count) {
+            allDone.wait(&mutex);
+        }
+    }
+
+    QAtomicInt ref;
+
+private:
+    QAtomicInt next;
+    QAtomicInt done;
+    BlockKernel *kernel;
+    const int count;
+    const int blockSize;
+    QFutureState *state;
+    QMutex mutex;
+    QWaitCondition allDone;
+};
+
+class BlockRunnable : public QRunnable
+{
+public:
+    BlockRunnable(BlockShared *shared) : shared(shared) { }
+
+    void run() final
+    {
+        shared->work();
+        if (!shared->ref.deref()) {
+            delete shared;
+        }
+    }
+
+private:
+    BlockShared *shared;
+};
+
+BlockKernel::~BlockKernel()
+{
+}
+
+/*!
+    \internal
+    Runs \a kernel over [0, \a count) in blocks, using the global thread
+    pool for the blocks the calling thread does not get to. The progress of
+    \a state, if not null, is the number of items done and blocks are
+    skipped once it is canceled.
+*/
+void runBlocks(BlockKernel *kernel, int count, QFutureState *state)
+{
+    if (state) {
+        state->setProgressRange(0, count);
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    // a few blocks per thread so that uneven blocks balance out
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int threadCount = qMax(1, pool->maxThreadCount());
+    const int blockSize = qMax(1, count / (threadCount * 4));
+    const int blockCount = (count + blockSize - 1) / blockSize;
+    const int helpers = qMin(threadCount, blockCount) - 1;
+
+    if (helpers <= 0) {
+        for (int begin = 0; begin < count; begin += blockSize) {
+            const int end = qMin(begin + blockSize, count);
+            if (!state || !state->isCanceled()) {
+                kernel->runBlock(begin, end);
+            }
+            if (state) {
+                state->setProgressValue(end);
+            }
+        }
+        return;
+    }
+
+    BlockShared *shared = new BlockShared(kernel, count, blockSize, state, helpers);
+    for (int i = 0; i < helpers; ++i) {
+        pool->start(new BlockRunnable(shared));
+    }
+    shared->work();
+    shared->wait();
+    if (!shared->ref.deref()) {
+        delete shared;
+    }
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
@@ -0,0 +1,313 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QTCONCURRENT_H
+#define QTCONCURRENT_H
+
+#include <QtCore/qfuture.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
+
+#include <type_traits>
+#include <utility>
+
+#ifndef QT_NO_THREAD
+
+QT_BEGIN_NAMESPACE
+
+namespace QtConcurrent {
+
+class Q_CORE_EXPORT BlockKernel
+{
+public:
+    virtual ~BlockKernel();
+    virtual void runBlock(int begin, int end) = 0;
+};
+
+Q_CORE_EXPORT void runBlocks(BlockKernel *kernel, int count, QFutureState *state = nullptr);
+
+template <typename Functor>
+class FunctorBlockKernel : public BlockKernel
+{
+public:
+    inline FunctorBlockKernel(Functor &functor) : functor(functor) { }
+    void runBlock(int begin, int end) final { functor(begin, end); }
+
+private:
+    Functor &functor;
+};
+
+// calls functor(begin, end) for blocks of [0, count) on the global thread
+// pool, the calling thread takes part and the call returns once all blocks
+// are done
+template <typename Functor>
+inline void forEachBlock(int count, Functor functor, QFutureState *state = nullptr)
+{
+    FunctorBlockKernel<Functor> kernel(functor);
+    runBlocks(&kernel, count, state);
+}
+
+template <typename T, typename Functor>
+struct StoreResult
+{
+    static inline void call(QFutureData<T> *data, Functor &functor) { data->value = functor(data); }
+};
+
+template <typename Functor>
+struct StoreResult<void, Functor>
+{
+    static inline void call(QFutureData<void> *data, Functor &functor) { functor(data); }
+};
+
+template <typename T, typename Functor>
+class FutureRunnable : public QRunnable
+{
+public:
+    inline FutureRunnable(QFutureData<T> *data, const Functor &functor)
+        : data(data), functor(functor)
+    { }
+
+    void run() final
+    {
+        StoreResult<T, Functor>::call(data.data(), functor);
+        data->reportFinished();
+    }
+
+private:
+    QExplicitlySharedDataPointer<QFutureData<T> > data;
+    Functor functor;
+};
+
+// runs functor(QFutureState *) on the global thread pool, the future gets
+// its return value
+template <typename T, typename Functor>
+inline QFuture<T> startFuture(const Functor &functor)
+{
+    QFutureData<T> *data = new QFutureData<T>;
+    QFuture<T> future(data);
+    data->reportStarted();
+    QThreadPool::globalInstance()->start(new FutureRunnable<T, Functor>(data, functor));
+    return future;
+}
+
+// mapped values are collected into a vector and moved to the result container
+template <typename U>
+inline void assignResults(QVector<U> &out, QVector<U> &results)
+{
+    out.swap(results);
+}
+
+template <typename Container, typename U>
+inline void assignResults(Container &out, QVector<U> &results)
+{
+    out.reserve(results.size());
+    for (int i = 0; i < results.size(); ++i) {
+        out.append(results.at(i));
+    }
+}
+
+template <typename Functor, typename T>
+struct MapResultType
+{
+    typedef typename std::decay<decltype(std::declval<Functor &>()(std::declval<const T &>()))>::type Type;
+};
+
+template <typename Functor>
+struct RunResultType
+{
+    typedef typename std::decay<decltype(std::declval<Functor &>()())>::type Type;
+};
+
+template <typename Functor>
+struct ReduceResultType : ReduceResultType<decltype(&Functor::operator())>
+{
+};
+
+template <typename R, typename U>
+struct ReduceResultType<void (*)(R &, U)>
+{
+    typedef R Type;
+};
+
+template <typename C, typename R, typename U>
+struct ReduceResultType<void (C::*)(R &, U)>
+{
+    typedef R Type;
+};
+
+template <typename C, typename R, typename U>
+struct ReduceResultType<void (C::*)(R &, U) const>
+{
+    typedef R Type;
+};
+
+template <typename Sequence, typename MapFunctor>
+inline void blockingMap(Sequence &sequence, MapFunctor map, QFutureState *state = nullptr)
+{
+    const typename Sequence::iterator begin = sequence.begin();
+    forEachBlock(sequence.size(), [&](int from, int to) {
+        for (int i = from; i < to; ++i) {
+            map(begin[i]);
+        }
+    }, state);
+}
+
+template <template <typename> class Sequence, typename T, typename MapFunctor>
+inline Sequence<typename MapResultType<MapFunctor, T>::Type>
+blockingMapped(const Sequence<T> &sequence, MapFunctor map, QFutureState *state = nullptr)
+{
+    typedef typename MapResultType<MapFunctor, T>::Type U;
+    const typename Sequence<T>::const_iterator begin = sequence.begin();
+    QVector<U> results(sequence.size());
+    U *data = results.data();
+    forEachBlock(sequence.size(), [&](int from, int to) {
+        for (int i = from; i < to; ++i) {
+            data[i] = map(begin[i]);
+        }
+    }, state);
+    Sequence<U> out;
+    assignResults(out, results);
+    return out;
+}
+
+template <typename Sequence, typename KeepFunctor>
+inline Sequence blockingFiltered(const Sequence &sequence, KeepFunctor keep, QFutureState *state = nullptr)
+{
+    const typename Sequence::const_iterator begin = sequence.begin();
+    const int count = sequence.size();
+    QVector<char> kept(count);
+    char *data = kept.data();
+    forEachBlock(count, [&](int from, int to) {
+        for (int i = from; i < to; ++i) {
+            data[i] = keep(begin[i]);
+        }
+    }, state);
+    Sequence out;
+    for (int i = 0; i < count; ++i) {
+        if (data[i]) {
+            out.append(begin[i]);
+        }
+    }
+    return out;
+}
+
+template <typename Sequence, typename KeepFunctor>
+inline void blockingFilter(Sequence &sequence, KeepFunctor keep, QFutureState *state = nullptr)
+{
+    sequence = blockingFiltered(sequence, keep, state);
+}
+
+template <typename ResultType, typename Sequence, typename MapFunctor, typename ReduceFunctor>
+inline ResultType blockingMappedReduced(const Sequence &sequence, MapFunctor map, ReduceFunctor reduce,
+                                        QFutureState *state = nullptr)
+{
+    typedef typename MapResultType<MapFunctor, typename Sequence::value_type>::Type U;
+    const typename Sequence::const_iterator begin = sequence.begin();
+    QVector<U> results(sequence.size());
+    U *data = results.data();
+    forEachBlock(sequence.size(), [&](int from, int to) {
+        for (int i = from; i < to; ++i) {
+            data[i] = map(begin[i]);
+        }
+    }, state);
+    // reduce in the order of the sequence so that the result is deterministic
+    ResultType result = ResultType();
+    for (int i = 0; i < results.size(); ++i) {
+        reduce(result, data[i]);
+    }
+    return result;
+}
+
+template <typename Sequence, typename MapFunctor, typename ReduceFunctor>
+inline typename ReduceResultType<ReduceFunctor>::Type
+blockingMappedReduced(const Sequence &sequence, MapFunctor map, ReduceFunctor reduce,
+                      QFutureState *state = nullptr)
+{
+    return blockingMappedReduced<typename ReduceResultType<ReduceFunctor>::Type>(sequence, map, reduce, state);
+}
+
+template <typename Sequence, typename MapFunctor>
+inline QFuture<void> map(Sequence &sequence, MapFunctor map)
+{
+    Sequence *pointer = &sequence;
+    return startFuture<void>([pointer, map](QFutureState *state) {
+        blockingMap(*pointer, map, state);
+    });
+}
+
+template <template <typename> class Sequence, typename T, typename MapFunctor>
+inline QFuture<Sequence<typename MapResultType<MapFunctor, T>::Type> >
+mapped(const Sequence<T> &sequence, MapFunctor map)
+{
+    typedef Sequence<typename MapResultType<MapFunctor, T>::Type> Result;
+    return startFuture<Result>([sequence, map](QFutureState *state) {
+        return blockingMapped(sequence, map, state);
+    });
+}
+
+template <typename Sequence, typename KeepFunctor>
+inline QFuture<Sequence> filtered(const Sequence &sequence, KeepFunctor keep)
+{
+    return startFuture<Sequence>([sequence, keep](QFutureState *state) {
+        return blockingFiltered(sequence, keep, state);
+    });
+}
+
+template <typename Sequence, typename KeepFunctor>
+inline QFuture<void> filter(Sequence &sequence, KeepFunctor keep)
+{
+    Sequence *pointer = &sequence;
+    return startFuture<void>([pointer, keep](QFutureState *state) {
+        blockingFilter(*pointer, keep, state);
+    });
+}
+
+template <typename ResultType, typename Sequence, typename MapFunctor, typename ReduceFunctor>
+inline QFuture<ResultType> mappedReduced(const Sequence &sequence, MapFunctor map, ReduceFunctor reduce)
+{
+    return startFuture<ResultType>([sequence, map, reduce](QFutureState *state) {
+        return blockingMappedReduced<ResultType>(sequence, map, reduce, state);
+    });
+}
+
+template <typename Sequence, typename MapFunctor, typename ReduceFunctor>
+inline QFuture<typename ReduceResultType<ReduceFunctor>::Type>
+mappedReduced(const Sequence &sequence, MapFunctor map, ReduceFunctor reduce)
+{
+    return mappedReduced<typename ReduceResultType<ReduceFunctor>::Type>(sequence, map, reduce);
+}
+
+template <typename Functor>
+inline QFuture<typename RunResultType<Functor>::Type>
+run(Functor functor)
+{
+    typedef typename RunResultType<Functor>::Type Result;
+    return startFuture<Result>([functor](QFutureState *) mutable {
+        return functor();
+    });
+}
+
+} // namespace QtConcurrent
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
+
+#endif // QTCONCURRENT_H
@@ -25,46 +25,201 @@
 #ifndef QT_NO_FILESYSTEMWATCHER
 
 #include "qdebug.h"
+#include "qfile.h"
+
+#ifdef QT_HAVE_INOTIFY_INIT1
+#  include <sys/inotify.h>
+#  include <sys/ioctl.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
+#ifdef QT_HAVE_INOTIFY_INIT1
+static const quint32 QFileWatchMask = (IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+// only entries being added, removed or renamed change a directory
+static const quint32 QDirectoryWatchMask = (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO
+    | IN_MOVE_SELF | IN_DELETE_SELF | IN_ONLYDIR);
+#endif
+
+// removes paths from the ordered list in one pass
+static void removeListed(QStringList &list, const QSet<QString> &paths)
+{
+    if (paths.isEmpty()) {
+        return;
+    }
+    QStringList::iterator it = list.begin();
+    while (it != list.end()) {
+        if (paths.contains(*it)) {
+            it = list.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// appends the path unless it was appended already
+static inline void appendPath(QStringList &list, QSet<QString> &seen, const QString &path)
+{
+    if (!seen.contains(path)) {
+        seen.insert(path);
+        list.append(path);
+    }
+}
+
 QFileSystemWatcherPrivate::QFileSystemWatcherPrivate()
     : interval(1000),
-    timer(q_ptr)
+    timer(q_ptr),
+    inotifyfd(-1),
+    inotifyfailed(false),
+    notifier(nullptr)
+{
+}
+
+QFileSystemWatcherPrivate::~QFileSystemWatcherPrivate()
 {
+    // the notifier is a child of the watcher and is gone by now
+    if (inotifyfd != -1) {
+        qt_safe_close(inotifyfd);
+    }
+}
+
+bool QFileSystemWatcherPrivate::initInotify()
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    if (inotifyfd != -1) {
+        return true;
+    } else if (inotifyfailed) {
+        return false;
+    }
+
+    Q_Q(QFileSystemWatcher);
+    inotifyfailed = true;
+    if (!qgetenv("QT_NO_INOTIFY").isEmpty()) {
+        return false;
+    }
+    inotifyfd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (Q_UNLIKELY(inotifyfd == -1)) {
+        // EMFILE when the per-user instance limit is reached, fallback to polling
+        qWarning("QFileSystemWatcher: inotify_init1() failed: %s", qPrintable(qt_error_string(errno)));
+        return false;
+    }
+    inotifyfailed = false;
+    notifier = new QSocketNotifier(inotifyfd, QSocketNotifier::Read, q);
+    QObject::connect(notifier, SIGNAL(activated(int)), q, SLOT(_q_readInotify()));
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool QFileSystemWatcherPrivate::addWatch(const QString &path, const bool isdir)
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    if (!initInotify()) {
+        return false;
+    }
+    const QByteArray nativepath = QFile::encodeName(path);
+    const int wd = ::inotify_add_watch(inotifyfd, nativepath.constData(),
+                                       isdir ? QDirectoryWatchMask : QFileWatchMask);
+    if (wd == -1) {
+        // ENOENT for paths that do not exist yet, ENOSPC when the watch limit
+        // is reached - either way the path is polled
+        return false;
+    }
+    if (isdir) {
+        directorywatches.insert(path, wd);
+    } else {
+        filewatches.insert(path, wd);
+    }
+    watchpaths[wd].append(path);
+    return true;
+#else
+    Q_UNUSED(path);
+    Q_UNUSED(isdir);
+    return false;
+#endif
+}
+
+void QFileSystemWatcherPrivate::removeWatch(const QString &path, const bool isdir)
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    const int wd = (isdir ? directorywatches.take(path) : filewatches.take(path));
+    QHash<int, QStringList>::iterator it = watchpaths.find(wd);
+    if (it == watchpaths.end()) {
+        return;
+    }
+    it.value().removeOne(path);
+    if (it.value().isEmpty()) {
+        watchpaths.erase(it);
+        ::inotify_rm_watch(inotifyfd, wd);
+    }
+#else
+    Q_UNUSED(path);
+    Q_UNUSED(isdir);
+#endif
+}
+
+void QFileSystemWatcherPrivate::startStopTimer()
+{
+    if (polledfiles.isEmpty() && polleddirectories.isEmpty()) {
+        timer.stop();
+    } else if (!timer.isActive()) {
+        timer.start(interval);
+    }
 }
 
 QStringList QFileSystemWatcherPrivate::addPaths(const QStringList &paths)
 {
-    QStringList p = paths;
+    // paths that can not be watched via inotify are polled, all are accepted
     foreach (const QString &path, paths) {
-        const QStatInfo fi(path, true);
-        if (fi.isDir() || path.endsWith(QLatin1Char('/'))) {
-            directories.insert(path, fi);
+        if (fileset.contains(path) || directoryset.contains(path)) {
+            continue;
+        }
+        const QStatInfo fi(path);
+        const bool isdir = (fi.isDir() || path.endsWith(QLatin1Char('/')));
+        if (isdir) {
+            directories.append(path);
+            directoryset.insert(path);
         } else {
-            files.insert(path, fi);
+            files.append(path);
+            fileset.insert(path);
+        }
+        if (fi.exists() && addWatch(path, isdir)) {
+            continue;
+        }
+        if (isdir) {
+            polleddirectories.insert(path, QStatInfo(path, true));
+        } else {
+            polledfiles.insert(path, fi);
         }
-        p.removeAll(path);
-    }
-    if ((!files.isEmpty() || !directories.isEmpty()) && !timer.isActive()) {
-        timer.start(interval);
     }
-    return p;
+    startStopTimer();
+    return QStringList();
 }
 
 QStringList QFileSystemWatcherPrivate::removePaths(const QStringList &paths)
 {
-    QStringList p = paths;
+    QStringList p;
+    QSet<QString> removedfiles;
+    QSet<QString> removeddirectories;
     foreach (const QString &path, paths) {
-        if (directories.remove(path)) {
-            p.removeAll(path);
-        } else if (files.remove(path)) {
-            p.removeAll(path);
+        if (directoryset.remove(path)) {
+            if (!polleddirectories.remove(path)) {
+                removeWatch(path, true);
+            }
+            removeddirectories.insert(path);
+        } else if (fileset.remove(path)) {
+            if (!polledfiles.remove(path)) {
+                removeWatch(path, false);
+            }
+            removedfiles.insert(path);
+        } else if (!removedfiles.contains(path) && !removeddirectories.contains(path)) {
+            p.append(path);
         }
     }
-    if (files.isEmpty() && directories.isEmpty()) {
-        timer.stop();
-    }
+    removeListed(files, removedfiles);
+    removeListed(directories, removeddirectories);
+    startStopTimer();
     return p;
 }
 
@@ -72,7 +227,9 @@ void QFileSystemWatcherPrivate::_q_timeout()
 {
     Q_Q(QFileSystemWatcher);
 
-    QMutableHashIterator<QString, QStatInfo> fit(files);
+    QStringList changedfiles;
+    QSet<QString> gonefiles;
+    QMutableHashIterator<QString, QStatInfo> fit(polledfiles);
     while (fit.hasNext()) {
         QHash<QString, QStatInfo>::iterator x = fit.next();
         const QString path = x.key();
@@ -80,13 +237,20 @@ void QFileSystemWatcherPrivate::_q_timeout()
         if (x.value() != fi) {
             if (!fi.exists()) {
                 fit.remove();
+                fileset.remove(path);
+                gonefiles.insert(path);
+            } else if (addWatch(path, false)) {
+                // it exists now, let inotify take over
+                fit.remove();
             } else {
-                files[path] = fi;
+                x.value() = fi;
             }
-            emit q->fileChanged(path);
+            changedfiles.append(path);
         }
     }
-    QMutableHashIterator<QString, QStatInfo> dit(directories);
+    QStringList changeddirectories;
+    QSet<QString> gonedirectories;
+    QMutableHashIterator<QString, QStatInfo> dit(polleddirectories);
     while (dit.hasNext()) {
         QHash<QString, QStatInfo>::iterator x = dit.next();
         const QString path = x.key();
@@ -94,12 +258,121 @@ void QFileSystemWatcherPrivate::_q_timeout()
         if (!fi.dirEquals(x.value())) {
             if (!fi.exists()) {
                 dit.remove();
+                directoryset.remove(path);
+                gonedirectories.insert(path);
+            } else if (addWatch(path, true)) {
+                dit.remove();
             } else {
-                directories[path] = fi;
+                x.value() = fi;
             }
-            emit q->directoryChanged(path);
+            changeddirectories.append(path);
         }
     }
+    removeListed(files, gonefiles);
+    removeListed(directories, gonedirectories);
+    startStopTimer();
+
+    foreach (const QString &path, changedfiles) {
+        emit q->fileChanged(path);
+    }
+    foreach (const QString &path, changeddirectories) {
+        emit q->directoryChanged(path);
+    }
+}
+
+void QFileSystemWatcherPrivate::_q_readInotify()
+{
+#ifdef QT_HAVE_INOTIFY_INIT1
+    Q_Q(QFileSystemWatcher);
+
+    int available = 0;
+    if (::ioctl(inotifyfd, FIONREAD, &available) == -1 || available <= 0) {
+        available = 4096;
+    }
+    QByteArray buffer(available, Qt::Uninitialized);
+    const qint64 bytesread = qt_safe_read(inotifyfd, buffer.data(), buffer.size());
+    if (bytesread <= 0) {
+        return;
+    }
+
+    // all events read at once are coalesced, each path is reported at most once
+    QStringList changedfiles;
+    QStringList changeddirectories;
+    QStringList gonefiles;
+    QStringList gonedirectories;
+    QSet<QString> changedfileset;
+    QSet<QString> changeddirectoryset;
+    QSet<QString> gonefileset;
+    QSet<QString> gonedirectoryset;
+    const char *at = buffer.constData();
+    const char *const end = at + bytesread;
+    while (at < end) {
+        const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(at);
+        at += sizeof(struct inotify_event) + event->len;
+
+        if (Q_UNLIKELY(event->mask & IN_Q_OVERFLOW)) {
+            // events were dropped, report everything that inotify watches
+            QHash<QString, int>::const_iterator fit = filewatches.constBegin();
+            for (; fit != filewatches.constEnd(); ++fit) {
+                appendPath(changedfiles, changedfileset, fit.key());
+            }
+            QHash<QString, int>::const_iterator dit = directorywatches.constBegin();
+            for (; dit != directorywatches.constEnd(); ++dit) {
+                appendPath(changeddirectories, changeddirectoryset, dit.key());
+            }
+            continue;
+        }
+
+        const bool gone = (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED | IN_UNMOUNT));
+        foreach (const QString &path, watchpaths.value(event->wd)) {
+            if (directorywatches.contains(path)) {
+                appendPath(changeddirectories, changeddirectoryset, path);
+                if (gone) {
+                    appendPath(gonedirectories, gonedirectoryset, path);
+                }
+            } else {
+                appendPath(changedfiles, changedfileset, path);
+                if (gone) {
+                    appendPath(gonefiles, gonefileset, path);
+                }
+            }
+        }
+    }
+
+    // the path may have been atomically replaced, keep watching it if so
+    QSet<QString> removedfiles;
+    foreach (const QString &path, gonefiles) {
+        removeWatch(path, false);
+        const QStatInfo fi(path);
+        if (!fi.exists()) {
+            fileset.remove(path);
+            removedfiles.insert(path);
+        } else if (!addWatch(path, false)) {
+            polledfiles.insert(path, fi);
+        }
+    }
+    QSet<QString> removeddirectories;
+    foreach (const QString &path, gonedirectories) {
+        removeWatch(path, true);
+        const QStatInfo fi(path, true);
+        if (!fi.isDir()) {
+            directoryset.remove(path);
+            removeddirectories.insert(path);
+        } else if (!addWatch(path, true)) {
+            polleddirectories.insert(path, fi);
+        }
+    }
+    removeListed(files, removedfiles);
+    removeListed(directories, removeddirectories);
+    startStopTimer();
+
+    foreach (const QString &path, changedfiles) {
+        emit q->fileChanged(path);
+    }
+    foreach (const QString &path, changeddirectories) {
+        emit q->directoryChanged(path);
+    }
+#endif
 }
 
 /*!
@@ -127,6 +400,13 @@ void QFileSystemWatcherPrivate::_q_timeout()
     they have been renamed or removed from disk, and directories once
     they have been removed from disk.
 
+    On Linux the kernel inotify interface is used to get notified about
+    changes without waking up periodically. Paths that do not exist yet,
+    paths added after the inotify watch limit has been reached and all
+    paths when the \c QT_NO_INOTIFY environment variable is set are
+    polled instead every interval() milliseconds. Changes that happen in
+    quick succession may be reported only once.
+
     \sa QFile, QDir
 */
 
@@ -244,29 +524,32 @@ void QFileSystemWatcher::removePaths(const QStringList &paths)
 }
 
 /*!
-    Returns a list of paths to directories that are being watched.
+    Returns a list of paths to directories that are being watched, in
+    the order they were added.
 
     \sa files()
 */
 QStringList QFileSystemWatcher::directories() const
 {
     Q_D(const QFileSystemWatcher);
-    return d->directories.keys();
+    return d->directories;
 }
 
 /*!
-    Returns a list of paths to files that are being watched.
+    Returns a list of paths to files that are being watched, in the
+    order they were added.
 
     \sa directories()
 */
 QStringList QFileSystemWatcher::files() const
 {
     Q_D(const QFileSystemWatcher);
-    return d->files.keys();
+    return d->files;
 }
 
 /*!
-    Returns the interval on which files and directories are checked.
+    Returns the interval on which files and directories that are not
+    watched via inotify are checked.
 
     \since 4.14
     \sa setInterval()
@@ -41,6 +41,8 @@
 #include "qtimer.h"
 #include "qcore_unix_p.h"
 #include "qstringlist.h"
+#include "qset.h"
+#include "qsocketnotifier.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -50,15 +52,32 @@ class QFileSystemWatcherPrivate : public QObjectPrivate
 
 public:
     QFileSystemWatcherPrivate();
+    ~QFileSystemWatcherPrivate();
 
     QStringList addPaths(const QStringList &paths);
     QStringList removePaths(const QStringList &paths);
 
+    bool initInotify();
+    bool addWatch(const QString &path, const bool isdir);
+    void removeWatch(const QString &path, const bool isdir);
+    void startStopTimer();
+
     int interval;
     QTimer timer;
-    QHash<QString, QStatInfo> files, directories;
+    // watched paths in the order they were added and for lookups
+    QStringList files, directories;
+    QSet<QString> fileset, directoryset;
+    // paths which inotify does not cover, checked on timeout
+    QHash<QString, QStatInfo> polledfiles, polleddirectories;
+    // inotify watch descriptors, the same inode may be watched via different paths
+    QHash<QString, int> filewatches, directorywatches;
+    QHash<int, QStringList> watchpaths;
+    int inotifyfd;
+    bool inotifyfailed;
+    QSocketNotifier *notifier;
 
     void _q_timeout();
+    void _q_readInotify();
 };
 
 QT_END_NAMESPACE
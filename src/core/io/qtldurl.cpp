@@ -21,6 +21,9 @@
 
 #include "qtldurl_p.h"
 #include "qstringlist.h"
+#include "qcorecommon_p.h"
+
+#include <string.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -29,9124 +32,10539 @@ QT_BEGIN_NAMESPACE
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 // generated via gentld.py
-static const char* TLDTbl[9104] = {
-    "ac",
-    "com.ac",
-    "edu.ac",
-    "gov.ac",
-    "net.ac",
-    "mil.ac",
-    "org.ac",
-    "ad",
-    "nom.ad",
-    "ae",
-    "co.ae",
-    "net.ae",
-    "org.ae",
-    "sch.ae",
-    "ac.ae",
-    "gov.ae",
-    "mil.ae",
-    "aero",
-    "accident-investigation.aero",
-    "accident-prevention.aero",
-    "aerobatic.aero",
-    "aeroclub.aero",
-    "aerodrome.aero",
-    "agents.aero",
-    "aircraft.aero",
-    "airline.aero",
-    "airport.aero",
-    "air-surveillance.aero",
-    "airtraffic.aero",
-    "air-traffic-control.aero",
-    "ambulance.aero",
-    "amusement.aero",
-    "association.aero",
-    "author.aero",
-    "ballooning.aero",
-    "broker.aero",
-    "caa.aero",
-    "cargo.aero",
-    "catering.aero",
-    "certification.aero",
-    "championship.aero",
-    "charter.aero",
-    "civilaviation.aero",
-    "club.aero",
-    "conference.aero",
-    "consultant.aero",
-    "consulting.aero",
-    "control.aero",
-    "council.aero",
-    "crew.aero",
-    "design.aero",
-    "dgca.aero",
-    "educator.aero",
-    "emergency.aero",
-    "engine.aero",
-    "engineer.aero",
-    "entertainment.aero",
-    "equipment.aero",
-    "exchange.aero",
-    "express.aero",
-    "federation.aero",
-    "flight.aero",
-    "fuel.aero",
-    "gliding.aero",
-    "government.aero",
-    "groundhandling.aero",
-    "group.aero",
-    "hanggliding.aero",
-    "homebuilt.aero",
-    "insurance.aero",
-    "journal.aero",
-    "journalist.aero",
-    "leasing.aero",
-    "logistics.aero",
-    "magazine.aero",
-    "maintenance.aero",
-    "media.aero",
-    "microlight.aero",
-    "modelling.aero",
-    "navigation.aero",
-    "parachuting.aero",
-    "paragliding.aero",
-    "passenger-association.aero",
-    "pilot.aero",
-    "press.aero",
-    "production.aero",
-    "recreation.aero",
-    "repbody.aero",
-    "res.aero",
-    "research.aero",
-    "rotorcraft.aero",
-    "safety.aero",
-    "scientist.aero",
-    "services.aero",
-    "show.aero",
-    "skydiving.aero",
-    "software.aero",
-    "student.aero",
-    "trader.aero",
-    "trading.aero",
-    "trainer.aero",
-    "union.aero",
-    "workinggroup.aero",
-    "works.aero",
-    "af",
-    "gov.af",
-    "com.af",
-    "org.af",
-    "net.af",
-    "edu.af",
-    "ag",
-    "com.ag",
-    "org.ag",
-    "net.ag",
-    "co.ag",
-    "nom.ag",
-    "ai",
-    "off.ai",
-    "com.ai",
-    "net.ai",
-    "org.ai",
-    "al",
-    "com.al",
-    "edu.al",
-    "gov.al",
-    "mil.al",
-    "net.al",
-    "org.al",
-    "am",
-    "co.am",
-    "com.am",
-    "commune.am",
-    "net.am",
-    "org.am",
-    "ao",
-    "ed.ao",
-    "gv.ao",
-    "og.ao",
-    "co.ao",
-    "pb.ao",
-    "it.ao",
-    "aq",
-    "ar",
-    "bet.ar",
-    "com.ar",
-    "coop.ar",
-    "edu.ar",
-    "gob.ar",
-    "gov.ar",
-    "int.ar",
-    "mil.ar",
-    "musica.ar",
-    "mutual.ar",
-    "net.ar",
-    "org.ar",
-    "senasa.ar",
-    "tur.ar",
-    "arpa",
-    "e164.arpa",
-    "in-addr.arpa",
-    "ip6.arpa",
-    "iris.arpa",
-    "uri.arpa",
-    "urn.arpa",
-    "as",
-    "gov.as",
-    "asia",
-    "at",
-    "ac.at",
-    "co.at",
-    "gv.at",
-    "or.at",
-    "sth.ac.at",
-    "au",
-    "com.au",
-    "net.au",
-    "org.au",
-    "edu.au",
-    "gov.au",
-    "asn.au",
-    "id.au",
-    "info.au",
-    "conf.au",
-    "oz.au",
-    "act.au",
-    "nsw.au",
-    "nt.au",
-    "qld.au",
-    "sa.au",
-    "tas.au",
-    "vic.au",
-    "wa.au",
-    "act.edu.au",
-    "catholic.edu.au",
-    "nsw.edu.au",
-    "nt.edu.au",
-    "qld.edu.au",
-    "sa.edu.au",
-    "tas.edu.au",
-    "vic.edu.au",
-    "wa.edu.au",
-    "qld.gov.au",
-    "sa.gov.au",
-    "tas.gov.au",
-    "vic.gov.au",
-    "wa.gov.au",
-    "schools.nsw.edu.au",
-    "aw",
-    "com.aw",
-    "ax",
-    "az",
-    "com.az",
-    "net.az",
-    "int.az",
-    "gov.az",
-    "org.az",
-    "edu.az",
-    "info.az",
-    "pp.az",
-    "mil.az",
-    "name.az",
-    "pro.az",
-    "biz.az",
-    "ba",
-    "com.ba",
-    "edu.ba",
-    "gov.ba",
-    "mil.ba",
-    "net.ba",
-    "org.ba",
-    "bb",
-    "biz.bb",
-    "co.bb",
-    "com.bb",
-    "edu.bb",
-    "gov.bb",
-    "info.bb",
-    "net.bb",
-    "org.bb",
-    "store.bb",
-    "tv.bb",
-    "*.bd",
-    "be",
-    "ac.be",
-    "bf",
-    "gov.bf",
-    "bg",
-    "a.bg",
-    "b.bg",
-    "c.bg",
-    "d.bg",
-    "e.bg",
-    "f.bg",
-    "g.bg",
-    "h.bg",
-    "i.bg",
-    "j.bg",
-    "k.bg",
-    "l.bg",
-    "m.bg",
-    "n.bg",
-    "o.bg",
-    "p.bg",
-    "q.bg",
-    "r.bg",
-    "s.bg",
-    "t.bg",
-    "u.bg",
-    "v.bg",
-    "w.bg",
-    "x.bg",
-    "y.bg",
-    "z.bg",
-    "0.bg",
-    "1.bg",
-    "2.bg",
-    "3.bg",
-    "4.bg",
-    "5.bg",
-    "6.bg",
-    "7.bg",
-    "8.bg",
-    "9.bg",
-    "bh",
-    "com.bh",
-    "edu.bh",
-    "net.bh",
-    "org.bh",
-    "gov.bh",
-    "bi",
-    "co.bi",
-    "com.bi",
-    "edu.bi",
-    "or.bi",
-    "org.bi",
-    "biz",
-    "bj",
-    "africa.bj",
-    "agro.bj",
-    "architectes.bj",
-    "assur.bj",
-    "avocats.bj",
-    "co.bj",
-    "com.bj",
-    "eco.bj",
-    "econo.bj",
-    "edu.bj",
-    "info.bj",
-    "loisirs.bj",
-    "money.bj",
-    "net.bj",
-    "org.bj",
-    "ote.bj",
-    "resto.bj",
-    "restaurant.bj",
-    "tourism.bj",
-    "univ.bj",
-    "bm",
-    "com.bm",
-    "edu.bm",
-    "gov.bm",
-    "net.bm",
-    "org.bm",
-    "bn",
-    "com.bn",
-    "edu.bn",
-    "gov.bn",
-    "net.bn",
-    "org.bn",
-    "bo",
-    "com.bo",
-    "edu.bo",
-    "gob.bo",
-    "int.bo",
-    "org.bo",
-    "net.bo",
-    "mil.bo",
-    "tv.bo",
-    "web.bo",
-    "academia.bo",
-    "agro.bo",
-    "arte.bo",
-    "blog.bo",
-    "bolivia.bo",
-    "ciencia.bo",
-    "cooperativa.bo",
-    "democracia.bo",
-    "deporte.bo",
-    "ecologia.bo",
-    "economia.bo",
-    "empresa.bo",
-    "indigena.bo",
-    "industria.bo",
-    "info.bo",
-    "medicina.bo",
-    "movimiento.bo",
-    "musica.bo",
-    "natural.bo",
-    "nombre.bo",
-    "noticias.bo",
-    "patria.bo",
-    "politica.bo",
-    "profesional.bo",
-    "plurinacional.bo",
-    "pueblo.bo",
-    "revista.bo",
-    "salud.bo",
-    "tecnologia.bo",
-    "tksat.bo",
-    "transporte.bo",
-    "wiki.bo",
-    "br",
-    "9guacu.br",
-    "abc.br",
-    "adm.br",
-    "adv.br",
-    "agr.br",
-    "aju.br",
-    "am.br",
-    "anani.br",
-    "aparecida.br",
-    "app.br",
-    "arq.br",
-    "art.br",
-    "ato.br",
-    "b.br",
-    "barueri.br",
-    "belem.br",
-    "bhz.br",
-    "bib.br",
-    "bio.br",
-    "blog.br",
-    "bmd.br",
-    "boavista.br",
-    "bsb.br",
-    "campinagrande.br",
-    "campinas.br",
-    "caxias.br",
-    "cim.br",
-    "cng.br",
-    "cnt.br",
-    "com.br",
-    "contagem.br",
-    "coop.br",
-    "coz.br",
-    "cri.br",
-    "cuiaba.br",
-    "curitiba.br",
-    "def.br",
-    "des.br",
-    "det.br",
-    "dev.br",
-    "ecn.br",
-    "eco.br",
-    "edu.br",
-    "emp.br",
-    "enf.br",
-    "eng.br",
-    "esp.br",
-    "etc.br",
-    "eti.br",
-    "far.br",
-    "feira.br",
-    "flog.br",
-    "floripa.br",
-    "fm.br",
-    "fnd.br",
-    "fortal.br",
-    "fot.br",
-    "foz.br",
-    "fst.br",
-    "g12.br",
-    "geo.br",
-    "ggf.br",
-    "goiania.br",
-    "gov.br",
-    "ac.gov.br",
-    "al.gov.br",
-    "am.gov.br",
-    "ap.gov.br",
-    "ba.gov.br",
-    "ce.gov.br",
-    "df.gov.br",
-    "es.gov.br",
-    "go.gov.br",
-    "ma.gov.br",
-    "mg.gov.br",
-    "ms.gov.br",
-    "mt.gov.br",
-    "pa.gov.br",
-    "pb.gov.br",
-    "pe.gov.br",
-    "pi.gov.br",
-    "pr.gov.br",
-    "rj.gov.br",
-    "rn.gov.br",
-    "ro.gov.br",
-    "rr.gov.br",
-    "rs.gov.br",
-    "sc.gov.br",
-    "se.gov.br",
-    "sp.gov.br",
-    "to.gov.br",
-    "gru.br",
-    "imb.br",
-    "ind.br",
-    "inf.br",
-    "jab.br",
-    "jampa.br",
-    "jdf.br",
-    "joinville.br",
-    "jor.br",
-    "jus.br",
-    "leg.br",
-    "lel.br",
-    "log.br",
-    "londrina.br",
-    "macapa.br",
-    "maceio.br",
-    "manaus.br",
-    "maringa.br",
-    "mat.br",
-    "med.br",
-    "mil.br",
-    "morena.br",
-    "mp.br",
-    "mus.br",
-    "natal.br",
-    "net.br",
-    "niteroi.br",
-    "*.nom.br",
-    "not.br",
-    "ntr.br",
-    "odo.br",
-    "ong.br",
-    "org.br",
-    "osasco.br",
-    "palmas.br",
-    "poa.br",
-    "ppg.br",
-    "pro.br",
-    "psc.br",
-    "psi.br",
-    "pvh.br",
-    "qsl.br",
-    "radio.br",
-    "rec.br",
-    "recife.br",
-    "rep.br",
-    "ribeirao.br",
-    "rio.br",
-    "riobranco.br",
-    "riopreto.br",
-    "salvador.br",
-    "sampa.br",
-    "santamaria.br",
-    "santoandre.br",
-    "saobernardo.br",
-    "saogonca.br",
-    "seg.br",
-    "sjc.br",
-    "slg.br",
-    "slz.br",
-    "sorocaba.br",
-    "srv.br",
-    "taxi.br",
-    "tc.br",
-    "tec.br",
-    "teo.br",
-    "the.br",
-    "tmp.br",
-    "trd.br",
-    "tur.br",
-    "tv.br",
-    "udi.br",
-    "vet.br",
-    "vix.br",
-    "vlog.br",
-    "wiki.br",
-    "zlg.br",
-    "bs",
-    "com.bs",
-    "net.bs",
-    "org.bs",
-    "edu.bs",
-    "gov.bs",
-    "bt",
-    "com.bt",
-    "edu.bt",
-    "gov.bt",
-    "net.bt",
-    "org.bt",
-    "bv",
-    "bw",
-    "co.bw",
-    "org.bw",
-    "by",
-    "gov.by",
-    "mil.by",
-    "com.by",
-    "of.by",
-    "bz",
-    "com.bz",
-    "net.bz",
-    "org.bz",
-    "edu.bz",
-    "gov.bz",
-    "ca",
-    "ab.ca",
-    "bc.ca",
-    "mb.ca",
-    "nb.ca",
-    "nf.ca",
-    "nl.ca",
-    "ns.ca",
-    "nt.ca",
-    "nu.ca",
-    "on.ca",
-    "pe.ca",
-    "qc.ca",
-    "sk.ca",
-    "yk.ca",
-    "gc.ca",
-    "cat",
-    "cc",
-    "cd",
-    "gov.cd",
-    "cf",
-    "cg",
-    "ch",
-    "ci",
-    "org.ci",
-    "or.ci",
-    "com.ci",
-    "co.ci",
-    "edu.ci",
-    "ed.ci",
-    "ac.ci",
-    "net.ci",
-    "go.ci",
-    "asso.ci",
-    "aéroport.ci",
-    "int.ci",
-    "presse.ci",
-    "md.ci",
-    "gouv.ci",
-    "*.ck",
-    "!www.ck",
-    "cl",
-    "co.cl",
-    "gob.cl",
-    "gov.cl",
-    "mil.cl",
-    "cm",
-    "co.cm",
-    "com.cm",
-    "gov.cm",
-    "net.cm",
-    "cn",
-    "ac.cn",
-    "com.cn",
-    "edu.cn",
-    "gov.cn",
-    "net.cn",
-    "org.cn",
-    "mil.cn",
-    "公司.cn",
-    "网络.cn",
-    "網絡.cn",
-    "ah.cn",
-    "bj.cn",
-    "cq.cn",
-    "fj.cn",
-    "gd.cn",
-    "gs.cn",
-    "gz.cn",
-    "gx.cn",
-    "ha.cn",
-    "hb.cn",
-    "he.cn",
-    "hi.cn",
-    "hl.cn",
-    "hn.cn",
-    "jl.cn",
-    "js.cn",
-    "jx.cn",
-    "ln.cn",
-    "nm.cn",
-    "nx.cn",
-    "qh.cn",
-    "sc.cn",
-    "sd.cn",
-    "sh.cn",
-    "sn.cn",
-    "sx.cn",
-    "tj.cn",
-    "xj.cn",
-    "xz.cn",
-    "yn.cn",
-    "zj.cn",
-    "hk.cn",
-    "mo.cn",
-    "tw.cn",
-    "co",
-    "arts.co",
-    "com.co",
-    "edu.co",
-    "firm.co",
-    "gov.co",
-    "info.co",
-    "int.co",
-    "mil.co",
-    "net.co",
-    "nom.co",
-    "org.co",
-    "rec.co",
-    "web.co",
-    "com",
-    "coop",
-    "cr",
-    "ac.cr",
-    "co.cr",
-    "ed.cr",
-    "fi.cr",
-    "go.cr",
-    "or.cr",
-    "sa.cr",
-    "cu",
-    "com.cu",
-    "edu.cu",
-    "org.cu",
-    "net.cu",
-    "gov.cu",
-    "inf.cu",
-    "cv",
-    "com.cv",
-    "edu.cv",
-    "int.cv",
-    "nome.cv",
-    "org.cv",
-    "cw",
-    "com.cw",
-    "edu.cw",
-    "net.cw",
-    "org.cw",
-    "cx",
-    "gov.cx",
-    "cy",
-    "ac.cy",
-    "biz.cy",
-    "com.cy",
-    "ekloges.cy",
-    "gov.cy",
-    "ltd.cy",
-    "mil.cy",
-    "net.cy",
-    "org.cy",
-    "press.cy",
-    "pro.cy",
-    "tm.cy",
-    "cz",
-    "de",
-    "dj",
-    "dk",
-    "dm",
-    "com.dm",
-    "net.dm",
-    "org.dm",
-    "edu.dm",
-    "gov.dm",
-    "do",
-    "art.do",
-    "com.do",
-    "edu.do",
-    "gob.do",
-    "gov.do",
-    "mil.do",
-    "net.do",
-    "org.do",
-    "sld.do",
-    "web.do",
-    "dz",
-    "art.dz",
-    "asso.dz",
-    "com.dz",
-    "edu.dz",
-    "gov.dz",
-    "org.dz",
-    "net.dz",
-    "pol.dz",
-    "soc.dz",
-    "tm.dz",
-    "ec",
-    "com.ec",
-    "info.ec",
-    "net.ec",
-    "fin.ec",
-    "k12.ec",
-    "med.ec",
-    "pro.ec",
-    "org.ec",
-    "edu.ec",
-    "gov.ec",
-    "gob.ec",
-    "mil.ec",
-    "edu",
-    "ee",
-    "edu.ee",
-    "gov.ee",
-    "riik.ee",
-    "lib.ee",
-    "med.ee",
-    "com.ee",
-    "pri.ee",
-    "aip.ee",
-    "org.ee",
-    "fie.ee",
-    "eg",
-    "com.eg",
-    "edu.eg",
-    "eun.eg",
-    "gov.eg",
-    "mil.eg",
-    "name.eg",
-    "net.eg",
-    "org.eg",
-    "sci.eg",
-    "*.er",
-    "es",
-    "com.es",
-    "nom.es",
-    "org.es",
-    "gob.es",
-    "edu.es",
-    "et",
-    "com.et",
-    "gov.et",
-    "org.et",
-    "edu.et",
-    "biz.et",
-    "name.et",
-    "info.et",
-    "net.et",
-    "eu",
-    "fi",
-    "aland.fi",
-    "fj",
-    "ac.fj",
-    "biz.fj",
-    "com.fj",
-    "gov.fj",
-    "info.fj",
-    "mil.fj",
-    "name.fj",
-    "net.fj",
-    "org.fj",
-    "pro.fj",
-    "*.fk",
-    "com.fm",
-    "edu.fm",
-    "net.fm",
-    "org.fm",
-    "fm",
-    "fo",
-    "fr",
-    "asso.fr",
-    "com.fr",
-    "gouv.fr",
-    "nom.fr",
-    "prd.fr",
-    "tm.fr",
-    "aeroport.fr",
-    "avocat.fr",
-    "avoues.fr",
-    "cci.fr",
-    "chambagri.fr",
-    "chirurgiens-dentistes.fr",
-    "experts-comptables.fr",
-    "geometre-expert.fr",
-    "greta.fr",
-    "huissier-justice.fr",
-    "medecin.fr",
-    "notaires.fr",
-    "pharmacien.fr",
-    "port.fr",
-    "veterinaire.fr",
-    "ga",
-    "gb",
-    "edu.gd",
-    "gov.gd",
-    "gd",
-    "ge",
-    "com.ge",
-    "edu.ge",
-    "gov.ge",
-    "org.ge",
-    "mil.ge",
-    "net.ge",
-    "pvt.ge",
-    "gf",
-    "gg",
-    "co.gg",
-    "net.gg",
-    "org.gg",
-    "gh",
-    "com.gh",
-    "edu.gh",
-    "gov.gh",
-    "org.gh",
-    "mil.gh",
-    "gi",
-    "com.gi",
-    "ltd.gi",
-    "gov.gi",
-    "mod.gi",
-    "edu.gi",
-    "org.gi",
-    "gl",
-    "co.gl",
-    "com.gl",
-    "edu.gl",
-    "net.gl",
-    "org.gl",
-    "gm",
-    "gn",
-    "ac.gn",
-    "com.gn",
-    "edu.gn",
-    "gov.gn",
-    "org.gn",
-    "net.gn",
-    "gov",
-    "gp",
-    "com.gp",
-    "net.gp",
-    "mobi.gp",
-    "edu.gp",
-    "org.gp",
-    "asso.gp",
-    "gq",
-    "gr",
-    "com.gr",
-    "edu.gr",
-    "net.gr",
-    "org.gr",
-    "gov.gr",
-    "gs",
-    "gt",
-    "com.gt",
-    "edu.gt",
-    "gob.gt",
-    "ind.gt",
-    "mil.gt",
-    "net.gt",
-    "org.gt",
-    "gu",
-    "com.gu",
-    "edu.gu",
-    "gov.gu",
-    "guam.gu",
-    "info.gu",
-    "net.gu",
-    "org.gu",
-    "web.gu",
-    "gw",
-    "gy",
-    "co.gy",
-    "com.gy",
-    "edu.gy",
-    "gov.gy",
-    "net.gy",
-    "org.gy",
-    "hk",
-    "com.hk",
-    "edu.hk",
-    "gov.hk",
-    "idv.hk",
-    "net.hk",
-    "org.hk",
-    "公司.hk",
-    "教育.hk",
-    "敎育.hk",
-    "政府.hk",
-    "個人.hk",
-    "个人.hk",
-    "箇人.hk",
-    "網络.hk",
-    "网络.hk",
-    "组織.hk",
-    "網絡.hk",
-    "网絡.hk",
-    "组织.hk",
-    "組織.hk",
-    "組织.hk",
-    "hm",
-    "hn",
-    "com.hn",
-    "edu.hn",
-    "org.hn",
-    "net.hn",
-    "mil.hn",
-    "gob.hn",
-    "hr",
-    "iz.hr",
-    "from.hr",
-    "name.hr",
-    "com.hr",
-    "ht",
-    "com.ht",
-    "shop.ht",
-    "firm.ht",
-    "info.ht",
-    "adult.ht",
-    "net.ht",
-    "pro.ht",
-    "org.ht",
-    "med.ht",
-    "art.ht",
-    "coop.ht",
-    "pol.ht",
-    "asso.ht",
-    "edu.ht",
-    "rel.ht",
-    "gouv.ht",
-    "perso.ht",
-    "hu",
-    "co.hu",
-    "info.hu",
-    "org.hu",
-    "priv.hu",
-    "sport.hu",
-    "tm.hu",
-    "2000.hu",
-    "agrar.hu",
-    "bolt.hu",
-    "casino.hu",
-    "city.hu",
-    "erotica.hu",
-    "erotika.hu",
-    "film.hu",
-    "forum.hu",
-    "games.hu",
-    "hotel.hu",
-    "ingatlan.hu",
-    "jogasz.hu",
-    "konyvelo.hu",
-    "lakas.hu",
-    "media.hu",
-    "news.hu",
-    "reklam.hu",
-    "sex.hu",
-    "shop.hu",
-    "suli.hu",
-    "szex.hu",
-    "tozsde.hu",
-    "utazas.hu",
-    "video.hu",
-    "id",
-    "ac.id",
-    "biz.id",
-    "co.id",
-    "desa.id",
-    "go.id",
-    "mil.id",
-    "my.id",
-    "net.id",
-    "or.id",
-    "ponpes.id",
-    "sch.id",
-    "web.id",
-    "ie",
-    "gov.ie",
-    "il",
-    "ac.il",
-    "co.il",
-    "gov.il",
-    "idf.il",
-    "k12.il",
-    "muni.il",
-    "net.il",
-    "org.il",
-    "ישראל",
-    "אקדמיה.ישראל",
-    "ישוב.ישראל",
-    "צהל.ישראל",
-    "ממשל.ישראל",
-    "im",
-    "ac.im",
-    "co.im",
-    "com.im",
-    "ltd.co.im",
-    "net.im",
-    "org.im",
-    "plc.co.im",
-    "tt.im",
-    "tv.im",
-    "in",
-    "5g.in",
-    "6g.in",
-    "ac.in",
-    "ai.in",
-    "am.in",
-    "bihar.in",
-    "biz.in",
-    "business.in",
-    "ca.in",
-    "cn.in",
-    "co.in",
-    "com.in",
-    "coop.in",
-    "cs.in",
-    "delhi.in",
-    "dr.in",
-    "edu.in",
-    "er.in",
-    "firm.in",
-    "gen.in",
-    "gov.in",
-    "gujarat.in",
-    "ind.in",
-    "info.in",
-    "int.in",
-    "internet.in",
-    "io.in",
-    "me.in",
-    "mil.in",
-    "net.in",
-    "nic.in",
-    "org.in",
-    "pg.in",
-    "post.in",
-    "pro.in",
-    "res.in",
-    "travel.in",
-    "tv.in",
-    "uk.in",
-    "up.in",
-    "us.in",
-    "info",
-    "int",
-    "eu.int",
-    "io",
-    "com.io",
-    "iq",
-    "gov.iq",
-    "edu.iq",
-    "mil.iq",
-    "com.iq",
-    "org.iq",
-    "net.iq",
-    "ir",
-    "ac.ir",
-    "co.ir",
-    "gov.ir",
-    "id.ir",
-    "net.ir",
-    "org.ir",
-    "sch.ir",
-    "ایران.ir",
-    "ايران.ir",
-    "is",
-    "net.is",
-    "com.is",
-    "edu.is",
-    "gov.is",
-    "org.is",
-    "int.is",
-    "it",
-    "gov.it",
-    "edu.it",
-    "abr.it",
-    "abruzzo.it",
-    "aosta-valley.it",
-    "aostavalley.it",
-    "bas.it",
-    "basilicata.it",
-    "cal.it",
-    "calabria.it",
-    "cam.it",
-    "campania.it",
-    "emilia-romagna.it",
-    "emiliaromagna.it",
-    "emr.it",
-    "friuli-v-giulia.it",
-    "friuli-ve-giulia.it",
-    "friuli-vegiulia.it",
-    "friuli-venezia-giulia.it",
-    "friuli-veneziagiulia.it",
-    "friuli-vgiulia.it",
-    "friuliv-giulia.it",
-    "friulive-giulia.it",
-    "friulivegiulia.it",
-    "friulivenezia-giulia.it",
-    "friuliveneziagiulia.it",
-    "friulivgiulia.it",
-    "fvg.it",
-    "laz.it",
-    "lazio.it",
-    "lig.it",
-    "liguria.it",
-    "lom.it",
-    "lombardia.it",
-    "lombardy.it",
-    "lucania.it",
-    "mar.it",
-    "marche.it",
-    "mol.it",
-    "molise.it",
-    "piedmont.it",
-    "piemonte.it",
-    "pmn.it",
-    "pug.it",
-    "puglia.it",
-    "sar.it",
-    "sardegna.it",
-    "sardinia.it",
-    "sic.it",
-    "sicilia.it",
-    "sicily.it",
-    "taa.it",
-    "tos.it",
-    "toscana.it",
-    "trentin-sud-tirol.it",
-    "trentin-süd-tirol.it",
-    "trentin-sudtirol.it",
-    "trentin-südtirol.it",
-    "trentin-sued-tirol.it",
-    "trentin-suedtirol.it",
-    "trentino-a-adige.it",
-    "trentino-aadige.it",
-    "trentino-alto-adige.it",
-    "trentino-altoadige.it",
-    "trentino-s-tirol.it",
-    "trentino-stirol.it",
-    "trentino-sud-tirol.it",
-    "trentino-süd-tirol.it",
-    "trentino-sudtirol.it",
-    "trentino-südtirol.it",
-    "trentino-sued-tirol.it",
-    "trentino-suedtirol.it",
-    "trentino.it",
-    "trentinoa-adige.it",
-    "trentinoaadige.it",
-    "trentinoalto-adige.it",
-    "trentinoaltoadige.it",
-    "trentinos-tirol.it",
-    "trentinostirol.it",
-    "trentinosud-tirol.it",
-    "trentinosüd-tirol.it",
-    "trentinosudtirol.it",
-    "trentinosüdtirol.it",
-    "trentinosued-tirol.it",
-    "trentinosuedtirol.it",
-    "trentinsud-tirol.it",
-    "trentinsüd-tirol.it",
-    "trentinsudtirol.it",
-    "trentinsüdtirol.it",
-    "trentinsued-tirol.it",
-    "trentinsuedtirol.it",
-    "tuscany.it",
-    "umb.it",
-    "umbria.it",
-    "val-d-aosta.it",
-    "val-daosta.it",
-    "vald-aosta.it",
-    "valdaosta.it",
-    "valle-aosta.it",
-    "valle-d-aosta.it",
-    "valle-daosta.it",
-    "valleaosta.it",
-    "valled-aosta.it",
-    "valledaosta.it",
-    "vallee-aoste.it",
-    "vallée-aoste.it",
-    "vallee-d-aoste.it",
-    "vallée-d-aoste.it",
-    "valleeaoste.it",
-    "valléeaoste.it",
-    "valleedaoste.it",
-    "valléedaoste.it",
-    "vao.it",
-    "vda.it",
-    "ven.it",
-    "veneto.it",
-    "ag.it",
-    "agrigento.it",
-    "al.it",
-    "alessandria.it",
-    "alto-adige.it",
-    "altoadige.it",
-    "an.it",
-    "ancona.it",
-    "andria-barletta-trani.it",
-    "andria-trani-barletta.it",
-    "andriabarlettatrani.it",
-    "andriatranibarletta.it",
-    "ao.it",
-    "aosta.it",
-    "aoste.it",
-    "ap.it",
-    "aq.it",
-    "aquila.it",
-    "ar.it",
-    "arezzo.it",
-    "ascoli-piceno.it",
-    "ascolipiceno.it",
-    "asti.it",
-    "at.it",
-    "av.it",
-    "avellino.it",
-    "ba.it",
-    "balsan-sudtirol.it",
-    "balsan-südtirol.it",
-    "balsan-suedtirol.it",
-    "balsan.it",
-    "bari.it",
-    "barletta-trani-andria.it",
-    "barlettatraniandria.it",
-    "belluno.it",
-    "benevento.it",
-    "bergamo.it",
-    "bg.it",
-    "bi.it",
-    "biella.it",
-    "bl.it",
-    "bn.it",
-    "bo.it",
-    "bologna.it",
-    "bolzano-altoadige.it",
-    "bolzano.it",
-    "bozen-sudtirol.it",
-    "bozen-südtirol.it",
-    "bozen-suedtirol.it",
-    "bozen.it",
-    "br.it",
-    "brescia.it",
-    "brindisi.it",
-    "bs.it",
-    "bt.it",
-    "bulsan-sudtirol.it",
-    "bulsan-südtirol.it",
-    "bulsan-suedtirol.it",
-    "bulsan.it",
-    "bz.it",
-    "ca.it",
-    "cagliari.it",
-    "caltanissetta.it",
-    "campidano-medio.it",
-    "campidanomedio.it",
-    "campobasso.it",
-    "carbonia-iglesias.it",
-    "carboniaiglesias.it",
-    "carrara-massa.it",
-    "carraramassa.it",
-    "caserta.it",
-    "catania.it",
-    "catanzaro.it",
-    "cb.it",
-    "ce.it",
-    "cesena-forli.it",
-    "cesena-forlì.it",
-    "cesenaforli.it",
-    "cesenaforlì.it",
-    "ch.it",
-    "chieti.it",
-    "ci.it",
-    "cl.it",
-    "cn.it",
-    "co.it",
-    "como.it",
-    "cosenza.it",
-    "cr.it",
-    "cremona.it",
-    "crotone.it",
-    "cs.it",
-    "ct.it",
-    "cuneo.it",
-    "cz.it",
-    "dell-ogliastra.it",
-    "dellogliastra.it",
-    "en.it",
-    "enna.it",
-    "fc.it",
-    "fe.it",
-    "fermo.it",
-    "ferrara.it",
-    "fg.it",
-    "fi.it",
-    "firenze.it",
-    "florence.it",
-    "fm.it",
-    "foggia.it",
-    "forli-cesena.it",
-    "forlì-cesena.it",
-    "forlicesena.it",
-    "forlìcesena.it",
-    "fr.it",
-    "frosinone.it",
-    "ge.it",
-    "genoa.it",
-    "genova.it",
-    "go.it",
-    "gorizia.it",
-    "gr.it",
-    "grosseto.it",
-    "iglesias-carbonia.it",
-    "iglesiascarbonia.it",
-    "im.it",
-    "imperia.it",
-    "is.it",
-    "isernia.it",
-    "kr.it",
-    "la-spezia.it",
-    "laquila.it",
-    "laspezia.it",
-    "latina.it",
-    "lc.it",
-    "le.it",
-    "lecce.it",
-    "lecco.it",
-    "li.it",
-    "livorno.it",
-    "lo.it",
-    "lodi.it",
-    "lt.it",
-    "lu.it",
-    "lucca.it",
-    "macerata.it",
-    "mantova.it",
-    "massa-carrara.it",
-    "massacarrara.it",
-    "matera.it",
-    "mb.it",
-    "mc.it",
-    "me.it",
-    "medio-campidano.it",
-    "mediocampidano.it",
-    "messina.it",
-    "mi.it",
-    "milan.it",
-    "milano.it",
-    "mn.it",
-    "mo.it",
-    "modena.it",
-    "monza-brianza.it",
-    "monza-e-della-brianza.it",
-    "monza.it",
-    "monzabrianza.it",
-    "monzaebrianza.it",
-    "monzaedellabrianza.it",
-    "ms.it",
-    "mt.it",
-    "na.it",
-    "naples.it",
-    "napoli.it",
-    "no.it",
-    "novara.it",
-    "nu.it",
-    "nuoro.it",
-    "og.it",
-    "ogliastra.it",
-    "olbia-tempio.it",
-    "olbiatempio.it",
-    "or.it",
-    "oristano.it",
-    "ot.it",
-    "pa.it",
-    "padova.it",
-    "padua.it",
-    "palermo.it",
-    "parma.it",
-    "pavia.it",
-    "pc.it",
-    "pd.it",
-    "pe.it",
-    "perugia.it",
-    "pesaro-urbino.it",
-    "pesarourbino.it",
-    "pescara.it",
-    "pg.it",
-    "pi.it",
-    "piacenza.it",
-    "pisa.it",
-    "pistoia.it",
-    "pn.it",
-    "po.it",
-    "pordenone.it",
-    "potenza.it",
-    "pr.it",
-    "prato.it",
-    "pt.it",
-    "pu.it",
-    "pv.it",
-    "pz.it",
-    "ra.it",
-    "ragusa.it",
-    "ravenna.it",
-    "rc.it",
-    "re.it",
-    "reggio-calabria.it",
-    "reggio-emilia.it",
-    "reggiocalabria.it",
-    "reggioemilia.it",
-    "rg.it",
-    "ri.it",
-    "rieti.it",
-    "rimini.it",
-    "rm.it",
-    "rn.it",
-    "ro.it",
-    "roma.it",
-    "rome.it",
-    "rovigo.it",
-    "sa.it",
-    "salerno.it",
-    "sassari.it",
-    "savona.it",
-    "si.it",
-    "siena.it",
-    "siracusa.it",
-    "so.it",
-    "sondrio.it",
-    "sp.it",
-    "sr.it",
-    "ss.it",
-    "suedtirol.it",
-    "südtirol.it",
-    "sv.it",
-    "ta.it",
-    "taranto.it",
-    "te.it",
-    "tempio-olbia.it",
-    "tempioolbia.it",
-    "teramo.it",
-    "terni.it",
-    "tn.it",
-    "to.it",
-    "torino.it",
-    "tp.it",
-    "tr.it",
-    "trani-andria-barletta.it",
-    "trani-barletta-andria.it",
-    "traniandriabarletta.it",
-    "tranibarlettaandria.it",
-    "trapani.it",
-    "trento.it",
-    "treviso.it",
-    "trieste.it",
-    "ts.it",
-    "turin.it",
-    "tv.it",
-    "ud.it",
-    "udine.it",
-    "urbino-pesaro.it",
-    "urbinopesaro.it",
-    "va.it",
-    "varese.it",
-    "vb.it",
-    "vc.it",
-    "ve.it",
-    "venezia.it",
-    "venice.it",
-    "verbania.it",
-    "vercelli.it",
-    "verona.it",
-    "vi.it",
-    "vibo-valentia.it",
-    "vibovalentia.it",
-    "vicenza.it",
-    "viterbo.it",
-    "vr.it",
-    "vs.it",
-    "vt.it",
-    "vv.it",
-    "je",
-    "co.je",
-    "net.je",
-    "org.je",
-    "*.jm",
-    "jo",
-    "com.jo",
-    "org.jo",
-    "net.jo",
-    "edu.jo",
-    "sch.jo",
-    "gov.jo",
-    "mil.jo",
-    "name.jo",
-    "jobs",
-    "jp",
-    "ac.jp",
-    "ad.jp",
-    "co.jp",
-    "ed.jp",
-    "go.jp",
-    "gr.jp",
-    "lg.jp",
-    "ne.jp",
-    "or.jp",
-    "aichi.jp",
-    "akita.jp",
-    "aomori.jp",
-    "chiba.jp",
-    "ehime.jp",
-    "fukui.jp",
-    "fukuoka.jp",
-    "fukushima.jp",
-    "gifu.jp",
-    "gunma.jp",
-    "hiroshima.jp",
-    "hokkaido.jp",
-    "hyogo.jp",
-    "ibaraki.jp",
-    "ishikawa.jp",
-    "iwate.jp",
-    "kagawa.jp",
-    "kagoshima.jp",
-    "kanagawa.jp",
-    "kochi.jp",
-    "kumamoto.jp",
-    "kyoto.jp",
-    "mie.jp",
-    "miyagi.jp",
-    "miyazaki.jp",
-    "nagano.jp",
-    "nagasaki.jp",
-    "nara.jp",
-    "niigata.jp",
-    "oita.jp",
-    "okayama.jp",
-    "okinawa.jp",
-    "osaka.jp",
-    "saga.jp",
-    "saitama.jp",
-    "shiga.jp",
-    "shimane.jp",
-    "shizuoka.jp",
-    "tochigi.jp",
-    "tokushima.jp",
-    "tokyo.jp",
-    "tottori.jp",
-    "toyama.jp",
-    "wakayama.jp",
-    "yamagata.jp",
-    "yamaguchi.jp",
-    "yamanashi.jp",
-    "栃木.jp",
-    "愛知.jp",
-    "愛媛.jp",
-    "兵庫.jp",
-    "熊本.jp",
-    "茨城.jp",
-    "北海道.jp",
-    "千葉.jp",
-    "和歌山.jp",
-    "長崎.jp",
-    "長野.jp",
-    "新潟.jp",
-    "青森.jp",
-    "静岡.jp",
-    "東京.jp",
-    "石川.jp",
-    "埼玉.jp",
-    "三重.jp",
-    "京都.jp",
-    "佐賀.jp",
-    "大分.jp",
-    "大阪.jp",
-    "奈良.jp",
-    "宮城.jp",
-    "宮崎.jp",
-    "富山.jp",
-    "山口.jp",
-    "山形.jp",
-    "山梨.jp",
-    "岩手.jp",
-    "岐阜.jp",
-    "岡山.jp",
-    "島根.jp",
-    "広島.jp",
-    "徳島.jp",
-    "沖縄.jp",
-    "滋賀.jp",
-    "神奈川.jp",
-    "福井.jp",
-    "福岡.jp",
-    "福島.jp",
-    "秋田.jp",
-    "群馬.jp",
-    "香川.jp",
-    "高知.jp",
-    "鳥取.jp",
-    "鹿児島.jp",
-    "*.kawasaki.jp",
-    "*.kitakyushu.jp",
-    "*.kobe.jp",
-    "*.nagoya.jp",
-    "*.sapporo.jp",
-    "*.sendai.jp",
-    "*.yokohama.jp",
-    "!city.kawasaki.jp",
-    "!city.kitakyushu.jp",
-    "!city.kobe.jp",
-    "!city.nagoya.jp",
-    "!city.sapporo.jp",
-    "!city.sendai.jp",
-    "!city.yokohama.jp",
-    "aisai.aichi.jp",
-    "ama.aichi.jp",
-    "anjo.aichi.jp",
-    "asuke.aichi.jp",
-    "chiryu.aichi.jp",
-    "chita.aichi.jp",
-    "fuso.aichi.jp",
-    "gamagori.aichi.jp",
-    "handa.aichi.jp",
-    "hazu.aichi.jp",
-    "hekinan.aichi.jp",
-    "higashiura.aichi.jp",
-    "ichinomiya.aichi.jp",
-    "inazawa.aichi.jp",
-    "inuyama.aichi.jp",
-    "isshiki.aichi.jp",
-    "iwakura.aichi.jp",
-    "kanie.aichi.jp",
-    "kariya.aichi.jp",
-    "kasugai.aichi.jp",
-    "kira.aichi.jp",
-    "kiyosu.aichi.jp",
-    "komaki.aichi.jp",
-    "konan.aichi.jp",
-    "kota.aichi.jp",
-    "mihama.aichi.jp",
-    "miyoshi.aichi.jp",
-    "nishio.aichi.jp",
-    "nisshin.aichi.jp",
-    "obu.aichi.jp",
-    "oguchi.aichi.jp",
-    "oharu.aichi.jp",
-    "okazaki.aichi.jp",
-    "owariasahi.aichi.jp",
-    "seto.aichi.jp",
-    "shikatsu.aichi.jp",
-    "shinshiro.aichi.jp",
-    "shitara.aichi.jp",
-    "tahara.aichi.jp",
-    "takahama.aichi.jp",
-    "tobishima.aichi.jp",
-    "toei.aichi.jp",
-    "togo.aichi.jp",
-    "tokai.aichi.jp",
-    "tokoname.aichi.jp",
-    "toyoake.aichi.jp",
-    "toyohashi.aichi.jp",
-    "toyokawa.aichi.jp",
-    "toyone.aichi.jp",
-    "toyota.aichi.jp",
-    "tsushima.aichi.jp",
-    "yatomi.aichi.jp",
-    "akita.akita.jp",
-    "daisen.akita.jp",
-    "fujisato.akita.jp",
-    "gojome.akita.jp",
-    "hachirogata.akita.jp",
-    "happou.akita.jp",
-    "higashinaruse.akita.jp",
-    "honjo.akita.jp",
-    "honjyo.akita.jp",
-    "ikawa.akita.jp",
-    "kamikoani.akita.jp",
-    "kamioka.akita.jp",
-    "katagami.akita.jp",
-    "kazuno.akita.jp",
-    "kitaakita.akita.jp",
-    "kosaka.akita.jp",
-    "kyowa.akita.jp",
-    "misato.akita.jp",
-    "mitane.akita.jp",
-    "moriyoshi.akita.jp",
-    "nikaho.akita.jp",
-    "noshiro.akita.jp",
-    "odate.akita.jp",
-    "oga.akita.jp",
-    "ogata.akita.jp",
-    "semboku.akita.jp",
-    "yokote.akita.jp",
-    "yurihonjo.akita.jp",
-    "aomori.aomori.jp",
-    "gonohe.aomori.jp",
-    "hachinohe.aomori.jp",
-    "hashikami.aomori.jp",
-    "hiranai.aomori.jp",
-    "hirosaki.aomori.jp",
-    "itayanagi.aomori.jp",
-    "kuroishi.aomori.jp",
-    "misawa.aomori.jp",
-    "mutsu.aomori.jp",
-    "nakadomari.aomori.jp",
-    "noheji.aomori.jp",
-    "oirase.aomori.jp",
-    "owani.aomori.jp",
-    "rokunohe.aomori.jp",
-    "sannohe.aomori.jp",
-    "shichinohe.aomori.jp",
-    "shingo.aomori.jp",
-    "takko.aomori.jp",
-    "towada.aomori.jp",
-    "tsugaru.aomori.jp",
-    "tsuruta.aomori.jp",
-    "abiko.chiba.jp",
-    "asahi.chiba.jp",
-    "chonan.chiba.jp",
-    "chosei.chiba.jp",
-    "choshi.chiba.jp",
-    "chuo.chiba.jp",
-    "funabashi.chiba.jp",
-    "futtsu.chiba.jp",
-    "hanamigawa.chiba.jp",
-    "ichihara.chiba.jp",
-    "ichikawa.chiba.jp",
-    "ichinomiya.chiba.jp",
-    "inzai.chiba.jp",
-    "isumi.chiba.jp",
-    "kamagaya.chiba.jp",
-    "kamogawa.chiba.jp",
-    "kashiwa.chiba.jp",
-    "katori.chiba.jp",
-    "katsuura.chiba.jp",
-    "kimitsu.chiba.jp",
-    "kisarazu.chiba.jp",
-    "kozaki.chiba.jp",
-    "kujukuri.chiba.jp",
-    "kyonan.chiba.jp",
-    "matsudo.chiba.jp",
-    "midori.chiba.jp",
-    "mihama.chiba.jp",
-    "minamiboso.chiba.jp",
-    "mobara.chiba.jp",
-    "mutsuzawa.chiba.jp",
-    "nagara.chiba.jp",
-    "nagareyama.chiba.jp",
-    "narashino.chiba.jp",
-    "narita.chiba.jp",
-    "noda.chiba.jp",
-    "oamishirasato.chiba.jp",
-    "omigawa.chiba.jp",
-    "onjuku.chiba.jp",
-    "otaki.chiba.jp",
-    "sakae.chiba.jp",
-    "sakura.chiba.jp",
-    "shimofusa.chiba.jp",
-    "shirako.chiba.jp",
-    "shiroi.chiba.jp",
-    "shisui.chiba.jp",
-    "sodegaura.chiba.jp",
-    "sosa.chiba.jp",
-    "tako.chiba.jp",
-    "tateyama.chiba.jp",
-    "togane.chiba.jp",
-    "tohnosho.chiba.jp",
-    "tomisato.chiba.jp",
-    "urayasu.chiba.jp",
-    "yachimata.chiba.jp",
-    "yachiyo.chiba.jp",
-    "yokaichiba.chiba.jp",
-    "yokoshibahikari.chiba.jp",
-    "yotsukaido.chiba.jp",
-    "ainan.ehime.jp",
-    "honai.ehime.jp",
-    "ikata.ehime.jp",
-    "imabari.ehime.jp",
-    "iyo.ehime.jp",
-    "kamijima.ehime.jp",
-    "kihoku.ehime.jp",
-    "kumakogen.ehime.jp",
-    "masaki.ehime.jp",
-    "matsuno.ehime.jp",
-    "matsuyama.ehime.jp",
-    "namikata.ehime.jp",
-    "niihama.ehime.jp",
-    "ozu.ehime.jp",
-    "saijo.ehime.jp",
-    "seiyo.ehime.jp",
-    "shikokuchuo.ehime.jp",
-    "tobe.ehime.jp",
-    "toon.ehime.jp",
-    "uchiko.ehime.jp",
-    "uwajima.ehime.jp",
-    "yawatahama.ehime.jp",
-    "echizen.fukui.jp",
-    "eiheiji.fukui.jp",
-    "fukui.fukui.jp",
-    "ikeda.fukui.jp",
-    "katsuyama.fukui.jp",
-    "mihama.fukui.jp",
-    "minamiechizen.fukui.jp",
-    "obama.fukui.jp",
-    "ohi.fukui.jp",
-    "ono.fukui.jp",
-    "sabae.fukui.jp",
-    "sakai.fukui.jp",
-    "takahama.fukui.jp",
-    "tsuruga.fukui.jp",
-    "wakasa.fukui.jp",
-    "ashiya.fukuoka.jp",
-    "buzen.fukuoka.jp",
-    "chikugo.fukuoka.jp",
-    "chikuho.fukuoka.jp",
-    "chikujo.fukuoka.jp",
-    "chikushino.fukuoka.jp",
-    "chikuzen.fukuoka.jp",
-    "chuo.fukuoka.jp",
-    "dazaifu.fukuoka.jp",
-    "fukuchi.fukuoka.jp",
-    "hakata.fukuoka.jp",
-    "higashi.fukuoka.jp",
-    "hirokawa.fukuoka.jp",
-    "hisayama.fukuoka.jp",
-    "iizuka.fukuoka.jp",
-    "inatsuki.fukuoka.jp",
-    "kaho.fukuoka.jp",
-    "kasuga.fukuoka.jp",
-    "kasuya.fukuoka.jp",
-    "kawara.fukuoka.jp",
-    "keisen.fukuoka.jp",
-    "koga.fukuoka.jp",
-    "kurate.fukuoka.jp",
-    "kurogi.fukuoka.jp",
-    "kurume.fukuoka.jp",
-    "minami.fukuoka.jp",
-    "miyako.fukuoka.jp",
-    "miyama.fukuoka.jp",
-    "miyawaka.fukuoka.jp",
-    "mizumaki.fukuoka.jp",
-    "munakata.fukuoka.jp",
-    "nakagawa.fukuoka.jp",
-    "nakama.fukuoka.jp",
-    "nishi.fukuoka.jp",
-    "nogata.fukuoka.jp",
-    "ogori.fukuoka.jp",
-    "okagaki.fukuoka.jp",
-    "okawa.fukuoka.jp",
-    "oki.fukuoka.jp",
-    "omuta.fukuoka.jp",
-    "onga.fukuoka.jp",
-    "onojo.fukuoka.jp",
-    "oto.fukuoka.jp",
-    "saigawa.fukuoka.jp",
-    "sasaguri.fukuoka.jp",
-    "shingu.fukuoka.jp",
-    "shinyoshitomi.fukuoka.jp",
-    "shonai.fukuoka.jp",
-    "soeda.fukuoka.jp",
-    "sue.fukuoka.jp",
-    "tachiarai.fukuoka.jp",
-    "tagawa.fukuoka.jp",
-    "takata.fukuoka.jp",
-    "toho.fukuoka.jp",
-    "toyotsu.fukuoka.jp",
-    "tsuiki.fukuoka.jp",
-    "ukiha.fukuoka.jp",
-    "umi.fukuoka.jp",
-    "usui.fukuoka.jp",
-    "yamada.fukuoka.jp",
-    "yame.fukuoka.jp",
-    "yanagawa.fukuoka.jp",
-    "yukuhashi.fukuoka.jp",
-    "aizubange.fukushima.jp",
-    "aizumisato.fukushima.jp",
-    "aizuwakamatsu.fukushima.jp",
-    "asakawa.fukushima.jp",
-    "bandai.fukushima.jp",
-    "date.fukushima.jp",
-    "fukushima.fukushima.jp",
-    "furudono.fukushima.jp",
-    "futaba.fukushima.jp",
-    "hanawa.fukushima.jp",
-    "higashi.fukushima.jp",
-    "hirata.fukushima.jp",
-    "hirono.fukushima.jp",
-    "iitate.fukushima.jp",
-    "inawashiro.fukushima.jp",
-    "ishikawa.fukushima.jp",
-    "iwaki.fukushima.jp",
-    "izumizaki.fukushima.jp",
-    "kagamiishi.fukushima.jp",
-    "kaneyama.fukushima.jp",
-    "kawamata.fukushima.jp",
-    "kitakata.fukushima.jp",
-    "kitashiobara.fukushima.jp",
-    "koori.fukushima.jp",
-    "koriyama.fukushima.jp",
-    "kunimi.fukushima.jp",
-    "miharu.fukushima.jp",
-    "mishima.fukushima.jp",
-    "namie.fukushima.jp",
-    "nango.fukushima.jp",
-    "nishiaizu.fukushima.jp",
-    "nishigo.fukushima.jp",
-    "okuma.fukushima.jp",
-    "omotego.fukushima.jp",
-    "ono.fukushima.jp",
-    "otama.fukushima.jp",
-    "samegawa.fukushima.jp",
-    "shimogo.fukushima.jp",
-    "shirakawa.fukushima.jp",
-    "showa.fukushima.jp",
-    "soma.fukushima.jp",
-    "sukagawa.fukushima.jp",
-    "taishin.fukushima.jp",
-    "tamakawa.fukushima.jp",
-    "tanagura.fukushima.jp",
-    "tenei.fukushima.jp",
-    "yabuki.fukushima.jp",
-    "yamato.fukushima.jp",
-    "yamatsuri.fukushima.jp",
-    "yanaizu.fukushima.jp",
-    "yugawa.fukushima.jp",
-    "anpachi.gifu.jp",
-    "ena.gifu.jp",
-    "gifu.gifu.jp",
-    "ginan.gifu.jp",
-    "godo.gifu.jp",
-    "gujo.gifu.jp",
-    "hashima.gifu.jp",
-    "hichiso.gifu.jp",
-    "hida.gifu.jp",
-    "higashishirakawa.gifu.jp",
-    "ibigawa.gifu.jp",
-    "ikeda.gifu.jp",
-    "kakamigahara.gifu.jp",
-    "kani.gifu.jp",
-    "kasahara.gifu.jp",
-    "kasamatsu.gifu.jp",
-    "kawaue.gifu.jp",
-    "kitagata.gifu.jp",
-    "mino.gifu.jp",
-    "minokamo.gifu.jp",
-    "mitake.gifu.jp",
-    "mizunami.gifu.jp",
-    "motosu.gifu.jp",
-    "nakatsugawa.gifu.jp",
-    "ogaki.gifu.jp",
-    "sakahogi.gifu.jp",
-    "seki.gifu.jp",
-    "sekigahara.gifu.jp",
-    "shirakawa.gifu.jp",
-    "tajimi.gifu.jp",
-    "takayama.gifu.jp",
-    "tarui.gifu.jp",
-    "toki.gifu.jp",
-    "tomika.gifu.jp",
-    "wanouchi.gifu.jp",
-    "yamagata.gifu.jp",
-    "yaotsu.gifu.jp",
-    "yoro.gifu.jp",
-    "annaka.gunma.jp",
-    "chiyoda.gunma.jp",
-    "fujioka.gunma.jp",
-    "higashiagatsuma.gunma.jp",
-    "isesaki.gunma.jp",
-    "itakura.gunma.jp",
-    "kanna.gunma.jp",
-    "kanra.gunma.jp",
-    "katashina.gunma.jp",
-    "kawaba.gunma.jp",
-    "kiryu.gunma.jp",
-    "kusatsu.gunma.jp",
-    "maebashi.gunma.jp",
-    "meiwa.gunma.jp",
-    "midori.gunma.jp",
-    "minakami.gunma.jp",
-    "naganohara.gunma.jp",
-    "nakanojo.gunma.jp",
-    "nanmoku.gunma.jp",
-    "numata.gunma.jp",
-    "oizumi.gunma.jp",
-    "ora.gunma.jp",
-    "ota.gunma.jp",
-    "shibukawa.gunma.jp",
-    "shimonita.gunma.jp",
-    "shinto.gunma.jp",
-    "showa.gunma.jp",
-    "takasaki.gunma.jp",
-    "takayama.gunma.jp",
-    "tamamura.gunma.jp",
-    "tatebayashi.gunma.jp",
-    "tomioka.gunma.jp",
-    "tsukiyono.gunma.jp",
-    "tsumagoi.gunma.jp",
-    "ueno.gunma.jp",
-    "yoshioka.gunma.jp",
-    "asaminami.hiroshima.jp",
-    "daiwa.hiroshima.jp",
-    "etajima.hiroshima.jp",
-    "fuchu.hiroshima.jp",
-    "fukuyama.hiroshima.jp",
-    "hatsukaichi.hiroshima.jp",
-    "higashihiroshima.hiroshima.jp",
-    "hongo.hiroshima.jp",
-    "jinsekikogen.hiroshima.jp",
-    "kaita.hiroshima.jp",
-    "kui.hiroshima.jp",
-    "kumano.hiroshima.jp",
-    "kure.hiroshima.jp",
-    "mihara.hiroshima.jp",
-    "miyoshi.hiroshima.jp",
-    "naka.hiroshima.jp",
-    "onomichi.hiroshima.jp",
-    "osakikamijima.hiroshima.jp",
-    "otake.hiroshima.jp",
-    "saka.hiroshima.jp",
-    "sera.hiroshima.jp",
-    "seranishi.hiroshima.jp",
-    "shinichi.hiroshima.jp",
-    "shobara.hiroshima.jp",
-    "takehara.hiroshima.jp",
-    "abashiri.hokkaido.jp",
-    "abira.hokkaido.jp",
-    "aibetsu.hokkaido.jp",
-    "akabira.hokkaido.jp",
-    "akkeshi.hokkaido.jp",
-    "asahikawa.hokkaido.jp",
-    "ashibetsu.hokkaido.jp",
-    "ashoro.hokkaido.jp",
-    "assabu.hokkaido.jp",
-    "atsuma.hokkaido.jp",
-    "bibai.hokkaido.jp",
-    "biei.hokkaido.jp",
-    "bifuka.hokkaido.jp",
-    "bihoro.hokkaido.jp",
-    "biratori.hokkaido.jp",
-    "chippubetsu.hokkaido.jp",
-    "chitose.hokkaido.jp",
-    "date.hokkaido.jp",
-    "ebetsu.hokkaido.jp",
-    "embetsu.hokkaido.jp",
-    "eniwa.hokkaido.jp",
-    "erimo.hokkaido.jp",
-    "esan.hokkaido.jp",
-    "esashi.hokkaido.jp",
-    "fukagawa.hokkaido.jp",
-    "fukushima.hokkaido.jp",
-    "furano.hokkaido.jp",
-    "furubira.hokkaido.jp",
-    "haboro.hokkaido.jp",
-    "hakodate.hokkaido.jp",
-    "hamatonbetsu.hokkaido.jp",
-    "hidaka.hokkaido.jp",
-    "higashikagura.hokkaido.jp",
-    "higashikawa.hokkaido.jp",
-    "hiroo.hokkaido.jp",
-    "hokuryu.hokkaido.jp",
-    "hokuto.hokkaido.jp",
-    "honbetsu.hokkaido.jp",
-    "horokanai.hokkaido.jp",
-    "horonobe.hokkaido.jp",
-    "ikeda.hokkaido.jp",
-    "imakane.hokkaido.jp",
-    "ishikari.hokkaido.jp",
-    "iwamizawa.hokkaido.jp",
-    "iwanai.hokkaido.jp",
-    "kamifurano.hokkaido.jp",
-    "kamikawa.hokkaido.jp",
-    "kamishihoro.hokkaido.jp",
-    "kamisunagawa.hokkaido.jp",
-    "kamoenai.hokkaido.jp",
-    "kayabe.hokkaido.jp",
-    "kembuchi.hokkaido.jp",
-    "kikonai.hokkaido.jp",
-    "kimobetsu.hokkaido.jp",
-    "kitahiroshima.hokkaido.jp",
-    "kitami.hokkaido.jp",
-    "kiyosato.hokkaido.jp",
-    "koshimizu.hokkaido.jp",
-    "kunneppu.hokkaido.jp",
-    "kuriyama.hokkaido.jp",
-    "kuromatsunai.hokkaido.jp",
-    "kushiro.hokkaido.jp",
-    "kutchan.hokkaido.jp",
-    "kyowa.hokkaido.jp",
-    "mashike.hokkaido.jp",
-    "matsumae.hokkaido.jp",
-    "mikasa.hokkaido.jp",
-    "minamifurano.hokkaido.jp",
-    "mombetsu.hokkaido.jp",
-    "moseushi.hokkaido.jp",
-    "mukawa.hokkaido.jp",
-    "muroran.hokkaido.jp",
-    "naie.hokkaido.jp",
-    "nakagawa.hokkaido.jp",
-    "nakasatsunai.hokkaido.jp",
-    "nakatombetsu.hokkaido.jp",
-    "nanae.hokkaido.jp",
-    "nanporo.hokkaido.jp",
-    "nayoro.hokkaido.jp",
-    "nemuro.hokkaido.jp",
-    "niikappu.hokkaido.jp",
-    "niki.hokkaido.jp",
-    "nishiokoppe.hokkaido.jp",
-    "noboribetsu.hokkaido.jp",
-    "numata.hokkaido.jp",
-    "obihiro.hokkaido.jp",
-    "obira.hokkaido.jp",
-    "oketo.hokkaido.jp",
-    "okoppe.hokkaido.jp",
-    "otaru.hokkaido.jp",
-    "otobe.hokkaido.jp",
-    "otofuke.hokkaido.jp",
-    "otoineppu.hokkaido.jp",
-    "oumu.hokkaido.jp",
-    "ozora.hokkaido.jp",
-    "pippu.hokkaido.jp",
-    "rankoshi.hokkaido.jp",
-    "rebun.hokkaido.jp",
-    "rikubetsu.hokkaido.jp",
-    "rishiri.hokkaido.jp",
-    "rishirifuji.hokkaido.jp",
-    "saroma.hokkaido.jp",
-    "sarufutsu.hokkaido.jp",
-    "shakotan.hokkaido.jp",
-    "shari.hokkaido.jp",
-    "shibecha.hokkaido.jp",
-    "shibetsu.hokkaido.jp",
-    "shikabe.hokkaido.jp",
-    "shikaoi.hokkaido.jp",
-    "shimamaki.hokkaido.jp",
-    "shimizu.hokkaido.jp",
-    "shimokawa.hokkaido.jp",
-    "shinshinotsu.hokkaido.jp",
-    "shintoku.hokkaido.jp",
-    "shiranuka.hokkaido.jp",
-    "shiraoi.hokkaido.jp",
-    "shiriuchi.hokkaido.jp",
-    "sobetsu.hokkaido.jp",
-    "sunagawa.hokkaido.jp",
-    "taiki.hokkaido.jp",
-    "takasu.hokkaido.jp",
-    "takikawa.hokkaido.jp",
-    "takinoue.hokkaido.jp",
-    "teshikaga.hokkaido.jp",
-    "tobetsu.hokkaido.jp",
-    "tohma.hokkaido.jp",
-    "tomakomai.hokkaido.jp",
-    "tomari.hokkaido.jp",
-    "toya.hokkaido.jp",
-    "toyako.hokkaido.jp",
-    "toyotomi.hokkaido.jp",
-    "toyoura.hokkaido.jp",
-    "tsubetsu.hokkaido.jp",
-    "tsukigata.hokkaido.jp",
-    "urakawa.hokkaido.jp",
-    "urausu.hokkaido.jp",
-    "uryu.hokkaido.jp",
-    "utashinai.hokkaido.jp",
-    "wakkanai.hokkaido.jp",
-    "wassamu.hokkaido.jp",
-    "yakumo.hokkaido.jp",
-    "yoichi.hokkaido.jp",
-    "aioi.hyogo.jp",
-    "akashi.hyogo.jp",
-    "ako.hyogo.jp",
-    "amagasaki.hyogo.jp",
-    "aogaki.hyogo.jp",
-    "asago.hyogo.jp",
-    "ashiya.hyogo.jp",
-    "awaji.hyogo.jp",
-    "fukusaki.hyogo.jp",
-    "goshiki.hyogo.jp",
-    "harima.hyogo.jp",
-    "himeji.hyogo.jp",
-    "ichikawa.hyogo.jp",
-    "inagawa.hyogo.jp",
-    "itami.hyogo.jp",
-    "kakogawa.hyogo.jp",
-    "kamigori.hyogo.jp",
-    "kamikawa.hyogo.jp",
-    "kasai.hyogo.jp",
-    "kasuga.hyogo.jp",
-    "kawanishi.hyogo.jp",
-    "miki.hyogo.jp",
-    "minamiawaji.hyogo.jp",
-    "nishinomiya.hyogo.jp",
-    "nishiwaki.hyogo.jp",
-    "ono.hyogo.jp",
-    "sanda.hyogo.jp",
-    "sannan.hyogo.jp",
-    "sasayama.hyogo.jp",
-    "sayo.hyogo.jp",
-    "shingu.hyogo.jp",
-    "shinonsen.hyogo.jp",
-    "shiso.hyogo.jp",
-    "sumoto.hyogo.jp",
-    "taishi.hyogo.jp",
-    "taka.hyogo.jp",
-    "takarazuka.hyogo.jp",
-    "takasago.hyogo.jp",
-    "takino.hyogo.jp",
-    "tamba.hyogo.jp",
-    "tatsuno.hyogo.jp",
-    "toyooka.hyogo.jp",
-    "yabu.hyogo.jp",
-    "yashiro.hyogo.jp",
-    "yoka.hyogo.jp",
-    "yokawa.hyogo.jp",
-    "ami.ibaraki.jp",
-    "asahi.ibaraki.jp",
-    "bando.ibaraki.jp",
-    "chikusei.ibaraki.jp",
-    "daigo.ibaraki.jp",
-    "fujishiro.ibaraki.jp",
-    "hitachi.ibaraki.jp",
-    "hitachinaka.ibaraki.jp",
-    "hitachiomiya.ibaraki.jp",
-    "hitachiota.ibaraki.jp",
-    "ibaraki.ibaraki.jp",
-    "ina.ibaraki.jp",
-    "inashiki.ibaraki.jp",
-    "itako.ibaraki.jp",
-    "iwama.ibaraki.jp",
-    "joso.ibaraki.jp",
-    "kamisu.ibaraki.jp",
-    "kasama.ibaraki.jp",
-    "kashima.ibaraki.jp",
-    "kasumigaura.ibaraki.jp",
-    "koga.ibaraki.jp",
-    "miho.ibaraki.jp",
-    "mito.ibaraki.jp",
-    "moriya.ibaraki.jp",
-    "naka.ibaraki.jp",
-    "namegata.ibaraki.jp",
-    "oarai.ibaraki.jp",
-    "ogawa.ibaraki.jp",
-    "omitama.ibaraki.jp",
-    "ryugasaki.ibaraki.jp",
-    "sakai.ibaraki.jp",
-    "sakuragawa.ibaraki.jp",
-    "shimodate.ibaraki.jp",
-    "shimotsuma.ibaraki.jp",
-    "shirosato.ibaraki.jp",
-    "sowa.ibaraki.jp",
-    "suifu.ibaraki.jp",
-    "takahagi.ibaraki.jp",
-    "tamatsukuri.ibaraki.jp",
-    "tokai.ibaraki.jp",
-    "tomobe.ibaraki.jp",
-    "tone.ibaraki.jp",
-    "toride.ibaraki.jp",
-    "tsuchiura.ibaraki.jp",
-    "tsukuba.ibaraki.jp",
-    "uchihara.ibaraki.jp",
-    "ushiku.ibaraki.jp",
-    "yachiyo.ibaraki.jp",
-    "yamagata.ibaraki.jp",
-    "yawara.ibaraki.jp",
-    "yuki.ibaraki.jp",
-    "anamizu.ishikawa.jp",
-    "hakui.ishikawa.jp",
-    "hakusan.ishikawa.jp",
-    "kaga.ishikawa.jp",
-    "kahoku.ishikawa.jp",
-    "kanazawa.ishikawa.jp",
-    "kawakita.ishikawa.jp",
-    "komatsu.ishikawa.jp",
-    "nakanoto.ishikawa.jp",
-    "nanao.ishikawa.jp",
-    "nomi.ishikawa.jp",
-    "nonoichi.ishikawa.jp",
-    "noto.ishikawa.jp",
-    "shika.ishikawa.jp",
-    "suzu.ishikawa.jp",
-    "tsubata.ishikawa.jp",
-    "tsurugi.ishikawa.jp",
-    "uchinada.ishikawa.jp",
-    "wajima.ishikawa.jp",
-    "fudai.iwate.jp",
-    "fujisawa.iwate.jp",
-    "hanamaki.iwate.jp",
-    "hiraizumi.iwate.jp",
-    "hirono.iwate.jp",
-    "ichinohe.iwate.jp",
-    "ichinoseki.iwate.jp",
-    "iwaizumi.iwate.jp",
-    "iwate.iwate.jp",
-    "joboji.iwate.jp",
-    "kamaishi.iwate.jp",
-    "kanegasaki.iwate.jp",
-    "karumai.iwate.jp",
-    "kawai.iwate.jp",
-    "kitakami.iwate.jp",
-    "kuji.iwate.jp",
-    "kunohe.iwate.jp",
-    "kuzumaki.iwate.jp",
-    "miyako.iwate.jp",
-    "mizusawa.iwate.jp",
-    "morioka.iwate.jp",
-    "ninohe.iwate.jp",
-    "noda.iwate.jp",
-    "ofunato.iwate.jp",
-    "oshu.iwate.jp",
-    "otsuchi.iwate.jp",
-    "rikuzentakata.iwate.jp",
-    "shiwa.iwate.jp",
-    "shizukuishi.iwate.jp",
-    "sumita.iwate.jp",
-    "tanohata.iwate.jp",
-    "tono.iwate.jp",
-    "yahaba.iwate.jp",
-    "yamada.iwate.jp",
-    "ayagawa.kagawa.jp",
-    "higashikagawa.kagawa.jp",
-    "kanonji.kagawa.jp",
-    "kotohira.kagawa.jp",
-    "manno.kagawa.jp",
-    "marugame.kagawa.jp",
-    "mitoyo.kagawa.jp",
-    "naoshima.kagawa.jp",
-    "sanuki.kagawa.jp",
-    "tadotsu.kagawa.jp",
-    "takamatsu.kagawa.jp",
-    "tonosho.kagawa.jp",
-    "uchinomi.kagawa.jp",
-    "utazu.kagawa.jp",
-    "zentsuji.kagawa.jp",
-    "akune.kagoshima.jp",
-    "amami.kagoshima.jp",
-    "hioki.kagoshima.jp",
-    "isa.kagoshima.jp",
-    "isen.kagoshima.jp",
-    "izumi.kagoshima.jp",
-    "kagoshima.kagoshima.jp",
-    "kanoya.kagoshima.jp",
-    "kawanabe.kagoshima.jp",
-    "kinko.kagoshima.jp",
-    "kouyama.kagoshima.jp",
-    "makurazaki.kagoshima.jp",
-    "matsumoto.kagoshima.jp",
-    "minamitane.kagoshima.jp",
-    "nakatane.kagoshima.jp",
-    "nishinoomote.kagoshima.jp",
-    "satsumasendai.kagoshima.jp",
-    "soo.kagoshima.jp",
-    "tarumizu.kagoshima.jp",
-    "yusui.kagoshima.jp",
-    "aikawa.kanagawa.jp",
-    "atsugi.kanagawa.jp",
-    "ayase.kanagawa.jp",
-    "chigasaki.kanagawa.jp",
-    "ebina.kanagawa.jp",
-    "fujisawa.kanagawa.jp",
-    "hadano.kanagawa.jp",
-    "hakone.kanagawa.jp",
-    "hiratsuka.kanagawa.jp",
-    "isehara.kanagawa.jp",
-    "kaisei.kanagawa.jp",
-    "kamakura.kanagawa.jp",
-    "kiyokawa.kanagawa.jp",
-    "matsuda.kanagawa.jp",
-    "minamiashigara.kanagawa.jp",
-    "miura.kanagawa.jp",
-    "nakai.kanagawa.jp",
-    "ninomiya.kanagawa.jp",
-    "odawara.kanagawa.jp",
-    "oi.kanagawa.jp",
-    "oiso.kanagawa.jp",
-    "sagamihara.kanagawa.jp",
-    "samukawa.kanagawa.jp",
-    "tsukui.kanagawa.jp",
-    "yamakita.kanagawa.jp",
-    "yamato.kanagawa.jp",
-    "yokosuka.kanagawa.jp",
-    "yugawara.kanagawa.jp",
-    "zama.kanagawa.jp",
-    "zushi.kanagawa.jp",
-    "aki.kochi.jp",
-    "geisei.kochi.jp",
-    "hidaka.kochi.jp",
-    "higashitsuno.kochi.jp",
-    "ino.kochi.jp",
-    "kagami.kochi.jp",
-    "kami.kochi.jp",
-    "kitagawa.kochi.jp",
-    "kochi.kochi.jp",
-    "mihara.kochi.jp",
-    "motoyama.kochi.jp",
-    "muroto.kochi.jp",
-    "nahari.kochi.jp",
-    "nakamura.kochi.jp",
-    "nankoku.kochi.jp",
-    "nishitosa.kochi.jp",
-    "niyodogawa.kochi.jp",
-    "ochi.kochi.jp",
-    "okawa.kochi.jp",
-    "otoyo.kochi.jp",
-    "otsuki.kochi.jp",
-    "sakawa.kochi.jp",
-    "sukumo.kochi.jp",
-    "susaki.kochi.jp",
-    "tosa.kochi.jp",
-    "tosashimizu.kochi.jp",
-    "toyo.kochi.jp",
-    "tsuno.kochi.jp",
-    "umaji.kochi.jp",
-    "yasuda.kochi.jp",
-    "yusuhara.kochi.jp",
-    "amakusa.kumamoto.jp",
-    "arao.kumamoto.jp",
-    "aso.kumamoto.jp",
-    "choyo.kumamoto.jp",
-    "gyokuto.kumamoto.jp",
-    "kamiamakusa.kumamoto.jp",
-    "kikuchi.kumamoto.jp",
-    "kumamoto.kumamoto.jp",
-    "mashiki.kumamoto.jp",
-    "mifune.kumamoto.jp",
-    "minamata.kumamoto.jp",
-    "minamioguni.kumamoto.jp",
-    "nagasu.kumamoto.jp",
-    "nishihara.kumamoto.jp",
-    "oguni.kumamoto.jp",
-    "ozu.kumamoto.jp",
-    "sumoto.kumamoto.jp",
-    "takamori.kumamoto.jp",
-    "uki.kumamoto.jp",
-    "uto.kumamoto.jp",
-    "yamaga.kumamoto.jp",
-    "yamato.kumamoto.jp",
-    "yatsushiro.kumamoto.jp",
-    "ayabe.kyoto.jp",
-    "fukuchiyama.kyoto.jp",
-    "higashiyama.kyoto.jp",
-    "ide.kyoto.jp",
-    "ine.kyoto.jp",
-    "joyo.kyoto.jp",
-    "kameoka.kyoto.jp",
-    "kamo.kyoto.jp",
-    "kita.kyoto.jp",
-    "kizu.kyoto.jp",
-    "kumiyama.kyoto.jp",
-    "kyotamba.kyoto.jp",
-    "kyotanabe.kyoto.jp",
-    "kyotango.kyoto.jp",
-    "maizuru.kyoto.jp",
-    "minami.kyoto.jp",
-    "minamiyamashiro.kyoto.jp",
-    "miyazu.kyoto.jp",
-    "muko.kyoto.jp",
-    "nagaokakyo.kyoto.jp",
-    "nakagyo.kyoto.jp",
-    "nantan.kyoto.jp",
-    "oyamazaki.kyoto.jp",
-    "sakyo.kyoto.jp",
-    "seika.kyoto.jp",
-    "tanabe.kyoto.jp",
-    "uji.kyoto.jp",
-    "ujitawara.kyoto.jp",
-    "wazuka.kyoto.jp",
-    "yamashina.kyoto.jp",
-    "yawata.kyoto.jp",
-    "asahi.mie.jp",
-    "inabe.mie.jp",
-    "ise.mie.jp",
-    "kameyama.mie.jp",
-    "kawagoe.mie.jp",
-    "kiho.mie.jp",
-    "kisosaki.mie.jp",
-    "kiwa.mie.jp",
-    "komono.mie.jp",
-    "kumano.mie.jp",
-    "kuwana.mie.jp",
-    "matsusaka.mie.jp",
-    "meiwa.mie.jp",
-    "mihama.mie.jp",
-    "minamiise.mie.jp",
-    "misugi.mie.jp",
-    "miyama.mie.jp",
-    "nabari.mie.jp",
-    "shima.mie.jp",
-    "suzuka.mie.jp",
-    "tado.mie.jp",
-    "taiki.mie.jp",
-    "taki.mie.jp",
-    "tamaki.mie.jp",
-    "toba.mie.jp",
-    "tsu.mie.jp",
-    "udono.mie.jp",
-    "ureshino.mie.jp",
-    "watarai.mie.jp",
-    "yokkaichi.mie.jp",
-    "furukawa.miyagi.jp",
-    "higashimatsushima.miyagi.jp",
-    "ishinomaki.miyagi.jp",
-    "iwanuma.miyagi.jp",
-    "kakuda.miyagi.jp",
-    "kami.miyagi.jp",
-    "kawasaki.miyagi.jp",
-    "marumori.miyagi.jp",
-    "matsushima.miyagi.jp",
-    "minamisanriku.miyagi.jp",
-    "misato.miyagi.jp",
-    "murata.miyagi.jp",
-    "natori.miyagi.jp",
-    "ogawara.miyagi.jp",
-    "ohira.miyagi.jp",
-    "onagawa.miyagi.jp",
-    "osaki.miyagi.jp",
-    "rifu.miyagi.jp",
-    "semine.miyagi.jp",
-    "shibata.miyagi.jp",
-    "shichikashuku.miyagi.jp",
-    "shikama.miyagi.jp",
-    "shiogama.miyagi.jp",
-    "shiroishi.miyagi.jp",
-    "tagajo.miyagi.jp",
-    "taiwa.miyagi.jp",
-    "tome.miyagi.jp",
-    "tomiya.miyagi.jp",
-    "wakuya.miyagi.jp",
-    "watari.miyagi.jp",
-    "yamamoto.miyagi.jp",
-    "zao.miyagi.jp",
-    "aya.miyazaki.jp",
-    "ebino.miyazaki.jp",
-    "gokase.miyazaki.jp",
-    "hyuga.miyazaki.jp",
-    "kadogawa.miyazaki.jp",
-    "kawaminami.miyazaki.jp",
-    "kijo.miyazaki.jp",
-    "kitagawa.miyazaki.jp",
-    "kitakata.miyazaki.jp",
-    "kitaura.miyazaki.jp",
-    "kobayashi.miyazaki.jp",
-    "kunitomi.miyazaki.jp",
-    "kushima.miyazaki.jp",
-    "mimata.miyazaki.jp",
-    "miyakonojo.miyazaki.jp",
-    "miyazaki.miyazaki.jp",
-    "morotsuka.miyazaki.jp",
-    "nichinan.miyazaki.jp",
-    "nishimera.miyazaki.jp",
-    "nobeoka.miyazaki.jp",
-    "saito.miyazaki.jp",
-    "shiiba.miyazaki.jp",
-    "shintomi.miyazaki.jp",
-    "takaharu.miyazaki.jp",
-    "takanabe.miyazaki.jp",
-    "takazaki.miyazaki.jp",
-    "tsuno.miyazaki.jp",
-    "achi.nagano.jp",
-    "agematsu.nagano.jp",
-    "anan.nagano.jp",
-    "aoki.nagano.jp",
-    "asahi.nagano.jp",
-    "azumino.nagano.jp",
-    "chikuhoku.nagano.jp",
-    "chikuma.nagano.jp",
-    "chino.nagano.jp",
-    "fujimi.nagano.jp",
-    "hakuba.nagano.jp",
-    "hara.nagano.jp",
-    "hiraya.nagano.jp",
-    "iida.nagano.jp",
-    "iijima.nagano.jp",
-    "iiyama.nagano.jp",
-    "iizuna.nagano.jp",
-    "ikeda.nagano.jp",
-    "ikusaka.nagano.jp",
-    "ina.nagano.jp",
-    "karuizawa.nagano.jp",
-    "kawakami.nagano.jp",
-    "kiso.nagano.jp",
-    "kisofukushima.nagano.jp",
-    "kitaaiki.nagano.jp",
-    "komagane.nagano.jp",
-    "komoro.nagano.jp",
-    "matsukawa.nagano.jp",
-    "matsumoto.nagano.jp",
-    "miasa.nagano.jp",
-    "minamiaiki.nagano.jp",
-    "minamimaki.nagano.jp",
-    "minamiminowa.nagano.jp",
-    "minowa.nagano.jp",
-    "miyada.nagano.jp",
-    "miyota.nagano.jp",
-    "mochizuki.nagano.jp",
-    "nagano.nagano.jp",
-    "nagawa.nagano.jp",
-    "nagiso.nagano.jp",
-    "nakagawa.nagano.jp",
-    "nakano.nagano.jp",
-    "nozawaonsen.nagano.jp",
-    "obuse.nagano.jp",
-    "ogawa.nagano.jp",
-    "okaya.nagano.jp",
-    "omachi.nagano.jp",
-    "omi.nagano.jp",
-    "ookuwa.nagano.jp",
-    "ooshika.nagano.jp",
-    "otaki.nagano.jp",
-    "otari.nagano.jp",
-    "sakae.nagano.jp",
-    "sakaki.nagano.jp",
-    "saku.nagano.jp",
-    "sakuho.nagano.jp",
-    "shimosuwa.nagano.jp",
-    "shinanomachi.nagano.jp",
-    "shiojiri.nagano.jp",
-    "suwa.nagano.jp",
-    "suzaka.nagano.jp",
-    "takagi.nagano.jp",
-    "takamori.nagano.jp",
-    "takayama.nagano.jp",
-    "tateshina.nagano.jp",
-    "tatsuno.nagano.jp",
-    "togakushi.nagano.jp",
-    "togura.nagano.jp",
-    "tomi.nagano.jp",
-    "ueda.nagano.jp",
-    "wada.nagano.jp",
-    "yamagata.nagano.jp",
-    "yamanouchi.nagano.jp",
-    "yasaka.nagano.jp",
-    "yasuoka.nagano.jp",
-    "chijiwa.nagasaki.jp",
-    "futsu.nagasaki.jp",
-    "goto.nagasaki.jp",
-    "hasami.nagasaki.jp",
-    "hirado.nagasaki.jp",
-    "iki.nagasaki.jp",
-    "isahaya.nagasaki.jp",
-    "kawatana.nagasaki.jp",
-    "kuchinotsu.nagasaki.jp",
-    "matsuura.nagasaki.jp",
-    "nagasaki.nagasaki.jp",
-    "obama.nagasaki.jp",
-    "omura.nagasaki.jp",
-    "oseto.nagasaki.jp",
-    "saikai.nagasaki.jp",
-    "sasebo.nagasaki.jp",
-    "seihi.nagasaki.jp",
-    "shimabara.nagasaki.jp",
-    "shinkamigoto.nagasaki.jp",
-    "togitsu.nagasaki.jp",
-    "tsushima.nagasaki.jp",
-    "unzen.nagasaki.jp",
-    "ando.nara.jp",
-    "gose.nara.jp",
-    "heguri.nara.jp",
-    "higashiyoshino.nara.jp",
-    "ikaruga.nara.jp",
-    "ikoma.nara.jp",
-    "kamikitayama.nara.jp",
-    "kanmaki.nara.jp",
-    "kashiba.nara.jp",
-    "kashihara.nara.jp",
-    "katsuragi.nara.jp",
-    "kawai.nara.jp",
-    "kawakami.nara.jp",
-    "kawanishi.nara.jp",
-    "koryo.nara.jp",
-    "kurotaki.nara.jp",
-    "mitsue.nara.jp",
-    "miyake.nara.jp",
-    "nara.nara.jp",
-    "nosegawa.nara.jp",
-    "oji.nara.jp",
-    "ouda.nara.jp",
-    "oyodo.nara.jp",
-    "sakurai.nara.jp",
-    "sango.nara.jp",
-    "shimoichi.nara.jp",
-    "shimokitayama.nara.jp",
-    "shinjo.nara.jp",
-    "soni.nara.jp",
-    "takatori.nara.jp",
-    "tawaramoto.nara.jp",
-    "tenkawa.nara.jp",
-    "tenri.nara.jp",
-    "uda.nara.jp",
-    "yamatokoriyama.nara.jp",
-    "yamatotakada.nara.jp",
-    "yamazoe.nara.jp",
-    "yoshino.nara.jp",
-    "aga.niigata.jp",
-    "agano.niigata.jp",
-    "gosen.niigata.jp",
-    "itoigawa.niigata.jp",
-    "izumozaki.niigata.jp",
-    "joetsu.niigata.jp",
-    "kamo.niigata.jp",
-    "kariwa.niigata.jp",
-    "kashiwazaki.niigata.jp",
-    "minamiuonuma.niigata.jp",
-    "mitsuke.niigata.jp",
-    "muika.niigata.jp",
-    "murakami.niigata.jp",
-    "myoko.niigata.jp",
-    "nagaoka.niigata.jp",
-    "niigata.niigata.jp",
-    "ojiya.niigata.jp",
-    "omi.niigata.jp",
-    "sado.niigata.jp",
-    "sanjo.niigata.jp",
-    "seiro.niigata.jp",
-    "seirou.niigata.jp",
-    "sekikawa.niigata.jp",
-    "shibata.niigata.jp",
-    "tagami.niigata.jp",
-    "tainai.niigata.jp",
-    "tochio.niigata.jp",
-    "tokamachi.niigata.jp",
-    "tsubame.niigata.jp",
-    "tsunan.niigata.jp",
-    "uonuma.niigata.jp",
-    "yahiko.niigata.jp",
-    "yoita.niigata.jp",
-    "yuzawa.niigata.jp",
-    "beppu.oita.jp",
-    "bungoono.oita.jp",
-    "bungotakada.oita.jp",
-    "hasama.oita.jp",
-    "hiji.oita.jp",
-    "himeshima.oita.jp",
-    "hita.oita.jp",
-    "kamitsue.oita.jp",
-    "kokonoe.oita.jp",
-    "kuju.oita.jp",
-    "kunisaki.oita.jp",
-    "kusu.oita.jp",
-    "oita.oita.jp",
-    "saiki.oita.jp",
-    "taketa.oita.jp",
-    "tsukumi.oita.jp",
-    "usa.oita.jp",
-    "usuki.oita.jp",
-    "yufu.oita.jp",
-    "akaiwa.okayama.jp",
-    "asakuchi.okayama.jp",
-    "bizen.okayama.jp",
-    "hayashima.okayama.jp",
-    "ibara.okayama.jp",
-    "kagamino.okayama.jp",
-    "kasaoka.okayama.jp",
-    "kibichuo.okayama.jp",
-    "kumenan.okayama.jp",
-    "kurashiki.okayama.jp",
-    "maniwa.okayama.jp",
-    "misaki.okayama.jp",
-    "nagi.okayama.jp",
-    "niimi.okayama.jp",
-    "nishiawakura.okayama.jp",
-    "okayama.okayama.jp",
-    "satosho.okayama.jp",
-    "setouchi.okayama.jp",
-    "shinjo.okayama.jp",
-    "shoo.okayama.jp",
-    "soja.okayama.jp",
-    "takahashi.okayama.jp",
-    "tamano.okayama.jp",
-    "tsuyama.okayama.jp",
-    "wake.okayama.jp",
-    "yakage.okayama.jp",
-    "aguni.okinawa.jp",
-    "ginowan.okinawa.jp",
-    "ginoza.okinawa.jp",
-    "gushikami.okinawa.jp",
-    "haebaru.okinawa.jp",
-    "higashi.okinawa.jp",
-    "hirara.okinawa.jp",
-    "iheya.okinawa.jp",
-    "ishigaki.okinawa.jp",
-    "ishikawa.okinawa.jp",
-    "itoman.okinawa.jp",
-    "izena.okinawa.jp",
-    "kadena.okinawa.jp",
-    "kin.okinawa.jp",
-    "kitadaito.okinawa.jp",
-    "kitanakagusuku.okinawa.jp",
-    "kumejima.okinawa.jp",
-    "kunigami.okinawa.jp",
-    "minamidaito.okinawa.jp",
-    "motobu.okinawa.jp",
-    "nago.okinawa.jp",
-    "naha.okinawa.jp",
-    "nakagusuku.okinawa.jp",
-    "nakijin.okinawa.jp",
-    "nanjo.okinawa.jp",
-    "nishihara.okinawa.jp",
-    "ogimi.okinawa.jp",
-    "okinawa.okinawa.jp",
-    "onna.okinawa.jp",
-    "shimoji.okinawa.jp",
-    "taketomi.okinawa.jp",
-    "tarama.okinawa.jp",
-    "tokashiki.okinawa.jp",
-    "tomigusuku.okinawa.jp",
-    "tonaki.okinawa.jp",
-    "urasoe.okinawa.jp",
-    "uruma.okinawa.jp",
-    "yaese.okinawa.jp",
-    "yomitan.okinawa.jp",
-    "yonabaru.okinawa.jp",
-    "yonaguni.okinawa.jp",
-    "zamami.okinawa.jp",
-    "abeno.osaka.jp",
-    "chihayaakasaka.osaka.jp",
-    "chuo.osaka.jp",
-    "daito.osaka.jp",
-    "fujiidera.osaka.jp",
-    "habikino.osaka.jp",
-    "hannan.osaka.jp",
-    "higashiosaka.osaka.jp",
-    "higashisumiyoshi.osaka.jp",
-    "higashiyodogawa.osaka.jp",
-    "hirakata.osaka.jp",
-    "ibaraki.osaka.jp",
-    "ikeda.osaka.jp",
-    "izumi.osaka.jp",
-    "izumiotsu.osaka.jp",
-    "izumisano.osaka.jp",
-    "kadoma.osaka.jp",
-    "kaizuka.osaka.jp",
-    "kanan.osaka.jp",
-    "kashiwara.osaka.jp",
-    "katano.osaka.jp",
-    "kawachinagano.osaka.jp",
-    "kishiwada.osaka.jp",
-    "kita.osaka.jp",
-    "kumatori.osaka.jp",
-    "matsubara.osaka.jp",
-    "minato.osaka.jp",
-    "minoh.osaka.jp",
-    "misaki.osaka.jp",
-    "moriguchi.osaka.jp",
-    "neyagawa.osaka.jp",
-    "nishi.osaka.jp",
-    "nose.osaka.jp",
-    "osakasayama.osaka.jp",
-    "sakai.osaka.jp",
-    "sayama.osaka.jp",
-    "sennan.osaka.jp",
-    "settsu.osaka.jp",
-    "shijonawate.osaka.jp",
-    "shimamoto.osaka.jp",
-    "suita.osaka.jp",
-    "tadaoka.osaka.jp",
-    "taishi.osaka.jp",
-    "tajiri.osaka.jp",
-    "takaishi.osaka.jp",
-    "takatsuki.osaka.jp",
-    "tondabayashi.osaka.jp",
-    "toyonaka.osaka.jp",
-    "toyono.osaka.jp",
-    "yao.osaka.jp",
-    "ariake.saga.jp",
-    "arita.saga.jp",
-    "fukudomi.saga.jp",
-    "genkai.saga.jp",
-    "hamatama.saga.jp",
-    "hizen.saga.jp",
-    "imari.saga.jp",
-    "kamimine.saga.jp",
-    "kanzaki.saga.jp",
-    "karatsu.saga.jp",
-    "kashima.saga.jp",
-    "kitagata.saga.jp",
-    "kitahata.saga.jp",
-    "kiyama.saga.jp",
-    "kouhoku.saga.jp",
-    "kyuragi.saga.jp",
-    "nishiarita.saga.jp",
-    "ogi.saga.jp",
-    "omachi.saga.jp",
-    "ouchi.saga.jp",
-    "saga.saga.jp",
-    "shiroishi.saga.jp",
-    "taku.saga.jp",
-    "tara.saga.jp",
-    "tosu.saga.jp",
-    "yoshinogari.saga.jp",
-    "arakawa.saitama.jp",
-    "asaka.saitama.jp",
-    "chichibu.saitama.jp",
-    "fujimi.saitama.jp",
-    "fujimino.saitama.jp",
-    "fukaya.saitama.jp",
-    "hanno.saitama.jp",
-    "hanyu.saitama.jp",
-    "hasuda.saitama.jp",
-    "hatogaya.saitama.jp",
-    "hatoyama.saitama.jp",
-    "hidaka.saitama.jp",
-    "higashichichibu.saitama.jp",
-    "higashimatsuyama.saitama.jp",
-    "honjo.saitama.jp",
-    "ina.saitama.jp",
-    "iruma.saitama.jp",
-    "iwatsuki.saitama.jp",
-    "kamiizumi.saitama.jp",
-    "kamikawa.saitama.jp",
-    "kamisato.saitama.jp",
-    "kasukabe.saitama.jp",
-    "kawagoe.saitama.jp",
-    "kawaguchi.saitama.jp",
-    "kawajima.saitama.jp",
-    "kazo.saitama.jp",
-    "kitamoto.saitama.jp",
-    "koshigaya.saitama.jp",
-    "kounosu.saitama.jp",
-    "kuki.saitama.jp",
-    "kumagaya.saitama.jp",
-    "matsubushi.saitama.jp",
-    "minano.saitama.jp",
-    "misato.saitama.jp",
-    "miyashiro.saitama.jp",
-    "miyoshi.saitama.jp",
-    "moroyama.saitama.jp",
-    "nagatoro.saitama.jp",
-    "namegawa.saitama.jp",
-    "niiza.saitama.jp",
-    "ogano.saitama.jp",
-    "ogawa.saitama.jp",
-    "ogose.saitama.jp",
-    "okegawa.saitama.jp",
-    "omiya.saitama.jp",
-    "otaki.saitama.jp",
-    "ranzan.saitama.jp",
-    "ryokami.saitama.jp",
-    "saitama.saitama.jp",
-    "sakado.saitama.jp",
-    "satte.saitama.jp",
-    "sayama.saitama.jp",
-    "shiki.saitama.jp",
-    "shiraoka.saitama.jp",
-    "soka.saitama.jp",
-    "sugito.saitama.jp",
-    "toda.saitama.jp",
-    "tokigawa.saitama.jp",
-    "tokorozawa.saitama.jp",
-    "tsurugashima.saitama.jp",
-    "urawa.saitama.jp",
-    "warabi.saitama.jp",
-    "yashio.saitama.jp",
-    "yokoze.saitama.jp",
-    "yono.saitama.jp",
-    "yorii.saitama.jp",
-    "yoshida.saitama.jp",
-    "yoshikawa.saitama.jp",
-    "yoshimi.saitama.jp",
-    "aisho.shiga.jp",
-    "gamo.shiga.jp",
-    "higashiomi.shiga.jp",
-    "hikone.shiga.jp",
-    "koka.shiga.jp",
-    "konan.shiga.jp",
-    "kosei.shiga.jp",
-    "koto.shiga.jp",
-    "kusatsu.shiga.jp",
-    "maibara.shiga.jp",
-    "moriyama.shiga.jp",
-    "nagahama.shiga.jp",
-    "nishiazai.shiga.jp",
-    "notogawa.shiga.jp",
-    "omihachiman.shiga.jp",
-    "otsu.shiga.jp",
-    "ritto.shiga.jp",
-    "ryuoh.shiga.jp",
-    "takashima.shiga.jp",
-    "takatsuki.shiga.jp",
-    "torahime.shiga.jp",
-    "toyosato.shiga.jp",
-    "yasu.shiga.jp",
-    "akagi.shimane.jp",
-    "ama.shimane.jp",
-    "gotsu.shimane.jp",
-    "hamada.shimane.jp",
-    "higashiizumo.shimane.jp",
-    "hikawa.shimane.jp",
-    "hikimi.shimane.jp",
-    "izumo.shimane.jp",
-    "kakinoki.shimane.jp",
-    "masuda.shimane.jp",
-    "matsue.shimane.jp",
-    "misato.shimane.jp",
-    "nishinoshima.shimane.jp",
-    "ohda.shimane.jp",
-    "okinoshima.shimane.jp",
-    "okuizumo.shimane.jp",
-    "shimane.shimane.jp",
-    "tamayu.shimane.jp",
-    "tsuwano.shimane.jp",
-    "unnan.shimane.jp",
-    "yakumo.shimane.jp",
-    "yasugi.shimane.jp",
-    "yatsuka.shimane.jp",
-    "arai.shizuoka.jp",
-    "atami.shizuoka.jp",
-    "fuji.shizuoka.jp",
-    "fujieda.shizuoka.jp",
-    "fujikawa.shizuoka.jp",
-    "fujinomiya.shizuoka.jp",
-    "fukuroi.shizuoka.jp",
-    "gotemba.shizuoka.jp",
-    "haibara.shizuoka.jp",
-    "hamamatsu.shizuoka.jp",
-    "higashiizu.shizuoka.jp",
-    "ito.shizuoka.jp",
-    "iwata.shizuoka.jp",
-    "izu.shizuoka.jp",
-    "izunokuni.shizuoka.jp",
-    "kakegawa.shizuoka.jp",
-    "kannami.shizuoka.jp",
-    "kawanehon.shizuoka.jp",
-    "kawazu.shizuoka.jp",
-    "kikugawa.shizuoka.jp",
-    "kosai.shizuoka.jp",
-    "makinohara.shizuoka.jp",
-    "matsuzaki.shizuoka.jp",
-    "minamiizu.shizuoka.jp",
-    "mishima.shizuoka.jp",
-    "morimachi.shizuoka.jp",
-    "nishiizu.shizuoka.jp",
-    "numazu.shizuoka.jp",
-    "omaezaki.shizuoka.jp",
-    "shimada.shizuoka.jp",
-    "shimizu.shizuoka.jp",
-    "shimoda.shizuoka.jp",
-    "shizuoka.shizuoka.jp",
-    "susono.shizuoka.jp",
-    "yaizu.shizuoka.jp",
-    "yoshida.shizuoka.jp",
-    "ashikaga.tochigi.jp",
-    "bato.tochigi.jp",
-    "haga.tochigi.jp",
-    "ichikai.tochigi.jp",
-    "iwafune.tochigi.jp",
-    "kaminokawa.tochigi.jp",
-    "kanuma.tochigi.jp",
-    "karasuyama.tochigi.jp",
-    "kuroiso.tochigi.jp",
-    "mashiko.tochigi.jp",
-    "mibu.tochigi.jp",
-    "moka.tochigi.jp",
-    "motegi.tochigi.jp",
-    "nasu.tochigi.jp",
-    "nasushiobara.tochigi.jp",
-    "nikko.tochigi.jp",
-    "nishikata.tochigi.jp",
-    "nogi.tochigi.jp",
-    "ohira.tochigi.jp",
-    "ohtawara.tochigi.jp",
-    "oyama.tochigi.jp",
-    "sakura.tochigi.jp",
-    "sano.tochigi.jp",
-    "shimotsuke.tochigi.jp",
-    "shioya.tochigi.jp",
-    "takanezawa.tochigi.jp",
-    "tochigi.tochigi.jp",
-    "tsuga.tochigi.jp",
-    "ujiie.tochigi.jp",
-    "utsunomiya.tochigi.jp",
-    "yaita.tochigi.jp",
-    "aizumi.tokushima.jp",
-    "anan.tokushima.jp",
-    "ichiba.tokushima.jp",
-    "itano.tokushima.jp",
-    "kainan.tokushima.jp",
-    "komatsushima.tokushima.jp",
-    "matsushige.tokushima.jp",
-    "mima.tokushima.jp",
-    "minami.tokushima.jp",
-    "miyoshi.tokushima.jp",
-    "mugi.tokushima.jp",
-    "nakagawa.tokushima.jp",
-    "naruto.tokushima.jp",
-    "sanagochi.tokushima.jp",
-    "shishikui.tokushima.jp",
-    "tokushima.tokushima.jp",
-    "wajiki.tokushima.jp",
-    "adachi.tokyo.jp",
-    "akiruno.tokyo.jp",
-    "akishima.tokyo.jp",
-    "aogashima.tokyo.jp",
-    "arakawa.tokyo.jp",
-    "bunkyo.tokyo.jp",
-    "chiyoda.tokyo.jp",
-    "chofu.tokyo.jp",
-    "chuo.tokyo.jp",
-    "edogawa.tokyo.jp",
-    "fuchu.tokyo.jp",
-    "fussa.tokyo.jp",
-    "hachijo.tokyo.jp",
-    "hachioji.tokyo.jp",
-    "hamura.tokyo.jp",
-    "higashikurume.tokyo.jp",
-    "higashimurayama.tokyo.jp",
-    "higashiyamato.tokyo.jp",
-    "hino.tokyo.jp",
-    "hinode.tokyo.jp",
-    "hinohara.tokyo.jp",
-    "inagi.tokyo.jp",
-    "itabashi.tokyo.jp",
-    "katsushika.tokyo.jp",
-    "kita.tokyo.jp",
-    "kiyose.tokyo.jp",
-    "kodaira.tokyo.jp",
-    "koganei.tokyo.jp",
-    "kokubunji.tokyo.jp",
-    "komae.tokyo.jp",
-    "koto.tokyo.jp",
-    "kouzushima.tokyo.jp",
-    "kunitachi.tokyo.jp",
-    "machida.tokyo.jp",
-    "meguro.tokyo.jp",
-    "minato.tokyo.jp",
-    "mitaka.tokyo.jp",
-    "mizuho.tokyo.jp",
-    "musashimurayama.tokyo.jp",
-    "musashino.tokyo.jp",
-    "nakano.tokyo.jp",
-    "nerima.tokyo.jp",
-    "ogasawara.tokyo.jp",
-    "okutama.tokyo.jp",
-    "ome.tokyo.jp",
-    "oshima.tokyo.jp",
-    "ota.tokyo.jp",
-    "setagaya.tokyo.jp",
-    "shibuya.tokyo.jp",
-    "shinagawa.tokyo.jp",
-    "shinjuku.tokyo.jp",
-    "suginami.tokyo.jp",
-    "sumida.tokyo.jp",
-    "tachikawa.tokyo.jp",
-    "taito.tokyo.jp",
-    "tama.tokyo.jp",
-    "toshima.tokyo.jp",
-    "chizu.tottori.jp",
-    "hino.tottori.jp",
-    "kawahara.tottori.jp",
-    "koge.tottori.jp",
-    "kotoura.tottori.jp",
-    "misasa.tottori.jp",
-    "nanbu.tottori.jp",
-    "nichinan.tottori.jp",
-    "sakaiminato.tottori.jp",
-    "tottori.tottori.jp",
-    "wakasa.tottori.jp",
-    "yazu.tottori.jp",
-    "yonago.tottori.jp",
-    "asahi.toyama.jp",
-    "fuchu.toyama.jp",
-    "fukumitsu.toyama.jp",
-    "funahashi.toyama.jp",
-    "himi.toyama.jp",
-    "imizu.toyama.jp",
-    "inami.toyama.jp",
-    "johana.toyama.jp",
-    "kamiichi.toyama.jp",
-    "kurobe.toyama.jp",
-    "nakaniikawa.toyama.jp",
-    "namerikawa.toyama.jp",
-    "nanto.toyama.jp",
-    "nyuzen.toyama.jp",
-    "oyabe.toyama.jp",
-    "taira.toyama.jp",
-    "takaoka.toyama.jp",
-    "tateyama.toyama.jp",
-    "toga.toyama.jp",
-    "tonami.toyama.jp",
-    "toyama.toyama.jp",
-    "unazuki.toyama.jp",
-    "uozu.toyama.jp",
-    "yamada.toyama.jp",
-    "arida.wakayama.jp",
-    "aridagawa.wakayama.jp",
-    "gobo.wakayama.jp",
-    "hashimoto.wakayama.jp",
-    "hidaka.wakayama.jp",
-    "hirogawa.wakayama.jp",
-    "inami.wakayama.jp",
-    "iwade.wakayama.jp",
-    "kainan.wakayama.jp",
-    "kamitonda.wakayama.jp",
-    "katsuragi.wakayama.jp",
-    "kimino.wakayama.jp",
-    "kinokawa.wakayama.jp",
-    "kitayama.wakayama.jp",
-    "koya.wakayama.jp",
-    "koza.wakayama.jp",
-    "kozagawa.wakayama.jp",
-    "kudoyama.wakayama.jp",
-    "kushimoto.wakayama.jp",
-    "mihama.wakayama.jp",
-    "misato.wakayama.jp",
-    "nachikatsuura.wakayama.jp",
-    "shingu.wakayama.jp",
-    "shirahama.wakayama.jp",
-    "taiji.wakayama.jp",
-    "tanabe.wakayama.jp",
-    "wakayama.wakayama.jp",
-    "yuasa.wakayama.jp",
-    "yura.wakayama.jp",
-    "asahi.yamagata.jp",
-    "funagata.yamagata.jp",
-    "higashine.yamagata.jp",
-    "iide.yamagata.jp",
-    "kahoku.yamagata.jp",
-    "kaminoyama.yamagata.jp",
-    "kaneyama.yamagata.jp",
-    "kawanishi.yamagata.jp",
-    "mamurogawa.yamagata.jp",
-    "mikawa.yamagata.jp",
-    "murayama.yamagata.jp",
-    "nagai.yamagata.jp",
-    "nakayama.yamagata.jp",
-    "nanyo.yamagata.jp",
-    "nishikawa.yamagata.jp",
-    "obanazawa.yamagata.jp",
-    "oe.yamagata.jp",
-    "oguni.yamagata.jp",
-    "ohkura.yamagata.jp",
-    "oishida.yamagata.jp",
-    "sagae.yamagata.jp",
-    "sakata.yamagata.jp",
-    "sakegawa.yamagata.jp",
-    "shinjo.yamagata.jp",
-    "shirataka.yamagata.jp",
-    "shonai.yamagata.jp",
-    "takahata.yamagata.jp",
-    "tendo.yamagata.jp",
-    "tozawa.yamagata.jp",
-    "tsuruoka.yamagata.jp",
-    "yamagata.yamagata.jp",
-    "yamanobe.yamagata.jp",
-    "yonezawa.yamagata.jp",
-    "yuza.yamagata.jp",
-    "abu.yamaguchi.jp",
-    "hagi.yamaguchi.jp",
-    "hikari.yamaguchi.jp",
-    "hofu.yamaguchi.jp",
-    "iwakuni.yamaguchi.jp",
-    "kudamatsu.yamaguchi.jp",
-    "mitou.yamaguchi.jp",
-    "nagato.yamaguchi.jp",
-    "oshima.yamaguchi.jp",
-    "shimonoseki.yamaguchi.jp",
-    "shunan.yamaguchi.jp",
-    "tabuse.yamaguchi.jp",
-    "tokuyama.yamaguchi.jp",
-    "toyota.yamaguchi.jp",
-    "ube.yamaguchi.jp",
-    "yuu.yamaguchi.jp",
-    "chuo.yamanashi.jp",
-    "doshi.yamanashi.jp",
-    "fuefuki.yamanashi.jp",
-    "fujikawa.yamanashi.jp",
-    "fujikawaguchiko.yamanashi.jp",
-    "fujiyoshida.yamanashi.jp",
-    "hayakawa.yamanashi.jp",
-    "hokuto.yamanashi.jp",
-    "ichikawamisato.yamanashi.jp",
-    "kai.yamanashi.jp",
-    "kofu.yamanashi.jp",
-    "koshu.yamanashi.jp",
-    "kosuge.yamanashi.jp",
-    "minami-alps.yamanashi.jp",
-    "minobu.yamanashi.jp",
-    "nakamichi.yamanashi.jp",
-    "nanbu.yamanashi.jp",
-    "narusawa.yamanashi.jp",
-    "nirasaki.yamanashi.jp",
-    "nishikatsura.yamanashi.jp",
-    "oshino.yamanashi.jp",
-    "otsuki.yamanashi.jp",
-    "showa.yamanashi.jp",
-    "tabayama.yamanashi.jp",
-    "tsuru.yamanashi.jp",
-    "uenohara.yamanashi.jp",
-    "yamanakako.yamanashi.jp",
-    "yamanashi.yamanashi.jp",
-    "ke",
-    "ac.ke",
-    "co.ke",
-    "go.ke",
-    "info.ke",
-    "me.ke",
-    "mobi.ke",
-    "ne.ke",
-    "or.ke",
-    "sc.ke",
-    "kg",
-    "org.kg",
-    "net.kg",
-    "com.kg",
-    "edu.kg",
-    "gov.kg",
-    "mil.kg",
-    "*.kh",
-    "ki",
-    "edu.ki",
-    "biz.ki",
-    "net.ki",
-    "org.ki",
-    "gov.ki",
-    "info.ki",
-    "com.ki",
-    "km",
-    "org.km",
-    "nom.km",
-    "gov.km",
-    "prd.km",
-    "tm.km",
-    "edu.km",
-    "mil.km",
-    "ass.km",
-    "com.km",
-    "coop.km",
-    "asso.km",
-    "presse.km",
-    "medecin.km",
-    "notaires.km",
-    "pharmaciens.km",
-    "veterinaire.km",
-    "gouv.km",
-    "kn",
-    "net.kn",
-    "org.kn",
-    "edu.kn",
-    "gov.kn",
-    "kp",
-    "com.kp",
-    "edu.kp",
-    "gov.kp",
-    "org.kp",
-    "rep.kp",
-    "tra.kp",
-    "kr",
-    "ac.kr",
-    "co.kr",
-    "es.kr",
-    "go.kr",
-    "hs.kr",
-    "kg.kr",
-    "mil.kr",
-    "ms.kr",
-    "ne.kr",
-    "or.kr",
-    "pe.kr",
-    "re.kr",
-    "sc.kr",
-    "busan.kr",
-    "chungbuk.kr",
-    "chungnam.kr",
-    "daegu.kr",
-    "daejeon.kr",
-    "gangwon.kr",
-    "gwangju.kr",
-    "gyeongbuk.kr",
-    "gyeonggi.kr",
-    "gyeongnam.kr",
-    "incheon.kr",
-    "jeju.kr",
-    "jeonbuk.kr",
-    "jeonnam.kr",
-    "seoul.kr",
-    "ulsan.kr",
-    "kw",
-    "com.kw",
-    "edu.kw",
-    "emb.kw",
-    "gov.kw",
-    "ind.kw",
-    "net.kw",
-    "org.kw",
-    "ky",
-    "com.ky",
-    "edu.ky",
-    "net.ky",
-    "org.ky",
-    "kz",
-    "org.kz",
-    "edu.kz",
-    "net.kz",
-    "gov.kz",
-    "mil.kz",
-    "com.kz",
-    "la",
-    "int.la",
-    "net.la",
-    "info.la",
-    "edu.la",
-    "gov.la",
-    "per.la",
-    "com.la",
-    "org.la",
-    "lb",
-    "com.lb",
-    "edu.lb",
-    "gov.lb",
-    "net.lb",
-    "org.lb",
-    "lc",
-    "com.lc",
-    "net.lc",
-    "co.lc",
-    "org.lc",
-    "edu.lc",
-    "gov.lc",
-    "li",
-    "lk",
-    "gov.lk",
-    "sch.lk",
-    "net.lk",
-    "int.lk",
-    "com.lk",
-    "org.lk",
-    "edu.lk",
-    "ngo.lk",
-    "soc.lk",
-    "web.lk",
-    "ltd.lk",
-    "assn.lk",
-    "grp.lk",
-    "hotel.lk",
-    "ac.lk",
-    "lr",
-    "com.lr",
-    "edu.lr",
-    "gov.lr",
-    "org.lr",
-    "net.lr",
-    "ls",
-    "ac.ls",
-    "biz.ls",
-    "co.ls",
-    "edu.ls",
-    "gov.ls",
-    "info.ls",
-    "net.ls",
-    "org.ls",
-    "sc.ls",
-    "lt",
-    "gov.lt",
-    "lu",
-    "lv",
-    "com.lv",
-    "edu.lv",
-    "gov.lv",
-    "org.lv",
-    "mil.lv",
-    "id.lv",
-    "net.lv",
-    "asn.lv",
-    "conf.lv",
-    "ly",
-    "com.ly",
-    "net.ly",
-    "gov.ly",
-    "plc.ly",
-    "edu.ly",
-    "sch.ly",
-    "med.ly",
-    "org.ly",
-    "id.ly",
-    "ma",
-    "co.ma",
-    "net.ma",
-    "gov.ma",
-    "org.ma",
-    "ac.ma",
-    "press.ma",
-    "mc",
-    "tm.mc",
-    "asso.mc",
-    "md",
-    "me",
-    "co.me",
-    "net.me",
-    "org.me",
-    "edu.me",
-    "ac.me",
-    "gov.me",
-    "its.me",
-    "priv.me",
-    "mg",
-    "org.mg",
-    "nom.mg",
-    "gov.mg",
-    "prd.mg",
-    "tm.mg",
-    "edu.mg",
-    "mil.mg",
-    "com.mg",
-    "co.mg",
-    "mh",
-    "mil",
-    "mk",
-    "com.mk",
-    "org.mk",
-    "net.mk",
-    "edu.mk",
-    "gov.mk",
-    "inf.mk",
-    "name.mk",
-    "ml",
-    "com.ml",
-    "edu.ml",
-    "gouv.ml",
-    "gov.ml",
-    "net.ml",
-    "org.ml",
-    "presse.ml",
-    "*.mm",
-    "mn",
-    "gov.mn",
-    "edu.mn",
-    "org.mn",
-    "mo",
-    "com.mo",
-    "net.mo",
-    "org.mo",
-    "edu.mo",
-    "gov.mo",
-    "mobi",
-    "mp",
-    "mq",
-    "mr",
-    "gov.mr",
-    "ms",
-    "com.ms",
-    "edu.ms",
-    "gov.ms",
-    "net.ms",
-    "org.ms",
-    "mt",
-    "com.mt",
-    "edu.mt",
-    "net.mt",
-    "org.mt",
-    "mu",
-    "com.mu",
-    "net.mu",
-    "org.mu",
-    "gov.mu",
-    "ac.mu",
-    "co.mu",
-    "or.mu",
-    "museum",
-    "mv",
-    "aero.mv",
-    "biz.mv",
-    "com.mv",
-    "coop.mv",
-    "edu.mv",
-    "gov.mv",
-    "info.mv",
-    "int.mv",
-    "mil.mv",
-    "museum.mv",
-    "name.mv",
-    "net.mv",
-    "org.mv",
-    "pro.mv",
-    "mw",
-    "ac.mw",
-    "biz.mw",
-    "co.mw",
-    "com.mw",
-    "coop.mw",
-    "edu.mw",
-    "gov.mw",
-    "int.mw",
-    "museum.mw",
-    "net.mw",
-    "org.mw",
-    "mx",
-    "com.mx",
-    "org.mx",
-    "gob.mx",
-    "edu.mx",
-    "net.mx",
-    "my",
-    "biz.my",
-    "com.my",
-    "edu.my",
-    "gov.my",
-    "mil.my",
-    "name.my",
-    "net.my",
-    "org.my",
-    "mz",
-    "ac.mz",
-    "adv.mz",
-    "co.mz",
-    "edu.mz",
-    "gov.mz",
-    "mil.mz",
-    "net.mz",
-    "org.mz",
-    "na",
-    "info.na",
-    "pro.na",
-    "name.na",
-    "school.na",
-    "or.na",
-    "dr.na",
-    "us.na",
-    "mx.na",
-    "ca.na",
-    "in.na",
-    "cc.na",
-    "tv.na",
-    "ws.na",
-    "mobi.na",
-    "co.na",
-    "com.na",
-    "org.na",
-    "name",
-    "nc",
-    "asso.nc",
-    "nom.nc",
-    "ne",
-    "net",
-    "nf",
-    "com.nf",
-    "net.nf",
-    "per.nf",
-    "rec.nf",
-    "web.nf",
-    "arts.nf",
-    "firm.nf",
-    "info.nf",
-    "other.nf",
-    "store.nf",
-    "ng",
-    "com.ng",
-    "edu.ng",
-    "gov.ng",
-    "i.ng",
-    "mil.ng",
-    "mobi.ng",
-    "name.ng",
-    "net.ng",
-    "org.ng",
-    "sch.ng",
-    "ni",
-    "ac.ni",
-    "biz.ni",
-    "co.ni",
-    "com.ni",
-    "edu.ni",
-    "gob.ni",
-    "in.ni",
-    "info.ni",
-    "int.ni",
-    "mil.ni",
-    "net.ni",
-    "nom.ni",
-    "org.ni",
-    "web.ni",
-    "nl",
-    "no",
-    "fhs.no",
-    "vgs.no",
-    "fylkesbibl.no",
-    "folkebibl.no",
-    "museum.no",
-    "idrett.no",
-    "priv.no",
-    "mil.no",
-    "stat.no",
-    "dep.no",
-    "kommune.no",
-    "herad.no",
-    "aa.no",
-    "ah.no",
-    "bu.no",
-    "fm.no",
-    "hl.no",
-    "hm.no",
-    "jan-mayen.no",
-    "mr.no",
-    "nl.no",
-    "nt.no",
-    "of.no",
-    "ol.no",
-    "oslo.no",
-    "rl.no",
-    "sf.no",
-    "st.no",
-    "svalbard.no",
-    "tm.no",
-    "tr.no",
-    "va.no",
-    "vf.no",
-    "gs.aa.no",
-    "gs.ah.no",
-    "gs.bu.no",
-    "gs.fm.no",
-    "gs.hl.no",
-    "gs.hm.no",
-    "gs.jan-mayen.no",
-    "gs.mr.no",
-    "gs.nl.no",
-    "gs.nt.no",
-    "gs.of.no",
-    "gs.ol.no",
-    "gs.oslo.no",
-    "gs.rl.no",
-    "gs.sf.no",
-    "gs.st.no",
-    "gs.svalbard.no",
-    "gs.tm.no",
-    "gs.tr.no",
-    "gs.va.no",
-    "gs.vf.no",
-    "akrehamn.no",
-    "åkrehamn.no",
-    "algard.no",
-    "ålgård.no",
-    "arna.no",
-    "brumunddal.no",
-    "bryne.no",
-    "bronnoysund.no",
-    "brønnøysund.no",
-    "drobak.no",
-    "drøbak.no",
-    "egersund.no",
-    "fetsund.no",
-    "floro.no",
-    "florø.no",
-    "fredrikstad.no",
-    "hokksund.no",
-    "honefoss.no",
-    "hønefoss.no",
-    "jessheim.no",
-    "jorpeland.no",
-    "jørpeland.no",
-    "kirkenes.no",
-    "kopervik.no",
-    "krokstadelva.no",
-    "langevag.no",
-    "langevåg.no",
-    "leirvik.no",
-    "mjondalen.no",
-    "mjøndalen.no",
-    "mo-i-rana.no",
-    "mosjoen.no",
-    "mosjøen.no",
-    "nesoddtangen.no",
-    "orkanger.no",
-    "osoyro.no",
-    "osøyro.no",
-    "raholt.no",
-    "råholt.no",
-    "sandnessjoen.no",
-    "sandnessjøen.no",
-    "skedsmokorset.no",
-    "slattum.no",
-    "spjelkavik.no",
-    "stathelle.no",
-    "stavern.no",
-    "stjordalshalsen.no",
-    "stjørdalshalsen.no",
-    "tananger.no",
-    "tranby.no",
-    "vossevangen.no",
-    "afjord.no",
-    "åfjord.no",
-    "agdenes.no",
-    "al.no",
-    "ål.no",
-    "alesund.no",
-    "ålesund.no",
-    "alstahaug.no",
-    "alta.no",
-    "áltá.no",
-    "alaheadju.no",
-    "álaheadju.no",
-    "alvdal.no",
-    "amli.no",
-    "åmli.no",
-    "amot.no",
-    "åmot.no",
-    "andebu.no",
-    "andoy.no",
-    "andøy.no",
-    "andasuolo.no",
-    "ardal.no",
-    "årdal.no",
-    "aremark.no",
-    "arendal.no",
-    "ås.no",
-    "aseral.no",
-    "åseral.no",
-    "asker.no",
-    "askim.no",
-    "askvoll.no",
-    "askoy.no",
-    "askøy.no",
-    "asnes.no",
-    "åsnes.no",
-    "audnedaln.no",
-    "aukra.no",
-    "aure.no",
-    "aurland.no",
-    "aurskog-holand.no",
-    "aurskog-høland.no",
-    "austevoll.no",
-    "austrheim.no",
-    "averoy.no",
-    "averøy.no",
-    "balestrand.no",
-    "ballangen.no",
-    "balat.no",
-    "bálát.no",
-    "balsfjord.no",
-    "bahccavuotna.no",
-    "báhccavuotna.no",
-    "bamble.no",
-    "bardu.no",
-    "beardu.no",
-    "beiarn.no",
-    "bajddar.no",
-    "bájddar.no",
-    "baidar.no",
-    "báidár.no",
-    "berg.no",
-    "bergen.no",
-    "berlevag.no",
-    "berlevåg.no",
-    "bearalvahki.no",
-    "bearalváhki.no",
-    "bindal.no",
-    "birkenes.no",
-    "bjarkoy.no",
-    "bjarkøy.no",
-    "bjerkreim.no",
-    "bjugn.no",
-    "bodo.no",
-    "bodø.no",
-    "badaddja.no",
-    "bådåddjå.no",
-    "budejju.no",
-    "bokn.no",
-    "bremanger.no",
-    "bronnoy.no",
-    "brønnøy.no",
-    "bygland.no",
-    "bykle.no",
-    "barum.no",
-    "bærum.no",
-    "bo.telemark.no",
-    "bø.telemark.no",
-    "bo.nordland.no",
-    "bø.nordland.no",
-    "bievat.no",
-    "bievát.no",
-    "bomlo.no",
-    "bømlo.no",
-    "batsfjord.no",
-    "båtsfjord.no",
-    "bahcavuotna.no",
-    "báhcavuotna.no",
-    "dovre.no",
-    "drammen.no",
-    "drangedal.no",
-    "dyroy.no",
-    "dyrøy.no",
-    "donna.no",
-    "dønna.no",
-    "eid.no",
-    "eidfjord.no",
-    "eidsberg.no",
-    "eidskog.no",
-    "eidsvoll.no",
-    "eigersund.no",
-    "elverum.no",
-    "enebakk.no",
-    "engerdal.no",
-    "etne.no",
-    "etnedal.no",
-    "evenes.no",
-    "evenassi.no",
-    "evenášši.no",
-    "evje-og-hornnes.no",
-    "farsund.no",
-    "fauske.no",
-    "fuossko.no",
-    "fuoisku.no",
-    "fedje.no",
-    "fet.no",
-    "finnoy.no",
-    "finnøy.no",
-    "fitjar.no",
-    "fjaler.no",
-    "fjell.no",
-    "flakstad.no",
-    "flatanger.no",
-    "flekkefjord.no",
-    "flesberg.no",
-    "flora.no",
-    "fla.no",
-    "flå.no",
-    "folldal.no",
-    "forsand.no",
-    "fosnes.no",
-    "frei.no",
-    "frogn.no",
-    "froland.no",
-    "frosta.no",
-    "frana.no",
-    "fræna.no",
-    "froya.no",
-    "frøya.no",
-    "fusa.no",
-    "fyresdal.no",
-    "forde.no",
-    "førde.no",
-    "gamvik.no",
-    "gangaviika.no",
-    "gáŋgaviika.no",
-    "gaular.no",
-    "gausdal.no",
-    "gildeskal.no",
-    "gildeskål.no",
-    "giske.no",
-    "gjemnes.no",
-    "gjerdrum.no",
-    "gjerstad.no",
-    "gjesdal.no",
-    "gjovik.no",
-    "gjøvik.no",
-    "gloppen.no",
-    "gol.no",
-    "gran.no",
-    "grane.no",
-    "granvin.no",
-    "gratangen.no",
-    "grimstad.no",
-    "grong.no",
-    "kraanghke.no",
-    "kråanghke.no",
-    "grue.no",
-    "gulen.no",
-    "hadsel.no",
-    "halden.no",
-    "halsa.no",
-    "hamar.no",
-    "hamaroy.no",
-    "habmer.no",
-    "hábmer.no",
-    "hapmir.no",
-    "hápmir.no",
-    "hammerfest.no",
-    "hammarfeasta.no",
-    "hámmárfeasta.no",
-    "haram.no",
-    "hareid.no",
-    "harstad.no",
-    "hasvik.no",
-    "aknoluokta.no",
-    "ákŋoluokta.no",
-    "hattfjelldal.no",
-    "aarborte.no",
-    "haugesund.no",
-    "hemne.no",
-    "hemnes.no",
-    "hemsedal.no",
-    "heroy.more-og-romsdal.no",
-    "herøy.møre-og-romsdal.no",
-    "heroy.nordland.no",
-    "herøy.nordland.no",
-    "hitra.no",
-    "hjartdal.no",
-    "hjelmeland.no",
-    "hobol.no",
-    "hobøl.no",
-    "hof.no",
-    "hol.no",
-    "hole.no",
-    "holmestrand.no",
-    "holtalen.no",
-    "holtålen.no",
-    "hornindal.no",
-    "horten.no",
-    "hurdal.no",
-    "hurum.no",
-    "hvaler.no",
-    "hyllestad.no",
-    "hagebostad.no",
-    "hægebostad.no",
-    "hoyanger.no",
-    "høyanger.no",
-    "hoylandet.no",
-    "høylandet.no",
-    "ha.no",
-    "hå.no",
-    "ibestad.no",
-    "inderoy.no",
-    "inderøy.no",
-    "iveland.no",
-    "jevnaker.no",
-    "jondal.no",
-    "jolster.no",
-    "jølster.no",
-    "karasjok.no",
-    "karasjohka.no",
-    "kárášjohka.no",
-    "karlsoy.no",
-    "galsa.no",
-    "gálsá.no",
-    "karmoy.no",
-    "karmøy.no",
-    "kautokeino.no",
-    "guovdageaidnu.no",
-    "klepp.no",
-    "klabu.no",
-    "klæbu.no",
-    "kongsberg.no",
-    "kongsvinger.no",
-    "kragero.no",
-    "kragerø.no",
-    "kristiansand.no",
-    "kristiansund.no",
-    "krodsherad.no",
-    "krødsherad.no",
-    "kvalsund.no",
-    "rahkkeravju.no",
-    "ráhkkerávju.no",
-    "kvam.no",
-    "kvinesdal.no",
-    "kvinnherad.no",
-    "kviteseid.no",
-    "kvitsoy.no",
-    "kvitsøy.no",
-    "kvafjord.no",
-    "kvæfjord.no",
-    "giehtavuoatna.no",
-    "kvanangen.no",
-    "kvænangen.no",
-    "navuotna.no",
-    "návuotna.no",
-    "kafjord.no",
-    "kåfjord.no",
-    "gaivuotna.no",
-    "gáivuotna.no",
-    "larvik.no",
-    "lavangen.no",
-    "lavagis.no",
-    "loabat.no",
-    "loabát.no",
-    "lebesby.no",
-    "davvesiida.no",
-    "leikanger.no",
-    "leirfjord.no",
-    "leka.no",
-    "leksvik.no",
-    "lenvik.no",
-    "leangaviika.no",
-    "leaŋgaviika.no",
-    "lesja.no",
-    "levanger.no",
-    "lier.no",
-    "lierne.no",
-    "lillehammer.no",
-    "lillesand.no",
-    "lindesnes.no",
-    "lindas.no",
-    "lindås.no",
-    "lom.no",
-    "loppa.no",
-    "lahppi.no",
-    "láhppi.no",
-    "lund.no",
-    "lunner.no",
-    "luroy.no",
-    "lurøy.no",
-    "luster.no",
-    "lyngdal.no",
-    "lyngen.no",
-    "ivgu.no",
-    "lardal.no",
-    "lerdal.no",
-    "lærdal.no",
-    "lodingen.no",
-    "lødingen.no",
-    "lorenskog.no",
-    "lørenskog.no",
-    "loten.no",
-    "løten.no",
-    "malvik.no",
-    "masoy.no",
-    "måsøy.no",
-    "muosat.no",
-    "muosát.no",
-    "mandal.no",
-    "marker.no",
-    "marnardal.no",
-    "masfjorden.no",
-    "meland.no",
-    "meldal.no",
-    "melhus.no",
-    "meloy.no",
-    "meløy.no",
-    "meraker.no",
-    "meråker.no",
-    "moareke.no",
-    "moåreke.no",
-    "midsund.no",
-    "midtre-gauldal.no",
-    "modalen.no",
-    "modum.no",
-    "molde.no",
-    "moskenes.no",
-    "moss.no",
-    "mosvik.no",
-    "malselv.no",
-    "målselv.no",
-    "malatvuopmi.no",
-    "málatvuopmi.no",
-    "namdalseid.no",
-    "aejrie.no",
-    "namsos.no",
-    "namsskogan.no",
-    "naamesjevuemie.no",
-    "nååmesjevuemie.no",
-    "laakesvuemie.no",
-    "nannestad.no",
-    "narvik.no",
-    "narviika.no",
-    "naustdal.no",
-    "nedre-eiker.no",
-    "nes.akershus.no",
-    "nes.buskerud.no",
-    "nesna.no",
-    "nesodden.no",
-    "nesseby.no",
-    "unjarga.no",
-    "unjárga.no",
-    "nesset.no",
-    "nissedal.no",
-    "nittedal.no",
-    "nord-aurdal.no",
-    "nord-fron.no",
-    "nord-odal.no",
-    "norddal.no",
-    "nordkapp.no",
-    "davvenjarga.no",
-    "davvenjárga.no",
-    "nordre-land.no",
-    "nordreisa.no",
-    "raisa.no",
-    "ráisa.no",
-    "nore-og-uvdal.no",
-    "notodden.no",
-    "naroy.no",
-    "nærøy.no",
-    "notteroy.no",
-    "nøtterøy.no",
-    "odda.no",
-    "oksnes.no",
-    "øksnes.no",
-    "oppdal.no",
-    "oppegard.no",
-    "oppegård.no",
-    "orkdal.no",
-    "orland.no",
-    "ørland.no",
-    "orskog.no",
-    "ørskog.no",
-    "orsta.no",
-    "ørsta.no",
-    "os.hedmark.no",
-    "os.hordaland.no",
-    "osen.no",
-    "osteroy.no",
-    "osterøy.no",
-    "ostre-toten.no",
-    "østre-toten.no",
-    "overhalla.no",
-    "ovre-eiker.no",
-    "øvre-eiker.no",
-    "oyer.no",
-    "øyer.no",
-    "oygarden.no",
-    "øygarden.no",
-    "oystre-slidre.no",
-    "øystre-slidre.no",
-    "porsanger.no",
-    "porsangu.no",
-    "porsáŋgu.no",
-    "porsgrunn.no",
-    "radoy.no",
-    "radøy.no",
-    "rakkestad.no",
-    "rana.no",
-    "ruovat.no",
-    "randaberg.no",
-    "rauma.no",
-    "rendalen.no",
-    "rennebu.no",
-    "rennesoy.no",
-    "rennesøy.no",
-    "rindal.no",
-    "ringebu.no",
-    "ringerike.no",
-    "ringsaker.no",
-    "rissa.no",
-    "risor.no",
-    "risør.no",
-    "roan.no",
-    "rollag.no",
-    "rygge.no",
-    "ralingen.no",
-    "rælingen.no",
-    "rodoy.no",
-    "rødøy.no",
-    "romskog.no",
-    "rømskog.no",
-    "roros.no",
-    "røros.no",
-    "rost.no",
-    "røst.no",
-    "royken.no",
-    "røyken.no",
-    "royrvik.no",
-    "røyrvik.no",
-    "rade.no",
-    "råde.no",
-    "salangen.no",
-    "siellak.no",
-    "saltdal.no",
-    "salat.no",
-    "sálát.no",
-    "sálat.no",
-    "samnanger.no",
-    "sande.more-og-romsdal.no",
-    "sande.møre-og-romsdal.no",
-    "sande.vestfold.no",
-    "sandefjord.no",
-    "sandnes.no",
-    "sandoy.no",
-    "sandøy.no",
-    "sarpsborg.no",
-    "sauda.no",
-    "sauherad.no",
-    "sel.no",
-    "selbu.no",
-    "selje.no",
-    "seljord.no",
-    "sigdal.no",
-    "siljan.no",
-    "sirdal.no",
-    "skaun.no",
-    "skedsmo.no",
-    "ski.no",
-    "skien.no",
-    "skiptvet.no",
-    "skjervoy.no",
-    "skjervøy.no",
-    "skierva.no",
-    "skiervá.no",
-    "skjak.no",
-    "skjåk.no",
-    "skodje.no",
-    "skanland.no",
-    "skånland.no",
-    "skanit.no",
-    "skánit.no",
-    "smola.no",
-    "smøla.no",
-    "snillfjord.no",
-    "snasa.no",
-    "snåsa.no",
-    "snoasa.no",
-    "snaase.no",
-    "snåase.no",
-    "sogndal.no",
-    "sokndal.no",
-    "sola.no",
-    "solund.no",
-    "songdalen.no",
-    "sortland.no",
-    "spydeberg.no",
-    "stange.no",
-    "stavanger.no",
-    "steigen.no",
-    "steinkjer.no",
-    "stjordal.no",
-    "stjørdal.no",
-    "stokke.no",
-    "stor-elvdal.no",
-    "stord.no",
-    "stordal.no",
-    "storfjord.no",
-    "omasvuotna.no",
-    "strand.no",
-    "stranda.no",
-    "stryn.no",
-    "sula.no",
-    "suldal.no",
-    "sund.no",
-    "sunndal.no",
-    "surnadal.no",
-    "sveio.no",
-    "svelvik.no",
-    "sykkylven.no",
-    "sogne.no",
-    "søgne.no",
-    "somna.no",
-    "sømna.no",
-    "sondre-land.no",
-    "søndre-land.no",
-    "sor-aurdal.no",
-    "sør-aurdal.no",
-    "sor-fron.no",
-    "sør-fron.no",
-    "sor-odal.no",
-    "sør-odal.no",
-    "sor-varanger.no",
-    "sør-varanger.no",
-    "matta-varjjat.no",
-    "mátta-várjjat.no",
-    "sorfold.no",
-    "sørfold.no",
-    "sorreisa.no",
-    "sørreisa.no",
-    "sorum.no",
-    "sørum.no",
-    "tana.no",
-    "deatnu.no",
-    "time.no",
-    "tingvoll.no",
-    "tinn.no",
-    "tjeldsund.no",
-    "dielddanuorri.no",
-    "tjome.no",
-    "tjøme.no",
-    "tokke.no",
-    "tolga.no",
-    "torsken.no",
-    "tranoy.no",
-    "tranøy.no",
-    "tromso.no",
-    "tromsø.no",
-    "tromsa.no",
-    "romsa.no",
-    "trondheim.no",
-    "troandin.no",
-    "trysil.no",
-    "trana.no",
-    "træna.no",
-    "trogstad.no",
-    "trøgstad.no",
-    "tvedestrand.no",
-    "tydal.no",
-    "tynset.no",
-    "tysfjord.no",
-    "divtasvuodna.no",
-    "divttasvuotna.no",
-    "tysnes.no",
-    "tysvar.no",
-    "tysvær.no",
-    "tonsberg.no",
-    "tønsberg.no",
-    "ullensaker.no",
-    "ullensvang.no",
-    "ulvik.no",
-    "utsira.no",
-    "vadso.no",
-    "vadsø.no",
-    "cahcesuolo.no",
-    "čáhcesuolo.no",
-    "vaksdal.no",
-    "valle.no",
-    "vang.no",
-    "vanylven.no",
-    "vardo.no",
-    "vardø.no",
-    "varggat.no",
-    "várggát.no",
-    "vefsn.no",
-    "vaapste.no",
-    "vega.no",
-    "vegarshei.no",
-    "vegårshei.no",
-    "vennesla.no",
-    "verdal.no",
-    "verran.no",
-    "vestby.no",
-    "vestnes.no",
-    "vestre-slidre.no",
-    "vestre-toten.no",
-    "vestvagoy.no",
-    "vestvågøy.no",
-    "vevelstad.no",
-    "vik.no",
-    "vikna.no",
-    "vindafjord.no",
-    "volda.no",
-    "voss.no",
-    "varoy.no",
-    "værøy.no",
-    "vagan.no",
-    "vågan.no",
-    "voagat.no",
-    "vagsoy.no",
-    "vågsøy.no",
-    "vaga.no",
-    "vågå.no",
-    "valer.ostfold.no",
-    "våler.østfold.no",
-    "valer.hedmark.no",
-    "våler.hedmark.no",
-    "*.np",
-    "nr",
-    "biz.nr",
-    "info.nr",
-    "gov.nr",
-    "edu.nr",
-    "org.nr",
-    "net.nr",
-    "com.nr",
-    "nu",
-    "nz",
-    "ac.nz",
-    "co.nz",
-    "cri.nz",
-    "geek.nz",
-    "gen.nz",
-    "govt.nz",
-    "health.nz",
-    "iwi.nz",
-    "kiwi.nz",
-    "maori.nz",
-    "mil.nz",
-    "māori.nz",
-    "net.nz",
-    "org.nz",
-    "parliament.nz",
-    "school.nz",
-    "om",
-    "co.om",
-    "com.om",
-    "edu.om",
-    "gov.om",
-    "med.om",
-    "museum.om",
-    "net.om",
-    "org.om",
-    "pro.om",
-    "onion",
-    "org",
-    "pa",
-    "ac.pa",
-    "gob.pa",
-    "com.pa",
-    "org.pa",
-    "sld.pa",
-    "edu.pa",
-    "net.pa",
-    "ing.pa",
-    "abo.pa",
-    "med.pa",
-    "nom.pa",
-    "pe",
-    "edu.pe",
-    "gob.pe",
-    "nom.pe",
-    "mil.pe",
-    "org.pe",
-    "com.pe",
-    "net.pe",
-    "pf",
-    "com.pf",
-    "org.pf",
-    "edu.pf",
-    "*.pg",
-    "ph",
-    "com.ph",
-    "net.ph",
-    "org.ph",
-    "gov.ph",
-    "edu.ph",
-    "ngo.ph",
-    "mil.ph",
-    "i.ph",
-    "pk",
-    "com.pk",
-    "net.pk",
-    "edu.pk",
-    "org.pk",
-    "fam.pk",
-    "biz.pk",
-    "web.pk",
-    "gov.pk",
-    "gob.pk",
-    "gok.pk",
-    "gon.pk",
-    "gop.pk",
-    "gos.pk",
-    "info.pk",
-    "pl",
-    "com.pl",
-    "net.pl",
-    "org.pl",
-    "aid.pl",
-    "agro.pl",
-    "atm.pl",
-    "auto.pl",
-    "biz.pl",
-    "edu.pl",
-    "gmina.pl",
-    "gsm.pl",
-    "info.pl",
-    "mail.pl",
-    "miasta.pl",
-    "media.pl",
-    "mil.pl",
-    "nieruchomosci.pl",
-    "nom.pl",
-    "pc.pl",
-    "powiat.pl",
-    "priv.pl",
-    "realestate.pl",
-    "rel.pl",
-    "sex.pl",
-    "shop.pl",
-    "sklep.pl",
-    "sos.pl",
-    "szkola.pl",
-    "targi.pl",
-    "tm.pl",
-    "tourism.pl",
-    "travel.pl",
-    "turystyka.pl",
-    "gov.pl",
-    "ap.gov.pl",
-    "griw.gov.pl",
-    "ic.gov.pl",
-    "is.gov.pl",
-    "kmpsp.gov.pl",
-    "konsulat.gov.pl",
-    "kppsp.gov.pl",
-    "kwp.gov.pl",
-    "kwpsp.gov.pl",
-    "mup.gov.pl",
-    "mw.gov.pl",
-    "oia.gov.pl",
-    "oirm.gov.pl",
-    "oke.gov.pl",
-    "oow.gov.pl",
-    "oschr.gov.pl",
-    "oum.gov.pl",
-    "pa.gov.pl",
-    "pinb.gov.pl",
-    "piw.gov.pl",
-    "po.gov.pl",
-    "pr.gov.pl",
-    "psp.gov.pl",
-    "psse.gov.pl",
-    "pup.gov.pl",
-    "rzgw.gov.pl",
-    "sa.gov.pl",
-    "sdn.gov.pl",
-    "sko.gov.pl",
-    "so.gov.pl",
-    "sr.gov.pl",
-    "starostwo.gov.pl",
-    "ug.gov.pl",
-    "ugim.gov.pl",
-    "um.gov.pl",
-    "umig.gov.pl",
-    "upow.gov.pl",
-    "uppo.gov.pl",
-    "us.gov.pl",
-    "uw.gov.pl",
-    "uzs.gov.pl",
-    "wif.gov.pl",
-    "wiih.gov.pl",
-    "winb.gov.pl",
-    "wios.gov.pl",
-    "witd.gov.pl",
-    "wiw.gov.pl",
-    "wkz.gov.pl",
-    "wsa.gov.pl",
-    "wskr.gov.pl",
-    "wsse.gov.pl",
-    "wuoz.gov.pl",
-    "wzmiuw.gov.pl",
-    "zp.gov.pl",
-    "zpisdn.gov.pl",
-    "augustow.pl",
-    "babia-gora.pl",
-    "bedzin.pl",
-    "beskidy.pl",
-    "bialowieza.pl",
-    "bialystok.pl",
-    "bielawa.pl",
-    "bieszczady.pl",
-    "boleslawiec.pl",
-    "bydgoszcz.pl",
-    "bytom.pl",
-    "cieszyn.pl",
-    "czeladz.pl",
-    "czest.pl",
-    "dlugoleka.pl",
-    "elblag.pl",
-    "elk.pl",
-    "glogow.pl",
-    "gniezno.pl",
-    "gorlice.pl",
-    "grajewo.pl",
-    "ilawa.pl",
-    "jaworzno.pl",
-    "jelenia-gora.pl",
-    "jgora.pl",
-    "kalisz.pl",
-    "kazimierz-dolny.pl",
-    "karpacz.pl",
-    "kartuzy.pl",
-    "kaszuby.pl",
-    "katowice.pl",
-    "kepno.pl",
-    "ketrzyn.pl",
-    "klodzko.pl",
-    "kobierzyce.pl",
-    "kolobrzeg.pl",
-    "konin.pl",
-    "konskowola.pl",
-    "kutno.pl",
-    "lapy.pl",
-    "lebork.pl",
-    "legnica.pl",
-    "lezajsk.pl",
-    "limanowa.pl",
-    "lomza.pl",
-    "lowicz.pl",
-    "lubin.pl",
-    "lukow.pl",
-    "malbork.pl",
-    "malopolska.pl",
-    "mazowsze.pl",
-    "mazury.pl",
-    "mielec.pl",
-    "mielno.pl",
-    "mragowo.pl",
-    "naklo.pl",
-    "nowaruda.pl",
-    "nysa.pl",
-    "olawa.pl",
-    "olecko.pl",
-    "olkusz.pl",
-    "olsztyn.pl",
-    "opoczno.pl",
-    "opole.pl",
-    "ostroda.pl",
-    "ostroleka.pl",
-    "ostrowiec.pl",
-    "ostrowwlkp.pl",
-    "pila.pl",
-    "pisz.pl",
-    "podhale.pl",
-    "podlasie.pl",
-    "polkowice.pl",
-    "pomorze.pl",
-    "pomorskie.pl",
-    "prochowice.pl",
-    "pruszkow.pl",
-    "przeworsk.pl",
-    "pulawy.pl",
-    "radom.pl",
-    "rawa-maz.pl",
-    "rybnik.pl",
-    "rzeszow.pl",
-    "sanok.pl",
-    "sejny.pl",
-    "slask.pl",
-    "slupsk.pl",
-    "sosnowiec.pl",
-    "stalowa-wola.pl",
-    "skoczow.pl",
-    "starachowice.pl",
-    "stargard.pl",
-    "suwalki.pl",
-    "swidnica.pl",
-    "swiebodzin.pl",
-    "swinoujscie.pl",
-    "szczecin.pl",
-    "szczytno.pl",
-    "tarnobrzeg.pl",
-    "tgory.pl",
-    "turek.pl",
-    "tychy.pl",
-    "ustka.pl",
-    "walbrzych.pl",
-    "warmia.pl",
-    "warszawa.pl",
-    "waw.pl",
-    "wegrow.pl",
-    "wielun.pl",
-    "wlocl.pl",
-    "wloclawek.pl",
-    "wodzislaw.pl",
-    "wolomin.pl",
-    "wroclaw.pl",
-    "zachpomor.pl",
-    "zagan.pl",
-    "zarow.pl",
-    "zgora.pl",
-    "zgorzelec.pl",
-    "pm",
-    "pn",
-    "gov.pn",
-    "co.pn",
-    "org.pn",
-    "edu.pn",
-    "net.pn",
-    "post",
-    "pr",
-    "com.pr",
-    "net.pr",
-    "org.pr",
-    "gov.pr",
-    "edu.pr",
-    "isla.pr",
-    "pro.pr",
-    "biz.pr",
-    "info.pr",
-    "name.pr",
-    "est.pr",
-    "prof.pr",
-    "ac.pr",
-    "pro",
-    "aaa.pro",
-    "aca.pro",
-    "acct.pro",
-    "avocat.pro",
-    "bar.pro",
-    "cpa.pro",
-    "eng.pro",
-    "jur.pro",
-    "law.pro",
-    "med.pro",
-    "recht.pro",
-    "ps",
-    "edu.ps",
-    "gov.ps",
-    "sec.ps",
-    "plo.ps",
-    "com.ps",
-    "org.ps",
-    "net.ps",
-    "pt",
-    "net.pt",
-    "gov.pt",
-    "org.pt",
-    "edu.pt",
-    "int.pt",
-    "publ.pt",
-    "com.pt",
-    "nome.pt",
-    "pw",
-    "co.pw",
-    "ne.pw",
-    "or.pw",
-    "ed.pw",
-    "go.pw",
-    "belau.pw",
-    "py",
-    "com.py",
-    "coop.py",
-    "edu.py",
-    "gov.py",
-    "mil.py",
-    "net.py",
-    "org.py",
-    "qa",
-    "com.qa",
-    "edu.qa",
-    "gov.qa",
-    "mil.qa",
-    "name.qa",
-    "net.qa",
-    "org.qa",
-    "sch.qa",
-    "re",
-    "asso.re",
-    "com.re",
-    "nom.re",
-    "ro",
-    "arts.ro",
-    "com.ro",
-    "firm.ro",
-    "info.ro",
-    "nom.ro",
-    "nt.ro",
-    "org.ro",
-    "rec.ro",
-    "store.ro",
-    "tm.ro",
-    "www.ro",
-    "rs",
-    "ac.rs",
-    "co.rs",
-    "edu.rs",
-    "gov.rs",
-    "in.rs",
-    "org.rs",
-    "ru",
-    "rw",
-    "ac.rw",
-    "co.rw",
-    "coop.rw",
-    "gov.rw",
-    "mil.rw",
-    "net.rw",
-    "org.rw",
-    "sa",
-    "com.sa",
-    "net.sa",
-    "org.sa",
-    "gov.sa",
-    "med.sa",
-    "pub.sa",
-    "edu.sa",
-    "sch.sa",
-    "sb",
-    "com.sb",
-    "edu.sb",
-    "gov.sb",
-    "net.sb",
-    "org.sb",
-    "sc",
-    "com.sc",
-    "gov.sc",
-    "net.sc",
-    "org.sc",
-    "edu.sc",
-    "sd",
-    "com.sd",
-    "net.sd",
-    "org.sd",
-    "edu.sd",
-    "med.sd",
-    "tv.sd",
-    "gov.sd",
-    "info.sd",
-    "se",
-    "a.se",
-    "ac.se",
-    "b.se",
-    "bd.se",
-    "brand.se",
-    "c.se",
-    "d.se",
-    "e.se",
-    "f.se",
-    "fh.se",
-    "fhsk.se",
-    "fhv.se",
-    "g.se",
-    "h.se",
-    "i.se",
-    "k.se",
-    "komforb.se",
-    "kommunalforbund.se",
-    "komvux.se",
-    "l.se",
-    "lanbib.se",
-    "m.se",
-    "n.se",
-    "naturbruksgymn.se",
-    "o.se",
-    "org.se",
-    "p.se",
-    "parti.se",
-    "pp.se",
-    "press.se",
-    "r.se",
-    "s.se",
-    "t.se",
-    "tm.se",
-    "u.se",
-    "w.se",
-    "x.se",
-    "y.se",
-    "z.se",
-    "sg",
-    "com.sg",
-    "net.sg",
-    "org.sg",
-    "gov.sg",
-    "edu.sg",
-    "per.sg",
-    "sh",
-    "com.sh",
-    "net.sh",
-    "gov.sh",
-    "org.sh",
-    "mil.sh",
-    "si",
-    "sj",
-    "sk",
-    "sl",
-    "com.sl",
-    "net.sl",
-    "edu.sl",
-    "gov.sl",
-    "org.sl",
-    "sm",
-    "sn",
-    "art.sn",
-    "com.sn",
-    "edu.sn",
-    "gouv.sn",
-    "org.sn",
-    "perso.sn",
-    "univ.sn",
-    "so",
-    "com.so",
-    "edu.so",
-    "gov.so",
-    "me.so",
-    "net.so",
-    "org.so",
-    "sr",
-    "ss",
-    "biz.ss",
-    "com.ss",
-    "edu.ss",
-    "gov.ss",
-    "me.ss",
-    "net.ss",
-    "org.ss",
-    "sch.ss",
-    "st",
-    "co.st",
-    "com.st",
-    "consulado.st",
-    "edu.st",
-    "embaixada.st",
-    "mil.st",
-    "net.st",
-    "org.st",
-    "principe.st",
-    "saotome.st",
-    "store.st",
-    "su",
-    "sv",
-    "com.sv",
-    "edu.sv",
-    "gob.sv",
-    "org.sv",
-    "red.sv",
-    "sx",
-    "gov.sx",
-    "sy",
-    "edu.sy",
-    "gov.sy",
-    "net.sy",
-    "mil.sy",
-    "com.sy",
-    "org.sy",
-    "sz",
-    "co.sz",
-    "ac.sz",
-    "org.sz",
-    "tc",
-    "td",
-    "tel",
-    "tf",
-    "tg",
-    "th",
-    "ac.th",
-    "co.th",
-    "go.th",
-    "in.th",
-    "mi.th",
-    "net.th",
-    "or.th",
-    "tj",
-    "ac.tj",
-    "biz.tj",
-    "co.tj",
-    "com.tj",
-    "edu.tj",
-    "go.tj",
-    "gov.tj",
-    "int.tj",
-    "mil.tj",
-    "name.tj",
-    "net.tj",
-    "nic.tj",
-    "org.tj",
-    "test.tj",
-    "web.tj",
-    "tk",
-    "tl",
-    "gov.tl",
-    "tm",
-    "com.tm",
-    "co.tm",
-    "org.tm",
-    "net.tm",
-    "nom.tm",
-    "gov.tm",
-    "mil.tm",
-    "edu.tm",
-    "tn",
-    "com.tn",
-    "ens.tn",
-    "fin.tn",
-    "gov.tn",
-    "ind.tn",
-    "info.tn",
-    "intl.tn",
-    "mincom.tn",
-    "nat.tn",
-    "net.tn",
-    "org.tn",
-    "perso.tn",
-    "tourism.tn",
-    "to",
-    "com.to",
-    "gov.to",
-    "net.to",
-    "org.to",
-    "edu.to",
-    "mil.to",
-    "tr",
-    "av.tr",
-    "bbs.tr",
-    "bel.tr",
-    "biz.tr",
-    "com.tr",
-    "dr.tr",
-    "edu.tr",
-    "gen.tr",
-    "gov.tr",
-    "info.tr",
-    "mil.tr",
-    "k12.tr",
-    "kep.tr",
-    "name.tr",
-    "net.tr",
-    "org.tr",
-    "pol.tr",
-    "tel.tr",
-    "tsk.tr",
-    "tv.tr",
-    "web.tr",
-    "nc.tr",
-    "gov.nc.tr",
-    "tt",
-    "co.tt",
-    "com.tt",
-    "org.tt",
-    "net.tt",
-    "biz.tt",
-    "info.tt",
-    "pro.tt",
-    "int.tt",
-    "coop.tt",
-    "jobs.tt",
-    "mobi.tt",
-    "travel.tt",
-    "museum.tt",
-    "aero.tt",
-    "name.tt",
-    "gov.tt",
-    "edu.tt",
-    "tv",
-    "tw",
-    "edu.tw",
-    "gov.tw",
-    "mil.tw",
-    "com.tw",
-    "net.tw",
-    "org.tw",
-    "idv.tw",
-    "game.tw",
-    "ebiz.tw",
-    "club.tw",
-    "網路.tw",
-    "組織.tw",
-    "商業.tw",
-    "tz",
-    "ac.tz",
-    "co.tz",
-    "go.tz",
-    "hotel.tz",
-    "info.tz",
-    "me.tz",
-    "mil.tz",
-    "mobi.tz",
-    "ne.tz",
-    "or.tz",
-    "sc.tz",
-    "tv.tz",
-    "ua",
-    "com.ua",
-    "edu.ua",
-    "gov.ua",
-    "in.ua",
-    "net.ua",
-    "org.ua",
-    "cherkassy.ua",
-    "cherkasy.ua",
-    "chernigov.ua",
-    "chernihiv.ua",
-    "chernivtsi.ua",
-    "chernovtsy.ua",
-    "ck.ua",
-    "cn.ua",
-    "cr.ua",
-    "crimea.ua",
-    "cv.ua",
-    "dn.ua",
-    "dnepropetrovsk.ua",
-    "dnipropetrovsk.ua",
-    "donetsk.ua",
-    "dp.ua",
-    "if.ua",
-    "ivano-frankivsk.ua",
-    "kh.ua",
-    "kharkiv.ua",
-    "kharkov.ua",
-    "kherson.ua",
-    "khmelnitskiy.ua",
-    "khmelnytskyi.ua",
-    "kiev.ua",
-    "kirovograd.ua",
-    "km.ua",
-    "kr.ua",
-    "kropyvnytskyi.ua",
-    "krym.ua",
-    "ks.ua",
-    "kv.ua",
-    "kyiv.ua",
-    "lg.ua",
-    "lt.ua",
-    "lugansk.ua",
-    "lutsk.ua",
-    "lv.ua",
-    "lviv.ua",
-    "mk.ua",
-    "mykolaiv.ua",
-    "nikolaev.ua",
-    "od.ua",
-    "odesa.ua",
-    "odessa.ua",
-    "pl.ua",
-    "poltava.ua",
-    "rivne.ua",
-    "rovno.ua",
-    "rv.ua",
-    "sb.ua",
-    "sebastopol.ua",
-    "sevastopol.ua",
-    "sm.ua",
-    "sumy.ua",
-    "te.ua",
-    "ternopil.ua",
-    "uz.ua",
-    "uzhgorod.ua",
-    "vinnica.ua",
-    "vinnytsia.ua",
-    "vn.ua",
-    "volyn.ua",
-    "yalta.ua",
-    "zaporizhzhe.ua",
-    "zaporizhzhia.ua",
-    "zhitomir.ua",
-    "zhytomyr.ua",
-    "zp.ua",
-    "zt.ua",
-    "ug",
-    "co.ug",
-    "or.ug",
-    "ac.ug",
-    "sc.ug",
-    "go.ug",
-    "ne.ug",
-    "com.ug",
-    "org.ug",
-    "uk",
-    "ac.uk",
-    "co.uk",
-    "gov.uk",
-    "ltd.uk",
-    "me.uk",
-    "net.uk",
-    "nhs.uk",
-    "org.uk",
-    "plc.uk",
-    "police.uk",
-    "*.sch.uk",
-    "us",
-    "dni.us",
-    "fed.us",
-    "isa.us",
-    "kids.us",
-    "nsn.us",
-    "ak.us",
-    "al.us",
-    "ar.us",
-    "as.us",
-    "az.us",
-    "ca.us",
-    "co.us",
-    "ct.us",
-    "dc.us",
-    "de.us",
-    "fl.us",
-    "ga.us",
-    "gu.us",
-    "hi.us",
-    "ia.us",
-    "id.us",
-    "il.us",
-    "in.us",
-    "ks.us",
-    "ky.us",
-    "la.us",
-    "ma.us",
-    "md.us",
-    "me.us",
-    "mi.us",
-    "mn.us",
-    "mo.us",
-    "ms.us",
-    "mt.us",
-    "nc.us",
-    "nd.us",
-    "ne.us",
-    "nh.us",
-    "nj.us",
-    "nm.us",
-    "nv.us",
-    "ny.us",
-    "oh.us",
-    "ok.us",
-    "or.us",
-    "pa.us",
-    "pr.us",
-    "ri.us",
-    "sc.us",
-    "sd.us",
-    "tn.us",
-    "tx.us",
-    "ut.us",
-    "vi.us",
-    "vt.us",
-    "va.us",
-    "wa.us",
-    "wi.us",
-    "wv.us",
-    "wy.us",
-    "k12.ak.us",
-    "k12.al.us",
-    "k12.ar.us",
-    "k12.as.us",
-    "k12.az.us",
-    "k12.ca.us",
-    "k12.co.us",
-    "k12.ct.us",
-    "k12.dc.us",
-    "k12.de.us",
-    "k12.fl.us",
-    "k12.ga.us",
-    "k12.gu.us",
-    "k12.ia.us",
-    "k12.id.us",
-    "k12.il.us",
-    "k12.in.us",
-    "k12.ks.us",
-    "k12.ky.us",
-    "k12.la.us",
-    "k12.ma.us",
-    "k12.md.us",
-    "k12.me.us",
-    "k12.mi.us",
-    "k12.mn.us",
-    "k12.mo.us",
-    "k12.ms.us",
-    "k12.mt.us",
-    "k12.nc.us",
-    "k12.ne.us",
-    "k12.nh.us",
-    "k12.nj.us",
-    "k12.nm.us",
-    "k12.nv.us",
-    "k12.ny.us",
-    "k12.oh.us",
-    "k12.ok.us",
-    "k12.or.us",
-    "k12.pa.us",
-    "k12.pr.us",
-    "k12.sc.us",
-    "k12.tn.us",
-    "k12.tx.us",
-    "k12.ut.us",
-    "k12.vi.us",
-    "k12.vt.us",
-    "k12.va.us",
-    "k12.wa.us",
-    "k12.wi.us",
-    "k12.wy.us",
-    "cc.ak.us",
-    "cc.al.us",
-    "cc.ar.us",
-    "cc.as.us",
-    "cc.az.us",
-    "cc.ca.us",
-    "cc.co.us",
-    "cc.ct.us",
-    "cc.dc.us",
-    "cc.de.us",
-    "cc.fl.us",
-    "cc.ga.us",
-    "cc.gu.us",
-    "cc.hi.us",
-    "cc.ia.us",
-    "cc.id.us",
-    "cc.il.us",
-    "cc.in.us",
-    "cc.ks.us",
-    "cc.ky.us",
-    "cc.la.us",
-    "cc.ma.us",
-    "cc.md.us",
-    "cc.me.us",
-    "cc.mi.us",
-    "cc.mn.us",
-    "cc.mo.us",
-    "cc.ms.us",
-    "cc.mt.us",
-    "cc.nc.us",
-    "cc.nd.us",
-    "cc.ne.us",
-    "cc.nh.us",
-    "cc.nj.us",
-    "cc.nm.us",
-    "cc.nv.us",
-    "cc.ny.us",
-    "cc.oh.us",
-    "cc.ok.us",
-    "cc.or.us",
-    "cc.pa.us",
-    "cc.pr.us",
-    "cc.ri.us",
-    "cc.sc.us",
-    "cc.sd.us",
-    "cc.tn.us",
-    "cc.tx.us",
-    "cc.ut.us",
-    "cc.vi.us",
-    "cc.vt.us",
-    "cc.va.us",
-    "cc.wa.us",
-    "cc.wi.us",
-    "cc.wv.us",
-    "cc.wy.us",
-    "lib.ak.us",
-    "lib.al.us",
-    "lib.ar.us",
-    "lib.as.us",
-    "lib.az.us",
-    "lib.ca.us",
-    "lib.co.us",
-    "lib.ct.us",
-    "lib.dc.us",
-    "lib.fl.us",
-    "lib.ga.us",
-    "lib.gu.us",
-    "lib.hi.us",
-    "lib.ia.us",
-    "lib.id.us",
-    "lib.il.us",
-    "lib.in.us",
-    "lib.ks.us",
-    "lib.ky.us",
-    "lib.la.us",
-    "lib.ma.us",
-    "lib.md.us",
-    "lib.me.us",
-    "lib.mi.us",
-    "lib.mn.us",
-    "lib.mo.us",
-    "lib.ms.us",
-    "lib.mt.us",
-    "lib.nc.us",
-    "lib.nd.us",
-    "lib.ne.us",
-    "lib.nh.us",
-    "lib.nj.us",
-    "lib.nm.us",
-    "lib.nv.us",
-    "lib.ny.us",
-    "lib.oh.us",
-    "lib.ok.us",
-    "lib.or.us",
-    "lib.pa.us",
-    "lib.pr.us",
-    "lib.ri.us",
-    "lib.sc.us",
-    "lib.sd.us",
-    "lib.tn.us",
-    "lib.tx.us",
-    "lib.ut.us",
-    "lib.vi.us",
-    "lib.vt.us",
-    "lib.va.us",
-    "lib.wa.us",
-    "lib.wi.us",
-    "lib.wy.us",
-    "pvt.k12.ma.us",
-    "chtr.k12.ma.us",
-    "paroch.k12.ma.us",
-    "ann-arbor.mi.us",
-    "cog.mi.us",
-    "dst.mi.us",
-    "eaton.mi.us",
-    "gen.mi.us",
-    "mus.mi.us",
-    "tec.mi.us",
-    "washtenaw.mi.us",
-    "uy",
-    "com.uy",
-    "edu.uy",
-    "gub.uy",
-    "mil.uy",
-    "net.uy",
-    "org.uy",
-    "uz",
-    "co.uz",
-    "com.uz",
-    "net.uz",
-    "org.uz",
-    "va",
-    "vc",
-    "com.vc",
-    "net.vc",
-    "org.vc",
-    "gov.vc",
-    "mil.vc",
-    "edu.vc",
-    "ve",
-    "arts.ve",
-    "bib.ve",
-    "co.ve",
-    "com.ve",
-    "e12.ve",
-    "edu.ve",
-    "firm.ve",
-    "gob.ve",
-    "gov.ve",
-    "info.ve",
-    "int.ve",
-    "mil.ve",
-    "net.ve",
-    "nom.ve",
-    "org.ve",
-    "rar.ve",
-    "rec.ve",
-    "store.ve",
-    "tec.ve",
-    "web.ve",
-    "vg",
-    "vi",
-    "co.vi",
-    "com.vi",
-    "k12.vi",
-    "net.vi",
-    "org.vi",
-    "vn",
-    "ac.vn",
-    "ai.vn",
-    "biz.vn",
-    "com.vn",
-    "edu.vn",
-    "gov.vn",
-    "health.vn",
-    "id.vn",
-    "info.vn",
-    "int.vn",
-    "io.vn",
-    "name.vn",
-    "net.vn",
-    "org.vn",
-    "pro.vn",
-    "angiang.vn",
-    "bacgiang.vn",
-    "backan.vn",
-    "baclieu.vn",
-    "bacninh.vn",
-    "baria-vungtau.vn",
-    "bentre.vn",
-    "binhdinh.vn",
-    "binhduong.vn",
-    "binhphuoc.vn",
-    "binhthuan.vn",
-    "camau.vn",
-    "cantho.vn",
-    "caobang.vn",
-    "daklak.vn",
-    "daknong.vn",
-    "danang.vn",
-    "dienbien.vn",
-    "dongnai.vn",
-    "dongthap.vn",
-    "gialai.vn",
-    "hagiang.vn",
-    "haiduong.vn",
-    "haiphong.vn",
-    "hanam.vn",
-    "hanoi.vn",
-    "hatinh.vn",
-    "haugiang.vn",
-    "hoabinh.vn",
-    "hungyen.vn",
-    "khanhhoa.vn",
-    "kiengiang.vn",
-    "kontum.vn",
-    "laichau.vn",
-    "lamdong.vn",
-    "langson.vn",
-    "laocai.vn",
-    "longan.vn",
-    "namdinh.vn",
-    "nghean.vn",
-    "ninhbinh.vn",
-    "ninhthuan.vn",
-    "phutho.vn",
-    "phuyen.vn",
-    "quangbinh.vn",
-    "quangnam.vn",
-    "quangngai.vn",
-    "quangninh.vn",
-    "quangtri.vn",
-    "soctrang.vn",
-    "sonla.vn",
-    "tayninh.vn",
-    "thaibinh.vn",
-    "thainguyen.vn",
-    "thanhhoa.vn",
-    "thanhphohochiminh.vn",
-    "thuathienhue.vn",
-    "tiengiang.vn",
-    "travinh.vn",
-    "tuyenquang.vn",
-    "vinhlong.vn",
-    "vinhphuc.vn",
-    "yenbai.vn",
-    "vu",
-    "com.vu",
-    "edu.vu",
-    "net.vu",
-    "org.vu",
-    "wf",
-    "ws",
-    "com.ws",
-    "net.ws",
-    "org.ws",
-    "gov.ws",
-    "edu.ws",
-    "yt",
-    "امارات",
-    "հայ",
-    "বাংলা",
-    "бг",
-    "البحرين",
-    "бел",
-    "中国",
-    "中國",
-    "الجزائر",
-    "مصر",
-    "ею",
-    "ευ",
-    "موريتانيا",
-    "გე",
-    "ελ",
-    "香港",
-    "公司.香港",
-    "教育.香港",
-    "政府.香港",
-    "個人.香港",
-    "網絡.香港",
-    "組織.香港",
-    "ಭಾರತ",
-    "ଭାରତ",
-    "ভাৰত",
-    "भारतम्",
-    "भारोत",
-    "ڀارت",
-    "ഭാരതം",
-    "भारत",
-    "بارت",
-    "بھارت",
-    "భారత్",
-    "ભારત",
-    "ਭਾਰਤ",
-    "ভারত",
-    "இந்தியா",
-    "ایران",
-    "ايران",
-    "عراق",
-    "الاردن",
-    "한국",
-    "қаз",
-    "ລາວ",
-    "ලංකා",
-    "இலங்கை",
-    "المغرب",
-    "мкд",
-    "мон",
-    "澳門",
-    "澳门",
-    "مليسيا",
-    "عمان",
-    "پاکستان",
-    "پاكستان",
-    "فلسطين",
-    "срб",
-    "пр.срб",
-    "орг.срб",
-    "обр.срб",
-    "од.срб",
-    "упр.срб",
-    "ак.срб",
-    "рф",
-    "قطر",
-    "السعودية",
-    "السعودیة",
-    "السعودیۃ",
-    "السعوديه",
-    "سودان",
-    "新加坡",
-    "சிங்கப்பூர்",
-    "سورية",
-    "سوريا",
-    "ไทย",
-    "ศึกษา.ไทย",
-    "ธุรกิจ.ไทย",
-    "รัฐบาล.ไทย",
-    "ทหาร.ไทย",
-    "เน็ต.ไทย",
-    "องค์กร.ไทย",
-    "تونس",
-    "台灣",
-    "台湾",
-    "臺灣",
-    "укр",
-    "اليمن",
-    "xxx",
-    "ye",
-    "com.ye",
-    "edu.ye",
-    "gov.ye",
-    "net.ye",
-    "mil.ye",
-    "org.ye",
-    "ac.za",
-    "agric.za",
-    "alt.za",
-    "co.za",
-    "edu.za",
-    "gov.za",
-    "grondar.za",
-    "law.za",
-    "mil.za",
-    "net.za",
-    "ngo.za",
-    "nic.za",
-    "nis.za",
-    "nom.za",
-    "org.za",
-    "school.za",
-    "tm.za",
-    "web.za",
-    "zm",
-    "ac.zm",
-    "biz.zm",
-    "co.zm",
-    "com.zm",
-    "edu.zm",
-    "gov.zm",
-    "info.zm",
-    "mil.zm",
-    "net.zm",
-    "org.zm",
-    "sch.zm",
-    "zw",
-    "ac.zw",
-    "co.zw",
-    "gov.zw",
-    "mil.zw",
-    "org.zw",
-    "aaa",
-    "aarp",
-    "abb",
-    "abbott",
-    "abbvie",
-    "abc",
-    "able",
-    "abogado",
-    "abudhabi",
-    "academy",
-    "accenture",
-    "accountant",
-    "accountants",
-    "aco",
-    "actor",
-    "ads",
-    "adult",
-    "aeg",
-    "aetna",
-    "afl",
-    "africa",
-    "agakhan",
-    "agency",
-    "aig",
-    "airbus",
-    "airforce",
-    "airtel",
-    "akdn",
-    "alibaba",
-    "alipay",
-    "allfinanz",
-    "allstate",
-    "ally",
-    "alsace",
-    "alstom",
-    "amazon",
-    "americanexpress",
-    "americanfamily",
-    "amex",
-    "amfam",
-    "amica",
-    "amsterdam",
-    "analytics",
-    "android",
-    "anquan",
-    "anz",
-    "aol",
-    "apartments",
-    "app",
-    "apple",
-    "aquarelle",
-    "arab",
-    "aramco",
-    "archi",
-    "army",
-    "art",
-    "arte",
-    "asda",
-    "associates",
-    "athleta",
-    "attorney",
-    "auction",
-    "audi",
-    "audible",
-    "audio",
-    "auspost",
-    "author",
-    "auto",
-    "autos",
-    "avianca",
-    "aws",
-    "axa",
-    "azure",
-    "baby",
-    "baidu",
-    "banamex",
-    "bananarepublic",
-    "band",
-    "bank",
-    "bar",
-    "barcelona",
-    "barclaycard",
-    "barclays",
-    "barefoot",
-    "bargains",
-    "baseball",
-    "basketball",
-    "bauhaus",
-    "bayern",
-    "bbc",
-    "bbt",
-    "bbva",
-    "bcg",
-    "bcn",
-    "beats",
-    "beauty",
-    "beer",
-    "bentley",
-    "berlin",
-    "best",
-    "bestbuy",
-    "bet",
-    "bharti",
-    "bible",
-    "bid",
-    "bike",
-    "bing",
-    "bingo",
-    "bio",
-    "black",
-    "blackfriday",
-    "blockbuster",
-    "blog",
-    "bloomberg",
-    "blue",
-    "bms",
-    "bmw",
-    "bnpparibas",
-    "boats",
-    "boehringer",
-    "bofa",
-    "bom",
-    "bond",
-    "boo",
-    "book",
-    "booking",
-    "bosch",
-    "bostik",
-    "boston",
-    "bot",
-    "boutique",
-    "box",
-    "bradesco",
-    "bridgestone",
-    "broadway",
-    "broker",
-    "brother",
-    "brussels",
-    "build",
-    "builders",
-    "business",
-    "buy",
-    "buzz",
-    "bzh",
-    "cab",
-    "cafe",
-    "cal",
-    "call",
-    "calvinklein",
-    "cam",
-    "camera",
-    "camp",
-    "canon",
-    "capetown",
-    "capital",
-    "capitalone",
-    "car",
-    "caravan",
-    "cards",
-    "care",
-    "career",
-    "careers",
-    "cars",
-    "casa",
-    "case",
-    "cash",
-    "casino",
-    "catering",
-    "catholic",
-    "cba",
-    "cbn",
-    "cbre",
-    "cbs",
-    "center",
-    "ceo",
-    "cern",
-    "cfa",
-    "cfd",
-    "chanel",
-    "channel",
-    "charity",
-    "chase",
-    "chat",
-    "cheap",
-    "chintai",
-    "christmas",
-    "chrome",
-    "church",
-    "cipriani",
-    "circle",
-    "cisco",
-    "citadel",
-    "citi",
-    "citic",
-    "city",
-    "cityeats",
-    "claims",
-    "cleaning",
-    "click",
-    "clinic",
-    "clinique",
-    "clothing",
-    "cloud",
-    "club",
-    "clubmed",
-    "coach",
-    "codes",
-    "coffee",
-    "college",
-    "cologne",
-    "comcast",
-    "commbank",
-    "community",
-    "company",
-    "compare",
-    "computer",
-    "comsec",
-    "condos",
-    "construction",
-    "consulting",
-    "contact",
-    "contractors",
-    "cooking",
-    "cool",
-    "corsica",
-    "country",
-    "coupon",
-    "coupons",
-    "courses",
-    "cpa",
-    "credit",
-    "creditcard",
-    "creditunion",
-    "cricket",
-    "crown",
-    "crs",
-    "cruise",
-    "cruises",
-    "cuisinella",
-    "cymru",
-    "cyou",
-    "dabur",
-    "dad",
-    "dance",
-    "data",
-    "date",
-    "dating",
-    "datsun",
-    "day",
-    "dclk",
-    "dds",
-    "deal",
-    "dealer",
-    "deals",
-    "degree",
-    "delivery",
-    "dell",
-    "deloitte",
-    "delta",
-    "democrat",
-    "dental",
-    "dentist",
-    "desi",
-    "design",
-    "dev",
-    "dhl",
-    "diamonds",
-    "diet",
-    "digital",
-    "direct",
-    "directory",
-    "discount",
-    "discover",
-    "dish",
-    "diy",
-    "dnp",
-    "docs",
-    "doctor",
-    "dog",
-    "domains",
-    "dot",
-    "download",
-    "drive",
-    "dtv",
-    "dubai",
-    "dunlop",
-    "dupont",
-    "durban",
-    "dvag",
-    "dvr",
-    "earth",
-    "eat",
-    "eco",
-    "edeka",
-    "education",
-    "email",
-    "emerck",
-    "energy",
-    "engineer",
-    "engineering",
-    "enterprises",
-    "epson",
-    "equipment",
-    "ericsson",
-    "erni",
-    "esq",
-    "estate",
-    "etisalat",
-    "eurovision",
-    "eus",
-    "events",
-    "exchange",
-    "expert",
-    "exposed",
-    "express",
-    "extraspace",
-    "fage",
-    "fail",
-    "fairwinds",
-    "faith",
-    "family",
-    "fan",
-    "fans",
-    "farm",
-    "farmers",
-    "fashion",
-    "fast",
-    "fedex",
-    "feedback",
-    "ferrari",
-    "ferrero",
-    "fidelity",
-    "fido",
-    "film",
-    "final",
-    "finance",
-    "financial",
-    "fire",
-    "firestone",
-    "firmdale",
-    "fish",
-    "fishing",
-    "fit",
-    "fitness",
-    "flickr",
-    "flights",
-    "flir",
-    "florist",
-    "flowers",
-    "fly",
-    "foo",
-    "food",
-    "football",
-    "ford",
-    "forex",
-    "forsale",
-    "forum",
-    "foundation",
-    "fox",
-    "free",
-    "fresenius",
-    "frl",
-    "frogans",
-    "frontdoor",
-    "frontier",
-    "ftr",
-    "fujitsu",
-    "fun",
-    "fund",
-    "furniture",
-    "futbol",
-    "fyi",
-    "gal",
-    "gallery",
-    "gallo",
-    "gallup",
-    "game",
-    "games",
-    "gap",
-    "garden",
-    "gay",
-    "gbiz",
-    "gdn",
-    "gea",
-    "gent",
-    "genting",
-    "george",
-    "ggee",
-    "gift",
-    "gifts",
-    "gives",
-    "giving",
-    "glass",
-    "gle",
-    "global",
-    "globo",
-    "gmail",
-    "gmbh",
-    "gmo",
-    "gmx",
-    "godaddy",
-    "gold",
-    "goldpoint",
-    "golf",
-    "goo",
-    "goodyear",
-    "goog",
-    "google",
-    "gop",
-    "got",
-    "grainger",
-    "graphics",
-    "gratis",
-    "green",
-    "gripe",
-    "grocery",
-    "group",
-    "guardian",
-    "gucci",
-    "guge",
-    "guide",
-    "guitars",
-    "guru",
-    "hair",
-    "hamburg",
-    "hangout",
-    "haus",
-    "hbo",
-    "hdfc",
-    "hdfcbank",
-    "health",
-    "healthcare",
-    "help",
-    "helsinki",
-    "here",
-    "hermes",
-    "hiphop",
-    "hisamitsu",
-    "hitachi",
-    "hiv",
-    "hkt",
-    "hockey",
-    "holdings",
-    "holiday",
-    "homedepot",
-    "homegoods",
-    "homes",
-    "homesense",
-    "honda",
-    "horse",
-    "hospital",
-    "host",
-    "hosting",
-    "hot",
-    "hotels",
-    "hotmail",
-    "house",
-    "how",
-    "hsbc",
-    "hughes",
-    "hyatt",
-    "hyundai",
-    "ibm",
-    "icbc",
-    "ice",
-    "icu",
-    "ieee",
-    "ifm",
-    "ikano",
-    "imamat",
-    "imdb",
-    "immo",
-    "immobilien",
-    "inc",
-    "industries",
-    "infiniti",
-    "ing",
-    "ink",
-    "institute",
-    "insurance",
-    "insure",
-    "international",
-    "intuit",
-    "investments",
-    "ipiranga",
-    "irish",
-    "ismaili",
-    "ist",
-    "istanbul",
-    "itau",
-    "itv",
-    "jaguar",
-    "java",
-    "jcb",
-    "jeep",
-    "jetzt",
-    "jewelry",
-    "jio",
-    "jll",
-    "jmp",
-    "jnj",
-    "joburg",
-    "jot",
-    "joy",
-    "jpmorgan",
-    "jprs",
-    "juegos",
-    "juniper",
-    "kaufen",
-    "kddi",
-    "kerryhotels",
-    "kerrylogistics",
-    "kerryproperties",
-    "kfh",
-    "kia",
-    "kids",
-    "kim",
-    "kinder",
-    "kindle",
-    "kitchen",
-    "kiwi",
-    "koeln",
-    "komatsu",
-    "kosher",
-    "kpmg",
-    "kpn",
-    "krd",
-    "kred",
-    "kuokgroup",
-    "kyoto",
-    "lacaixa",
-    "lamborghini",
-    "lamer",
-    "lancaster",
-    "land",
-    "landrover",
-    "lanxess",
-    "lasalle",
-    "lat",
-    "latino",
-    "latrobe",
-    "law",
-    "lawyer",
-    "lds",
-    "lease",
-    "leclerc",
-    "lefrak",
-    "legal",
-    "lego",
-    "lexus",
-    "lgbt",
-    "lidl",
-    "life",
-    "lifeinsurance",
-    "lifestyle",
-    "lighting",
-    "like",
-    "lilly",
-    "limited",
-    "limo",
-    "lincoln",
-    "link",
-    "lipsy",
-    "live",
-    "living",
-    "llc",
-    "llp",
-    "loan",
-    "loans",
-    "locker",
-    "locus",
-    "lol",
-    "london",
-    "lotte",
-    "lotto",
-    "love",
-    "lpl",
-    "lplfinancial",
-    "ltd",
-    "ltda",
-    "lundbeck",
-    "luxe",
-    "luxury",
-    "madrid",
-    "maif",
-    "maison",
-    "makeup",
-    "man",
-    "management",
-    "mango",
-    "map",
-    "market",
-    "marketing",
-    "markets",
-    "marriott",
-    "marshalls",
-    "mattel",
-    "mba",
-    "mckinsey",
-    "med",
-    "media",
-    "meet",
-    "melbourne",
-    "meme",
-    "memorial",
-    "men",
-    "menu",
-    "merckmsd",
-    "miami",
-    "microsoft",
-    "mini",
-    "mint",
-    "mit",
-    "mitsubishi",
-    "mlb",
-    "mls",
-    "mma",
-    "mobile",
-    "moda",
-    "moe",
-    "moi",
-    "mom",
-    "monash",
-    "money",
-    "monster",
-    "mormon",
-    "mortgage",
-    "moscow",
-    "moto",
-    "motorcycles",
-    "mov",
-    "movie",
-    "msd",
-    "mtn",
-    "mtr",
-    "music",
-    "nab",
-    "nagoya",
-    "natura",
-    "navy",
-    "nba",
-    "nec",
-    "netbank",
-    "netflix",
-    "network",
-    "neustar",
-    "new",
-    "news",
-    "next",
-    "nextdirect",
-    "nexus",
-    "nfl",
-    "ngo",
-    "nhk",
-    "nico",
-    "nike",
-    "nikon",
-    "ninja",
-    "nissan",
-    "nissay",
-    "nokia",
-    "norton",
-    "now",
-    "nowruz",
-    "nowtv",
-    "nra",
-    "nrw",
-    "ntt",
-    "nyc",
-    "obi",
-    "observer",
-    "office",
-    "okinawa",
-    "olayan",
-    "olayangroup",
-    "oldnavy",
-    "ollo",
-    "omega",
-    "one",
-    "ong",
-    "onl",
-    "online",
-    "ooo",
-    "open",
-    "oracle",
-    "orange",
-    "organic",
-    "origins",
-    "osaka",
-    "otsuka",
-    "ott",
-    "ovh",
-    "page",
-    "panasonic",
-    "paris",
-    "pars",
-    "partners",
-    "parts",
-    "party",
-    "pay",
-    "pccw",
-    "pet",
-    "pfizer",
-    "pharmacy",
-    "phd",
-    "philips",
-    "phone",
-    "photo",
-    "photography",
-    "photos",
-    "physio",
-    "pics",
-    "pictet",
-    "pictures",
-    "pid",
-    "pin",
-    "ping",
-    "pink",
-    "pioneer",
-    "pizza",
-    "place",
-    "play",
-    "playstation",
-    "plumbing",
-    "plus",
-    "pnc",
-    "pohl",
-    "poker",
-    "politie",
-    "porn",
-    "pramerica",
-    "praxi",
-    "press",
-    "prime",
-    "prod",
-    "productions",
-    "prof",
-    "progressive",
-    "promo",
-    "properties",
-    "property",
-    "protection",
-    "pru",
-    "prudential",
-    "pub",
-    "pwc",
-    "qpon",
-    "quebec",
-    "quest",
-    "racing",
-    "radio",
-    "read",
-    "realestate",
-    "realtor",
-    "realty",
-    "recipes",
-    "red",
-    "redstone",
-    "redumbrella",
-    "rehab",
-    "reise",
-    "reisen",
-    "reit",
-    "reliance",
-    "ren",
-    "rent",
-    "rentals",
-    "repair",
-    "report",
-    "republican",
-    "rest",
-    "restaurant",
-    "review",
-    "reviews",
-    "rexroth",
-    "rich",
-    "richardli",
-    "ricoh",
-    "ril",
-    "rio",
-    "rip",
-    "rocher",
-    "rocks",
-    "rodeo",
-    "rogers",
-    "room",
-    "rsvp",
-    "rugby",
-    "ruhr",
-    "run",
-    "rwe",
-    "ryukyu",
-    "saarland",
-    "safe",
-    "safety",
-    "sakura",
-    "sale",
-    "salon",
-    "samsclub",
-    "samsung",
-    "sandvik",
-    "sandvikcoromant",
-    "sanofi",
-    "sap",
-    "sarl",
-    "sas",
-    "save",
-    "saxo",
-    "sbi",
-    "sbs",
-    "sca",
-    "scb",
-    "schaeffler",
-    "schmidt",
-    "scholarships",
-    "school",
-    "schule",
-    "schwarz",
-    "science",
-    "scot",
-    "search",
-    "seat",
-    "secure",
-    "security",
-    "seek",
-    "select",
-    "sener",
-    "services",
-    "seven",
-    "sew",
-    "sex",
-    "sexy",
-    "sfr",
-    "shangrila",
-    "sharp",
-    "shaw",
-    "shell",
-    "shia",
-    "shiksha",
-    "shoes",
-    "shop",
-    "shopping",
-    "shouji",
-    "show",
-    "showtime",
-    "silk",
-    "sina",
-    "singles",
-    "site",
-    "ski",
-    "skin",
-    "sky",
-    "skype",
-    "sling",
-    "smart",
-    "smile",
-    "sncf",
-    "soccer",
-    "social",
-    "softbank",
-    "software",
-    "sohu",
-    "solar",
-    "solutions",
-    "song",
-    "sony",
-    "soy",
-    "spa",
-    "space",
-    "sport",
-    "spot",
-    "srl",
-    "stada",
-    "staples",
-    "star",
-    "statebank",
-    "statefarm",
-    "stc",
-    "stcgroup",
-    "stockholm",
-    "storage",
-    "store",
-    "stream",
-    "studio",
-    "study",
-    "style",
-    "sucks",
-    "supplies",
-    "supply",
-    "support",
-    "surf",
-    "surgery",
-    "suzuki",
-    "swatch",
-    "swiss",
-    "sydney",
-    "systems",
-    "tab",
-    "taipei",
-    "talk",
-    "taobao",
-    "target",
-    "tatamotors",
-    "tatar",
-    "tattoo",
-    "tax",
-    "taxi",
-    "tci",
-    "tdk",
-    "team",
-    "tech",
-    "technology",
-    "temasek",
-    "tennis",
-    "teva",
-    "thd",
-    "theater",
-    "theatre",
-    "tiaa",
-    "tickets",
-    "tienda",
-    "tips",
-    "tires",
-    "tirol",
-    "tjmaxx",
-    "tjx",
-    "tkmaxx",
-    "tmall",
-    "today",
-    "tokyo",
-    "tools",
-    "top",
-    "toray",
-    "toshiba",
-    "total",
-    "tours",
-    "town",
-    "toyota",
-    "toys",
-    "trade",
-    "trading",
-    "training",
-    "travel",
-    "travelers",
-    "travelersinsurance",
-    "trust",
-    "trv",
-    "tube",
-    "tui",
-    "tunes",
-    "tushu",
-    "tvs",
-    "ubank",
-    "ubs",
-    "unicom",
-    "university",
-    "uno",
-    "uol",
-    "ups",
-    "vacations",
-    "vana",
-    "vanguard",
-    "vegas",
-    "ventures",
-    "verisign",
-    "versicherung",
-    "vet",
-    "viajes",
-    "video",
-    "vig",
-    "viking",
-    "villas",
-    "vin",
-    "vip",
-    "virgin",
-    "visa",
-    "vision",
-    "viva",
-    "vivo",
-    "vlaanderen",
-    "vodka",
-    "volkswagen",
-    "volvo",
-    "vote",
-    "voting",
-    "voto",
-    "voyage",
-    "wales",
-    "walmart",
-    "walter",
-    "wang",
-    "wanggou",
-    "watch",
-    "watches",
-    "weather",
-    "weatherchannel",
-    "webcam",
-    "weber",
-    "website",
-    "wedding",
-    "weibo",
-    "weir",
-    "whoswho",
-    "wien",
-    "wiki",
-    "williamhill",
-    "win",
-    "windows",
-    "wine",
-    "winners",
-    "wme",
-    "wolterskluwer",
-    "woodside",
-    "work",
-    "works",
-    "world",
-    "wow",
-    "wtc",
-    "wtf",
-    "xbox",
-    "xerox",
-    "xfinity",
-    "xihuan",
-    "xin",
-    "कॉम",
-    "セール",
-    "佛山",
-    "慈善",
-    "集团",
-    "在线",
-    "点看",
-    "คอม",
-    "八卦",
-    "موقع",
-    "公益",
-    "公司",
-    "香格里拉",
-    "网站",
-    "移动",
-    "我爱你",
-    "москва",
-    "католик",
-    "онлайн",
-    "сайт",
-    "联通",
-    "קום",
-    "时尚",
-    "微博",
-    "淡马锡",
-    "ファッション",
-    "орг",
-    "नेट",
-    "ストア",
-    "アマゾン",
-    "삼성",
-    "商标",
-    "商店",
-    "商城",
-    "дети",
-    "ポイント",
-    "新闻",
-    "家電",
-    "كوم",
-    "中文网",
-    "中信",
-    "娱乐",
-    "谷歌",
-    "電訊盈科",
-    "购物",
-    "クラウド",
-    "通販",
-    "网店",
-    "संगठन",
-    "餐厅",
-    "网络",
-    "ком",
-    "亚马逊",
-    "食品",
-    "飞利浦",
-    "手机",
-    "ارامكو",
-    "العليان",
-    "اتصالات",
-    "بازار",
-    "ابوظبي",
-    "كاثوليك",
-    "همراه",
-    "닷컴",
-    "政府",
-    "شبكة",
-    "بيتك",
-    "عرب",
-    "机构",
-    "组织机构",
-    "健康",
-    "招聘",
-    "рус",
-    "大拿",
-    "みんな",
-    "グーグル",
-    "世界",
-    "書籍",
-    "网址",
-    "닷넷",
-    "コム",
-    "天主教",
-    "游戏",
-    "vermögensberater",
-    "vermögensberatung",
-    "企业",
-    "信息",
-    "嘉里大酒店",
-    "嘉里",
-    "广东",
-    "政务",
-    "xyz",
-    "yachts",
-    "yahoo",
-    "yamaxun",
-    "yandex",
-    "yodobashi",
-    "yoga",
-    "yokohama",
-    "you",
-    "youtube",
-    "yun",
-    "zappos",
-    "zara",
-    "zero",
-    "zip",
-    "zone",
-    "zuerich",
-    "cc.ua",
-    "inf.ua",
-    "ltd.ua",
-    "611.to",
-    "graphox.us",
-    "*.devcdnaccesso.com",
-    "*.on-acorn.io",
-    "activetrail.biz",
-    "adobeaemcloud.com",
-    "*.dev.adobeaemcloud.com",
-    "hlx.live",
-    "adobeaemcloud.net",
-    "hlx.page",
-    "hlx3.page",
-    "adobeio-static.net",
-    "adobeioruntime.net",
-    "beep.pl",
-    "airkitapps.com",
-    "airkitapps-au.com",
-    "airkitapps.eu",
-    "aivencloud.com",
-    "akadns.net",
-    "akamai.net",
-    "akamai-staging.net",
-    "akamaiedge.net",
-    "akamaiedge-staging.net",
-    "akamaihd.net",
-    "akamaihd-staging.net",
-    "akamaiorigin.net",
-    "akamaiorigin-staging.net",
-    "akamaized.net",
-    "akamaized-staging.net",
-    "edgekey.net",
-    "edgekey-staging.net",
-    "edgesuite.net",
-    "edgesuite-staging.net",
-    "barsy.ca",
-    "*.compute.estate",
-    "*.alces.network",
-    "kasserver.com",
-    "altervista.org",
-    "alwaysdata.net",
-    "myamaze.net",
-    "cloudfront.net",
-    "*.compute.amazonaws.com",
-    "*.compute-1.amazonaws.com",
-    "*.compute.amazonaws.com.cn",
-    "us-east-1.amazonaws.com",
-    "s3.cn-north-1.amazonaws.com.cn",
-    "s3.dualstack.ap-northeast-1.amazonaws.com",
-    "s3.dualstack.ap-northeast-2.amazonaws.com",
-    "s3.ap-northeast-2.amazonaws.com",
-    "s3-website.ap-northeast-2.amazonaws.com",
-    "s3.dualstack.ap-south-1.amazonaws.com",
-    "s3.ap-south-1.amazonaws.com",
-    "s3-website.ap-south-1.amazonaws.com",
-    "s3.dualstack.ap-southeast-1.amazonaws.com",
-    "s3.dualstack.ap-southeast-2.amazonaws.com",
-    "s3.dualstack.ca-central-1.amazonaws.com",
-    "s3.ca-central-1.amazonaws.com",
-    "s3-website.ca-central-1.amazonaws.com",
-    "s3.dualstack.eu-central-1.amazonaws.com",
-    "s3.eu-central-1.amazonaws.com",
-    "s3-website.eu-central-1.amazonaws.com",
-    "s3.dualstack.eu-west-1.amazonaws.com",
-    "s3.dualstack.eu-west-2.amazonaws.com",
-    "s3.eu-west-2.amazonaws.com",
-    "s3-website.eu-west-2.amazonaws.com",
-    "s3.dualstack.eu-west-3.amazonaws.com",
-    "s3.eu-west-3.amazonaws.com",
-    "s3-website.eu-west-3.amazonaws.com",
-    "s3.amazonaws.com",
-    "s3-ap-northeast-1.amazonaws.com",
-    "s3-ap-northeast-2.amazonaws.com",
-    "s3-ap-south-1.amazonaws.com",
-    "s3-ap-southeast-1.amazonaws.com",
-    "s3-ap-southeast-2.amazonaws.com",
-    "s3-ca-central-1.amazonaws.com",
-    "s3-eu-central-1.amazonaws.com",
-    "s3-eu-west-1.amazonaws.com",
-    "s3-eu-west-2.amazonaws.com",
-    "s3-eu-west-3.amazonaws.com",
-    "s3-external-1.amazonaws.com",
-    "s3-fips-us-gov-west-1.amazonaws.com",
-    "s3-sa-east-1.amazonaws.com",
-    "s3-us-east-2.amazonaws.com",
-    "s3-us-gov-west-1.amazonaws.com",
-    "s3-us-west-1.amazonaws.com",
-    "s3-us-west-2.amazonaws.com",
-    "s3-website-ap-northeast-1.amazonaws.com",
-    "s3-website-ap-southeast-1.amazonaws.com",
-    "s3-website-ap-southeast-2.amazonaws.com",
-    "s3-website-eu-west-1.amazonaws.com",
-    "s3-website-sa-east-1.amazonaws.com",
-    "s3-website-us-east-1.amazonaws.com",
-    "s3-website-us-west-1.amazonaws.com",
-    "s3-website-us-west-2.amazonaws.com",
-    "s3.dualstack.sa-east-1.amazonaws.com",
-    "s3.dualstack.us-east-1.amazonaws.com",
-    "s3.dualstack.us-east-2.amazonaws.com",
-    "s3.us-east-2.amazonaws.com",
-    "s3-website.us-east-2.amazonaws.com",
-    "analytics-gateway.ap-northeast-1.amazonaws.com",
-    "analytics-gateway.eu-west-1.amazonaws.com",
-    "analytics-gateway.us-east-1.amazonaws.com",
-    "analytics-gateway.us-east-2.amazonaws.com",
-    "analytics-gateway.us-west-2.amazonaws.com",
-    "webview-assets.aws-cloud9.af-south-1.amazonaws.com",
-    "vfs.cloud9.af-south-1.amazonaws.com",
-    "webview-assets.cloud9.af-south-1.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-east-1.amazonaws.com",
-    "vfs.cloud9.ap-east-1.amazonaws.com",
-    "webview-assets.cloud9.ap-east-1.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-northeast-1.amazonaws.com",
-    "vfs.cloud9.ap-northeast-1.amazonaws.com",
-    "webview-assets.cloud9.ap-northeast-1.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-northeast-2.amazonaws.com",
-    "vfs.cloud9.ap-northeast-2.amazonaws.com",
-    "webview-assets.cloud9.ap-northeast-2.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-northeast-3.amazonaws.com",
-    "vfs.cloud9.ap-northeast-3.amazonaws.com",
-    "webview-assets.cloud9.ap-northeast-3.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-south-1.amazonaws.com",
-    "vfs.cloud9.ap-south-1.amazonaws.com",
-    "webview-assets.cloud9.ap-south-1.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-southeast-1.amazonaws.com",
-    "vfs.cloud9.ap-southeast-1.amazonaws.com",
-    "webview-assets.cloud9.ap-southeast-1.amazonaws.com",
-    "webview-assets.aws-cloud9.ap-southeast-2.amazonaws.com",
-    "vfs.cloud9.ap-southeast-2.amazonaws.com",
-    "webview-assets.cloud9.ap-southeast-2.amazonaws.com",
-    "webview-assets.aws-cloud9.ca-central-1.amazonaws.com",
-    "vfs.cloud9.ca-central-1.amazonaws.com",
-    "webview-assets.cloud9.ca-central-1.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-central-1.amazonaws.com",
-    "vfs.cloud9.eu-central-1.amazonaws.com",
-    "webview-assets.cloud9.eu-central-1.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-north-1.amazonaws.com",
-    "vfs.cloud9.eu-north-1.amazonaws.com",
-    "webview-assets.cloud9.eu-north-1.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-south-1.amazonaws.com",
-    "vfs.cloud9.eu-south-1.amazonaws.com",
-    "webview-assets.cloud9.eu-south-1.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-west-1.amazonaws.com",
-    "vfs.cloud9.eu-west-1.amazonaws.com",
-    "webview-assets.cloud9.eu-west-1.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-west-2.amazonaws.com",
-    "vfs.cloud9.eu-west-2.amazonaws.com",
-    "webview-assets.cloud9.eu-west-2.amazonaws.com",
-    "webview-assets.aws-cloud9.eu-west-3.amazonaws.com",
-    "vfs.cloud9.eu-west-3.amazonaws.com",
-    "webview-assets.cloud9.eu-west-3.amazonaws.com",
-    "webview-assets.aws-cloud9.me-south-1.amazonaws.com",
-    "vfs.cloud9.me-south-1.amazonaws.com",
-    "webview-assets.cloud9.me-south-1.amazonaws.com",
-    "webview-assets.aws-cloud9.sa-east-1.amazonaws.com",
-    "vfs.cloud9.sa-east-1.amazonaws.com",
-    "webview-assets.cloud9.sa-east-1.amazonaws.com",
-    "webview-assets.aws-cloud9.us-east-1.amazonaws.com",
-    "vfs.cloud9.us-east-1.amazonaws.com",
-    "webview-assets.cloud9.us-east-1.amazonaws.com",
-    "webview-assets.aws-cloud9.us-east-2.amazonaws.com",
-    "vfs.cloud9.us-east-2.amazonaws.com",
-    "webview-assets.cloud9.us-east-2.amazonaws.com",
-    "webview-assets.aws-cloud9.us-west-1.amazonaws.com",
-    "vfs.cloud9.us-west-1.amazonaws.com",
-    "webview-assets.cloud9.us-west-1.amazonaws.com",
-    "webview-assets.aws-cloud9.us-west-2.amazonaws.com",
-    "vfs.cloud9.us-west-2.amazonaws.com",
-    "webview-assets.cloud9.us-west-2.amazonaws.com",
-    "cn-north-1.eb.amazonaws.com.cn",
-    "cn-northwest-1.eb.amazonaws.com.cn",
-    "elasticbeanstalk.com",
-    "ap-northeast-1.elasticbeanstalk.com",
-    "ap-northeast-2.elasticbeanstalk.com",
-    "ap-northeast-3.elasticbeanstalk.com",
-    "ap-south-1.elasticbeanstalk.com",
-    "ap-southeast-1.elasticbeanstalk.com",
-    "ap-southeast-2.elasticbeanstalk.com",
-    "ca-central-1.elasticbeanstalk.com",
-    "eu-central-1.elasticbeanstalk.com",
-    "eu-west-1.elasticbeanstalk.com",
-    "eu-west-2.elasticbeanstalk.com",
-    "eu-west-3.elasticbeanstalk.com",
-    "sa-east-1.elasticbeanstalk.com",
-    "us-east-1.elasticbeanstalk.com",
-    "us-east-2.elasticbeanstalk.com",
-    "us-gov-west-1.elasticbeanstalk.com",
-    "us-west-1.elasticbeanstalk.com",
-    "us-west-2.elasticbeanstalk.com",
-    "*.elb.amazonaws.com.cn",
-    "*.elb.amazonaws.com",
-    "awsglobalaccelerator.com",
-    "eero.online",
-    "eero-stage.online",
-    "t3l3p0rt.net",
-    "tele.amune.org",
-    "apigee.io",
-    "siiites.com",
-    "appspacehosted.com",
-    "appspaceusercontent.com",
-    "appudo.net",
-    "on-aptible.com",
-    "user.aseinet.ne.jp",
-    "gv.vc",
-    "d.gv.vc",
-    "user.party.eus",
-    "pimienta.org",
-    "poivron.org",
-    "potager.org",
-    "sweetpepper.org",
-    "myasustor.com",
-    "cdn.prod.atlassian-dev.net",
-    "translated.page",
-    "autocode.dev",
-    "myfritz.net",
-    "onavstack.net",
-    "*.awdev.ca",
-    "*.advisor.ws",
-    "ecommerce-shop.pl",
-    "b-data.io",
-    "backplaneapp.io",
-    "balena-devices.com",
-    "rs.ba",
-    "*.banzai.cloud",
-    "app.banzaicloud.io",
-    "*.backyards.banzaicloud.io",
-    "base.ec",
-    "official.ec",
-    "buyshop.jp",
-    "fashionstore.jp",
-    "handcrafted.jp",
-    "kawaiishop.jp",
-    "supersale.jp",
-    "theshop.jp",
-    "shopselect.net",
-    "base.shop",
-    "beagleboard.io",
-    "*.beget.app",
-    "betainabox.com",
-    "bnr.la",
-    "bitbucket.io",
-    "blackbaudcdn.net",
-    "of.je",
-    "bluebite.io",
-    "boomla.net",
-    "boutir.com",
-    "boxfuse.io",
-    "square7.ch",
-    "bplaced.com",
-    "bplaced.de",
-    "square7.de",
-    "bplaced.net",
-    "square7.net",
-    "shop.brendly.rs",
-    "browsersafetymark.io",
-    "uk0.bigv.io",
-    "dh.bytemark.co.uk",
-    "vm.bytemark.co.uk",
-    "cafjs.com",
-    "mycd.eu",
-    "canva-apps.cn",
-    "canva-apps.com",
-    "drr.ac",
-    "uwu.ai",
-    "carrd.co",
-    "crd.co",
-    "ju.mp",
-    "ae.org",
-    "br.com",
-    "cn.com",
-    "com.de",
-    "com.se",
-    "de.com",
-    "eu.com",
-    "gb.net",
-    "hu.net",
-    "jp.net",
-    "jpn.com",
-    "mex.com",
-    "ru.com",
-    "sa.com",
-    "se.net",
-    "uk.com",
-    "uk.net",
-    "us.com",
-    "za.bz",
-    "za.com",
-    "ar.com",
-    "hu.com",
-    "kr.com",
-    "no.com",
-    "qc.com",
-    "uy.com",
-    "africa.com",
-    "gr.com",
-    "in.net",
-    "web.in",
-    "us.org",
-    "co.com",
-    "aus.basketball",
-    "nz.basketball",
-    "radio.am",
-    "radio.fm",
-    "c.la",
-    "certmgr.org",
-    "cx.ua",
-    "discourse.group",
-    "discourse.team",
-    "cleverapps.io",
-    "clerk.app",
-    "clerkstage.app",
-    "*.lcl.dev",
-    "*.lclstage.dev",
-    "*.stg.dev",
-    "*.stgstage.dev",
-    "clickrising.net",
-    "c66.me",
-    "cloud66.ws",
-    "cloud66.zone",
-    "jdevcloud.com",
-    "wpdevcloud.com",
-    "cloudaccess.host",
-    "freesite.host",
-    "cloudaccess.net",
-    "cloudcontrolled.com",
-    "cloudcontrolapp.com",
-    "*.cloudera.site",
-    "cf-ipfs.com",
-    "cloudflare-ipfs.com",
-    "trycloudflare.com",
-    "pages.dev",
-    "r2.dev",
-    "workers.dev",
-    "wnext.app",
-    "co.ca",
-    "*.otap.co",
-    "co.cz",
-    "c.cdn77.org",
-    "cdn77-ssl.net",
-    "r.cdn77.net",
-    "rsc.cdn77.org",
-    "ssl.origin.cdn77-secure.org",
-    "cloudns.asia",
-    "cloudns.biz",
-    "cloudns.club",
-    "cloudns.cc",
-    "cloudns.eu",
-    "cloudns.in",
-    "cloudns.info",
-    "cloudns.org",
-    "cloudns.pro",
-    "cloudns.pw",
-    "cloudns.us",
-    "cnpy.gdn",
-    "codeberg.page",
-    "co.nl",
-    "co.no",
-    "webhosting.be",
-    "hosting-cluster.nl",
-    "ac.ru",
-    "edu.ru",
-    "gov.ru",
-    "int.ru",
-    "mil.ru",
-    "test.ru",
-    "dyn.cosidns.de",
-    "dynamisches-dns.de",
-    "dnsupdater.de",
-    "internet-dns.de",
-    "l-o-g-i-n.de",
-    "dynamic-dns.info",
-    "feste-ip.net",
-    "knx-server.net",
-    "static-access.net",
-    "realm.cz",
-    "*.cryptonomic.net",
-    "cupcake.is",
-    "curv.dev",
-    "*.customer-oci.com",
-    "*.oci.customer-oci.com",
-    "*.ocp.customer-oci.com",
-    "*.ocs.customer-oci.com",
-    "cyon.link",
-    "cyon.site",
-    "fnwk.site",
-    "folionetwork.site",
-    "platform0.app",
-    "daplie.me",
-    "localhost.daplie.me",
-    "dattolocal.com",
-    "dattorelay.com",
-    "dattoweb.com",
-    "mydatto.com",
-    "dattolocal.net",
-    "mydatto.net",
-    "biz.dk",
-    "co.dk",
-    "firm.dk",
-    "reg.dk",
-    "store.dk",
-    "dyndns.dappnode.io",
-    "*.dapps.earth",
-    "*.bzz.dapps.earth",
-    "builtwithdark.com",
-    "demo.datadetect.com",
-    "instance.datadetect.com",
-    "edgestack.me",
-    "ddns5.com",
-    "debian.net",
-    "deno.dev",
-    "deno-staging.dev",
-    "dedyn.io",
-    "deta.app",
-    "deta.dev",
-    "*.rss.my.id",
-    "*.diher.solutions",
-    "discordsays.com",
-    "discordsez.com",
-    "jozi.biz",
-    "dnshome.de",
-    "online.th",
-    "shop.th",
-    "drayddns.com",
-    "shoparena.pl",
-    "dreamhosters.com",
-    "mydrobo.com",
-    "drud.io",
-    "drud.us",
-    "duckdns.org",
-    "bip.sh",
-    "bitbridge.net",
-    "dy.fi",
-    "tunk.org",
-    "dyndns-at-home.com",
-    "dyndns-at-work.com",
-    "dyndns-blog.com",
-    "dyndns-free.com",
-    "dyndns-home.com",
-    "dyndns-ip.com",
-    "dyndns-mail.com",
-    "dyndns-office.com",
-    "dyndns-pics.com",
-    "dyndns-remote.com",
-    "dyndns-server.com",
-    "dyndns-web.com",
-    "dyndns-wiki.com",
-    "dyndns-work.com",
-    "dyndns.biz",
-    "dyndns.info",
-    "dyndns.org",
-    "dyndns.tv",
-    "at-band-camp.net",
-    "ath.cx",
-    "barrel-of-knowledge.info",
-    "barrell-of-knowledge.info",
-    "better-than.tv",
-    "blogdns.com",
-    "blogdns.net",
-    "blogdns.org",
-    "blogsite.org",
-    "boldlygoingnowhere.org",
-    "broke-it.net",
-    "buyshouses.net",
-    "cechire.com",
-    "dnsalias.com",
-    "dnsalias.net",
-    "dnsalias.org",
-    "dnsdojo.com",
-    "dnsdojo.net",
-    "dnsdojo.org",
-    "does-it.net",
-    "doesntexist.com",
-    "doesntexist.org",
-    "dontexist.com",
-    "dontexist.net",
-    "dontexist.org",
-    "doomdns.com",
-    "doomdns.org",
-    "dvrdns.org",
-    "dyn-o-saur.com",
-    "dynalias.com",
-    "dynalias.net",
-    "dynalias.org",
-    "dynathome.net",
-    "dyndns.ws",
-    "endofinternet.net",
-    "endofinternet.org",
-    "endoftheinternet.org",
-    "est-a-la-maison.com",
-    "est-a-la-masion.com",
-    "est-le-patron.com",
-    "est-mon-blogueur.com",
-    "for-better.biz",
-    "for-more.biz",
-    "for-our.info",
-    "for-some.biz",
-    "for-the.biz",
-    "forgot.her.name",
-    "forgot.his.name",
-    "from-ak.com",
-    "from-al.com",
-    "from-ar.com",
-    "from-az.net",
-    "from-ca.com",
-    "from-co.net",
-    "from-ct.com",
-    "from-dc.com",
-    "from-de.com",
-    "from-fl.com",
-    "from-ga.com",
-    "from-hi.com",
-    "from-ia.com",
-    "from-id.com",
-    "from-il.com",
-    "from-in.com",
-    "from-ks.com",
-    "from-ky.com",
-    "from-la.net",
-    "from-ma.com",
-    "from-md.com",
-    "from-me.org",
-    "from-mi.com",
-    "from-mn.com",
-    "from-mo.com",
-    "from-ms.com",
-    "from-mt.com",
-    "from-nc.com",
-    "from-nd.com",
-    "from-ne.com",
-    "from-nh.com",
-    "from-nj.com",
-    "from-nm.com",
-    "from-nv.com",
-    "from-ny.net",
-    "from-oh.com",
-    "from-ok.com",
-    "from-or.com",
-    "from-pa.com",
-    "from-pr.com",
-    "from-ri.com",
-    "from-sc.com",
-    "from-sd.com",
-    "from-tn.com",
-    "from-tx.com",
-    "from-ut.com",
-    "from-va.com",
-    "from-vt.com",
-    "from-wa.com",
-    "from-wi.com",
-    "from-wv.com",
-    "from-wy.com",
-    "ftpaccess.cc",
-    "fuettertdasnetz.de",
-    "game-host.org",
-    "game-server.cc",
-    "getmyip.com",
-    "gets-it.net",
-    "go.dyndns.org",
-    "gotdns.com",
-    "gotdns.org",
-    "groks-the.info",
-    "groks-this.info",
-    "ham-radio-op.net",
-    "here-for-more.info",
-    "hobby-site.com",
-    "hobby-site.org",
-    "home.dyndns.org",
-    "homedns.org",
-    "homeftp.net",
-    "homeftp.org",
-    "homeip.net",
-    "homelinux.com",
-    "homelinux.net",
-    "homelinux.org",
-    "homeunix.com",
-    "homeunix.net",
-    "homeunix.org",
-    "iamallama.com",
-    "in-the-band.net",
-    "is-a-anarchist.com",
-    "is-a-blogger.com",
-    "is-a-bookkeeper.com",
-    "is-a-bruinsfan.org",
-    "is-a-bulls-fan.com",
-    "is-a-candidate.org",
-    "is-a-caterer.com",
-    "is-a-celticsfan.org",
-    "is-a-chef.com",
-    "is-a-chef.net",
-    "is-a-chef.org",
-    "is-a-conservative.com",
-    "is-a-cpa.com",
-    "is-a-cubicle-slave.com",
-    "is-a-democrat.com",
-    "is-a-designer.com",
-    "is-a-doctor.com",
-    "is-a-financialadvisor.com",
-    "is-a-geek.com",
-    "is-a-geek.net",
-    "is-a-geek.org",
-    "is-a-green.com",
-    "is-a-guru.com",
-    "is-a-hard-worker.com",
-    "is-a-hunter.com",
-    "is-a-knight.org",
-    "is-a-landscaper.com",
-    "is-a-lawyer.com",
-    "is-a-liberal.com",
-    "is-a-libertarian.com",
-    "is-a-linux-user.org",
-    "is-a-llama.com",
-    "is-a-musician.com",
-    "is-a-nascarfan.com",
-    "is-a-nurse.com",
-    "is-a-painter.com",
-    "is-a-patsfan.org",
-    "is-a-personaltrainer.com",
-    "is-a-photographer.com",
-    "is-a-player.com",
-    "is-a-republican.com",
-    "is-a-rockstar.com",
-    "is-a-socialist.com",
-    "is-a-soxfan.org",
-    "is-a-student.com",
-    "is-a-teacher.com",
-    "is-a-techie.com",
-    "is-a-therapist.com",
-    "is-an-accountant.com",
-    "is-an-actor.com",
-    "is-an-actress.com",
-    "is-an-anarchist.com",
-    "is-an-artist.com",
-    "is-an-engineer.com",
-    "is-an-entertainer.com",
-    "is-by.us",
-    "is-certified.com",
-    "is-found.org",
-    "is-gone.com",
-    "is-into-anime.com",
-    "is-into-cars.com",
-    "is-into-cartoons.com",
-    "is-into-games.com",
-    "is-leet.com",
-    "is-lost.org",
-    "is-not-certified.com",
-    "is-saved.org",
-    "is-slick.com",
-    "is-uberleet.com",
-    "is-very-bad.org",
-    "is-very-evil.org",
-    "is-very-good.org",
-    "is-very-nice.org",
-    "is-very-sweet.org",
-    "is-with-theband.com",
-    "isa-geek.com",
-    "isa-geek.net",
-    "isa-geek.org",
-    "isa-hockeynut.com",
-    "issmarterthanyou.com",
-    "isteingeek.de",
-    "istmein.de",
-    "kicks-ass.net",
-    "kicks-ass.org",
-    "knowsitall.info",
-    "land-4-sale.us",
-    "lebtimnetz.de",
-    "leitungsen.de",
-    "likes-pie.com",
-    "likescandy.com",
-    "merseine.nu",
-    "mine.nu",
-    "misconfused.org",
-    "mypets.ws",
-    "myphotos.cc",
-    "neat-url.com",
-    "office-on-the.net",
-    "on-the-web.tv",
-    "podzone.net",
-    "podzone.org",
-    "readmyblog.org",
-    "saves-the-whales.com",
-    "scrapper-site.net",
-    "scrapping.cc",
-    "selfip.biz",
-    "selfip.com",
-    "selfip.info",
-    "selfip.net",
-    "selfip.org",
-    "sells-for-less.com",
-    "sells-for-u.com",
-    "sells-it.net",
-    "sellsyourhome.org",
-    "servebbs.com",
-    "servebbs.net",
-    "servebbs.org",
-    "serveftp.net",
-    "serveftp.org",
-    "servegame.org",
-    "shacknet.nu",
-    "simple-url.com",
-    "space-to-rent.com",
-    "stuff-4-sale.org",
-    "stuff-4-sale.us",
-    "teaches-yoga.com",
-    "thruhere.net",
-    "traeumtgerade.de",
-    "webhop.biz",
-    "webhop.info",
-    "webhop.net",
-    "webhop.org",
-    "worse-than.tv",
-    "writesthisblog.com",
-    "ddnss.de",
-    "dyn.ddnss.de",
-    "dyndns.ddnss.de",
-    "dyndns1.de",
-    "dyn-ip24.de",
-    "home-webserver.de",
-    "dyn.home-webserver.de",
-    "myhome-server.de",
-    "ddnss.org",
-    "definima.net",
-    "definima.io",
-    "ondigitalocean.app",
-    "*.digitaloceanspaces.com",
-    "bci.dnstrace.pro",
-    "ddnsfree.com",
-    "ddnsgeek.com",
-    "giize.com",
-    "gleeze.com",
-    "kozow.com",
-    "loseyourip.com",
-    "ooguy.com",
-    "theworkpc.com",
-    "casacam.net",
-    "dynu.net",
-    "accesscam.org",
-    "camdvr.org",
-    "freeddns.org",
-    "mywire.org",
-    "webredirect.org",
-    "myddns.rocks",
-    "blogsite.xyz",
-    "dynv6.net",
-    "e4.cz",
-    "easypanel.app",
-    "easypanel.host",
-    "elementor.cloud",
-    "elementor.cool",
-    "en-root.fr",
-    "mytuleap.com",
-    "tuleap-partners.com",
-    "encr.app",
-    "encoreapi.com",
-    "onred.one",
-    "staging.onred.one",
-    "eu.encoway.cloud",
-    "eu.org",
-    "al.eu.org",
-    "asso.eu.org",
-    "at.eu.org",
-    "au.eu.org",
-    "be.eu.org",
-    "bg.eu.org",
-    "ca.eu.org",
-    "cd.eu.org",
-    "ch.eu.org",
-    "cn.eu.org",
-    "cy.eu.org",
-    "cz.eu.org",
-    "de.eu.org",
-    "dk.eu.org",
-    "edu.eu.org",
-    "ee.eu.org",
-    "es.eu.org",
-    "fi.eu.org",
-    "fr.eu.org",
-    "gr.eu.org",
-    "hr.eu.org",
-    "hu.eu.org",
-    "ie.eu.org",
-    "il.eu.org",
-    "in.eu.org",
-    "int.eu.org",
-    "is.eu.org",
-    "it.eu.org",
-    "jp.eu.org",
-    "kr.eu.org",
-    "lt.eu.org",
-    "lu.eu.org",
-    "lv.eu.org",
-    "mc.eu.org",
-    "me.eu.org",
-    "mk.eu.org",
-    "mt.eu.org",
-    "my.eu.org",
-    "net.eu.org",
-    "ng.eu.org",
-    "nl.eu.org",
-    "no.eu.org",
-    "nz.eu.org",
-    "paris.eu.org",
-    "pl.eu.org",
-    "pt.eu.org",
-    "q-a.eu.org",
-    "ro.eu.org",
-    "ru.eu.org",
-    "se.eu.org",
-    "si.eu.org",
-    "sk.eu.org",
-    "tr.eu.org",
-    "uk.eu.org",
-    "us.eu.org",
-    "eurodir.ru",
-    "eu-1.evennode.com",
-    "eu-2.evennode.com",
-    "eu-3.evennode.com",
-    "eu-4.evennode.com",
-    "us-1.evennode.com",
-    "us-2.evennode.com",
-    "us-3.evennode.com",
-    "us-4.evennode.com",
-    "twmail.cc",
-    "twmail.net",
-    "twmail.org",
-    "mymailer.com.tw",
-    "url.tw",
-    "onfabrica.com",
-    "apps.fbsbx.com",
-    "ru.net",
-    "adygeya.ru",
-    "bashkiria.ru",
-    "bir.ru",
-    "cbg.ru",
-    "com.ru",
-    "dagestan.ru",
-    "grozny.ru",
-    "kalmykia.ru",
-    "kustanai.ru",
-    "marine.ru",
-    "mordovia.ru",
-    "msk.ru",
-    "mytis.ru",
-    "nalchik.ru",
-    "nov.ru",
-    "pyatigorsk.ru",
-    "spb.ru",
-    "vladikavkaz.ru",
-    "vladimir.ru",
-    "abkhazia.su",
-    "adygeya.su",
-    "aktyubinsk.su",
-    "arkhangelsk.su",
-    "armenia.su",
-    "ashgabad.su",
-    "azerbaijan.su",
-    "balashov.su",
-    "bashkiria.su",
-    "bryansk.su",
-    "bukhara.su",
-    "chimkent.su",
-    "dagestan.su",
-    "east-kazakhstan.su",
-    "exnet.su",
-    "georgia.su",
-    "grozny.su",
-    "ivanovo.su",
-    "jambyl.su",
-    "kalmykia.su",
-    "kaluga.su",
-    "karacol.su",
-    "karaganda.su",
-    "karelia.su",
-    "khakassia.su",
-    "krasnodar.su",
-    "kurgan.su",
-    "kustanai.su",
-    "lenug.su",
-    "mangyshlak.su",
-    "mordovia.su",
-    "msk.su",
-    "murmansk.su",
-    "nalchik.su",
-    "navoi.su",
-    "north-kazakhstan.su",
-    "nov.su",
-    "obninsk.su",
-    "penza.su",
-    "pokrovsk.su",
-    "sochi.su",
-    "spb.su",
-    "tashkent.su",
-    "termez.su",
-    "togliatti.su",
-    "troitsk.su",
-    "tselinograd.su",
-    "tula.su",
-    "tuva.su",
-    "vladikavkaz.su",
-    "vladimir.su",
-    "vologda.su",
-    "channelsdvr.net",
-    "u.channelsdvr.net",
-    "edgecompute.app",
-    "fastly-edge.com",
-    "fastly-terrarium.com",
-    "fastlylb.net",
-    "map.fastlylb.net",
-    "freetls.fastly.net",
-    "map.fastly.net",
-    "a.prod.fastly.net",
-    "global.prod.fastly.net",
-    "a.ssl.fastly.net",
-    "b.ssl.fastly.net",
-    "global.ssl.fastly.net",
-    "*.user.fm",
-    "fastvps-server.com",
-    "fastvps.host",
-    "myfast.host",
-    "fastvps.site",
-    "myfast.space",
-    "fedorainfracloud.org",
-    "fedorapeople.org",
-    "cloud.fedoraproject.org",
-    "app.os.fedoraproject.org",
-    "app.os.stg.fedoraproject.org",
-    "conn.uk",
-    "copro.uk",
-    "hosp.uk",
-    "mydobiss.com",
-    "fh-muenster.io",
-    "filegear.me",
-    "filegear-au.me",
-    "filegear-de.me",
-    "filegear-gb.me",
-    "filegear-ie.me",
-    "filegear-jp.me",
-    "filegear-sg.me",
-    "firebaseapp.com",
-    "fireweb.app",
-    "flap.id",
-    "onflashdrive.app",
-    "fldrv.com",
-    "fly.dev",
-    "edgeapp.net",
-    "shw.io",
-    "flynnhosting.net",
-    "forgeblocks.com",
-    "id.forgerock.io",
-    "framer.app",
-    "framercanvas.com",
-    "framer.media",
-    "framer.photos",
-    "framer.website",
-    "framer.wiki",
-    "*.frusky.de",
-    "ravpage.co.il",
-    "0e.vc",
-    "freebox-os.com",
-    "freeboxos.com",
-    "fbx-os.fr",
-    "fbxos.fr",
-    "freebox-os.fr",
-    "freeboxos.fr",
-    "freedesktop.org",
-    "freemyip.com",
-    "wien.funkfeuer.at",
-    "*.futurecms.at",
-    "*.ex.futurecms.at",
-    "*.in.futurecms.at",
-    "futurehosting.at",
-    "futuremailing.at",
-    "*.ex.ortsinfo.at",
-    "*.kunden.ortsinfo.at",
-    "*.statics.cloud",
-    "independent-commission.uk",
-    "independent-inquest.uk",
-    "independent-inquiry.uk",
-    "independent-panel.uk",
-    "independent-review.uk",
-    "public-inquiry.uk",
-    "royal-commission.uk",
-    "campaign.gov.uk",
-    "service.gov.uk",
-    "api.gov.uk",
-    "gehirn.ne.jp",
-    "usercontent.jp",
-    "gentapps.com",
-    "gentlentapis.com",
-    "lab.ms",
-    "cdn-edges.net",
-    "ghost.io",
-    "gsj.bz",
-    "githubusercontent.com",
-    "githubpreview.dev",
-    "github.io",
-    "gitlab.io",
-    "gitapp.si",
-    "gitpage.si",
-    "glitch.me",
-    "nog.community",
-    "co.ro",
-    "shop.ro",
-    "lolipop.io",
-    "angry.jp",
-    "babyblue.jp",
-    "babymilk.jp",
-    "backdrop.jp",
-    "bambina.jp",
-    "bitter.jp",
-    "blush.jp",
-    "boo.jp",
-    "boy.jp",
-    "boyfriend.jp",
-    "but.jp",
-    "candypop.jp",
-    "capoo.jp",
-    "catfood.jp",
-    "cheap.jp",
-    "chicappa.jp",
-    "chillout.jp",
-    "chips.jp",
-    "chowder.jp",
-    "chu.jp",
-    "ciao.jp",
-    "cocotte.jp",
-    "coolblog.jp",
-    "cranky.jp",
-    "cutegirl.jp",
-    "daa.jp",
-    "deca.jp",
-    "deci.jp",
-    "digick.jp",
-    "egoism.jp",
-    "fakefur.jp",
-    "fem.jp",
-    "flier.jp",
-    "floppy.jp",
-    "fool.jp",
-    "frenchkiss.jp",
-    "girlfriend.jp",
-    "girly.jp",
-    "gloomy.jp",
-    "gonna.jp",
-    "greater.jp",
-    "hacca.jp",
-    "heavy.jp",
-    "her.jp",
-    "hiho.jp",
-    "hippy.jp",
-    "holy.jp",
-    "hungry.jp",
-    "icurus.jp",
-    "itigo.jp",
-    "jellybean.jp",
-    "kikirara.jp",
-    "kill.jp",
-    "kilo.jp",
-    "kuron.jp",
-    "littlestar.jp",
-    "lolipopmc.jp",
-    "lolitapunk.jp",
-    "lomo.jp",
-    "lovepop.jp",
-    "lovesick.jp",
-    "main.jp",
-    "mods.jp",
-    "mond.jp",
-    "mongolian.jp",
-    "moo.jp",
-    "namaste.jp",
-    "nikita.jp",
-    "nobushi.jp",
-    "noor.jp",
-    "oops.jp",
-    "parallel.jp",
-    "parasite.jp",
-    "pecori.jp",
-    "peewee.jp",
-    "penne.jp",
-    "pepper.jp",
-    "perma.jp",
-    "pigboat.jp",
-    "pinoko.jp",
-    "punyu.jp",
-    "pupu.jp",
-    "pussycat.jp",
-    "pya.jp",
-    "raindrop.jp",
-    "readymade.jp",
-    "sadist.jp",
-    "schoolbus.jp",
-    "secret.jp",
-    "staba.jp",
-    "stripper.jp",
-    "sub.jp",
-    "sunnyday.jp",
-    "thick.jp",
-    "tonkotsu.jp",
-    "under.jp",
-    "upper.jp",
-    "velvet.jp",
-    "verse.jp",
-    "versus.jp",
-    "vivian.jp",
-    "watson.jp",
-    "weblike.jp",
-    "whitesnow.jp",
-    "zombie.jp",
-    "heteml.net",
-    "cloudapps.digital",
-    "london.cloudapps.digital",
-    "pymnt.uk",
-    "homeoffice.gov.uk",
-    "ro.im",
-    "goip.de",
-    "run.app",
-    "a.run.app",
-    "web.app",
-    "*.0emm.com",
-    "appspot.com",
-    "*.r.appspot.com",
-    "codespot.com",
-    "googleapis.com",
-    "googlecode.com",
-    "pagespeedmobilizer.com",
-    "publishproxy.com",
-    "withgoogle.com",
-    "withyoutube.com",
-    "*.gateway.dev",
-    "cloud.goog",
-    "translate.goog",
-    "*.usercontent.goog",
-    "cloudfunctions.net",
-    "blogspot.ae",
-    "blogspot.al",
-    "blogspot.am",
-    "blogspot.ba",
-    "blogspot.be",
-    "blogspot.bg",
-    "blogspot.bj",
-    "blogspot.ca",
-    "blogspot.cf",
-    "blogspot.ch",
-    "blogspot.cl",
-    "blogspot.co.at",
-    "blogspot.co.id",
-    "blogspot.co.il",
-    "blogspot.co.ke",
-    "blogspot.co.nz",
-    "blogspot.co.uk",
-    "blogspot.co.za",
-    "blogspot.com",
-    "blogspot.com.ar",
-    "blogspot.com.au",
-    "blogspot.com.br",
-    "blogspot.com.by",
-    "blogspot.com.co",
-    "blogspot.com.cy",
-    "blogspot.com.ee",
-    "blogspot.com.eg",
-    "blogspot.com.es",
-    "blogspot.com.mt",
-    "blogspot.com.ng",
-    "blogspot.com.tr",
-    "blogspot.com.uy",
-    "blogspot.cv",
-    "blogspot.cz",
-    "blogspot.de",
-    "blogspot.dk",
-    "blogspot.fi",
-    "blogspot.fr",
-    "blogspot.gr",
-    "blogspot.hk",
-    "blogspot.hr",
-    "blogspot.hu",
-    "blogspot.ie",
-    "blogspot.in",
-    "blogspot.is",
-    "blogspot.it",
-    "blogspot.jp",
-    "blogspot.kr",
-    "blogspot.li",
-    "blogspot.lt",
-    "blogspot.lu",
-    "blogspot.md",
-    "blogspot.mk",
-    "blogspot.mr",
-    "blogspot.mx",
-    "blogspot.my",
-    "blogspot.nl",
-    "blogspot.no",
-    "blogspot.pe",
-    "blogspot.pt",
-    "blogspot.qa",
-    "blogspot.re",
-    "blogspot.ro",
-    "blogspot.rs",
-    "blogspot.ru",
-    "blogspot.se",
-    "blogspot.sg",
-    "blogspot.si",
-    "blogspot.sk",
-    "blogspot.sn",
-    "blogspot.td",
-    "blogspot.tw",
-    "blogspot.ug",
-    "blogspot.vn",
-    "goupile.fr",
-    "gov.nl",
-    "awsmppl.com",
-    "günstigbestellen.de",
-    "günstigliefern.de",
-    "fin.ci",
-    "free.hr",
-    "caa.li",
-    "ua.rs",
-    "conf.se",
-    "hs.zone",
-    "hs.run",
-    "hashbang.sh",
-    "hasura.app",
-    "hasura-app.io",
-    "pages.it.hs-heilbronn.de",
-    "hepforge.org",
-    "herokuapp.com",
-    "herokussl.com",
-    "ravendb.cloud",
-    "ravendb.community",
-    "ravendb.me",
-    "development.run",
-    "ravendb.run",
-    "homesklep.pl",
-    "secaas.hk",
-    "hoplix.shop",
-    "orx.biz",
-    "biz.gl",
-    "col.ng",
-    "firm.ng",
-    "gen.ng",
-    "ltd.ng",
-    "ngo.ng",
-    "edu.scot",
-    "sch.so",
-    "ie.ua",
-    "hostyhosting.io",
-    "häkkinen.fi",
-    "*.moonscale.io",
-    "moonscale.net",
-    "iki.fi",
-    "ibxos.it",
-    "iliadboxos.it",
-    "impertrixcdn.com",
-    "impertrix.com",
-    "smushcdn.com",
-    "wphostedmail.com",
-    "wpmucdn.com",
-    "tempurl.host",
-    "wpmudev.host",
-    "dyn-berlin.de",
-    "in-berlin.de",
-    "in-brb.de",
-    "in-butter.de",
-    "in-dsl.de",
-    "in-dsl.net",
-    "in-dsl.org",
-    "in-vpn.de",
-    "in-vpn.net",
-    "in-vpn.org",
-    "biz.at",
-    "info.at",
-    "info.cx",
-    "ac.leg.br",
-    "al.leg.br",
-    "am.leg.br",
-    "ap.leg.br",
-    "ba.leg.br",
-    "ce.leg.br",
-    "df.leg.br",
-    "es.leg.br",
-    "go.leg.br",
-    "ma.leg.br",
-    "mg.leg.br",
-    "ms.leg.br",
-    "mt.leg.br",
-    "pa.leg.br",
-    "pb.leg.br",
-    "pe.leg.br",
-    "pi.leg.br",
-    "pr.leg.br",
-    "rj.leg.br",
-    "rn.leg.br",
-    "ro.leg.br",
-    "rr.leg.br",
-    "rs.leg.br",
-    "sc.leg.br",
-    "se.leg.br",
-    "sp.leg.br",
-    "to.leg.br",
-    "pixolino.com",
-    "na4u.ru",
-    "iopsys.se",
-    "ipifony.net",
-    "iservschule.de",
-    "mein-iserv.de",
-    "schulplattform.de",
-    "schulserver.de",
-    "test-iserv.de",
-    "iserv.dev",
-    "iobb.net",
-    "mel.cloudlets.com.au",
-    "cloud.interhostsolutions.be",
-    "mycloud.by",
-    "alp1.ae.flow.ch",
-    "appengine.flow.ch",
-    "es-1.axarnet.cloud",
-    "diadem.cloud",
-    "vip.jelastic.cloud",
-    "jele.cloud",
-    "it1.eur.aruba.jenv-aruba.cloud",
-    "it1.jenv-aruba.cloud",
-    "keliweb.cloud",
-    "cs.keliweb.cloud",
-    "oxa.cloud",
-    "tn.oxa.cloud",
-    "uk.oxa.cloud",
-    "primetel.cloud",
-    "uk.primetel.cloud",
-    "ca.reclaim.cloud",
-    "uk.reclaim.cloud",
-    "us.reclaim.cloud",
-    "ch.trendhosting.cloud",
-    "de.trendhosting.cloud",
-    "jele.club",
-    "amscompute.com",
-    "dopaas.com",
-    "paas.hosted-by-previder.com",
-    "rag-cloud.hosteur.com",
-    "rag-cloud-ch.hosteur.com",
-    "jcloud.ik-server.com",
-    "jcloud-ver-jpc.ik-server.com",
-    "demo.jelastic.com",
-    "kilatiron.com",
-    "paas.massivegrid.com",
-    "jed.wafaicloud.com",
-    "lon.wafaicloud.com",
-    "ryd.wafaicloud.com",
-    "j.scaleforce.com.cy",
-    "jelastic.dogado.eu",
-    "fi.cloudplatform.fi",
-    "demo.datacenter.fi",
-    "paas.datacenter.fi",
-    "jele.host",
-    "mircloud.host",
-    "paas.beebyte.io",
-    "sekd1.beebyteapp.io",
-    "jele.io",
-    "cloud-fr1.unispace.io",
-    "jc.neen.it",
-    "cloud.jelastic.open.tim.it",
-    "jcloud.kz",
-    "upaas.kazteleport.kz",
-    "cloudjiffy.net",
-    "fra1-de.cloudjiffy.net",
-    "west1-us.cloudjiffy.net",
-    "jls-sto1.elastx.net",
-    "jls-sto2.elastx.net",
-    "jls-sto3.elastx.net",
-    "faststacks.net",
-    "fr-1.paas.massivegrid.net",
-    "lon-1.paas.massivegrid.net",
-    "lon-2.paas.massivegrid.net",
-    "ny-1.paas.massivegrid.net",
-    "ny-2.paas.massivegrid.net",
-    "sg-1.paas.massivegrid.net",
-    "jelastic.saveincloud.net",
-    "nordeste-idc.saveincloud.net",
-    "j.scaleforce.net",
-    "jelastic.tsukaeru.net",
-    "sdscloud.pl",
-    "unicloud.pl",
-    "mircloud.ru",
-    "jelastic.regruhosting.ru",
-    "enscaled.sg",
-    "jele.site",
-    "jelastic.team",
-    "orangecloud.tn",
-    "j.layershift.co.uk",
-    "phx.enscaled.us",
-    "mircloud.us",
-    "myjino.ru",
-    "*.hosting.myjino.ru",
-    "*.landing.myjino.ru",
-    "*.spectrum.myjino.ru",
-    "*.vps.myjino.ru",
-    "jotelulu.cloud",
-    "*.triton.zone",
-    "*.cns.joyent.com",
-    "js.org",
-    "kaas.gg",
-    "khplay.nl",
-    "ktistory.com",
-    "kapsi.fi",
-    "keymachine.de",
-    "kinghost.net",
-    "uni5.net",
-    "knightpoint.systems",
-    "koobin.events",
-    "oya.to",
-    "kuleuven.cloud",
-    "ezproxy.kuleuven.be",
-    "co.krd",
-    "edu.krd",
-    "krellian.net",
-    "webthings.io",
-    "git-repos.de",
-    "lcube-server.de",
-    "svn-repos.de",
-    "leadpages.co",
-    "lpages.co",
-    "lpusercontent.com",
-    "lelux.site",
-    "co.business",
-    "co.education",
-    "co.events",
-    "co.financial",
-    "co.network",
-    "co.place",
-    "co.technology",
-    "app.lmpm.com",
-    "linkyard.cloud",
-    "linkyard-cloud.ch",
-    "members.linode.com",
-    "*.nodebalancer.linode.com",
-    "*.linodeobjects.com",
-    "ip.linodeusercontent.com",
-    "we.bs",
-    "*.user.localcert.dev",
-    "localzone.xyz",
-    "loginline.app",
-    "loginline.dev",
-    "loginline.io",
-    "loginline.services",
-    "loginline.site",
-    "servers.run",
-    "lohmus.me",
-    "krasnik.pl",
-    "leczna.pl",
-    "lubartow.pl",
-    "lublin.pl",
-    "poniatowa.pl",
-    "swidnik.pl",
-    "glug.org.uk",
-    "lug.org.uk",
-    "lugs.org.uk",
-    "barsy.bg",
-    "barsy.co.uk",
-    "barsyonline.co.uk",
-    "barsycenter.com",
-    "barsyonline.com",
-    "barsy.club",
-    "barsy.de",
-    "barsy.eu",
-    "barsy.in",
-    "barsy.info",
-    "barsy.io",
-    "barsy.me",
-    "barsy.menu",
-    "barsy.mobi",
-    "barsy.net",
-    "barsy.online",
-    "barsy.org",
-    "barsy.pro",
-    "barsy.pub",
-    "barsy.ro",
-    "barsy.shop",
-    "barsy.site",
-    "barsy.support",
-    "barsy.uk",
-    "*.magentosite.cloud",
-    "mayfirst.info",
-    "mayfirst.org",
-    "hb.cldmail.ru",
-    "cn.vu",
-    "mazeplay.com",
-    "mcpe.me",
-    "mcdir.me",
-    "mcdir.ru",
-    "mcpre.ru",
-    "vps.mcdir.ru",
-    "mediatech.by",
-    "mediatech.dev",
-    "hra.health",
-    "miniserver.com",
-    "memset.net",
-    "messerli.app",
-    "*.cloud.metacentrum.cz",
-    "custom.metacentrum.cz",
-    "flt.cloud.muni.cz",
-    "usr.cloud.muni.cz",
-    "meteorapp.com",
-    "eu.meteorapp.com",
-    "co.pl",
-    "*.azurecontainer.io",
-    "azurewebsites.net",
-    "azure-mobile.net",
-    "cloudapp.net",
-    "azurestaticapps.net",
-    "1.azurestaticapps.net",
-    "2.azurestaticapps.net",
-    "3.azurestaticapps.net",
-    "centralus.azurestaticapps.net",
-    "eastasia.azurestaticapps.net",
-    "eastus2.azurestaticapps.net",
-    "westeurope.azurestaticapps.net",
-    "westus2.azurestaticapps.net",
-    "csx.cc",
-    "mintere.site",
-    "forte.id",
-    "mozilla-iot.org",
-    "bmoattachments.org",
-    "net.ru",
-    "org.ru",
-    "pp.ru",
-    "hostedpi.com",
-    "customer.mythic-beasts.com",
-    "caracal.mythic-beasts.com",
-    "fentiger.mythic-beasts.com",
-    "lynx.mythic-beasts.com",
-    "ocelot.mythic-beasts.com",
-    "oncilla.mythic-beasts.com",
-    "onza.mythic-beasts.com",
-    "sphinx.mythic-beasts.com",
-    "vs.mythic-beasts.com",
-    "x.mythic-beasts.com",
-    "yali.mythic-beasts.com",
-    "cust.retrosnub.co.uk",
-    "ui.nabu.casa",
-    "cloud.nospamproxy.com",
-    "netlify.app",
-    "4u.com",
-    "ngrok.app",
-    "ngrok-free.app",
-    "ngrok.dev",
-    "ngrok-free.dev",
-    "ngrok.io",
-    "ap.ngrok.io",
-    "au.ngrok.io",
-    "eu.ngrok.io",
-    "in.ngrok.io",
-    "jp.ngrok.io",
-    "sa.ngrok.io",
-    "us.ngrok.io",
-    "ngrok.pizza",
-    "nh-serv.co.uk",
-    "nfshost.com",
-    "*.developer.app",
-    "noop.app",
-    "*.northflank.app",
-    "*.build.run",
-    "*.code.run",
-    "*.database.run",
-    "*.migration.run",
-    "noticeable.news",
-    "dnsking.ch",
-    "mypi.co",
-    "n4t.co",
-    "001www.com",
-    "ddnslive.com",
-    "myiphost.com",
-    "forumz.info",
-    "16-b.it",
-    "32-b.it",
-    "64-b.it",
-    "soundcast.me",
-    "tcp4.me",
-    "dnsup.net",
-    "hicam.net",
-    "now-dns.net",
-    "ownip.net",
-    "vpndns.net",
-    "dynserv.org",
-    "now-dns.org",
-    "x443.pw",
-    "now-dns.top",
-    "ntdll.top",
-    "freeddns.us",
-    "crafting.xyz",
-    "zapto.xyz",
-    "nsupdate.info",
-    "nerdpol.ovh",
-    "blogsyte.com",
-    "brasilia.me",
-    "cable-modem.org",
-    "ciscofreak.com",
-    "collegefan.org",
-    "couchpotatofries.org",
-    "damnserver.com",
-    "ddns.me",
-    "ditchyourip.com",
-    "dnsfor.me",
-    "dnsiskinky.com",
-    "dvrcam.info",
-    "dynns.com",
-    "eating-organic.net",
-    "fantasyleague.cc",
-    "geekgalaxy.com",
-    "golffan.us",
-    "health-carereform.com",
-    "homesecuritymac.com",
-    "homesecuritypc.com",
-    "hopto.me",
-    "ilovecollege.info",
-    "loginto.me",
-    "mlbfan.org",
-    "mmafan.biz",
-    "myactivedirectory.com",
-    "mydissent.net",
-    "myeffect.net",
-    "mymediapc.net",
-    "mypsx.net",
-    "mysecuritycamera.com",
-    "mysecuritycamera.net",
-    "mysecuritycamera.org",
-    "net-freaks.com",
-    "nflfan.org",
-    "nhlfan.net",
-    "no-ip.ca",
-    "no-ip.co.uk",
-    "no-ip.net",
-    "noip.us",
-    "onthewifi.com",
-    "pgafan.net",
-    "point2this.com",
-    "pointto.us",
-    "privatizehealthinsurance.net",
-    "quicksytes.com",
-    "read-books.org",
-    "securitytactics.com",
-    "serveexchange.com",
-    "servehumour.com",
-    "servep2p.com",
-    "servesarcasm.com",
-    "stufftoread.com",
-    "ufcfan.org",
-    "unusualperson.com",
-    "workisboring.com",
-    "3utilities.com",
-    "bounceme.net",
-    "ddns.net",
-    "ddnsking.com",
-    "gotdns.ch",
-    "hopto.org",
-    "myftp.biz",
-    "myftp.org",
-    "myvnc.com",
-    "no-ip.biz",
-    "no-ip.info",
-    "no-ip.org",
-    "noip.me",
-    "redirectme.net",
-    "servebeer.com",
-    "serveblog.net",
-    "servecounterstrike.com",
-    "serveftp.com",
-    "servegame.com",
-    "servehalflife.com",
-    "servehttp.com",
-    "serveirc.com",
-    "serveminecraft.net",
-    "servemp3.com",
-    "servepics.com",
-    "servequake.com",
-    "sytes.net",
-    "webhop.me",
-    "zapto.org",
-    "stage.nodeart.io",
-    "pcloud.host",
-    "nyc.mn",
-    "static.observableusercontent.com",
-    "cya.gg",
-    "omg.lol",
-    "cloudycluster.net",
-    "omniwe.site",
-    "123hjemmeside.dk",
-    "123hjemmeside.no",
-    "123homepage.it",
-    "123kotisivu.fi",
-    "123minsida.se",
-    "123miweb.es",
-    "123paginaweb.pt",
-    "123sait.ru",
-    "123siteweb.fr",
-    "123webseite.at",
-    "123webseite.de",
-    "123website.be",
-    "123website.ch",
-    "123website.lu",
-    "123website.nl",
-    "service.one",
-    "simplesite.com",
-    "simplesite.com.br",
-    "simplesite.gr",
-    "simplesite.pl",
-    "nid.io",
-    "opensocial.site",
-    "opencraft.hosting",
-    "orsites.com",
-    "operaunite.com",
-    "tech.orange",
-    "authgear-staging.com",
-    "authgearapps.com",
-    "skygearapp.com",
-    "outsystemscloud.com",
-    "*.webpaas.ovh.net",
-    "*.hosting.ovh.net",
-    "ownprovider.com",
-    "own.pm",
-    "*.owo.codes",
-    "ox.rs",
-    "oy.lc",
-    "pgfog.com",
-    "pagefrontapp.com",
-    "pagexl.com",
-    "*.paywhirl.com",
-    "bar0.net",
-    "bar1.net",
-    "bar2.net",
-    "rdv.to",
-    "art.pl",
-    "gliwice.pl",
-    "krakow.pl",
-    "poznan.pl",
-    "wroc.pl",
-    "zakopane.pl",
-    "pantheonsite.io",
-    "gotpantheon.com",
-    "mypep.link",
-    "perspecta.cloud",
-    "lk3.ru",
-    "on-web.fr",
-    "bc.platform.sh",
-    "ent.platform.sh",
-    "eu.platform.sh",
-    "us.platform.sh",
-    "*.platformsh.site",
-    "*.tst.site",
-    "platter-app.com",
-    "platter-app.dev",
-    "platterp.us",
-    "pdns.page",
-    "plesk.page",
-    "pleskns.com",
-    "dyn53.io",
-    "onporter.run",
-    "co.bn",
-    "postman-echo.com",
-    "pstmn.io",
-    "mock.pstmn.io",
-    "httpbin.org",
-    "prequalifyme.today",
-    "xen.prgmr.com",
-    "priv.at",
-    "prvcy.page",
-    "*.dweb.link",
-    "protonet.io",
-    "chirurgiens-dentistes-en-france.fr",
-    "byen.site",
-    "pubtls.org",
-    "pythonanywhere.com",
-    "eu.pythonanywhere.com",
-    "qoto.io",
-    "qualifioapp.com",
-    "ladesk.com",
-    "qbuser.com",
-    "cloudsite.builders",
-    "instances.spawn.cc",
-    "instantcloud.cn",
-    "ras.ru",
-    "qa2.com",
-    "qcx.io",
-    "*.sys.qcx.io",
-    "dev-myqnapcloud.com",
-    "alpha-myqnapcloud.com",
-    "myqnapcloud.com",
-    "*.quipelements.com",
-    "vapor.cloud",
-    "vaporcloud.io",
-    "rackmaze.com",
-    "rackmaze.net",
-    "g.vbrplsbx.io",
-    "*.on-k3s.io",
-    "*.on-rancher.cloud",
-    "*.on-rio.io",
-    "readthedocs.io",
-    "rhcloud.com",
-    "app.render.com",
-    "onrender.com",
-    "firewalledreplit.co",
-    "id.firewalledreplit.co",
-    "repl.co",
-    "id.repl.co",
-    "repl.run",
-    "resindevice.io",
-    "devices.resinstaging.io",
-    "hzc.io",
-    "wellbeingzone.eu",
-    "wellbeingzone.co.uk",
-    "adimo.co.uk",
-    "itcouldbewor.se",
-    "git-pages.rit.edu",
-    "rocky.page",
-    "биз.рус",
-    "ком.рус",
-    "крым.рус",
-    "мир.рус",
-    "мск.рус",
-    "орг.рус",
-    "самара.рус",
-    "сочи.рус",
-    "спб.рус",
-    "я.рус",
-    "180r.com",
-    "dojin.com",
-    "sakuratan.com",
-    "sakuraweb.com",
-    "x0.com",
-    "2-d.jp",
-    "bona.jp",
-    "crap.jp",
-    "daynight.jp",
-    "eek.jp",
-    "flop.jp",
-    "halfmoon.jp",
-    "jeez.jp",
-    "matrix.jp",
-    "mimoza.jp",
-    "ivory.ne.jp",
-    "mail-box.ne.jp",
-    "mints.ne.jp",
-    "mokuren.ne.jp",
-    "opal.ne.jp",
-    "sakura.ne.jp",
-    "sumomo.ne.jp",
-    "topaz.ne.jp",
-    "netgamers.jp",
-    "nyanta.jp",
-    "o0o0.jp",
-    "rdy.jp",
-    "rgr.jp",
-    "rulez.jp",
-    "s3.isk01.sakurastorage.jp",
-    "s3.isk02.sakurastorage.jp",
-    "saloon.jp",
-    "sblo.jp",
-    "skr.jp",
-    "tank.jp",
-    "uh-oh.jp",
-    "undo.jp",
-    "rs.webaccel.jp",
-    "user.webaccel.jp",
-    "websozai.jp",
-    "xii.jp",
-    "squares.net",
-    "jpn.org",
-    "kirara.st",
-    "x0.to",
-    "from.tv",
-    "sakura.tv",
-    "*.builder.code.com",
-    "*.dev-builder.code.com",
-    "*.stg-builder.code.com",
-    "sandcats.io",
-    "logoip.de",
-    "logoip.com",
-    "fr-par-1.baremetal.scw.cloud",
-    "fr-par-2.baremetal.scw.cloud",
-    "nl-ams-1.baremetal.scw.cloud",
-    "fnc.fr-par.scw.cloud",
-    "functions.fnc.fr-par.scw.cloud",
-    "k8s.fr-par.scw.cloud",
-    "nodes.k8s.fr-par.scw.cloud",
-    "s3.fr-par.scw.cloud",
-    "s3-website.fr-par.scw.cloud",
-    "whm.fr-par.scw.cloud",
-    "priv.instances.scw.cloud",
-    "pub.instances.scw.cloud",
-    "k8s.scw.cloud",
-    "k8s.nl-ams.scw.cloud",
-    "nodes.k8s.nl-ams.scw.cloud",
-    "s3.nl-ams.scw.cloud",
-    "s3-website.nl-ams.scw.cloud",
-    "whm.nl-ams.scw.cloud",
-    "k8s.pl-waw.scw.cloud",
-    "nodes.k8s.pl-waw.scw.cloud",
-    "s3.pl-waw.scw.cloud",
-    "s3-website.pl-waw.scw.cloud",
-    "scalebook.scw.cloud",
-    "smartlabeling.scw.cloud",
-    "dedibox.fr",
-    "schokokeks.net",
-    "gov.scot",
-    "service.gov.scot",
-    "scrysec.com",
-    "firewall-gateway.com",
-    "firewall-gateway.de",
-    "my-gateway.de",
-    "my-router.de",
-    "spdns.de",
-    "spdns.eu",
-    "firewall-gateway.net",
-    "my-firewall.org",
-    "myfirewall.org",
-    "spdns.org",
-    "seidat.net",
-    "sellfy.store",
-    "senseering.net",
-    "minisite.ms",
-    "magnet.page",
-    "biz.ua",
-    "co.ua",
-    "pp.ua",
-    "shiftcrypto.dev",
-    "shiftcrypto.io",
-    "shiftedit.io",
-    "myshopblocks.com",
-    "myshopify.com",
-    "shopitsite.com",
-    "shopware.store",
-    "mo-siemens.io",
-    "1kapp.com",
-    "appchizi.com",
-    "applinzi.com",
-    "sinaapp.com",
-    "vipsinaapp.com",
-    "siteleaf.net",
-    "bounty-full.com",
-    "alpha.bounty-full.com",
-    "beta.bounty-full.com",
-    "small-web.org",
-    "vp4.me",
-    "snowflake.app",
-    "privatelink.snowflake.app",
-    "streamlit.app",
-    "streamlitapp.com",
-    "try-snowplow.com",
-    "srht.site",
-    "stackhero-network.com",
-    "musician.io",
-    "novecore.site",
-    "static.land",
-    "dev.static.land",
-    "sites.static.land",
-    "storebase.store",
-    "vps-host.net",
-    "atl.jelastic.vps-host.net",
-    "njs.jelastic.vps-host.net",
-    "ric.jelastic.vps-host.net",
-    "playstation-cloud.com",
-    "apps.lair.io",
-    "*.stolos.io",
-    "spacekit.io",
-    "customer.speedpartner.de",
-    "myspreadshop.at",
-    "myspreadshop.com.au",
-    "myspreadshop.be",
-    "myspreadshop.ca",
-    "myspreadshop.ch",
-    "myspreadshop.com",
-    "myspreadshop.de",
-    "myspreadshop.dk",
-    "myspreadshop.es",
-    "myspreadshop.fi",
-    "myspreadshop.fr",
-    "myspreadshop.ie",
-    "myspreadshop.it",
-    "myspreadshop.net",
-    "myspreadshop.nl",
-    "myspreadshop.no",
-    "myspreadshop.pl",
-    "myspreadshop.se",
-    "myspreadshop.co.uk",
-    "api.stdlib.com",
-    "storipress.app",
-    "storj.farm",
-    "utwente.io",
-    "soc.srcf.net",
-    "user.srcf.net",
-    "temp-dns.com",
-    "supabase.co",
-    "supabase.in",
-    "supabase.net",
-    "su.paba.se",
-    "*.s5y.io",
-    "*.sensiosite.cloud",
-    "syncloud.it",
-    "dscloud.biz",
-    "direct.quickconnect.cn",
-    "dsmynas.com",
-    "familyds.com",
-    "diskstation.me",
-    "dscloud.me",
-    "i234.me",
-    "myds.me",
-    "synology.me",
-    "dscloud.mobi",
-    "dsmynas.net",
-    "familyds.net",
-    "dsmynas.org",
-    "familyds.org",
-    "vpnplus.to",
-    "direct.quickconnect.to",
-    "tabitorder.co.il",
-    "mytabit.co.il",
-    "mytabit.com",
-    "taifun-dns.de",
-    "beta.tailscale.net",
-    "ts.net",
-    "gda.pl",
-    "gdansk.pl",
-    "gdynia.pl",
-    "med.pl",
-    "sopot.pl",
-    "site.tb-hosting.com",
-    "edugit.io",
-    "s3.teckids.org",
-    "telebit.app",
-    "telebit.io",
-    "*.telebit.xyz",
-    "*.firenet.ch",
-    "*.svc.firenet.ch",
-    "reservd.com",
-    "thingdustdata.com",
-    "cust.dev.thingdust.io",
-    "cust.disrec.thingdust.io",
-    "cust.prod.thingdust.io",
-    "cust.testing.thingdust.io",
-    "reservd.dev.thingdust.io",
-    "reservd.disrec.thingdust.io",
-    "reservd.testing.thingdust.io",
-    "tickets.io",
-    "arvo.network",
-    "azimuth.network",
-    "tlon.network",
-    "torproject.net",
-    "pages.torproject.net",
-    "bloxcms.com",
-    "townnews-staging.com",
-    "12hp.at",
-    "2ix.at",
-    "4lima.at",
-    "lima-city.at",
-    "12hp.ch",
-    "2ix.ch",
-    "4lima.ch",
-    "lima-city.ch",
-    "trafficplex.cloud",
-    "de.cool",
-    "12hp.de",
-    "2ix.de",
-    "4lima.de",
-    "lima-city.de",
-    "1337.pictures",
-    "clan.rip",
-    "lima-city.rocks",
-    "webspace.rocks",
-    "lima.zone",
-    "*.transurl.be",
-    "*.transurl.eu",
-    "*.transurl.nl",
-    "site.transip.me",
-    "tuxfamily.org",
-    "dd-dns.de",
-    "diskstation.eu",
-    "diskstation.org",
-    "dray-dns.de",
-    "draydns.de",
-    "dyn-vpn.de",
-    "dynvpn.de",
-    "mein-vigor.de",
-    "my-vigor.de",
-    "my-wan.de",
-    "syno-ds.de",
-    "synology-diskstation.de",
-    "synology-ds.de",
-    "typedream.app",
-    "pro.typeform.com",
-    "uber.space",
-    "*.uberspace.de",
-    "hk.com",
-    "hk.org",
-    "ltd.hk",
-    "inc.hk",
-    "it.com",
-    "name.pm",
-    "sch.tf",
-    "biz.wf",
-    "sch.wf",
-    "org.yt",
-    "virtualuser.de",
-    "virtual-user.de",
-    "upli.io",
-    "urown.cloud",
-    "dnsupdate.info",
-    "lib.de.us",
-    "2038.io",
-    "vercel.app",
-    "vercel.dev",
-    "now.sh",
-    "router.management",
-    "v-info.info",
-    "voorloper.cloud",
-    "neko.am",
-    "nyaa.am",
-    "be.ax",
-    "cat.ax",
-    "es.ax",
-    "eu.ax",
-    "gg.ax",
-    "mc.ax",
-    "us.ax",
-    "xy.ax",
-    "nl.ci",
-    "xx.gl",
-    "app.gp",
-    "blog.gt",
-    "de.gt",
-    "to.gt",
-    "be.gy",
-    "cc.hn",
-    "blog.kg",
-    "io.kg",
-    "jp.kg",
-    "tv.kg",
-    "uk.kg",
-    "us.kg",
-    "de.ls",
-    "at.md",
-    "de.md",
-    "jp.md",
-    "to.md",
-    "indie.porn",
-    "vxl.sh",
-    "ch.tc",
-    "me.tc",
-    "we.tc",
-    "nyan.to",
-    "at.vg",
-    "blog.vu",
-    "dev.vu",
-    "me.vu",
-    "v.ua",
-    "*.vultrobjects.com",
-    "wafflecell.com",
-    "*.webhare.dev",
-    "reserve-online.net",
-    "reserve-online.com",
-    "bookonline.app",
-    "hotelwithflight.com",
-    "wedeploy.io",
-    "wedeploy.me",
-    "wedeploy.sh",
-    "remotewd.com",
-    "pages.wiardweb.com",
-    "wmflabs.org",
-    "toolforge.org",
-    "wmcloud.org",
-    "panel.gg",
-    "daemon.panel.gg",
-    "messwithdns.com",
-    "woltlab-demo.com",
-    "myforum.community",
-    "community-pro.de",
-    "diskussionsbereich.de",
-    "community-pro.net",
-    "meinforum.net",
-    "affinitylottery.org.uk",
-    "raffleentry.org.uk",
-    "weeklylottery.org.uk",
-    "wpenginepowered.com",
-    "js.wpenginepowered.com",
-    "wixsite.com",
-    "editorx.io",
-    "half.host",
-    "xnbay.com",
-    "u2.xnbay.com",
-    "u2-local.xnbay.com",
-    "cistron.nl",
-    "demon.nl",
-    "xs4all.space",
-    "yandexcloud.net",
-    "storage.yandexcloud.net",
-    "website.yandexcloud.net",
-    "official.academy",
-    "yolasite.com",
-    "ybo.faith",
-    "yombo.me",
-    "homelink.one",
-    "ybo.party",
-    "ybo.review",
-    "ybo.science",
-    "ybo.trade",
-    "ynh.fr",
-    "nohost.me",
-    "noho.st",
-    "za.net",
-    "za.org",
-    "bss.design",
-    "basicserver.io",
-    "virtualserver.io",
-    "enterprisecloud.nu",
+static const char TLDStrings[] =
+    "xfinity\0"
+    "gs.mr.no\0"
+    "org.mv\0"
+    "dyndns-wiki.com\0"
+    "andøy.no\0"
+    "f.se\0"
+    "barsy.org\0"
+    "com.ua\0"
+    "biz.ls\0"
+    "blogspot.td\0"
+    "aseral.no\0"
+    "net.gn\0"
+    "com.cu\0"
+    "in-addr.arpa\0"
+    "shinto.gunma.jp\0"
+    "s3.isk01.sakurastorage.jp\0"
+    "wedeploy.me\0"
+    "vologda.su\0"
+    "littlestar.jp\0"
+    "sakura\0"
+    "2ix.de\0"
+    "karelia.su\0"
+    "tv.in\0"
+    "abbvie\0"
+    "lilly\0"
+    "gb.net\0"
+    "edu.gl\0"
+    "shari.hokkaido.jp\0"
+    "katowice.pl\0"
+    "shisui.chiba.jp\0"
+    "tranøy.no\0"
+    "store.bb\0"
+    "iwade.wakayama.jp\0"
+    "sale\0"
+    "shop.pl\0"
+    "stufftoread.com\0"
+    "ελ\0"
+    "værøy.no\0"
+    "edu.mt\0"
+    "its.me\0"
+    "org.mn\0"
+    "ap-southeast-1.elasticbeanstalk.com\0"
+    "udine.it\0"
+    "*.ocp.customer-oci.com\0"
+    "is-a-cpa.com\0"
+    "grozny.ru\0"
+    "me.it\0"
+    "aa.no\0"
+    "tw\0"
+    "yenbai.vn\0"
+    "kashiwara.osaka.jp\0"
+    "mt.leg.br\0"
+    "gov.sy\0"
+    "gov.ec\0"
+    "ilawa.pl\0"
+    "monzaebrianza.it\0"
+    "cc.tn.us\0"
+    "likes-pie.com\0"
+    "gsm.pl\0"
+    "kvalsund.no\0"
+    "barsy.pub\0"
+    "shop.brendly.rs\0"
+    "gov.is\0"
+    "from-de.com\0"
+    "candypop.jp\0"
+    "ome.tokyo.jp\0"
+    "edu.ac\0"
+    "jelastic.dogado.eu\0"
+    "ad.jp\0"
+    "shinshinotsu.hokkaido.jp\0"
+    "fin.tn\0"
+    "ishikawa.okinawa.jp\0"
+    "yoka.hyogo.jp\0"
+    "wedeploy.sh\0"
+    "amot.no\0"
+    "koto.shiga.jp\0"
+    "flå.no\0"
+    "орг\0"
+    "lolipop.io\0"
+    "ls\0"
+    "j.scaleforce.net\0"
+    "trogstad.no\0"
+    "bygland.no\0"
+    "tuva.su\0"
+    "myshopify.com\0"
+    "press.cy\0"
+    "napoli.it\0"
+    "selfip.net\0"
+    "yokaichiba.chiba.jp\0"
+    "kiho.mie.jp\0"
+    "iobb.net\0"
+    "mil.qa\0"
+    "lib.ks.us\0"
+    "vagan.no\0"
+    "aisai.aichi.jp\0"
+    "hemne.no\0"
+    "com.to\0"
+    "natura\0"
+    "idrett.no\0"
+    "*.oci.customer-oci.com\0"
+    "y.se\0"
+    "capitalone\0"
+    "toyotsu.fukuoka.jp\0"
+    "k12.ak.us\0"
+    "*.stolos.io\0"
+    "security\0"
+    "rip\0"
+    "ro\0"
+    "123website.be\0"
+    "kr.eu.org\0"
+    "lviv.ua\0"
+    "pid\0"
+    "higashine.yamagata.jp\0"
+    "stathelle.no\0"
+    "nt.au\0"
+    "au\0"
+    "com.km\0"
+    "公司.hk\0"
+    "org.ge\0"
+    "kaga.ishikawa.jp\0"
+    "nishi.osaka.jp\0"
+    "abbott\0"
+    "swatch\0"
+    "ohtawara.tochigi.jp\0"
+    "slupsk.pl\0"
+    "medecin.fr\0"
+    "組織.hk\0"
+    "yatsuka.shimane.jp\0"
+    "gleeze.com\0"
+    "navuotna.no\0"
+    "visa\0"
+    "ecologia.bo\0"
+    "org.mk\0"
+    "naka.ibaraki.jp\0"
+    "reserve-online.net\0"
+    "paris\0"
+    "cc.ct.us\0"
+    "dr.tr\0"
+    "land\0"
+    "duckdns.org\0"
+    "vallee-d-aoste.it\0"
+    "raffleentry.org.uk\0"
+    "toyooka.hyogo.jp\0"
+    "info.la\0"
+    "com.gn\0"
+    "taito.tokyo.jp\0"
+    "tokorozawa.saitama.jp\0"
+    "edu.ci\0"
+    "org.gu\0"
+    "teramo.it\0"
+    "cremona.it\0"
+    "is-very-sweet.org\0"
+    "horten.no\0"
+    "firewall-gateway.de\0"
+    "ap-southeast-2.elasticbeanstalk.com\0"
+    "drud.us\0"
+    "s3-eu-west-2.amazonaws.com\0"
+    "naie.hokkaido.jp\0"
+    "be.eu.org\0"
+    "psse.gov.pl\0"
+    "cab\0"
+    "services\0"
+    "recht.pro\0"
+    "hair\0"
+    "hiroshima.jp\0"
+    "io.kg\0"
+    "ubs\0"
+    "tv.tz\0"
+    "icbc\0"
+    "odawara.kanagawa.jp\0"
+    "tdk\0"
+    "from-wv.com\0"
+    "my.id\0"
+    "kiyokawa.kanagawa.jp\0"
+    "g.vbrplsbx.io\0"
+    "fm.br\0"
+    "valer.hedmark.no\0"
+    "zt.ua\0"
+    "barcelona\0"
+    "woodside\0"
+    "is-an-accountant.com\0"
+    "sørreisa.no\0"
+    "nakagawa.hokkaido.jp\0"
+    "mil.gh\0"
+    "kurgan.su\0"
+    "ce.it\0"
+    "half.host\0"
+    "2.azurestaticapps.net\0"
+    "maebashi.gunma.jp\0"
+    "ms.leg.br\0"
+    "enf.br\0"
+    "heguri.nara.jp\0"
+    "ott\0"
+    "suzu.ishikawa.jp\0"
+    "hongo.hiroshima.jp\0"
+    "net.bn\0"
+    "racing\0"
+    "ktistory.com\0"
+    "мон\0"
+    "fish\0"
+    "mil.in\0"
+    "gol.no\0"
+    "miyakonojo.miyazaki.jp\0"
+    "erotica.hu\0"
+    "kanra.gunma.jp\0"
+    "productions\0"
+    "wales\0"
+    "dev-myqnapcloud.com\0"
+    "wajima.ishikawa.jp\0"
+    "bacgiang.vn\0"
+    "gs.ol.no\0"
+    "net.st\0"
+    "berlevåg.no\0"
+    "art\0"
+    "on.ca\0"
+    "mielec.pl\0"
+    "salerno.it\0"
+    "med.br\0"
+    "shimoda.shizuoka.jp\0"
+    "eu\0"
+    "snowflake.app\0"
+    "dynv6.net\0"
+    "it1.jenv-aruba.cloud\0"
+    "call\0"
+    "ابوظبي\0"
+    "åkrehamn.no\0"
+    "gouv.fr\0"
+    "닷컴\0"
+    "com.re\0"
+    "hakone.kanagawa.jp\0"
+    "laz.it\0"
+    "webview-assets.aws-cloud9.eu-west-1.amazonaws.com\0"
+    "sakuragawa.ibaraki.jp\0"
+    "hosp.uk\0"
+    "servers.run\0"
+    "com.ge\0"
+    "danang.vn\0"
+    "sci.eg\0"
+    "baidu\0"
+    "pn.it\0"
+    "net.am\0"
+    "gov.au\0"
+    "edu.hk\0"
+    "toyono.osaka.jp\0"
+    "vibovalentia.it\0"
+    "cci.fr\0"
+    "club.tw\0"
+    "hdfc\0"
+    "or.id\0"
+    "shibecha.hokkaido.jp\0"
+    "friuli-venezia-giulia.it\0"
+    "edu.mn\0"
+    "shinshiro.aichi.jp\0"
+    "steigen.no\0"
+    "alstom\0"
+    "fnwk.site\0"
+    "福井.jp\0"
+    "lib.sc.us\0"
+    "gsj.bz\0"
+    "cafjs.com\0"
+    "per.nf\0"
+    "us\0"
+    "townnews-staging.com\0"
+    "jølster.no\0"
+    "org.sy\0"
+    "yachts\0"
+    "lo.it\0"
+    "co.rs\0"
+    "news\0"
+    "gliding.aero\0"
+    "ao.it\0"
+    "adimo.co.uk\0"
+    "jnj\0"
+    "123website.nl\0"
+    "gs.tm.no\0"
+    "hi.cn\0"
+    "transporte.bo\0"
+    "room\0"
+    "kutchan.hokkaido.jp\0"
+    "law.za\0"
+    "tsubame.niigata.jp\0"
+    "nhs.uk\0"
+    "ct.it\0"
+    "audio\0"
+    "boats\0"
+    "id.repl.co\0"
+    "mil.sy\0"
+    "net.mt\0"
+    "com.gr\0"
+    "boston\0"
+    "karumai.iwate.jp\0"
+    "y.bg\0"
+    "katori.chiba.jp\0"
+    "varoy.no\0"
+    "lib.hi.us\0"
+    "me.so\0"
+    "kiwa.mie.jp\0"
+    "in.net\0"
+    "kadogawa.miyazaki.jp\0"
+    "safety\0"
+    "skydiving.aero\0"
+    "webview-assets.cloud9.ap-northeast-3.amazonaws.com\0"
+    "bomlo.no\0"
+    "id.lv\0"
+    "dhl\0"
+    "网絡.hk\0"
+    "aguni.okinawa.jp\0"
+    "ru.com\0"
+    "info.et\0"
+    "cloud66.ws\0"
+    "lombardy.it\0"
+    "com.gp\0"
+    "landrover\0"
+    "edu.ar\0"
+    "davvenjarga.no\0"
+    "or.ug\0"
+    "tvedestrand.no\0"
+    "hikimi.shimane.jp\0"
+    "lpusercontent.com\0"
+    "vivo\0"
+    "gs.sf.no\0"
+    "analytics-gateway.us-east-2.amazonaws.com\0"
+    "ip.linodeusercontent.com\0"
+    "box\0"
+    "mil.lv\0"
+    "tsubata.ishikawa.jp\0"
+    "com.vc\0"
+    "game.tw\0"
+    "k12.nj.us\0"
+    "blogspot.co.uk\0"
+    "definima.net\0"
+    "makeup\0"
+    "pp.az\0"
+    "sa.com\0"
+    "nozawaonsen.nagano.jp\0"
+    "com.hk\0"
+    "gov.lc\0"
+    "ikata.ehime.jp\0"
+    "piacenza.it\0"
+    "komoro.nagano.jp\0"
+    "mc.eu.org\0"
+    "upper.jp\0"
+    "bg.it\0"
+    "lib.dc.us\0"
+    "bt.it\0"
+    "com.bm\0"
+    "blogspot.com.au\0"
+    "gáivuotna.no\0"
+    "shiogama.miyagi.jp\0"
+    "holy.jp\0"
+    "karuizawa.nagano.jp\0"
+    "new\0"
+    "awsglobalaccelerator.com\0"
+    "aukra.no\0"
+    "net.mx\0"
+    "coop.mw\0"
+    "com.kg\0"
+    "juniper\0"
+    "hanamaki.iwate.jp\0"
+    "bolivia.bo\0"
+    "deta.app\0"
+    "mydissent.net\0"
+    "ഭാരതം\0"
+    "oksnes.no\0"
+    "faith\0"
+    "ລາວ\0"
+    "cdn.prod.atlassian-dev.net\0"
+    "tottori.tottori.jp\0"
+    "shinanomachi.nagano.jp\0"
+    "takahata.yamagata.jp\0"
+    "*.landing.myjino.ru\0"
+    "lib.ky.us\0"
+    "virtualserver.io\0"
+    "ubank\0"
+    "sf.no\0"
+    "edu.mv\0"
+    "appengine.flow.ch\0"
+    "vxl.sh\0"
+    "com.tm\0"
+    "izumiotsu.osaka.jp\0"
+    "kg\0"
+    "yonago.tottori.jp\0"
+    "choshi.chiba.jp\0"
+    "ευ\0"
+    "download\0"
+    "edu.tj\0"
+    "map\0"
+    "cloud\0"
+    "isa-geek.com\0"
+    "nt.ca\0"
+    "gov.ms\0"
+    "mochizuki.nagano.jp\0"
+    "gratis\0"
+    "entertainment.aero\0"
+    "moe\0"
+    "한국\0"
+    "sar.it\0"
+    "taketa.oita.jp\0"
+    "from-ks.com\0"
+    "ecommerce-shop.pl\0"
+    "s3.ap-northeast-2.amazonaws.com\0"
+    "*.user.fm\0"
+    "motorcycles\0"
+    "minamiaiki.nagano.jp\0"
+    "gov.ba\0"
+    "adobeioruntime.net\0"
+    "nom.mg\0"
+    "streamlit.app\0"
+    "volvo\0"
+    "s3-ap-south-1.amazonaws.com\0"
+    "travel.tt\0"
+    "police.uk\0"
+    "spa\0"
+    "gov.tr\0"
+    "co.events\0"
+    "in\0"
+    "bc.ca\0"
+    "bozen.it\0"
+    "nov.ru\0"
+    "mombetsu.hokkaido.jp\0"
+    "goo\0"
+    "kumatori.osaka.jp\0"
+    "*.s5y.io\0"
+    "mytuleap.com\0"
+    "st\0"
+    "chernivtsi.ua\0"
+    "tarui.gifu.jp\0"
+    "aeroport.fr\0"
+    "barclaycard\0"
+    "tn\0"
+    "ojiya.niigata.jp\0"
+    "net.bs\0"
+    "habikino.osaka.jp\0"
+    "dyndns-home.com\0"
+    "组织.hk\0"
+    "sec.ps\0"
+    "blogspot.co.nz\0"
+    "name.vn\0"
+    "fastlylb.net\0"
+    "trapani.it\0"
+    "ogimi.okinawa.jp\0"
+    "kizu.kyoto.jp\0"
+    "com.ky\0"
+    "biz.pl\0"
+    "cloudns.club\0"
+    "*.code.run\0"
+    "place\0"
+    "com.kz\0"
+    "from-il.com\0"
+    "קום\0"
+    "immo\0"
+    "vet.br\0"
+    "mypi.co\0"
+    "synology.me\0"
+    "s3-website.eu-west-2.amazonaws.com\0"
+    "ørland.no\0"
+    "accenture\0"
+    "no-ip.co.uk\0"
+    "neat-url.com\0"
+    "actor\0"
+    "play\0"
+    "cc.hi.us\0"
+    "cc.sd.us\0"
+    "ketrzyn.pl\0"
+    "oyer.no\0"
+    "voagat.no\0"
+    "datsun\0"
+    "net.ki\0"
+    "yk.ca\0"
+    "com.ki\0"
+    "k12.vt.us\0"
+    "maizuru.kyoto.jp\0"
+    "adygeya.su\0"
+    "gov.ls\0"
+    "香川.jp\0"
+    "alwaysdata.net\0"
+    "ise.mie.jp\0"
+    "le.it\0"
+    "frontdoor\0"
+    "nom.ni\0"
+    "uwu.ai\0"
+    "friulivenezia-giulia.it\0"
+    "matsumoto.nagano.jp\0"
+    "*.svc.firenet.ch\0"
+    "øyer.no\0"
+    "bryansk.su\0"
+    "reservd.com\0"
+    "cbre\0"
+    "moskenes.no\0"
+    "zombie.jp\0"
+    "date\0"
+    "herøy.møre-og-romsdal.no\0"
+    "keisen.fukuoka.jp\0"
+    "tc.br\0"
+    "lc.it\0"
+    "ichinomiya.chiba.jp\0"
+    "fh-muenster.io\0"
+    "tsuno.miyazaki.jp\0"
+    "gold\0"
+    "nomi.ishikawa.jp\0"
+    "pythonanywhere.com\0"
+    "uk.eu.org\0"
+    "info.co\0"
+    "honjo.akita.jp\0"
+    "k12.ec\0"
+    "cloud.interhostsolutions.be\0"
+    "com.do\0"
+    "koga.fukuoka.jp\0"
+    "mibu.tochigi.jp\0"
+    "saitama.saitama.jp\0"
+    "edu.gn\0"
+    "pup.gov.pl\0"
+    "kouyama.kagoshima.jp\0"
+    "ikaruga.nara.jp\0"
+    "com.vu\0"
+    "monzaedellabrianza.it\0"
+    "cc.fl.us\0"
+    "motobu.okinawa.jp\0"
+    "yamagata.jp\0"
+    "cloud.fedoraproject.org\0"
+    "tselinograd.su\0"
+    "osasco.br\0"
+    "mov\0"
+    "kr.it\0"
+    "firmdale\0"
+    "from-ky.com\0"
+    "kumenan.okayama.jp\0"
+    "jelastic.saveincloud.net\0"
+    "day\0"
+    "id\0"
+    "ac.sz\0"
+    "ditchyourip.com\0"
+    "net.zm\0"
+    "tec.mi.us\0"
+    "cc.mt.us\0"
+    "k12.wi.us\0"
+    "agents.aero\0"
+    "vig\0"
+    "org.yt\0"
+    "grane.no\0"
+    "pokrovsk.su\0"
+    "ศึกษา.ไทย\0"
+    "net.dm\0"
+    "tochigi.tochigi.jp\0"
+    "acct.pro\0"
+    "blackfriday\0"
+    "toyoura.hokkaido.jp\0"
+    "minobu.yamanashi.jp\0"
+    "nom.pl\0"
+    "co.tm\0"
+    "kawara.fukuoka.jp\0"
+    "omachi.saga.jp\0"
+    "gentlentapis.com\0"
+    "airbus\0"
+    "sel.no\0"
+    "fujikawa.shizuoka.jp\0"
+    "net.uz\0"
+    "plus\0"
+    "kinko.kagoshima.jp\0"
+    "vc\0"
+    "com.lk\0"
+    "inf.br\0"
+    "enterprises\0"
+    "org.cu\0"
+    "nesoddtangen.no\0"
+    "olbiatempio.it\0"
+    "po.it\0"
+    "slz.br\0"
+    "mil.nz\0"
+    "kochi.kochi.jp\0"
+    "lurøy.no\0"
+    "durban\0"
+    "shirakawa.fukushima.jp\0"
+    "sakae.chiba.jp\0"
+    "kamogawa.chiba.jp\0"
+    "mil.ar\0"
+    "balestrand.no\0"
+    "fm\0"
+    "radøy.no\0"
+    "arendal.no\0"
+    "hamburg\0"
+    "sakahogi.gifu.jp\0"
+    "us.org\0"
+    "bio.br\0"
+    "unicom\0"
+    "سودان\0"
+    "myfast.space\0"
+    "nodes.k8s.nl-ams.scw.cloud\0"
+    "loans\0"
+    "pp.ua\0"
+    "cesenaforli.it\0"
+    "suzuka.mie.jp\0"
+    "network\0"
+    "hitra.no\0"
+    "lindesnes.no\0"
+    "kiyama.saga.jp\0"
+    "沖縄.jp\0"
+    "ua.rs\0"
+    "jp.eu.org\0"
+    "blogspot.com.cy\0"
+    "togo.aichi.jp\0"
+    "bodø.no\0"
+    "hbo\0"
+    "mjøndalen.no\0"
+    "izumizaki.fukushima.jp\0"
+    "trana.no\0"
+    "servebbs.net\0"
+    "elasticbeanstalk.com\0"
+    "kamikoani.akita.jp\0"
+    "vladimir.su\0"
+    "oharu.aichi.jp\0"
+    "world\0"
+    "carboniaiglesias.it\0"
+    "k.bg\0"
+    "drammen.no\0"
+    "gdn\0"
+    "kosaka.akita.jp\0"
+    "toyoake.aichi.jp\0"
+    "kim\0"
+    "pro.tt\0"
+    "gob.es\0"
+    "dyndns-at-work.com\0"
+    "net.to\0"
+    "mcdir.me\0"
+    "mitake.gifu.jp\0"
+    "shizukuishi.iwate.jp\0"
+    "blogspot.com.eg\0"
+    "net.kg\0"
+    "vaga.no\0"
+    "gov.cx\0"
+    "us.in\0"
+    "dynathome.net\0"
+    "ujiie.tochigi.jp\0"
+    "webview-assets.cloud9.ap-east-1.amazonaws.com\0"
+    "caravan\0"
+    "fr.it\0"
+    "gjesdal.no\0"
+    "herøy.nordland.no\0"
+    "family\0"
+    "clan.rip\0"
+    "sirdal.no\0"
+    "pigboat.jp\0"
+    "woltlab-demo.com\0"
+    "tonami.toyama.jp\0"
+    "kozaki.chiba.jp\0"
+    "eco.bj\0"
+    "hostyhosting.io\0"
+    "ltd.cy\0"
+    "biz.zm\0"
+    "meteorapp.com\0"
+    "thaibinh.vn\0"
+    "kawanehon.shizuoka.jp\0"
+    "123siteweb.fr\0"
+    "点看\0"
+    "vik.no\0"
+    "catering\0"
+    "okazaki.aichi.jp\0"
+    "minami.tokushima.jp\0"
+    "k12.oh.us\0"
+    "embaixada.st\0"
+    "sc.kr\0"
+    "is-a-hard-worker.com\0"
+    "mit\0"
+    "ac.in\0"
+    "git-pages.rit.edu\0"
+    "from-nd.com\0"
+    "gov.bf\0"
+    "tonosho.kagawa.jp\0"
+    "4lima.ch\0"
+    "org.ba\0"
+    "இலங்கை\0"
+    "air-surveillance.aero\0"
+    "ginowan.okinawa.jp\0"
+    "maibara.shiga.jp\0"
+    "isen.kagoshima.jp\0"
+    "net.ni\0"
+    "press\0"
+    "jio\0"
+    "website\0"
+    "org.sc\0"
+    "meme\0"
+    "tv.it\0"
+    "sor-aurdal.no\0"
+    "ac.ls\0"
+    "tsushima.aichi.jp\0"
+    "yt\0"
+    "mil.rw\0"
+    "tsurugashima.saitama.jp\0"
+    "sphinx.mythic-beasts.com\0"
+    "basketball\0"
+    "shimotsuma.ibaraki.jp\0"
+    "shintoku.hokkaido.jp\0"
+    "ms.kr\0"
+    "dellogliastra.it\0"
+    "net.ba\0"
+    "静岡.jp\0"
+    "net.ru\0"
+    "gov.iq\0"
+    "webview-assets.aws-cloud9.ap-south-1.amazonaws.com\0"
+    "tsuru.yamanashi.jp\0"
+    "sorfold.no\0"
+    "higashiyodogawa.osaka.jp\0"
+    "deals\0"
+    "blogspot.kr\0"
+    "vic.edu.au\0"
+    "com.cw\0"
+    "valléedaoste.it\0"
+    "so\0"
+    "freeddns.org\0"
+    "rw\0"
+    "rs.ba\0"
+    "parma.it\0"
+    "oslo.no\0"
+    "author.aero\0"
+    "tecnologia.bo\0"
+    "hitachiota.ibaraki.jp\0"
+    "bnr.la\0"
+    "tajiri.osaka.jp\0"
+    "lib.tn.us\0"
+    "rec.br\0"
+    "whm.nl-ams.scw.cloud\0"
+    "trading\0"
+    "dclk\0"
+    "ogi.saga.jp\0"
+    "ashibetsu.hokkaido.jp\0"
+    "toscana.it\0"
+    "mashiki.kumamoto.jp\0"
+    "by\0"
+    "is.it\0"
+    "raisa.no\0"
+    "kashiwazaki.niigata.jp\0"
+    "prd.km\0"
+    "limo\0"
+    "lib.mt.us\0"
+    "tf\0"
+    "vladikavkaz.su\0"
+    "web.do\0"
+    "froya.no\0"
+    "srht.site\0"
+    "购物\0"
+    "ngrok.pizza\0"
+    "kr.com\0"
+    "habmer.no\0"
+    "com.hr\0"
+    "hokuto.yamanashi.jp\0"
+    "trycloudflare.com\0"
+    "yahiko.niigata.jp\0"
+    "asti.it\0"
+    "otaki.nagano.jp\0"
+    "nflfan.org\0"
+    "fe.it\0"
+    "midori.gunma.jp\0"
+    "blogspot.my\0"
+    "tomi.nagano.jp\0"
+    "istanbul\0"
+    "lom.no\0"
+    "shiksha\0"
+    "láhppi.no\0"
+    "it.eu.org\0"
+    "tagami.niigata.jp\0"
+    "net.la\0"
+    "net-freaks.com\0"
+    "wanouchi.gifu.jp\0"
+    "ki\0"
+    "is-a-nascarfan.com\0"
+    "yamanobe.yamagata.jp\0"
+    "tt\0"
+    "wskr.gov.pl\0"
+    "hønefoss.no\0"
+    "boyfriend.jp\0"
+    "asahi.nagano.jp\0"
+    "info.vn\0"
+    "desa.id\0"
+    "co.cr\0"
+    "df.leg.br\0"
+    "kamaishi.iwate.jp\0"
+    "*.0emm.com\0"
+    "भारत\0"
+    "álaheadju.no\0"
+    "*.mm\0"
+    "pueblo.bo\0"
+    "dattolocal.com\0"
+    "paroch.k12.ma.us\0"
+    "store.ro\0"
+    "london\0"
+    "poltava.ua\0"
+    "gov.ve\0"
+    "shikama.miyagi.jp\0"
+    "vfs.cloud9.eu-west-1.amazonaws.com\0"
+    "cw\0"
+    "*.migration.run\0"
+    "hotels\0"
+    "blogspot.vn\0"
+    "vermögensberater\0"
+    "webview-assets.cloud9.ca-central-1.amazonaws.com\0"
+    "bms\0"
+    "*.firenet.ch\0"
+    "eu-central-1.elasticbeanstalk.com\0"
+    "modena.it\0"
+    "pescara.it\0"
+    "shaw\0"
+    "hurum.no\0"
+    "berlin\0"
+    "長崎.jp\0"
+    "tsuchiura.ibaraki.jp\0"
+    "deal\0"
+    "loan\0"
+    "airforce\0"
+    "mk.ua\0"
+    "diskstation.eu\0"
+    "benevento.it\0"
+    "edu.in\0"
+    "minato.osaka.jp\0"
+    "mil.vc\0"
+    "yamatsuri.fukushima.jp\0"
+    "com.pt\0"
+    "edu.sl\0"
+    "sr.gov.pl\0"
+    "turin.it\0"
+    "akadns.net\0"
+    "club\0"
+    "co.cm\0"
+    "poniatowa.pl\0"
+    "honjyo.akita.jp\0"
+    "usuki.oita.jp\0"
+    "toyo.kochi.jp\0"
+    "mazeplay.com\0"
+    "stuff-4-sale.org\0"
+    "pb.gov.br\0"
+    "tm.km\0"
+    "spdns.eu\0"
+    "byen.site\0"
+    "ivanovo.su\0"
+    "site.transip.me\0"
+    "net.ws\0"
+    "oguchi.aichi.jp\0"
+    "econo.bj\0"
+    "eus\0"
+    "organic\0"
+    "tychy.pl\0"
+    "net.ec\0"
+    "no-ip.net\0"
+    "flynnhosting.net\0"
+    "iglesias-carbonia.it\0"
+    "sblo.jp\0"
+    "az\0"
+    "รัฐบาล.ไทย\0"
+    "ngo.ph\0"
+    "kpn\0"
+    "shinjuku.tokyo.jp\0"
+    "is-a-doctor.com\0"
+    "k8s.pl-waw.scw.cloud\0"
+    "international\0"
+    "sveio.no\0"
+    "sunndal.no\0"
+    "ens.tn\0"
+    "123minsida.se\0"
+    "ac.at\0"
+    "app.os.stg.fedoraproject.org\0"
+    "бел\0"
+    "isa-geek.net\0"
+    "nord-aurdal.no\0"
+    "tourism.tn\0"
+    "taa.it\0"
+    "nakatombetsu.hokkaido.jp\0"
+    "org.kn\0"
+    "takashima.shiga.jp\0"
+    "skjak.no\0"
+    "lima-city.at\0"
+    "int.eu.org\0"
+    "mt.us\0"
+    "net.bo\0"
+    "seven\0"
+    "tunes\0"
+    "alaheadju.no\0"
+    "chanel\0"
+    "taxi\0"
+    "cranky.jp\0"
+    "gov.rs\0"
+    "tomigusuku.okinawa.jp\0"
+    "bergamo.it\0"
+    "is-by.us\0"
+    "*.transurl.nl\0"
+    "vladimir.ru\0"
+    "ibara.okayama.jp\0"
+    "mytis.ru\0"
+    "bamble.no\0"
+    "agric.za\0"
+    "milano.it\0"
+    "richardli\0"
+    "yaizu.shizuoka.jp\0"
+    "fentiger.mythic-beasts.com\0"
+    "sømna.no\0"
+    "shibata.miyagi.jp\0"
+    "org.bn\0"
+    "radom.pl\0"
+    "as\0"
+    "name.tj\0"
+    "ve\0"
+    "gov.ee\0"
+    "echizen.fukui.jp\0"
+    "independent-inquiry.uk\0"
+    "ભારત\0"
+    "freeboxos.fr\0"
+    "crap.jp\0"
+    "daigo.ibaraki.jp\0"
+    "ikeda.fukui.jp\0"
+    "msk.ru\0"
+    "yamanashi.jp\0"
+    "fukuoka.jp\0"
+    "kofu.yamanashi.jp\0"
+    "padua.it\0"
+    "is-a-patsfan.org\0"
+    "yuki.ibaraki.jp\0"
+    "vestvågøy.no\0"
+    "org.ss\0"
+    "org.bb\0"
+    "oishida.yamagata.jp\0"
+    "am.in\0"
+    "syncloud.it\0"
+    "lenvik.no\0"
+    "vikna.no\0"
+    "rieti.it\0"
+    "gov.il\0"
+    "thd\0"
+    "kagamino.okayama.jp\0"
+    "det.br\0"
+    "east-kazakhstan.su\0"
+    "citadel\0"
+    "numazu.shizuoka.jp\0"
+    "marumori.miyagi.jp\0"
+    "com.hn\0"
+    "gs.bu.no\0"
+    "com.pf\0"
+    "net.vu\0"
+    "apps.lair.io\0"
+    "kids.us\0"
+    "gov.lb\0"
+    "school.na\0"
+    "gwangju.kr\0"
+    "goodyear\0"
+    "noto.ishikawa.jp\0"
+    "workers.dev\0"
+    "pmn.it\0"
+    "com.py\0"
+    "limited\0"
+    "camp\0"
+    "is-with-theband.com\0"
+    "uozu.toyama.jp\0"
+    "*.hosting.ovh.net\0"
+    "omi.niigata.jp\0"
+    "boomla.net\0"
+    "lillesand.no\0"
+    "ngrok.app\0"
+    "cargo.aero\0"
+    "miki.hyogo.jp\0"
+    "uk.reclaim.cloud\0"
+    "mino.gifu.jp\0"
+    "babyblue.jp\0"
+    "k12.md.us\0"
+    "sc.cn\0"
+    "fairwinds\0"
+    "edu.sd\0"
+    "auto.pl\0"
+    "mt\0"
+    "misaki.osaka.jp\0"
+    "blogsyte.com\0"
+    "vaporcloud.io\0"
+    "isa.kagoshima.jp\0"
+    "hsbc\0"
+    "lib.nv.us\0"
+    "fnc.fr-par.scw.cloud\0"
+    "appspaceusercontent.com\0"
+    "kanan.osaka.jp\0"
+    "hiraizumi.iwate.jp\0"
+    "!www.ck\0"
+    "ieee\0"
+    "nishio.aichi.jp\0"
+    "dnp\0"
+    "voto\0"
+    "caltanissetta.it\0"
+    "chita.aichi.jp\0"
+    "グーグル\0"
+    "chrome\0"
+    "gehirn.ne.jp\0"
+    "shirako.chiba.jp\0"
+    "yamada.toyama.jp\0"
+    "*.usercontent.goog\0"
+    "org.ug\0"
+    "plc.ly\0"
+    "org.na\0"
+    "nyuzen.toyama.jp\0"
+    "genova.it\0"
+    "pz.it\0"
+    "haiduong.vn\0"
+    "lib.id.us\0"
+    "asahi.ibaraki.jp\0"
+    "koto.tokyo.jp\0"
+    "mima.tokushima.jp\0"
+    "trentino-s-tirol.it\0"
+    "za.bz\0"
+    "mobara.chiba.jp\0"
+    "ryuoh.shiga.jp\0"
+    "show\0"
+    "in-the-band.net\0"
+    "komatsu\0"
+    "nishigo.fukushima.jp\0"
+    "edu.cv\0"
+    "km\0"
+    "ozu.kumamoto.jp\0"
+    "hikawa.shimane.jp\0"
+    "stockholm\0"
+    "net.pr\0"
+    "higashikawa.hokkaido.jp\0"
+    "*.dev.adobeaemcloud.com\0"
+    "com.sc\0"
+    "ga.us\0"
+    "pepper.jp\0"
+    "kashima.ibaraki.jp\0"
+    "cc.ga.us\0"
+    "belem.br\0"
+    "takaharu.miyazaki.jp\0"
+    "amusement.aero\0"
+    "rifu.miyagi.jp\0"
+    "pvt.ge\0"
+    "cf\0"
+    "biz.bb\0"
+    "org.ro\0"
+    "heavy.jp\0"
+    "秋田.jp\0"
+    "org.pk\0"
+    "mitsuke.niigata.jp\0"
+    "is-slick.com\0"
+    "sch.ng\0"
+    "channelsdvr.net\0"
+    "honda\0"
+    "tmp.br\0"
+    "k12.in.us\0"
+    "name\0"
+    "memorial\0"
+    "webview-assets.aws-cloud9.me-south-1.amazonaws.com\0"
+    "toride.ibaraki.jp\0"
+    "lu.it\0"
+    "winners\0"
+    "eero-stage.online\0"
+    "biz.gl\0"
+    "com.bs\0"
+    "shimoji.okinawa.jp\0"
+    "ebina.kanagawa.jp\0"
+    "co.zm\0"
+    "fuoisku.no\0"
+    "dyn-ip24.de\0"
+    "ooo\0"
+    "mashiko.tochigi.jp\0"
+    "kragerø.no\0"
+    "email\0"
+    "mutsuzawa.chiba.jp\0"
+    "webview-assets.cloud9.af-south-1.amazonaws.com\0"
+    "gr.com\0"
+    "ss\0"
+    "hemsedal.no\0"
+    "gov.lr\0"
+    "int.in\0"
+    "pruszkow.pl\0"
+    "pyatigorsk.ru\0"
+    "or.cr\0"
+    "org.rw\0"
+    "*.futurecms.at\0"
+    "usr.cloud.muni.cz\0"
+    "higashiagatsuma.gunma.jp\0"
+    "joboji.iwate.jp\0"
+    "bacninh.vn\0"
+    "tamano.okayama.jp\0"
+    "aibetsu.hokkaido.jp\0"
+    "karasuyama.tochigi.jp\0"
+    "uk.net\0"
+    "twmail.cc\0"
+    "ny-1.paas.massivegrid.net\0"
+    "nakayama.yamagata.jp\0"
+    "nd.us\0"
+    "inawashiro.fukushima.jp\0"
+    "j.bg\0"
+    "airtel\0"
+    "åseral.no\0"
+    "koobin.events\0"
+    "sakuho.nagano.jp\0"
+    "ambulance.aero\0"
+    "ybo.faith\0"
+    "direct.quickconnect.to\0"
+    "realm.cz\0"
+    "nemuro.hokkaido.jp\0"
+    "ro.eu.org\0"
+    "df.gov.br\0"
+    "nome.cv\0"
+    "oirase.aomori.jp\0"
+    "grajewo.pl\0"
+    "ravendb.me\0"
+    "wielun.pl\0"
+    "lasalle\0"
+    "gloppen.no\0"
+    "lib.mo.us\0"
+    "од.срб\0"
+    "framer.photos\0"
+    "tosa.kochi.jp\0"
+    "hoyanger.no\0"
+    "ai.in\0"
+    "eu.ngrok.io\0"
+    "slattum.no\0"
+    "yamagata.ibaraki.jp\0"
+    "wpenginepowered.com\0"
+    "rauma.no\0"
+    "khanhhoa.vn\0"
+    "oh.us\0"
+    "wassamu.hokkaido.jp\0"
+    "123hjemmeside.dk\0"
+    "trentino-aadige.it\0"
+    "cc.me.us\0"
+    "nishinoshima.shimane.jp\0"
+    "gyokuto.kumamoto.jp\0"
+    "deta.dev\0"
+    "ballooning.aero\0"
+    "kamikawa.saitama.jp\0"
+    "webview-assets.cloud9.us-east-2.amazonaws.com\0"
+    "camera\0"
+    "klæbu.no\0"
+    "bg\0"
+    "gov.qa\0"
+    "blogspot.com.co\0"
+    "run\0"
+    "for-the.biz\0"
+    "finnøy.no\0"
+    "ltd.ng\0"
+    "pagexl.com\0"
+    "krakow.pl\0"
+    "heroy.more-og-romsdal.no\0"
+    "user.aseinet.ne.jp\0"
+    "kasumigaura.ibaraki.jp\0"
+    "商标\0"
+    "movimiento.bo\0"
+    "k12.as.us\0"
+    "togliatti.su\0"
+    "gouv.ml\0"
+    "ar\0"
+    "name.fj\0"
+    "gangwon.kr\0"
+    "pru\0"
+    "natal.br\0"
+    "main.jp\0"
+    "vda.it\0"
+    "art.br\0"
+    "gallo\0"
+    "123hjemmeside.no\0"
+    "open\0"
+    "cherkasy.ua\0"
+    "gov.kz\0"
+    "ab.ca\0"
+    "網絡.香港\0"
+    "auto\0"
+    "webview-assets.cloud9.eu-north-1.amazonaws.com\0"
+    "chips.jp\0"
+    "org.ni\0"
+    "mydatto.com\0"
+    "sardinia.it\0"
+    "nysa.pl\0"
+    "drive\0"
+    "cc.or.us\0"
+    "ochi.kochi.jp\0"
+    "mein-iserv.de\0"
+    "fo\0"
+    "trani-barletta-andria.it\0"
+    "android\0"
+    "net.bj\0"
+    "dh.bytemark.co.uk\0"
+    "averoy.no\0"
+    "sc.ug\0"
+    "higashihiroshima.hiroshima.jp\0"
+    "asahi.chiba.jp\0"
+    "org\0"
+    "dazaifu.fukuoka.jp\0"
+    "olecko.pl\0"
+    "is-a-libertarian.com\0"
+    "girlfriend.jp\0"
+    "kawagoe.saitama.jp\0"
+    "hn.cn\0"
+    "csx.cc\0"
+    "vågsøy.no\0"
+    "test.ru\0"
+    "nom.ro\0"
+    "tondabayashi.osaka.jp\0"
+    "int.ci\0"
+    "商城\0"
+    "cng.br\0"
+    "yokawa.hyogo.jp\0"
+    "arida.wakayama.jp\0"
+    "net.bb\0"
+    "lib.md.us\0"
+    "tydal.no\0"
+    "in.eu.org\0"
+    "w.bg\0"
+    "minisite.ms\0"
+    "fuji.shizuoka.jp\0"
+    "inazawa.aichi.jp\0"
+    "*.cns.joyent.com\0"
+    "tara.saga.jp\0"
+    "info.ec\0"
+    "hlx.page\0"
+    "com.is\0"
+    "sor-odal.no\0"
+    "cc.wi.us\0"
+    "org.gt\0"
+    "marshalls\0"
+    "ikoma.nara.jp\0"
+    "credit\0"
+    "jp.net\0"
+    "meråker.no\0"
+    "aosta.it\0"
+    "koori.fukushima.jp\0"
+    "repl.run\0"
+    "sadist.jp\0"
+    "chernigov.ua\0"
+    "uh-oh.jp\0"
+    "yono.saitama.jp\0"
+    "col.ng\0"
+    "cityeats\0"
+    "oow.gov.pl\0"
+    "neyagawa.osaka.jp\0"
+    "t.bg\0"
+    "or.it\0"
+    "report\0"
+    "sagae.yamagata.jp\0"
+    "hanam.vn\0"
+    "dyndns-ip.com\0"
+    "cc.sc.us\0"
+    "mizusawa.iwate.jp\0"
+    "dn.ua\0"
+    "kristiansund.no\0"
+    "is-a-conservative.com\0"
+    "tula.su\0"
+    "k12.id.us\0"
+    "mel.cloudlets.com.au\0"
+    "jp.kg\0"
+    "hayashima.okayama.jp\0"
+    "froland.no\0"
+    "tamayu.shimane.jp\0"
+    "pe.it\0"
+    "hobol.no\0"
+    "grimstad.no\0"
+    "siteleaf.net\0"
+    "京都.jp\0"
+    "*.yokohama.jp\0"
+    "to\0"
+    "商業.tw\0"
+    "hatinh.vn\0"
+    "modelling.aero\0"
+    "ap.gov.pl\0"
+    "ril\0"
+    "ent.platform.sh\0"
+    "iwate.jp\0"
+    "shangrila\0"
+    "rel.pl\0"
+    "mihama.chiba.jp\0"
+    "degree\0"
+    "edu.pr\0"
+    "vic.gov.au\0"
+    "in.us\0"
+    "val-d-aosta.it\0"
+    "ky\0"
+    "iq\0"
+    "settsu.osaka.jp\0"
+    "coffee\0"
+    "lib.in.us\0"
+    "skjervøy.no\0"
+    "123sait.ru\0"
+    "va\0"
+    "*.kunden.ortsinfo.at\0"
+    "campaign.gov.uk\0"
+    "sko.gov.pl\0"
+    "*.ex.futurecms.at\0"
+    "ভাৰত\0"
+    "edu.ec\0"
+    "yamaga.kumamoto.jp\0"
+    "fr-par-1.baremetal.scw.cloud\0"
+    "vps-host.net\0"
+    "matrix.jp\0"
+    "tottori.jp\0"
+    "lt.it\0"
+    "sakai.osaka.jp\0"
+    "eng.pro\0"
+    "nom.za\0"
+    "kusatsu.gunma.jp\0"
+    "kitashiobara.fukushima.jp\0"
+    "directory\0"
+    "scrysec.com\0"
+    "org.mw\0"
+    "ringebu.no\0"
+    "imperia.it\0"
+    "nom.km\0"
+    "kashihara.nara.jp\0"
+    "com.tw\0"
+    "ug\0"
+    "wios.gov.pl\0"
+    "championship.aero\0"
+    "hiranai.aomori.jp\0"
+    "setouchi.okayama.jp\0"
+    "vercel.dev\0"
+    "nanto.toyama.jp\0"
+    "loginline.io\0"
+    "of.by\0"
+    "ascolipiceno.it\0"
+    "com.mv\0"
+    "mtn\0"
+    "ie\0"
+    "tatebayashi.gunma.jp\0"
+    "wiih.gov.pl\0"
+    "med.sd\0"
+    "edu.is\0"
+    "properties\0"
+    "rahkkeravju.no\0"
+    "gov.mr\0"
+    "oy.lc\0"
+    "kfh\0"
+    "c.bg\0"
+    "rimini.it\0"
+    "supply\0"
+    "edu.rs\0"
+    "hita.oita.jp\0"
+    "olbia-tempio.it\0"
+    "cz.eu.org\0"
+    "yoshida.saitama.jp\0"
+    "org.zw\0"
+    "aparecida.br\0"
+    "miho.ibaraki.jp\0"
+    "shakotan.hokkaido.jp\0"
+    "servesarcasm.com\0"
+    "net.id\0"
+    "synology-diskstation.de\0"
+    "kimobetsu.hokkaido.jp\0"
+    "on-the-web.tv\0"
+    "gitapp.si\0"
+    "from-or.com\0"
+    "httpbin.org\0"
+    "irish\0"
+    "com.dz\0"
+    "cafe\0"
+    "ha.cn\0"
+    "nhlfan.net\0"
+    "*.ex.ortsinfo.at\0"
+    "s3-us-east-2.amazonaws.com\0"
+    "kakegawa.shizuoka.jp\0"
+    "georgia.su\0"
+    "sch.id\0"
+    "hs.kr\0"
+    "es.leg.br\0"
+    "eu-west-1.elasticbeanstalk.com\0"
+    "stjordalshalsen.no\0"
+    "fujimi.nagano.jp\0"
+    "ilovecollege.info\0"
+    "am.gov.br\0"
+    "doomdns.com\0"
+    "kagamiishi.fukushima.jp\0"
+    "net.eu.org\0"
+    "iitate.fukushima.jp\0"
+    "kv.ua\0"
+    "a.bg\0"
+    "base.shop\0"
+    "sakuratan.com\0"
+    "gov.za\0"
+    "se\0"
+    "floripa.br\0"
+    "microlight.aero\0"
+    "name.hr\0"
+    "if.ua\0"
+    "org.gy\0"
+    "sande.more-og-romsdal.no\0"
+    "matera.it\0"
+    "operaunite.com\0"
+    "is-a-hunter.com\0"
+    "moåreke.no\0"
+    "valled-aosta.it\0"
+    "gov.bb\0"
+    "เน็ต.ไทย\0"
+    "vana\0"
+    "filegear-jp.me\0"
+    "gov.fj\0"
+    "analytics-gateway.us-west-2.amazonaws.com\0"
+    "utazu.kagawa.jp\0"
+    "suli.hu\0"
+    "kashiba.nara.jp\0"
+    "hamamatsu.shizuoka.jp\0"
+    "ondigitalocean.app\0"
+    "witd.gov.pl\0"
+    "fr-par-2.baremetal.scw.cloud\0"
+    "greater.jp\0"
+    "kvænangen.no\0"
+    "bible\0"
+    "ltd.lk\0"
+    "co.me\0"
+    "bashkiria.ru\0"
+    "youtube\0"
+    "gop.pk\0"
+    "hashbang.sh\0"
+    "misato.akita.jp\0"
+    "si\0"
+    "elblag.pl\0"
+    "reisen\0"
+    "ap.ngrok.io\0"
+    "higashikagura.hokkaido.jp\0"
+    "sogne.no\0"
+    "s3.dualstack.ap-northeast-2.amazonaws.com\0"
+    "trentinsudtirol.it\0"
+    "mt.it\0"
+    "org.lr\0"
+    "rivne.ua\0"
+    "ax\0"
+    "cloudaccess.net\0"
+    "blogspot.mx\0"
+    "bio\0"
+    "бг\0"
+    "wmcloud.org\0"
+    "mayfirst.org\0"
+    "edu.bm\0"
+    "nom.ad\0"
+    "est-a-la-masion.com\0"
+    "ac\0"
+    "kamimine.saga.jp\0"
+    "*.webhare.dev\0"
+    "ogata.akita.jp\0"
+    "de.ls\0"
+    "rana.no\0"
+    "*.transurl.be\0"
+    "2ix.ch\0"
+    "sex\0"
+    "org.sg\0"
+    "gov.lk\0"
+    "s3-external-1.amazonaws.com\0"
+    "lib.ar.us\0"
+    "id.au\0"
+    "from-ms.com\0"
+    "tsukumi.oita.jp\0"
+    "coop.rw\0"
+    "kai.yamanashi.jp\0"
+    "codes\0"
+    "nisshin.aichi.jp\0"
+    "blogspot.am\0"
+    "edu.ps\0"
+    "goip.de\0"
+    "now-dns.top\0"
+    "odate.akita.jp\0"
+    "veterinaire.km\0"
+    "for-better.biz\0"
+    "net.sy\0"
+    "geek.nz\0"
+    "evenes.no\0"
+    "ina.ibaraki.jp\0"
+    "org.se\0"
+    "k12.fl.us\0"
+    "shimada.shizuoka.jp\0"
+    "kumakogen.ehime.jp\0"
+    "com.mw\0"
+    "sosnowiec.pl\0"
+    "desi\0"
+    "gov.tm\0"
+    "net.in\0"
+    "campania.it\0"
+    "orland.no\0"
+    "s3-ap-southeast-1.amazonaws.com\0"
+    "forlìcesena.it\0"
+    "fujishiro.ibaraki.jp\0"
+    "tec.ve\0"
+    "takino.hyogo.jp\0"
+    "crown\0"
+    "gr\0"
+    "online.th\0"
+    "fit\0"
+    "ato.br\0"
+    "kami.miyagi.jp\0"
+    "horonobe.hokkaido.jp\0"
+    "kitagata.gifu.jp\0"
+    "yn.cn\0"
+    "c.se\0"
+    "pesaro-urbino.it\0"
+    "gov.bt\0"
+    "s.se\0"
+    "skedsmo.no\0"
+    "tochio.niigata.jp\0"
+    "pg.it\0"
+    "ibaraki.ibaraki.jp\0"
+    "gov\0"
+    "hobby-site.com\0"
+    "mv\0"
+    "pr.gov.pl\0"
+    "kaminoyama.yamagata.jp\0"
+    "cesena-forlì.it\0"
+    "ryugasaki.ibaraki.jp\0"
+    "better-than.tv\0"
+    "aid.pl\0"
+    "bryne.no\0"
+    "ارامكو\0"
+    "val-daosta.it\0"
+    "kibichuo.okayama.jp\0"
+    "mil.cl\0"
+    "kumiyama.kyoto.jp\0"
+    "app.br\0"
+    "s3.isk02.sakurastorage.jp\0"
+    "radio.am\0"
+    "sweetpepper.org\0"
+    "nl.eu.org\0"
+    "cx.ua\0"
+    "bievat.no\0"
+    "bel.tr\0"
+    "info.az\0"
+    "tendo.yamagata.jp\0"
+    "info.ni\0"
+    "coz.br\0"
+    "webview-assets.aws-cloud9.us-west-2.amazonaws.com\0"
+    "pharmaciens.km\0"
+    "suzaka.nagano.jp\0"
+    "org.is\0"
+    "soctrang.vn\0"
+    "edu.lk\0"
+    "soccer\0"
+    "easypanel.host\0"
+    "nesseby.no\0"
+    "amsterdam\0"
+    "targi.pl\0"
+    "musica.ar\0"
+    "aetna\0"
+    "omachi.nagano.jp\0"
+    "fly.dev\0"
+    "cocotte.jp\0"
+    "florist\0"
+    "cim.br\0"
+    "greta.fr\0"
+    "itano.tokushima.jp\0"
+    "happou.akita.jp\0"
+    "charter.aero\0"
+    "beiarn.no\0"
+    "sk\0"
+    "kuroiso.tochigi.jp\0"
+    "test.tj\0"
+    "*.alces.network\0"
+    "net.sb\0"
+    "servehttp.com\0"
+    "watch\0"
+    "hinode.tokyo.jp\0"
+    "com.ss\0"
+    "websozai.jp\0"
+    "per.sg\0"
+    "edu.tr\0"
+    "grosseto.it\0"
+    "lubin.pl\0"
+    "nikko.tochigi.jp\0"
+    "vindafjord.no\0"
+    "myfirewall.org\0"
+    "com.ci\0"
+    "kokubunji.tokyo.jp\0"
+    "matsuda.kanagawa.jp\0"
+    "jls-sto2.elastx.net\0"
+    "nu.ca\0"
+    "sa.cr\0"
+    "ايران\0"
+    "kg.kr\0"
+    "kawamata.fukushima.jp\0"
+    "jeonnam.kr\0"
+    "lolipopmc.jp\0"
+    "perugia.it\0"
+    "chuo.fukuoka.jp\0"
+    "ssl.origin.cdn77-secure.org\0"
+    "cars\0"
+    "de.trendhosting.cloud\0"
+    "sch.ly\0"
+    "gotdns.ch\0"
+    "myspreadshop.ca\0"
+    "id.us\0"
+    "audible\0"
+    "2ix.at\0"
+    "tobe.ehime.jp\0"
+    "shirakawa.gifu.jp\0"
+    "pomorskie.pl\0"
+    "bahcavuotna.no\0"
+    "m.se\0"
+    "sklep.pl\0"
+    "askim.no\0"
+    "kamiizumi.saitama.jp\0"
+    "ppg.br\0"
+    "swinoujscie.pl\0"
+    "hasama.oita.jp\0"
+    "int.cv\0"
+    "saku.nagano.jp\0"
+    "com.bz\0"
+    "hitachi\0"
+    "oncilla.mythic-beasts.com\0"
+    "s3-us-gov-west-1.amazonaws.com\0"
+    "pol.dz\0"
+    "koka.shiga.jp\0"
+    "notaires.km\0"
+    "framer.website\0"
+    "univ.sn\0"
+    "podlasie.pl\0"
+    "lahppi.no\0"
+    "nayoro.hokkaido.jp\0"
+    "izumi.osaka.jp\0"
+    "ringerike.no\0"
+    "koshimizu.hokkaido.jp\0"
+    "ac.ma\0"
+    "shinjo.nara.jp\0"
+    "now\0"
+    "top\0"
+    "shoes\0"
+    "cba\0"
+    "gov.ps\0"
+    "gob.bo\0"
+    "mls\0"
+    "org.vc\0"
+    "pinoko.jp\0"
+    "gotemba.shizuoka.jp\0"
+    "hiratsuka.kanagawa.jp\0"
+    "net.vc\0"
+    "hb.cn\0"
+    "*.telebit.xyz\0"
+    "chofu.tokyo.jp\0"
+    "kamagaya.chiba.jp\0"
+    "jur.pro\0"
+    "bhz.br\0"
+    "web.tj\0"
+    "polkowice.pl\0"
+    "omigawa.chiba.jp\0"
+    "poker\0"
+    "ltd.hk\0"
+    "فلسطين\0"
+    "masfjorden.no\0"
+    "at-band-camp.net\0"
+    "kokonoe.oita.jp\0"
+    "museum.om\0"
+    "net.ms\0"
+    "zhitomir.ua\0"
+    "nagiso.nagano.jp\0"
+    "sohu\0"
+    "is-very-bad.org\0"
+    "niigata.jp\0"
+    "kustanai.ru\0"
+    "sch.tf\0"
+    "org.ee\0"
+    "blog.vu\0"
+    "trentinoaadige.it\0"
+    "kunneppu.hokkaido.jp\0"
+    "oguni.yamagata.jp\0"
+    "wodzislaw.pl\0"
+    "vfs.cloud9.ap-east-1.amazonaws.com\0"
+    "net.cw\0"
+    "istmein.de\0"
+    "homesecuritypc.com\0"
+    "miharu.fukushima.jp\0"
+    "ntdll.top\0"
+    "org.et\0"
+    "hirakata.osaka.jp\0"
+    "sonla.vn\0"
+    "szkola.pl\0"
+    "community-pro.net\0"
+    "com.mk\0"
+    "råholt.no\0"
+    "org.uy\0"
+    "haibara.shizuoka.jp\0"
+    "dnsupdater.de\0"
+    "or.kr\0"
+    "shiki.saitama.jp\0"
+    "abc.br\0"
+    "trentino-a-adige.it\0"
+    "matsudo.chiba.jp\0"
+    "mydatto.net\0"
+    "com.az\0"
+    "gw\0"
+    "iyo.ehime.jp\0"
+    "nanmoku.gunma.jp\0"
+    "dscloud.mobi\0"
+    "pwc\0"
+    "w.se\0"
+    "クラウド\0"
+    "akashi.hyogo.jp\0"
+    "pt\0"
+    "mintere.site\0"
+    "otsuchi.iwate.jp\0"
+    "dnsking.ch\0"
+    "review\0"
+    "org.la\0"
+    "marriott\0"
+    "is-a-guru.com\0"
+    "tz\0"
+    "谷歌\0"
+    "rj.gov.br\0"
+    "gob.ar\0"
+    "tatamotors\0"
+    "okaya.nagano.jp\0"
+    "certmgr.org\0"
+    "hirono.iwate.jp\0"
+    "glass\0"
+    "weblike.jp\0"
+    "cipriani\0"
+    "sauherad.no\0"
+    "x443.pw\0"
+    "sch.lk\0"
+    "ci.it\0"
+    "blogspot.al\0"
+    "na4u.ru\0"
+    "时尚\0"
+    "chikuzen.fukuoka.jp\0"
+    "shingu.fukuoka.jp\0"
+    "info.tz\0"
+    "*.transurl.eu\0"
+    "is-a-chef.com\0"
+    "gdynia.pl\0"
+    "bulsan.it\0"
+    "leclerc\0"
+    "noheji.aomori.jp\0"
+    "com.dm\0"
+    "github.io\0"
+    "from-nm.com\0"
+    "nom.nc\0"
+    "vallee-aoste.it\0"
+    "عراق\0"
+    "ip6.arpa\0"
+    "meguro.tokyo.jp\0"
+    "onfabrica.com\0"
+    "123paginaweb.pt\0"
+    "edu.pa\0"
+    "chiba.jp\0"
+    "ac.vn\0"
+    "lipsy\0"
+    "vercel.app\0"
+    "dyndns.org\0"
+    "餐厅\0"
+    "myphotos.cc\0"
+    "pramerica\0"
+    "wajiki.tokushima.jp\0"
+    "forsale\0"
+    "edu.gy\0"
+    "org.ky\0"
+    "eero.online\0"
+    "geekgalaxy.com\0"
+    "sv\0"
+    "control.aero\0"
+    "sch.wf\0"
+    "cc.id.us\0"
+    "shonai.fukuoka.jp\0"
+    "langevag.no\0"
+    "cnpy.gdn\0"
+    "niikappu.hokkaido.jp\0"
+    "cfa\0"
+    "nowaruda.pl\0"
+    "servep2p.com\0"
+    "miyoshi.saitama.jp\0"
+    "*.spectrum.myjino.ru\0"
+    "mo.us\0"
+    "yamashina.kyoto.jp\0"
+    "toki.gifu.jp\0"
+    "simple-url.com\0"
+    "com.in\0"
+    "balsan-suedtirol.it\0"
+    "takasaki.gunma.jp\0"
+    "faststacks.net\0"
+    "navoi.su\0"
+    "host\0"
+    "ice\0"
+    "odo.br\0"
+    "co.uk\0"
+    "net.pn\0"
+    "mp\0"
+    "osakikamijima.hiroshima.jp\0"
+    "gob.ni\0"
+    "loginline.services\0"
+    "千葉.jp\0"
+    "sennan.osaka.jp\0"
+    "achi.nagano.jp\0"
+    "gs.va.no\0"
+    "net.pt\0"
+    "*.stgstage.dev\0"
+    "kartuzy.pl\0"
+    "from-al.com\0"
+    "int\0"
+    "al.leg.br\0"
+    "bridgestone\0"
+    "ota.tokyo.jp\0"
+    "logoip.com\0"
+    "tmall\0"
+    "rybnik.pl\0"
+    "ac.jp\0"
+    "kafjord.no\0"
+    "shinjo.yamagata.jp\0"
+    "rel.ht\0"
+    "tuscany.it\0"
+    "vfs.cloud9.sa-east-1.amazonaws.com\0"
+    "in.th\0"
+    "pgfog.com\0"
+    "porsáŋgu.no\0"
+    "com.tj\0"
+    "*.nodebalancer.linode.com\0"
+    "kikuchi.kumamoto.jp\0"
+    "fermo.it\0"
+    "180r.com\0"
+    "tsuruga.fukui.jp\0"
+    "bostik\0"
+    "ac.tz\0"
+    "koya.wakayama.jp\0"
+    "space\0"
+    "nom.pa\0"
+    "gen.tr\0"
+    "kharkov.ua\0"
+    "health-carereform.com\0"
+    "o.bg\0"
+    "rc.it\0"
+    "homesense\0"
+    "edu.ee\0"
+    "lamborghini\0"
+    "senseering.net\0"
+    "otsuki.kochi.jp\0"
+    "k12.al.us\0"
+    "betainabox.com\0"
+    "måsøy.no\0"
+    "anan.nagano.jp\0"
+    "kouzushima.tokyo.jp\0"
+    "sakado.saitama.jp\0"
+    "lib.la.us\0"
+    "dynamisches-dns.de\0"
+    "eti.br\0"
+    "hadano.kanagawa.jp\0"
+    "bu.no\0"
+    "lawyer\0"
+    "大分.jp\0"
+    "mil.py\0"
+    "webview-assets.aws-cloud9.ap-southeast-2.amazonaws.com\0"
+    "backdrop.jp\0"
+    "siellak.no\0"
+    "net.af\0"
+    "s3-us-west-2.amazonaws.com\0"
+    "minamiuonuma.niigata.jp\0"
+    "calabria.it\0"
+    "cfd\0"
+    "gov.ir\0"
+    "muko.kyoto.jp\0"
+    "imabari.ehime.jp\0"
+    "global.ssl.fastly.net\0"
+    "várggát.no\0"
+    "lib.or.us\0"
+    "bluebite.io\0"
+    "iservschule.de\0"
+    "røyken.no\0"
+    "li.it\0"
+    "tokashiki.okinawa.jp\0"
+    "cal\0"
+    "myspreadshop.es\0"
+    "thingdustdata.com\0"
+    "krødsherad.no\0"
+    "skype\0"
+    "宮城.jp\0"
+    "goog\0"
+    "qa\0"
+    "臺灣\0"
+    "lecce.it\0"
+    "ushiku.ibaraki.jp\0"
+    "ah.no\0"
+    "nishiwaki.hyogo.jp\0"
+    "sanok.pl\0"
+    "cloudfront.net\0"
+    "trentino-stirol.it\0"
+    "spb.ru\0"
+    "mc.it\0"
+    "roma.it\0"
+    "ingatlan.hu\0"
+    "aurland.no\0"
+    "fujioka.gunma.jp\0"
+    "tagawa.fukuoka.jp\0"
+    "fujisawa.iwate.jp\0"
+    "com.bo\0"
+    "takamori.nagano.jp\0"
+    "vestby.no\0"
+    "微博\0"
+    "!city.yokohama.jp\0"
+    "*.database.run\0"
+    "boxfuse.io\0"
+    "citi\0"
+    "nf\0"
+    "athleta\0"
+    "yokote.akita.jp\0"
+    "biei.hokkaido.jp\0"
+    "nose.osaka.jp\0"
+    "mifune.kumamoto.jp\0"
+    "miyagi.jp\0"
+    "od.ua\0"
+    "asn.au\0"
+    "cloud.jelastic.open.tim.it\0"
+    "org.kz\0"
+    "how\0"
+    "svalbard.no\0"
+    "kobierzyce.pl\0"
+    "forumz.info\0"
+    "lørenskog.no\0"
+    "de.gt\0"
+    "himeji.hyogo.jp\0"
+    "pubtls.org\0"
+    "sochi.su\0"
+    "sayama.osaka.jp\0"
+    "locus\0"
+    "jmp\0"
+    "shimabara.nagasaki.jp\0"
+    "kaluga.su\0"
+    "12hp.ch\0"
+    "ugim.gov.pl\0"
+    "123website.lu\0"
+    "higashi.okinawa.jp\0"
+    "jot\0"
+    "est.pr\0"
+    "trafficplex.cloud\0"
+    "service.gov.scot\0"
+    "goldpoint\0"
+    "nasushiobara.tochigi.jp\0"
+    "kvanangen.no\0"
+    "es.eu.org\0"
+    "kárášjohka.no\0"
+    "yakumo.hokkaido.jp\0"
+    "mormon\0"
+    "fhsk.se\0"
+    "bari.it\0"
+    "paris.eu.org\0"
+    "hoplix.shop\0"
+    "ichihara.chiba.jp\0"
+    "info.pl\0"
+    "higashi.fukushima.jp\0"
+    "notteroy.no\0"
+    "reise\0"
+    "org.hu\0"
+    "gifts\0"
+    "man\0"
+    "serveirc.com\0"
+    "sandvikcoromant\0"
+    "mobi.gp\0"
+    "notogawa.shiga.jp\0"
+    "السعودیة\0"
+    "forum\0"
+    "org.sa\0"
+    "k12.ny.us\0"
+    "pya.jp\0"
+    "gov.sh\0"
+    "shima.mie.jp\0"
+    "grainger\0"
+    "rollag.no\0"
+    "avianca\0"
+    "sobetsu.hokkaido.jp\0"
+    "is-an-anarchist.com\0"
+    "com\0"
+    "travelersinsurance\0"
+    "kommunalforbund.se\0"
+    "airport.aero\0"
+    "aw\0"
+    "bar.pro\0"
+    "pet\0"
+    "sayama.saitama.jp\0"
+    "atsugi.kanagawa.jp\0"
+    "myspreadshop.ie\0"
+    "nishiizu.shizuoka.jp\0"
+    "os.hordaland.no\0"
+    "fashionstore.jp\0"
+    "hagi.yamaguchi.jp\0"
+    "sakura.chiba.jp\0"
+    "togane.chiba.jp\0"
+    "simplesite.com.br\0"
+    "myspreadshop.at\0"
+    "com.ag\0"
+    "sandnessjoen.no\0"
+    "cdn-edges.net\0"
+    "網絡.hk\0"
+    "binhphuoc.vn\0"
+    "mn.us\0"
+    "com.fj\0"
+    "oshima.tokyo.jp\0"
+    "priv.pl\0"
+    "kazimierz-dolny.pl\0"
+    "wow\0"
+    "奈良.jp\0"
+    "भारोत\0"
+    "shika.ishikawa.jp\0"
+    "!city.kawasaki.jp\0"
+    "eu.ax\0"
+    "ski\0"
+    "notodden.no\0"
+    "net.uy\0"
+    "yugawara.kanagawa.jp\0"
+    "naroy.no\0"
+    "chowder.jp\0"
+    "tirol\0"
+    "mil.tw\0"
+    "not.br\0"
+    "agano.niigata.jp\0"
+    "cc.nd.us\0"
+    "belluno.it\0"
+    "webview-assets.aws-cloud9.ap-northeast-3.amazonaws.com\0"
+    "kawanishi.nara.jp\0"
+    "sekd1.beebyteapp.io\0"
+    "inabe.mie.jp\0"
+    "sx\0"
+    "sumomo.ne.jp\0"
+    "salangen.no\0"
+    "from-ne.com\0"
+    "int.lk\0"
+    "samsclub\0"
+    "reservd.testing.thingdust.io\0"
+    "jele.club\0"
+    "valer.ostfold.no\0"
+    "net.au\0"
+    "nom.es\0"
+    "kasuga.hyogo.jp\0"
+    "starostwo.gov.pl\0"
+    "mitou.yamaguchi.jp\0"
+    "marine.ru\0"
+    "net.lv\0"
+    "analytics-gateway.us-east-1.amazonaws.com\0"
+    "asago.hyogo.jp\0"
+    "broke-it.net\0"
+    "biz\0"
+    "webview-assets.aws-cloud9.eu-west-2.amazonaws.com\0"
+    "is-a-cubicle-slave.com\0"
+    "aaa.pro\0"
+    "obihiro.hokkaido.jp\0"
+    "s3-eu-west-1.amazonaws.com\0"
+    "kamikawa.hyogo.jp\0"
+    "sardegna.it\0"
+    "net.ng\0"
+    "gmina.pl\0"
+    "s3-website.ap-northeast-2.amazonaws.com\0"
+    "taobao\0"
+    "ama.aichi.jp\0"
+    "mil.sh\0"
+    "seto.aichi.jp\0"
+    "com.se\0"
+    "kvinnherad.no\0"
+    "space-to-rent.com\0"
+    "devices.resinstaging.io\0"
+    "sch.qa\0"
+    "rs\0"
+    "be\0"
+    "qa2.com\0"
+    "shikatsu.aichi.jp\0"
+    "konskowola.pl\0"
+    "quangnam.vn\0"
+    "money.bj\0"
+    "om\0"
+    "sa-east-1.elasticbeanstalk.com\0"
+    "hikari.yamaguchi.jp\0"
+    "lima-city.de\0"
+    "yoshimi.saitama.jp\0"
+    "murmansk.su\0"
+    "mitoyo.kagawa.jp\0"
+    "moda\0"
+    "namdalseid.no\0"
+    "gov.mv\0"
+    "hokksund.no\0"
+    "filegear-gb.me\0"
+    "kddi\0"
+    "gob.do\0"
+    "cosenza.it\0"
+    "wphostedmail.com\0"
+    "السعوديه\0"
+    "pe.leg.br\0"
+    "s3.dualstack.eu-central-1.amazonaws.com\0"
+    "gov.sb\0"
+    "com.st\0"
+    "logoip.de\0"
+    "fitjar.no\0"
+    "taishi.osaka.jp\0"
+    "lifeinsurance\0"
+    "awaji.hyogo.jp\0"
+    "my-wan.de\0"
+    "sarufutsu.hokkaido.jp\0"
+    "webview-assets.cloud9.us-west-2.amazonaws.com\0"
+    "com.gl\0"
+    "us-east-1.amazonaws.com\0"
+    "kawagoe.mie.jp\0"
+    "kasahara.gifu.jp\0"
+    "cagliari.it\0"
+    "tsu.mie.jp\0"
+    "ธุรกิจ.ไทย\0"
+    "misato.wakayama.jp\0"
+    "tønsberg.no\0"
+    "trentino-sued-tirol.it\0"
+    "sch.ir\0"
+    "numata.hokkaido.jp\0"
+    "sør-odal.no\0"
+    "trv\0"
+    "kuroishi.aomori.jp\0"
+    "gob.mx\0"
+    "sc.ls\0"
+    "vadsø.no\0"
+    "basicserver.io\0"
+    "raindrop.jp\0"
+    "dm\0"
+    "org.jo\0"
+    "gov.ki\0"
+    "ro.gov.br\0"
+    "cieszyn.pl\0"
+    "jls-sto1.elastx.net\0"
+    "safety.aero\0"
+    "groundhandling.aero\0"
+    "sumida.tokyo.jp\0"
+    "rotorcraft.aero\0"
+    "restaurant\0"
+    "now-dns.org\0"
+    "kherson.ua\0"
+    "vs.it\0"
+    "canva-apps.cn\0"
+    "express\0"
+    "blogspot.com.es\0"
+    "te.it\0"
+    "nerdpol.ovh\0"
+    "org.pn\0"
+    "mil.kz\0"
+    "gojome.akita.jp\0"
+    "cbn\0"
+    "setagaya.tokyo.jp\0"
+    "webview-assets.cloud9.ap-southeast-1.amazonaws.com\0"
+    "dyndns-work.com\0"
+    "yufu.oita.jp\0"
+    "misato.shimane.jp\0"
+    "blogspot.co.id\0"
+    "cc.mi.us\0"
+    "servehumour.com\0"
+    "ryd.wafaicloud.com\0"
+    "comcast\0"
+    "x0.com\0"
+    "yawatahama.ehime.jp\0"
+    "gjovik.no\0"
+    "org.sd\0"
+    "mo-siemens.io\0"
+    "higashiyoshino.nara.jp\0"
+    "unzen.nagasaki.jp\0"
+    "freedesktop.org\0"
+    "halsa.no\0"
+    "from-ct.com\0"
+    "supersale.jp\0"
+    "motegi.tochigi.jp\0"
+    "forte.id\0"
+    "juegos\0"
+    "audi\0"
+    "mr.no\0"
+    "org.il\0"
+    "matsumoto.kagoshima.jp\0"
+    "playstation\0"
+    "us.com\0"
+    "pizza\0"
+    "morioka.iwate.jp\0"
+    "ri.it\0"
+    "fi.cloudplatform.fi\0"
+    "sellfy.store\0"
+    "wakasa.fukui.jp\0"
+    "markets\0"
+    "yasaka.nagano.jp\0"
+    "homelinux.com\0"
+    "cy.eu.org\0"
+    "mobi.na\0"
+    "ac.ir\0"
+    "floppy.jp\0"
+    "anz\0"
+    "shinkamigoto.nagasaki.jp\0"
+    "abb\0"
+    "kamiamakusa.kumamoto.jp\0"
+    "edu.bs\0"
+    "isumi.chiba.jp\0"
+    "ak.us\0"
+    "shiroishi.saga.jp\0"
+    "nagasaki.nagasaki.jp\0"
+    "toga.toyama.jp\0"
+    "vladikavkaz.ru\0"
+    "com.bn\0"
+    "io\0"
+    "kagoshima.kagoshima.jp\0"
+    "remotewd.com\0"
+    "nittedal.no\0"
+    "lindas.no\0"
+    "is-a-personaltrainer.com\0"
+    "salud.bo\0"
+    "omasvuotna.no\0"
+    "oyabe.toyama.jp\0"
+    "zlg.br\0"
+    "wtc\0"
+    "beer\0"
+    "wine\0"
+    "tksat.bo\0"
+    "rwe\0"
+    "net.iq\0"
+    "rs.webaccel.jp\0"
+    "canva-apps.com\0"
+    "net.om\0"
+    "impertrixcdn.com\0"
+    "edu.sg\0"
+    "leka.no\0"
+    "laocai.vn\0"
+    "a.se\0"
+    "bplaced.com\0"
+    "ru.net\0"
+    "fj.cn\0"
+    "tabitorder.co.il\0"
+    "fitness\0"
+    "moroyama.saitama.jp\0"
+    "asaka.saitama.jp\0"
+    "baseball\0"
+    "fukagawa.hokkaido.jp\0"
+    "org.pt\0"
+    "skr.jp\0"
+    "bungoono.oita.jp\0"
+    "skoczow.pl\0"
+    "abeno.osaka.jp\0"
+    "ofunato.iwate.jp\0"
+    "priv.at\0"
+    "hra.health\0"
+    "*.rss.my.id\0"
+    "team\0"
+    "miyawaka.fukuoka.jp\0"
+    "org.sz\0"
+    "nagasaki.jp\0"
+    "sasayama.hyogo.jp\0"
+    "org.om\0"
+    "hasvik.no\0"
+    "mar.it\0"
+    "gn\0"
+    "yanaizu.fukushima.jp\0"
+    "com.uy\0"
+    "gal\0"
+    "squares.net\0"
+    "sina\0"
+    "asker.no\0"
+    "obi\0"
+    "gov.dz\0"
+    "kuleuven.cloud\0"
+    "edu.dm\0"
+    "klodzko.pl\0"
+    "rebun.hokkaido.jp\0"
+    "ito.shizuoka.jp\0"
+    "mg.gov.br\0"
+    "oe.yamagata.jp\0"
+    "com.sy\0"
+    "taranto.it\0"
+    "sandefjord.no\0"
+    "佛山\0"
+    "zaporizhzhe.ua\0"
+    "magnet.page\0"
+    "rag-cloud.hosteur.com\0"
+    "th\0"
+    "go.tj\0"
+    "nb.ca\0"
+    "gd.cn\0"
+    "arna.no\0"
+    "ਭਾਰਤ\0"
+    "gov.pt\0"
+    "cherkassy.ua\0"
+    "gyeonggi.kr\0"
+    "צהל.ישראל\0"
+    "rome.it\0"
+    "from-md.com\0"
+    "nom.fr\0"
+    "kosai.shizuoka.jp\0"
+    "versus.jp\0"
+    "bb\0"
+    "cc.nm.us\0"
+    "fuso.aichi.jp\0"
+    "game-host.org\0"
+    "ne.ug\0"
+    "photography\0"
+    "qsl.br\0"
+    "agrar.hu\0"
+    "co.kr\0"
+    "aquarelle\0"
+    "pages.wiardweb.com\0"
+    "yuzawa.niigata.jp\0"
+    "esq\0"
+    "deloitte\0"
+    "aremark.no\0"
+    "marnardal.no\0"
+    "public-inquiry.uk\0"
+    "com.nr\0"
+    "servemp3.com\0"
+    "kunitachi.tokyo.jp\0"
+    "azure\0"
+    "ac.cr\0"
+    "furukawa.miyagi.jp\0"
+    "chiyoda.gunma.jp\0"
+    "net.bh\0"
+    "موقع\0"
+    "*.fk\0"
+    "minamiechizen.fukui.jp\0"
+    "岐阜.jp\0"
+    "blogspot.ru\0"
+    "read\0"
+    "sakura.tv\0"
+    "playstation-cloud.com\0"
+    "cv.ua\0"
+    "lol\0"
+    "net.sd\0"
+    "eco\0"
+    "scientist.aero\0"
+    "sv.it\0"
+    "higashiosaka.osaka.jp\0"
+    "ohira.miyagi.jp\0"
+    "isa.us\0"
+    "tochigi.jp\0"
+    "myspreadshop.ch\0"
+    "ena.gifu.jp\0"
+    "mil.mv\0"
+    "ngo.za\0"
+    "us.kg\0"
+    "santoandre.br\0"
+    "money\0"
+    "s3-website-us-east-1.amazonaws.com\0"
+    "forgot.his.name\0"
+    "bihar.in\0"
+    "odesa.ua\0"
+    "balsfjord.no\0"
+    "s3.dualstack.ca-central-1.amazonaws.com\0"
+    "name.pr\0"
+    "com.my\0"
+    "com.ai\0"
+    "analytics-gateway.eu-west-1.amazonaws.com\0"
+    "sells-for-less.com\0"
+    "misconfused.org\0"
+    "kongsberg.no\0"
+    "我爱你\0"
+    "car\0"
+    "yasu.shiga.jp\0"
+    "krd\0"
+    "info.bb\0"
+    "uk.com\0"
+    "mb.it\0"
+    "eu-west-2.elasticbeanstalk.com\0"
+    "tysvær.no\0"
+    "fukusaki.hyogo.jp\0"
+    "fukuchi.fukuoka.jp\0"
+    "sortland.no\0"
+    "dyndns.dappnode.io\0"
+    "biz.az\0"
+    "toon.ehime.jp\0"
+    "webhosting.be\0"
+    "gop\0"
+    "edu.bb\0"
+    "myhome-server.de\0"
+    "minamiyamashiro.kyoto.jp\0"
+    "cc.ne.us\0"
+    "lab.ms\0"
+    "valleedaoste.it\0"
+    "blogspot.lu\0"
+    "mil.za\0"
+    "reggio-calabria.it\0"
+    "phone\0"
+    "horokanai.hokkaido.jp\0"
+    "gniezno.pl\0"
+    "pub.sa\0"
+    "edu.om\0"
+    "storipress.app\0"
+    "edu.ye\0"
+    "edu.ht\0"
+    "cleverapps.io\0"
+    "obu.aichi.jp\0"
+    "611.to\0"
+    "hm.no\0"
+    "xj.cn\0"
+    "est-a-la-maison.com\0"
+    "kep.tr\0"
+    "salat.no\0"
+    "daklak.vn\0"
+    "uy\0"
+    "myforum.community\0"
+    "computer\0"
+    "手机\0"
+    "sz\0"
+    "crafting.xyz\0"
+    "vestre-toten.no\0"
+    "hashikami.aomori.jp\0"
+    "pro.pr\0"
+    "iwata.shizuoka.jp\0"
+    "medecin.km\0"
+    "temasek\0"
+    "info\0"
+    "oshu.iwate.jp\0"
+    "ebino.miyazaki.jp\0"
+    "tobishima.aichi.jp\0"
+    "hatoyama.saitama.jp\0"
+    "sp.gov.br\0"
+    "storj.farm\0"
+    "lib.ok.us\0"
+    "个人.hk\0"
+    "jgora.pl\0"
+    "hyuga.miyazaki.jp\0"
+    "is-a-linux-user.org\0"
+    "cc.la.us\0"
+    "chino.nagano.jp\0"
+    "gs.hl.no\0"
+    "bø.nordland.no\0"
+    "but.jp\0"
+    "trentinsüdtirol.it\0"
+    "cn.vu\0"
+    "fukushima.hokkaido.jp\0"
+    "hosting\0"
+    "services.aero\0"
+    "firm.dk\0"
+    "ddns.me\0"
+    "cbs\0"
+    "com.pk\0"
+    "swidnica.pl\0"
+    "cq.cn\0"
+    "com.gu\0"
+    "*.elb.amazonaws.com.cn\0"
+    "sumoto.hyogo.jp\0"
+    "hobby-site.org\0"
+    "günstigbestellen.de\0"
+    "org.cy\0"
+    "primetel.cloud\0"
+    "am.br\0"
+    "联通\0"
+    "dell-ogliastra.it\0"
+    "stange.no\0"
+    "tt.im\0"
+    "eg\0"
+    "shiriuchi.hokkaido.jp\0"
+    "agro.bj\0"
+    "co.tt\0"
+    "edu.km\0"
+    "fakefur.jp\0"
+    "bolzano-altoadige.it\0"
+    "saijo.ehime.jp\0"
+    "dr.in\0"
+    "sp.leg.br\0"
+    "net.nz\0"
+    "*.backyards.banzaicloud.io\0"
+    "co.mz\0"
+    "com.ps\0"
+    "ac.th\0"
+    "himeshima.oita.jp\0"
+    "centralus.azurestaticapps.net\0"
+    "trader.aero\0"
+    "traniandriabarletta.it\0"
+    "games\0"
+    "na\0"
+    "fukushima.jp\0"
+    "澳門\0"
+    "ooguy.com\0"
+    "onga.fukuoka.jp\0"
+    "co.lc\0"
+    "framer.app\0"
+    "gent\0"
+    "zp.gov.pl\0"
+    "doomdns.org\0"
+    "haugesund.no\0"
+    "okagaki.fukuoka.jp\0"
+    "co.no\0"
+    "edgestack.me\0"
+    "adobeaemcloud.net\0"
+    "yali.mythic-beasts.com\0"
+    "miyazu.kyoto.jp\0"
+    "fr-1.paas.massivegrid.net\0"
+    "okinawa.jp\0"
+    "shiso.hyogo.jp\0"
+    "forum.hu\0"
+    "org.ai\0"
+    "avocat.fr\0"
+    "shiftedit.io\0"
+    "upow.gov.pl\0"
+    "nanao.ishikawa.jp\0"
+    "dnsdojo.com\0"
+    "blogspot.no\0"
+    "dyndns-free.com\0"
+    "minamata.kumamoto.jp\0"
+    "!city.sapporo.jp\0"
+    "it.ao\0"
+    "mamurogawa.yamagata.jp\0"
+    "higashikurume.tokyo.jp\0"
+    "s3.dualstack.ap-south-1.amazonaws.com\0"
+    "co.uz\0"
+    "telebit.app\0"
+    "friulivgiulia.it\0"
+    "hachirogata.akita.jp\0"
+    "webview-assets.cloud9.eu-central-1.amazonaws.com\0"
+    "iwanuma.miyagi.jp\0"
+    "tatar\0"
+    "edu.vn\0"
+    "*.banzai.cloud\0"
+    "ac.nz\0"
+    "ardal.no\0"
+    "int.vn\0"
+    "arts.ro\0"
+    "組織.tw\0"
+    "shouji\0"
+    "dvag\0"
+    "store.ve\0"
+    "løten.no\0"
+    "info.pr\0"
+    "bib.br\0"
+    "shingu.hyogo.jp\0"
+    "is-a-painter.com\0"
+    "is-an-entertainer.com\0"
+    "jp\0"
+    "bronnoy.no\0"
+    "matsubara.osaka.jp\0"
+    "мир.рус\0"
+    "is-an-artist.com\0"
+    "in.na\0"
+    "kadoma.osaka.jp\0"
+    "friuli-veneziagiulia.it\0"
+    "gouv.km\0"
+    "go.kr\0"
+    "et\0"
+    "tjome.no\0"
+    "4lima.at\0"
+    "gokase.miyazaki.jp\0"
+    "krokstadelva.no\0"
+    "domains\0"
+    "dubai\0"
+    "florence.it\0"
+    "個人.hk\0"
+    "røyrvik.no\0"
+    "net.do\0"
+    "me.eu.org\0"
+    "conn.uk\0"
+    "intuit\0"
+    "journal.aero\0"
+    "bosch\0"
+    "joyo.kyoto.jp\0"
+    "canon\0"
+    "santamaria.br\0"
+    "mediatech.by\0"
+    "oke.gov.pl\0"
+    "tsuruta.aomori.jp\0"
+    "dielddanuorri.no\0"
+    "ichinohe.iwate.jp\0"
+    "taishin.fukushima.jp\0"
+    "seranishi.hiroshima.jp\0"
+    "nz\0"
+    "civilaviation.aero\0"
+    "co.je\0"
+    "airtraffic.aero\0"
+    "id.vn\0"
+    "cust.retrosnub.co.uk\0"
+    "raholt.no\0"
+    "2000.hu\0"
+    "is-leet.com\0"
+    "kasukabe.saitama.jp\0"
+    "ug.gov.pl\0"
+    "knowsitall.info\0"
+    "va.it\0"
+    "music\0"
+    "barletta-trani-andria.it\0"
+    "photo\0"
+    "cc.in.us\0"
+    "unazuki.toyama.jp\0"
+    "samnanger.no\0"
+    "firm.nf\0"
+    "net.az\0"
+    "science\0"
+    "sic.it\0"
+    "العليان\0"
+    "shimamoto.osaka.jp\0"
+    "ca.reclaim.cloud\0"
+    "edu.jo\0"
+    "minokamo.gifu.jp\0"
+    "nordeste-idc.saveincloud.net\0"
+    "kr.ua\0"
+    "gov.af\0"
+    "blogspot.mr\0"
+    "tenei.fukushima.jp\0"
+    "daito.osaka.jp\0"
+    "venice.it\0"
+    "net.gy\0"
+    "fla.no\0"
+    "k12.ia.us\0"
+    "passenger-association.aero\0"
+    "stokke.no\0"
+    "grondar.za\0"
+    "敎育.hk\0"
+    "daejeon.kr\0"
+    "reg.dk\0"
+    "clerkstage.app\0"
+    "net.cn\0"
+    "goupile.fr\0"
+    "nordreisa.no\0"
+    "vicenza.it\0"
+    "net.pl\0"
+    "edu.bh\0"
+    "frontier\0"
+    "edu.vu\0"
+    "com.by\0"
+    "ist\0"
+    "q-a.eu.org\0"
+    "arao.kumamoto.jp\0"
+    "langson.vn\0"
+    "cantho.vn\0"
+    "omotego.fukushima.jp\0"
+    "rindal.no\0"
+    "podzone.net\0"
+    "ro.it\0"
+    "store.nf\0"
+    "cc.ri.us\0"
+    "org.ag\0"
+    "homesecuritymac.com\0"
+    "ybo.science\0"
+    "ikeda.gifu.jp\0"
+    "kobayashi.miyazaki.jp\0"
+    "himi.toyama.jp\0"
+    "to.leg.br\0"
+    "koshigaya.saitama.jp\0"
+    "olayangroup\0"
+    "ikeda.nagano.jp\0"
+    "student.aero\0"
+    "fedorainfracloud.org\0"
+    "ghost.io\0"
+    "ing\0"
+    "akabira.hokkaido.jp\0"
+    "choyo.kumamoto.jp\0"
+    "gov.pk\0"
+    "pisz.pl\0"
+    "skiptvet.no\0"
+    "hasuda.saitama.jp\0"
+    "toyone.aichi.jp\0"
+    "uda.nara.jp\0"
+    "cc.wv.us\0"
+    "fi.it\0"
+    "feste-ip.net\0"
+    "us.platform.sh\0"
+    "pages.torproject.net\0"
+    "to.gov.br\0"
+    "pa.gov.br\0"
+    "ap-northeast-2.elasticbeanstalk.com\0"
+    "k12.ks.us\0"
+    "gob.ve\0"
+    "zapto.xyz\0"
+    "windows\0"
+    "in-dsl.net\0"
+    "takarazuka.hyogo.jp\0"
+    "shimonoseki.yamaguchi.jp\0"
+    "com.qa\0"
+    "hachinohe.aomori.jp\0"
+    "123website.ch\0"
+    "mil.br\0"
+    "wolomin.pl\0"
+    "tokushima.jp\0"
+    "amfam\0"
+    "travel\0"
+    "from.hr\0"
+    "romskog.no\0"
+    "prequalifyme.today\0"
+    "soni.nara.jp\0"
+    "gov.km\0"
+    "nesodden.no\0"
+    "co.ir\0"
+    "yamato.fukushima.jp\0"
+    "firenze.it\0"
+    "6g.in\0"
+    "omuta.fukuoka.jp\0"
+    "9guacu.br\0"
+    "forex\0"
+    "bz.it\0"
+    "gov.bm\0"
+    "kyowa.hokkaido.jp\0"
+    "k12.ok.us\0"
+    "pharmacien.fr\0"
+    "lib.nd.us\0"
+    "ss.it\0"
+    "minamidaito.okinawa.jp\0"
+    "community\0"
+    "eu.int\0"
+    "soc.srcf.net\0"
+    "fresenius\0"
+    "gratangen.no\0"
+    "gov.mn\0"
+    "scrapping.cc\0"
+    "farsund.no\0"
+    "locker\0"
+    "eu-west-3.elasticbeanstalk.com\0"
+    "schoolbus.jp\0"
+    "org.uz\0"
+    "セール\0"
+    "chichibu.saitama.jp\0"
+    "nfl\0"
+    "rzgw.gov.pl\0"
+    "ford\0"
+    "tromso.no\0"
+    "sch.jo\0"
+    "nakamura.kochi.jp\0"
+    "firm.ng\0"
+    "rugby\0"
+    "abiko.chiba.jp\0"
+    "ostre-toten.no\0"
+    "zappos\0"
+    "armenia.su\0"
+    "is-very-evil.org\0"
+    "pol.ht\0"
+    "parallel.jp\0"
+    "training\0"
+    "eu-2.evennode.com\0"
+    "chernovtsy.ua\0"
+    "deporte.bo\0"
+    "bbt\0"
+    "spdns.org\0"
+    "cistron.nl\0"
+    "amli.no\0"
+    "maniwa.okayama.jp\0"
+    "hida.gifu.jp\0"
+    "bj\0"
+    "swidnik.pl\0"
+    "tomakomai.hokkaido.jp\0"
+    "nyanta.jp\0"
+    "gu\0"
+    "itigo.jp\0"
+    "edu.kn\0"
+    "diet\0"
+    "software\0"
+    "budejju.no\0"
+    "edu.ms\0"
+    "ismaili\0"
+    "hkt\0"
+    "nahari.kochi.jp\0"
+    "per.la\0"
+    "gs.fm.no\0"
+    "misawa.aomori.jp\0"
+    "saobernardo.br\0"
+    "123miweb.es\0"
+    "schule\0"
+    "vardø.no\0"
+    "nakagawa.tokushima.jp\0"
+    "tsuyama.okayama.jp\0"
+    "perma.jp\0"
+    "diy\0"
+    "kawaba.gunma.jp\0"
+    "ákŋoluokta.no\0"
+    "buzen.fukuoka.jp\0"
+    "nirasaki.yamanashi.jp\0"
+    "brønnøysund.no\0"
+    "mragowo.pl\0"
+    "hábmer.no\0"
+    "blogspot.jp\0"
+    "bozen-sudtirol.it\0"
+    "abudhabi\0"
+    "drr.ac\0"
+    "lel.br\0"
+    "meloy.no\0"
+    "usui.fukuoka.jp\0"
+    "jelastic.regruhosting.ru\0"
+    "oarai.ibaraki.jp\0"
+    "koganei.tokyo.jp\0"
+    "info.ht\0"
+    "schwarz\0"
+    "kamo.niigata.jp\0"
+    "nanporo.hokkaido.jp\0"
+    "hino.tokyo.jp\0"
+    "hungry.jp\0"
+    "edu.gt\0"
+    "4.bg\0"
+    "solund.no\0"
+    "barum.no\0"
+    "kamiichi.toyama.jp\0"
+    "lamer\0"
+    "org.tm\0"
+    "dabur\0"
+    "ms\0"
+    "enebakk.no\0"
+    "higashi.fukuoka.jp\0"
+    "yamada.fukuoka.jp\0"
+    "pagespeedmobilizer.com\0"
+    "router.management\0"
+    "couchpotatofries.org\0"
+    "shop.th\0"
+    "web.za\0"
+    "!city.kobe.jp\0"
+    "in.ni\0"
+    "ann-arbor.mi.us\0"
+    "coop.ar\0"
+    "beardu.no\0"
+    "is-a-bulls-fan.com\0"
+    "k12.ky.us\0"
+    "il\0"
+    "lib.ms.us\0"
+    "rest\0"
+    "dyn.home-webserver.de\0"
+    "kitanakagusuku.okinawa.jp\0"
+    "shimogo.fukushima.jp\0"
+    "gotpantheon.com\0"
+    "mil.jo\0"
+    "com.sl\0"
+    "org.in\0"
+    "int.ru\0"
+    "egoism.jp\0"
+    "lib.pr.us\0"
+    "اليمن\0"
+    "b.bg\0"
+    "sbi\0"
+    "experts-comptables.fr\0"
+    "askøy.no\0"
+    "cd\0"
+    "cn-north-1.eb.amazonaws.com.cn\0"
+    "oppegard.no\0"
+    "lebork.pl\0"
+    "ninohe.iwate.jp\0"
+    "rikuzentakata.iwate.jp\0"
+    "med.ec\0"
+    "jdevcloud.com\0"
+    "org.bm\0"
+    "no\0"
+    "engerdal.no\0"
+    "ogawa.nagano.jp\0"
+    "minakami.gunma.jp\0"
+    "opensocial.site\0"
+    "eigersund.no\0"
+    "kawaminami.miyazaki.jp\0"
+    "ch.tc\0"
+    "cern\0"
+    "webview-assets.cloud9.us-east-1.amazonaws.com\0"
+    "tinn.no\0"
+    "webview-assets.aws-cloud9.eu-north-1.amazonaws.com\0"
+    "yamamoto.miyagi.jp\0"
+    "aero\0"
+    "koriyama.fukushima.jp\0"
+    "blogdns.com\0"
+    "messina.it\0"
+    "higashisumiyoshi.osaka.jp\0"
+    "co.ni\0"
+    "presse.ml\0"
+    "crimea.ua\0"
+    "h.bg\0"
+    "edu.mx\0"
+    "fg.it\0"
+    "misugi.mie.jp\0"
+    "mil.ph\0"
+    "dk\0"
+    "عمان\0"
+    "ai\0"
+    "meet\0"
+    "org.ng\0"
+    "staples\0"
+    "funagata.yamagata.jp\0"
+    "friuliveneziagiulia.it\0"
+    "lindås.no\0"
+    "webview-assets.aws-cloud9.ap-northeast-2.amazonaws.com\0"
+    "lomza.pl\0"
+    "ah.cn\0"
+    "friulivegiulia.it\0"
+    "moss.no\0"
+    "edu.bn\0"
+    "slask.pl\0"
+    "gx.cn\0"
+    "net.ht\0"
+    "ac.ni\0"
+    "sassari.it\0"
+    "barsy.club\0"
+    "慈善\0"
+    "sowa.ibaraki.jp\0"
+    "opole.pl\0"
+    "from-mn.com\0"
+    "miyashiro.saitama.jp\0"
+    "toyotomi.hokkaido.jp\0"
+    "keymachine.de\0"
+    "ujitawara.kyoto.jp\0"
+    "jo\0"
+    "mil.co\0"
+    "takikawa.hokkaido.jp\0"
+    "market\0"
+    "jeju.kr\0"
+    "biz.ni\0"
+    "jessheim.no\0"
+    "rzeszow.pl\0"
+    "cpa.pro\0"
+    "mini\0"
+    "teaches-yoga.com\0"
+    "trieste.it\0"
+    "sor-varanger.no\0"
+    "click\0"
+    "shop.hu\0"
+    "tk\0"
+    "nz.eu.org\0"
+    "ferrara.it\0"
+    "fussa.tokyo.jp\0"
+    "arpa\0"
+    "lodi.it\0"
+    "netlify.app\0"
+    "淡马锡\0"
+    "sth.ac.at\0"
+    "net.al\0"
+    "noticeable.news\0"
+    "kagami.kochi.jp\0"
+    "seek\0"
+    "鳥取.jp\0"
+    "شبكة\0"
+    "mitsubishi\0"
+    "pussycat.jp\0"
+    "k12.ma.us\0"
+    "lidl\0"
+    "pohl\0"
+    "nakanoto.ishikawa.jp\0"
+    "shop\0"
+    "catfood.jp\0"
+    "jor.br\0"
+    "ファッション\0"
+    "elementor.cloud\0"
+    "katano.osaka.jp\0"
+    "com.na\0"
+    "kagawa.jp\0"
+    "deatnu.no\0"
+    "gov.tt\0"
+    "busan.kr\0"
+    "cisco\0"
+    "gob.pk\0"
+    "gv.at\0"
+    "dattolocal.net\0"
+    "ac.zw\0"
+    "jelastic.team\0"
+    "fuchu.hiroshima.jp\0"
+    "soy\0"
+    "pisa.it\0"
+    "na.it\0"
+    "*.builder.code.com\0"
+    "overhalla.no\0"
+    "homebuilt.aero\0"
+    "opal.ne.jp\0"
+    "公益\0"
+    "ski.no\0"
+    "is-a-techie.com\0"
+    "ichikawa.hyogo.jp\0"
+    "com.sd\0"
+    "yolasite.com\0"
+    "eidfjord.no\0"
+    "eu.platform.sh\0"
+    "volkswagen\0"
+    "clerk.app\0"
+    "k12.wy.us\0"
+    "vacations\0"
+    "namsos.no\0"
+    "dish\0"
+    "rsvp\0"
+    "aero.mv\0"
+    "rendalen.no\0"
+    "go.tz\0"
+    "tushu\0"
+    "spacekit.io\0"
+    "in-dsl.org\0"
+    "kikugawa.shizuoka.jp\0"
+    "tranby.no\0"
+    "barsy.co.uk\0"
+    "rankoshi.hokkaido.jp\0"
+    "iide.yamagata.jp\0"
+    "vfs.cloud9.eu-west-2.amazonaws.com\0"
+    "ed.pw\0"
+    "je\0"
+    "miasa.nagano.jp\0"
+    "pf\0"
+    "takayama.gifu.jp\0"
+    "net.br\0"
+    "onflashdrive.app\0"
+    "namegata.ibaraki.jp\0"
+    "org.bo\0"
+    "hs.run\0"
+    "org.my\0"
+    "hofu.yamaguchi.jp\0"
+    "today\0"
+    "com.so\0"
+    "urbinopesaro.it\0"
+    "panel.gg\0"
+    "førde.no\0"
+    "noho.st\0"
+    "mito.ibaraki.jp\0"
+    "nh-serv.co.uk\0"
+    "omaezaki.shizuoka.jp\0"
+    "songdalen.no\0"
+    "js.wpenginepowered.com\0"
+    "長野.jp\0"
+    "guardian\0"
+    "delhi.in\0"
+    "kisofukushima.nagano.jp\0"
+    "aso.kumamoto.jp\0"
+    "kicks-ass.org\0"
+    "com.ar\0"
+    "lug.org.uk\0"
+    "readthedocs.io\0"
+    "or.ke\0"
+    "wada.nagano.jp\0"
+    "catholic\0"
+    "aol\0"
+    "video.hu\0"
+    "org.ru\0"
+    "nakadomari.aomori.jp\0"
+    "hægebostad.no\0"
+    "lib.co.us\0"
+    "circle\0"
+    "bs\0"
+    "*.frusky.de\0"
+    "oygarden.no\0"
+    "aurskog-høland.no\0"
+    "time.no\0"
+    "re\0"
+    "co.financial\0"
+    "sera.hiroshima.jp\0"
+    "com.ru\0"
+    "minamitane.kagoshima.jp\0"
+    "asso.gp\0"
+    "kanuma.tochigi.jp\0"
+    "ne.ke\0"
+    "net.dz\0"
+    "gr.eu.org\0"
+    "instances.spawn.cc\0"
+    "ringsaker.no\0"
+    "1337.pictures\0"
+    "from-pa.com\0"
+    "edu.pl\0"
+    "yatsushiro.kumamoto.jp\0"
+    "tur.ar\0"
+    "media\0"
+    "macapa.br\0"
+    "zm\0"
+    "versicherung\0"
+    "iliadboxos.it\0"
+    "oppegård.no\0"
+    "tajimi.gifu.jp\0"
+    "tv.br\0"
+    "awsmppl.com\0"
+    "gs.nl.no\0"
+    "com.cn\0"
+    "hasura.app\0"
+    "eun.eg\0"
+    "sa\0"
+    "nishitosa.kochi.jp\0"
+    "kepno.pl\0"
+    "gov.zm\0"
+    "tlon.network\0"
+    "malvik.no\0"
+    "porsgrunn.no\0"
+    "m.bg\0"
+    "info.mv\0"
+    "orsites.com\0"
+    "kred\0"
+    "kitayama.wakayama.jp\0"
+    "us-west-2.elasticbeanstalk.com\0"
+    "goshiki.hyogo.jp\0"
+    "mil.ge\0"
+    "øvre-eiker.no\0"
+    "co.business\0"
+    "edu.bj\0"
+    "gobo.wakayama.jp\0"
+    "u.se\0"
+    "fjaler.no\0"
+    "blogsite.xyz\0"
+    "pd.it\0"
+    "nobeoka.miyazaki.jp\0"
+    "gen.mi.us\0"
+    "fuel.aero\0"
+    "secure\0"
+    "mymediapc.net\0"
+    "go.cr\0"
+    "digital\0"
+    "kh.ua\0"
+    "org.mg\0"
+    "from-mo.com\0"
+    "abu.yamaguchi.jp\0"
+    "memset.net\0"
+    "pecori.jp\0"
+    "rexroth\0"
+    "i234.me\0"
+    "bolt.hu\0"
+    "skaun.no\0"
+    "matta-varjjat.no\0"
+    "ag.it\0"
+    "hoylandet.no\0"
+    "architectes.bj\0"
+    "selbu.no\0"
+    "maif\0"
+    "o0o0.jp\0"
+    "nikolaev.ua\0"
+    "edu.sv\0"
+    "dni.us\0"
+    "lg.ua\0"
+    "kita.osaka.jp\0"
+    "virtual-user.de\0"
+    "now-dns.net\0"
+    "tashkent.su\0"
+    "debian.net\0"
+    "gle\0"
+    "wafflecell.com\0"
+    "averøy.no\0"
+    "مصر\0"
+    "fujitsu\0"
+    "飞利浦\0"
+    "sumoto.kumamoto.jp\0"
+    "kameoka.kyoto.jp\0"
+    "nieruchomosci.pl\0"
+    "consulting.aero\0"
+    "dojin.com\0"
+    "ic.gov.pl\0"
+    "ලංකා\0"
+    "varggat.no\0"
+    "webview-assets.aws-cloud9.ap-east-1.amazonaws.com\0"
+    "huissier-justice.fr\0"
+    "mihara.hiroshima.jp\0"
+    "bifuka.hokkaido.jp\0"
+    "bielawa.pl\0"
+    "small-web.org\0"
+    "priv.no\0"
+    "sykkylven.no\0"
+    "tohnosho.chiba.jp\0"
+    "ba\0"
+    "takinoue.hokkaido.jp\0"
+    "barefoot\0"
+    "lamdong.vn\0"
+    "giske.no\0"
+    "hicam.net\0"
+    "dot\0"
+    "ltd.co.im\0"
+    "bplaced.net\0"
+    "health.nz\0"
+    "user.party.eus\0"
+    "lesja.no\0"
+    "青森.jp\0"
+    "valledaosta.it\0"
+    "co.pw\0"
+    "independent-review.uk\0"
+    "dienbien.vn\0"
+    "affinitylottery.org.uk\0"
+    "edu.bo\0"
+    "map.fastlylb.net\0"
+    "blue\0"
+    "takahama.aichi.jp\0"
+    "nl-ams-1.baremetal.scw.cloud\0"
+    "øystre-slidre.no\0"
+    "lunner.no\0"
+    "us.na\0"
+    "torsken.no\0"
+    "pics\0"
+    "mihama.fukui.jp\0"
+    "porn\0"
+    "io.vn\0"
+    "cc.il.us\0"
+    "ravendb.cloud\0"
+    "fi\0"
+    "isa-hockeynut.com\0"
+    "123homepage.it\0"
+    "msk.su\0"
+    "edu.ng\0"
+    "aarborte.no\0"
+    "takagi.nagano.jp\0"
+    "is-uberleet.com\0"
+    "name.eg\0"
+    "trøgstad.no\0"
+    "yatomi.aichi.jp\0"
+    "channel\0"
+    "imamat\0"
+    "filegear-sg.me\0"
+    "taku.saga.jp\0"
+    "nord-odal.no\0"
+    "press.se\0"
+    "earth\0"
+    "uto.kumamoto.jp\0"
+    "iwate.iwate.jp\0"
+    "flir\0"
+    "taiwa.miyagi.jp\0"
+    "adult.ht\0"
+    "schmidt\0"
+    "meløy.no\0"
+    "uz.ua\0"
+    "org.tn\0"
+    "worse-than.tv\0"
+    "usa.oita.jp\0"
+    "abr.it\0"
+    "nanjo.okinawa.jp\0"
+    "flesberg.no\0"
+    "nodes.k8s.pl-waw.scw.cloud\0"
+    "com.mo\0"
+    "com.tn\0"
+    "medicina.bo\0"
+    "arakawa.tokyo.jp\0"
+    "shinjo.okayama.jp\0"
+    "art.pl\0"
+    "ml\0"
+    "akamaihd.net\0"
+    "toya.hokkaido.jp\0"
+    "kurobe.toyama.jp\0"
+    "tas.edu.au\0"
+    "bmoattachments.org\0"
+    "osakasayama.osaka.jp\0"
+    "org.cv\0"
+    "shinyoshitomi.fukuoka.jp\0"
+    "dynns.com\0"
+    "diamonds\0"
+    "daplie.me\0"
+    "gov.sa\0"
+    "fl.us\0"
+    "icu\0"
+    "or.bi\0"
+    "br\0"
+    "edu.ru\0"
+    "okutama.tokyo.jp\0"
+    "kamitonda.wakayama.jp\0"
+    "*.compute-1.amazonaws.com\0"
+    "tn.us\0"
+    "zpisdn.gov.pl\0"
+    "art.sn\0"
+    "ikusaka.nagano.jp\0"
+    "網络.hk\0"
+    "is-a-player.com\0"
+    "nango.fukushima.jp\0"
+    "s3-us-west-1.amazonaws.com\0"
+    "pi.leg.br\0"
+    "us-3.evennode.com\0"
+    "cloudns.in\0"
+    "baclieu.vn\0"
+    "flatanger.no\0"
+    "ok.us\0"
+    "stage.nodeart.io\0"
+    "volda.no\0"
+    "contact\0"
+    "info.in\0"
+    "is-a-anarchist.com\0"
+    "storage.yandexcloud.net\0"
+    "pro\0"
+    "网络.cn\0"
+    "vang.no\0"
+    "googleapis.com\0"
+    "*.bd\0"
+    "mobi.ng\0"
+    "consulting\0"
+    "cc.mn.us\0"
+    "barsy.eu\0"
+    "barsyonline.co.uk\0"
+    "leksvik.no\0"
+    "biz.dk\0"
+    "fujiyoshida.yamanashi.jp\0"
+    "nh.us\0"
+    "k12.tn.us\0"
+    "сайт\0"
+    "k8s.nl-ams.scw.cloud\0"
+    "ce.gov.br\0"
+    "ozu.ehime.jp\0"
+    "webview-assets.cloud9.ap-south-1.amazonaws.com\0"
+    "minano.saitama.jp\0"
+    "taiki.hokkaido.jp\0"
+    "s3.dualstack.eu-west-1.amazonaws.com\0"
+    "akrehamn.no\0"
+    "iiyama.nagano.jp\0"
+    "agency\0"
+    "physio\0"
+    "in.rs\0"
+    "oia.gov.pl\0"
+    "co.ke\0"
+    "itako.ibaraki.jp\0"
+    "nome.pt\0"
+    "brother\0"
+    "aknoluokta.no\0"
+    "ne.us\0"
+    "graphox.us\0"
+    "gdansk.pl\0"
+    "net.ve\0"
+    "se.eu.org\0"
+    "cc.pa.us\0"
+    "fantasyleague.cc\0"
+    "mt.gov.br\0"
+    "thanhhoa.vn\0"
+    "tc\0"
+    "seidat.net\0"
+    "電訊盈科\0"
+    "dyndns.ws\0"
+    "tolga.no\0"
+    "alpha.bounty-full.com\0"
+    "pa.it\0"
+    "tarnobrzeg.pl\0"
+    "pvt.k12.ma.us\0"
+    "ps\0"
+    "ny-2.paas.massivegrid.net\0"
+    "公司.cn\0"
+    "cc.nc.us\0"
+    "oristano.it\0"
+    "org.dz\0"
+    "arq.br\0"
+    "telebit.io\0"
+    "福島.jp\0"
+    "hanoi.vn\0"
+    "flop.jp\0"
+    "foggia.it\0"
+    "kitaura.miyazaki.jp\0"
+    "sicily.it\0"
+    "tx.us\0"
+    "githubpreview.dev\0"
+    "gunma.jp\0"
+    "gjerstad.no\0"
+    "mycloud.by\0"
+    "glitch.me\0"
+    "abo.pa\0"
+    "kani.gifu.jp\0"
+    "toyama.jp\0"
+    "org.ac\0"
+    "gives\0"
+    "boo\0"
+    "gov.pn\0"
+    "valle-daosta.it\0"
+    "ngrok.dev\0"
+    "cd.eu.org\0"
+    "tuyenquang.vn\0"
+    "sb.ua\0"
+    "kamoenai.hokkaido.jp\0"
+    "jele.cloud\0"
+    "oumu.hokkaido.jp\0"
+    "hzc.io\0"
+    "co.ao\0"
+    "東京.jp\0"
+    "gov.lt\0"
+    "va.no\0"
+    "edu.mo\0"
+    "a.prod.fastly.net\0"
+    "info.sd\0"
+    "seki.gifu.jp\0"
+    "ltda\0"
+    "okoppe.hokkaido.jp\0"
+    "kozow.com\0"
+    "新潟.jp\0"
+    "sandnessjøen.no\0"
+    "musashino.tokyo.jp\0"
+    "bid\0"
+    "nyan.to\0"
+    "co\0"
+    "yanagawa.fukuoka.jp\0"
+    "nsupdate.info\0"
+    "dyndns-server.com\0"
+    "official.ec\0"
+    "kawakami.nagano.jp\0"
+    "custom.metacentrum.cz\0"
+    "beta.tailscale.net\0"
+    "americanexpress\0"
+    "tech.orange\0"
+    "inatsuki.fukuoka.jp\0"
+    "hámmárfeasta.no\0"
+    "miasta.pl\0"
+    "пр.срб\0"
+    "feira.br\0"
+    "flowers\0"
+    "yokoshibahikari.chiba.jp\0"
+    "pimienta.org\0"
+    "edu.gh\0"
+    "vinnytsia.ua\0"
+    "from-ma.com\0"
+    "withyoutube.com\0"
+    "krasnik.pl\0"
+    "com.uz\0"
+    "mizunami.gifu.jp\0"
+    "typedream.app\0"
+    "legal\0"
+    "hanawa.fukushima.jp\0"
+    "ed.jp\0"
+    "backplaneapp.io\0"
+    "org.ki\0"
+    "khplay.nl\0"
+    "bot\0"
+    "fhs.no\0"
+    "chillout.jp\0"
+    "imakane.hokkaido.jp\0"
+    "kimitsu.chiba.jp\0"
+    "webview-assets.aws-cloud9.us-west-1.amazonaws.com\0"
+    "me.uk\0"
+    "caserta.it\0"
+    "mobi\0"
+    "me.tz\0"
+    "cn\0"
+    "中國\0"
+    "viajes\0"
+    "com.sh\0"
+    "mint\0"
+    "edu.it\0"
+    "biz.ua\0"
+    "hakusan.ishikawa.jp\0"
+    "weir\0"
+    "date.fukushima.jp\0"
+    "makurazaki.kagoshima.jp\0"
+    "tohma.hokkaido.jp\0"
+    "nt.no\0"
+    "ch.it\0"
+    "js.org\0"
+    "otaru.hokkaido.jp\0"
+    "gamagori.aichi.jp\0"
+    "xin\0"
+    "edu.eu.org\0"
+    "s3-eu-west-3.amazonaws.com\0"
+    "oji.nara.jp\0"
+    "myoko.niigata.jp\0"
+    "*.moonscale.io\0"
+    "ms.us\0"
+    "chu.jp\0"
+    "ceo\0"
+    "გე\0"
+    "guru\0"
+    "livorno.it\0"
+    "arai.shizuoka.jp\0"
+    "africa.com\0"
+    "tokai.aichi.jp\0"
+    "org.vi\0"
+    "kushimoto.wakayama.jp\0"
+    "pr.us\0"
+    "poa.br\0"
+    "ui.nabu.casa\0"
+    "joetsu.niigata.jp\0"
+    "ed.ao\0"
+    "me\0"
+    "is-saved.org\0"
+    "家電\0"
+    "barsy.de\0"
+    "guam.gu\0"
+    "barsy.pro\0"
+    "style\0"
+    "*.nom.br\0"
+    "wy.us\0"
+    "blogspot.nl\0"
+    "ac.cy\0"
+    "ממשל.ישראל\0"
+    "myspreadshop.de\0"
+    "co.in\0"
+    "bank\0"
+    "co.im\0"
+    "morena.br\0"
+    "x0.to\0"
+    "lefrak\0"
+    "fast\0"
+    "shimodate.ibaraki.jp\0"
+    "edu.af\0"
+    "gt\0"
+    "redstone\0"
+    "gov.ac\0"
+    "gs.svalbard.no\0"
+    "asn.lv\0"
+    "sør-aurdal.no\0"
+    "ocelot.mythic-beasts.com\0"
+    "ac.gn\0"
+    "kisosaki.mie.jp\0"
+    "okuizumo.shimane.jp\0"
+    "gov.bn\0"
+    "supabase.in\0"
+    "schaeffler\0"
+    "watches\0"
+    "free.hr\0"
+    "reservd.disrec.thingdust.io\0"
+    "evenášši.no\0"
+    "yokohama\0"
+    "বাংলা\0"
+    "navy\0"
+    "googlecode.com\0"
+    "condos\0"
+    "umig.gov.pl\0"
+    "ichikai.tochigi.jp\0"
+    "kitamoto.saitama.jp\0"
+    "lib.va.us\0"
+    "st.no\0"
+    "com.sg\0"
+    "fhv.se\0"
+    "asso.dz\0"
+    "zgora.pl\0"
+    "flap.id\0"
+    "ddns5.com\0"
+    "ftpaccess.cc\0"
+    "tarama.okinawa.jp\0"
+    "chirurgiens-dentistes-en-france.fr\0"
+    "org.mz\0"
+    "forsand.no\0"
+    "shimizu.shizuoka.jp\0"
+    "webview-assets.cloud9.us-west-1.amazonaws.com\0"
+    "curitiba.br\0"
+    "oya.to\0"
+    "lucania.it\0"
+    "vfs.cloud9.us-west-2.amazonaws.com\0"
+    "randaberg.no\0"
+    "net.ai\0"
+    "shioya.tochigi.jp\0"
+    "nagato.yamaguchi.jp\0"
+    "suldal.no\0"
+    "fbxos.fr\0"
+    "info.hu\0"
+    "neustar\0"
+    "katsuura.chiba.jp\0"
+    "myactivedirectory.com\0"
+    "gs.of.no\0"
+    "the.br\0"
+    "virtualuser.de\0"
+    "org.py\0"
+    "institute\0"
+    "mayfirst.info\0"
+    "voorloper.cloud\0"
+    "nagahama.shiga.jp\0"
+    "fusa.no\0"
+    "sørum.no\0"
+    "iopsys.se\0"
+    "mil.tm\0"
+    "pnc\0"
+    "org.zm\0"
+    "meiwa.mie.jp\0"
+    "bálát.no\0"
+    "novara.it\0"
+    "edu.et\0"
+    "vfs.cloud9.us-east-1.amazonaws.com\0"
+    "donna.no\0"
+    "jaworzno.pl\0"
+    "hareid.no\0"
+    "chiryu.aichi.jp\0"
+    "*.compute.amazonaws.com\0"
+    "med\0"
+    "教育.hk\0"
+    "asaminami.hiroshima.jp\0"
+    "minamiashigara.kanagawa.jp\0"
+    "kamigori.hyogo.jp\0"
+    "trentino-alto-adige.it\0"
+    "marche.it\0"
+    "homedepot\0"
+    "lebesby.no\0"
+    "edu.sn\0"
+    "holmestrand.no\0"
+    "64-b.it\0"
+    "gmx\0"
+    "repl.co\0"
+    "ogliastra.it\0"
+    "cn.in\0"
+    "messwithdns.com\0"
+    "栃木.jp\0"
+    "sub.jp\0"
+    "bz\0"
+    "gift\0"
+    "myspreadshop.pl\0"
+    "hol.no\0"
+    "gon.pk\0"
+    "grozny.su\0"
+    "shiftcrypto.io\0"
+    "lotte\0"
+    "pro.na\0"
+    "aju.br\0"
+    "org.gi\0"
+    "patria.bo\0"
+    "from-oh.com\0"
+    "søndre-land.no\0"
+    "plo.ps\0"
+    "royrvik.no\0"
+    "miami\0"
+    "bona.jp\0"
+    "kinder\0"
+    "soundcast.me\0"
+    "konyvelo.hu\0"
+    "gov.gd\0"
+    "v.ua\0"
+    "hk.cn\0"
+    "grocery\0"
+    "ru\0"
+    "net.sc\0"
+    "int.tt\0"
+    "rodoy.no\0"
+    "tr.eu.org\0"
+    "ipifony.net\0"
+    "mihama.wakayama.jp\0"
+    "showa.fukushima.jp\0"
+    "myspreadshop.fi\0"
+    "viterbo.it\0"
+    "try-snowplow.com\0"
+    "kawajima.saitama.jp\0"
+    "home-webserver.de\0"
+    "nikon\0"
+    "lib.nj.us\0"
+    "net.tw\0"
+    "ts.it\0"
+    "omi.nagano.jp\0"
+    "simplesite.com\0"
+    "co.ci\0"
+    "homeftp.org\0"
+    "gotsu.shimane.jp\0"
+    "hughes\0"
+    "l.se\0"
+    "kuju.oita.jp\0"
+    "in-berlin.de\0"
+    "yoshioka.gunma.jp\0"
+    "tonkotsu.jp\0"
+    "jc.neen.it\0"
+    "chiyoda.tokyo.jp\0"
+    "or.jp\0"
+    "røros.no\0"
+    "vlog.br\0"
+    "dev\0"
+    "hioki.kagoshima.jp\0"
+    "london.cloudapps.digital\0"
+    "net.za\0"
+    "kitchen\0"
+    "yonaguni.okinawa.jp\0"
+    "haebaru.okinawa.jp\0"
+    "tm.dz\0"
+    "assabu.hokkaido.jp\0"
+    "gorizia.it\0"
+    "nesset.no\0"
+    "energy\0"
+    "mil.uy\0"
+    "edgecompute.app\0"
+    "bcn\0"
+    "mil.to\0"
+    "uenohara.yamanashi.jp\0"
+    "org.bz\0"
+    "čáhcesuolo.no\0"
+    "kasamatsu.gifu.jp\0"
+    "firm.ht\0"
+    "fastvps.host\0"
+    "bådåddjå.no\0"
+    "nu.it\0"
+    "jls-sto3.elastx.net\0"
+    "phx.enscaled.us\0"
+    "keliweb.cloud\0"
+    "hiphop\0"
+    "yusui.kagoshima.jp\0"
+    "fastly-terrarium.com\0"
+    "turystyka.pl\0"
+    "potenza.it\0"
+    "iwama.ibaraki.jp\0"
+    "yamaxun\0"
+    "ks.ua\0"
+    "name.tr\0"
+    "vennesla.no\0"
+    "serveminecraft.net\0"
+    "mandal.no\0"
+    "ivano-frankivsk.ua\0"
+    "kainan.wakayama.jp\0"
+    "discount\0"
+    "moka.tochigi.jp\0"
+    "lolitapunk.jp\0"
+    "azumino.nagano.jp\0"
+    "rgr.jp\0"
+    "okinawa\0"
+    "mátta-várjjat.no\0"
+    "government.aero\0"
+    "lynx.mythic-beasts.com\0"
+    "onavstack.net\0"
+    "gs.hm.no\0"
+    "vu\0"
+    "inf.cu\0"
+    "net.ss\0"
+    "act.au\0"
+    "nis.za\0"
+    "amagasaki.hyogo.jp\0"
+    "hotelwithflight.com\0"
+    "høyanger.no\0"
+    "lon-2.paas.massivegrid.net\0"
+    "nannestad.no\0"
+    "cc.pr.us\0"
+    "cg\0"
+    "net.sh\0"
+    "webview-assets.cloud9.ap-northeast-1.amazonaws.com\0"
+    "pro.typeform.com\0"
+    "alp1.ae.flow.ch\0"
+    "iz.hr\0"
+    "nishiawakura.okayama.jp\0"
+    "barsy.menu\0"
+    "com.io\0"
+    "k12.tr\0"
+    "zp.ua\0"
+    "miniserver.com\0"
+    "kasugai.aichi.jp\0"
+    "yokoze.saitama.jp\0"
+    "gjemnes.no\0"
+    "cya.gg\0"
+    "hoabinh.vn\0"
+    "komatsushima.tokushima.jp\0"
+    "from-ar.com\0"
+    "bato.tochigi.jp\0"
+    "catania.it\0"
+    "tj\0"
+    "info.tr\0"
+    "*.kobe.jp\0"
+    "beppu.oita.jp\0"
+    "te.ua\0"
+    "s3.dualstack.us-east-1.amazonaws.com\0"
+    "ac.mw\0"
+    "eaton.mi.us\0"
+    "augustow.pl\0"
+    "zara\0"
+    "1.azurestaticapps.net\0"
+    "itoman.okinawa.jp\0"
+    "dyn-o-saur.com\0"
+    "noboribetsu.hokkaido.jp\0"
+    "tadaoka.osaka.jp\0"
+    "lib.ak.us\0"
+    "higashiura.aichi.jp\0"
+    "walmart\0"
+    "eng.br\0"
+    "iheya.okinawa.jp\0"
+    "ayagawa.kagawa.jp\0"
+    "matsushige.tokushima.jp\0"
+    "s3-website-eu-west-1.amazonaws.com\0"
+    "construction\0"
+    "báidár.no\0"
+    "isehara.kanagawa.jp\0"
+    "edu.ky\0"
+    "gmo\0"
+    "coop.mv\0"
+    "servebeer.com\0"
+    "schulserver.de\0"
+    "haugiang.vn\0"
+    "uchiko.ehime.jp\0"
+    "za.org\0"
+    "thick.jp\0"
+    "dnsup.net\0"
+    "urown.cloud\0"
+    "familyds.net\0"
+    "divtasvuodna.no\0"
+    "net.uk\0"
+    "latina.it\0"
+    "spdns.de\0"
+    "com.sn\0"
+    "kontum.vn\0"
+    "lillehammer.no\0"
+    "אקדמיה.ישראל\0"
+    "suedtirol.it\0"
+    "tokushima.tokushima.jp\0"
+    "tech\0"
+    "bd.se\0"
+    "crew.aero\0"
+    "chikugo.fukuoka.jp\0"
+    "red.sv\0"
+    "accident-prevention.aero\0"
+    "forli-cesena.it\0"
+    "panasonic\0"
+    "pictures\0"
+    "gildeskal.no\0"
+    "jambyl.su\0"
+    "kaho.fukuoka.jp\0"
+    "nishiokoppe.hokkaido.jp\0"
+    "nagaoka.niigata.jp\0"
+    "dog\0"
+    "weber\0"
+    "redumbrella\0"
+    "s3-ap-northeast-2.amazonaws.com\0"
+    "x.se\0"
+    "kmpsp.gov.pl\0"
+    "is-a-candidate.org\0"
+    "auction\0"
+    "dyndns1.de\0"
+    "tkmaxx\0"
+    "net.gt\0"
+    "k12.il.us\0"
+    "vfs.cloud9.af-south-1.amazonaws.com\0"
+    "rv.ua\0"
+    "pm\0"
+    "ap-south-1.elasticbeanstalk.com\0"
+    "klepp.no\0"
+    "мск.рус\0"
+    "tuleap-partners.com\0"
+    "k12.ut.us\0"
+    "eek.jp\0"
+    "myds.me\0"
+    "kumagaya.saitama.jp\0"
+    "is-a-therapist.com\0"
+    "rocky.page\0"
+    "skedsmokorset.no\0"
+    "info.bo\0"
+    "nhk\0"
+    "omg.lol\0"
+    "naples.it\0"
+    "fnd.br\0"
+    "k12.vi.us\0"
+    "eniwa.hokkaido.jp\0"
+    "aerobatic.aero\0"
+    "徳島.jp\0"
+    "other.nf\0"
+    "bom\0"
+    "koga.ibaraki.jp\0"
+    "us.ax\0"
+    "nom.co\0"
+    "ashiya.fukuoka.jp\0"
+    "wa.au\0"
+    "prochowice.pl\0"
+    "user.webaccel.jp\0"
+    "nesna.no\0"
+    "treviso.it\0"
+    "capital\0"
+    "dvrcam.info\0"
+    "trentinosud-tirol.it\0"
+    "shopware.store\0"
+    "minamimaki.nagano.jp\0"
+    "uol\0"
+    "pvh.br\0"
+    "builtwithdark.com\0"
+    "myspreadshop.fr\0"
+    "tsurugi.ishikawa.jp\0"
+    "equipment.aero\0"
+    "com.ro\0"
+    "gov.jo\0"
+    "minoh.osaka.jp\0"
+    "sew\0"
+    "gov.mw\0"
+    "sauda.no\0"
+    "d.se\0"
+    "edu.au\0"
+    "aus.basketball\0"
+    "imizu.toyama.jp\0"
+    "com.co\0"
+    "girly.jp\0"
+    "hl.no\0"
+    "bas.it\0"
+    "aki.kochi.jp\0"
+    "pin\0"
+    "hekinan.aichi.jp\0"
+    "fauske.no\0"
+    "dyroy.no\0"
+    "hr.eu.org\0"
+    "net.qa\0"
+    "cv\0"
+    "enna.it\0"
+    "itayanagi.aomori.jp\0"
+    "logistics.aero\0"
+    "aeg\0"
+    "muroto.kochi.jp\0"
+    "protection\0"
+    "мкд\0"
+    "lenug.su\0"
+    "shichikashuku.miyagi.jp\0"
+    "indie.porn\0"
+    "matsusaka.mie.jp\0"
+    "servegame.com\0"
+    "platform0.app\0"
+    "cloudns.cc\0"
+    "br.it\0"
+    "is-into-cars.com\0"
+    "com.ng\0"
+    "bi\0"
+    "tranibarlettaandria.it\0"
+    "skygearapp.com\0"
+    "mil.kg\0"
+    "vfs.cloud9.ap-northeast-1.amazonaws.com\0"
+    "edu.st\0"
+    "bytom.pl\0"
+    "s3.dualstack.eu-west-3.amazonaws.com\0"
+    "higashiomi.shiga.jp\0"
+    "bg.eu.org\0"
+    "mymailer.com.tw\0"
+    "target\0"
+    "bahccavuotna.no\0"
+    "blogspot.sn\0"
+    "inc\0"
+    "kuki.saitama.jp\0"
+    "nishiaizu.fukushima.jp\0"
+    "barsyonline.com\0"
+    "org.bj\0"
+    "bbs.tr\0"
+    "co.sz\0"
+    "hjartdal.no\0"
+    "net.im\0"
+    "azurestaticapps.net\0"
+    "kamisunagawa.hokkaido.jp\0"
+    "lazio.it\0"
+    "turek.pl\0"
+    "ogawara.miyagi.jp\0"
+    "tec.br\0"
+    "biz.at\0"
+    "hr\0"
+    "shirosato.ibaraki.jp\0"
+    "net.il\0"
+    "ovh\0"
+    "hosting-cluster.nl\0"
+    "larvik.no\0"
+    "hvaler.no\0"
+    "iwi.nz\0"
+    "myshopblocks.com\0"
+    "八卦\0"
+    "laichau.vn\0"
+    "nakatsugawa.gifu.jp\0"
+    "koza.wakayama.jp\0"
+    "bc.platform.sh\0"
+    "net.co\0"
+    "scalebook.scw.cloud\0"
+    "shikokuchuo.ehime.jp\0"
+    "semine.miyagi.jp\0"
+    "herokussl.com\0"
+    "*.in.futurecms.at\0"
+    "ishigaki.okinawa.jp\0"
+    "capetown\0"
+    "web.in\0"
+    "edu.mw\0"
+    "2-d.jp\0"
+    "kanna.gunma.jp\0"
+    "обр.срб\0"
+    "kasama.ibaraki.jp\0"
+    "in.ua\0"
+    "tono.iwate.jp\0"
+    "stordal.no\0"
+    "cutegirl.jp\0"
+    "mizumaki.fukuoka.jp\0"
+    "plumbing\0"
+    "cash\0"
+    "tr.no\0"
+    "commune.am\0"
+    "brasilia.me\0"
+    "k12.ar.us\0"
+    "stalowa-wola.pl\0"
+    "production.aero\0"
+    "dyn53.io\0"
+    "kawazu.shizuoka.jp\0"
+    "stjørdal.no\0"
+    "daknong.vn\0"
+    "nishi.fukuoka.jp\0"
+    "def.br\0"
+    "kurume.fukuoka.jp\0"
+    "gov.nc.tr\0"
+    "kembuchi.hokkaido.jp\0"
+    "takamori.kumamoto.jp\0"
+    "pleskns.com\0"
+    "blogspot.com.uy\0"
+    "geisei.kochi.jp\0"
+    "gbiz\0"
+    "kiyosu.aichi.jp\0"
+    "audnedaln.no\0"
+    "lon-1.paas.massivegrid.net\0"
+    "ngo\0"
+    "sfr\0"
+    "edu.kg\0"
+    "com.cy\0"
+    "kamikitayama.nara.jp\0"
+    "blogspot.be\0"
+    "123kotisivu.fi\0"
+    "abira.hokkaido.jp\0"
+    "co.dk\0"
+    "org.so\0"
+    "fukui.fukui.jp\0"
+    "engineer\0"
+    "law.pro\0"
+    "chungnam.kr\0"
+    "røst.no\0"
+    "mircloud.ru\0"
+    "சிங்கப்பூர்\0"
+    "cloudns.eu\0"
+    "research.aero\0"
+    "chikuma.nagano.jp\0"
+    "vp4.me\0"
+    "コム\0"
+    "asso.km\0"
+    "coolblog.jp\0"
+    "asso.re\0"
+    "nic.tj\0"
+    "günstigliefern.de\0"
+    "godo.gifu.jp\0"
+    "pcloud.host\0"
+    "gov.om\0"
+    "oshino.yamanashi.jp\0"
+    "ube.yamaguchi.jp\0"
+    "ogawa.saitama.jp\0"
+    "blogspot.com.ee\0"
+    "beta.bounty-full.com\0"
+    "cc.mo.us\0"
+    "karlsoy.no\0"
+    "leg.br\0"
+    "kyoto\0"
+    "dnsiskinky.com\0"
+    "saarland\0"
+    "associates\0"
+    "framer.media\0"
+    "edu.kw\0"
+    "aomori.jp\0"
+    "twmail.org\0"
+    "im.it\0"
+    "workinggroup.aero\0"
+    "trentino-suedtirol.it\0"
+    "from-nj.com\0"
+    "serveftp.com\0"
+    "gialai.vn\0"
+    "dyn-berlin.de\0"
+    "co.ve\0"
+    "africa.bj\0"
+    "co.mu\0"
+    "самара.рус\0"
+    "diskstation.me\0"
+    "i.bg\0"
+    "clubmed\0"
+    "ota.gunma.jp\0"
+    "to.gt\0"
+    "søgne.no\0"
+    "kariya.aichi.jp\0"
+    "uki.kumamoto.jp\0"
+    "zamami.okinawa.jp\0"
+    "toyama.toyama.jp\0"
+    "ae\0"
+    "kawai.iwate.jp\0"
+    "taipei\0"
+    "eiheiji.fukui.jp\0"
+    "mz\0"
+    "cc.ks.us\0"
+    "azerbaijan.su\0"
+    "ac.fj\0"
+    "*.tst.site\0"
+    "mba\0"
+    "shibetsu.hokkaido.jp\0"
+    "org.cw\0"
+    "dyndns-web.com\0"
+    "akita.akita.jp\0"
+    "tozawa.yamagata.jp\0"
+    "akdn\0"
+    "rishiri.hokkaido.jp\0"
+    "longan.vn\0"
+    "兵庫.jp\0"
+    "myvnc.com\0"
+    "kindle\0"
+    "sekikawa.niigata.jp\0"
+    "laspezia.it\0"
+    "niiza.saitama.jp\0"
+    "nohost.me\0"
+    "kiryu.gunma.jp\0"
+    "guge\0"
+    "k12.ga.us\0"
+    "futurehosting.at\0"
+    "shintomi.miyazaki.jp\0"
+    "utazas.hu\0"
+    "able\0"
+    "book\0"
+    "higashimatsushima.miyagi.jp\0"
+    "kaneyama.fukushima.jp\0"
+    "myftp.biz\0"
+    "is-a-liberal.com\0"
+    "toyohashi.aichi.jp\0"
+    "bambina.jp\0"
+    "musashimurayama.tokyo.jp\0"
+    "madrid\0"
+    "kiengiang.vn\0"
+    "ln.cn\0"
+    "haus\0"
+    "hangout\0"
+    "etc.br\0"
+    "bn\0"
+    "gmbh\0"
+    "batsfjord.no\0"
+    "net.pe\0"
+    "takatsuki.shiga.jp\0"
+    "lu\0"
+    "shitara.aichi.jp\0"
+    "haga.tochigi.jp\0"
+    "机构\0"
+    "yakage.okayama.jp\0"
+    "net.jo\0"
+    "art.ht\0"
+    "ono.hyogo.jp\0"
+    "kazo.saitama.jp\0"
+    "gov.uk\0"
+    "blush.jp\0"
+    "xihuan\0"
+    "med.pa\0"
+    "blogspot.li\0"
+    "kanegasaki.iwate.jp\0"
+    "cloudns.pw\0"
+    "andriabarlettatrani.it\0"
+    "mil\0"
+    "eastasia.azurestaticapps.net\0"
+    "kvinesdal.no\0"
+    "j.scaleforce.com.cy\0"
+    "matsuno.ehime.jp\0"
+    "inami.toyama.jp\0"
+    "thanhphohochiminh.vn\0"
+    "jan-mayen.no\0"
+    "trentinsud-tirol.it\0"
+    "piw.gov.pl\0"
+    "uk\0"
+    "pro.fj\0"
+    "k12.sc.us\0"
+    "mycd.eu\0"
+    "sharp\0"
+    "barsy.ro\0"
+    "tcp4.me\0"
+    "mk\0"
+    "latrobe\0"
+    "nakamichi.yamanashi.jp\0"
+    "org.do\0"
+    "kanazawa.ishikawa.jp\0"
+    "pub\0"
+    "otofuke.hokkaido.jp\0"
+    "大拿\0"
+    "kilo.jp\0"
+    "izumisano.osaka.jp\0"
+    "edu.cw\0"
+    "takazaki.miyazaki.jp\0"
+    "is-a-photographer.com\0"
+    "int.pt\0"
+    "svn-repos.de\0"
+    "harstad.no\0"
+    "pi.it\0"
+    "پاکستان\0"
+    "minamiise.mie.jp\0"
+    "webhop.me\0"
+    "shinichi.hiroshima.jp\0"
+    "webview-assets.aws-cloud9.ap-northeast-1.amazonaws.com\0"
+    "udi.br\0"
+    "riopreto.br\0"
+    "friuli-ve-giulia.it\0"
+    "sch.ae\0"
+    "supplies\0"
+    "build\0"
+    "s3.dualstack.ap-southeast-2.amazonaws.com\0"
+    "altoadige.it\0"
+    "farm\0"
+    "l.bg\0"
+    "abashiri.hokkaido.jp\0"
+    "sucks\0"
+    "nes.buskerud.no\0"
+    "kumano.mie.jp\0"
+    "ascoli-piceno.it\0"
+    "x.bg\0"
+    "nichinan.miyazaki.jp\0"
+    "hyatt\0"
+    "from-ny.net\0"
+    "net.kn\0"
+    "from.tv\0"
+    "ac.mz\0"
+    "blogsite.org\0"
+    "chitose.hokkaido.jp\0"
+    "org.tr\0"
+    "s3-website.fr-par.scw.cloud\0"
+    "lib.wi.us\0"
+    "cloudycluster.net\0"
+    "of.je\0"
+    "sm\0"
+    "meiwa.gunma.jp\0"
+    "masuda.shimane.jp\0"
+    "orange\0"
+    "myspreadshop.nl\0"
+    "miyama.fukuoka.jp\0"
+    "indigena.bo\0"
+    "living\0"
+    "spydeberg.no\0"
+    "aco\0"
+    "co.ro\0"
+    "mil.ec\0"
+    "is-a-celticsfan.org\0"
+    "is-into-anime.com\0"
+    "ibaraki.osaka.jp\0"
+    "blogspot.dk\0"
+    "miyoshi.aichi.jp\0"
+    "encr.app\0"
+    "mil.zw\0"
+    "ikawa.akita.jp\0"
+    "barsy.bg\0"
+    "nyc.mn\0"
+    "málatvuopmi.no\0"
+    "三重.jp\0"
+    "shia\0"
+    "cam.it\0"
+    "tanohata.iwate.jp\0"
+    "tunk.org\0"
+    "kviteseid.no\0"
+    "plc.co.im\0"
+    "appudo.net\0"
+    "pippu.hokkaido.jp\0"
+    "gotdns.com\0"
+    "smøla.no\0"
+    "itakura.gunma.jp\0"
+    "ráisa.no\0"
+    "meraker.no\0"
+    "edu\0"
+    "mma\0"
+    "com.au\0"
+    "isla.pr\0"
+    "okayama.jp\0"
+    "emp.br\0"
+    "kounosu.saitama.jp\0"
+    "tsushima.nagasaki.jp\0"
+    "kitakata.miyazaki.jp\0"
+    "gov.ru\0"
+    "nishiarita.saga.jp\0"
+    "homelinux.net\0"
+    "valleeaoste.it\0"
+    "nakijin.okinawa.jp\0"
+    "shikabe.hokkaido.jp\0"
+    "ferrari\0"
+    "akamai-staging.net\0"
+    "lugansk.ua\0"
+    "cog.mi.us\0"
+    "gm\0"
+    "al.no\0"
+    "trentinsuedtirol.it\0"
+    "travel.pl\0"
+    "net.lk\0"
+    "eidsberg.no\0"
+    "hanyu.saitama.jp\0"
+    "gov.zw\0"
+    "golffan.us\0"
+    "is-an-actor.com\0"
+    "kawatana.nagasaki.jp\0"
+    "app.banzaicloud.io\0"
+    "og.ao\0"
+    "azurewebsites.net\0"
+    "omiya.saitama.jp\0"
+    "wellbeingzone.co.uk\0"
+    "com.mg\0"
+    "royal-commission.uk\0"
+    "tra.kp\0"
+    "sd.cn\0"
+    "konan.shiga.jp\0"
+    "reklam.hu\0"
+    "cc.ar.us\0"
+    "mediatech.dev\0"
+    "aaa\0"
+    "s3.dualstack.ap-southeast-1.amazonaws.com\0"
+    "from-ca.com\0"
+    "tachikawa.tokyo.jp\0"
+    "web.id\0"
+    "haram.no\0"
+    "rawa-maz.pl\0"
+    "servehalflife.com\0"
+    "rj.leg.br\0"
+    "bearalvahki.no\0"
+    "wien\0"
+    "fuettertdasnetz.de\0"
+    "toolforge.org\0"
+    "aikawa.kanagawa.jp\0"
+    "blog.gt\0"
+    "愛媛.jp\0"
+    "weibo\0"
+    "githubusercontent.com\0"
+    "plesk.page\0"
+    "biz.mw\0"
+    "vision\0"
+    "*.nagoya.jp\0"
+    "reggio-emilia.it\0"
+    "gov.pl\0"
+    "كاثوليك\0"
+    "shiroishi.miyagi.jp\0"
+    "aws\0"
+    "haiphong.vn\0"
+    "jampa.br\0"
+    "wpdevcloud.com\0"
+    "орг.рус\0"
+    "mil.no\0"
+    "nom.ve\0"
+    "urn.arpa\0"
+    "apps.fbsbx.com\0"
+    "torproject.net\0"
+    "xxx\0"
+    "agakhan\0"
+    "boleslawiec.pl\0"
+    "dyndns-office.com\0"
+    "moi\0"
+    "com.lr\0"
+    "rec.nf\0"
+    "edu.bz\0"
+    "mcdir.ru\0"
+    "البحرين\0"
+    "ibxos.it\0"
+    "d.bg\0"
+    "gr.it\0"
+    "frogn.no\0"
+    "mom\0"
+    "osen.no\0"
+    "org.uk\0"
+    "presse.ci\0"
+    "bungotakada.oita.jp\0"
+    "pp.se\0"
+    "ro.leg.br\0"
+    "sg-1.paas.massivegrid.net\0"
+    "lt.ua\0"
+    "docs\0"
+    "priv.me\0"
+    "yuasa.wakayama.jp\0"
+    "org.tj\0"
+    "gov.tw\0"
+    "horse\0"
+    "samukawa.kanagawa.jp\0"
+    "issmarterthanyou.com\0"
+    "ba.gov.br\0"
+    "k12.nm.us\0"
+    "org.ht\0"
+    "mil.fj\0"
+    "chippubetsu.hokkaido.jp\0"
+    "trd.br\0"
+    "house\0"
+    "orkdal.no\0"
+    "భారత్\0"
+    "como.it\0"
+    "bukhara.su\0"
+    "skien.no\0"
+    "in-vpn.net\0"
+    "serveftp.net\0"
+    "jp.md\0"
+    "návuotna.no\0"
+    "nab\0"
+    "s3.amazonaws.com\0"
+    "independent-panel.uk\0"
+    "city\0"
+    "voyage\0"
+    "fm.it\0"
+    "filegear-de.me\0"
+    "bet\0"
+    "onthewifi.com\0"
+    "aig\0"
+    "mango\0"
+    "aca.pro\0"
+    "bykle.no\0"
+    "jll\0"
+    "basilicata.it\0"
+    "rep.kp\0"
+    "meldal.no\0"
+    "ina.saitama.jp\0"
+    "inami.wakayama.jp\0"
+    "okawa.kochi.jp\0"
+    "surf\0"
+    "km.ua\0"
+    "s3-ap-northeast-1.amazonaws.com\0"
+    "grp.lk\0"
+    "babymilk.jp\0"
+    "sarpsborg.no\0"
+    "биз.рус\0"
+    "urausu.hokkaido.jp\0"
+    "nanae.hokkaido.jp\0"
+    "gov.do\0"
+    "vaapste.no\0"
+    "kiwi\0"
+    "ako.hyogo.jp\0"
+    "davvenjárga.no\0"
+    "webview-assets.aws-cloud9.eu-central-1.amazonaws.com\0"
+    "arvo.network\0"
+    "nagawa.nagano.jp\0"
+    "cri.br\0"
+    "ge.it\0"
+    "clinique\0"
+    "swiebodzin.pl\0"
+    "ehime.jp\0"
+    "otoyo.kochi.jp\0"
+    "yamanashi.yamanashi.jp\0"
+    "ddnsgeek.com\0"
+    "damnserver.com\0"
+    "k12.dc.us\0"
+    "biz.in\0"
+    "oldnavy\0"
+    "hermes\0"
+    "qc.com\0"
+    "rakkestad.no\0"
+    "ny.us\0"
+    "e4.cz\0"
+    "kuji.iwate.jp\0"
+    "vardo.no\0"
+    "ninhbinh.vn\0"
+    "bnpparibas\0"
+    "gov.sl\0"
+    "hasami.nagasaki.jp\0"
+    "cloud.goog\0"
+    "moonscale.net\0"
+    "ac.ae\0"
+    "sondre-land.no\0"
+    "nr\0"
+    "yandex\0"
+    "zachpomor.pl\0"
+    "dell\0"
+    "org.bi\0"
+    "المغرب\0"
+    "网络.hk\0"
+    "urayasu.chiba.jp\0"
+    "tsukigata.hokkaido.jp\0"
+    "ostroda.pl\0"
+    "dyndns.ddnss.de\0"
+    "rovigo.it\0"
+    "ichinomiya.aichi.jp\0"
+    "ngo.ng\0"
+    "cloud.nospamproxy.com\0"
+    "rio.br\0"
+    "rost.no\0"
+    "kishiwada.osaka.jp\0"
+    "áltá.no\0"
+    "tm.no\0"
+    "yamato.kumamoto.jp\0"
+    "khakassia.su\0"
+    "net.lc\0"
+    "webview-assets.cloud9.eu-west-2.amazonaws.com\0"
+    "cc.ca.us\0"
+    "kashiwa.chiba.jp\0"
+    "संगठन\0"
+    "co.rw\0"
+    "aure.no\0"
+    "tainai.niigata.jp\0"
+    "discordsays.com\0"
+    "herad.no\0"
+    "frana.no\0"
+    "ouda.nara.jp\0"
+    "tenkawa.nara.jp\0"
+    "przeworsk.pl\0"
+    "kakamigahara.gifu.jp\0"
+    "tobetsu.hokkaido.jp\0"
+    "dnsdojo.org\0"
+    "fishing\0"
+    "嘉里大酒店\0"
+    "kuwana.mie.jp\0"
+    "balsan-sudtirol.it\0"
+    "co.mg\0"
+    "s3.eu-west-3.amazonaws.com\0"
+    "kanie.aichi.jp\0"
+    "leangaviika.no\0"
+    "homelinux.org\0"
+    "voss.no\0"
+    "masaki.ehime.jp\0"
+    "sula.no\0"
+    "fuchu.toyama.jp\0"
+    "andria-trani-barletta.it\0"
+    "sorreisa.no\0"
+    "net.tt\0"
+    "int.mw\0"
+    "firewall-gateway.net\0"
+    "webhop.biz\0"
+    "gose.nara.jp\0"
+    "yasuoka.nagano.jp\0"
+    "hungyen.vn\0"
+    "vip\0"
+    "takahashi.okayama.jp\0"
+    "blogspot.se\0"
+    "si.it\0"
+    "us.gov.pl\0"
+    "ostrowiec.pl\0"
+    "funahashi.toyama.jp\0"
+    "dnsalias.com\0"
+    "vågan.no\0"
+    "ogose.saitama.jp\0"
+    "velvet.jp\0"
+    "hakuba.nagano.jp\0"
+    "co.il\0"
+    "mmafan.biz\0"
+    "bar2.net\0"
+    "vfs.cloud9.ap-northeast-2.amazonaws.com\0"
+    "yokkaichi.mie.jp\0"
+    "komaki.aichi.jp\0"
+    "usercontent.jp\0"
+    "ye\0"
+    "net.sl\0"
+    "com.ph\0"
+    "editorx.io\0"
+    "blogspot.ro\0"
+    "jozi.biz\0"
+    "lubartow.pl\0"
+    "pictet\0"
+    "mil.tj\0"
+    "sc.tz\0"
+    "nakanojo.gunma.jp\0"
+    "analytics-gateway.ap-northeast-1.amazonaws.com\0"
+    "mil.ni\0"
+    "est-mon-blogueur.com\0"
+    "int.is\0"
+    "pa.leg.br\0"
+    "amica\0"
+    "blogspot.com.ng\0"
+    "rs.leg.br\0"
+    "mn\0"
+    "yaese.okinawa.jp\0"
+    "lib.nm.us\0"
+    "town\0"
+    "tonaki.okinawa.jp\0"
+    "taira.toyama.jp\0"
+    "beep.pl\0"
+    "abruzzo.it\0"
+    "blogspot.ca\0"
+    "jele.site\0"
+    "school.nz\0"
+    "sano.tochigi.jp\0"
+    "serveftp.org\0"
+    "praxi\0"
+    "from-mt.com\0"
+    "com.ac\0"
+    "penza.su\0"
+    "hirado.nagasaki.jp\0"
+    "hk.com\0"
+    "grong.no\0"
+    "estate\0"
+    "*.sapporo.jp\0"
+    "empresa.bo\0"
+    "riobranco.br\0"
+    "mk.eu.org\0"
+    "k12.me.us\0"
+    "va.us\0"
+    "game-server.cc\0"
+    "moriya.ibaraki.jp\0"
+    "uri.arpa\0"
+    "tabuse.yamaguchi.jp\0"
+    "etnedal.no\0"
+    "bashkiria.su\0"
+    "ws.na\0"
+    "ed.ci\0"
+    "naka.hiroshima.jp\0"
+    "blog.br\0"
+    "ve.it\0"
+    "bookonline.app\0"
+    "masoy.no\0"
+    "utsunomiya.tochigi.jp\0"
+    "webredirect.org\0"
+    "matsukawa.nagano.jp\0"
+    "bando.ibaraki.jp\0"
+    "nord-fron.no\0"
+    "ca.it\0"
+    "32-b.it\0"
+    "aq.it\0"
+    "dds\0"
+    "lukow.pl\0"
+    "nid.io\0"
+    "konan.aichi.jp\0"
+    "ravendb.community\0"
+    "alto-adige.it\0"
+    "net.pa\0"
+    "miyako.iwate.jp\0"
+    "verse.jp\0"
+    "torahime.shiga.jp\0"
+    "lincoln\0"
+    "*.jm\0"
+    "pccw\0"
+    "org.iq\0"
+    "fylkesbibl.no\0"
+    "gc.ca\0"
+    "gp\0"
+    "upli.io\0"
+    "公司\0"
+    "yamanouchi.nagano.jp\0"
+    "com.bb\0"
+    "folionetwork.site\0"
+    "kurogi.fukuoka.jp\0"
+    "hamatama.saga.jp\0"
+    "inc.hk\0"
+    "com.aw\0"
+    "angry.jp\0"
+    "valle.no\0"
+    "dev.br\0"
+    "myspreadshop.co.uk\0"
+    "tui\0"
+    "anquan\0"
+    "vibo-valentia.it\0"
+    "webview-assets.cloud9.me-south-1.amazonaws.com\0"
+    "vanguard\0"
+    "dreamhosters.com\0"
+    "kosuge.yamanashi.jp\0"
+    "equipment\0"
+    "gs.cn\0"
+    "jobs\0"
+    "lib.fl.us\0"
+    "hirogawa.wakayama.jp\0"
+    "ranzan.saitama.jp\0"
+    "eurodir.ru\0"
+    "dz\0"
+    "sc.us\0"
+    "cloud66.zone\0"
+    "lplfinancial\0"
+    "point2this.com\0"
+    "tananger.no\0"
+    "bentre.vn\0"
+    "blogdns.org\0"
+    "com.ml\0"
+    "familyds.org\0"
+    "syno-ds.de\0"
+    "nz.basketball\0"
+    "org.im\0"
+    "art.do\0"
+    "net.ge\0"
+    "cn.it\0"
+    "donetsk.ua\0"
+    "lib.vt.us\0"
+    "k12.ca.us\0"
+    "组织机构\0"
+    "gallup\0"
+    "matsuura.nagasaki.jp\0"
+    "co.krd\0"
+    "com.al\0"
+    "daemon.panel.gg\0"
+    "radoy.no\0"
+    "vfs.cloud9.ap-southeast-1.amazonaws.com\0"
+    "ricoh\0"
+    "cz\0"
+    "cuisinella\0"
+    "co.mw\0"
+    "تونس\0"
+    "redirectme.net\0"
+    "mil.hn\0"
+    "tas.gov.au\0"
+    "instantcloud.cn\0"
+    "likescandy.com\0"
+    "vps.mcdir.ru\0"
+    "baria-vungtau.vn\0"
+    "web.nf\0"
+    "royken.no\0"
+    "cc.nh.us\0"
+    "hiji.oita.jp\0"
+    "nowtv\0"
+    "oyodo.nara.jp\0"
+    "otsuki.yamanashi.jp\0"
+    "jetzt\0"
+    "org.dm\0"
+    "xnbay.com\0"
+    "lib.il.us\0"
+    "trading.aero\0"
+    "mozilla-iot.org\0"
+    "tokyo.jp\0"
+    "gy\0"
+    "tomiya.miyagi.jp\0"
+    "men\0"
+    "asda\0"
+    "group.aero\0"
+    "chikuho.fukuoka.jp\0"
+    "cs.it\0"
+    "mil.ba\0"
+    "ichinoseki.iwate.jp\0"
+    "otaki.saitama.jp\0"
+    "nikita.jp\0"
+    "me.tc\0"
+    "nogata.fukuoka.jp\0"
+    "com.ba\0"
+    "ltd\0"
+    "scrapper-site.net\0"
+    "groks-the.info\0"
+    "com.jo\0"
+    "westeurope.azurestaticapps.net\0"
+    "trentin-suedtirol.it\0"
+    "myiphost.com\0"
+    "cs.in\0"
+    "service.gov.uk\0"
+    "ac.uk\0"
+    "cable-modem.org\0"
+    "r.cdn77.net\0"
+    "me.in\0"
+    "kiyose.tokyo.jp\0"
+    "reviews\0"
+    "ownprovider.com\0"
+    "chikujo.fukuoka.jp\0"
+    "bandai.fukushima.jp\0"
+    "3.bg\0"
+    "yoshino.nara.jp\0"
+    "s3-website-us-west-2.amazonaws.com\0"
+    "nishikawa.yamagata.jp\0"
+    "matsubushi.saitama.jp\0"
+    "asso.ci\0"
+    "finance\0"
+    "bialowieza.pl\0"
+    "pl.ua\0"
+    "ric.jelastic.vps-host.net\0"
+    "nyaa.am\0"
+    "me.ss\0"
+    "groks-this.info\0"
+    "tosu.saga.jp\0"
+    "tele.amune.org\0"
+    "gs.jan-mayen.no\0"
+    "sl\0"
+    "icurus.jp\0"
+    "ekloges.cy\0"
+    "soo.kagoshima.jp\0"
+    "digick.jp\0"
+    "ogawa.ibaraki.jp\0"
+    "westus2.azurestaticapps.net\0"
+    "from-la.net\0"
+    "ørsta.no\0"
+    "store.dk\0"
+    "ac.id\0"
+    "oki.fukuoka.jp\0"
+    "tr\0"
+    "net.gg\0"
+    "edu.scot\0"
+    "sunnyday.jp\0"
+    "kaisei.kanagawa.jp\0"
+    "int.tj\0"
+    "edu.ni\0"
+    "bw\0"
+    "s3-website.ap-south-1.amazonaws.com\0"
+    "blogspot.pe\0"
+    "dyndns.tv\0"
+    "coop.tt\0"
+    "ullensaker.no\0"
+    "shopping\0"
+    "kaszuby.pl\0"
+    "shell\0"
+    "bn.it\0"
+    "barsy.mobi\0"
+    "tvs\0"
+    "hokkaido.jp\0"
+    "mikasa.hokkaido.jp\0"
+    "sport\0"
+    "co.ae\0"
+    "aosta-valley.it\0"
+    "krodsherad.no\0"
+    "yashiro.hyogo.jp\0"
+    "on-aptible.com\0"
+    "morotsuka.miyazaki.jp\0"
+    "or.tz\0"
+    "codespot.com\0"
+    "gotdns.org\0"
+    "edgesuite-staging.net\0"
+    "privatizehealthinsurance.net\0"
+    "singles\0"
+    "gu.us\0"
+    "lifestyle\0"
+    "政府.香港\0"
+    "beskidy.pl\0"
+    "ks.us\0"
+    "es.kr\0"
+    "vald-aosta.it\0"
+    "5g.in\0"
+    "oschr.gov.pl\0"
+    "engineer.aero\0"
+    "s3-website-us-west-1.amazonaws.com\0"
+    "org.pr\0"
+    "net.me\0"
+    "olayan\0"
+    "lib.ne.us\0"
+    "co.bj\0"
+    "blogspot.ae\0"
+    "wolterskluwer\0"
+    "garden\0"
+    "hospital\0"
+    "bs.it\0"
+    "barsy.in\0"
+    "s.bg\0"
+    "nordre-land.no\0"
+    "neko.am\0"
+    "wsse.gov.pl\0"
+    "kn\0"
+    "webhop.org\0"
+    "servebbs.org\0"
+    "net.ar\0"
+    "amami.kagoshima.jp\0"
+    "macerata.it\0"
+    "fukuchiyama.kyoto.jp\0"
+    "cc.gu.us\0"
+    "app.render.com\0"
+    "co.jp\0"
+    "fra1-de.cloudjiffy.net\0"
+    "chicappa.jp\0"
+    "lib.vi.us\0"
+    "platter-app.dev\0"
+    "fr.eu.org\0"
+    "karasjohka.no\0"
+    "miyazaki.jp\0"
+    "ayabe.kyoto.jp\0"
+    "gov.py\0"
+    "smart\0"
+    "suwalki.pl\0"
+    "kawai.nara.jp\0"
+    "authgearapps.com\0"
+    "meinforum.net\0"
+    "folldal.no\0"
+    "ju.mp\0"
+    "gov.bh\0"
+    "ca.us\0"
+    "onojo.fukuoka.jp\0"
+    "edu.az\0"
+    "game\0"
+    "nishihara.kumamoto.jp\0"
+    "shop.ro\0"
+    "tynset.no\0"
+    "kopervik.no\0"
+    "yuu.yamaguchi.jp\0"
+    "lucca.it\0"
+    "net.mu\0"
+    "al.eu.org\0"
+    "dnepropetrovsk.ua\0"
+    "warabi.saitama.jp\0"
+    "nakama.fukuoka.jp\0"
+    "soja.okayama.jp\0"
+    "ashiya.hyogo.jp\0"
+    "trondheim.no\0"
+    "dyndns-mail.com\0"
+    "rag-cloud-ch.hosteur.com\0"
+    "resto.bj\0"
+    "ar.it\0"
+    "ogano.saitama.jp\0"
+    "chihayaakasaka.osaka.jp\0"
+    "alessandria.it\0"
+    "ebiz.tw\0"
+    "is.eu.org\0"
+    "blogspot.tw\0"
+    "ninja\0"
+    "mil.my\0"
+    "journalist.aero\0"
+    "nishiazai.shiga.jp\0"
+    "hayakawa.yamanashi.jp\0"
+    "mol.it\0"
+    "alipay\0"
+    "akune.kagoshima.jp\0"
+    "obanazawa.yamagata.jp\0"
+    "sb\0"
+    "edu.cn\0"
+    "radio.fm\0"
+    "hápmir.no\0"
+    "sex.hu\0"
+    "co.cl\0"
+    "frei.no\0"
+    "jinsekikogen.hiroshima.jp\0"
+    "daegu.kr\0"
+    "hornindal.no\0"
+    "gets-it.net\0"
+    "bmw\0"
+    "su.paba.se\0"
+    "honefoss.no\0"
+    "com.sa\0"
+    "gov.gr\0"
+    "vfs.cloud9.eu-south-1.amazonaws.com\0"
+    "akamaiorigin-staging.net\0"
+    "u2-local.xnbay.com\0"
+    "postman-echo.com\0"
+    "mus.br\0"
+    "xbox\0"
+    "org.fm\0"
+    "gob.ec\0"
+    "eurovision\0"
+    "nagareyama.chiba.jp\0"
+    "sr\0"
+    "priv.hu\0"
+    "freemyip.com\0"
+    "hitachiomiya.ibaraki.jp\0"
+    "lapy.pl\0"
+    "frenchkiss.jp\0"
+    "ha.no\0"
+    "shop.ht\0"
+    "lc\0"
+    "hl.cn\0"
+    "s3.dualstack.eu-west-2.amazonaws.com\0"
+    "blogspot.ie\0"
+    "kanoya.kagoshima.jp\0"
+    "is-a-caterer.com\0"
+    "dep.no\0"
+    "higashimurayama.tokyo.jp\0"
+    "aramco\0"
+    "gouv.ci\0"
+    "ralingen.no\0"
+    "ogaki.gifu.jp\0"
+    "togura.nagano.jp\0"
+    "link\0"
+    "freetls.fastly.net\0"
+    "po.gov.pl\0"
+    "drangedal.no\0"
+    "art.dz\0"
+    "gov.in\0"
+    "eidskog.no\0"
+    "selfip.org\0"
+    "name.pm\0"
+    "gv.ao\0"
+    "католик\0"
+    "daiwa.hiroshima.jp\0"
+    "akamai.net\0"
+    "numata.gunma.jp\0"
+    "here\0"
+    "wif.gov.pl\0"
+    "biz.pk\0"
+    "cloudns.us\0"
+    "norddal.no\0"
+    "uchinomi.kagawa.jp\0"
+    "wiw.gov.pl\0"
+    "urawa.saitama.jp\0"
+    "eating-organic.net\0"
+    "ac.be\0"
+    "co.gy\0"
+    "baidar.no\0"
+    "p.se\0"
+    "zapto.org\0"
+    "org.rs\0"
+    "gov.kw\0"
+    "tadotsu.kagawa.jp\0"
+    "123webseite.at\0"
+    "nonoichi.ishikawa.jp\0"
+    "iijima.nagano.jp\0"
+    "tarumizu.kagoshima.jp\0"
+    "kz\0"
+    "tr.it\0"
+    "org.ar\0"
+    "from-az.net\0"
+    "venezia.it\0"
+    "cust.prod.thingdust.io\0"
+    "carbonia-iglesias.it\0"
+    "kåfjord.no\0"
+    "ac.ci\0"
+    "com.eg\0"
+    "airkitapps.eu\0"
+    "fage\0"
+    "edu.kz\0"
+    "s3-website.pl-waw.scw.cloud\0"
+    "招聘\0"
+    "forlicesena.it\0"
+    "edu.ls\0"
+    "taxi.br\0"
+    "midtre-gauldal.no\0"
+    "b.se\0"
+    "edu.gu\0"
+    "fbx-os.fr\0"
+    "gamo.shiga.jp\0"
+    "blogspot.com\0"
+    "bardu.no\0"
+    "satte.saitama.jp\0"
+    "homes\0"
+    "ullensvang.no\0"
+    "mokuren.ne.jp\0"
+    "shingo.aomori.jp\0"
+    "åmli.no\0"
+    "kitagata.saga.jp\0"
+    "casacam.net\0"
+    "ookuwa.nagano.jp\0"
+    "k12.de.us\0"
+    "clothing\0"
+    "org.nr\0"
+    "biz.tr\0"
+    "e12.ve\0"
+    "shimizu.hokkaido.jp\0"
+    "prvcy.page\0"
+    "soc.lk\0"
+    "for-some.biz\0"
+    "tawaramoto.nara.jp\0"
+    "shinagawa.tokyo.jp\0"
+    "moto\0"
+    "careers\0"
+    "financial\0"
+    "firm.ro\0"
+    "biz.mv\0"
+    "dyndns-blog.com\0"
+    "niyodogawa.kochi.jp\0"
+    "helsinki\0"
+    "buyshop.jp\0"
+    "sorocaba.br\0"
+    "shiroi.chiba.jp\0"
+    "dev.vu\0"
+    "davvesiida.no\0"
+    "chuo.osaka.jp\0"
+    "山形.jp\0"
+    "crs\0"
+    "hopto.org\0"
+    "barsy.net\0"
+    "com.kp\0"
+    "fi.eu.org\0"
+    "gov.bz\0"
+    "catholic.edu.au\0"
+    "vinhphuc.vn\0"
+    "kr\0"
+    "bronnoysund.no\0"
+    "ভারত\0"
+    "contractors\0"
+    "doesntexist.com\0"
+    "friuli-v-giulia.it\0"
+    "verbania.it\0"
+    "inf.mk\0"
+    "whm.fr-par.scw.cloud\0"
+    "mytabit.com\0"
+    "egersund.no\0"
+    "compare\0"
+    "cloudflare-ipfs.com\0"
+    "easypanel.app\0"
+    "works\0"
+    "auspost\0"
+    "台灣\0"
+    "ohi.fukui.jp\0"
+    "sp.it\0"
+    "ooshika.nagano.jp\0"
+    "itv\0"
+    "sa.it\0"
+    "lærdal.no\0"
+    "blackbaudcdn.net\0"
+    "f.bg\0"
+    "jele.io\0"
+    "lv.ua\0"
+    "pomorze.pl\0"
+    "cleaning\0"
+    "ørskog.no\0"
+    "broadway\0"
+    "chambagri.fr\0"
+    "hachioji.tokyo.jp\0"
+    "eat\0"
+    "pg.in\0"
+    "gran.no\0"
+    "sytes.net\0"
+    "sk.ca\0"
+    "buy\0"
+    "takaoka.toyama.jp\0"
+    "saxo\0"
+    "umbria.it\0"
+    "kanonji.kagawa.jp\0"
+    "mc.ax\0"
+    "prudential\0"
+    "blogspot.cv\0"
+    "tempioolbia.it\0"
+    "jotelulu.cloud\0"
+    "toyako.hokkaido.jp\0"
+    "oyamazaki.kyoto.jp\0"
+    "kannami.shizuoka.jp\0"
+    "ap-northeast-3.elasticbeanstalk.com\0"
+    "بارت\0"
+    "fukumitsu.toyama.jp\0"
+    "tj.cn\0"
+    "andria-barletta-trani.it\0"
+    "kunisaki.oita.jp\0"
+    "कॉम\0"
+    "kiwi.nz\0"
+    "k12.nc.us\0"
+    "dyndns-pics.com\0"
+    "shirahama.wakayama.jp\0"
+    "prof.pr\0"
+    "cust.testing.thingdust.io\0"
+    "iwaki.fukushima.jp\0"
+    "radio\0"
+    "ישראל\0"
+    "blogspot.rs\0"
+    "alstahaug.no\0"
+    "halfmoon.jp\0"
+    "v.bg\0"
+    "browsersafetymark.io\0"
+    "int.mv\0"
+    "from-ia.com\0"
+    "shingu.wakayama.jp\0"
+    "nagano.nagano.jp\0"
+    "香格里拉\0"
+    "solar\0"
+    "int.la\0"
+    "info.bj\0"
+    "jørpeland.no\0"
+    "mil.km\0"
+    "edu.ge\0"
+    "ryokami.saitama.jp\0"
+    "kamishihoro.hokkaido.jp\0"
+    "tas.au\0"
+    "suita.osaka.jp\0"
+    "nabari.mie.jp\0"
+    "mykolaiv.ua\0"
+    "mil.kr\0"
+    "bozen-suedtirol.it\0"
+    "komvux.se\0"
+    "sopot.pl\0"
+    "ee.eu.org\0"
+    "blogspot.hr\0"
+    "tonsberg.no\0"
+    "kitakata.fukushima.jp\0"
+    "osaka.jp\0"
+    "discourse.group\0"
+    "law\0"
+    "al.it\0"
+    "villas\0"
+    "hichiso.gifu.jp\0"
+    "bydgoszcz.pl\0"
+    "otsuka\0"
+    "news.hu\0"
+    "rødøy.no\0"
+    "localzone.xyz\0"
+    "moriyama.shiga.jp\0"
+    "demon.nl\0"
+    "edgekey.net\0"
+    "ukiha.fukuoka.jp\0"
+    "harima.hyogo.jp\0"
+    "gov.nr\0"
+    "is-an-engineer.com\0"
+    "sc.ke\0"
+    "kawahara.tottori.jp\0"
+    "net.ph\0"
+    "waw.pl\0"
+    "conf.au\0"
+    "delivery\0"
+    "嘉里\0"
+    "tgory.pl\0"
+    "nore-og-uvdal.no\0"
+    "ie.ua\0"
+    "cn.ua\0"
+    "servegame.org\0"
+    "ustka.pl\0"
+    "fie.ee\0"
+    "*.on-k3s.io\0"
+    "fukuyama.hiroshima.jp\0"
+    "klabu.no\0"
+    "media.hu\0"
+    "bananarepublic\0"
+    "am\0"
+    "stada\0"
+    "me.us\0"
+    "hamaroy.no\0"
+    "vin\0"
+    "pistoia.it\0"
+    "kurate.fukuoka.jp\0"
+    "nanbu.tottori.jp\0"
+    "عرب\0"
+    "gov.so\0"
+    "otama.fukushima.jp\0"
+    "udono.mie.jp\0"
+    "net.gp\0"
+    "furano.hokkaido.jp\0"
+    "org.qa\0"
+    "tenri.nara.jp\0"
+    "joso.ibaraki.jp\0"
+    "ut.us\0"
+    "tamatsukuri.ibaraki.jp\0"
+    "myfast.host\0"
+    "plurinacional.bo\0"
+    "k12.la.us\0"
+    "hs.zone\0"
+    "uonuma.niigata.jp\0"
+    "tci\0"
+    "toho.fukuoka.jp\0"
+    "haboro.hokkaido.jp\0"
+    "does-it.net\0"
+    "kahoku.yamagata.jp\0"
+    "erotika.hu\0"
+    "*.pg\0"
+    "cuneo.it\0"
+    "malselv.no\0"
+    "from-sd.com\0"
+    "tv.kg\0"
+    "com.ve\0"
+    "ponpes.id\0"
+    "edgekey-staging.net\0"
+    "uchihara.ibaraki.jp\0"
+    "stranda.no\0"
+    "vn.ua\0"
+    "s3.teckids.org\0"
+    "toshima.tokyo.jp\0"
+    "com.vn\0"
+    "nom.ag\0"
+    "au.eu.org\0"
+    "nl\0"
+    "org.az\0"
+    "hirosaki.aomori.jp\0"
+    "1.bg\0"
+    "kamakura.kanagawa.jp\0"
+    "tv.im\0"
+    "org.mx\0"
+    "hannan.osaka.jp\0"
+    "teo.br\0"
+    "lk\0"
+    "andebu.no\0"
+    "weeklylottery.org.uk\0"
+    "mukawa.hokkaido.jp\0"
+    "omega\0"
+    "tm.fr\0"
+    "chirurgiens-dentistes.fr\0"
+    "moo.jp\0"
+    "u.channelsdvr.net\0"
+    "muni.il\0"
+    "kvam.no\0"
+    "edu.do\0"
+    "ts.net\0"
+    "servepics.com\0"
+    "readmyblog.org\0"
+    "oi.kanagawa.jp\0"
+    "hostedpi.com\0"
+    "in-vpn.org\0"
+    "cc.dc.us\0"
+    "trentinosued-tirol.it\0"
+    "krasnodar.su\0"
+    "ås.no\0"
+    "utwente.io\0"
+    "sandvik\0"
+    "is-a-designer.com\0"
+    "kumano.hiroshima.jp\0"
+    "cc.ut.us\0"
+    "best\0"
+    "secaas.hk\0"
+    "øygarden.no\0"
+    "*.platformsh.site\0"
+    "static.land\0"
+    "vegarshei.no\0"
+    "教育.香港\0"
+    "higashitsuno.kochi.jp\0"
+    "web.ve\0"
+    "cloudapps.digital\0"
+    "tel\0"
+    "mutual.ar\0"
+    "cricket\0"
+    "edu.la\0"
+    "blogspot.cz\0"
+    "mazowsze.pl\0"
+    "kameyama.mie.jp\0"
+    "net.sa\0"
+    "adobeaemcloud.com\0"
+    "gripe\0"
+    "mortgage\0"
+    "foundation\0"
+    "oketo.hokkaido.jp\0"
+    "webview-assets.cloud9.eu-west-3.amazonaws.com\0"
+    "rishirifuji.hokkaido.jp\0"
+    "ddnss.org\0"
+    "club.aero\0"
+    "øksnes.no\0"
+    "brønnøy.no\0"
+    "snåase.no\0"
+    "iwatsuki.saitama.jp\0"
+    "nantan.kyoto.jp\0"
+    "org.lv\0"
+    "medio-campidano.it\0"
+    "lv.eu.org\0"
+    "firm.in\0"
+    "vaksdal.no\0"
+    "us.eu.org\0"
+    "hyllestad.no\0"
+    "pe\0"
+    "kuokgroup\0"
+    "capoo.jp\0"
+    "cards\0"
+    "båtsfjord.no\0"
+    "*.kitakyushu.jp\0"
+    "tome.miyagi.jp\0"
+    "kongsvinger.no\0"
+    "namie.fukushima.jp\0"
+    "jaguar\0"
+    "asso.fr\0"
+    "arte.bo\0"
+    "sabae.fukui.jp\0"
+    "sener\0"
+    "sakuraweb.com\0"
+    "ong\0"
+    "org.al\0"
+    "you\0"
+    "北海道.jp\0"
+    "federation.aero\0"
+    "saga.jp\0"
+    "definima.io\0"
+    "workisboring.com\0"
+    "net.tj\0"
+    "functions.fnc.fr-par.scw.cloud\0"
+    "edu.vc\0"
+    "noshiro.akita.jp\0"
+    "myasustor.com\0"
+    "gh\0"
+    "hammerfest.no\0"
+    "0.bg\0"
+    "3.azurestaticapps.net\0"
+    "sncf\0"
+    "my\0"
+    "भारतम्\0"
+    "is\0"
+    "fidelity\0"
+    "ishikawa.fukushima.jp\0"
+    "showa.yamanashi.jp\0"
+    "square7.de\0"
+    "drøbak.no\0"
+    "kaminokawa.tochigi.jp\0"
+    "sørfold.no\0"
+    "br.com\0"
+    "forlì-cesena.it\0"
+    "rennesoy.no\0"
+    "certification.aero\0"
+    "co.network\0"
+    "is-into-games.com\0"
+    "ком\0"
+    "info.ve\0"
+    "tingvoll.no\0"
+    "trentin-sud-tirol.it\0"
+    "co.tz\0"
+    "zone\0"
+    "tozsde.hu\0"
+    "cc.vt.us\0"
+    "net.hk\0"
+    "politica.bo\0"
+    "id.firewalledreplit.co\0"
+    "govt.nz\0"
+    "*.sensiosite.cloud\0"
+    "blogspot.ch\0"
+    "tl\0"
+    "yamatokoriyama.nara.jp\0"
+    "kitami.hokkaido.jp\0"
+    "kp\0"
+    "bf\0"
+    "assur.bj\0"
+    "sakura.ne.jp\0"
+    "ce.leg.br\0"
+    "temp-dns.com\0"
+    "net.ae\0"
+    "monza-brianza.it\0"
+    "info.pk\0"
+    "hidaka.wakayama.jp\0"
+    "cloudns.asia\0"
+    "from-dc.com\0"
+    "fireweb.app\0"
+    "ravenna.it\0"
+    "loppa.no\0"
+    "rr.leg.br\0"
+    "gov.et\0"
+    "edu.ss\0"
+    "sodegaura.chiba.jp\0"
+    "zarow.pl\0"
+    "mihama.aichi.jp\0"
+    "bihoro.hokkaido.jp\0"
+    "*.dapps.earth\0"
+    "k12.pa.us\0"
+    "gov.nl\0"
+    "cloudsite.builders\0"
+    "ישוב.ישראל\0"
+    "static.observableusercontent.com\0"
+    "fin.ec\0"
+    "endofinternet.net\0"
+    "daisen.akita.jp\0"
+    "gob.pa\0"
+    "murayama.yamagata.jp\0"
+    "uryu.hokkaido.jp\0"
+    "ebetsu.hokkaido.jp\0"
+    "minami.fukuoka.jp\0"
+    "freeddns.us\0"
+    "saka.hiroshima.jp\0"
+    "fukushima.fukushima.jp\0"
+    "åfjord.no\0"
+    "ads\0"
+    "天主教\0"
+    "doesntexist.org\0"
+    "events\0"
+    "test-iserv.de\0"
+    "legnica.pl\0"
+    "webview-assets.cloud9.eu-south-1.amazonaws.com\0"
+    "is-a-financialadvisor.com\0"
+    "miyoshi.tokushima.jp\0"
+    "christmas\0"
+    "cust.dev.thingdust.io\0"
+    "wv.us\0"
+    "g.se\0"
+    "lk3.ru\0"
+    "servequake.com\0"
+    "sanofi\0"
+    "kicks-ass.net\0"
+    "nishimera.miyazaki.jp\0"
+    "co.om\0"
+    "inagawa.hyogo.jp\0"
+    "massacarrara.it\0"
+    "org.pf\0"
+    "nachikatsuura.wakayama.jp\0"
+    "dnshome.de\0"
+    "verisign\0"
+    "онлайн\0"
+    "inf.ua\0"
+    "pr.it\0"
+    "webview-assets.aws-cloud9.us-east-1.amazonaws.com\0"
+    "co.ls\0"
+    "pb.leg.br\0"
+    "*.lcl.dev\0"
+    "quangngai.vn\0"
+    "aeroclub.aero\0"
+    "jeonbuk.kr\0"
+    "lb\0"
+    "site.tb-hosting.com\0"
+    "cn.com\0"
+    "web.co\0"
+    "read-books.org\0"
+    "bar1.net\0"
+    "info.ro\0"
+    "dyndns.biz\0"
+    "ch.eu.org\0"
+    "gap\0"
+    "ею\0"
+    "s3-sa-east-1.amazonaws.com\0"
+    "vfs.cloud9.me-south-1.amazonaws.com\0"
+    "city.hu\0"
+    "s3-website.eu-west-3.amazonaws.com\0"
+    "سوريا\0"
+    "hot\0"
+    "cc.ia.us\0"
+    "saloon.jp\0"
+    "firestone\0"
+    "collegefan.org\0"
+    "våler.hedmark.no\0"
+    "diadem.cloud\0"
+    "cloudfunctions.net\0"
+    "chuo.tokyo.jp\0"
+    "pordenone.it\0"
+    "levanger.no\0"
+    "vercelli.it\0"
+    "graphics\0"
+    "vfs.cloud9.eu-west-3.amazonaws.com\0"
+    "ar.com\0"
+    "nagoya\0"
+    "fjell.no\0"
+    "tsuruoka.yamagata.jp\0"
+    "selfip.biz\0"
+    "luroy.no\0"
+    "odessa.ua\0"
+    "nagano.jp\0"
+    "is-a-republican.com\0"
+    "withgoogle.com\0"
+    "rsc.cdn77.org\0"
+    "webthings.io\0"
+    "asahikawa.hokkaido.jp\0"
+    "onrender.com\0"
+    "edeka\0"
+    "fly\0"
+    "skanland.no\0"
+    "mil.st\0"
+    "hashima.gifu.jp\0"
+    "trento.it\0"
+    "*.compute.estate\0"
+    "go.ke\0"
+    "bounty-full.com\0"
+    "net.eg\0"
+    "yamanakako.yamanashi.jp\0"
+    "halden.no\0"
+    "høylandet.no\0"
+    "seihi.nagasaki.jp\0"
+    "mo-i-rana.no\0"
+    "gob.hn\0"
+    "drayddns.com\0"
+    "edu.krd\0"
+    "py\0"
+    "g12.br\0"
+    "balat.no\0"
+    "akamaiorigin.net\0"
+    "nog.community\0"
+    "is-very-nice.org\0"
+    "internet.in\0"
+    "kasuga.fukuoka.jp\0"
+    "from-co.net\0"
+    "nl.no\0"
+    "ing.pa\0"
+    "4lima.de\0"
+    "casa\0"
+    "toba.mie.jp\0"
+    "cc.nv.us\0"
+    "cc.ak.us\0"
+    "academia.bo\0"
+    "co.nz\0"
+    "aga.niigata.jp\0"
+    "tiengiang.vn\0"
+    "lib.ct.us\0"
+    "cat.ax\0"
+    "com.mu\0"
+    "kristiansand.no\0"
+    "vpndns.net\0"
+    "xyz\0"
+    "foz.br\0"
+    "omniwe.site\0"
+    "sch.sa\0"
+    "cesena-forli.it\0"
+    "*.ck\0"
+    "akamaized.net\0"
+    "gucci\0"
+    "webview-assets.aws-cloud9.af-south-1.amazonaws.com\0"
+    "vfs.cloud9.ap-south-1.amazonaws.com\0"
+    "leczna.pl\0"
+    "pfizer\0"
+    "cu\0"
+    "網絡.cn\0"
+    "from-fl.com\0"
+    "porsangu.no\0"
+    "sokndal.no\0"
+    "andriatranibarletta.it\0"
+    "rovno.ua\0"
+    "kunohe.iwate.jp\0"
+    "arab\0"
+    "b-data.io\0"
+    "showa.gunma.jp\0"
+    "ac.lk\0"
+    "k8s.scw.cloud\0"
+    "vfs.cloud9.eu-central-1.amazonaws.com\0"
+    "kimino.wakayama.jp\0"
+    "hidaka.hokkaido.jp\0"
+    "vestnes.no\0"
+    "cri.nz\0"
+    "u2.xnbay.com\0"
+    "cloudns.info\0"
+    "andoy.no\0"
+    "ando.nara.jp\0"
+    "org.je\0"
+    "nowruz\0"
+    "com.sv\0"
+    "frl\0"
+    "endofinternet.org\0"
+    "dnsalias.org\0"
+    "divttasvuotna.no\0"
+    "etajima.hiroshima.jp\0"
+    "नेट\0"
+    "edu.gi\0"
+    "iida.nagano.jp\0"
+    "broker.aero\0"
+    "xy.ax\0"
+    "umi.fukuoka.jp\0"
+    "shimofusa.chiba.jp\0"
+    "org.br\0"
+    "kustanai.su\0"
+    "est-le-patron.com\0"
+    "5.bg\0"
+    "nakasatsunai.hokkaido.jp\0"
+    "tateyama.toyama.jp\0"
+    "algard.no\0"
+    "ladesk.com\0"
+    "lombardia.it\0"
+    "jcb\0"
+    "jprs\0"
+    "xz.cn\0"
+    "erimo.hokkaido.jp\0"
+    "uno\0"
+    "sanda.hyogo.jp\0"
+    "kawachinagano.osaka.jp\0"
+    "tanabe.kyoto.jp\0"
+    "k12.va.us\0"
+    "yoga\0"
+    "se.gov.br\0"
+    "ac.ug\0"
+    "n.se\0"
+    "embetsu.hokkaido.jp\0"
+    "surnadal.no\0"
+    "cr\0"
+    "umb.it\0"
+    "punyu.jp\0"
+    "ribeirao.br\0"
+    "ngrok.io\0"
+    "koeln\0"
+    "sakegawa.yamagata.jp\0"
+    "zama.kanagawa.jp\0"
+    "bærum.no\0"
+    "kerrylogistics\0"
+    "flora.no\0"
+    "lier.no\0"
+    "beagleboard.io\0"
+    "asia\0"
+    "platter-app.com\0"
+    "mil.do\0"
+    "hyundai\0"
+    "upaas.kazteleport.kz\0"
+    "tickets\0"
+    "loginline.dev\0"
+    "a.ssl.fastly.net\0"
+    "hiho.jp\0"
+    "trentin-süd-tirol.it\0"
+    "sande.vestfold.no\0"
+    "toei.aichi.jp\0"
+    "party\0"
+    "from-ut.com\0"
+    "nagara.chiba.jp\0"
+    "nishikatsura.yamanashi.jp\0"
+    "nec\0"
+    "itcouldbewor.se\0"
+    "post\0"
+    "台湾\0"
+    "qld.au\0"
+    "noticias.bo\0"
+    "moseushi.hokkaido.jp\0"
+    "hemnes.no\0"
+    "kuromatsunai.hokkaido.jp\0"
+    "unjárga.no\0"
+    "malbork.pl\0"
+    "edu.tw\0"
+    "guitars\0"
+    "miura.kanagawa.jp\0"
+    "katsuragi.wakayama.jp\0"
+    "dlugoleka.pl\0"
+    "mywire.org\0"
+    "eidsvoll.no\0"
+    "*.northflank.app\0"
+    "com.pe\0"
+    "gg.ax\0"
+    "an.it\0"
+    "travinh.vn\0"
+    "seiyo.ehime.jp\0"
+    "kutno.pl\0"
+    "eastus2.azurestaticapps.net\0"
+    "ud.it\0"
+    "sh\0"
+    "rokunohe.aomori.jp\0"
+    "homeoffice.gov.uk\0"
+    "*.devcdnaccesso.com\0"
+    "gloomy.jp\0"
+    "xii.jp\0"
+    "onomichi.hiroshima.jp\0"
+    "higashiizumo.shimane.jp\0"
+    "gl\0"
+    "games.hu\0"
+    "flights\0"
+    "b.br\0"
+    "ทหาร.ไทย\0"
+    "adv.br\0"
+    "jcloud-ver-jpc.ik-server.com\0"
+    "gjøvik.no\0"
+    "oracle\0"
+    "synology-ds.de\0"
+    "ferrero\0"
+    "susono.shizuoka.jp\0"
+    "lib.ri.us\0"
+    "hazu.aichi.jp\0"
+    "c.la\0"
+    "nagaokakyo.kyoto.jp\0"
+    "2038.io\0"
+    "6.bg\0"
+    "ainan.ehime.jp\0"
+    "union.aero\0"
+    "koshu.yamanashi.jp\0"
+    "website.yandexcloud.net\0"
+    "ac.zm\0"
+    "roros.no\0"
+    "*.magentosite.cloud\0"
+    "nc.tr\0"
+    "shonai.yamagata.jp\0"
+    "country\0"
+    "fastvps-server.com\0"
+    "edu.pe\0"
+    "gmail\0"
+    "nagi.okayama.jp\0"
+    "data\0"
+    "frosta.no\0"
+    "parts\0"
+    "aero.tt\0"
+    "yamagata.yamagata.jp\0"
+    "weatherchannel\0"
+    "press.aero\0"
+    "sør-fron.no\0"
+    "urbino-pesaro.it\0"
+    "skierva.no\0"
+    "co.vi\0"
+    "esan.hokkaido.jp\0"
+    "uz\0"
+    "shikaoi.hokkaido.jp\0"
+    "mine.nu\0"
+    "fujikawa.yamanashi.jp\0"
+    "ap-northeast-1.elasticbeanstalk.com\0"
+    "kotoura.tottori.jp\0"
+    "piedmont.it\0"
+    "altervista.org\0"
+    "com.om\0"
+    "blogspot.lt\0"
+    "dyn.cosidns.de\0"
+    "hagiang.vn\0"
+    "rogers\0"
+    "ind.br\0"
+    "is-certified.com\0"
+    "agdenes.no\0"
+    "td\0"
+    "gyeongnam.kr\0"
+    "cc.ky.us\0"
+    "protonet.io\0"
+    "trentinoalto-adige.it\0"
+    "blog.bo\0"
+    "ge\0"
+    "edgeapp.net\0"
+    "kawakita.ishikawa.jp\0"
+    "info.tt\0"
+    "edu.iq\0"
+    "cruise\0"
+    "cb.it\0"
+    "starachowice.pl\0"
+    "abkhazia.su\0"
+    "net.nf\0"
+    "app\0"
+    "ueda.nagano.jp\0"
+    "mimata.miyazaki.jp\0"
+    "from-wy.com\0"
+    "net.cy\0"
+    "nalchik.su\0"
+    "net.fj\0"
+    "agrigento.it\0"
+    "filegear-au.me\0"
+    "ohkura.yamagata.jp\0"
+    "sandcats.io\0"
+    "*.er\0"
+    "gob.gt\0"
+    "aizumisato.fukushima.jp\0"
+    "vinnica.ua\0"
+    "bjerkreim.no\0"
+    "ol.no\0"
+    "info.ls\0"
+    "education\0"
+    "academy\0"
+    "aq\0"
+    "giize.com\0"
+    "res.aero\0"
+    "khmelnytskyi.ua\0"
+    "mypep.link\0"
+    "service.one\0"
+    "onza.mythic-beasts.com\0"
+    "secret.jp\0"
+    "recreation.aero\0"
+    "岡山.jp\0"
+    "terni.it\0"
+    "onl\0"
+    "3utilities.com\0"
+    "skånland.no\0"
+    "globo\0"
+    "s3-ap-southeast-2.amazonaws.com\0"
+    "case\0"
+    "simplesite.gr\0"
+    "org.sv\0"
+    "de.eu.org\0"
+    "wiki.bo\0"
+    "ginan.gifu.jp\0"
+    "fans\0"
+    "geo.br\0"
+    "dsmynas.org\0"
+    "jobs.tt\0"
+    "bar0.net\0"
+    "gen.ng\0"
+    "pt.eu.org\0"
+    "weather\0"
+    "nanyo.yamagata.jp\0"
+    "in-dsl.de\0"
+    "webview-assets.aws-cloud9.sa-east-1.amazonaws.com\0"
+    "0e.vc\0"
+    "mypets.ws\0"
+    "sugito.saitama.jp\0"
+    "manaus.br\0"
+    "nl.ca\0"
+    "s3-website.nl-ams.scw.cloud\0"
+    "binhdinh.vn\0"
+    "mydobiss.com\0"
+    "arkhangelsk.su\0"
+    "monzabrianza.it\0"
+    "yamada.iwate.jp\0"
+    "edu.lv\0"
+    "com.tt\0"
+    "ownip.net\0"
+    "hof.no\0"
+    "nagai.yamagata.jp\0"
+    "binhduong.vn\0"
+    "museum.mw\0"
+    "e164.arpa\0"
+    "shiojiri.nagano.jp\0"
+    "net.ir\0"
+    "sch.ss\0"
+    "study\0"
+    "cm\0"
+    "blogspot.ba\0"
+    "karpacz.pl\0"
+    "svelvik.no\0"
+    "love\0"
+    "tomika.gifu.jp\0"
+    "ne.pw\0"
+    "myeffect.net\0"
+    "info.au\0"
+    "med.pl\0"
+    "cooperativa.bo\0"
+    "cloudcontrolled.com\0"
+    "user.srcf.net\0"
+    "tomioka.gunma.jp\0"
+    "mod.gi\0"
+    "k12.or.us\0"
+    "پاكستان\0"
+    "uber.space\0"
+    "or.ci\0"
+    "global\0"
+    "com.ly\0"
+    "mlb\0"
+    "go.ug\0"
+    "edogawa.tokyo.jp\0"
+    "wa.us\0"
+    "ntt\0"
+    "for-more.biz\0"
+    "dunlop\0"
+    "chigasaki.kanagawa.jp\0"
+    "blogspot.co.ke\0"
+    "impertrix.com\0"
+    "paas.datacenter.fi\0"
+    "ot.it\0"
+    "gov.rw\0"
+    "gov.mo\0"
+    "insurance.aero\0"
+    "ind.in\0"
+    "from-in.com\0"
+    "pv.it\0"
+    "lakas.hu\0"
+    "nico\0"
+    "vallée-d-aoste.it\0"
+    "trentino.it\0"
+    "bentley\0"
+    "ouchi.saga.jp\0"
+    "mi.us\0"
+    "yahoo\0"
+    "sarl\0"
+    "kakuda.miyagi.jp\0"
+    "trentinosudtirol.it\0"
+    "trani-andria-barletta.it\0"
+    "fst.br\0"
+    "gen.in\0"
+    "kinokawa.wakayama.jp\0"
+    "imb.br\0"
+    "musica.bo\0"
+    "av.it\0"
+    "gyeongbuk.kr\0"
+    "edu.hn\0"
+    "monza.it\0"
+    "cc\0"
+    "kikonai.hokkaido.jp\0"
+    "*.diher.solutions\0"
+    "kwp.gov.pl\0"
+    "under.jp\0"
+    "hurdal.no\0"
+    "vfs.cloud9.us-west-1.amazonaws.com\0"
+    "taiji.wakayama.jp\0"
+    "media.pl\0"
+    "hotel.tz\0"
+    "kiev.ua\0"
+    "myddns.rocks\0"
+    "埼玉.jp\0"
+    "name.jo\0"
+    "higashishirakawa.gifu.jp\0"
+    "at.vg\0"
+    "coop.in\0"
+    "通販\0"
+    "hisamitsu\0"
+    "beauty\0"
+    "nom.tm\0"
+    "*.paywhirl.com\0"
+    "oita.oita.jp\0"
+    "sos.pl\0"
+    "kamioka.akita.jp\0"
+    "n.bg\0"
+    "isahaya.nagasaki.jp\0"
+    "verona.it\0"
+    "strand.no\0"
+    "shiga.jp\0"
+    "rulez.jp\0"
+    "deno.dev\0"
+    "lib.sd.us\0"
+    "warszawa.pl\0"
+    "palermo.it\0"
+    "*.hosting.myjino.ru\0"
+    "ac.rs\0"
+    "co.gl\0"
+    "kasserver.com\0"
+    "中信\0"
+    "md.ci\0"
+    "sa.au\0"
+    "dvr\0"
+    "is-a-chef.org\0"
+    "austevoll.no\0"
+    "bzh\0"
+    "com.bt\0"
+    "mg\0"
+    "shijonawate.osaka.jp\0"
+    "emb.kw\0"
+    "org.za\0"
+    "com.nf\0"
+    "vlaanderen\0"
+    "org.es\0"
+    "lib.az.us\0"
+    "publishproxy.com\0"
+    "nc\0"
+    "suginami.tokyo.jp\0"
+    "vn\0"
+    "*.dev-builder.code.com\0"
+    "cc.wy.us\0"
+    "lg.jp\0"
+    "monster\0"
+    "draydns.de\0"
+    "kamisato.saitama.jp\0"
+    "karacol.su\0"
+    "allstate\0"
+    "org.tw\0"
+    "org.ec\0"
+    "net.th\0"
+    "kozagawa.wakayama.jp\0"
+    "gonohe.aomori.jp\0"
+    "soma.fukushima.jp\0"
+    "schokokeks.net\0"
+    "jelenia-gora.pl\0"
+    "final\0"
+    "us.reclaim.cloud\0"
+    "takata.fukuoka.jp\0"
+    "la\0"
+    "barsy.info\0"
+    "joinville.br\0"
+    "wloclawek.pl\0"
+    "rocher\0"
+    "lu.eu.org\0"
+    "tuxfamily.org\0"
+    "casino\0"
+    "lib.tx.us\0"
+    "com.kw\0"
+    "k12.ne.us\0"
+    "gs.st.no\0"
+    "takaishi.osaka.jp\0"
+    "nosegawa.nara.jp\0"
+    "hikone.shiga.jp\0"
+    "mil.ng\0"
+    "cc.tx.us\0"
+    "hirata.fukushima.jp\0"
+    "af\0"
+    "lt\0"
+    "lr\0"
+    "siena.it\0"
+    "tamakawa.fukushima.jp\0"
+    "org.ir\0"
+    "qld.gov.au\0"
+    "uchinada.ishikawa.jp\0"
+    "origins\0"
+    "*.triton.zone\0"
+    "boy.jp\0"
+    "community-pro.de\0"
+    "abc\0"
+    "business.in\0"
+    "gifu.jp\0"
+    "stavern.no\0"
+    "at.md\0"
+    "ålesund.no\0"
+    "fosnes.no\0"
+    "pgafan.net\0"
+    "co.ug\0"
+    "chikushino.fukuoka.jp\0"
+    "blogspot.gr\0"
+    "s3.eu-west-2.amazonaws.com\0"
+    "kvafjord.no\0"
+    "fedorapeople.org\0"
+    "vestre-slidre.no\0"
+    "jpmorgan\0"
+    "limanowa.pl\0"
+    "lig.it\0"
+    "org.ps\0"
+    "gov.ie\0"
+    "cc.as.us\0"
+    "knightpoint.systems\0"
+    "slg.br\0"
+    "hisayama.fukuoka.jp\0"
+    "bj.cn\0"
+    "static-access.net\0"
+    "a.run.app\0"
+    "k12.nh.us\0"
+    "ginoza.okinawa.jp\0"
+    "tateshina.nagano.jp\0"
+    "or.at\0"
+    "hiv\0"
+    "lib.mn.us\0"
+    "mattel\0"
+    "go.th\0"
+    "hopto.me\0"
+    "saogonca.br\0"
+    "doctor\0"
+    "kerryproperties\0"
+    "loabát.no\0"
+    "bi.it\0"
+    "fot.br\0"
+    "de.us\0"
+    "onagawa.miyagi.jp\0"
+    "save\0"
+    "name.my\0"
+    "kalmykia.su\0"
+    "nghean.vn\0"
+    "asahi.toyama.jp\0"
+    "urasoe.okinawa.jp\0"
+    "bcg\0"
+    "hdfcbank\0"
+    "集团\0"
+    "広島.jp\0"
+    "pink\0"
+    "com.pl\0"
+    "pe.ca\0"
+    "tm.pl\0"
+    "org.gn\0"
+    "gov.ss\0"
+    "courses\0"
+    "hotel.lk\0"
+    "gjerdrum.no\0"
+    "lon.wafaicloud.com\0"
+    "trentino-altoadige.it\0"
+    "discourse.team\0"
+    "info.tn\0"
+    "iwaizumi.iwate.jp\0"
+    "inagi.tokyo.jp\0"
+    "blog\0"
+    "dyndns-remote.com\0"
+    "web.bo\0"
+    "fukuroi.shizuoka.jp\0"
+    "prof\0"
+    "watson.jp\0"
+    "or.th\0"
+    "hobøl.no\0"
+    "cloudns.biz\0"
+    "fyresdal.no\0"
+    "calvinklein\0"
+    "office\0"
+    "for-our.info\0"
+    "saves-the-whales.com\0"
+    "my-router.de\0"
+    "takahama.fukui.jp\0"
+    "cloudapp.net\0"
+    "sukumo.kochi.jp\0"
+    "psp.gov.pl\0"
+    "hu.com\0"
+    "net.ye\0"
+    "shirataka.yamagata.jp\0"
+    "cc.na\0"
+    "obuse.nagano.jp\0"
+    "kyonan.chiba.jp\0"
+    "binhthuan.vn\0"
+    "is-a-democrat.com\0"
+    "kirovograd.ua\0"
+    "chimkent.su\0"
+    "sakai.fukui.jp\0"
+    "stjørdalshalsen.no\0"
+    "ht\0"
+    "k12.il\0"
+    "tatsuno.hyogo.jp\0"
+    "e.se\0"
+    "meland.no\0"
+    "fyi\0"
+    "12hp.at\0"
+    "hotmail\0"
+    "edu.co\0"
+    "log.br\0"
+    "claims\0"
+    "org.pe\0"
+    "lohmus.me\0"
+    "gov.my\0"
+    "utashinai.hokkaido.jp\0"
+    "free\0"
+    "hakata.fukuoka.jp\0"
+    "web.pk\0"
+    "evenassi.no\0"
+    "site\0"
+    "mazury.pl\0"
+    "myspreadshop.com.au\0"
+    "towada.aomori.jp\0"
+    "bieszczady.pl\0"
+    "hi.us\0"
+    "vao.it\0"
+    "trust\0"
+    "airkitapps-au.com\0"
+    "web.tr\0"
+    "wtf\0"
+    "cc.vi.us\0"
+    "lib.wa.us\0"
+    "tama.tokyo.jp\0"
+    "kitaakita.akita.jp\0"
+    "vevelstad.no\0"
+    "rr.gov.br\0"
+    "uk.oxa.cloud\0"
+    "yorii.saitama.jp\0"
+    "亚马逊\0"
+    "mosvik.no\0"
+    "sasaguri.fukuoka.jp\0"
+    "samsung\0"
+    "fujiidera.osaka.jp\0"
+    "suifu.ibaraki.jp\0"
+    "org.lc\0"
+    "baby\0"
+    "akishima.tokyo.jp\0"
+    "noop.app\0"
+    "sayo.hyogo.jp\0"
+    "caa.li\0"
+    "健康\0"
+    "casino.hu\0"
+    "liguria.it\0"
+    "pp.ru\0"
+    "podhale.pl\0"
+    "org.sl\0"
+    "shw.io\0"
+    "museum.no\0"
+    "myqnapcloud.com\0"
+    "org.to\0"
+    "ciencia.bo\0"
+    "takanabe.miyazaki.jp\0"
+    "saltdal.no\0"
+    "bitbucket.io\0"
+    "ao\0"
+    "рф\0"
+    "s3-website-sa-east-1.amazonaws.com\0"
+    "prd.mg\0"
+    "localhost.daplie.me\0"
+    "chungbuk.kr\0"
+    "quest\0"
+    "gda.pl\0"
+    "natural.bo\0"
+    "rackmaze.net\0"
+    "nishinomiya.hyogo.jp\0"
+    "yonezawa.yamagata.jp\0"
+    "shimokitayama.nara.jp\0"
+    "holtålen.no\0"
+    "katsuyama.fukui.jp\0"
+    "erni\0"
+    "tanabe.wakayama.jp\0"
+    "myfritz.net\0"
+    "sn.cn\0"
+    "termez.su\0"
+    "lego\0"
+    "ninomiya.kanagawa.jp\0"
+    "stjordal.no\0"
+    "snasa.no\0"
+    "yaita.tochigi.jp\0"
+    "s3-website.us-east-2.amazonaws.com\0"
+    "org.ae\0"
+    "ftr\0"
+    "aéroport.ci\0"
+    "pi.gov.br\0"
+    "trentino-südtirol.it\0"
+    "bh\0"
+    "kråanghke.no\0"
+    "maringa.br\0"
+    "flickr\0"
+    "b.ssl.fastly.net\0"
+    "商店\0"
+    "varese.it\0"
+    "biz.wf\0"
+    "hasura-app.io\0"
+    "wroclaw.pl\0"
+    "mysecuritycamera.net\0"
+    "roan.no\0"
+    "gf\0"
+    "mcpre.ru\0"
+    "from-sc.com\0"
+    "kvitsoy.no\0"
+    "live\0"
+    "maori.nz\0"
+    "my-firewall.org\0"
+    "gs.rl.no\0"
+    "kaufen\0"
+    "komagane.nagano.jp\0"
+    "rs.gov.br\0"
+    "sdscloud.pl\0"
+    "kragero.no\0"
+    "ink\0"
+    "ulvik.no\0"
+    "eu-4.evennode.com\0"
+    "snåsa.no\0"
+    "ne.kr\0"
+    "taishi.hyogo.jp\0"
+    "miyada.nagano.jp\0"
+    "solutions\0"
+    "is-a-soxfan.org\0"
+    "hashimoto.wakayama.jp\0"
+    "org.bh\0"
+    "الجزائر\0"
+    "cc.md.us\0"
+    "naoshima.kagawa.jp\0"
+    "t3l3p0rt.net\0"
+    "kitagawa.miyazaki.jp\0"
+    "wpmudev.host\0"
+    "phutho.vn\0"
+    "báhcavuotna.no\0"
+    "sony\0"
+    "spjelkavik.no\0"
+    "stuff-4-sale.us\0"
+    "rent\0"
+    "barsy.io\0"
+    "fujikawaguchiko.yamanashi.jp\0"
+    "szczytno.pl\0"
+    "edu.gr\0"
+    "!city.kitakyushu.jp\0"
+    "tjeldsund.no\0"
+    "ybo.review\0"
+    "krellian.net\0"
+    "balena-devices.com\0"
+    "campobasso.it\0"
+    "fukui.jp\0"
+    "net.mk\0"
+    "la-spezia.it\0"
+    "mp.br\0"
+    "rio\0"
+    "fed.us\0"
+    "in.ngrok.io\0"
+    "eid.no\0"
+    "kasai.hyogo.jp\0"
+    "ec\0"
+    "sicilia.it\0"
+    "gob.pe\0"
+    "mn.it\0"
+    "rælingen.no\0"
+    "edu.eg\0"
+    "austrheim.no\0"
+    "nt.edu.au\0"
+    "j.layershift.co.uk\0"
+    "gov.ge\0"
+    "ups\0"
+    "vip.jelastic.cloud\0"
+    "tokai.ibaraki.jp\0"
+    "ox.rs\0"
+    "blogspot.sg\0"
+    "biz.pr\0"
+    "net.ky\0"
+    "theater\0"
+    "ポイント\0"
+    "search\0"
+    "熊本.jp\0"
+    "yotsukaido.chiba.jp\0"
+    "山梨.jp\0"
+    "kakogawa.hyogo.jp\0"
+    "eu-1.evennode.com\0"
+    "k12.wa.us\0"
+    "kisarazu.chiba.jp\0"
+    "er.in\0"
+    "com.gy\0"
+    "takatsuki.osaka.jp\0"
+    "furubira.hokkaido.jp\0"
+    "ciscofreak.com\0"
+    "miyama.mie.jp\0"
+    "*.build.run\0"
+    "school.za\0"
+    "stream\0"
+    "swiss\0"
+    "kadena.okinawa.jp\0"
+    "net.mw\0"
+    "com.sb\0"
+    "store\0"
+    "årdal.no\0"
+    "l-o-g-i-n.de\0"
+    "s3-website.eu-central-1.amazonaws.com\0"
+    "biz.ss\0"
+    "ком.рус\0"
+    "oops.jp\0"
+    "stor-elvdal.no\0"
+    "nsw.au\0"
+    "fedex\0"
+    "avocats.bj\0"
+    "drud.io\0"
+    "is-gone.com\0"
+    "pe.kr\0"
+    "بيتك\0"
+    "frogans\0"
+    "ecn.br\0"
+    "travel.in\0"
+    "at\0"
+    "arts.nf\0"
+    "pc.it\0"
+    "pro.az\0"
+    "api.gov.uk\0"
+    "now.sh\0"
+    "kraanghke.no\0"
+    "ren\0"
+    "med.ly\0"
+    "jewelry\0"
+    "direct\0"
+    "partners\0"
+    "photos\0"
+    "lublin.pl\0"
+    "gov.hk\0"
+    "edu.sc\0"
+    "kawaguchi.saitama.jp\0"
+    "blog.kg\0"
+    "molise.it\0"
+    "ayase.kanagawa.jp\0"
+    "unjarga.no\0"
+    "com.bi\0"
+    "bergen.no\0"
+    "pavia.it\0"
+    "tahara.aichi.jp\0"
+    "aejrie.no\0"
+    "hockey\0"
+    "chikusei.ibaraki.jp\0"
+    "dnsalias.net\0"
+    "eu.com\0"
+    "срб\0"
+    "phd\0"
+    "tires\0"
+    "yalta.ua\0"
+    "kota.aichi.jp\0"
+    "lima.zone\0"
+    "nikaho.akita.jp\0"
+    "oizumi.gunma.jp\0"
+    "from-wa.com\0"
+    "webview-assets.cloud9.eu-west-1.amazonaws.com\0"
+    "immobilien\0"
+    "ac.gov.br\0"
+    "economia.bo\0"
+    "tm.mc\0"
+    "org.fj\0"
+    "yahaba.iwate.jp\0"
+    "kita.tokyo.jp\0"
+    "sakai.ibaraki.jp\0"
+    "vg\0"
+    "stat.no\0"
+    "webhop.info\0"
+    "abogado\0"
+    "onion\0"
+    "tokoname.aichi.jp\0"
+    "jdf.br\0"
+    "fujisawa.kanagawa.jp\0"
+    "tn.oxa.cloud\0"
+    "chernihiv.ua\0"
+    "ايران.ir\0"
+    "cooking\0"
+    "oiso.kanagawa.jp\0"
+    "*.otap.co\0"
+    "gen.nz\0"
+    "zao.miyagi.jp\0"
+    "tako.chiba.jp\0"
+    "biz.et\0"
+    "lds\0"
+    "tools\0"
+    "seoul.kr\0"
+    "is-an-actress.com\0"
+    "mugi.tokushima.jp\0"
+    "ufcfan.org\0"
+    "kyotango.kyoto.jp\0"
+    "kyotanabe.kyoto.jp\0"
+    "etisalat\0"
+    "lyngen.no\0"
+    "go.leg.br\0"
+    "backan.vn\0"
+    "p.bg\0"
+    "trentino-süd-tirol.it\0"
+    "mil.by\0"
+    "is-a-knight.org\0"
+    "re.it\0"
+    "mat.br\0"
+    "இந்தியா\0"
+    "moscow\0"
+    "otsu.shiga.jp\0"
+    "nishihara.okinawa.jp\0"
+    "yamatotakada.nara.jp\0"
+    "from-nh.com\0"
+    "karatsu.saga.jp\0"
+    "is-a-musician.com\0"
+    "bharti\0"
+    "naklo.pl\0"
+    "中文网\0"
+    "north-kazakhstan.su\0"
+    "of.no\0"
+    "tourism.pl\0"
+    "accident-investigation.aero\0"
+    "vapor.cloud\0"
+    "ntr.br\0"
+    "sandnes.no\0"
+    "curv.dev\0"
+    "ino.kochi.jp\0"
+    "wellbeingzone.eu\0"
+    "bologna.it\0"
+    "atami.shizuoka.jp\0"
+    "com.de\0"
+    "hlx3.page\0"
+    "dsmynas.net\0"
+    "publ.pt\0"
+    "servecounterstrike.com\0"
+    "drobak.no\0"
+    "nissan\0"
+    "lancaster\0"
+    "com.br\0"
+    "sd.us\0"
+    "cc.ua\0"
+    "nfshost.com\0"
+    "us.ngrok.io\0"
+    "sells-it.net\0"
+    "wang\0"
+    "moriyoshi.akita.jp\0"
+    "edu.bt\0"
+    "ڀارت\0"
+    "volyn.ua\0"
+    "motoyama.kochi.jp\0"
+    "edu.bi\0"
+    "edu.py\0"
+    "ng\0"
+    "progressive\0"
+    "higashimatsuyama.saitama.jp\0"
+    "vefsn.no\0"
+    "nsn.us\0"
+    "bø.telemark.no\0"
+    "aioi.hyogo.jp\0"
+    "yachimata.chiba.jp\0"
+    "onporter.run\0"
+    "net.cm\0"
+    "codeberg.page\0"
+    "feedback\0"
+    "lezajsk.pl\0"
+    "airline.aero\0"
+    "fujisato.akita.jp\0"
+    "serveexchange.com\0"
+    "netgamers.jp\0"
+    "presse.km\0"
+    "cechire.com\0"
+    "tattoo\0"
+    "pro.in\0"
+    "re.kr\0"
+    "co.technology\0"
+    "catering.aero\0"
+    "commbank\0"
+    "takahagi.ibaraki.jp\0"
+    "nakagawa.fukuoka.jp\0"
+    "authgear-staging.com\0"
+    "gov.ar\0"
+    "dental\0"
+    "001www.com\0"
+    "mihama.mie.jp\0"
+    "dscloud.me\0"
+    "no-ip.biz\0"
+    "ac.rw\0"
+    "mil.ae\0"
+    "paas.beebyte.io\0"
+    "сочи.рус\0"
+    "wakasa.tottori.jp\0"
+    "google\0"
+    "aoki.nagano.jp\0"
+    "citic\0"
+    "bearalváhki.no\0"
+    "matsuzaki.shizuoka.jp\0"
+    "com.fr\0"
+    "vegas\0"
+    "edu.pn\0"
+    "سورية\0"
+    "dongthap.vn\0"
+    "natori.miyagi.jp\0"
+    "tur.br\0"
+    "pb.ao\0"
+    "gulen.no\0"
+    "uk.in\0"
+    "opoczno.pl\0"
+    "voting\0"
+    "mx.na\0"
+    "film.hu\0"
+    "luxury\0"
+    "luxe\0"
+    "rec.co\0"
+    "ybo.trade\0"
+    "navigation.aero\0"
+    "1kapp.com\0"
+    "theshop.jp\0"
+    "アマゾン\0"
+    "cz.it\0"
+    "kitahata.saga.jp\0"
+    "odda.no\0"
+    "go.pw\0"
+    "k12.ct.us\0"
+    "k12.az.us\0"
+    "red\0"
+    "unusualperson.com\0"
+    "travelers\0"
+    "next\0"
+    "s3-fips-us-gov-west-1.amazonaws.com\0"
+    "avellino.it\0"
+    "yachiyo.ibaraki.jp\0"
+    "omihachiman.shiga.jp\0"
+    "independent-commission.uk\0"
+    "glogow.pl\0"
+    "encoreapi.com\0"
+    "kawanishi.hyogo.jp\0"
+    "modalen.no\0"
+    "adachi.tokyo.jp\0"
+    "messerli.app\0"
+    "heteml.net\0"
+    "hacca.jp\0"
+    "h.se\0"
+    "bremanger.no\0"
+    "tsk.tr\0"
+    "gob.sv\0"
+    "edu.es\0"
+    "off.ai\0"
+    "q.bg\0"
+    "fun\0"
+    "foo\0"
+    "is-a-geek.org\0"
+    "aya.miyazaki.jp\0"
+    "no-ip.info\0"
+    "tax\0"
+    "tsukui.kanagawa.jp\0"
+    "org.bt\0"
+    "cpa\0"
+    "conf.lv\0"
+    "cymru\0"
+    "menu\0"
+    "fastly-edge.com\0"
+    "edu.ki\0"
+    "care\0"
+    "bitter.jp\0"
+    "hiroo.hokkaido.jp\0"
+    "sosa.chiba.jp\0"
+    "carrara-massa.it\0"
+    "mil.ac\0"
+    "dønna.no\0"
+    "trentino-sudtirol.it\0"
+    "ostrowwlkp.pl\0"
+    "lib.ny.us\0"
+    "gov.sg\0"
+    "handa.aichi.jp\0"
+    "gov.lv\0"
+    "网络\0"
+    "forde.no\0"
+    "østre-toten.no\0"
+    "cn.eu.org\0"
+    "r.se\0"
+    "machida.tokyo.jp\0"
+    "co.ca\0"
+    "priv.instances.scw.cloud\0"
+    "net.je\0"
+    "int.az\0"
+    "peewee.jp\0"
+    "siiites.com\0"
+    "yomitan.okinawa.jp\0"
+    "skanit.no\0"
+    "info.cx\0"
+    "org.gp\0"
+    "shibukawa.gunma.jp\0"
+    "minamisanriku.miyagi.jp\0"
+    "griw.gov.pl\0"
+    "stryn.no\0"
+    "rn.gov.br\0"
+    "orangecloud.tn\0"
+    "org.tt\0"
+    "sites.static.land\0"
+    "misato.saitama.jp\0"
+    "steinkjer.no\0"
+    "soka.saitama.jp\0"
+    "sk.eu.org\0"
+    "shimane.shimane.jp\0"
+    "co.za\0"
+    "bir.ru\0"
+    "gujarat.in\0"
+    "2.bg\0"
+    "coop.py\0"
+    "gallery\0"
+    "daynight.jp\0"
+    "cuiaba.br\0"
+    "winb.gov.pl\0"
+    "tickets.io\0"
+    "asakawa.fukushima.jp\0"
+    "tsuiki.fukuoka.jp\0"
+    "gob.cl\0"
+    "kiso.nagano.jp\0"
+    "co.it\0"
+    "org.ph\0"
+    "gs.tr.no\0"
+    "uppo.gov.pl\0"
+    "asso.nc\0"
+    "customer.mythic-beasts.com\0"
+    "siracusa.it\0"
+    "homeunix.net\0"
+    "*.vps.myjino.ru\0"
+    "xs4all.space\0"
+    "suwa.nagano.jp\0"
+    "k12.mn.us\0"
+    "avocat.pro\0"
+    "cheap\0"
+    "lotto\0"
+    "loginline.app\0"
+    "idv.tw\0"
+    "minamifurano.hokkaido.jp\0"
+    "takasu.hokkaido.jp\0"
+    "nalchik.ru\0"
+    "czeladz.pl\0"
+    "企业\0"
+    "glug.org.uk\0"
+    "ipiranga\0"
+    "med.ht\0"
+    "statefarm\0"
+    "mysecuritycamera.org\0"
+    "coop.ht\0"
+    "s3.ap-south-1.amazonaws.com\0"
+    "*.cryptonomic.net\0"
+    "trentinoaltoadige.it\0"
+    "zero\0"
+    "kita.kyoto.jp\0"
+    "bplaced.de\0"
+    "football\0"
+    "like\0"
+    "al\0"
+    "дети\0"
+    "ynh.fr\0"
+    "dynvpn.de\0"
+    "onna.okinawa.jp\0"
+    "aichi.jp\0"
+    "webview-assets.aws-cloud9.eu-west-3.amazonaws.com\0"
+    "iizuna.nagano.jp\0"
+    "qc.ca\0"
+    "alesund.no\0"
+    "blogspot.qa\0"
+    "s3-website-ap-southeast-1.amazonaws.com\0"
+    "福岡.jp\0"
+    "lorenskog.no\0"
+    "rodeo\0"
+    "12hp.de\0"
+    "banamex\0"
+    "հայ\0"
+    "wiki.br\0"
+    "kamifurano.hokkaido.jp\0"
+    "from-ri.com\0"
+    "*.r.appspot.com\0"
+    "pixolino.com\0"
+    "boehringer\0"
+    "co.ua\0"
+    "gov.br\0"
+    "ono.fukushima.jp\0"
+    "ruhr\0"
+    "lib.ga.us\0"
+    "homeunix.org\0"
+    "blogspot.co.at\0"
+    "penne.jp\0"
+    "ri.us\0"
+    "rennesøy.no\0"
+    "qualifioapp.com\0"
+    "yao.osaka.jp\0"
+    "shiranuka.hokkaido.jp\0"
+    "mitane.akita.jp\0"
+    "fi.cr\0"
+    "tosashimizu.kochi.jp\0"
+    "doshi.yamanashi.jp\0"
+    "tamba.hyogo.jp\0"
+    "mil.cy\0"
+    "noip.me\0"
+    "rade.no\0"
+    "dyn.ddnss.de\0"
+    "miyota.nagano.jp\0"
+    "sg\0"
+    "firewall-gateway.com\0"
+    "info.gu\0"
+    "tw.cn\0"
+    "autos\0"
+    "midsund.no\0"
+    "ollo\0"
+    "滋賀.jp\0"
+    "cc.co.us\0"
+    "mil.tr\0"
+    "konsulat.gov.pl\0"
+    "xen.prgmr.com\0"
+    "discover\0"
+    "my.eu.org\0"
+    "accountants\0"
+    "shimane.jp\0"
+    "sannan.hyogo.jp\0"
+    "gushikami.okinawa.jp\0"
+    "int.co\0"
+    "ct.us\0"
+    "nara.jp\0"
+    "online\0"
+    "kawakami.nara.jp\0"
+    "mtr\0"
+    "kamisu.ibaraki.jp\0"
+    "coupon\0"
+    "fuchu.tokyo.jp\0"
+    "kuzumaki.iwate.jp\0"
+    "edu.zm\0"
+    "sy\0"
+    "mincom.tn\0"
+    "med.ee\0"
+    "kharkiv.ua\0"
+    "khmelnitskiy.ua\0"
+    "susaki.kochi.jp\0"
+    "page\0"
+    "co.cz\0"
+    "www.ro\0"
+    "bindal.no\0"
+    "rn.leg.br\0"
+    "dp.ua\0"
+    "barsy.me\0"
+    "kanagawa.jp\0"
+    "takehara.hiroshima.jp\0"
+    "gg\0"
+    "bømlo.no\0"
+    "minamiizu.shizuoka.jp\0"
+    "healthcare\0"
+    "got\0"
+    "wlocl.pl\0"
+    "kin.okinawa.jp\0"
+    "cc.hn\0"
+    "dynalias.com\0"
+    "lavangen.no\0"
+    "lib.pa.us\0"
+    "chuo.yamanashi.jp\0"
+    "in-butter.de\0"
+    "republican\0"
+    "net.tr\0"
+    "webcam\0"
+    "anamizu.ishikawa.jp\0"
+    "gov.as\0"
+    "thainguyen.vn\0"
+    "mitsue.nara.jp\0"
+    "prd.fr\0"
+    "net.bm\0"
+    "name.et\0"
+    "yusuhara.kochi.jp\0"
+    "ac.se\0"
+    "adv.mz\0"
+    "gov.by\0"
+    "nagasu.kumamoto.jp\0"
+    "net.mo\0"
+    "gs\0"
+    "freesite.host\0"
+    "webview-assets.cloud9.ap-southeast-2.amazonaws.com\0"
+    "fudai.iwate.jp\0"
+    "sevastopol.ua\0"
+    "biz.cy\0"
+    "org.mu\0"
+    "x.mythic-beasts.com\0"
+    "arita.saga.jp\0"
+    "life\0"
+    "cloudns.pro\0"
+    "mircloud.us\0"
+    "axa\0"
+    "hiraya.nagano.jp\0"
+    "realestate.pl\0"
+    "kapsi.fi\0"
+    "wedeploy.io\0"
+    "ac.im\0"
+    "snaase.no\0"
+    "takamatsu.kagawa.jp\0"
+    "edu.sy\0"
+    "padova.it\0"
+    "whitesnow.jp\0"
+    "boo.jp\0"
+    "iveland.no\0"
+    "hokuto.hokkaido.jp\0"
+    "otake.hiroshima.jp\0"
+    "skin\0"
+    "com.pr\0"
+    "krym.ua\0"
+    "org.lb\0"
+    "net.so\0"
+    "seiro.niigata.jp\0"
+    "vågå.no\0"
+    "cc.wa.us\0"
+    "deca.jp\0"
+    "mo.it\0"
+    "wegrow.pl\0"
+    "brand.se\0"
+    "cdn77-ssl.net\0"
+    "archi\0"
+    "kaita.hiroshima.jp\0"
+    "center\0"
+    "wnext.app\0"
+    "sa.gov.pl\0"
+    "act.edu.au\0"
+    "sakyo.kyoto.jp\0"
+    "movie\0"
+    "works.aero\0"
+    "getmyip.com\0"
+    "kure.hiroshima.jp\0"
+    "องค์กร.ไทย\0"
+    "merckmsd\0"
+    "tysfjord.no\0"
+    "fr\0"
+    "szczecin.pl\0"
+    "webhop.net\0"
+    "firm.ve\0"
+    "from-nc.com\0"
+    "is-a-landscaper.com\0"
+    "matsue.shimane.jp\0"
+    "washtenaw.mi.us\0"
+    "matsushima.miyagi.jp\0"
+    "blogspot.com.mt\0"
+    "marugame.kagawa.jp\0"
+    "kudamatsu.yamaguchi.jp\0"
+    "kitaaiki.nagano.jp\0"
+    "org.gh\0"
+    "giehtavuoatna.no\0"
+    "kariwa.niigata.jp\0"
+    "uy.com\0"
+    "tos.it\0"
+    "tsuga.tochigi.jp\0"
+    "fredrikstad.no\0"
+    "genkai.saga.jp\0"
+    "s3.ca-central-1.amazonaws.com\0"
+    "from-vt.com\0"
+    "xerox\0"
+    "potager.org\0"
+    "sd\0"
+    "o.se\0"
+    "net.ac\0"
+    "minamiminowa.nagano.jp\0"
+    "veneto.it\0"
+    "z.se\0"
+    "org.af\0"
+    "zuerich\0"
+    "kasuya.fukuoka.jp\0"
+    "澳门\0"
+    "omura.nagasaki.jp\0"
+    "mircloud.host\0"
+    "nba\0"
+    "com.lb\0"
+    "aland.fi\0"
+    "is-a-bruinsfan.org\0"
+    "råde.no\0"
+    "ir\0"
+    "sálat.no\0"
+    "paragliding.aero\0"
+    "oseto.nagasaki.jp\0"
+    "takasago.hyogo.jp\0"
+    "kainan.tokushima.jp\0"
+    "ybo.party\0"
+    "parti.se\0"
+    "gitpage.si\0"
+    "leaŋgaviika.no\0"
+    "mikawa.yamagata.jp\0"
+    "murakami.niigata.jp\0"
+    "sn\0"
+    "ma.leg.br\0"
+    "*.sys.qcx.io\0"
+    "smartlabeling.scw.cloud\0"
+    "framer.wiki\0"
+    "ma.gov.br\0"
+    "principe.st\0"
+    "pt.it\0"
+    "org.km\0"
+    "isa-geek.org\0"
+    "ballangen.no\0"
+    "blogspot.co.il\0"
+    "edu.pk\0"
+    "saotome.st\0"
+    "佐賀.jp\0"
+    "msd\0"
+    "resindevice.io\0"
+    "kerryhotels\0"
+    "conf.se\0"
+    "bargains\0"
+    "star\0"
+    "pilot.aero\0"
+    "bloomberg\0"
+    "ål.no\0"
+    "firebaseapp.com\0"
+    "pro.mv\0"
+    "saroma.hokkaido.jp\0"
+    "oga.akita.jp\0"
+    "traeumtgerade.de\0"
+    "narusawa.yamanashi.jp\0"
+    "naha.okinawa.jp\0"
+    "gos.pk\0"
+    "امارات\0"
+    "org.mo\0"
+    "yamakita.kanagawa.jp\0"
+    "esp.br\0"
+    "gaivuotna.no\0"
+    "gs.nt.no\0"
+    "mcpe.me\0"
+    "leirvik.no\0"
+    "whoswho\0"
+    "softbank\0"
+    "lecco.it\0"
+    "fujieda.shizuoka.jp\0"
+    "ggf.br\0"
+    "kawasaki.miyagi.jp\0"
+    "org.am\0"
+    "izu.shizuoka.jp\0"
+    "الاردن\0"
+    "otaki.chiba.jp\0"
+    "apigee.io\0"
+    "higashiizu.shizuoka.jp\0"
+    "allfinanz\0"
+    "brescia.it\0"
+    "mt.eu.org\0"
+    "lacaixa\0"
+    "holiday\0"
+    "cat\0"
+    "ky.us\0"
+    "shishikui.tokushima.jp\0"
+    "niigata.niigata.jp\0"
+    "taka.hyogo.jp\0"
+    "gov.pr\0"
+    "москва\0"
+    "kommune.no\0"
+    "akkeshi.hokkaido.jp\0"
+    "andasuolo.no\0"
+    "iamallama.com\0"
+    "food\0"
+    "ine.kyoto.jp\0"
+    "lib.nc.us\0"
+    "web.gu\0"
+    "tm.za\0"
+    "ed.cr\0"
+    "g.bg\0"
+    "vf.no\0"
+    "pw\0"
+    "s3.dualstack.us-east-2.amazonaws.com\0"
+    "dyrøy.no\0"
+    "bounceme.net\0"
+    "chosei.chiba.jp\0"
+    "ind.kw\0"
+    "tachiarai.fukuoka.jp\0"
+    "uw.gov.pl\0"
+    "so.gov.pl\0"
+    "galsa.no\0"
+    "hu.net\0"
+    "pa\0"
+    "nago.okinawa.jp\0"
+    "ina.nagano.jp\0"
+    "wakayama.jp\0"
+    "fh.se\0"
+    "ru.eu.org\0"
+    "we.bs\0"
+    "sør-varanger.no\0"
+    "co.gg\0"
+    "walter\0"
+    "bv\0"
+    "ally\0"
+    "ternopil.ua\0"
+    "kamo.kyoto.jp\0"
+    "vfs.cloud9.ap-northeast-3.amazonaws.com\0"
+    "lom.it\0"
+    "luster.no\0"
+    "aizubange.fukushima.jp\0"
+    "ryukyu\0"
+    "kusu.oita.jp\0"
+    "marker.no\0"
+    "boutir.com\0"
+    "mlbfan.org\0"
+    "me.ke\0"
+    "fldrv.com\0"
+    "net.kw\0"
+    "hattfjelldal.no\0"
+    "hirono.fukushima.jp\0"
+    "bbva\0"
+    "ddnslive.com\0"
+    "blogspot.fr\0"
+    "ivgu.no\0"
+    "sanuki.kagawa.jp\0"
+    "reservd.dev.thingdust.io\0"
+    "ca\0"
+    "net.nr\0"
+    "tjx\0"
+    "minami-alps.yamanashi.jp\0"
+    "aquila.it\0"
+    "hanno.saitama.jp\0"
+    "kawaue.gifu.jp\0"
+    "jeez.jp\0"
+    "lcube-server.de\0"
+    "iruma.saitama.jp\0"
+    "wien.funkfeuer.at\0"
+    "friuliv-giulia.it\0"
+    "net.kz\0"
+    "gov.cu\0"
+    "no.com\0"
+    "ag\0"
+    "webview-assets.aws-cloud9.eu-south-1.amazonaws.com\0"
+    "lib.nh.us\0"
+    "okegawa.saitama.jp\0"
+    "deci.jp\0"
+    "unicloud.pl\0"
+    "js.cn\0"
+    "tokyo\0"
+    "jab.br\0"
+    "iizuka.fukuoka.jp\0"
+    "epson\0"
+    "association.aero\0"
+    "en-root.fr\0"
+    "ishikari.hokkaido.jp\0"
+    "futuremailing.at\0"
+    "oto.fukuoka.jp\0"
+    "askoy.no\0"
+    "mie.jp\0"
+    "rackmaze.com\0"
+    "prato.it\0"
+    "jus.br\0"
+    "friuli-vgiulia.it\0"
+    "creditcard\0"
+    "hyogo.jp\0"
+    "mints.ne.jp\0"
+    "riik.ee\0"
+    "brindisi.it\0"
+    "com.es\0"
+    "expert\0"
+    "sekigahara.gifu.jp\0"
+    "biz.fj\0"
+    "infiniti\0"
+    "*.ocs.customer-oci.com\0"
+    "hakodate.hokkaido.jp\0"
+    "asakuchi.okayama.jp\0"
+    "edu.ws\0"
+    "tysnes.no\0"
+    "barsy.online\0"
+    "from-tn.com\0"
+    "mc\0"
+    "اتصالات\0"
+    "kakinoki.shimane.jp\0"
+    "saga.saga.jp\0"
+    "bodo.no\0"
+    "sor-fron.no\0"
+    "shiwa.iwate.jp\0"
+    "koge.tottori.jp\0"
+    "ancona.it\0"
+    "gru.br\0"
+    "tana.no\0"
+    "co.com\0"
+    "gok.pk\0"
+    "gov.cd\0"
+    "pug.it\0"
+    "fastvps.site\0"
+    "chieti.it\0"
+    "webview-assets.cloud9.sa-east-1.amazonaws.com\0"
+    "大阪.jp\0"
+    "zentsuji.kagawa.jp\0"
+    "is-a-nurse.com\0"
+    "londrina.br\0"
+    "dnipropetrovsk.ua\0"
+    "undo.jp\0"
+    "edu.cu\0"
+    "senasa.ar\0"
+    "stargard.pl\0"
+    "floro.no\0"
+    "ph\0"
+    "independent-inquest.uk\0"
+    "mydrobo.com\0"
+    "!city.nagoya.jp\0"
+    "is-a-teacher.com\0"
+    "laakesvuemie.no\0"
+    "ck.ua\0"
+    "afjord.no\0"
+    "dc.us\0"
+    "atm.pl\0"
+    "corsica\0"
+    "qld.edu.au\0"
+    "web.lk\0"
+    "realestate\0"
+    "lib.as.us\0"
+    "wakkanai.hokkaido.jp\0"
+    "nakano.tokyo.jp\0"
+    "kira.aichi.jp\0"
+    "lib.mi.us\0"
+    "tv.na\0"
+    "vi.it\0"
+    "sagamihara.kanagawa.jp\0"
+    "orskog.no\0"
+    "supabase.co\0"
+    "bolzano.it\0"
+    "kanmaki.nara.jp\0"
+    "industria.bo\0"
+    "design.aero\0"
+    "romsa.no\0"
+    "gv.vc\0"
+    "modum.no\0"
+    "wakuya.miyagi.jp\0"
+    "org.kg\0"
+    "همراه\0"
+    "tempio-olbia.it\0"
+    "tp.it\0"
+    "nagatoro.saitama.jp\0"
+    "gov.la\0"
+    "boutique\0"
+    "here-for-more.info\0"
+    "langevåg.no\0"
+    "trentin-sued-tirol.it\0"
+    "on-web.fr\0"
+    "net.sg\0"
+    "futbol\0"
+    "net.tm\0"
+    "muika.niigata.jp\0"
+    "edu.fm\0"
+    "pu.it\0"
+    "lovepop.jp\0"
+    "co.bi\0"
+    "7.bg\0"
+    "press.ma\0"
+    "tatsuno.nagano.jp\0"
+    "pagefrontapp.com\0"
+    "togitsu.nagasaki.jp\0"
+    "eu.meteorapp.com\0"
+    "farmers\0"
+    "adult\0"
+    "kudoyama.wakayama.jp\0"
+    "鹿児島.jp\0"
+    "daa.jp\0"
+    "rec.ro\0"
+    "quangtri.vn\0"
+    "semboku.akita.jp\0"
+    "air-traffic-control.aero\0"
+    "pl\0"
+    "comsec\0"
+    "nexus\0"
+    "kamijima.ehime.jp\0"
+    "idv.hk\0"
+    "nøtterøy.no\0"
+    "kodaira.tokyo.jp\0"
+    "aivencloud.com\0"
+    "twmail.net\0"
+    "seirou.niigata.jp\0"
+    "dray-dns.de\0"
+    "组織.hk\0"
+    "staba.jp\0"
+    "homedns.org\0"
+    "lerdal.no\0"
+    "hb.cldmail.ru\0"
+    "gb\0"
+    "angiang.vn\0"
+    "nokia\0"
+    "blockbuster\0"
+    "onred.one\0"
+    "jele.host\0"
+    "gliwice.pl\0"
+    "pesarourbino.it\0"
+    "k12.tx.us\0"
+    "kujukuri.chiba.jp\0"
+    "org.gg\0"
+    "nerima.tokyo.jp\0"
+    "akagi.shimane.jp\0"
+    "sakaiminato.tottori.jp\0"
+    "name.mk\0"
+    "skánit.no\0"
+    "myftp.org\0"
+    "ca-central-1.elasticbeanstalk.com\0"
+    "ong.br\0"
+    "is.gov.pl\0"
+    "inderøy.no\0"
+    "edu.lr\0"
+    "tab\0"
+    "wsa.gov.pl\0"
+    "tokuyama.yamaguchi.jp\0"
+    "webview-assets.cloud9.ap-northeast-2.amazonaws.com\0"
+    "shiftcrypto.dev\0"
+    "holtalen.no\0"
+    "gov.to\0"
+    "endoftheinternet.org\0"
+    "blogspot.hu\0"
+    "kayabe.hokkaido.jp\0"
+    "from-mi.com\0"
+    "namikata.ehime.jp\0"
+    "me.vu\0"
+    "us-east-2.elasticbeanstalk.com\0"
+    "gov.sx\0"
+    "quangninh.vn\0"
+    "*.stg-builder.code.com\0"
+    "shopitsite.com\0"
+    "com.pa\0"
+    "yamagata.gifu.jp\0"
+    "no-ip.ca\0"
+    "mil.gt\0"
+    "bss.design\0"
+    "plc.uk\0"
+    "*.digitaloceanspaces.com\0"
+    "ac.mu\0"
+    "higashikagawa.kagawa.jp\0"
+    "ac.tj\0"
+    "sas\0"
+    "florø.no\0"
+    "sund.no\0"
+    "ee\0"
+    "ac.pa\0"
+    "mil.pe\0"
+    "yabuki.fukushima.jp\0"
+    "bo.telemark.no\0"
+    "edu.ba\0"
+    "gov.vn\0"
+    "yuza.yamagata.jp\0"
+    "map.fastly.net\0"
+    "nodes.k8s.fr-par.scw.cloud\0"
+    "from-me.org\0"
+    "takanezawa.tochigi.jp\0"
+    "chuo.chiba.jp\0"
+    "pro.vn\0"
+    "annaka.gunma.jp\0"
+    "niki.hokkaido.jp\0"
+    "de.md\0"
+    "wroc.pl\0"
+    "cc.ms.us\0"
+    "mil.zm\0"
+    "mock.pstmn.io\0"
+    "so.it\0"
+    "owariasahi.aichi.jp\0"
+    "pe.gov.br\0"
+    "from-tx.com\0"
+    "toys\0"
+    "ravendb.run\0"
+    "wixsite.com\0"
+    "hara.nagano.jp\0"
+    "bayern\0"
+    "bizen.okayama.jp\0"
+    "tourism.bj\0"
+    "misasa.tottori.jp\0"
+    "fox\0"
+    "mobile\0"
+    "*.cloud.metacentrum.cz\0"
+    "pro.cy\0"
+    "it\0"
+    "sellsyourhome.org\0"
+    "biz.tj\0"
+    "cc.va.us\0"
+    "safe\0"
+    "maintenance.aero\0"
+    "cyou\0"
+    "fetsund.no\0"
+    "sunagawa.hokkaido.jp\0"
+    "perso.ht\0"
+    "troandin.no\0"
+    "kuron.jp\0"
+    "narita.chiba.jp\0"
+    "gov.sd\0"
+    "melbourne\0"
+    "sld.pa\0"
+    "ichikawa.chiba.jp\0"
+    "schulplattform.de\0"
+    "tsugaru.aomori.jp\0"
+    "vallée-aoste.it\0"
+    "bibai.hokkaido.jp\0"
+    "goiania.br\0"
+    "az.us\0"
+    "narviika.no\0"
+    "bjarkøy.no\0"
+    "win\0"
+    "express.aero\0"
+    "uk.kg\0"
+    "attorney\0"
+    "k12.nv.us\0"
+    "health.vn\0"
+    "saito.miyazaki.jp\0"
+    "av.tr\0"
+    "land-4-sale.us\0"
+    "net.tn\0"
+    "za.net\0"
+    "mup.gov.pl\0"
+    "go.dyndns.org\0"
+    "staging.onred.one\0"
+    "rhcloud.com\0"
+    "gentapps.com\0"
+    "tsukiyono.gunma.jp\0"
+    "r.bg\0"
+    "higashichichibu.saitama.jp\0"
+    "ikeda.hokkaido.jp\0"
+    "nra\0"
+    "gov.ml\0"
+    "translate.goog\0"
+    "mjondalen.no\0"
+    "sh.cn\0"
+    "edu.br\0"
+    "hitachi.ibaraki.jp\0"
+    "pulawy.pl\0"
+    "surgery\0"
+    "edu.gp\0"
+    "software.aero\0"
+    "vagsoy.no\0"
+    "app.lmpm.com\0"
+    "ibaraki.jp\0"
+    "lib.ee\0"
+    "agro.bo\0"
+    "net.is\0"
+    "kurashiki.okayama.jp\0"
+    "net.ma\0"
+    "si.eu.org\0"
+    "nom.pe\0"
+    "kautokeino.no\0"
+    "mq\0"
+    "net.rw\0"
+    "name.az\0"
+    "izumo.shimane.jp\0"
+    "in-vpn.de\0"
+    "finnoy.no\0"
+    "myspreadshop.no\0"
+    "al.gov.br\0"
+    "sanagochi.tokushima.jp\0"
+    "blogdns.net\0"
+    "misato.miyagi.jp\0"
+    "co.st\0"
+    "from-va.com\0"
+    "kw\0"
+    "pr\0"
+    "org.mt\0"
+    "kusatsu.shiga.jp\0"
+    "gangaviika.no\0"
+    "from-hi.com\0"
+    "com.lv\0"
+    "phuyen.vn\0"
+    "net.fm\0"
+    "kvitsøy.no\0"
+    "mosjoen.no\0"
+    "guide\0"
+    "dnsfor.me\0"
+    "oz.au\0"
+    "sa.gov.au\0"
+    "appspacehosted.com\0"
+    "kosei.shiga.jp\0"
+    "*.lclstage.dev\0"
+    "aircraft.aero\0"
+    "kvæfjord.no\0"
+    "*.elb.amazonaws.com\0"
+    "xx.gl\0"
+    "shiraoka.saitama.jp\0"
+    "blogspot.co.za\0"
+    "vpnplus.to\0"
+    "com.iq\0"
+    "enterprisecloud.nu\0"
+    "gov.ma\0"
+    "yoshinogari.saga.jp\0"
+    "*.bzz.dapps.earth\0"
+    "dentist\0"
+    "dr.na\0"
+    "lpl\0"
+    "ایران.ir\0"
+    "ca.na\0"
+    "zaporizhzhia.ua\0"
+    "perspecta.cloud\0"
+    "ac.za\0"
+    "åsnes.no\0"
+    "demo.jelastic.com\0"
+    "go.jp\0"
+    "com.la\0"
+    "gov.cl\0"
+    "tomobe.ibaraki.jp\0"
+    "repair\0"
+    "ishinomaki.miyagi.jp\0"
+    "lundbeck\0"
+    "ac.pr\0"
+    "analytics\0"
+    "caracal.mythic-beasts.com\0"
+    "k12.gu.us\0"
+    "bulsan-suedtirol.it\0"
+    "geometre-expert.fr\0"
+    "ogori.fukuoka.jp\0"
+    "flt.cloud.muni.cz\0"
+    "paas.hosted-by-previder.com\0"
+    "wuoz.gov.pl\0"
+    "com.mt\0"
+    "bloxcms.com\0"
+    "gov.eg\0"
+    "ravpage.co.il\0"
+    "privatelink.snowflake.app\0"
+    "shimoichi.nara.jp\0"
+    "rec.ve\0"
+    "com.gh\0"
+    "skodje.no\0"
+    "biz.my\0"
+    "vega.no\0"
+    "id.ir\0"
+    "dupont\0"
+    "gov.dm\0"
+    "ly\0"
+    "lib.gu.us\0"
+    "lib.ma.us\0"
+    "mosjøen.no\0"
+    "dattoweb.com\0"
+    "pdns.page\0"
+    "council.aero\0"
+    "med.om\0"
+    "lugs.org.uk\0"
+    "kanzaki.saga.jp\0"
+    "agro.pl\0"
+    "afl\0"
+    "k12.mt.us\0"
+    "kilatiron.com\0"
+    "engine.aero\0"
+    "sasebo.nagasaki.jp\0"
+    "ras.ru\0"
+    "みんな\0"
+    "yabu.hyogo.jp\0"
+    "edu.za\0"
+    "arts.ve\0"
+    "крым.рус\0"
+    "freeboxos.com\0"
+    "pstmn.io\0"
+    "ap.it\0"
+    "zhytomyr.ua\0"
+    "ac.ke\0"
+    "myspreadshop.be\0"
+    "co.at\0"
+    "ath.cx\0"
+    "homeftp.net\0"
+    "com.ms\0"
+    "kashima.saga.jp\0"
+    "talk\0"
+    "ns.ca\0"
+    "lierne.no\0"
+    "fuossko.no\0"
+    "direct.quickconnect.cn\0"
+    "ulsan.kr\0"
+    "vodka\0"
+    "rdy.jp\0"
+    "gov.ws\0"
+    "com.et\0"
+    "obama.fukui.jp\0"
+    "ass.km\0"
+    "reggioemilia.it\0"
+    "tips\0"
+    "yandexcloud.net\0"
+    "fræna.no\0"
+    "hn\0"
+    "kumamoto.kumamoto.jp\0"
+    "malopolska.pl\0"
+    "sado.niigata.jp\0"
+    "deno-staging.dev\0"
+    "ngo.lk\0"
+    "pa.gov.pl\0"
+    "gov.ae\0"
+    "berg.no\0"
+    "gov.kp\0"
+    "ro.im\0"
+    "skjåk.no\0"
+    "evje-og-hornnes.no\0"
+    "sport.hu\0"
+    "ericsson\0"
+    "flight.aero\0"
+    "hamar.no\0"
+    "app.os.fedoraproject.org\0"
+    "obira.hokkaido.jp\0"
+    "co.tj\0"
+    "n4t.co\0"
+    "clinic\0"
+    "univ.bj\0"
+    "loginline.site\0"
+    "rep.br\0"
+    "pub.instances.scw.cloud\0"
+    "milan.it\0"
+    "java\0"
+    "wake.okayama.jp\0"
+    "gov.cm\0"
+    "engineering\0"
+    "dagestan.su\0"
+    "is-very-good.org\0"
+    "info.fj\0"
+    "moriguchi.osaka.jp\0"
+    "motosu.gifu.jp\0"
+    "qoto.io\0"
+    "army\0"
+    "chijiwa.nagasaki.jp\0"
+    "melhus.no\0"
+    "prime\0"
+    "writesthisblog.com\0"
+    "ci\0"
+    "myspreadshop.net\0"
+    "oxa.cloud\0"
+    "ba.it\0"
+    "asnes.no\0"
+    "net.mz\0"
+    "kosher\0"
+    "wakayama.wakayama.jp\0"
+    "mitaka.tokyo.jp\0"
+    "hokuryu.hokkaido.jp\0"
+    "nsw.edu.au\0"
+    "org.sh\0"
+    "promo\0"
+    "caa.aero\0"
+    "aogaki.hyogo.jp\0"
+    "træna.no\0"
+    "pymnt.uk\0"
+    "activetrail.biz\0"
+    "schools.nsw.edu.au\0"
+    "hm\0"
+    "za.com\0"
+    "com.cm\0"
+    "gálsá.no\0"
+    "bulsan-sudtirol.it\0"
+    "dgca.aero\0"
+    "kolobrzeg.pl\0"
+    "nanbu.yamanashi.jp\0"
+    "fc.it\0"
+    "to.it\0"
+    "hamura.tokyo.jp\0"
+    "co.ma\0"
+    "箇人.hk\0"
+    "crd.co\0"
+    "lima-city.rocks\0"
+    "gouv.ht\0"
+    "lavagis.no\0"
+    "våler.østfold.no\0"
+    "sakae.nagano.jp\0"
+    "showtime\0"
+    "mil.mg\0"
+    "org.gr\0"
+    "bájddar.no\0"
+    "fuefuki.yamanashi.jp\0"
+    "leirfjord.no\0"
+    "support\0"
+    "kamikawa.hokkaido.jp\0"
+    "piemonte.it\0"
+    "coop.km\0"
+    "rm.it\0"
+    "pro.om\0"
+    "myjino.ru\0"
+    "sumy.ua\0"
+    "kuchinotsu.nagasaki.jp\0"
+    "info.ki\0"
+    "stord.no\0"
+    "blogspot.is\0"
+    "barueri.br\0"
+    "tromsø.no\0"
+    "is-a-llama.com\0"
+    "wf\0"
+    "co.bw\0"
+    "nl.ci\0"
+    "url.tw\0"
+    "新闻\0"
+    "edu.tt\0"
+    "arte\0"
+    "dnsdojo.net\0"
+    "rn.it\0"
+    "mond.jp\0"
+    "org.kw\0"
+    "scholarships\0"
+    "career\0"
+    "pointto.us\0"
+    "org.vu\0"
+    "manno.kagawa.jp\0"
+    "her.jp\0"
+    "edu.tm\0"
+    "ni\0"
+    "cc.oh.us\0"
+    "homegoods\0"
+    "one\0"
+    "netflix\0"
+    "es.ax\0"
+    "risør.no\0"
+    "camau.vn\0"
+    "karmøy.no\0"
+    "kochi.jp\0"
+    "viking\0"
+    "sejny.pl\0"
+    "gujo.gifu.jp\0"
+    "do\0"
+    "amscompute.com\0"
+    "shimotsuke.tochigi.jp\0"
+    "honai.ehime.jp\0"
+    "com.bh\0"
+    "yun\0"
+    "edu.pf\0"
+    "ಭಾರತ\0"
+    "akita.jp\0"
+    "west1-us.cloudjiffy.net\0"
+    "democrat\0"
+    "gd\0"
+    "idf.il\0"
+    "org.ve\0"
+    "troitsk.su\0"
+    "lighting\0"
+    "kumejima.okinawa.jp\0"
+    "dnsupdate.info\0"
+    "fvg.it\0"
+    "com.gi\0"
+    "lima-city.ch\0"
+    "gov.gh\0"
+    "gay\0"
+    "mil.ye\0"
+    "own.pm\0"
+    "edu.my\0"
+    "yachiyo.chiba.jp\0"
+    "net.vi\0"
+    "il.eu.org\0"
+    "noor.jp\0"
+    "fem.jp\0"
+    "fashion\0"
+    "toyota.yamaguchi.jp\0"
+    "hanggliding.aero\0"
+    "emergency.aero\0"
+    "mx\0"
+    "dk.eu.org\0"
+    "cc.ny.us\0"
+    "bsb.br\0"
+    "lib.wy.us\0"
+    "furniture\0"
+    "dontexist.com\0"
+    "org.me\0"
+    "s3-eu-central-1.amazonaws.com\0"
+    "gouv.sn\0"
+    "from-id.com\0"
+    "c.cdn77.org\0"
+    "anan.tokushima.jp\0"
+    "osoyro.no\0"
+    "teshikaga.hokkaido.jp\0"
+    "industries\0"
+    "tsuwano.shimane.jp\0"
+    "shiiba.miyazaki.jp\0"
+    "mypsx.net\0"
+    "vic.au\0"
+    "co.zw\0"
+    "webview-assets.aws-cloud9.us-east-2.amazonaws.com\0"
+    "sandoy.no\0"
+    "ragusa.it\0"
+    "moareke.no\0"
+    "katsushika.tokyo.jp\0"
+    "net.bz\0"
+    "olkusz.pl\0"
+    "veterinaire.fr\0"
+    "namegawa.saitama.jp\0"
+    "nakagyo.kyoto.jp\0"
+    "caxias.br\0"
+    "vb.it\0"
+    "kushiro.hokkaido.jp\0"
+    "czest.pl\0"
+    "barsy.site\0"
+    "trysil.no\0"
+    "māori.nz\0"
+    "beats\0"
+    "*.awdev.ca\0"
+    "mimoza.jp\0"
+    "uwajima.ehime.jp\0"
+    "gs.ah.no\0"
+    "stcgroup\0"
+    "cnt.br\0"
+    "kitahiroshima.hokkaido.jp\0"
+    "matsuyama.ehime.jp\0"
+    "lardal.no\0"
+    "tado.mie.jp\0"
+    "investments\0"
+    "friuli-vegiulia.it\0"
+    "eu.pythonanywhere.com\0"
+    "pages.it.hs-heilbronn.de\0"
+    "be.ax\0"
+    "vr.it\0"
+    "kuriyama.hokkaido.jp\0"
+    "taki.mie.jp\0"
+    "mishima.fukushima.jp\0"
+    "post.in\0"
+    "katsuragi.nara.jp\0"
+    "s3.fr-par.scw.cloud\0"
+    "aktyubinsk.su\0"
+    "valléeaoste.it\0"
+    "agr.br\0"
+    "tamaki.mie.jp\0"
+    "org.lk\0"
+    "seika.kyoto.jp\0"
+    "bajddar.no\0"
+    "삼성\0"
+    "游戏\0"
+    "int.bo\0"
+    "otobe.hokkaido.jp\0"
+    "platterp.us\0"
+    "maison\0"
+    "dj\0"
+    "prod\0"
+    "ote.bj\0"
+    "taketomi.okinawa.jp\0"
+    "asso.mc\0"
+    "appchizi.com\0"
+    "dance\0"
+    "film\0"
+    "gov.gu\0"
+    "valdaosta.it\0"
+    "gq\0"
+    "homelink.one\0"
+    "bm\0"
+    "yurihonjo.akita.jp\0"
+    "wme\0"
+    "nt.ro\0"
+    "dedibox.fr\0"
+    "tokke.no\0"
+    "dagestan.ru\0"
+    "ms.gov.br\0"
+    "net.ua\0"
+    "*.kh\0"
+    "minamiboso.chiba.jp\0"
+    "alsace\0"
+    "oamishirasato.chiba.jp\0"
+    "aomori.aomori.jp\0"
+    "selje.no\0"
+    "ne.tz\0"
+    "kawaiishop.jp\0"
+    "res.in\0"
+    "co.pn\0"
+    "dsmynas.com\0"
+    "ac.me\0"
+    "satsumasendai.kagoshima.jp\0"
+    "exnet.su\0"
+    "social\0"
+    "pl.eu.org\0"
+    "scot\0"
+    "tagajo.miyagi.jp\0"
+    "kiyosato.hokkaido.jp\0"
+    "miyazaki.miyazaki.jp\0"
+    "nichinan.tottori.jp\0"
+    "mishima.shizuoka.jp\0"
+    "myamaze.net\0"
+    "africa\0"
+    "americanfamily\0"
+    "jellybean.jp\0"
+    "mi.th\0"
+    "yodobashi\0"
+    "gov.sc\0"
+    "komono.mie.jp\0"
+    "كوم\0"
+    "nyc\0"
+    "komatsu.ishikawa.jp\0"
+    "chintai\0"
+    "mediocampidano.it\0"
+    "hirokawa.fukuoka.jp\0"
+    "yoro.gifu.jp\0"
+    "sandøy.no\0"
+    "zakopane.pl\0"
+    "rar.ve\0"
+    "my-vigor.de\0"
+    "kagoshima.jp\0"
+    "poznan.pl\0"
+    "forgeblocks.com\0"
+    "mi.it\0"
+    "med.sa\0"
+    "aogashima.tokyo.jp\0"
+    "*.kawasaki.jp\0"
+    "hino.tottori.jp\0"
+    "ar.us\0"
+    "storebase.store\0"
+    "loginto.me\0"
+    "video\0"
+    "is-a-lawyer.com\0"
+    "hatogaya.saitama.jp\0"
+    "band\0"
+    "vm.bytemark.co.uk\0"
+    "kpmg\0"
+    "chat\0"
+    "cc.ma.us\0"
+    "hotel.hu\0"
+    "higashiyamato.tokyo.jp\0"
+    "cc.az.us\0"
+    "elverum.no\0"
+    "co.id\0"
+    "lanbib.se\0"
+    "is-found.org\0"
+    "pila.pl\0"
+    "mil.mz\0"
+    "bmd.br\0"
+    "watarai.mie.jp\0"
+    "k.se\0"
+    "sannohe.aomori.jp\0"
+    "tm.mg\0"
+    "sling\0"
+    "jolster.no\0"
+    "llp\0"
+    "akamaihd-staging.net\0"
+    "azure-mobile.net\0"
+    "elementor.cool\0"
+    "topaz.ne.jp\0"
+    "edu.mz\0"
+    "blogspot.de\0"
+    "sex.pl\0"
+    "konin.pl\0"
+    "net.lr\0"
+    "caobang.vn\0"
+    "alvdal.no\0"
+    "nrw\0"
+    "trentinos-tirol.it\0"
+    "org.ms\0"
+    "kawanabe.kagoshima.jp\0"
+    "edu.ly\0"
+    "nm.us\0"
+    "edu.qa\0"
+    "flog.br\0"
+    "as.us\0"
+    "cesenaforlì.it\0"
+    "insurance\0"
+    "nf.ca\0"
+    "muosát.no\0"
+    "run.app\0"
+    "myspreadshop.com\0"
+    "ohira.tochigi.jp\0"
+    "mobi.ke\0"
+    "bo\0"
+    "ggee\0"
+    "com.mx\0"
+    "trentin-südtirol.it\0"
+    "be.gy\0"
+    "gov.ye\0"
+    "tromsa.no\0"
+    "museum.tt\0"
+    "info.nf\0"
+    "ibestad.no\0"
+    "higashinaruse.akita.jp\0"
+    "giving\0"
+    "smola.no\0"
+    "orkanger.no\0"
+    "nara.nara.jp\0"
+    "namaste.jp\0"
+    "ureshino.mie.jp\0"
+    "tm.ro\0"
+    "ami.ibaraki.jp\0"
+    "brussels\0"
+    "ia.us\0"
+    "maceio.br\0"
+    "koryo.nara.jp\0"
+    "flekkefjord.no\0"
+    "lib.oh.us\0"
+    "toshiba\0"
+    "monash\0"
+    "بھارت\0"
+    "yamaguchi.jp\0"
+    "rg.it\0"
+    "*.owo.codes\0"
+    "scb\0"
+    "shibuya.tokyo.jp\0"
+    "contagem.br\0"
+    "servebbs.com\0"
+    "vt.it\0"
+    "joburg\0"
+    "miyako.fukuoka.jp\0"
+    "hitachinaka.ibaraki.jp\0"
+    "murata.miyagi.jp\0"
+    "toyosato.shiga.jp\0"
+    "srl\0"
+    "discordsez.com\0"
+    "cr.ua\0"
+    "iwakura.aichi.jp\0"
+    "id.ly\0"
+    "grue.no\0"
+    "co.pl\0"
+    "um.gov.pl\0"
+    "katagami.akita.jp\0"
+    "sigdal.no\0"
+    "nakagusuku.okinawa.jp\0"
+    "cyon.link\0"
+    "booking\0"
+    "williamhill\0"
+    "dad\0"
+    "s3-ca-central-1.amazonaws.com\0"
+    "hippy.jp\0"
+    "verdal.no\0"
+    "sukagawa.fukushima.jp\0"
+    "holdings\0"
+    "bozen-südtirol.it\0"
+    "sa.edu.au\0"
+    "wanggou\0"
+    "dev.static.land\0"
+    "网店\0"
+    "gov.vc\0"
+    "net.py\0"
+    "storfjord.no\0"
+    "snoasa.no\0"
+    "s3-website-ap-northeast-1.amazonaws.com\0"
+    "nes.akershus.no\0"
+    "cal.it\0"
+    "golf\0"
+    "v-info.info\0"
+    "بازار\0"
+    "takatori.nara.jp\0"
+    "mg.leg.br\0"
+    "kunitomi.miyazaki.jp\0"
+    "autocode.dev\0"
+    "frosinone.it\0"
+    "blogspot.bg\0"
+    "pr.leg.br\0"
+    "oyama.tochigi.jp\0"
+    "oirm.gov.pl\0"
+    "net.ml\0"
+    "nogi.tochigi.jp\0"
+    "kinghost.net\0"
+    "or.pw\0"
+    "us-west-1.elasticbeanstalk.com\0"
+    "cl.it\0"
+    "aisho.shiga.jp\0"
+    "design\0"
+    "monza-e-della-brianza.it\0"
+    "*.statics.cloud\0"
+    "komae.tokyo.jp\0"
+    "pupu.jp\0"
+    "asso.eu.org\0"
+    "umaji.kochi.jp\0"
+    "lebtimnetz.de\0"
+    "musician.io\0"
+    "osterøy.no\0"
+    "рус\0"
+    "id.forgerock.io\0"
+    "parasite.jp\0"
+    "gamvik.no\0"
+    "fj\0"
+    "*.on-rio.io\0"
+    "spb.su\0"
+    "org.cn\0"
+    "broker\0"
+    "edu.ua\0"
+    "qcx.io\0"
+    "itau\0"
+    "azimuth.network\0"
+    "customer.speedpartner.de\0"
+    "vegårshei.no\0"
+    "gov.ua\0"
+    "snillfjord.no\0"
+    "systems\0"
+    "honbetsu.hokkaido.jp\0"
+    "vet\0"
+    "group\0"
+    "edu.lb\0"
+    "babia-gora.pl\0"
+    "osaka\0"
+    "samegawa.fukushima.jp\0"
+    "securitytactics.com\0"
+    "aoste.it\0"
+    "tomari.hokkaido.jp\0"
+    "podzone.org\0"
+    "familyds.com\0"
+    "yokosuka.kanagawa.jp\0"
+    "makinohara.shizuoka.jp\0"
+    "anjo.aichi.jp\0"
+    "tv\0"
+    "co.na\0"
+    "minamioguni.kumamoto.jp\0"
+    "mail.pl\0"
+    "vote\0"
+    "政务\0"
+    "biella.it\0"
+    "sr.it\0"
+    "jeep\0"
+    "tysvar.no\0"
+    "zj.cn\0"
+    "cy\0"
+    "simplesite.pl\0"
+    "edu.so\0"
+    "gov.tn\0"
+    "pc.pl\0"
+    "profesional.bo\0"
+    "tienda\0"
+    "yawata.kyoto.jp\0"
+    "ama.shimane.jp\0"
+    "olawa.pl\0"
+    "es-1.axarnet.cloud\0"
+    "pro.br\0"
+    "c66.me\0"
+    "trainer.aero\0"
+    "imari.saga.jp\0"
+    "wmflabs.org\0"
+    "utsira.no\0"
+    "warmia.pl\0"
+    "democracia.bo\0"
+    "saigawa.fukuoka.jp\0"
+    "quebec\0"
+    "technology\0"
+    "shiraoi.hokkaido.jp\0"
+    "lpages.co\0"
+    "org.nz\0"
+    "exchange.aero\0"
+    "com.ht\0"
+    "qbuser.com\0"
+    "llc\0"
+    "viva\0"
+    "gi\0"
+    "*.user.localcert.dev\0"
+    "us-4.evennode.com\0"
+    "net.ls\0"
+    "furudono.fukushima.jp\0"
+    "theworkpc.com\0"
+    "s3.us-east-2.amazonaws.com\0"
+    "富山.jp\0"
+    "sakawa.kochi.jp\0"
+    "edugit.io\0"
+    "tateyama.chiba.jp\0"
+    "ra.it\0"
+    "jx.cn\0"
+    "total\0"
+    "trade\0"
+    "kahoku.ishikawa.jp\0"
+    "com.lc\0"
+    "shopselect.net\0"
+    "hirara.okinawa.jp\0"
+    "au.ngrok.io\0"
+    "nankoku.kochi.jp\0"
+    "filegear-ie.me\0"
+    "takayama.gunma.jp\0"
+    "9.bg\0"
+    "個人.香港\0"
+    "kalmykia.ru\0"
+    "ozora.hokkaido.jp\0"
+    "blogspot.in\0"
+    "*.uberspace.de\0"
+    "bo.it\0"
+    "okinoshima.shimane.jp\0"
+    "instance.datadetect.com\0"
+    "*.customer-oci.com\0"
+    "ae.org\0"
+    "bl.it\0"
+    "linkyard.cloud\0"
+    "kirkenes.no\0"
+    "mil.pl\0"
+    "fool.jp\0"
+    "kalisz.pl\0"
+    "lodingen.no\0"
+    "lv\0"
+    "business\0"
+    "s3-website-ap-southeast-2.amazonaws.com\0"
+    "heroy.nordland.no\0"
+    "rich\0"
+    "godaddy\0"
+    "mil.tz\0"
+    "educator.aero\0"
+    "*.on-rancher.cloud\0"
+    "biz.nr\0"
+    "emerck\0"
+    "demo.datadetect.com\0"
+    "dy.fi\0"
+    "kotohira.kagawa.jp\0"
+    "hagebostad.no\0"
+    "il.us\0"
+    "sjc.br\0"
+    "emr.it\0"
+    "vfs.cloud9.us-east-2.amazonaws.com\0"
+    "trentinosüd-tirol.it\0"
+    "brumunddal.no\0"
+    "spot\0"
+    "wzmiuw.gov.pl\0"
+    "assn.lk\0"
+    "se.leg.br\0"
+    "biz.ki\0"
+    "bauhaus\0"
+    "folkebibl.no\0"
+    "k12.vi\0"
+    "owani.aomori.jp\0"
+    "gáŋgaviika.no\0"
+    "karmoy.no\0"
+    "kazuno.akita.jp\0"
+    "nc.us\0"
+    "teva\0"
+    "kyotamba.kyoto.jp\0"
+    "ap.leg.br\0"
+    "tsubetsu.hokkaido.jp\0"
+    "org.ls\0"
+    "college\0"
+    "biz.vn\0"
+    "port.fr\0"
+    "rikubetsu.hokkaido.jp\0"
+    "vi.us\0"
+    "kitagawa.kochi.jp\0"
+    "members.linode.com\0"
+    "barrell-of-knowledge.info\0"
+    "co.am\0"
+    "imdb\0"
+    "pk\0"
+    "massa-carrara.it\0"
+    "shobara.hiroshima.jp\0"
+    "gov.kn\0"
+    "hachijo.tokyo.jp\0"
+    "ca.in\0"
+    "gov.ly\0"
+    "gov.cn\0"
+    "lødingen.no\0"
+    "selfip.info\0"
+    "munakata.fukuoka.jp\0"
+    "watari.miyagi.jp\0"
+    "adygeya.ru\0"
+    "to.md\0"
+    "museum.mv\0"
+    "shinonsen.hyogo.jp\0"
+    "barsy.ca\0"
+    "cahcesuolo.no\0"
+    "taiki.mie.jp\0"
+    "s3.cn-north-1.amazonaws.com.cn\0"
+    "ua\0"
+    "johana.toyama.jp\0"
+    "nissedal.no\0"
+    "hadsel.no\0"
+    "from-wi.com\0"
+    "home.dyndns.org\0"
+    "hamada.shimane.jp\0"
+    "blogspot.re\0"
+    "szex.hu\0"
+    "co.place\0"
+    "世界\0"
+    "ham-radio-op.net\0"
+    "mizuho.tokyo.jp\0"
+    "it1.eur.aruba.jenv-aruba.cloud\0"
+    "aostavalley.it\0"
+    "net.ag\0"
+    "amex\0"
+    "ashoro.hokkaido.jp\0"
+    "nasu.tochigi.jp\0"
+    "coop.br\0"
+    "tm\0"
+    "development.run\0"
+    "minowa.nagano.jp\0"
+    "tv.tr\0"
+    "blogspot.pt\0"
+    "izena.okinawa.jp\0"
+    "barlettatraniandria.it\0"
+    "co.hu\0"
+    "realtor\0"
+    "kropyvnytskyi.ua\0"
+    "ca.eu.org\0"
+    "kijo.miyazaki.jp\0"
+    "clickrising.net\0"
+    "kyoto.jp\0"
+    "edu.mg\0"
+    "askvoll.no\0"
+    "ไทย\0"
+    "blogspot.hk\0"
+    "applinzi.com\0"
+    "web.ni\0"
+    "mielno.pl\0"
+    "accesscam.org\0"
+    "ne.jp\0"
+    "akamaized-staging.net\0"
+    "os.hedmark.no\0"
+    "ivory.ne.jp\0"
+    "la.us\0"
+    "balashov.su\0"
+    "seg.br\0"
+    "edu.me\0"
+    "esashi.hokkaido.jp\0"
+    "homeunix.com\0"
+    "упр.срб\0"
+    "namdinh.vn\0"
+    "avoues.fr\0"
+    "narvik.no\0"
+    "minato.tokyo.jp\0"
+    "gov.bs\0"
+    "is-a-rockstar.com\0"
+    "blogspot.it\0"
+    "fet.no\0"
+    "im\0"
+    "cc.ok.us\0"
+    "shimokawa.hokkaido.jp\0"
+    "hepforge.org\0"
+    "cologne\0"
+    "kppsp.gov.pl\0"
+    "readymade.jp\0"
+    "blogspot.sk\0"
+    "conference.aero\0"
+    "nååmesjevuemie.no\0"
+    "radio.br\0"
+    "valleaosta.it\0"
+    "airkitapps.com\0"
+    "kaas.gg\0"
+    "barsy.support\0"
+    "black\0"
+    "org.ly\0"
+    "sande.møre-og-romsdal.no\0"
+    "hk.org\0"
+    "mil.bo\0"
+    "hu.eu.org\0"
+    "kia\0"
+    "*.developer.app\0"
+    "cam\0"
+    "trentin-sudtirol.it\0"
+    "石川.jp\0"
+    "go.it\0"
+    "salvador.br\0"
+    "hidaka.saitama.jp\0"
+    "lund.no\0"
+    "notaires.fr\0"
+    "int.ni\0"
+    "sue.fukuoka.jp\0"
+    "kawanishi.yamagata.jp\0"
+    "oita.jp\0"
+    "des.br\0"
+    "yazu.tottori.jp\0"
+    "statebank\0"
+    "bievát.no\0"
+    "eu.encoway.cloud\0"
+    "consulado.st\0"
+    "official.academy\0"
+    "ikano\0"
+    "ac.leg.br\0"
+    "org.vn\0"
+    "mil.ve\0"
+    "lgbt\0"
+    "goto.nagasaki.jp\0"
+    "pn\0"
+    "nv.us\0"
+    "stc\0"
+    "laquila.it\0"
+    "pantheonsite.io\0"
+    "dynu.net\0"
+    "smile\0"
+    "vgs.no\0"
+    "blogspot.md\0"
+    "mods.jp\0"
+    "ke\0"
+    "trentinosuedtirol.it\0"
+    "vi\0"
+    "org.bs\0"
+    "itoigawa.niigata.jp\0"
+    "takayama.nagano.jp\0"
+    "mil.iq\0"
+    "firewalledreplit.co\0"
+    "jl.cn\0"
+    "jed.wafaicloud.com\0"
+    "nobushi.jp\0"
+    "org.ci\0"
+    "anani.br\0"
+    "bialystok.pl\0"
+    "name.ng\0"
+    "net.hn\0"
+    "cn-northwest-1.eb.amazonaws.com.cn\0"
+    "r2.dev\0"
+    "name.qa\0"
+    "blogspot.com.tr\0"
+    "fm.no\0"
+    "oystre-slidre.no\0"
+    "myspreadshop.se\0"
+    "pages.dev\0"
+    "blogspot.com.br\0"
+    "creditunion\0"
+    "badaddja.no\0"
+    "gub.uy\0"
+    "puglia.it\0"
+    "seat\0"
+    "naruto.tokushima.jp\0"
+    "*.compute.amazonaws.com.cn\0"
+    "k12.ms.us\0"
+    "genoa.it\0"
+    "alpha-myqnapcloud.com\0"
+    "net.ps\0"
+    "enscaled.sg\0"
+    "tv.bo\0"
+    "toyokawa.aichi.jp\0"
+    "olsztyn.pl\0"
+    "edu.ph\0"
+    "reserve-online.com\0"
+    "ind.tn\0"
+    "hk\0"
+    "pioneer\0"
+    "edu.mk\0"
+    "net.gu\0"
+    "山口.jp\0"
+    "hatsukaichi.hiroshima.jp\0"
+    "no.eu.org\0"
+    "io.in\0"
+    "ritto.shiga.jp\0"
+    "date.hokkaido.jp\0"
+    "from-ga.com\0"
+    "茨城.jp\0"
+    "bar\0"
+    "ap.gov.br\0"
+    "granvin.no\0"
+    "vivian.jp\0"
+    "kyiv.ua\0"
+    "campidano-medio.it\0"
+    "is-a-socialist.com\0"
+    "gov.az\0"
+    "k12.mo.us\0"
+    "nu\0"
+    "موريتانيا\0"
+    "edu.al\0"
+    "bedzin.pl\0"
+    "yawara.ibaraki.jp\0"
+    "norton\0"
+    "fail\0"
+    "herokuapp.com\0"
+    "webview-assets.aws-cloud9.ca-central-1.amazonaws.com\0"
+    "cupcake.is\0"
+    "kyuragi.saga.jp\0"
+    "قطر\0"
+    "123webseite.de\0"
+    "bunkyo.tokyo.jp\0"
+    "pa.us\0"
+    "yamazoe.nara.jp\0"
+    "nakatane.kagoshima.jp\0"
+    "net.lb\0"
+    "adobeio-static.net\0"
+    "niimi.okayama.jp\0"
+    "ono.fukui.jp\0"
+    "k12.pr.us\0"
+    "广东\0"
+    "中国\0"
+    "kids\0"
+    "mysecuritycamera.com\0"
+    "komforb.se\0"
+    "jevnaker.no\0"
+    "isernia.it\0"
+    "web.app\0"
+    "ma.us\0"
+    "blogspot.cf\0"
+    "nakai.kanagawa.jp\0"
+    "thuathienhue.vn\0"
+    "kurotaki.nara.jp\0"
+    "sells-for-u.com\0"
+    "dtv\0"
+    "gov.gy\0"
+    "cloudns.org\0"
+    "群馬.jp\0"
+    "kui.hiroshima.jp\0"
+    "somna.no\0"
+    "edgesuite.net\0"
+    "cloudjiffy.net\0"
+    "bib.ve\0"
+    "mckinsey\0"
+    "quangbinh.vn\0"
+    "net.cu\0"
+    "kyowa.akita.jp\0"
+    "nom.re\0"
+    "oppdal.no\0"
+    "ezproxy.kuleuven.be\0"
+    "k12.mi.us\0"
+    "gov.me\0"
+    "sca\0"
+    "u.bg\0"
+    "lib.me.us\0"
+    "com.cv\0"
+    "unnan.shimane.jp\0"
+    "4u.com\0"
+    "cc.nj.us\0"
+    "yukuhashi.fukuoka.jp\0"
+    "dynserv.org\0"
+    "hu\0"
+    "tjøme.no\0"
+    "島根.jp\0"
+    "ta.it\0"
+    "from-ok.com\0"
+    "select\0"
+    "psi.br\0"
+    "stackhero-network.com\0"
+    "nakaniikawa.toyama.jp\0"
+    "cloudaccess.host\0"
+    "sch.zm\0"
+    "gs.oslo.no\0"
+    "bulsan-südtirol.it\0"
+    "16-b.it\0"
+    "tv.sd\0"
+    "matsumae.hokkaido.jp\0"
+    "ichikawamisato.yamanashi.jp\0"
+    "freebox-os.fr\0"
+    "wi.us\0"
+    "zip\0"
+    "rygge.no\0"
+    "bbc\0"
+    "dynalias.org\0"
+    "wa.edu.au\0"
+    "rdv.to\0"
+    "rennebu.no\0"
+    "saikai.nagasaki.jp\0"
+    "kumamoto.jp\0"
+    "pinb.gov.pl\0"
+    "toyota.aichi.jp\0"
+    "org.ws\0"
+    "akiruno.tokyo.jp\0"
+    "us-east-1.elasticbeanstalk.com\0"
+    "yamagata.nagano.jp\0"
+    "z.bg\0"
+    "insure\0"
+    "is-into-cartoons.com\0"
+    "wkz.gov.pl\0"
+    "nærøy.no\0"
+    "zushi.kanagawa.jp\0"
+    "blogspot.mk\0"
+    "mangyshlak.su\0"
+    "tank.jp\0"
+    "blogspot.com.ar\0"
+    "com.fm\0"
+    "at.it\0"
+    "og.it\0"
+    "net.et\0"
+    "risor.no\0"
+    "info.ke\0"
+    "netbank\0"
+    "edu.gd\0"
+    "nic.in\0"
+    "gov.kg\0"
+    "k8s.fr-par.scw.cloud\0"
+    "myspreadshop.dk\0"
+    "kaizuka.osaka.jp\0"
+    "orsta.no\0"
+    "blogspot.fi\0"
+    "name.tt\0"
+    "s3.pl-waw.scw.cloud\0"
+    "südtirol.it\0"
+    "hammarfeasta.no\0"
+    "fujimi.saitama.jp\0"
+    "edu.ml\0"
+    "cc.de.us\0"
+    "ga\0"
+    "magazine.aero\0"
+    "org.eg\0"
+    "toray\0"
+    "sakurai.nara.jp\0"
+    "mw.gov.pl\0"
+    "charity\0"
+    "torino.it\0"
+    "sydney\0"
+    "name.mv\0"
+    "tanagura.fukushima.jp\0"
+    "org.hn\0"
+    "gausdal.no\0"
+    "observer\0"
+    "mo\0"
+    "net.ly\0"
+    "recipes\0"
+    "nm.cn\0"
+    "gz.cn\0"
+    "obama.nagasaki.jp\0"
+    "tube\0"
+    "fedje.no\0"
+    "am.leg.br\0"
+    "新加坡\0"
+    "elk.pl\0"
+    "mil.id\0"
+    "reliance\0"
+    "org.st\0"
+    "ikeda.osaka.jp\0"
+    "tel.tr\0"
+    "joy\0"
+    "ålgård.no\0"
+    "or.mu\0"
+    "pharmacy\0"
+    "宮崎.jp\0"
+    "us-gov-west-1.elasticbeanstalk.com\0"
+    "coop\0"
+    "ad\0"
+    "dontexist.net\0"
+    "移动\0"
+    "de.cool\0"
+    "no-ip.org\0"
+    "reggiocalabria.it\0"
+    "ueno.gunma.jp\0"
+    "ogasawara.tokyo.jp\0"
+    "yoshikawa.saitama.jp\0"
+    "lyngdal.no\0"
+    "sc\0"
+    "dattorelay.com\0"
+    "*.webpaas.ovh.net\0"
+    "bing\0"
+    "yamato.kanagawa.jp\0"
+    "cf-ipfs.com\0"
+    "在线\0"
+    "latino\0"
+    "vermögensberatung\0"
+    "com.ug\0"
+    "sdn.gov.pl\0"
+    "sa.ngrok.io\0"
+    "愛知.jp\0"
+    "from-nv.com\0"
+    "global.prod.fastly.net\0"
+    "cc.al.us\0"
+    "hakui.ishikawa.jp\0"
+    "fire\0"
+    "knx-server.net\0"
+    "taifun-dns.de\0"
+    "ashgabad.su\0"
+    "trentino-sud-tirol.it\0"
+    "jp.ngrok.io\0"
+    "السعودية\0"
+    "builders\0"
+    "we.tc\0"
+    "com.af\0"
+    "nakano.nagano.jp\0"
+    "loseyourip.com\0"
+    "edu.sb\0"
+    "int.ar\0"
+    "iglesiascarbonia.it\0"
+    "sx.cn\0"
+    "adm.br\0"
+    "香港\0"
+    "carrd.co\0"
+    "tm.hu\0"
+    "d.gv.vc\0"
+    "marketing\0"
+    "dscloud.biz\0"
+    "itami.hyogo.jp\0"
+    "ishikawa.jp\0"
+    "lib.ut.us\0"
+    "omitama.ibaraki.jp\0"
+    "ms.it\0"
+    "com.gt\0"
+    "amakusa.kumamoto.jp\0"
+    "tm.se\0"
+    "jogasz.hu\0"
+    "birkenes.no\0"
+    "politie\0"
+    "sebastopol.ua\0"
+    "yasuda.kochi.jp\0"
+    "食品\0"
+    "*.gateway.dev\0"
+    "укр\0"
+    "store.st\0"
+    "okawa.fukuoka.jp\0"
+    "fujimino.saitama.jp\0"
+    "fukudomi.saga.jp\0"
+    "sampa.br\0"
+    "edu.nr\0"
+    "hidaka.kochi.jp\0"
+    "revista.bo\0"
+    "at.eu.org\0"
+    "岩手.jp\0"
+    "trentinsued-tirol.it\0"
+    "қаз\0"
+    "mobi.tt\0"
+    "cloud-fr1.unispace.io\0"
+    "gov.mz\0"
+    "inashiki.ibaraki.jp\0"
+    "nike\0"
+    "health\0"
+    "work\0"
+    "vipsinaapp.com\0"
+    "novecore.site\0"
+    "midori.chiba.jp\0"
+    "mil.al\0"
+    "balsan.it\0"
+    "lanxess\0"
+    "wiki\0"
+    "vs.mythic-beasts.com\0"
+    "filegear.me\0"
+    "bitbridge.net\0"
+    "okayama.okayama.jp\0"
+    "is-a-green.com\0"
+    "kwpsp.gov.pl\0"
+    "ie.eu.org\0"
+    "iwakuni.yamaguchi.jp\0"
+    "uk.primetel.cloud\0"
+    "gonna.jp\0"
+    "kaneyama.yamagata.jp\0"
+    "urakawa.hokkaido.jp\0"
+    "he.cn\0"
+    "bip.sh\0"
+    "mantova.it\0"
+    "sj\0"
+    "ariake.saga.jp\0"
+    "mongolian.jp\0"
+    "aip.ee\0"
+    "bingo\0"
+    "coupons\0"
+    "dvrdns.org\0"
+    "soeda.fukuoka.jp\0"
+    "oshima.yamaguchi.jp\0"
+    "naturbruksgymn.se\0"
+    "savona.it\0"
+    "uzs.gov.pl\0"
+    "int.ve\0"
+    "git-repos.de\0"
+    "oguni.kumamoto.jp\0"
+    "recife.br\0"
+    "handcrafted.jp\0"
+    "md.us\0"
+    "pro.ec\0"
+    "powiat.pl\0"
+    "emiliaromagna.it\0"
+    "wedding\0"
+    "bet.ar\0"
+    "co.th\0"
+    "nic.za\0"
+    "isshiki.aichi.jp\0"
+    "quicksytes.com\0"
+    "gea\0"
+    "karaganda.su\0"
+    "kikirara.jp\0"
+    "gov.mk\0"
+    "tranoy.no\0"
+    "ide.kyoto.jp\0"
+    "ltd.gi\0"
+    "muosat.no\0"
+    "net.mv\0"
+    "selfip.com\0"
+    "com.zm\0"
+    "ai.vn\0"
+    "lease\0"
+    "valle-aosta.it\0"
+    "häkkinen.fi\0"
+    "gs.aa.no\0"
+    "chtr.k12.ma.us\0"
+    "edu.to\0"
+    "edu.uy\0"
+    "linkyard-cloud.ch\0"
+    "nedre-eiker.no\0"
+    "green\0"
+    "iwanai.hokkaido.jp\0"
+    "gaular.no\0"
+    "ráhkkerávju.no\0"
+    "gr.jp\0"
+    "nj.us\0"
+    "catanzaro.it\0"
+    "edu.dz\0"
+    "is-a-chef.net\0"
+    "otoineppu.hokkaido.jp\0"
+    "org.ye\0"
+    "takko.aomori.jp\0"
+    "mo.cn\0"
+    "gov.tl\0"
+    "gildeskål.no\0"
+    "lat\0"
+    "ac.cn\0"
+    "組織.香港\0"
+    "is-a-geek.net\0"
+    "li\0"
+    "dontexist.org\0"
+    "intl.tn\0"
+    "namsskogan.no\0"
+    "alt.za\0"
+    "perso.tn\0"
+    "namerikawa.toyama.jp\0"
+    "atl.jelastic.vps-host.net\0"
+    "homesklep.pl\0"
+    "translated.page\0"
+    "kushima.miyazaki.jp\0"
+    "yaotsu.gifu.jp\0"
+    "psc.br\0"
+    "政府\0"
+    "frøya.no\0"
+    "gov.tj\0"
+    "السعودیۃ\0"
+    "shizuoka.jp\0"
+    "s3.nl-ams.scw.cloud\0"
+    "honjo.saitama.jp\0"
+    "name.na\0"
+    "my-gateway.de\0"
+    "delta\0"
+    "ora.gunma.jp\0"
+    "sbs\0"
+    "us-2.evennode.com\0"
+    "med.pro\0"
+    "iris.arpa\0"
+    "genting\0"
+    "org.gl\0"
+    "vv.it\0"
+    "trentinsüd-tirol.it\0"
+    "buzz\0"
+    "báhccavuotna.no\0"
+    "*.np\0"
+    "osaki.miyagi.jp\0"
+    "miyoshi.hiroshima.jp\0"
+    "author\0"
+    "tabayama.yamanashi.jp\0"
+    "ichiba.tokushima.jp\0"
+    "*.sch.uk\0"
+    "higashiyama.kyoto.jp\0"
+    "ashikaga.tochigi.jp\0"
+    "alta.no\0"
+    "naganohara.gunma.jp\0"
+    "orx.biz\0"
+    "gitlab.io\0"
+    "sogndal.no\0"
+    "is-a-geek.com\0"
+    "izumozaki.niigata.jp\0"
+    "apple\0"
+    "lelux.site\0"
+    "mil.az\0"
+    "isesaki.gunma.jp\0"
+    "toyonaka.osaka.jp\0"
+    "rehab\0"
+    "vfs.cloud9.eu-north-1.amazonaws.com\0"
+    "camdvr.org\0"
+    "คอม\0"
+    "njs.jelastic.vps-host.net\0"
+    "izumi.kagoshima.jp\0"
+    "from-ak.com\0"
+    "uni5.net\0"
+    "arakawa.saitama.jp\0"
+    "dd-dns.de\0"
+    "vestvagoy.no\0"
+    "mil.ru\0"
+    "hamatonbetsu.hokkaido.jp\0"
+    "narashino.chiba.jp\0"
+    "sakata.yamagata.jp\0"
+    "yoichi.hokkaido.jp\0"
+    "emilia-romagna.it\0"
+    "*.vultrobjects.com\0"
+    "書籍\0"
+    "dopaas.com\0"
+    "com.im\0"
+    "jcloud.kz\0"
+    "dynalias.net\0"
+    "no.it\0"
+    "tiaa\0"
+    "com.ec\0"
+    "izunokuni.shizuoka.jp\0"
+    "from-pr.com\0"
+    "okuma.fukushima.jp\0"
+    "lexus\0"
+    "property\0"
+    "nextdirect\0"
+    "网站\0"
+    "co.education\0"
+    "flier.jp\0"
+    "org.ua\0"
+    "vix.br\0"
+    "k12.co.us\0"
+    "bradesco\0"
+    "naustdal.no\0"
+    "freebox-os.com\0"
+    "parachuting.aero\0"
+    "yashio.saitama.jp\0"
+    "noda.chiba.jp\0"
+    "*.dweb.link\0"
+    "*.on-acorn.io\0"
+    "ch\0"
+    "campinagrande.br\0"
+    "cl\0"
+    "gov.gi\0"
+    "fund\0"
+    "funabashi.chiba.jp\0"
+    "aizuwakamatsu.fukushima.jp\0"
+    "gov.it\0"
+    "skiervá.no\0"
+    "togakushi.nagano.jp\0"
+    "bike\0"
+    "barsy.uk\0"
+    "info.nr\0"
+    "repbody.aero\0"
+    "edu.kp\0"
+    "yoshida.shizuoka.jp\0"
+    "su\0"
+    "mordovia.ru\0"
+    "dynamic-dns.info\0"
+    "mutsu.aomori.jp\0"
+    "*.quipelements.com\0"
+    "bt\0"
+    "net.vn\0"
+    "framercanvas.com\0"
+    "muroran.hokkaido.jp\0"
+    "realty\0"
+    "ltd.uk\0"
+    "tsumagoi.gunma.jp\0"
+    "asahi.mie.jp\0"
+    "shimosuwa.nagano.jp\0"
+    "edu.pt\0"
+    "apartments\0"
+    "outsystemscloud.com\0"
+    "hlx.live\0"
+    "lovesick.jp\0"
+    "bond\0"
+    "sondrio.it\0"
+    "gov.scot\0"
+    "nishikata.tochigi.jp\0"
+    "consultant.aero\0"
+    "shimonita.gunma.jp\0"
+    "fukaya.saitama.jp\0"
+    "philips\0"
+    "信息\0"
+    "cruises\0"
+    "co.bn\0"
+    "perso.sn\0"
+    "trentinostirol.it\0"
+    "inderoy.no\0"
+    "alibaba\0"
+    "tsuno.kochi.jp\0"
+    "it.com\0"
+    "tayninh.vn\0"
+    "sumita.iwate.jp\0"
+    "leitungsen.de\0"
+    "balsan-südtirol.it\0"
+    "co.us\0"
+    "sango.nara.jp\0"
+    "kunigami.okinawa.jp\0"
+    "kirara.st\0"
+    "yasugi.shimane.jp\0"
+    "спб.рус\0"
+    "網路.tw\0"
+    "akamaiedge.net\0"
+    "zw\0"
+    "dealer\0"
+    "blogspot.bj\0"
+    "ଭାରତ\0"
+    "gov.mg\0"
+    "vinhlong.vn\0"
+    "co.bb\0"
+    "help\0"
+    "bestbuy\0"
+    "inuyama.aichi.jp\0"
+    "niteroi.br\0"
+    "paas.massivegrid.com\0"
+    "is-not-certified.com\0"
+    "edu.ve\0"
+    "church\0"
+    "fortal.br\0"
+    "vt.us\0"
+    "copro.uk\0"
+    "firm.co\0"
+    "molde.no\0"
+    "sálát.no\0"
+    "studio\0"
+    "bokn.no\0"
+    "rømskog.no\0"
+    "square7.net\0"
+    "lomo.jp\0"
+    "amazon\0"
+    "*.linodeobjects.com\0"
+    "nakagawa.nagano.jp\0"
+    "jondal.no\0"
+    "satosho.okayama.jp\0"
+    "org.au\0"
+    "arezzo.it\0"
+    "hole.no\0"
+    "nordkapp.no\0"
+    "biz.tt\0"
+    "atsuma.hokkaido.jp\0"
+    "iserv.dev\0"
+    "isteingeek.de\0"
+    "*.azurecontainer.io\0"
+    "mil.cn\0"
+    "shibata.niigata.jp\0"
+    "aerodrome.aero\0"
+    "internet-dns.de\0"
+    "shizuoka.shizuoka.jp\0"
+    "ovre-eiker.no\0"
+    "minamiawaji.hyogo.jp\0"
+    "cust.disrec.thingdust.io\0"
+    "ping\0"
+    "bo.nordland.no\0"
+    "lib.ca.us\0"
+    "biratori.hokkaido.jp\0"
+    "belau.pw\0"
+    "bofa\0"
+    "sinaapp.com\0"
+    "katashina.gunma.jp\0"
+    "mex.com\0"
+    "dedyn.io\0"
+    "e.bg\0"
+    "merseine.nu\0"
+    "nuoro.it\0"
+    "yame.fukuoka.jp\0"
+    "diskstation.org\0"
+    "政府.hk\0"
+    "kihoku.ehime.jp\0"
+    "pr.gov.br\0"
+    "gs.vf.no\0"
+    "ac.ru\0"
+    "shichinohe.aomori.jp\0"
+    "webview-assets.aws-cloud9.ap-southeast-1.amazonaws.com\0"
+    "org.hk\0"
+    "dst.mi.us\0"
+    "rissa.no\0"
+    "ibm\0"
+    "toyota\0"
+    "is-a-student.com\0"
+    "itabashi.tokyo.jp\0"
+    "ruovat.no\0"
+    "hinohara.tokyo.jp\0"
+    "vadso.no\0"
+    "cr.it\0"
+    "tn.it\0"
+    "ac.kr\0"
+    "ddns.net\0"
+    "tokamachi.niigata.jp\0"
+    "homeip.net\0"
+    "saitama.jp\0"
+    "demo.datacenter.fi\0"
+    "org.ma\0"
+    "gov.cy\0"
+    "mb.ca\0"
+    "tv.bb\0"
+    "minami.kyoto.jp\0"
+    "sanjo.niigata.jp\0"
+    "ngrok-free.app\0"
+    "орг.срб\0"
+    "com.bj\0"
+    "ng.eu.org\0"
+    "pri.ee\0"
+    "malatvuopmi.no\0"
+    "cheap.jp\0"
+    "rocks\0"
+    "ddnsfree.com\0"
+    "guovdageaidnu.no\0"
+    "karasjok.no\0"
+    "is-lost.org\0"
+    "dovre.no\0"
+    "dongnai.vn\0"
+    "iwafune.tochigi.jp\0"
+    "ws\0"
+    "sm.ua\0"
+    "lowicz.pl\0"
+    "닷넷\0"
+    "cbg.ru\0"
+    "*.beget.app\0"
+    "streamlitapp.com\0"
+    "far.br\0"
+    "srv.br\0"
+    "us-1.evennode.com\0"
+    "ddnsking.com\0"
+    "anpachi.gifu.jp\0"
+    "trentinoa-adige.it\0"
+    "leikanger.no\0"
+    "app.gp\0"
+    "ventures\0"
+    "de.com\0"
+    "org.co\0"
+    "lib.al.us\0"
+    "net.ci\0"
+    "cool\0"
+    "hanamigawa.chiba.jp\0"
+    "mihara.kochi.jp\0"
+    "inzai.chiba.jp\0"
+    "buyshouses.net\0"
+    "morimachi.shizuoka.jp\0"
+    "uzhgorod.ua\0"
+    "salon\0"
+    "accountant\0"
+    "miyake.nara.jp\0"
+    "leasing.aero\0"
+    "info.na\0"
+    "edu.lc\0"
+    "ind.gt\0"
+    "8.bg\0"
+    "opencraft.hosting\0"
+    "*.sendai.jp\0"
+    "es.gov.br\0"
+    "silk\0"
+    "kamitsue.oita.jp\0"
+    "barsy.shop\0"
+    "sakaki.nagano.jp\0"
+    "fujinomiya.shizuoka.jp\0"
+    "ciao.jp\0"
+    "org.ml\0"
+    "kasaoka.okayama.jp\0"
+    "tsunan.niigata.jp\0"
+    "chonan.chiba.jp\0"
+    "shacknet.nu\0"
+    "tokigawa.saitama.jp\0"
+    "saiki.oita.jp\0"
+    "go.id\0"
+    "webspace.rocks\0"
+    "etne.no\0"
+    "rl.no\0"
+    "poivron.org\0"
+    "uk0.bigv.io\0"
+    "jorpeland.no\0"
+    "nx.cn\0"
+    "net.my\0"
+    "vfs.cloud9.ca-central-1.amazonaws.com\0"
+    "i.ng\0"
+    "org.sn\0"
+    "incheon.kr\0"
+    "exchange\0"
+    "*.advisor.ws\0"
+    "suzuki\0"
+    "flakstad.no\0"
+    "ifm\0"
+    "school\0"
+    "org.bw\0"
+    "edu.sa\0"
+    "kitakami.iwate.jp\0"
+    "tours\0"
+    "s3.eu-central-1.amazonaws.com\0"
+    "ac.il\0"
+    "extraspace\0"
+    "gov.co\0"
+    "media.aero\0"
+    "iwamizawa.hokkaido.jp\0"
+    "walbrzych.pl\0"
+    "soc.dz\0"
+    "mh\0"
+    "ddnss.de\0"
+    "reit\0"
+    "sld.do\0"
+    "nat.tn\0"
+    "okinawa.okinawa.jp\0"
+    "niihama.ehime.jp\0"
+    "shoo.okayama.jp\0"
+    "theatre\0"
+    "mw\0"
+    "exposed\0"
+    "fam.pk\0"
+    "square7.ch\0"
+    "blogspot.si\0"
+    "tg\0"
+    "chikuhoku.nagano.jp\0"
+    "stripper.jp\0"
+    "akamaiedge-staging.net\0"
+    "nishinoomote.kagoshima.jp\0"
+    "chizu.tottori.jp\0"
+    "pars\0"
+    "microsoft\0"
+    "loisirs.bj\0"
+    "mashike.hokkaido.jp\0"
+    "gifu.gifu.jp\0"
+    "smushcdn.com\0"
+    "otari.nagano.jp\0"
+    "loabat.no\0"
+    "cs.keliweb.cloud\0"
+    "yombo.me\0"
+    "asuke.aichi.jp\0"
+    "åmot.no\0"
+    "qpon\0"
+    "pro.ht\0"
+    "tone.ibaraki.jp\0"
+    "iki.fi\0"
+    "net.bt\0"
+    "obninsk.su\0"
+    "tempurl.host\0"
+    "s3.dualstack.sa-east-1.amazonaws.com\0"
+    "神奈川.jp\0"
+    "naamesjevuemie.no\0"
+    "tamamura.gunma.jp\0"
+    "org.pa\0"
+    "yugawa.fukushima.jp\0"
+    "bjugn.no\0"
+    "fin.ci\0"
+    "biz.id\0"
+    "en.it\0"
+    "sc.gov.br\0"
+    "sch.so\0"
+    "公司.香港\0"
+    "com.vi\0"
+    "kouhoku.saga.jp\0"
+    "tjmaxx\0"
+    "appspot.com\0"
+    "*.stg.dev\0"
+    "gov.gn\0"
+    "gov.ph\0"
+    "de\0"
+    "jpn.org\0"
+    "org.kp\0"
+    "wa.gov.au\0"
+    "wazuka.kyoto.jp\0"
+    "kill.jp\0"
+    "song\0"
+    "wpmucdn.com\0"
+    "jelastic.tsukaeru.net\0"
+    "storage\0"
+    "show.aero\0"
+    "ostroleka.pl\0"
+    "misaki.okayama.jp\0"
+    "verran.no\0"
+    "lt.eu.org\0"
+    "mus.mi.us\0"
+    "is-a-blogger.com\0"
+    "tm.cy\0"
+    "mu\0"
+    "crotone.it\0"
+    "leadpages.co\0"
+    "hapmir.no\0"
+    "skjervoy.no\0"
+    "diskussionsbereich.de\0"
+    "loten.no\0"
+    "zagan.pl\0"
+    "or.na\0"
+    "mr\0"
+    "ven.it\0"
+    "siljan.no\0"
+    "co.nl\0"
+    "supabase.net\0"
+    "office-on-the.net\0"
+    "blogspot.cl\0"
+    "onjuku.chiba.jp\0"
+    "ninhthuan.vn\0"
+    "kunimi.fukushima.jp\0"
+    "serveblog.net\0"
+    "jcloud.ik-server.com\0"
+    "blogspot.com.by\0"
+    "com.tr\0"
+    "hå.no\0"
+    "agematsu.nagano.jp\0"
+    "vfs.cloud9.ap-southeast-2.amazonaws.com\0"
+    "go.gov.br\0"
+    "nov.su\0"
+    "porsanger.no\0"
+    "ストア\0"
+    "futtsu.chiba.jp\0"
+    "hizen.saga.jp\0"
+    "blogspot.ug\0"
+    "shunan.yamaguchi.jp\0"
+    "oum.gov.pl\0"
+    "shimamaki.hokkaido.jp\0"
+    "es\0"
+    "al.us\0"
+    "ma\0"
+    "和歌山.jp\0"
+    "hjelmeland.no\0"
+    "lutsk.ua\0"
+    "restaurant.bj\0"
+    "!city.sendai.jp\0"
+    "uji.kyoto.jp\0"
+    "aarp\0"
+    "网址\0"
+    "thruhere.net\0"
+    "up.in\0"
+    "seljord.no\0"
+    "t.se\0"
+    "dyn-vpn.de\0"
+    "museum\0"
+    "org.sb\0"
+    "aridagawa.wakayama.jp\0"
+    "組织.hk\0"
+    "sakura.tochigi.jp\0"
+    "company\0"
+    "gov.mu\0"
+    "osteroy.no\0"
+    "ne\0"
+    "kami.kochi.jp\0"
+    "aizumi.tokushima.jp\0"
+    "bci.dnstrace.pro\0"
+    "nissay\0"
+    "info.at\0"
+    "com.ye\0"
+    "*.cloudera.site\0"
+    "co.ag\0"
+    "zgorzelec.pl\0"
+    "tomisato.chiba.jp\0"
+    "я.рус\0"
+    "aurskog-holand.no\0"
+    "futsu.nagasaki.jp\0"
+    "se.net\0"
+    "info.zm\0"
+    "s3.dualstack.ap-northeast-1.amazonaws.com\0"
+    "org.pl\0"
+    "toda.saitama.jp\0"
+    "com.ni\0"
+    "ba.leg.br\0"
+    "base.ec\0"
+    "ch.trendhosting.cloud\0"
+    "com.ee\0"
+    "chase\0"
+    "myspreadshop.it\0"
+    "i.ph\0"
+    "ohda.shimane.jp\0"
+    "akaiwa.okayama.jp\0"
+    "dating\0"
+    "ltd.ua\0"
+    "gosen.niigata.jp\0"
+    "barrel-of-knowledge.info\0"
+    "tsukuba.ibaraki.jp\0"
+    "s3-website.ca-central-1.amazonaws.com\0"
+    "bjarkoy.no\0"
+    "futaba.fukushima.jp\0"
+    "gov.ng\0"
+    "osøyro.no\0"
+    "lib.de.us\0"
+    "carraramassa.it\0"
+    "boavista.br\0"
+    "cloudcontrolapp.com\0"
+    "målselv.no\0"
+    "sky\0"
+    "eco.br\0"
+    "valle-d-aosta.it\0"
+    "cx\0"
+    "مليسيا\0"
+    "lib.ia.us\0"
+    "in-brb.de\0"
+    "iki.nagasaki.jp\0"
+    "net.gl\0"
+    "ак.срб\0"
+    "campidanomedio.it\0"
+    "arts.co\0"
+    "vossevangen.no\0"
+    "vanylven.no\0"
+    "mail-box.ne.jp\0"
+    "is-a-bookkeeper.com\0"
+    "高知.jp\0"
+    "george\0"
+    "gov.al\0"
+    "sap\0"
+    "dyndns.info\0"
+    "gorlice.pl\0"
+    "coach\0"
+    "mytabit.co.il\0"
+    "net\0"
+    "yonabaru.okinawa.jp\0"
+    "eu.org\0"
+    "noda.iwate.jp\0"
+    "娱乐\0"
+    "yura.wakayama.jp\0"
+    "barsycenter.com\0"
+    "fan\0"
+    "tennis\0"
+    "qh.cn\0"
+    "pay\0"
+    "sorum.no\0"
+    "asso.ht\0"
+    "trentinosüdtirol.it\0"
+    "boldlygoingnowhere.org\0"
+    "campinas.br\0"
+    "barclays\0"
+    "pol.tr\0"
+    "dyndns-at-home.com\0"
+    "eu-3.evennode.com\0"
+    "or.us\0"
+    "ibigawa.gifu.jp\0"
+    "uruma.okinawa.jp\0"
+    "rentals\0"
+    "stavanger.no\0"
+    "com.ws\0"
+    "i.se\0"
+    "sexy\0"
+    "yoita.niigata.jp\0"
+    "yakumo.shimane.jp\0"
+    "parliament.nz\0"
+    "friulive-giulia.it\0"
+    "mobi.tz\0"
+    "mein-vigor.de\0"
+    "fido\0"
+    "mil.eg\0"
+    "cyon.site\0"
+    "sc.leg.br\0"
+    "jpn.com\0"
+    "management\0"
+    "vc.it\0"
+    "kitadaito.okinawa.jp\0"
+    "university\0"
+    "net.pk\0"
+    "berlevag.no\0"
+    "mordovia.su\0"
+    "go.ci\0"
+    "shoparena.pl\0"
+    "com.am\0"
+    "asahi.yamagata.jp\0"
+    "md\0"
+    "noip.us\0"
+    "virgin\0"
+    "forgot.her.name\0"
+    "sola.no\0"
+    "net.gr\0"
+    "api.stdlib.com\0"
+    "ایران\0"
+    "nombre.bo\0"
+    "ngrok-free.dev\0"
+    "palmas.br\0"
+;
+
+static const quint32 TLDOffsets[9104] = {
+    0, 8, 17, 24, 40, 50, 55, 65,
+    72, 79, 91, 101, 108, 115, 128, 144,
+    170, 182, 193, 207, 214, 221, 232, 238,
+    245, 251, 258, 265, 283, 295, 311, 322,
+    331, 349, 354, 362, 378, 383, 394, 401,
+    408, 415, 451, 460, 483, 496, 506, 512,
+    518, 521, 531, 550, 560, 567, 574, 583,
+    600, 609, 623, 630, 642, 652, 668, 675,
+    687, 699, 712, 719, 738, 744, 769, 776,
+    796, 810, 822, 830, 844, 852, 859, 870,
+    873, 890, 902, 913, 921, 935, 944, 954,
+    965, 985, 997, 1006, 1013, 1023, 1032, 1047,
+    1056, 1063, 1070, 1080, 1103, 1108, 1119, 1138,
+    1148, 1160, 1169, 1173, 1176, 1190, 1200, 1208,
+    1212, 1234, 1247, 1253, 1256, 1263, 1273, 1280,
+    1297, 1312, 1319, 1326, 1346, 1356, 1367, 1377,
+    1396, 1407, 1419, 1424, 1436, 1443, 1459, 1478,
+    1484, 1493, 1499, 1504, 1516, 1534, 1553, 1570,
+    1578, 1585, 1600, 1622, 1629, 1636, 1646, 1657,
+    1675, 1685, 1705, 1741, 1749, 1776, 1793, 1803,
+    1815, 1819, 1828, 1838, 1843, 1856, 1862, 1866,
+    1872, 1877, 1897, 1901, 1913, 1919, 1940, 1954,
+    1960, 1977, 1983, 1993, 2002, 2023, 2036, 2057,
+    2064, 2074, 2080, 2090, 2112, 2130, 2140, 2147,
+    2162, 2166, 2183, 2202, 2209, 2216, 2229, 2236,
+    2241, 2248, 2255, 2278, 2289, 2304, 2316, 2322,
+    2342, 2361, 2373, 2382, 2389, 2402, 2406, 2412,
+    2422, 2433, 2440, 2460, 2463, 2477, 2487, 2508,
+    2513, 2526, 2539, 2547, 2554, 2561, 2580, 2587,
+    2637, 2659, 2667, 2679, 2686, 2696, 2703, 2709,
+    2715, 2722, 2729, 2736, 2752, 2768, 2775, 2783,
+    2788, 2794, 2815, 2840, 2847, 2866, 2877, 2884,
+    2894, 2904, 2914, 2921, 2931, 2938, 2941, 2962,
+    2974, 2981, 2988, 2994, 3000, 3005, 3018, 3024,
+    3036, 3040, 3054, 3063, 3069, 3083, 3088, 3108,
+    3115, 3134, 3141, 3147, 3153, 3159, 3170, 3177,
+    3184, 3191, 3198, 3215, 3220, 3236, 3245, 3255,
+    3261, 3273, 3280, 3301, 3308, 3323, 3374, 3383,
+    3389, 3393, 3403, 3420, 3427, 3435, 3446, 3458,
+    3465, 3475, 3482, 3497, 3503, 3518, 3536, 3554,
+    3559, 3568, 3610, 3635, 3639, 3646, 3666, 3673,
+    3681, 3691, 3706, 3719, 3726, 3732, 3739, 3761,
+    3768, 3775, 3790, 3802, 3819, 3829, 3838, 3844,
+    3854, 3860, 3867, 3883, 3897, 3916, 3924, 3944,
+    3948, 3973, 3982, 3989, 3997, 4004, 4012, 4030,
+    4041, 4050, 4064, 4080, 4090, 4096, 4106, 4133,
+    4152, 4175, 4196, 4216, 4226, 4243, 4249, 4255,
+    4262, 4280, 4287, 4294, 4313, 4316, 4334, 4350,
+    4355, 4364, 4371, 4375, 4381, 4394, 4400, 4407,
+    4427, 4434, 4453, 4457, 4464, 4471, 4486, 4498,
+    4516, 4548, 4558, 4570, 4591, 4598, 4617, 4624,
+    4638, 4644, 4672, 4682, 4692, 4696, 4703, 4713,
+    4716, 4722, 4731, 4738, 4759, 4763, 4781, 4790,
+    4803, 4806, 4820, 4834, 4846, 4858, 4861, 4878,
+    4885, 4903, 4919, 4929, 4936, 4951, 4959, 4972,
+    4983, 5000, 5014, 5021, 5028, 5041, 5052, 5058,
+    5065, 5077, 5084, 5089, 5096, 5104, 5116, 5151,
+    5162, 5172, 5184, 5197, 5203, 5208, 5217, 5226,
+    5237, 5245, 5255, 5262, 5269, 5275, 5282, 5292,
+    5309, 5320, 5327, 5337, 5352, 5363, 5369, 5379,
+    5386, 5393, 5417, 5437, 5454, 5463, 5474, 5486,
+    5491, 5503, 5513, 5518, 5545, 5563, 5569, 5575,
+    5595, 5610, 5628, 5633, 5650, 5669, 5679, 5687,
+    5702, 5709, 5737, 5744, 5760, 5776, 5795, 5802,
+    5813, 5834, 5850, 5857, 5879, 5888, 5906, 5918,
+    5942, 5957, 5967, 5971, 5977, 5986, 5998, 6017,
+    6042, 6046, 6049, 6055, 6071, 6078, 6088, 6097,
+    6107, 6119, 6123, 6130, 6139, 6151, 6177, 6184,
+    6203, 6212, 6224, 6244, 6264, 6271, 6277, 6295,
+    6310, 6327, 6334, 6341, 6362, 6369, 6374, 6393,
+    6396, 6403, 6410, 6422, 6429, 6445, 6460, 6466,
+    6473, 6480, 6495, 6505, 6512, 6535, 6550, 6568,
+    6575, 6589, 6592, 6602, 6613, 6621, 6638, 6645,
+    6652, 6659, 6670, 6683, 6710, 6716, 6722, 6737,
+    6751, 6759, 6768, 6781, 6796, 6806, 6812, 6822,
+    6838, 6852, 6861, 6865, 6879, 6902, 6911, 6924,
+    6945, 6964, 6976, 6991, 6997, 7017, 7022, 7033,
+    7037, 7053, 7070, 7074, 7081, 7088, 7107, 7114,
+    7123, 7138, 7159, 7175, 7182, 7190, 7197, 7203,
+    7217, 7234, 7280, 7288, 7294, 7305, 7324, 7331,
+    7340, 7350, 7361, 7378, 7395, 7411, 7418, 7434,
+    7441, 7448, 7462, 7474, 7496, 7510, 7517, 7524,
+    7533, 7550, 7570, 7580, 7593, 7599, 7620, 7624,
+    7630, 7648, 7660, 7667, 7685, 7694, 7701, 7720,
+    7742, 7761, 7778, 7796, 7803, 7809, 7813, 7821,
+    7828, 7833, 7839, 7853, 7859, 7877, 7880, 7887,
+    7911, 7936, 7947, 7969, 7990, 7996, 8013, 8020,
+    8030, 8037, 8044, 8095, 8114, 8125, 8150, 8156,
+    8168, 8179, 8186, 8203, 8206, 8219, 8222, 8228,
+    8237, 8245, 8257, 8271, 8293, 8300, 8316, 8326,
+    8333, 8354, 8362, 8367, 8379, 8401, 8412, 8432,
+    8435, 8441, 8450, 8473, 8480, 8485, 8495, 8498,
+    8513, 8520, 8529, 8539, 8546, 8558, 8565, 8575,
+    8582, 8602, 8620, 8638, 8646, 8662, 8673, 8679,
+    8695, 8707, 8722, 8731, 8738, 8746, 8757, 8767,
+    8785, 8792, 8807, 8824, 8827, 8846, 8867, 8870,
+    8882, 8895, 8908, 8924, 8932, 8940, 8946, 8956,
+    8974, 8985, 8998, 9012, 9017, 9027, 9042, 9059,
+    9068, 9075, 9086, 9093, 9111, 9146, 9149, 9165,
+    9172, 9184, 9202, 9251, 9255, 9268, 9302, 9312,
+    9323, 9328, 9337, 9344, 9354, 9375, 9380, 9385,
+    9394, 9400, 9415, 9428, 9435, 9451, 9458, 9481,
+    9488, 9495, 9505, 9514, 9525, 9530, 9536, 9549,
+    9565, 9579, 9593, 9606, 9623, 9633, 9639, 9648,
+    9658, 9669, 9685, 9692, 9708, 9717, 9721, 9729,
+    9738, 9745, 9755, 9772, 9793, 9801, 9804, 9833,
+    9840, 9844, 9862, 9878, 9899, 9913, 9922, 9933,
+    9940, 9954, 9960, 9989, 9996, 10009, 10024, 10035,
+    10042, 10067, 10074, 10093, 10102, 10115, 10126, 10132,
+    10139, 10145, 10151, 10164, 10171, 10176, 10186, 10193,
+    10215, 10226, 10235, 10249, 10261, 10278, 10287, 10297,
+    10306, 10316, 10326, 10344, 10371, 10381, 10399, 10406,
+    10415, 10418, 10426, 10429, 10436, 10453, 10476, 10489,
+    10502, 10510, 10527, 10542, 10549, 10562, 10573, 10591,
+    10600, 10617, 10633, 10648, 10655, 10662, 10682, 10688,
+    10700, 10710, 10719, 10728, 10735, 10739, 10759, 10766,
+    10785, 10793, 10812, 10831, 10838, 10847, 10854, 10861,
+    10874, 10882, 10889, 10899, 10910, 10919, 10936, 10948,
+    10955, 10962, 10970, 10975, 10995, 11010, 11028, 11043,
+    11054, 11067, 11077, 11088, 11102, 11119, 11132, 11144,
+    11154, 11160, 11170, 11177, 11185, 11188, 11204, 11217,
+    11231, 11248, 11253, 11263, 11284, 11308, 11323, 11342,
+    11350, 11355, 11371, 11375, 11380, 11397, 11412, 11425,
+    11432, 11445, 11462, 11479, 11498, 11505, 11512, 11519,
+    11536, 11546, 11552, 11564, 11574, 11591, 11605, 11623,
+    11643, 11649, 11665, 11680, 11685, 11701, 11709, 11730,
+    11737, 11740, 11756, 11774, 11784, 11791, 11815, 11839,
+    11846, 11852, 11862, 11881, 11890, 11899, 11920, 11935,
+    11950, 11957, 11960, 11967, 11974, 11983, 11993, 12000,
+    12019, 12032, 12039, 12055, 12061, 12068, 12078, 12083,
+    12092, 12143, 12161, 12167, 12175, 12193, 12200, 12207,
+    12226, 12244, 12250, 12261, 12273, 12277, 12296, 12308,
+    12314, 12333, 12380, 12387, 12390, 12402, 12409, 12416,
+    12428, 12442, 12448, 12455, 12470, 12488, 12513, 12529,
+    12540, 12558, 12578, 12600, 12607, 12617, 12643, 12664,
+    12670, 12694, 12699, 12706, 12717, 12731, 12748, 12763,
+    12773, 12796, 12805, 12824, 12834, 12844, 12852, 12869,
+    12880, 12891, 12901, 12909, 12920, 12930, 12942, 12956,
+    12970, 12982, 12988, 13000, 13011, 13031, 13051, 13060,
+    13072, 13078, 13098, 13115, 13134, 13143, 13167, 13187,
+    13196, 13212, 13232, 13278, 13285, 13295, 13298, 13305,
+    13321, 13325, 13337, 13348, 13355, 13366, 13376, 13401,
+    13420, 13443, 13450, 13464, 13474, 13487, 13495, 13498,
+    13506, 13517, 13521, 13530, 13538, 13545, 13552, 13558,
+    13575, 13580, 13592, 13599, 13605, 13619, 13624, 13671,
+    13680, 13687, 13699, 13711, 13719, 13725, 13734, 13748,
+    13762, 13765, 13790, 13798, 13805, 13823, 13833, 13839,
+    13869, 13884, 13888, 13907, 13917, 13938, 13952, 13971,
+    13977, 13984, 13996, 14004, 14011, 14033, 14040, 14047,
+    14054, 14070, 14088, 14095, 14105, 14114, 14124, 14129,
+    14141, 14158, 14175, 14192, 14205, 14213, 14222, 14229,
+    14241, 14250, 14257, 14267, 14281, 14288, 14295, 14307,
+    14316, 14335, 14344, 14354, 14367, 14376, 14392, 14399,
+    14408, 14419, 14437, 14442, 14448, 14455, 14473, 14482,
+    14496, 14505, 14523, 14529, 14545, 14567, 14575, 14585,
+    14606, 14612, 14633, 14644, 14662, 14668, 14677, 14689,
+    14702, 14712, 14726, 14729, 14739, 14749, 14764, 14774,
+    14778, 14794, 14803, 14813, 14820, 14836, 14843, 14850,
+    14861, 14867, 14882, 14885, 14888, 14904, 14911, 14921,
+    14934, 14945, 14948, 14969, 14985, 14996, 15014, 15027,
+    15034, 15053, 15082, 15095, 15105, 15116, 15122, 15137,
+    15145, 15152, 15169, 15195, 15205, 15217, 15224, 15235,
+    15246, 15253, 15271, 15278, 15281, 15293, 15311, 15329,
+    15349, 15360, 15376, 15389, 15395, 15411, 15418, 15422,
+    15425, 15446, 15458, 15465, 15472, 15483, 15498, 15505,
+    15511, 15515, 15520, 15530, 15537, 15544, 15557, 15573,
+    15583, 15602, 15609, 15622, 15638, 15659, 15676, 15683,
+    15707, 15729, 15743, 15753, 15765, 15777, 15783, 15790,
+    15795, 15801, 15812, 15829, 15856, 15877, 15888, 15895,
+    15901, 15911, 15942, 15961, 15978, 15996, 16006, 16018,
+    16042, 16053, 16073, 16079, 16084, 16094, 16108, 16115,
+    16118, 16129, 16145, 16153, 16159, 16166, 16191, 16201,
+    16216, 16232, 16244, 16260, 16267, 16290, 16295, 16310,
+    16317, 16359, 16375, 16383, 16399, 16421, 16440, 16452,
+    16481, 16492, 16506, 16512, 16519, 16525, 16538, 16546,
+    16553, 16565, 16581, 16584, 16594, 16601, 16613, 16639,
+    16648, 16690, 16709, 16715, 16722, 16731, 16734, 16750,
+    16762, 16766, 16771, 16783, 16796, 16803, 16810, 16830,
+    16833, 16850, 16864, 16879, 16885, 16893, 16907, 16914,
+    16918, 16925, 16932, 16960, 16970, 16976, 16988, 17004,
+    17012, 17029, 17035, 17052, 17064, 17071, 17079, 17091,
+    17106, 17121, 17136, 17143, 17151, 17161, 17176, 17183,
+    17193, 17213, 17232, 17239, 17252, 17257, 17264, 17271,
+    17283, 17293, 17325, 17341, 17362, 17369, 17385, 17391,
+    17394, 17404, 17408, 17415, 17430, 17451, 17468, 17474,
+    17479, 17496, 17503, 17508, 17519, 17537, 17543, 17562,
+    17566, 17581, 17584, 17594, 17617, 17634, 17655, 17670,
+    17677, 17686, 17699, 17713, 17733, 17740, 17758, 17765,
+    17791, 17800, 17816, 17826, 17832, 17842, 17849, 17857,
+    17875, 17883, 17890, 17940, 17955, 17972, 17979, 17991,
+    17998, 18005, 18020, 18031, 18041, 18050, 18060, 18066,
+    18083, 18091, 18102, 18110, 18117, 18126, 18145, 18161,
+    18174, 18184, 18187, 18206, 18214, 18230, 18237, 18251,
+    18257, 18273, 18280, 18292, 18299, 18306, 18318, 18327,
+    18344, 18358, 18373, 18380, 18399, 18419, 18439, 18445,
+    18451, 18462, 18468, 18490, 18501, 18514, 18525, 18541,
+    18569, 18574, 18596, 18603, 18613, 18629, 18635, 18643,
+    18650, 18664, 18682, 18695, 18710, 18715, 18724, 18733,
+    18754, 18761, 18776, 18791, 18798, 18813, 18820, 18828,
+    18854, 18885, 18892, 18906, 18918, 18933, 18941, 18953,
+    18963, 18982, 18997, 19010, 19032, 19038, 19053, 19057,
+    19061, 19067, 19071, 19078, 19085, 19089, 19096, 19106,
+    19126, 19148, 19155, 19161, 19175, 19190, 19208, 19216,
+    19223, 19230, 19243, 19260, 19266, 19273, 19286, 19300,
+    19317, 19333, 19343, 19350, 19362, 19379, 19384, 19400,
+    19411, 19423, 19430, 19437, 19445, 19463, 19484, 19502,
+    19515, 19550, 19557, 19568, 19587, 19607, 19617, 19624,
+    19642, 19651, 19661, 19679, 19686, 19697, 19704, 19724,
+    19738, 19744, 19761, 19768, 19788, 19805, 19817, 19824,
+    19827, 19840, 19857, 19870, 19874, 19879, 19892, 19908,
+    19911, 19924, 19941, 19952, 19959, 19966, 19975, 19989,
+    19992, 19999, 20009, 20016, 20027, 20043, 20055, 20071,
+    20077, 20088, 20097, 20109, 20117, 20124, 20130, 20142,
+    20150, 20157, 20177, 20195, 20203, 20217, 20231, 20241,
+    20251, 20259, 20276, 20283, 20293, 20305, 20312, 20328,
+    20337, 20346, 20362, 20376, 20392, 20399, 20408, 20414,
+    20420, 20431, 20442, 20449, 20461, 20471, 20491, 20499,
+    20506, 20513, 20525, 20540, 20543, 20556, 20563, 20572,
+    20590, 20602, 20611, 20632, 20636, 20648, 20661, 20680,
+    20701, 20707, 20726, 20739, 20754, 20761, 20781, 20799,
+    20814, 20823, 20828, 20832, 20839, 20845, 20852, 20855,
+    20882, 20889, 20908, 20918, 20934, 20949, 20958, 20965,
+    20980, 20991, 21003, 21007, 21017, 21029, 21042, 21053,
+    21059, 21069, 21075, 21086, 21105, 21112, 21123, 21158,
+    21164, 21174, 21188, 21195, 21221, 21241, 21250, 21259,
+    21276, 21283, 21289, 21306, 21312, 21319, 21326, 21337,
+    21359, 21364, 21370, 21380, 21387, 21399, 21414, 21430,
+    21440, 21455, 21466, 21481, 21501, 21519, 21529, 21548,
+    21555, 21574, 21580, 21587, 21597, 21604, 21659, 21671,
+    21682, 21689, 21716, 21740, 21752, 21756, 21763, 21777,
+    21794, 21816, 21829, 21839, 21851, 21866, 21877, 21883,
+    21904, 21908, 21924, 21942, 21957, 21963, 21973, 21978,
+    21981, 21988, 21997, 22015, 22021, 22040, 22049, 22064,
+    22083, 22090, 22096, 22104, 22116, 22127, 22144, 22162,
+    22180, 22187, 22206, 22216, 22223, 22241, 22256, 22267,
+    22272, 22275, 22283, 22299, 22316, 22330, 22349, 22359,
+    22365, 22372, 22399, 22406, 22410, 22422, 22436, 22448,
+    22462, 22468, 22484, 22495, 22504, 22520, 22526, 22530,
+    22552, 22562, 22570, 22582, 22596, 22615, 22619, 22626,
+    22644, 22661, 22671, 22695, 22708, 22718, 22735, 22754,
+    22761, 22769, 22777, 22790, 22802, 22820, 22828, 22849,
+    22861, 22867, 22874, 22880, 22884, 22897, 22913, 22921,
+    22939, 22956, 22962, 22969, 22979, 22986, 22993, 23006,
+    23015, 23025, 23033, 23053, 23073, 23077, 23096, 23115,
+    23128, 23131, 23139, 23143, 23161, 23180, 23196, 23217,
+    23233, 23249, 23267, 23283, 23299, 23317, 23333, 23340,
+    23356, 23370, 23380, 23393, 23399, 23406, 23422, 23430,
+    23449, 23453, 23463, 23479, 23497, 23515, 23521, 23525,
+    23537, 23544, 23565, 23574, 23585, 23591, 23598, 23605,
+    23622, 23631, 23642, 23697, 23715, 23735, 23748, 23751,
+    23764, 23776, 23788, 23795, 23804, 23833, 23843, 23860,
+    23867, 23874, 23890, 23907, 23926, 23936, 23943, 23985,
+    24000, 24013, 24017, 24067, 24090, 24098, 24118, 24145,
+    24163, 24175, 24182, 24191, 24231, 24238, 24251, 24258,
+    24272, 24279, 24293, 24311, 24335, 24342, 24345, 24348,
+    24356, 24374, 24388, 24400, 24409, 24412, 24443, 24463,
+    24476, 24495, 24507, 24524, 24529, 24543, 24550, 24562,
+    24577, 24582, 24589, 24600, 24617, 24634, 24644, 24684,
+    24691, 24698, 24708, 24718, 24734, 24748, 24763, 24773,
+    24795, 24841, 24848, 24872, 24887, 24904, 24916, 24927,
+    24956, 24975, 24988, 25011, 25018, 25037, 25050, 25054,
+    25073, 25080, 25086, 25096, 25111, 25123, 25126, 25133,
+    25140, 25150, 25161, 25181, 25193, 25213, 25229, 25245,
+    25256, 25268, 25279, 25285, 25299, 25307, 25323, 25329,
+    25341, 25348, 25355, 25371, 25375, 25393, 25444, 25460,
+    25473, 25491, 25506, 25515, 25531, 25550, 25558, 25565,
+    25585, 25595, 25602, 25616, 25639, 25657, 25673, 25682,
+    25694, 25707, 25725, 25734, 25741, 25746, 25752, 25759,
+    25782, 25794, 25801, 25807, 25824, 25830, 25850, 25863,
+    25879, 25887, 25904, 25918, 25928, 25936, 25942, 25952,
+    25956, 25981, 25985, 26009, 26016, 26031, 26037, 26055,
+    26076, 26091, 26106, 26113, 26116, 26139, 26152, 26164,
+    26174, 26199, 26208, 26222, 26238, 26245, 26249, 26254,
+    26259, 26268, 26272, 26279, 26294, 26309, 26316, 26333,
+    26340, 26348, 26358, 26363, 26375, 26382, 26388, 26405,
+    26413, 26433, 26450, 26459, 26480, 26487, 26494, 26511,
+    26522, 26537, 26554, 26562, 26573, 26585, 26590, 26610,
+    26617, 26629, 26647, 26654, 26664, 26671, 26674, 26695,
+    26702, 26706, 26718, 26723, 26732, 26736, 26743, 26758,
+    26765, 26776, 26794, 26810, 26820, 26835, 26842, 26853,
+    26867, 26874, 26889, 26901, 26923, 26926, 26932, 26938,
+    26944, 26952, 26965, 26972, 26985, 26997, 27015, 27023,
+    27035, 27042, 27060, 27070, 27073, 27082, 27096, 27110,
+    27116, 27128, 27135, 27144, 27150, 27160, 27179, 27197,
+    27201, 27210, 27221, 27234, 27252, 27259, 27272, 27291,
+    27297, 27303, 27322, 27339, 27346, 27355, 27360, 27383,
+    27393, 27405, 27410, 27420, 27442, 27448, 27452, 27459,
+    27463, 27478, 27484, 27506, 27522, 27529, 27540, 27556,
+    27568, 27575, 27582, 27588, 27602, 27608, 27643, 27659,
+    27668, 27677, 27690, 27730, 27738, 27745, 27752, 27794,
+    27813, 27829, 27842, 27852, 27856, 27870, 27874, 27882,
+    27889, 27895, 27926, 27937, 27955, 27974, 27986, 28005,
+    28012, 28026, 28040, 28044, 28051, 28068, 28093, 28102,
+    28109, 28125, 28137, 28144, 28163, 28169, 28191, 28202,
+    28209, 28216, 28231, 28238, 28245, 28259, 28272, 28279,
+    28285, 28291, 28311, 28318, 28327, 28337, 28340, 28358,
+    28367, 28374, 28377, 28390, 28406, 28426, 28433, 28451,
+    28462, 28470, 28475, 28489, 28507, 28526, 28546, 28556,
+    28567, 28577, 28587, 28596, 28614, 28634, 28643, 28659,
+    28668, 28684, 28691, 28711, 28717, 28739, 28747, 28761,
+    28769, 28777, 28781, 28788, 28800, 28806, 28813, 28836,
+    28852, 28867, 28888, 28895, 28910, 28916, 28923, 28941,
+    28951, 28957, 28960, 28982, 28990, 28996, 29003, 29014,
+    29035, 29050, 29056, 29066, 29073, 29100, 29106, 29113,
+    29119, 29137, 29167, 29179, 29202, 29208, 29211, 29224,
+    29231, 29241, 29257, 29263, 29274, 29279, 29289, 29301,
+    29314, 29333, 29339, 29352, 29370, 29393, 29409, 29435,
+    29446, 29461, 29470, 29477, 29487, 29500, 29512, 29530,
+    29542, 29554, 29570, 29591, 29608, 29614, 29637, 29660,
+    29698, 29704, 29716, 29733, 29754, 29803, 29821, 29827,
+    29834, 29849, 29855, 29864, 29871, 29879, 29889, 29896,
+    29901, 29910, 29920, 29928, 29935, 29951, 29968, 29990,
+    29993, 30004, 30023, 30037, 30054, 30060, 30076, 30100,
+    30108, 30114, 30117, 30126, 30135, 30154, 30170, 30178,
+    30184, 30196, 30206, 30218, 30225, 30235, 30243, 30250,
+    30263, 30269, 30283, 30289, 30303, 30316, 30327, 30345,
+    30362, 30380, 30401, 30424, 30427, 30446, 30452, 30468,
+    30474, 30495, 30505, 30513, 30525, 30545, 30555, 30571,
+    30577, 30583, 30608, 30614, 30623, 30641, 30654, 30662,
+    30669, 30677, 30684, 30699, 30718, 30735, 30742, 30759,
+    30788, 30794, 30801, 30813, 30832, 30847, 30857, 30864,
+    30871, 30881, 30908, 30918, 30929, 30939, 30950, 30957,
+    30972, 30979, 30990, 31003, 31014, 31021, 31028, 31037,
+    31044, 31051, 31055, 31066, 31083, 31094, 31104, 31125,
+    31135, 31147, 31153, 31162, 31171, 31178, 31198, 31210,
+    31224, 31246, 31261, 31271, 31292, 31304, 31320, 31333,
+    31354, 31363, 31367, 31387, 31405, 31412, 31420, 31432,
+    31450, 31466, 31478, 31487, 31493, 31506, 31521, 31542,
+    31552, 31562, 31598, 31608, 31615, 31625, 31633, 31644,
+    31664, 31689, 31696, 31716, 31730, 31737, 31748, 31761,
+    31767, 31774, 31782, 31793, 31812, 31825, 31832, 31844,
+    31850, 31870, 31881, 31887, 31904, 31914, 31920, 31926,
+    31933, 31951, 31961, 31975, 31985, 31991, 32014, 32024,
+    32031, 32044, 32054, 32067, 32074, 32087, 32098, 32105,
+    32136, 32149, 32156, 32166, 32186, 32190, 32202, 32207,
+    32217, 32224, 32242, 32250, 32256, 32271, 32286, 32293,
+    32304, 32321, 32328, 32340, 32349, 32367, 32381, 32392,
+    32396, 32406, 32417, 32425, 32443, 32456, 32459, 32470,
+    32492, 32502, 32505, 32514, 32521, 32526, 32535, 32546,
+    32553, 32561, 32565, 32581, 32588, 32597, 32614, 32629,
+    32641, 32648, 32658, 32680, 32699, 32708, 32712, 32728,
+    32744, 32761, 32783, 32800, 32811, 32822, 32834, 32852,
+    32861, 32868, 32875, 32884, 32900, 32925, 32942, 32959,
+    32967, 32975, 32991, 33011, 33025, 33035, 33042, 33047,
+    33057, 33066, 33085, 33091, 33098, 33104, 33107, 33118,
+    33137, 33155, 33178, 33196, 33217, 33225, 33232, 33246,
+    33252, 33268, 33276, 33286, 33305, 33315, 33318, 33328,
+    33333, 33355, 33381, 33402, 33418, 33425, 33432, 33439,
+    33446, 33456, 33466, 33477, 33482, 33486, 33508, 33518,
+    33521, 33552, 33564, 33574, 33590, 33613, 33620, 33634,
+    33641, 33644, 33656, 33672, 33690, 33706, 33719, 33742,
+    33748, 33753, 33799, 33807, 33858, 33877, 33882, 33904,
+    33916, 33927, 33953, 33959, 33969, 33979, 33984, 33991,
+    33997, 34011, 34018, 34021, 34030, 34033, 34038, 34045,
+    34053, 34074, 34097, 34108, 34163, 34172, 34178, 34196,
+    34204, 34211, 34220, 34226, 34233, 34239, 34250, 34261,
+    34268, 34284, 34293, 34305, 34326, 34347, 34361, 34380,
+    34383, 34390, 34411, 34418, 34426, 34433, 34445, 34456,
+    34464, 34469, 34486, 34497, 34513, 34519, 34527, 34530,
+    34540, 34551, 34566, 34571, 34579, 34591, 34601, 34611,
+    34618, 34634, 34650, 34655, 34665, 34674, 34685, 34697,
+    34707, 34712, 34717, 34738, 34743, 34754, 34761, 34780,
+    34796, 34812, 34819, 34829, 34839, 34846, 34855, 34861,
+    34868, 34874, 34889, 34895, 34909, 34928, 34932, 34940,
+    34946, 34965, 34978, 34993, 35004, 35011, 35018, 35034,
+    35052, 35059, 35072, 35084, 35099, 35110, 35120, 35130,
+    35140, 35150, 35155, 35160, 35168, 35180, 35186, 35192,
+    35204, 35215, 35236, 35246, 35258, 35279, 35296, 35331,
+    35337, 35340, 35356, 35359, 35376, 35383, 35400, 35420,
+    35427, 35434, 35441, 35459, 35465, 35472, 35488, 35497,
+    35507, 35515, 35531, 35545, 35566, 35579, 35602, 35612,
+    35621, 35630, 35654, 35670, 35684, 35691, 35702, 35717,
+    35723, 35738, 35747, 35751, 35760, 35767, 35788, 35803,
+    35813, 35820, 35823, 35835, 35847, 35866, 35874, 35877,
+    35890, 35908, 35915, 35939, 35947, 35965, 35971, 35978,
+    35988, 36007, 36020, 36034, 36046, 36053, 36076, 36083,
+    36089, 36099, 36102, 36115, 36129, 36142, 36157, 36163,
+    36175, 36184, 36191, 36202, 36209, 36212, 36231, 36240,
+    36247, 36260, 36270, 36283, 36288, 36296, 36308, 36313,
+    36334, 36365, 36382, 36389, 36404, 36416, 36423, 36440,
+    36445, 36455, 36468, 36474, 36494, 36504, 36514, 36521,
+    36535, 36541, 36549, 36555, 36562, 36574, 36591, 36602,
+    36612, 36620, 36628, 36636, 36645, 36662, 36668, 36681,
+    36696, 36705, 36710, 36718, 36730, 36737, 36744, 36750,
+    36764, 36780, 36792, 36804, 36815, 36819, 36834, 36845,
+    36852, 36860, 36870, 36889, 36906, 36923, 36939, 36949,
+    36959, 36972, 36983, 37033, 37053, 37073, 37092, 37103,
+    37117, 37125, 37138, 37156, 37159, 37180, 37189, 37200,
+    37209, 37219, 37223, 37233, 37245, 37255, 37270, 37279,
+    37289, 37304, 37310, 37332, 37344, 37367, 37374, 37391,
+    37396, 37414, 37443, 37461, 37471, 37477, 37488, 37493,
+    37509, 37514, 37520, 37529, 37543, 37546, 37564, 37579,
+    37586, 37593, 37605, 37622, 37638, 37646, 37659, 37675,
+    37683, 37690, 37705, 37718, 37731, 37740, 37746, 37762,
+    37777, 37782, 37798, 37807, 37815, 37825, 37831, 37838,
+    37852, 37864, 37871, 37888, 37900, 37927, 37934, 37941,
+    37953, 37970, 37988, 37995, 37998, 38011, 38028, 38045,
+    38056, 38075, 38096, 38103, 38128, 38138, 38147, 38157,
+    38164, 38170, 38174, 38180, 38183, 38190, 38207, 38229,
+    38255, 38261, 38275, 38282, 38300, 38310, 38326, 38345,
+    38372, 38382, 38400, 38411, 38422, 38435, 38441, 38458,
+    38467, 38475, 38483, 38502, 38526, 38530, 38540, 38548,
+    38563, 38568, 38576, 38587, 38596, 38605, 38623, 38634,
+    38641, 38666, 38672, 38682, 38691, 38712, 38722, 38735,
+    38782, 38800, 38818, 38855, 38867, 38884, 38891, 38898,
+    38904, 38915, 38921, 38938, 38946, 38954, 38968, 38974,
+    38985, 38995, 39002, 39012, 39021, 39038, 39048, 39060,
+    39063, 39074, 39087, 39097, 39106, 39128, 39134, 39148,
+    39162, 39165, 39191, 39201, 39210, 39222, 39229, 39236,
+    39247, 39257, 39266, 39274, 39284, 39304, 39314, 39320,
+    39338, 39347, 39359, 39370, 39380, 39387, 39400, 39410,
+    39417, 39423, 39427, 39434, 39450, 39460, 39470, 39484,
+    39490, 39511, 39522, 39539, 39546, 39552, 39562, 39569,
+    39575, 39582, 39600, 39608, 39621, 39626, 39645, 39655,
+    39665, 39682, 39701, 39705, 39713, 39716, 39736, 39750,
+    39768, 39780, 39799, 39821, 39840, 39856, 39868, 39888,
+    39906, 39916, 39928, 39937, 39945, 39970, 39983, 39990,
+    40003, 40015, 40031, 40042, 40049, 40066, 40080, 40086,
+    40106, 40112, 40128, 40135, 40145, 40149, 40156, 40168,
+    40188, 40205, 40255, 40261, 40272, 40277, 40283, 40286,
+    40293, 40300, 40307, 40312, 40319, 40326, 40346, 40351,
+    40369, 40393, 40411, 40417, 40423, 40430, 40448, 40466,
+    40470, 40481, 40508, 40520, 40537, 40552, 40558, 40565,
+    40569, 40576, 40581, 40592, 40609, 40620, 40635, 40642,
+    40664, 40670, 40677, 40690, 40708, 40714, 40717, 40730,
+    40737, 40746, 40754, 40764, 40770, 40779, 40785, 40797,
+    40803, 40823, 40839, 40845, 40850, 40856, 40866, 40872,
+    40879, 40884, 40905, 40912, 40915, 40924, 40931, 40946,
+    40953, 40968, 40993, 40999, 41015, 41035, 41042, 41054,
+    41065, 41073, 41081, 41109, 41124, 41133, 41149, 41154,
+    41169, 41176, 41188, 41207, 41227, 41237, 41243, 41250,
+    41257, 41265, 41274, 41282, 41292, 41305, 41323, 41358,
+    41365, 41376, 41396, 41442, 41454, 41461, 41472, 41507,
+    41520, 41527, 41545, 41565, 41575, 41584, 41592, 41600,
+    41618, 41640, 41649, 41656, 41671, 41678, 41688, 41702,
+    41718, 41736, 41744, 41754, 41764, 41771, 41775, 41782,
+    41795, 41806, 41816, 41823, 41858, 41867, 41879, 41889,
+    41905, 41929, 41933, 41943, 41966, 41993, 42011, 42034,
+    42044, 42054, 42065, 42072, 42087, 42095, 42099, 42107,
+    42120, 42126, 42142, 42152, 42159, 42162, 42167, 42183,
+    42190, 42197, 42207, 42222, 42228, 42235, 42242, 42249,
+    42259, 42271, 42287, 42294, 42305, 42311, 42319, 42326,
+    42339, 42351, 42358, 42363, 42369, 42377, 42380, 42387,
+    42394, 42403, 42413, 42425, 42444, 42463, 42479, 42490,
+    42507, 42527, 42545, 42551, 42561, 42568, 42574, 42588,
+    42603, 42609, 42621, 42638, 42645, 42650, 42663, 42676,
+    42694, 42706, 42717, 42734, 42740, 42750, 42758, 42762,
+    42781, 42806, 42813, 42821, 42841, 42860, 42866, 42885,
+    42896, 42906, 42913, 42920, 42936, 42940, 42947, 42969,
+    42976, 42992, 43010, 43018, 43031, 43046, 43052, 43072,
+    43088, 43102, 43109, 43128, 43149, 43162, 43173, 43190,
+    43198, 43204, 43212, 43224, 43243, 43253, 43272, 43291,
+    43300, 43316, 43330, 43348, 43355, 43363, 43382, 43398,
+    43421, 43435, 43444, 43447, 43454, 43461, 43468, 43475,
+    43494, 43514, 43527, 43554, 43567, 43576, 43579, 43586,
+    43637, 43654, 43670, 43676, 43700, 43711, 43718, 43725,
+    43731, 43746, 43763, 43781, 43792, 43799, 43810, 43836,
+    43848, 43864, 43875, 43878, 43886, 43896, 43910, 43916,
+    43953, 43959, 43971, 43983, 43988, 44010, 44028, 44043,
+    44067, 44084, 44094, 44114, 44122, 44129, 44146, 44164,
+    44188, 44223, 44236, 44248, 44268, 44275, 44279, 44287,
+    44301, 44316, 44328, 44344, 44351, 44360, 44370, 44382,
+    44395, 44411, 44418, 44428, 44437, 44444, 44454, 44469,
+    44493, 44506, 44529, 44534, 44540, 44550, 44569, 44576,
+    44601, 44617, 44627, 44636, 44649, 44659, 44675, 44699,
+    44718, 44722, 44728, 44740, 44772, 44777, 44790, 44809,
+    44817, 44828, 44835, 44842, 44852, 44888, 44894, 44897,
+    44929, 44938, 44952, 44972, 44982, 44989, 44997, 45017,
+    45036, 45047, 45064, 45072, 45076, 45084, 45094, 45101,
+    45111, 45129, 45144, 45154, 45163, 45167, 45183, 45189,
+    45196, 45214, 45220, 45234, 45251, 45260, 45271, 45279,
+    45291, 45312, 45327, 45348, 45352, 45359, 45377, 45393,
+    45413, 45428, 45435, 45442, 45457, 45461, 45468, 45477,
+    45482, 45489, 45504, 45520, 45527, 45536, 45542, 45549,
+    45562, 45566, 45583, 45593, 45602, 45612, 45619, 45622,
+    45630, 45650, 45665, 45669, 45685, 45696, 45703, 45712,
+    45736, 45747, 45764, 45778, 45792, 45803, 45809, 45826,
+    45833, 45836, 45859, 45874, 45881, 45921, 45928, 45937,
+    45974, 45994, 46004, 46020, 46027, 46043, 46055, 46059,
+    46075, 46098, 46114, 46121, 46128, 46134, 46146, 46153,
+    46173, 46198, 46207, 46216, 46234, 46241, 46248, 46251,
+    46272, 46279, 46283, 46302, 46312, 46322, 46329, 46346,
+    46353, 46364, 46384, 46401, 46416, 46423, 46443, 46464,
+    46481, 46495, 46513, 46533, 46542, 46549, 46556, 46563,
+    46578, 46592, 46610, 46616, 46630, 46641, 46653, 46673,
+    46682, 46687, 46693, 46704, 46716, 46726, 46742, 46758,
+    46767, 46786, 46799, 46810, 46827, 46834, 46852, 46862,
+    46883, 46904, 46916, 46932, 46948, 46953, 46969, 46982,
+    47009, 47013, 47017, 47024, 47031, 47052, 47064, 47079,
+    47097, 47103, 47110, 47125, 47134, 47142, 47154, 47163,
+    47175, 47209, 47220, 47234, 47252, 47259, 47266, 47274,
+    47286, 47294, 47301, 47320, 47333, 47345, 47352, 47372,
+    47389, 47406, 47422, 47443, 47452, 47463, 47470, 47476,
+    47491, 47500, 47511, 47524, 47531, 47541, 47552, 47558,
+    47576, 47598, 47610, 47623, 47633, 47647, 47653, 47663,
+    47669, 47689, 47704, 47709, 47717, 47730, 47736, 47746,
+    47762, 47778, 47796, 47813, 47816, 47831, 47838, 47855,
+    47858, 47867, 47881, 47887, 47898, 47902, 47923, 47930,
+    47945, 47960, 47979, 47984, 48004, 48014, 48024, 48034,
+    48041, 48061, 48073, 48090, 48100, 48115, 48120, 48130,
+    48147, 48168, 48178, 48183, 48188, 48216, 48238, 48248,
+    48265, 48284, 48295, 48320, 48327, 48340, 48346, 48351,
+    48359, 48366, 48369, 48374, 48387, 48394, 48413, 48416,
+    48433, 48449, 48456, 48474, 48481, 48488, 48501, 48517,
+    48524, 48533, 48540, 48547, 48559, 48579, 48590, 48613,
+    48617, 48646, 48659, 48679, 48696, 48712, 48733, 48746,
+    48766, 48777, 48780, 48787, 48797, 48805, 48811, 48820,
+    48828, 48831, 48839, 48862, 48869, 48890, 48894, 48914,
+    48921, 48929, 48948, 48955, 48976, 48998, 49005, 49018,
+    49029, 49035, 49050, 49067, 49077, 49099, 49154, 49161,
+    49173, 49193, 49200, 49209, 49215, 49257, 49270, 49275,
+    49280, 49301, 49307, 49323, 49337, 49354, 49359, 49380,
+    49386, 49398, 49405, 49413, 49419, 49432, 49452, 49459,
+    49487, 49497, 49515, 49521, 49524, 49539, 49557, 49564,
+    49580, 49598, 49610, 49617, 49630, 49634, 49640, 49647,
+    49667, 49685, 49702, 49714, 49731, 49740, 49747, 49762,
+    49771, 49778, 49794, 49804, 49809, 49816, 49834, 49843,
+    49856, 49866, 49877, 49895, 49906, 49916, 49933, 49943,
+    49954, 49958, 49962, 49969, 49977, 49988, 49995, 50014,
+    50035, 50056, 50063, 50082, 50096, 50111, 50130, 50150,
+    50158, 50177, 50188, 50198, 50201, 50207, 50227, 50237,
+    50244, 50256, 50273, 50280, 50291, 50307, 50328, 50347,
+    50353, 50371, 50388, 50408, 50415, 50435, 50442, 50448,
+    50463, 50473, 50482, 50496, 50500, 50542, 50554, 50573,
+    50580, 50589, 50601, 50619, 50629, 50644, 50649, 50668,
+    50682, 50701, 50709, 50719, 50725, 50747, 50758, 50765,
+    50772, 50784, 50801, 50808, 50823, 50843, 50847, 50859,
+    50868, 50883, 50897, 50904, 50911, 50920, 50935, 50950,
+    50954, 50962, 50977, 50995, 50999, 51006, 51013, 51020,
+    51029, 51044, 51053, 51058, 51064, 51073, 51077, 51085,
+    51092, 51102, 51122, 51128, 51138, 51164, 51170, 51175,
+    51183, 51201, 51208, 51215, 51221, 51242, 51263, 51273,
+    51283, 51290, 51297, 51321, 51328, 51334, 51344, 51360,
+    51368, 51379, 51388, 51399, 51412, 51418, 51431, 51435,
+    51452, 51473, 51478, 51485, 51491, 51506, 51510, 51524,
+    51528, 51534, 51542, 51551, 51555, 51569, 51576, 51586,
+    51601, 51619, 51634, 51639, 51645, 51677, 51684, 51696,
+    51709, 51723, 51742, 51760, 51767, 51778, 51783, 51796,
+    51812, 51865, 51878, 51895, 51902, 51908, 51917, 51931,
+    51940, 51955, 51978, 51991, 52006, 52016, 52023, 52031,
+    52038, 52045, 52058, 52064, 52070, 52084, 52093, 52105,
+    52116, 52123, 52142, 52153, 52167, 52173, 52188, 52191,
+    52198, 52211, 52216, 52223, 52236, 52246, 52263, 52285,
+    52296, 52312, 52322, 52342, 52349, 52371, 52378, 52386,
+    52405, 52415, 52421, 52440, 52453, 52460, 52506, 52515,
+    52532, 52548, 52554, 52562, 52580, 52596, 52605, 52614,
+    52627, 52643, 52656, 52677, 52697, 52709, 52717, 52733,
+    52747, 52766, 52772, 52799, 52814, 52829, 52843, 52851,
+    52867, 52875, 52891, 52916, 52928, 52935, 52942, 52963,
+    52974, 52987, 53005, 53016, 53020, 53041, 53053, 53059,
+    53069, 53082, 53102, 53115, 53125, 53142, 53152, 53169,
+    53175, 53186, 53195, 53235, 53252, 53268, 53283, 53286,
+    53293, 53300, 53311, 53323, 53332, 53344, 53351, 53358,
+    53364, 53382, 53429, 53436, 53457, 53464, 53474, 53480,
+    53496, 53506, 53509, 53526, 53536, 53541, 53559, 53575,
+    53583, 53594, 53606, 53616, 53626, 53642, 53655, 53661,
+    53673, 53680, 53689, 53708, 53715, 53724, 53731, 53744,
+    53755, 53768, 53778, 53788, 53794, 53809, 53827, 53836,
+    53856, 53867, 53880, 53886, 53892, 53910, 53918, 53924,
+    53939, 53948, 53970, 53986, 54006, 54023, 54036, 54042,
+    54050, 54056, 54060, 54069, 54076, 54091, 54109, 54123,
+    54130, 54146, 54155, 54173, 54181, 54186, 54191, 54198,
+    54212, 54218, 54221, 54229, 54236, 54257, 54264, 54282,
+    54300, 54317, 54324, 54331, 54340, 54349, 54356, 54375,
+    54379, 54386, 54403, 54450, 54459, 54476, 54496, 54506,
+    54512, 54517, 54527, 54548, 54566, 54577, 54580, 54586,
+    54599, 54612, 54627, 54639, 54649, 54661, 54668, 54681,
+    54692, 54706, 54713, 54720, 54727, 54733, 54744, 54754,
+    54764, 54777, 54784, 54805, 54812, 54819, 54835, 54844,
+    54884, 54890, 54893, 54904, 54910, 54919, 54934, 54941,
+    54952, 54968, 54983, 54996, 55013, 55020, 55030, 55039,
+    55052, 55058, 55072, 55092, 55098, 55105, 55115, 55125,
+    55138, 55154, 55163, 55166, 55183, 55187, 55192, 55203,
+    55222, 55228, 55235, 55255, 55272, 55282, 55288, 55306,
+    55313, 55317, 55335, 55350, 55357, 55388, 55409, 55422,
+    55428, 55443, 55449, 55465, 55477, 55483, 55499, 55507,
+    55523, 55542, 55562, 55567, 55583, 55618, 55640, 55662,
+    55670, 55678, 55692, 55698, 55724, 55732, 55738, 55754,
+    55767, 55782, 55798, 55801, 55811, 55822, 55839, 55849,
+    55866, 55894, 55906, 55916, 55925, 55931, 55946, 55949,
+    55956, 55965, 55977, 55996, 56003, 56010, 56013, 56049,
+    56061, 56071, 56079, 56093, 56102, 56113, 56119, 56125,
+    56136, 56140, 56152, 56171, 56177, 56183, 56199, 56213,
+    56230, 56245, 56267, 56273, 56286, 56297, 56319, 56348,
+    56356, 56362, 56372, 56386, 56397, 56403, 56409, 56423,
+    56429, 56442, 56456, 56491, 56498, 56505, 56512, 56522,
+    56528, 56540, 56554, 56561, 56570, 56576, 56585, 56590,
+    56605, 56613, 56625, 56628, 56639, 56652, 56659, 56678,
+    56690, 56711, 56720, 56735, 56741, 56764, 56776, 56786,
+    56802, 56812, 56826, 56838, 56853, 56860, 56866, 56877,
+    56891, 56908, 56922, 56933, 56939, 56946, 56952, 56969,
+    56976, 56981, 57003, 57011, 57021, 57033, 57050, 57059,
+    57066, 57076, 57094, 57112, 57130, 57146, 57162, 57175,
+    57191, 57216, 57225, 57231, 57248, 57272, 57287, 57295,
+    57305, 57317, 57323, 57330, 57346, 57365, 57387, 57394,
+    57401, 57420, 57442, 57445, 57452, 57461, 57472, 57479,
+    57485, 57493, 57519, 57528, 57541, 57553, 57557, 57568,
+    57580, 57587, 57594, 57630, 57655, 57674, 57691, 57698,
+    57703, 57710, 57717, 57728, 57748, 57751, 57759, 57772,
+    57796, 57804, 57818, 57824, 57832, 57835, 57841, 57878,
+    57890, 57910, 57927, 57934, 57959, 57966, 57974, 57986,
+    58000, 58017, 58022, 58041, 58051, 58064, 58071, 58078,
+    58089, 58100, 58108, 58114, 58129, 58148, 58159, 58175,
+    58180, 58191, 58198, 58209, 58220, 58239, 58250, 58267,
+    58286, 58292, 58298, 58308, 58313, 58323, 58330, 58337,
+    58355, 58370, 58391, 58408, 58430, 58433, 58439, 58446,
+    58458, 58469, 58492, 58513, 58525, 58531, 58538, 58552,
+    58557, 58564, 58592, 58599, 58614, 58621, 58629, 58647,
+    58652, 58659, 58669, 58683, 58696, 58705, 58722, 58728,
+    58742, 58756, 58773, 58782, 58799, 58811, 58828, 58838,
+    58847, 58854, 58861, 58868, 58888, 58899, 58906, 58919,
+    58938, 58957, 58962, 58970, 58980, 58988, 58995, 59011,
+    59031, 59040, 59051, 59063, 59079, 59086, 59100, 59114,
+    59124, 59128, 59138, 59148, 59155, 59165, 59172, 59188,
+    59200, 59203, 59218, 59231, 59243, 59259, 59278, 59290,
+    59297, 59318, 59330, 59342, 59350, 59370, 59384, 59390,
+    59398, 59405, 59418, 59424, 59442, 59446, 59452, 59463,
+    59480, 59485, 59493, 59499, 59510, 59519, 59530, 59539,
+    59552, 59570, 59574, 59580, 59588, 59598, 59604, 59608,
+    59626, 59631, 59641, 59659, 59665, 59676, 59688, 59703,
+    59718, 59737, 59756, 59776, 59812, 59821, 59841, 59847,
+    59872, 59889, 59899, 59907, 59917, 59933, 59955, 59963,
+    59989, 60008, 60014, 60025, 60037, 60050, 60062, 60067,
+    60088, 60095, 60107, 60126, 60143, 60156, 60162, 60169,
+    60177, 60191, 60198, 60205, 60224, 60248, 60255, 60270,
+    60284, 60296, 60303, 60322, 60332, 60341, 60351, 60363,
+    60375, 60397, 60406, 60422, 60426, 60432, 60439, 60455,
+    60468, 60475, 60483, 60494, 60508, 60526, 60535, 60547,
+    60564, 60580, 60587, 60606, 60612, 60632, 60639, 60646,
+    60654, 60663, 60670, 60679, 60696, 60702, 60708, 60722,
+    60731, 60738, 60750, 60772, 60781, 60790, 60805, 60808,
+    60814, 60820, 60831, 60835, 60846, 60864, 60881, 60888,
+    60895, 60914, 60927, 60934, 60953, 60960, 60974, 60990,
+    60996, 61019, 61031, 61048, 61058, 61066, 61084, 61088,
+    61104, 61123, 61135, 61154, 61165, 61170, 61179, 61190,
+    61202, 61208, 61215, 61225, 61245, 61265, 61276, 61282,
+    61297, 61314, 61321, 61328, 61338, 61341, 61348, 61367,
+    61372, 61393, 61399, 61406, 61422, 61429, 61432, 61442,
+    61463, 61482, 61488, 61494, 61519, 61526, 61544, 61552,
+    61560, 61567, 61574, 61588, 61603, 61618, 61631, 61642,
+    61651, 61673, 61686, 61693, 61704, 61712, 61730, 61750,
+    61759, 61764, 61774, 61787, 61805, 61817, 61830, 61844,
+    61866, 61873, 61891, 61895, 61905, 61913, 61920, 61932,
+    61944, 61960, 61967, 61985, 61991, 62000, 62011, 62029,
+    62075, 62099, 62109, 62119, 62130, 62143, 62154, 62174,
+    62190, 62197, 62216, 62226, 62234, 62245, 62255, 62268,
+    62271, 62281, 62290, 62296, 62310, 62326, 62341, 62356,
+    62375, 62382, 62390, 62398, 62413, 62419, 62433, 62437,
+    62444, 62448, 62461, 62477, 62485, 62497, 62514, 62521,
+    62552, 62559, 62576, 62590, 62593, 62607, 62612, 62634,
+    62639, 62642, 62661, 62664, 62673, 62695, 62714, 62725,
+    62736, 62758, 62770, 62777, 62794, 62806, 62825, 62836,
+    62854, 62861, 62869, 62881, 62902, 62908, 62913, 62923,
+    62932, 62939, 62951, 62974, 62982, 63001, 63013, 63016,
+    63039, 63058, 63061, 63064, 63073, 63086, 63096, 63109,
+    63116, 63133, 63141, 63160, 63173, 63185, 63197, 63208,
+    63217, 63227, 63234, 63241, 63260, 63269, 63285, 63304,
+    63318, 63328, 63335, 63354, 63374, 63407, 63414, 63432,
+    63448, 63455, 63476, 63493, 63512, 63530, 63542, 63560,
+    63583, 63594, 63598, 63608, 63624, 63631, 63645, 63656,
+    63703, 63729, 63750, 63760, 63782, 63788, 63793, 63800,
+    63815, 63822, 63836, 63858, 63864, 63881, 63897, 63904,
+    63930, 63941, 63950, 63963, 63970, 63976, 64026, 64032,
+    64042, 64052, 64065, 64079, 64090, 64093, 64113, 64120,
+    64127, 64142, 64151, 64159, 64170, 64180, 64184, 64189,
+    64216, 64252, 64260, 64295, 64306, 64310, 64319, 64329,
+    64339, 64354, 64372, 64385, 64404, 64418, 64431, 64443,
+    64455, 64464, 64499, 64506, 64513, 64522, 64543, 64554,
+    64563, 64573, 64583, 64603, 64618, 64632, 64645, 64667,
+    64680, 64686, 64690, 64702, 64709, 64725, 64735, 64752,
+    64758, 64774, 64781, 64805, 64815, 64829, 64847, 64860,
+    64867, 64880, 64888, 64891, 64898, 64907, 64924, 64938,
+    64955, 64967, 64985, 64997, 65003, 65010, 65019, 65024,
+    65036, 65045, 65054, 65066, 65072, 65087, 65100, 65110,
+    65117, 65124, 65140, 65151, 65155, 65162, 65174, 65181,
+    65197, 65202, 65216, 65222, 65273, 65309, 65319, 65326,
+    65329, 65339, 65351, 65363, 65374, 65397, 65406, 65422,
+    65427, 65437, 65452, 65458, 65472, 65510, 65529, 65548,
+    65559, 65566, 65579, 65592, 65601, 65614, 65621, 65628,
+    65635, 65639, 65657, 65670, 65687, 65708, 65718, 65725,
+    65740, 65752, 65758, 65773, 65792, 65799, 65811, 65829,
+    65834, 65859, 65878, 65888, 65899, 65912, 65916, 65921,
+    65927, 65945, 65949, 65964, 65987, 66003, 66013, 66018,
+    66028, 66034, 66039, 66059, 66071, 66074, 66081, 66090,
+    66102, 66111, 66117, 66138, 66155, 66165, 66180, 66189,
+    66197, 66212, 66217, 66233, 66240, 66248, 66269, 66277,
+    66291, 66308, 66316, 66338, 66356, 66370, 66376, 66388,
+    66404, 66430, 66434, 66450, 66455, 66462, 66469, 66481,
+    66502, 66512, 66537, 66549, 66560, 66567, 66575, 66593,
+    66615, 66628, 66639, 66651, 66668, 66675, 66681, 66687,
+    66698, 66713, 66722, 66750, 66756, 66759, 66778, 66796,
+    66816, 66826, 66833, 66855, 66879, 66882, 66891, 66899,
+    66904, 66927, 66934, 66963, 66974, 66981, 66996, 67004,
+    67023, 67033, 67047, 67052, 67072, 67080, 67085, 67100,
+    67111, 67130, 67154, 67160, 67169, 67189, 67195, 67214,
+    67222, 67241, 67248, 67254, 67270, 67275, 67285, 67291,
+    67299, 67320, 67335, 67346, 67359, 67376, 67387, 67393,
+    67410, 67413, 67433, 67441, 67463, 67499, 67518, 67530,
+    67545, 67552, 67564, 67579, 67590, 67597, 67604, 67621,
+    67632, 67635, 67648, 67657, 67669, 67691, 67699, 67702,
+    67714, 67735, 67743, 67750, 67757, 67763, 67779, 67791,
+    67798, 67802, 67817, 67836, 67848, 67855, 67866, 67873,
+    67886, 67901, 67920, 67932, 67937, 67944, 67968, 67979,
+    67992, 67998, 68006, 68016, 68024, 68027, 68037, 68046,
+    68062, 68073, 68085, 68108, 68118, 68134, 68144, 68153,
+    68157, 68172, 68185, 68191, 68223, 68228, 68242, 68249,
+    68259, 68267, 68281, 68286, 68293, 68305, 68313, 68322,
+    68329, 68339, 68347, 68365, 68375, 68425, 68431, 68441,
+    68459, 68469, 68475, 68503, 68515, 68528, 68543, 68559,
+    68575, 68582, 68589, 68599, 68606, 68624, 68637, 68647,
+    68657, 68676, 68683, 68690, 68696, 68699, 68711, 68722,
+    68733, 68738, 68753, 68759, 68772, 68780, 68787, 68802,
+    68822, 68836, 68853, 68860, 68870, 68885, 68896, 68902,
+    68909, 68916, 68920, 68926, 68943, 68949, 68953, 68966,
+    68973, 68995, 69010, 69024, 69043, 69049, 69056, 69063,
+    69078, 69085, 69097, 69103, 69112, 69117, 69136, 69148,
+    69156, 69170, 69176, 69182, 69187, 69204, 69224, 69249,
+    69256, 69263, 69284, 69291, 69301, 69307, 69320, 69327,
+    69336, 69339, 69359, 69377, 69388, 69397, 69407, 69442,
+    69460, 69469, 69478, 69486, 69499, 69509, 69517, 69542,
+    69548, 69556, 69563, 69573, 69580, 69587, 69602, 69615,
+    69622, 69639, 69644, 69664, 69674, 69684, 69693, 69702,
+    69711, 69721, 69733, 69744, 69764, 69770, 69776, 69790,
+    69797, 69803, 69809, 69813, 69827, 69840, 69844, 69851,
+    69854, 69875, 69882, 69889, 69896, 69907, 69914, 69924,
+    69941, 69944, 69962, 69965, 69988, 69997, 70003, 70011,
+    70022, 70042, 70053, 70062, 70069, 70076, 70083, 70104,
+    70121, 70139, 70154, 70170, 70176, 70193, 70211, 70214,
+    70225, 70238, 70251, 70258, 70268, 70282, 70289, 70299,
+    70306, 70316, 70325, 70343, 70360, 70376, 70383, 70392,
+    70412, 70415, 70418, 70421, 70430, 70452, 70459, 70470,
+    70491, 70499, 70513, 70520, 70537, 70541, 70553, 70561,
+    70572, 70578, 70590, 70600, 70611, 70617, 70639, 70651,
+    70678, 70690, 70707, 70724, 70733, 70745, 70752, 70759,
+    70766, 70775, 70795, 70802, 70822, 70828, 70846, 70856,
+    70866, 70884, 70904, 70910, 70914, 70924, 70931, 70937,
+    70946, 70958, 70965, 70981, 70992, 70998, 71005, 71011,
+    71029, 71034, 71042, 71054, 71064, 71080, 71098, 71102,
+    71111, 71118, 71128, 71133, 71140, 71146, 71152, 71159,
+    71166, 71174, 71183, 71195, 71214, 71236, 71251, 71259,
+    71277, 71292, 71297, 71315, 71322, 71342, 71347, 71357,
+    71363, 71373, 71385, 71397, 71409, 71416, 71429, 71450,
+    71463, 71481, 71494, 71510, 71521, 71528, 71535, 71557,
+    71563, 71579, 71595, 71608, 71626, 71640, 71652, 71667,
+    71687, 71690, 71697, 71714, 71719, 71729, 71733, 71741,
+    71749, 71756, 71763, 71770, 71777, 71787, 71794, 71816,
+    71821, 71839, 71846, 71858, 71863, 71873, 71893, 71910,
+    71924, 71930, 71937, 71943, 71961, 71968, 71972, 71981,
+    71991, 72005, 72024, 72037, 72047, 72060, 72077, 72087,
+    72097, 72117, 72125, 72144, 72161, 72168, 72173, 72191,
+    72200, 72214, 72221, 72228, 72238, 72249, 72255, 72266,
+    72273, 72280, 72290, 72306, 72313, 72324, 72345, 72356,
+    72369, 72372, 72377, 72412, 72419, 72439, 72451, 72457,
+    72464, 72475, 72488, 72509, 72530, 72552, 72565, 72584,
+    72589, 72608, 72620, 72626, 72636, 72641, 72662, 72674,
+    72683, 72700, 72735, 72742, 72746, 72759, 72769, 72791,
+    72794, 72808, 72819, 72826, 72843, 72850, 72860, 72867,
+    72881, 72892, 72913, 72921, 72924, 72933, 72945, 72956,
+    72961, 72970, 72986, 72995, 73002, 73021, 73031, 73043,
+    73054, 73058, 73067, 73085, 73095, 73101, 73117, 73134,
+    73144, 73160, 73182, 73189, 73204, 73213, 73232, 73245,
+    73266, 73279, 73289, 73305, 73310, 73324, 73340, 73345,
+    73354, 73383, 73395, 73402, 73422, 73435, 73446, 73459,
+    73478, 73492, 73501, 73508, 73521, 73527, 73531, 73538,
+    73550, 73557, 73572, 73575, 73586, 73593, 73599, 73612,
+    73619, 73632, 73642, 73661, 73668, 73672, 73691, 73708,
+    73714, 73726, 73733, 73740, 73748, 73761, 73768, 73778,
+    73798, 73808, 73826, 73844, 73854, 73872, 73878, 73885,
+    73904, 73925, 73940, 73954, 73966, 73976, 73983, 73989,
+    74007, 74014, 74021, 74027, 74037, 74050, 74088, 74095,
+    74109, 74117, 74132, 74139, 74145, 74156, 74164, 74176,
+    74182, 74191, 74199, 74206, 74216, 74219, 74227, 74233,
+    74240, 74251, 74258, 74271, 74275, 74282, 74290, 74297,
+    74306, 74313, 74323, 74330, 74337, 74358, 74366, 74376,
+    74394, 74405, 74412, 74422, 74431, 74447, 74457, 74464,
+    74484, 74497, 74504, 74511, 74515, 74521, 74530, 74544,
+    74554, 74570, 74586, 74598, 74644, 74655, 74665, 74677,
+    74683, 74690, 74706, 74720, 74737, 74740, 74748, 74760,
+    74768, 74774, 74792, 74799, 74820, 74833, 74846, 74860,
+    74868, 74885, 74895, 74902, 74916, 74930, 74937, 74941,
+    74947, 74956, 74974, 74992, 75003, 75021, 75040, 75049,
+    75059, 75069, 75079, 75084, 75107, 75114, 75130, 75136,
+    75143, 75165, 75172, 75186, 75207, 75228, 75240, 75256,
+    75274, 75281, 75290, 75300, 75320, 75326, 75337, 75365,
+    75377, 75384, 75395, 75404, 75417, 75434, 75445, 75463,
+    75470, 75480, 75492, 75500, 75523, 75533, 75540, 75550,
+    75557, 75563, 75569, 75581, 75593, 75606, 75611, 75630,
+    75637, 75646, 75655, 75673, 75680, 75687, 75690, 75702,
+    75730, 75739, 75746, 75762, 75776, 75795, 75808, 75815,
+    75829, 75838, 75849, 75862, 75880, 75898, 75911, 75921,
+    75933, 75940, 75947, 75953, 75967, 75981, 75990, 76010,
+    76030, 76051, 76058, 76065, 76076, 76090, 76101, 76111,
+    76117, 76124, 76140, 76156, 76174, 76181, 76196, 76202,
+    76218, 76240, 76247, 76253, 76260, 76271, 76283, 76300,
+    76307, 76313, 76322, 76328, 76339, 76346, 76352, 76360,
+    76367, 76372, 76379, 76389, 76405, 76415, 76426, 76439,
+    76445, 76462, 76470, 76476, 76486, 76496, 76500, 76518,
+    76528, 76533, 76569, 76581, 76600, 76621, 76647, 76657,
+    76671, 76690, 76701, 76717, 76730, 76741, 76750, 76755,
+    76768, 76775, 76782, 76789, 76796, 76801, 76805, 76809,
+    76823, 76839, 76850, 76854, 76873, 76880, 76884, 76892,
+    76898, 76903, 76919, 76926, 76931, 76941, 76959, 76973,
+    76990, 76997, 77007, 77028, 77042, 77052, 77059, 77074,
+    77081, 77088, 77097, 77113, 77123, 77128, 77145, 77151,
+    77176, 77183, 77190, 77200, 77212, 77231, 77241, 77249,
+    77256, 77275, 77299, 77311, 77320, 77330, 77345, 77352,
+    77370, 77388, 77401, 77417, 77427, 77446, 77452, 77459,
+    77470, 77475, 77483, 77491, 77503, 77513, 77525, 77536,
+    77557, 77575, 77582, 77597, 77603, 77610, 77619, 77631,
+    77639, 77666, 77678, 77691, 77707, 77720, 77735, 77745,
+    77756, 77762, 77768, 77782, 77789, 77814, 77833, 77844,
+    77855, 77862, 77874, 77883, 77890, 77900, 77921, 77929,
+    77957, 77975, 77996, 78001, 78015, 78026, 78035, 78040,
+    78043, 78052, 78059, 78069, 78085, 78094, 78144, 78161,
+    78167, 78178, 78190, 78230, 78240, 78253, 78259, 78267,
+    78275, 78282, 78290, 78313, 78325, 78341, 78354, 78365,
+    78371, 78378, 78395, 78400, 78410, 78423, 78438, 78447,
+    78453, 78466, 78482, 78495, 78517, 78533, 78539, 78560,
+    78579, 78594, 78601, 78609, 78617, 78630, 78647, 78650,
+    78671, 78679, 78685, 78691, 78702, 78707, 78717, 78726,
+    78733, 78749, 78763, 78772, 78782, 78794, 78805, 78821,
+    78842, 78849, 78855, 78863, 78870, 78887, 78891, 78909,
+    78916, 78931, 78949, 78956, 78959, 78969, 78976, 78987,
+    79003, 79019, 79024, 79030, 79037, 79047, 79057, 79063,
+    79072, 79084, 79106, 79109, 79119, 79141, 79152, 79156,
+    79165, 79180, 79186, 79199, 79211, 79221, 79239, 79252,
+    79263, 79270, 79277, 79297, 79304, 79318, 79333, 79340,
+    79347, 79355, 79373, 79379, 79386, 79393, 79412, 79419,
+    79422, 79436, 79487, 79502, 79516, 79523, 79530, 79550,
+    79564, 79569, 79581, 79593, 79597, 79614, 79628, 79637,
+    79649, 79655, 79665, 79685, 79692, 79702, 79715, 79722,
+    79733, 79752, 79771, 79776, 79783, 79791, 79798, 79805,
+    79822, 79832, 79841, 79849, 79855, 79865, 79874, 79888,
+    79894, 79913, 79920, 79930, 79940, 79951, 79966, 79972,
+    79983, 79995, 80013, 80042, 80051, 80063, 80066, 80078,
+    80089, 80097, 80109, 80129, 80147, 80163, 80184, 80200,
+    80219, 80242, 80261, 80268, 80285, 80303, 80310, 80317,
+    80334, 80349, 80364, 80394, 80406, 80412, 80424, 80427,
+    80432, 80439, 80462, 80472, 80477, 80484, 80492, 80510,
+    80517, 80535, 80549, 80553, 80560, 80569, 80588, 80597,
+    80600, 80610, 80627, 80645, 80663, 80683, 80693, 80702,
+    80713, 80729, 80748, 80768, 80771, 80781, 80794, 80818,
+    80830, 80840, 80852, 80858, 80865, 80878, 80891, 80906,
+    80913, 80924, 80934, 80938, 80953, 80965, 80973, 80982,
+    80987, 80998, 81008, 81015, 81031, 81038, 81057, 81070,
+    81087, 81109, 81125, 81132, 81145, 81152, 81173, 81180,
+    81193, 81202, 81210, 81221, 81229, 81238, 81247, 81267,
+    81274, 81293, 81300, 81316, 81329, 81344, 81354, 81377,
+    81387, 81398, 81408, 81416, 81424, 81428, 81434, 81457,
+    81476, 81490, 81497, 81510, 81521, 81541, 81554, 81568,
+    81573, 81586, 81596, 81603, 81609, 81615, 81620, 81626,
+    81629, 81666, 81676, 81689, 81705, 81712, 81733, 81743,
+    81753, 81762, 81769, 81772, 81788, 81802, 81814, 81820,
+    81830, 81836, 81853, 81859, 81866, 81869, 81874, 81886,
+    81900, 81940, 81947, 81957, 81980, 81987, 82000, 82010,
+    82021, 82032, 82038, 82048, 82055, 82071, 82091, 82096,
+    82109, 82121, 82129, 82146, 82171, 82174, 82181, 82185,
+    82210, 82220, 82237, 82252, 82260, 82276, 82293, 82311,
+    82329, 82336, 82343, 82350, 82353, 82404, 82414, 82433,
+    82441, 82453, 82459, 82465, 82472, 82490, 82496, 82513,
+    82524, 82545, 82562, 82577, 82586, 82593, 82606, 82615,
+    82622, 82640, 82651, 82660, 82672, 82680, 82692, 82699,
+    82706, 82725, 82732, 82741, 82764, 82785, 82805, 82812,
+    82822, 82835, 82847, 82850, 82865, 82885, 82898, 82906,
+    82918, 82933, 82949, 82959, 82966, 82974, 82981, 82988,
+    82995, 83002, 83015, 83025, 83071, 83081, 83100, 83115,
+    83127, 83145, 83153, 83160, 83170, 83182, 83191, 83194,
+    83217, 83229, 83245, 83262, 83278, 83284, 83294, 83300,
+    83307, 83315, 83326, 83333, 83344, 83354, 83375, 83391,
+    83405, 83415, 83421, 83427, 83450, 83460, 83472, 83483,
+    83499, 83512, 83524, 83533, 83539, 83548, 83565, 83572,
+    83583, 83599, 83605, 83625, 83632, 83641, 83660, 83673,
+    83695, 83705, 83712, 83719, 83726, 83743, 83750, 83756,
+    83767, 83773, 83778, 83787, 83805, 83822, 83842, 83859,
+    83867, 83873, 83894, 83907, 83914, 83921, 83933, 83950,
+    83975, 83978, 83985, 83991, 84009, 84016, 84030, 84047,
+    84062, 84073, 84091, 84103, 84113, 84122, 84134, 84144,
+    84158, 84161, 84172, 84178, 84190, 84200, 84210, 84221,
+    84237, 84247, 84265, 84272, 84288, 84305, 84328, 84336,
+    84347, 84357, 84391, 84398, 84408, 84420, 84427, 84431,
+    84442, 84464, 84515, 84531, 84543, 84550, 84571, 84583,
+    84602, 84614, 84632, 84638, 84669, 84676, 84689, 84712,
+    84727, 84734, 84751, 84760, 84767, 84778, 84785, 84810,
+    84816, 84840, 84846, 84850, 84860, 84868, 84871, 84877,
+    84884, 84904, 84919, 84926, 84933, 84950, 84965, 84992,
+    85004, 85026, 85040, 85047, 85063, 85080, 85086, 85094,
+    85103, 85110, 85124, 85130, 85150, 85160, 85172, 85177,
+    85189, 85201, 85216, 85223, 85240, 85251, 85269, 85273,
+    85280, 85303, 85310, 85313, 85331, 85338, 85347, 85352,
+    85369, 85374, 85385, 85406, 85415, 85427, 85436, 85452,
+    85459, 85469, 85476, 85494, 85512, 85530, 85547, 85565,
+    85576, 85582, 85594, 85606, 85610, 85623, 85629, 85638,
+    85648, 85658, 85676, 85682, 85697, 85704, 85711, 85722,
+    85736, 85754, 85766, 85779, 85798, 85803, 85830, 85848,
+    85852, 85859, 85874, 85887, 85893, 85900, 85919, 85929,
+    85937, 85944, 85958, 85968, 85981, 85992, 85999, 86007,
+    86014, 86035, 86042, 86052, 86059, 86073, 86076, 86083,
+    86091, 86108, 86118, 86128, 86144, 86154, 86177, 86189,
+    86206, 86212, 86224, 86227, 86230, 86237, 86254, 86268,
+    86280, 86287, 86297, 86304, 86316, 86327, 86333, 86343,
+    86349, 86359, 86378, 86393, 86408, 86422, 86435, 86455,
+    86461, 86481, 86496, 86507, 86514, 86533, 86540, 86560,
+    86578, 86586, 86592, 86596, 86610, 86616, 86632, 86648,
+    86654, 86664, 86682, 86688, 86695, 86702, 86720, 86727,
+    86748, 86757, 86763, 86773, 86799, 86809, 86829, 86848,
+    86865, 86883, 86911, 86923, 86930, 86942, 86949, 86963,
+    86989, 87007, 87014, 87021, 87031, 87038, 87046, 87052,
+    87059, 87066, 87069, 87079, 87089, 87101, 87114, 87124,
+    87137, 87144, 87156, 87172, 87180, 87184, 87194, 87208,
+    87220, 87239, 87246, 87256, 87270, 87277, 87285, 87301,
+    87315, 87324, 87330, 87342, 87348, 87364, 87370, 87377,
+    87389, 87396, 87412, 87417, 87423, 87433, 87444, 87467,
+    87476, 87482, 87489, 87496, 87503, 87518, 87525, 87541,
+    87546, 87562, 87572, 87575, 87596, 87610, 87626, 87643,
+    87650, 87660, 87667, 87675, 87682, 87688, 87698, 87717,
+    87726, 87735, 87747, 87756, 87781, 87799, 87805, 87812,
+    87819, 87827, 87842, 87849, 87873, 87882, 87887, 87903,
+    87910, 87922, 87934, 87951, 87959, 87978, 87993, 88001,
+    88006, 88026, 88036, 88042, 88061, 88064, 88081, 88091,
+    88097, 88106, 88113, 88120, 88141, 88157, 88177, 88188,
+    88195, 88201, 88210, 88226, 88236, 88245, 88261, 88280,
+    88283, 88290, 88297, 88308, 88327, 88337, 88350, 88369,
+    88375, 88381, 88397, 88403, 88413, 88420, 88436, 88444,
+    88455, 88474, 88490, 88499, 88506, 88513, 88525, 88546,
+    88559, 88567, 88588, 88600, 88608, 88614, 88621, 88631,
+    88639, 88662, 88670, 88679, 88691, 88702, 88713, 88728,
+    88731, 88737, 88743, 88750, 88757, 88764, 88769, 88781,
+    88787, 88795, 88802, 88815, 88822, 88833, 88840, 88856,
+    88863, 88870, 88873, 88882, 88892, 88896, 88904, 88910,
+    88920, 88929, 88940, 88949, 88956, 88965, 88978, 88981,
+    88996, 89018, 89033, 89040, 89044, 89051, 89064, 89073,
+    89097, 89106, 89109, 89116, 89123, 89134, 89143, 89163,
+    89178, 89185, 89192, 89205, 89212, 89216, 89223, 89230,
+    89237, 89254, 89261, 89271, 89279, 89286, 89294, 89314,
+    89331, 89346, 89349, 89359, 89368, 89375, 89385, 89395,
+    89409, 89416, 89446, 89454, 89466, 89478, 89496, 89506,
+    89528, 89539, 89558, 89577, 89587, 89594, 89600, 89650,
+    89660, 89670, 89681, 89701, 89708, 89718, 89733, 89753,
+    89770, 89780, 89786, 89806, 89815, 89826, 89836, 89846,
+    89852, 89863, 89873, 89890, 89899, 89908, 89915, 89941,
+    89960, 89970, 89982, 89994, 90013, 90035, 90060, 90066,
+    90072, 90093, 90105, 90126, 90134, 90152, 90172, 90186,
+    90202, 90209, 90223, 90230, 90245, 90256, 90263, 90270,
+    90277, 90295, 90307, 90314, 90317, 90322, 90329, 90349,
+    90357, 90370, 90376, 90381, 90388, 90401, 90404, 90417,
+    90420, 90439, 90443, 90449, 90460, 90469, 90481, 90491,
+    90498, 90503, 90523, 90530, 90553, 90570, 90579, 90585,
+    90599, 90606, 90612, 90624, 90630, 90657, 90666, 90673,
+    90683, 90688, 90705, 90726, 90747, 90767, 90787, 90799,
+    90806, 90821, 90834, 90840, 90850, 90857, 90871, 90878,
+    90882, 90902, 90910, 90928, 90948, 90961, 90972, 90984,
+    90991, 91003, 91016, 91026, 91042, 91048, 91055, 91074,
+    91088, 91104, 91110, 91126, 91137, 91143, 91159, 91179,
+    91184, 91202, 91207, 91212, 91221, 91230, 91253, 91262,
+    91273, 91279, 91289, 91302, 91310, 91317, 91324, 91339,
+    91344, 91362, 91368, 91374, 91385, 91389, 91410, 91427,
+    91442, 91454, 91461, 91473, 91480, 91489, 91496, 91507,
+    91517, 91521, 91540, 91547, 91569, 91576, 91582, 91589,
+    91597, 91603, 91619, 91629, 91635, 91646, 91654, 91671,
+    91688, 91696, 91699, 91704, 91711, 91732, 91738, 91745,
+    91755, 91765, 91773, 91784, 91807, 91814, 91823, 91835,
+    91848, 91859, 91875, 91881, 91896, 91905, 91911, 91921,
+    91935, 91950, 91960, 91968, 91975, 91986, 91999, 92005,
+    92017, 92021, 92038, 92050, 92063, 92069, 92076, 92094,
+    92117, 92134, 92152, 92156, 92171, 92177, 92194, 92200,
+    92208, 92214, 92224, 92242, 92252, 92274, 92284, 92292,
+    92304, 92308, 92338, 92347, 92357, 92379, 92388, 92407,
+    92417, 92425, 92441, 92448, 92455, 92462, 92475, 92485,
+    92525, 92541, 92548, 92553, 92565, 92576, 92593, 92603,
+    92624, 92637, 92650, 92662, 92672, 92689, 92701, 92708,
+    92724, 92737, 92743, 92774, 92780, 92795, 92802, 92827,
+    92843, 92858, 92866, 92878, 92893, 92907, 92919, 92931,
+    92938, 92954, 92966, 92976, 92979, 92991, 92998, 93005,
+    93012, 93019, 93026, 93031, 93047, 93072, 93086, 93093,
+    93107, 93115, 93136, 93140, 93146, 93153, 93167, 93173,
+    93195, 93215, 93224, 93243, 93255, 93268, 93289, 93312,
+    93326, 93329, 93335, 93359, 93367, 93372, 93379, 93389,
+    93395, 93400, 93410, 93416, 93419, 93433, 93440, 93447,
+    93453, 93468, 93475, 93491, 93506, 93515, 93534, 93541,
+    93548, 93561, 93575, 93587, 93597, 93607, 93621, 93640,
+    93647, 93658, 93678, 93688, 93695, 93709, 93716, 93727,
+    93731, 93736, 93739, 93760, 93778, 93785, 93807, 93821,
+    93848, 93858, 93874, 93884, 93902, 93908, 93914, 93920,
+    93926, 93945, 93952, 93967, 93985, 93997, 94014, 94029,
+    94047, 94052, 94066, 94078, 94096, 94108, 94123, 94129,
+    94151, 94175, 94194, 94201, 94207, 94222, 94234, 94241,
+    94249, 94259, 94271, 94274, 94283, 94323, 94341, 94346,
+    94354, 94361, 94375, 94394, 94401, 94408, 94428, 94434,
+    94453, 94467, 94473, 94480, 94487, 94522, 94544, 94558,
+    94563, 94577, 94585, 94595, 94602, 94610, 94623, 94630,
+    94646, 94662, 94672, 94688, 94694, 94699, 94717, 94727,
+    94748, 94755, 94763, 94770, 94778, 94800, 94806, 94824,
+    94843, 94869, 94875, 94880, 94883, 94900, 94921, 94928,
+    94945, 94951, 94958, 94965, 94978, 94990, 95010, 95027,
+    95038, 95044, 95054, 95073, 95082, 95096, 95109, 95140,
+    95143, 95160, 95172, 95182, 95194, 95210, 95228, 95240,
+    95248, 95257, 95264, 95281, 95297, 95328, 95343, 95350,
+    95355, 95374, 95390, 95398, 95401, 95417, 95434, 95440,
+    95452, 95469, 95492, 95498, 95506, 95523, 95533, 95550,
+    95566, 95575, 95582, 95593, 95603, 95615, 95628, 95635,
+    95645, 95659, 95665, 95687, 95701, 95713, 95719, 95731,
+    95738, 95745, 95764, 95777, 95791, 95802, 95812, 95822,
+    95838, 95845, 95863, 95875, 95882, 95885, 95894, 95916,
+    95929, 95937, 95950, 95963, 95975, 95991, 96011, 96020,
+    96034, 96049, 96057, 96071, 96077, 96084, 96110, 96117,
+    96124, 96134, 96138, 96154, 96158, 96178, 96188, 96194,
+    96206, 96224, 96232, 96244, 96251, 96266, 96288, 96296,
+    96303, 96319, 96329, 96340, 96357, 96370, 96387, 96393,
+    96403, 96410, 96417, 96422, 96439, 96442, 96448, 96452,
+    96463, 96479, 96488, 96494, 96501, 96513, 96521, 96524,
+    96545, 96548, 96555, 96575, 96594, 96601, 96621, 96627,
+    96646, 96657, 96664, 96673, 96686, 96694, 96701, 96736,
+    96743, 96751, 96767, 96773, 96790, 96806, 96816, 96832,
+    96844, 96856, 96863, 96873, 96878, 96898, 96925, 96935,
+    96944, 96966, 96973, 96985, 96991, 97009, 97020, 97027,
+    97046, 97053, 97056, 97064, 97071, 97078, 97088, 97113,
+    97123, 97129, 97144, 97161, 97173, 97183, 97187, 97197,
+    97208, 97218, 97226, 97245, 97264, 97271, 97281, 97284,
+    97303, 97310, 97320, 97338, 97345, 97350, 97364, 97417,
+    97428, 97444, 97451, 97466, 97482, 97488, 97504, 97526,
+    97533, 97552, 97569, 97582, 97592, 97599, 97606, 97611,
+    97632, 97643, 97655, 97666, 97674, 97680, 97692, 97710,
+    97726, 97743, 97759, 97763, 97770, 97782, 97792, 97809,
+    97818, 97832, 97847, 97854, 97863, 97876, 97883, 97898,
+    97905, 97915, 97935, 97945, 97952, 97956, 97961, 97971,
+    97978, 97995, 98002, 98011, 98032, 98044, 98047, 98057,
+    98067, 98073, 98085, 98092, 98099, 98121, 98143, 98160,
+    98167, 98178, 98198, 98206, 98212, 98233, 98261, 98275,
+    98281, 98285, 98294, 98298, 98311, 98321, 98328, 98339,
+    98358, 98370, 98382, 98398, 98405, 98422, 98453, 98472,
+    98477, 98484, 98505, 98516, 98527, 98545, 98557, 98571,
+    98579, 98595, 98602, 98608, 98614, 98621, 98630, 98638,
+    98646, 98653, 98660, 98667, 98688, 98704, 98721, 98730,
+    98742, 98750, 98770, 98783, 98799, 98817, 98824, 98833,
+    98836, 98850, 98857, 98863, 98879, 98889, 98897, 98907,
+    98914, 98922, 98944, 98951, 98962, 98971, 98974, 98981,
+    98989, 98995, 99001, 99019, 99024, 99033, 99043, 99053,
+    99060, 99067, 99076, 99083, 99098, 99105, 99109, 99121,
+    99127, 99136, 99146, 99181, 99186, 99189, 99203, 99210,
+    99218, 99228, 99246, 99260, 99279, 99300, 99311, 99314,
+    99329, 99347, 99352, 99371, 99383, 99390, 99397, 99416,
+    99423, 99434, 99446, 99456, 99468, 99491, 99500, 99518,
+    99523, 99538, 99552, 99564, 99586, 99598, 99615, 99624,
+    99630, 99637, 99654, 99669, 99676, 99683, 99703, 99709,
+    99716, 99723, 99732, 99738, 99746, 99756, 99768, 99783,
+    99795, 99805, 99824, 99830, 99837, 99857, 99863, 99873,
+    99885, 99893, 99907, 99923, 99930, 99944, 99951, 99960,
+    99977, 99997, 100014, 100023, 100030, 100046, 100057, 100067,
+    100077, 100098, 100105, 100113, 100135, 100142, 100162, 100167,
+    100174, 100179, 100194, 100208, 100224, 100231, 100241, 100249,
+    100254, 100275, 100287, 100301, 100320, 100335, 100348, 100358,
+    100379, 100397, 100406, 100427, 100447, 100453, 100460, 100471,
+    100474, 100489, 100502, 100509, 100515, 100523, 100534, 100551,
+    100571, 100589, 100599, 100610, 100617, 100630, 100648, 100658,
+    100673, 100679, 100686, 100696, 100713, 100721, 100728, 100734,
+    100741, 100758, 100773, 100777, 100790, 100802, 100809, 100819,
+    100832, 100839, 100849, 100856, 100867, 100874, 100880, 100886,
+    100901, 100914, 100923, 100938, 100945, 100952, 100970, 100985,
+    100991, 101010, 101020, 101037, 101043, 101049, 101062, 101069,
+    101083, 101105, 101112, 101128, 101134, 101141, 101155, 101159,
+    101165, 101179, 101193, 101196, 101210, 101218, 101232, 101239,
+    101248, 101269, 101295, 101308, 101324, 101344, 101359, 101366,
+    101373, 101383, 101390, 101407, 101419, 101439, 101456, 101464,
+    101478, 101484, 101497, 101501, 101519, 101527, 101537, 101545,
+    101552, 101558, 101579, 101584, 101601, 101606, 101622, 101643,
+    101650, 101672, 101692, 101701, 101722, 101742, 101750, 101770,
+    101778, 101788, 101799, 101813, 101834, 101840, 101851, 101858,
+    101875, 101893, 101899, 101935, 101946, 101956, 101982, 102001,
+    102013, 102022, 102041, 102051, 102064, 102071, 102096, 102115,
+    102134, 102153, 102171, 102190, 102197, 102208, 102215, 102225,
+    102238, 102244, 102249, 102256, 102278, 102290, 102309, 102315,
+    102324, 102335, 102342, 102355, 102364, 102371, 102378, 102388,
+    102397, 102409, 102424, 102441, 102459, 102473, 102485, 102499,
+    102502, 102519, 102522, 102529, 102534, 102553, 102580, 102587,
+    102599, 102619, 102624, 102633, 102641, 102654, 102661, 102681,
+    102684, 102696, 102713, 102729, 102748, 102751, 102758, 102775,
+    102795, 102802, 102809, 102827, 102840, 102860, 102867, 102878,
+    102898, 102907, 102919, 102924, 102935, 102944, 102965, 102981,
+    103000, 103018, 103026, 103033, 103041, 103047, 103056, 103074,
+    103085, 103093, 103108, 103115, 103126, 103142, 103156, 103176,
+    103182, 103196, 103216, 103226, 103244, 103258, 103268, 103283,
+    103286, 103293, 103305, 103318, 103325, 103337, 103343, 103348,
+    103356, 103373, 103384, 103405, 103426, 103433, 103440, 103450,
+    103456, 103465, 103473, 103482, 103493, 103500, 103508, 103520,
+    103532, 103540, 103547, 103567, 103586, 103596, 103615, 103622,
+    103632, 103640, 103652, 103659, 103678, 103688, 103702, 103722,
+    103729, 103748, 103763, 103779, 103800, 103814, 103835, 103860,
+    103865, 103880, 103890, 103911, 103920, 103925, 103937, 103956,
+    103964, 103973, 103978, 103990, 103999, 104015, 104031, 104041,
+    104057, 104067, 104076, 104082, 104103, 104158, 104165, 104175,
+    104184, 104188, 104195, 104212, 104230, 104240, 104258, 104267,
+    104273, 104279, 104285, 104294, 104315, 104326, 104337, 104356,
+    104363, 104370, 104376, 104382, 104398, 104415, 104430, 104444,
+    104451, 104461, 104468, 104483, 104492, 104498, 104511, 104528,
+    104540, 104552, 104561, 104572, 104591, 104594, 104600, 104610,
+    104617, 104624, 104636, 104653, 104660, 104667, 104685, 104698,
+    104714, 104733, 104746, 104753, 104762, 104769, 104776, 104786,
+    104793, 104798, 104818, 104834, 104849, 104864, 104886, 104898,
+    104904, 104915, 104930, 104943, 104951, 104958, 104965, 104970,
+    104988, 105000, 105010, 105015, 105032, 105043, 105060, 105083,
+    105091, 105098, 105117, 105135, 105151, 105163, 105183, 105197,
+    105203, 105218, 105226, 105232, 105244, 105256, 105269, 105275,
+    105282, 105320, 105325, 105332, 105343, 105352, 105365, 105372,
+    105384, 105388, 105395, 105402, 105409, 105427, 105433, 105463,
+    105469, 105480, 105487, 105498, 105520, 105533, 105540, 105543,
+    105552, 105557, 105564, 105571, 105590, 105607, 105623, 105631,
+    105634, 105642, 105649, 105660, 105672, 105675, 105695, 105707,
+    105730, 105756, 105773, 105778, 105788, 105799, 105819, 105832,
+    105845, 105861, 105871, 105888, 105897, 105912, 105921, 105926,
+    105933, 105949, 105956, 105963, 105974, 105987, 106024, 106037,
+    106055, 106073, 106080, 106100, 106109, 106116, 106123, 106129,
+    106139, 106146, 106160, 106167, 106183, 106190, 106202, 106212,
+    106219, 106226, 106229, 106237, 106244, 106254, 106270, 106278,
+    106283, 106295, 106317, 106325, 106335, 106348, 106366, 106376,
+    106386, 106396, 106413, 106419, 106422, 106433, 106446, 106456,
+    106468, 106490, 106499, 106508, 106514, 106517, 106524, 106534,
+    106540, 106553, 106571, 106583, 106599, 106612, 106632, 106646,
+    106667, 106683, 106690, 106697, 106716, 106756, 106766, 106773,
+    106786, 106796, 106812, 106826, 106838, 106858, 106869, 106891,
+    106894, 106900, 106903, 106916, 106930, 106939, 106953, 106969,
+    106982, 106987, 106994, 107007, 107013, 107024, 107029, 107040,
+    107047, 107054, 107076, 107086, 107104, 107112, 107119, 107130,
+    107133, 107147, 107167, 107184, 107191, 107199, 107206, 107222,
+    107228, 107241, 107259, 107269, 107287, 107305, 107312, 107320,
+    107362, 107369, 107385, 107392, 107402, 107410, 107432, 107439,
+    107445, 107461, 107466, 107482, 107500, 107507, 107514, 107531,
+    107556, 107575, 107613, 107624, 107644, 107651, 107662, 107672,
+    107688, 107700, 107720, 107732, 107736, 107743, 107760, 107763,
+    107776, 107786, 107796, 107812, 107819, 107831, 107849, 107857,
+    107872, 107884, 107899, 107919, 107929, 107936, 107943, 107947,
+    107959, 107970, 107976, 107990, 107994, 108014, 108021, 108035,
+    108042, 108059, 108075, 108079, 108086, 108092, 108096, 108105,
+    108113, 108134, 108157, 108169, 108178, 108185, 108204, 108222,
+    108228, 108244, 108261, 108269, 108282, 108289, 108294, 108299,
+    108316, 108334, 108348, 108367, 108375, 108389, 108394, 108401,
+    108411, 108421, 108429, 108440, 108446, 108467, 108478, 108485,
+    108497, 108509, 108515, 108528, 108535, 108553, 108556, 108564,
+    108571, 108587, 108595, 108602, 108617, 108628, 108638, 108653,
+};
+static const quint32 TLDTblSize = 9104;
+
+static const quint16 TLDSeeds[2276] = {
+    34, 5, 1, 90, 1, 5, 1, 39, 232, 145, 0, 127,
+    76, 1, 1, 22, 1, 68, 1, 1, 5, 11, 1, 56,
+    0, 16, 0, 75, 93, 47, 8, 190, 7, 29, 23, 176,
+    9, 118, 15, 16, 7, 75, 28, 2, 49, 0, 34, 92,
+    27, 27, 0, 51, 83, 41, 238, 187, 142, 20, 5, 3,
+    11, 1, 30, 7, 63, 84, 19, 64, 4, 1, 2, 84,
+    13, 2, 33, 9, 54, 1, 3, 4, 50, 1, 1, 81,
+    10, 15, 10, 65, 73, 1, 1, 254, 5, 14, 1, 30,
+    100, 7, 26, 1, 1, 156, 27, 2, 210, 3, 49, 49,
+    1, 109, 72, 212, 89, 9, 93, 26, 0, 93, 56, 10,
+    30, 10, 7, 5, 34, 22, 60, 61, 1, 183, 56, 15,
+    29, 30, 3, 2, 91, 5, 2, 58, 167, 1, 3, 7,
+    27, 278, 4, 6, 211, 19, 66, 214, 305, 1, 41, 27,
+    30, 2, 62, 4, 79, 18, 10, 32, 8, 5, 33, 290,
+    125, 13, 1, 121, 2, 9, 28, 14, 47, 36, 18, 66,
+    105, 90, 2, 1, 69, 33, 128, 7, 30, 25, 24, 75,
+    5, 3, 8, 36, 180, 3, 2, 53, 3, 10, 5, 36,
+    49, 164, 3, 32, 66, 40, 64, 7, 13, 51, 3, 101,
+    1, 12, 1, 15, 10, 10, 7, 8, 23, 195, 7, 4,
+    13, 1, 0, 184, 6, 106, 37, 119, 107, 11, 4, 1,
+    64, 28, 1, 107, 3, 10, 4, 15, 5, 112, 29, 51,
+    4, 27, 4, 4, 1, 2, 17, 25, 13, 22, 42, 57,
+    12, 18, 42, 8, 4, 5, 11, 117, 18, 3, 3, 12,
+    131, 2, 227, 1, 2, 4, 70, 33, 52, 10, 49, 48,
+    6, 85, 1, 152, 97, 402, 31, 38, 6, 218, 25, 15,
+    17, 3, 1, 10, 0, 4, 156, 69, 77, 6, 156, 36,
+    25, 33, 25, 12, 4, 1, 3, 272, 11, 135, 92, 50,
+    1, 178, 25, 136, 1, 91, 31, 2, 2, 3, 6, 3,
+    141, 12, 212, 89, 40, 8, 62, 27, 12, 193, 3, 40,
+    1, 29, 297, 8, 70, 11, 93, 30, 76, 162, 63, 36,
+    88, 11, 0, 16, 8, 14, 185, 101, 3, 17, 144, 70,
+    289, 207, 1, 7, 4, 12, 1, 6, 2, 4, 34, 78,
+    136, 346, 54, 7, 12, 95, 109, 6, 9, 46, 253, 83,
+    28, 20, 6, 101, 31, 2, 1, 20, 138, 91, 30, 83,
+    0, 17, 34, 15, 25, 302, 171, 189, 1, 1, 25, 57,
+    1, 10, 29, 2, 80, 10, 105, 68, 2, 1, 2, 1,
+    27, 47, 24, 142, 1, 53, 61, 490, 5, 5, 89, 27,
+    17, 178, 139, 569, 35, 312, 159, 6, 20, 9, 2, 219,
+    23, 1, 9, 511, 22, 26, 239, 45, 337, 126, 50, 93,
+    0, 32, 60, 22, 249, 9, 205, 19, 5, 43, 3, 71,
+    9, 7, 6, 19, 69, 177, 83, 234, 3, 93, 43, 2,
+    10, 18, 4, 38, 10, 32, 13, 4, 239, 138, 17, 220,
+    8, 39, 207, 154, 30, 1, 8, 42, 36, 3, 1, 125,
+    18, 88, 61, 2, 15, 135, 35, 19, 2, 5, 52, 92,
+    57, 36, 21, 211, 20, 13, 14, 122, 13, 124, 452, 399,
+    22, 69, 69, 10, 22, 47, 4, 2, 1, 4, 76, 90,
+    96, 4, 56, 111, 48, 4, 177, 1, 6, 126, 152, 1,
+    142, 14, 8, 14, 8, 12, 124, 85, 113, 2, 202, 110,
+    50, 18, 139, 146, 26, 1, 68, 10, 46, 33, 13, 3,
+    75, 1, 12, 31, 1, 372, 25, 19, 114, 20, 54, 238,
+    20, 1, 42, 105, 267, 8, 3, 75, 294, 13, 2, 4,
+    4, 1, 38, 1, 46, 12, 65, 136, 2, 1, 354, 102,
+    24, 11, 57, 274, 7, 8, 3, 227, 64, 17, 203, 13,
+    53, 1, 75, 1, 7, 3, 267, 20, 160, 0, 4, 9,
+    36, 4, 9, 46, 24, 84, 1, 12, 31, 8, 57, 96,
+    187, 11, 163, 1, 3, 42, 141, 6, 57, 2, 2, 69,
+    435, 74, 43, 326, 71, 44, 36, 3, 0, 2, 14, 26,
+    8, 4, 17, 84, 574, 9, 1, 8, 1, 18, 36, 8,
+    417, 9, 46, 120, 180, 100, 8, 196, 27, 12, 57, 8,
+    323, 64, 312, 10, 3, 28, 34, 12, 105, 10, 29, 293,
+    2, 9, 156, 1, 3, 644, 265, 45, 88, 5, 75, 16,
+    53, 67, 77, 2, 185, 415, 1, 5, 4, 10, 3, 8,
+    872, 65, 108, 418, 13, 162, 7, 1, 65, 235, 24, 39,
+    137, 31, 4, 12, 46, 833, 30, 64, 111, 5, 1, 1,
+    19, 219, 13, 3, 114, 48, 111, 209, 45, 55, 11, 41,
+    75, 15, 19, 43, 312, 193, 23, 233, 32, 42, 32, 26,
+    3, 135, 522, 5, 10, 2, 30, 16, 46, 2, 1, 2,
+    100, 3, 140, 5, 140, 25, 17, 149, 379, 9, 32, 87,
+    71, 15, 84, 67, 28, 25, 21, 0, 122, 944, 342, 2,
+    28, 8, 13, 7, 1, 25, 138, 28, 117, 436, 250, 2,
+    1, 3, 429, 2, 56, 6, 25, 102, 85, 12, 423, 9,
+    4, 27, 40, 3, 7, 2, 622, 4, 94, 66, 464, 14,
+    43, 328, 1, 48, 15, 26, 2, 110, 39, 1, 284, 0,
+    2, 1, 120, 36, 20, 4, 1, 17, 4, 17, 6, 395,
+    89, 4, 24, 66, 17, 39, 122, 62, 60, 228, 173, 54,
+    5, 11, 734, 2, 3, 108, 93, 57, 1, 40, 19, 5,
+    15, 107, 11, 183, 59, 45, 41, 1, 41, 53, 106, 1,
+    324, 26, 49, 5, 31, 154, 17, 4, 209, 26, 145, 109,
+    895, 16, 129, 31, 29, 7, 26, 470, 341, 36, 11, 436,
+    1, 101, 13, 58, 10, 17, 1, 75, 1, 3, 1, 43,
+    1, 111, 6, 78, 104, 32, 60, 6, 60, 112, 297, 107,
+    7, 3, 74, 3, 20, 2, 136, 33, 101, 246, 4, 189,
+    56, 8, 4, 50, 1, 20, 38, 4, 2, 313, 42, 28,
+    75, 21, 1, 2, 14, 29, 513, 13, 75, 143, 271, 5,
+    30, 409, 193, 4, 176, 4, 0, 25, 131, 211, 3, 273,
+    1, 0, 8, 3, 227, 7, 5, 3, 299, 59, 40, 89,
+    276, 20, 107, 117, 24, 8, 861, 306, 6, 3, 43, 45,
+    3, 63, 296, 49, 1, 205, 2, 25, 123, 27, 0, 107,
+    66, 1, 6, 266, 120, 268, 16, 42, 5, 11, 840, 549,
+    63, 181, 1, 47, 14, 7, 105, 18, 22, 131, 97, 30,
+    55, 5, 64, 39, 120, 223, 93, 308, 229, 1, 2, 4,
+    16, 0, 103, 3, 12, 293, 21, 257, 272, 21, 313, 29,
+    12, 1, 2, 200, 2, 11, 6, 58, 25, 44, 10, 1,
+    34, 168, 3, 498, 11, 534, 90, 247, 79, 18, 66, 31,
+    376, 26, 186, 150, 277, 14, 31, 9, 33, 11, 131, 78,
+    210, 9, 255, 1, 41, 209, 72, 1, 520, 11, 13, 23,
+    2, 7, 228, 170, 2, 164, 6, 1, 569, 17, 619, 364,
+    39, 10, 16, 52, 97, 59, 318, 244, 399, 2, 46, 7,
+    204, 5, 59, 66, 178, 8, 61, 1, 18, 1, 182, 497,
+    375, 72, 1696, 27, 27, 162, 1, 129, 130, 0, 454, 2,
+    79, 14, 235, 356, 422, 1, 1, 2, 31, 549, 423, 303,
+    34, 40, 1804, 4, 11, 33, 603, 20, 5, 136, 10, 18,
+    15, 46, 2, 17, 23, 99, 258, 82, 1, 1, 414, 82,
+    70, 3, 0, 90, 68, 4, 0, 22, 0, 6, 171, 230,
+    197, 7, 2, 111, 2, 23, 30, 5, 3, 292, 122, 192,
+    44, 7, 26, 172, 1, 10, 333, 12, 21, 4, 10, 98,
+    132, 26, 32, 667, 110, 7, 37, 631, 1, 1, 127, 3,
+    100, 12, 239, 66, 21, 327, 1, 180, 359, 3, 1, 12,
+    146, 16, 78, 20, 605, 74, 132, 483, 553, 2, 96, 11,
+    9, 1, 1, 3, 2, 34, 64, 409, 8, 51, 79, 26,
+    189, 430, 22, 73, 11, 796, 3, 129, 64, 15, 147, 35,
+    188, 81, 2, 35, 200, 349, 196, 93, 1386, 9, 41, 31,
+    378, 169, 1444, 202, 313, 2, 2, 17, 211, 30, 66, 176,
+    5, 3, 2, 693, 3, 198, 47, 7, 367, 3, 681, 53,
+    347, 2, 55, 695, 22, 9, 126, 47, 241, 388, 92, 86,
+    17, 1, 96, 544, 44, 529, 194, 348, 49, 89, 194, 2,
+    159, 60, 62, 1272, 6, 460, 33, 142, 2, 559, 941, 150,
+    1279, 4, 144, 12, 123, 3, 5, 248, 0, 1, 21, 277,
+    30, 20, 232, 6, 61, 30, 17, 10, 18, 20, 90, 385,
+    587, 220, 1, 1, 24, 108, 965, 63, 8, 7, 37, 163,
+    55, 188, 411, 74, 14, 188, 933, 173, 1, 35, 12, 1,
+    4, 6, 110, 62, 30, 2, 126, 358, 10, 32, 36, 20,
+    613, 280, 7, 21, 196, 254, 33, 522, 7, 3, 1, 81,
+    17, 11, 3, 557, 410, 129, 6, 478, 235, 1, 34, 60,
+    10, 304, 274, 142, 20, 267, 186, 5, 2, 1, 12, 2,
+    727, 381, 14, 405, 16, 60, 5, 4, 253, 242, 12, 166,
+    411, 169, 266, 77, 133, 2, 81, 1, 68, 26, 91, 3,
+    46, 201, 52, 3, 107, 26, 1, 727, 0, 12, 12, 595,
+    318, 106, 49, 323, 9, 260, 72, 621, 254, 32, 436, 11,
+    1, 6, 352, 856, 157, 2, 183, 10, 30, 11, 1, 8,
+    92, 379, 257, 128, 20, 13, 20, 2, 188, 0, 4, 25,
+    1, 1, 31, 10, 289, 1, 11, 782, 566, 68, 16, 106,
+    59, 84, 162, 600, 0, 282, 2, 278, 117, 6, 44, 61,
+    2, 288, 1, 2, 15, 42, 2530, 3, 85, 362, 388, 35,
+    231, 9, 405, 0, 1021, 1, 72, 852, 488, 46, 4, 1,
+    1, 23, 940, 19, 120, 39, 169, 158, 37, 28, 17, 56,
+    500, 4, 115, 1849, 181, 306, 66, 17, 63, 335, 1176, 192,
+    5, 25, 10, 959, 412, 826, 6, 71, 320, 292, 2, 996,
+    71, 24, 75, 77, 25, 16, 2283, 11, 26, 21, 8, 227,
+    26, 207, 24, 1, 254, 149, 5, 27, 8, 71, 12, 139,
+    396, 318, 12, 131, 124, 874, 117, 83, 134, 69, 86, 64,
+    55, 315, 210, 1, 991, 849, 90, 4, 31, 5, 476, 1,
+    2, 155, 9, 3, 131, 852, 50, 15, 398, 155, 63, 37,
+    2, 113, 35, 147, 14, 40, 844, 675, 1, 6, 303, 121,
+    2, 3, 36, 897, 3, 1179, 160, 58, 1638, 2, 17, 156,
+    105, 1403, 476, 30, 14, 11, 875, 437, 50, 565, 123, 426,
+    25, 146, 23, 207, 135, 3, 85, 542, 92, 5, 30, 250,
+    132, 2, 402, 288, 2, 5, 1, 33, 3, 19, 295, 815,
+    465, 695, 3131, 20, 233, 12, 544, 313, 785, 83, 119, 174,
+    106, 158, 322, 0, 294, 7, 209, 43, 118, 2, 27, 867,
+    471, 53, 21, 29, 4, 482, 4, 12, 74, 18, 5, 4,
+    66, 23, 686, 6, 258, 3, 540, 114, 56, 821, 26, 4,
+    3, 207, 376, 433, 122, 633, 419, 6, 392, 25, 221, 31,
+    3, 124, 450, 10, 814, 95, 65, 15, 42, 1, 1, 7,
+    68, 64, 484, 13, 1037, 3, 48, 42, 19, 5, 3639, 14,
+    572, 124, 1498, 233, 207, 495, 19, 112, 22, 162, 1, 171,
+    11, 135, 457, 10, 940, 19, 5, 289, 41, 2, 279, 1280,
+    255, 69, 462, 211, 19, 3, 159, 149, 2, 2, 515, 1,
+    38, 617, 92, 63, 5, 167, 9, 1, 1, 62, 195, 910,
+    606, 1, 303, 28, 553, 296, 196, 264, 221, 1343, 8, 1636,
+    324, 36, 9, 29, 29, 532, 584, 100, 5, 1, 409, 940,
+    320, 42, 27, 681, 603, 1, 61, 82, 101, 167, 993, 175,
+    17, 619, 83, 8, 223, 1, 516, 84, 201, 131, 856, 1,
+    1396, 57, 183, 2883, 55, 78, 1036, 155, 49, 3, 396, 2411,
+    48, 1341, 7, 49, 12, 53, 66, 2, 0, 178, 53, 7,
+    1, 871, 8, 184, 3250, 4, 77, 1, 63, 31, 2, 54,
+    30, 2, 2, 77, 44, 57, 9, 2, 16, 9, 9, 40,
+    10, 45, 5, 30, 27, 30, 1, 7, 170, 0, 2, 67,
+    443, 28, 165, 3476, 2407, 129, 1161, 1768, 265, 4, 116, 6,
+    2, 2427, 43, 0, 22, 1363, 7, 6, 28, 28, 1, 60,
+    180, 1682, 46, 1608, 27, 102, 285, 31, 6, 7, 2, 10,
+    5, 2896, 494, 86, 79, 1742, 25, 890, 109, 1, 89, 96,
+    64, 1065, 470, 169, 253, 42, 1, 4, 2, 1096, 3, 101,
+    18, 6, 280, 6, 128, 3431, 307, 10, 4, 172, 282, 3,
+    25, 408, 77, 330, 37, 2007, 94, 14, 4, 449, 1, 565,
+    4, 220, 154, 1, 840, 26, 31, 2464, 173, 1053, 781, 2027,
+    326, 3341, 61, 778, 1944, 95, 158, 32, 5, 3, 1, 1248,
+    4, 64, 0, 1048, 8, 2178, 102, 59, 1790, 1174, 445, 116,
+    3, 4415, 1, 102, 313, 0, 1, 977, 118, 2491, 230, 28,
+    2907, 649, 284, 326, 378, 13, 277, 443, 1, 285, 496, 2514,
+    104, 9, 851, 542, 8, 2053, 1277, 1, 101, 79, 1062, 495,
+    91, 45, 290, 1064, 83, 1513, 66, 576, 10, 24, 1, 613,
+    2929, 789, 10, 1, 64, 94, 119, 1436, 509, 458, 1, 27,
+    8, 3, 132, 61, 2, 6, 173, 666, 4313, 12, 74, 83,
+    1124, 224, 1, 12, 35, 438, 116, 47, 8393, 1045, 1174, 5835,
+    866, 4246, 2356, 83, 401, 15, 1103, 3, 11, 3340, 203, 2,
+    3462, 5, 4, 7, 46, 5, 1075, 64, 2192, 1343, 2, 957,
+    0, 46, 138, 0, 2, 743, 153, 0, 490, 640, 18, 6,
+    324, 16, 272, 153, 47, 2627, 1104, 7036, 1371, 936, 509, 235,
+    1797, 153, 56, 1625, 375, 4593, 13, 39,
 };
-static const qint16 TLDTblSize = 9104;
+static const quint32 TLDSeedsSize = 2276;
+static const int TLDMaxLength = 54;
 
+// keep in sync with tldhash() in gentld.py
+static inline quint32 qt_tld_hash(quint32 seed, char prefix, const char *data, int size)
+{
+    quint32 h = 0x811c9dc5 ^ seed;
+    if (prefix) {
+        h = (h ^ uchar(prefix)) * 0x01000193;
+    }
+    for (int i = 0; i < size; i++) {
+        h = (h ^ uchar(data[i])) * 0x01000193;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+// looks up prefix followed by the UTF-8 data, the perfect hash gives the
+// only slot the entry can be in
+static inline bool containsTLDEntry(char prefix, const char *data, int size)
+{
+    const quint32 bucket = qt_tld_hash(0, prefix, data, size) % TLDSeedsSize;
+    const quint32 slot = qt_tld_hash(TLDSeeds[bucket], prefix, data, size) % TLDTblSize;
+    const char *entry = TLDStrings + TLDOffsets[slot];
+    if (prefix) {
+        if (*entry != prefix) {
+            return false;
+        }
+        entry++;
+    }
+    int i = 0;
+    while (i < size && entry[i] != '\0' && entry[i] == data[i]) {
+        i++;
+    }
+    return (i == size && entry[i] == '\0');
+}
 
-static inline bool containsTLDEntry(const QString &entry)
+static bool isEffectiveTLD(const char *domain, int size)
 {
-    for (qint16 i = 0; i < TLDTblSize; i++) {
-        if (entry == QString::fromUtf8(TLDTbl[i]))
-            return true;
+    // for domain 'foo.bar.com':
+    // 1. return if TLD table contains 'foo.bar.com'
+    if (containsTLDEntry('\0', domain, size))
+        return true;
+
+    const char *dot = static_cast<const char *>(::memchr(domain, '.', size));
+    if (dot && dot != domain) {
+        // 2. if table contains '*.bar.com',
+        // test if table contains '!foo.bar.com'
+        if (containsTLDEntry('*', dot, size - int(dot - domain)))
+            return (!containsTLDEntry('!', domain, size));
     }
     return false;
 }
 
+static inline uint nextUcs4(const QString &domain, int &i)
+{
+    uint ucs4 = domain.at(i).unicode();
+    if (QChar::isHighSurrogate(ucs4) && i + 1 < domain.size()
+        && domain.at(i + 1).isLowSurrogate()) {
+        i++;
+        ucs4 = QChar::surrogateToUcs4(ushort(ucs4), domain.at(i).unicode());
+    }
+    return ucs4;
+}
+
+static inline void appendUtf8(char *utf8, int &size, uint ucs4)
+{
+    if (ucs4 >= 0xd800 && ucs4 <= 0xdfff) {
+        // lone surrogate, there are no such entries
+        ucs4 = QChar::ReplacementCharacter;
+    }
+    if (ucs4 < 0x80) {
+        utf8[size++] = char(ucs4);
+    } else if (ucs4 < 0x800) {
+        utf8[size++] = char(0xc0 | (ucs4 >> 6));
+        utf8[size++] = char(0x80 | (ucs4 & 0x3f));
+    } else if (ucs4 < 0x10000) {
+        utf8[size++] = char(0xe0 | (ucs4 >> 12));
+        utf8[size++] = char(0x80 | ((ucs4 >> 6) & 0x3f));
+        utf8[size++] = char(0x80 | (ucs4 & 0x3f));
+    } else {
+        utf8[size++] = char(0xf0 | (ucs4 >> 18));
+        utf8[size++] = char(0x80 | ((ucs4 >> 12) & 0x3f));
+        utf8[size++] = char(0x80 | ((ucs4 >> 6) & 0x3f));
+        utf8[size++] = char(0x80 | (ucs4 & 0x3f));
+    }
+}
+
 /*!
     \internal
 
@@ -9156,15 +10574,73 @@ static inline bool containsTLDEntry(const QString &entry)
 
 Q_CORE_EXPORT QString qTopLevelDomain(const QString &domain)
 {
-    QStringList sections = domain.toLower().split(QLatin1Char('.'), QString::SkipEmptyParts);
-    if (sections.isEmpty())
+    // the labels are converted to lower case UTF-8 from the last one to the
+    // first one without the empty labels and every level is looked up once
+    // its label is complete. the buffer holds the longest entry and one more
+    // label of up to 63 code points, once the levels after the current label
+    // are longer than the longest entry nothing can match and the conversion
+    // stops there
+    static const int TLDBufferSize = TLDMaxLength + 1 + 63 * 4;
+    QSTACKARRAY(char, utf8, TLDBufferSize);
+    char *const utf8end = utf8 + TLDBufferSize;
+    char *utf8pos = utf8end;
+    char *levelpos = utf8end;
+    int labelstart = -1;
+    int tldstart = -1;
+    bool overlong = false;
+    for (int i = domain.size() - 1; i >= -1; --i) {
+        if (i < 0 || domain.at(i) == QLatin1Char('.')) {
+            if (labelstart < 0)
+                continue;
+            if (overlong) {
+                // the level is longer than any entry, only a wildcard rule
+                // for the levels after the label can match it
+                if (levelpos != utf8end && containsTLDEntry('*', utf8pos, int(utf8end - utf8pos)))
+                    tldstart = labelstart;
+                break;
+            }
+            if (isEffectiveTLD(utf8pos, int(utf8end - utf8pos)))
+                tldstart = labelstart;
+            levelpos = utf8pos;
+            labelstart = -1;
+            if (utf8end - levelpos >= TLDMaxLength)
+                break;
+            continue;
+        }
+
+        labelstart = i;
+        uint ucs4 = domain.at(i).unicode();
+        if (QChar::isLowSurrogate(ucs4) && i > 0 && domain.at(i - 1).isHighSurrogate()) {
+            i--;
+            labelstart = i;
+            ucs4 = QChar::surrogateToUcs4(domain.at(i).unicode(), ushort(ucs4));
+        }
+        if (overlong)
+            continue;
+        char encoded[4];
+        int encodedsize = 0;
+        appendUtf8(encoded, encodedsize, QChar::toLower(ucs4));
+        const bool separator = (utf8pos == levelpos && levelpos != utf8end);
+        if (encodedsize + int(separator) > utf8pos - utf8) {
+            // keep only the separator and the levels after the label
+            overlong = true;
+            utf8pos = levelpos;
+            if (levelpos != utf8end)
+                *--utf8pos = '.';
+            continue;
+        }
+        if (separator)
+            *--utf8pos = '.';
+        utf8pos -= encodedsize;
+        ::memcpy(utf8pos, encoded, encodedsize);
+    }
+    if (tldstart < 0)
         return QString();
 
-    QString level, tld;
-    for (int j = sections.count() - 1; j >= 0; --j) {
-        level.prepend(QLatin1Char('.') + sections.at(j));
-        if (qIsEffectiveTLD(level.right(level.size() - 1)))
-            tld = level;
+    QString tld = QLatin1Char('.') + domain.mid(tldstart).toLower();
+    if (tld.contains(QLatin1String("..")) || tld.endsWith(QLatin1Char('.'))) {
+        const QStringList sections = tld.split(QLatin1Char('.'), QString::SkipEmptyParts);
+        tld = QLatin1Char('.') + sections.join(QLatin1String("."));
     }
     return tld;
 }
@@ -9177,29 +10653,29 @@ Q_CORE_EXPORT QString qTopLevelDomain(const QString &domain)
 
 Q_CORE_EXPORT bool qIsEffectiveTLD(const QString &domain)
 {
-    // for domain 'foo.bar.com':
-    // 1. return if TLD table contains 'foo.bar.com'
-    if (containsTLDEntry(domain))
-        return true;
-
+    // a wildcard rule matches a first label of any length, only the levels
+    // after it can not be longer than the longest entry
     const int dotindex = domain.indexOf(QLatin1Char('.'));
-    if (dotindex > 0) {
-        const int count = (domain.size() - dotindex);
-        QString wildCardDomain;
-        wildCardDomain.reserve(count + 1);
-        wildCardDomain.append(QLatin1Char('*'));
-        wildCardDomain.append(domain.right(count));
-        // 2. if table contains '*.bar.com',
-        // test if table contains '!foo.bar.com'
-        if (containsTLDEntry(wildCardDomain)) {
-            QString exceptionDomain;
-            exceptionDomain.reserve(domain.size() + 1);
-            exceptionDomain.append(QLatin1Char('!'));
-            exceptionDomain.append(domain);
-            return (! containsTLDEntry(exceptionDomain));
+    if (domain.size() - qMax(dotindex, 0) > TLDMaxLength)
+        return false;
+
+    // the buffer holds the longest entry and one more label of up to 63
+    // characters, at most 3 bytes are needed for every UTF-16 code unit.
+    // longer labels are not in any entry, only the wildcard rule for the
+    // levels after them is looked up
+    static const int TLDBufferSize = (TLDMaxLength + 1 + 63) * 3;
+    QSTACKARRAY(char, utf8, TLDBufferSize);
+    int utf8size = 0;
+    if (domain.size() > TLDMaxLength + 1 + 63) {
+        for (int i = dotindex; i < domain.size(); i++) {
+            appendUtf8(utf8, utf8size, nextUcs4(domain, i));
         }
+        return containsTLDEntry('*', utf8, utf8size);
     }
-    return false;
+    for (int i = 0; i < domain.size(); i++) {
+        appendUtf8(utf8, utf8size, nextUcs4(domain, i));
+    }
+    return isEffectiveTLD(utf8, utf8size);
 }
 
 QT_END_NAMESPACE
@@ -26,47 +26,65 @@
 #include "qthread_p.h"
 #include "qcoreapplication_p.h"
 
-#include <bitset>
+#include <functional>
+#include <limits>
 #include <mutex>
+#include <queue>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
-// 2048 pre-allocated should be more than enough for application, IDs rearely go beyond single
-// digit. could implement fallback to int-sized set if limit is reached
-enum { QTimerMax = 2048 };
-
-class QTimersSet : private std::bitset<QTimerMax>
+// IDs rarely go beyond single digit but applications with per-connection
+// timeouts can have tens of thousands of timers, the set grows as needed and
+// released IDs are reused lowest first
+class QTimersSet
 {
 public:
+    QTimersSet() : m_next(1) { } // 0 is invalid timer ID
+
     bool isSet(const int bit) const;
     void unsetBit(const int bit);
     int getBit();
 private:
-    std::mutex m_mutex;
+    mutable std::mutex m_mutex;
+    std::vector<bool> m_used;
+    std::priority_queue<int, std::vector<int>, std::greater<int> > m_free;
+    int m_next;
 };
 
 bool QTimersSet::isSet(const int bit) const
 {
-    return this->test(bit);
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return (bit > 0 && bit < m_next && m_used[bit]);
 }
 
 void QTimersSet::unsetBit(const int bit)
 {
     std::lock_guard<std::mutex> locker(m_mutex);
-    this->set(bit, false);
+    // releasing an unknown or already released ID must not put it in the
+    // free list, getBit() would hand it out twice
+    if (Q_UNLIKELY(bit <= 0 || bit >= m_next || !m_used[bit])) {
+        return;
+    }
+    m_used[bit] = false;
+    m_free.push(bit);
 }
 
 int QTimersSet::getBit()
 {
     std::lock_guard<std::mutex> locker(m_mutex);
-    // 0 is invalid timer ID
-    for (qint16 i = 1; i < QTimerMax; i++) {
-        if (!this->test(i)) {
-            this->set(i, true);
-            return i;
-        }
+    int id = 0;
+    if (!m_free.empty()) {
+        id = m_free.top();
+        m_free.pop();
+    } else if (Q_LIKELY(m_next < std::numeric_limits<int>::max())) {
+        id = m_next++;
+        m_used.resize(m_next, false);
+    } else {
+        return 0;
     }
-    return 0;
+    m_used[id] = true;
+    return id;
 }
 
 static QTimersSet timerIds;
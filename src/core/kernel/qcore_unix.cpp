@@ -30,6 +30,8 @@
 #include <sys/time.h>
 #include <stdlib.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 QStatInfo::QStatInfo()
@@ -215,4 +217,42 @@ int qt_safe_select(int nfds, fd_set *fdread, fd_set *fdwrite, fd_set *fdexcept,
     }
 }
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+static inline int timeval_to_msecs(const struct timeval &tv)
+{
+    // round up, waking up before the timeout expires means another wait
+    const qint64 msecs = (qint64(tv.tv_sec) * 1000) + ((tv.tv_usec + 999) / 1000);
+    return int(qMin(msecs, qint64(std::numeric_limits<int>::max())));
+}
+
+int qt_safe_epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+                       const struct timeval *orig_timeout)
+{
+    if (!orig_timeout) {
+        // no timeout -> block forever
+        int ret;
+        Q_EINTR_LOOP(ret, ::epoll_wait(epfd, events, maxevents, -1));
+        return ret;
+    }
+
+    timeval start = qt_gettime();
+    timeval timeout = *orig_timeout;
+
+    // loop and recalculate the timeout as needed
+    int ret;
+    forever {
+        ret = ::epoll_wait(epfd, events, maxevents, timeval_to_msecs(timeout));
+        if (ret != -1 || errno != EINTR)
+            return ret;
+
+        // recalculate the timeout
+        if (!time_update(&timeout, start, *orig_timeout)) {
+            // timeout during update
+            // or clock reset, fake timeout error
+            return 0;
+        }
+    }
+}
+#endif // QT_HAVE_EPOLL_CREATE1
+
 QT_END_NAMESPACE
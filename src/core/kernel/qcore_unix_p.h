@@ -48,6 +48,9 @@
 #ifdef QT_HAVE_FLOCK
 #  include <sys/file.h>
 #endif
+#ifdef QT_HAVE_EPOLL_CREATE1
+#  include <sys/epoll.h>
+#endif
 
 #define Q_EINTR_LOOP(var, cmd)                                \
     do {                                                      \
@@ -337,6 +340,12 @@ timeval qt_gettime(); // in qelapsedtimer_unix.cpp
 Q_CORE_EXPORT int qt_safe_select(int nfds, fd_set *fdread, fd_set *fdwrite, fd_set *fdexcept,
                                  const struct timeval *tv);
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+// don't call ::epoll_wait, call qt_safe_epoll_wait
+Q_CORE_EXPORT int qt_safe_epoll_wait(int epfd, struct epoll_event *events, int maxevents,
+                                     const struct timeval *tv);
+#endif
+
 /*
    Returns the difference between msecs and elapsed. If msecs is -1,
    however, -1 is returned.
@@ -48,6 +48,7 @@
 
 #include <stdlib.h>
 #include <errno.h>
+#include <mutex>
 
 QT_BEGIN_NAMESPACE
 
@@ -104,6 +105,8 @@ void Q_CORE_EXPORT qt_call_post_routines()
 Q_AUTOTEST_EXPORT uint qGlobalPostedEventsCount()
 {
     QThreadData *currentThreadData = QThreadData::current();
+    QMutexLocker locker(&currentThreadData->postEventList.mutex);
+    currentThreadData->postEventList.takeIncoming();
     return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
 }
 
@@ -141,6 +144,7 @@ QCoreApplicationPrivate::~QCoreApplicationPrivate()
     if (threadData) {
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         QMutexLocker locker(&threadData->postEventList.mutex);
+        threadData->postEventList.takeIncoming();
         for (int i = 0; i < threadData->postEventList.size(); ++i) {
             const QPostEvent &pe = threadData->postEventList.at(i);
             if (pe.event) {
@@ -802,6 +806,25 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    // events with the default priority which are never compressed are
+    // pushed without locking the mutex
+    if (priority == Qt::NormalEventPriority
+        && event->type() != QEvent::DeferredDelete && event->type() != QEvent::Quit) {
+        QScopedPointer<QEvent> eventDeleter(event);
+        QPostEventNode *node = new QPostEventNode;
+        eventDeleter.take();
+        node->pe = QPostEvent(receiver, event, priority);
+        event->posted = true;
+        if (data->postEventList.push(pdata, data, node)) {
+            if (data->eventDispatcher)
+                data->eventDispatcher->wakeUp();
+            return;
+        }
+        // the receiver is being moved to another thread
+        event->posted = false;
+        delete node;
+    }
+
     // lock the post event mutex
     data->postEventList.mutex.lock();
 
@@ -821,6 +844,9 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
 
     QMutexUnlocker locker(&data->postEventList.mutex);
 
+    // keep the order of events posted without the mutex
+    data->postEventList.takeIncoming();
+
     // if this is one of the compressible events, do compression
     if (receiver->d_func()->postedEvents
         && self && self->compressEvent(event, receiver, &data->postEventList)) {
@@ -918,6 +944,8 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
 
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->postEventList.takeIncoming();
+
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
     // events, canWait will be set to false.
@@ -1051,6 +1079,8 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
     QThreadData *data = receiver ? receiver->d_func()->threadData : QThreadData::current();
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->postEventList.takeIncoming();
+
     // the QObject destructor calls this function directly.  this can
     // happen while the event loop is in the middle of posting events,
     // and when we get here, we may not have any more posted events
@@ -1116,6 +1146,8 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
 
     QMutexLocker locker(&data->postEventList.mutex);
 
+    data->postEventList.takeIncoming();
+
     if (data->postEventList.size() == 0) {
 #ifndef QT_NO_DEBUG
         qDebug("QCoreApplication::removePostedEvent: Internal error: %p %d is posted",
@@ -1312,9 +1344,12 @@ QString QCoreApplication::translate(const char *context, const char *sourceText,
     if (Q_UNLIKELY(!sourceText))
         return QString();
 
-    if (self && !self->d_func()->translators.isEmpty()) {
-        foreach (const QTranslator *translationFile, self->d_func()->translators) {
-            QString result = translationFile->translate(context, sourceText);
+    if (self) {
+        // iterate without copying the list, avoids touching its shared
+        // reference count from every thread that translates
+        const QTranslatorList &translators = self->d_func()->translators;
+        for (int i = 0; i < translators.size(); i++) {
+            QString result = translators.at(i)->translate(context, sourceText);
             if (!result.isEmpty())
                 return result;
         }
@@ -35,6 +35,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/times.h>
+#ifdef QT_HAVE_EVENTFD
+#  include <sys/eventfd.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -44,31 +47,87 @@ static const long maxOpenFiles = sysconf(_SC_OPEN_MAX);
 
 static const char *sockTypeString[] = { "Read", "Write", "Exception" };
 
-QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
-    : sn_highest(-1),
+#ifdef QT_HAVE_EPOLL_CREATE1
+// events to register for and events that make a socket notifier ready, the
+// latter match the conditions under which select() reports the descriptor
+static const quint32 sockEpollEvents[] = { EPOLLIN, EPOLLOUT, EPOLLPRI };
+static const quint32 sockEpollReady[] = { EPOLLIN | EPOLLHUP | EPOLLERR, EPOLLOUT | EPOLLERR, EPOLLPRI };
+static const int maxEpollEvents = 256;
+#endif
+
+QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate(bool allowepoll)
+    :
+#ifdef QT_HAVE_EPOLL_CREATE1
+    epoll_fd(-1),
+#endif
+    sn_highest(-1),
     interrupt(false)
 {
     // initialize the common parts of the event loop
+#ifdef QT_HAVE_EVENTFD
+    thread_pipe[0] = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    thread_pipe[1] = thread_pipe[0];
+    if (Q_UNLIKELY(thread_pipe[0] == -1)) {
+        perror("QEventDispatcherUNIXPrivate(): Unable to create thread eventfd");
+        qFatal("QEventDispatcherUNIXPrivate(): Can not continue without a thread eventfd");
+    }
+#else
     if (Q_UNLIKELY(qt_safe_pipe(thread_pipe, O_NONBLOCK) == -1)) {
         perror("QEventDispatcherUNIXPrivate(): Unable to create thread pipe");
         qFatal("QEventDispatcherUNIXPrivate(): Can not continue without a thread pipe");
     }
+#endif
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    // select() is used as fallback
+    if (allowepoll && qgetenv("QT_NO_EPOLL").isEmpty()) {
+        epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (Q_UNLIKELY(epoll_fd == -1)) {
+            perror("QEventDispatcherUNIXPrivate(): Unable to create epoll instance");
+            return;
+        }
+
+        struct epoll_event ev;
+        ::memset(&ev, 0, sizeof(struct epoll_event));
+        ev.events = EPOLLIN;
+        ev.data.fd = thread_pipe[0];
+        if (Q_UNLIKELY(::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, thread_pipe[0], &ev) == -1)) {
+            perror("QEventDispatcherUNIXPrivate(): Unable to watch thread wake-up");
+            qt_safe_close(epoll_fd);
+            epoll_fd = -1;
+        }
+    }
+#else
+    Q_UNUSED(allowepoll);
+#endif
 }
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
 {
     // cleanup the common parts of the event loop
     qt_safe_close(thread_pipe[0]);
-    qt_safe_close(thread_pipe[1]);
-
-    // cleanup timers
-    qDeleteAll(timerList);
+    if (thread_pipe[1] != thread_pipe[0])
+        qt_safe_close(thread_pipe[1]);
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1)
+        qt_safe_close(epoll_fd);
+    foreach (QSockNotFd *snfd, epoll_sockets) {
+        qDeleteAll(snfd->list);
+        delete snfd;
+    }
+#endif
 }
 
 int QEventDispatcherUNIXPrivate::doSelect(QEventLoop::ProcessEventsFlags flags, timeval *timeout)
 {
     Q_Q(QEventDispatcherUNIX);
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1)
+        return doEpoll(flags, timeout);
+#endif
+
     // needed in QEventDispatcherUNIX::select()
     timerList.updateCurrentTime();
 
@@ -124,7 +183,9 @@ int QEventDispatcherUNIXPrivate::doSelect(QEventLoop::ProcessEventsFlags flags,
         }
     }
 
-    const int nevents = processThreadWakeUp(nsel);
+    int nevents = 0;
+    if (nsel > 0 && FD_ISSET(thread_pipe[0], &sn_vec[0].select_fds))
+        nevents = processThreadWakeUp();
 
     // activate socket notifiers
     if (! (flags & QEventLoop::ExcludeSocketNotifiers) && nsel > 0 && sn_highest >= 0) {
@@ -133,7 +194,7 @@ int QEventDispatcherUNIXPrivate::doSelect(QEventLoop::ProcessEventsFlags flags,
         for (int type = 0; type < 3; type++) {
             foreach (QSockNot *sn, sn_vec[type].list) {
                 if (FD_ISSET(sn->fd, &sn_vec[type].select_fds))
-                    q->setSocketNotifierPending(sn->obj);
+                    setSocketNotifierPending(sn);
             }
         }
     }
@@ -146,32 +207,237 @@ int QEventDispatcherUNIXPrivate::initThreadWakeUp()
     return thread_pipe[0];
 }
 
-int QEventDispatcherUNIXPrivate::processThreadWakeUp(int nsel)
+int QEventDispatcherUNIXPrivate::processThreadWakeUp()
+{
+    // some other thread woke us up... consume the data on the thread pipe so that
+    // select doesn't immediately return next time
+#ifdef QT_HAVE_EVENTFD
+    quint64 value = 0;
+    qt_safe_read(thread_pipe[0], &value, sizeof(value));
+#else
+    QSTACKARRAY(char, c, 16);
+    while (qt_safe_read(thread_pipe[0], c, sizeof(c)) > 0)
+        ;
+#endif
+
+    if (!wakeUps.testAndSetRelease(1, 0)) {
+        // hopefully, this is dead code
+        qWarning("QEventDispatcherUNIX: internal error, wakeUps.testAndSetRelease(1, 0) failed!");
+    }
+    return 1;
+}
+
+QSockNot *QEventDispatcherUNIXPrivate::findSocketNotifier(QSocketNotifier *notifier) const
+{
+    const int sockfd = notifier->socket();
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (epoll_fd != -1) {
+        const QSockNotFd *snfd = epoll_sockets.value(sockfd, nullptr);
+        if (snfd) {
+            for (int i = 0; i < snfd->list.size(); ++i) {
+                QSockNot *sn = snfd->list.at(i);
+                if (sn->obj == notifier)
+                    return sn;
+            }
+        }
+        return nullptr;
+    }
+#endif
+
+    const QSockNotType::List &list = sn_vec[notifier->type()].list;
+    for (int i = 0; i < list.size(); ++i) {
+        QSockNot *sn = list.at(i);
+        if (sn->obj == notifier && sn->fd == sockfd)
+            return sn;
+    }
+    return nullptr;
+}
+
+void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSockNot *sn)
+{
+    if (!sn->pending) {
+        sn->pending = true;
+        sn_pending_list.append(sn);
+    }
+}
+
+void QEventDispatcherUNIXPrivate::removeSocketNotifierPending(QSockNot *sn)
+{
+    if (!sn->pending)
+        return;
+    sn->pending = false;
+    for (int i = 0; i < sn_pending_list.size(); i++) {
+        if (sn_pending_list.at(i) == sn) {
+            sn_pending_list.remove(i);
+            break;
+        }
+    }
+}
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+int QEventDispatcherUNIXPrivate::doEpoll(QEventLoop::ProcessEventsFlags flags, timeval *timeout)
 {
-    if (nsel > 0 && FD_ISSET(thread_pipe[0], &sn_vec[0].select_fds)) {
-        // some other thread woke us up... consume the data on the thread pipe so that
-        // select doesn't immediately return next time
-        QSTACKARRAY(char, c, 16);
-        while (qt_safe_read(thread_pipe[0], c, sizeof(c)) > 0)
-            ;
+    Q_Q(QEventDispatcherUNIX);
+
+    int nevents = 0;
+    if (flags & QEventLoop::ExcludeSocketNotifiers) {
+        // sockets are registered level-triggered and would end the wait right
+        // away, wait for the thread wake-up only
+        struct pollfd fds;
+        ::memset(&fds, 0, sizeof(struct pollfd));
+        fds.fd = thread_pipe[0];
+        fds.events = POLLIN;
+
+        int msecs = -1;
+        if (timeout)
+            msecs = (timeout->tv_sec * 1000) + ((timeout->tv_usec + 999) / 1000);
+
+        int ret;
+        Q_EINTR_LOOP(ret, ::poll(&fds, 1, msecs));
+        if (ret > 0)
+            nevents += processThreadWakeUp();
+        return (nevents + q->activateSocketNotifiers());
+    }
 
-        if (!wakeUps.testAndSetRelease(1, 0)) {
-            // hopefully, this is dead code
-            qWarning("QEventDispatcherUNIX: internal error, wakeUps.testAndSetRelease(1, 0) failed!");
+    // regular files are always ready, do not block if there are any
+    timeval nowait = { 0l, 0l };
+    if (!epoll_regular.isEmpty())
+        timeout = &nowait;
+
+    struct epoll_event events[maxEpollEvents];
+    const int nsel = qt_safe_epoll_wait(epoll_fd, events, maxEpollEvents, timeout);
+    if (Q_UNLIKELY(nsel == -1)) {
+        // EINVAL... shouldn't happen, so let's complain to stderr
+        // and hope someone sends us a bug report
+        perror("epoll_wait");
+    }
+
+    for (int i = 0; i < nsel; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == thread_pipe[0]) {
+            nevents += processThreadWakeUp();
+            continue;
+        }
+
+        // the descriptor may outlive its notifiers if it was duplicated, the
+        // kernel keeps reporting it so events are keyed by the descriptor
+        QSockNotFd *snfd = epoll_sockets.value(fd, nullptr);
+        if (!snfd) {
+            ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, &events[i]);
+            continue;
+        }
+
+        bool ready = false;
+        for (int j = 0; j < snfd->list.size(); j++) {
+            QSockNot *sn = snfd->list.at(j);
+            if (events[i].events & sockEpollReady[sn->type]) {
+                setSocketNotifierPending(sn);
+                ready = true;
+            }
+        }
+        if (!ready) {
+            // hang-up or error with no notifier interested in it, it is reported
+            // regardless of the registered events so stop watching the socket
+            // until its notifiers change
+            ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, snfd->fd, &events[i]);
+            snfd->events = 0;
+        }
+    }
+
+    for (int i = 0; i < epoll_regular.size(); i++) {
+        const QSockNotFd *snfd = epoll_regular.at(i);
+        for (int j = 0; j < snfd->list.size(); j++) {
+            QSockNot *sn = snfd->list.at(j);
+            if (sn->type != QSocketNotifier::Exception)
+                setSocketNotifierPending(sn);
         }
-        return 1;
     }
-    return 0;
+
+    return (nevents + q->activateSocketNotifiers());
 }
 
+bool QEventDispatcherUNIXPrivate::updateEpoll(QSockNotFd *snfd, bool force)
+{
+    quint32 events = 0;
+    for (int i = 0; i < snfd->list.size(); i++)
+        events |= sockEpollEvents[snfd->list.at(i)->type];
+    if (snfd->regular || (events == snfd->events && !force))
+        return true;
+
+    struct epoll_event ev;
+    ::memset(&ev, 0, sizeof(struct epoll_event));
+    ev.events = events;
+    ev.data.fd = snfd->fd;
+
+    if (events == 0) {
+        // fails if the socket has been closed already, that removes it too
+        ::epoll_ctl(epoll_fd, EPOLL_CTL_DEL, snfd->fd, &ev);
+        snfd->events = 0;
+        return true;
+    }
+
+    int ret = ::epoll_ctl(epoll_fd, snfd->events ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, snfd->fd, &ev);
+    if (ret == -1 && errno == ENOENT) {
+        // the socket was closed while registered and its descriptor reused
+        ret = ::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, snfd->fd, &ev);
+    } else if (ret == -1 && errno == EEXIST) {
+        ret = ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, snfd->fd, &ev);
+    }
+    if (ret == -1) {
+        if (errno == EPERM) {
+            snfd->regular = true;
+            snfd->events = 0;
+            epoll_regular.append(snfd);
+            return true;
+        }
+        return false;
+    }
+    snfd->events = events;
+    return true;
+}
+
+void QEventDispatcherUNIXPrivate::removeEpoll(QSockNotFd *snfd, QSockNot *sn)
+{
+    for (int i = 0; i < snfd->list.size(); i++) {
+        if (snfd->list.at(i) == sn) {
+            snfd->list.remove(i);
+            break;
+        }
+    }
+    removeSocketNotifierPending(sn);
+    delete sn;
+
+    updateEpoll(snfd, false);
+    if (snfd->list.isEmpty()) {
+        if (snfd->regular) {
+            for (int i = 0; i < epoll_regular.size(); i++) {
+                if (epoll_regular.at(i) == snfd) {
+                    epoll_regular.remove(i);
+                    break;
+                }
+            }
+        }
+        epoll_sockets.remove(snfd->fd);
+        delete snfd;
+    }
+}
+#endif // QT_HAVE_EPOLL_CREATE1
+
 /*
- * Internal functions for manipulating timer data structures.  The
- * timerBitVec array is used for keeping track of timer identifiers.
+ * Internal functions for manipulating timer data structures. The timers
+ * are kept in a binary heap, each timer knows its position in it so that
+ * it can be removed without searching for it.
  */
 
+static inline bool timerLessThan(const QTimerInfo *t1, const QTimerInfo *t2)
+{
+    if (t1->timeout == t2->timeout)
+        return t1->sequence < t2->sequence;
+    return t1->timeout < t2->timeout;
+}
+
 QTimerInfoList::QTimerInfoList()
-    : QList<QTimerInfo*>(),
-    firstTimerInfo(nullptr)
+    : nextSequence(0)
 {
     if (Q_LIKELY(QElapsedTimer::isMonotonic())) {
         // detected monotonic timers
@@ -191,6 +457,11 @@ QTimerInfoList::QTimerInfoList()
     }
 }
 
+QTimerInfoList::~QTimerInfoList()
+{
+    qDeleteAll(timers);
+}
+
 timeval QTimerInfoList::updateCurrentTime()
 {
     currentTime = qt_gettime();
@@ -254,18 +525,72 @@ void QTimerInfoList::repairTimersIfNeeded()
         timerRepair(delta);
 }
 
+void QTimerInfoList::heapUp(int index)
+{
+    QTimerInfo *t = heap.at(index);
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        QTimerInfo *p = heap.at(parent);
+        if (!timerLessThan(t, p))
+            break;
+        heap[index] = p;
+        p->heapIndex = index;
+        index = parent;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
+void QTimerInfoList::heapDown(int index)
+{
+    const int size = heap.size();
+    QTimerInfo *t = heap.at(index);
+    forever {
+        int child = 2 * index + 1;
+        if (child >= size)
+            break;
+        if (child + 1 < size && timerLessThan(heap.at(child + 1), heap.at(child)))
+            child++;
+        QTimerInfo *c = heap.at(child);
+        if (!timerLessThan(c, t))
+            break;
+        heap[index] = c;
+        c->heapIndex = index;
+        index = child;
+    }
+    heap[index] = t;
+    t->heapIndex = index;
+}
+
+void QTimerInfoList::heapRemove(QTimerInfo *t)
+{
+    const int index = t->heapIndex;
+    if (index < 0)
+        return; // being activated
+    t->heapIndex = -1;
+
+    QTimerInfo *last = heap.last();
+    heap.pop_back();
+    if (last == t)
+        return;
+
+    // move the last timer into the hole and restore the heap order
+    heap[index] = last;
+    last->heapIndex = index;
+    if (index > 0 && timerLessThan(last, heap.at((index - 1) / 2)))
+        heapUp(index);
+    else
+        heapDown(index);
+}
+
 /*
-  insert timer info into list
+  insert timer info into heap
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
-    int index = size();
-    while (index--) {
-        const QTimerInfo * const t = at(index);
-        if (!(ti->timeout < t->timeout))
-            break;
-    }
-    insert(index+1, ti);
+    ti->sequence = nextSequence++;
+    heap.push_back(ti);
+    heapUp(heap.size() - 1);
 }
 
 /*
@@ -273,9 +598,8 @@ void QTimerInfoList::timerInsert(QTimerInfo *ti)
 */
 void QTimerInfoList::timerRepair(const timeval &diff)
 {
-    // repair all timers
-    for (int i = 0; i < size(); ++i) {
-        QTimerInfo *t = at(i);
+    // repair all timers, shifting all of them keeps the heap order
+    foreach (QTimerInfo *t, timers) {
         t->timeout = t->timeout + diff;
     }
 }
@@ -289,18 +613,11 @@ bool QTimerInfoList::timerWait(timeval &tm)
     timeval currentTime = updateCurrentTime();
     repairTimersIfNeeded();
 
-    // Find first waiting timer not already active
-    QTimerInfo *t = nullptr;
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (!(*it)->activateRef) {
-            t = *it;
-            break;
-        }
-    }
-
-    if (!t)
+    // timers being activated are not in the heap
+    if (heap.isEmpty())
         return false;
 
+    const QTimerInfo *t = heap.first();
     if (currentTime < t->timeout) {
         // time to wait
         tm = t->timeout - currentTime;
@@ -317,62 +634,52 @@ void QTimerInfoList::registerTimer(int timerId, int interval, QObject *object)
 {
     QTimerInfo *t = new QTimerInfo;
     t->id = timerId;
+    t->heapIndex = -1;
     t->interval.tv_sec  = interval / 1000;
     t->interval.tv_usec = (interval % 1000) * 1000;
     t->timeout = updateCurrentTime() + t->interval;
     t->obj = object;
     t->activateRef = nullptr;
 
+    timers.insert(timerId, t);
+    objectTimers.insert(object, t);
     timerInsert(t);
 }
 
+void QTimerInfoList::removeTimer(QTimerInfo *t)
+{
+    heapRemove(t);
+    timers.remove(t->id);
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+
+    // release the timer id
+    if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
+        QAbstractEventDispatcherPrivate::releaseTimerId(t->id);
+
+    delete t;
+}
+
 bool QTimerInfoList::unregisterTimer(int timerId)
 {
-    // set timer inactive
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            // found it
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-
-            // release the timer id
-            if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
-                QAbstractEventDispatcherPrivate::releaseTimerId(timerId);
-
-            delete t;
-            return true;
-        }
-    }
-    // id not found
-    return false;
+    QTimerInfo *t = timers.value(timerId, nullptr);
+    if (!t) // id not found
+        return false;
+
+    objectTimers.remove(t->obj, t);
+    removeTimer(t);
+    return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
-    if (isEmpty())
+    if (timers.isEmpty())
         return false;
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->obj == object) {
-            // object found
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-
-            // release the timer id
-            if (!QObjectPrivate::get(t->obj)->inThreadChangeEvent)
-                QAbstractEventDispatcherPrivate::releaseTimerId(t->id);
-
-            delete t;
-            // move back one so that we don't skip the new current item
-            --i;
-        }
+
+    const QList<QTimerInfo*> objecttimers = objectTimers.values(object);
+    objectTimers.remove(object);
+    foreach (QTimerInfo *t, objecttimers) {
+        removeTimer(t);
     }
     return true;
 }
@@ -380,10 +687,11 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 QList<QPair<int, int> > QTimerInfoList::registeredTimers(QObject *object) const
 {
     QList<QPair<int, int> > list;
-    for (int i = 0; i < count(); ++i) {
-        const QTimerInfo * const t = at(i);
-        if (t->obj == object)
-            list << QPair<int, int>(t->id, t->interval.tv_sec * 1000 + t->interval.tv_usec / 1000);
+    QMultiHash<QObject*, QTimerInfo*>::const_iterator it = objectTimers.constFind(object);
+    while (it != objectTimers.constEnd() && it.key() == object) {
+        const QTimerInfo * const t = it.value();
+        list.prepend(QPair<int, int>(t->id, t->interval.tv_sec * 1000 + t->interval.tv_usec / 1000));
+        ++it;
     }
     return list;
 }
@@ -393,68 +701,49 @@ QList<QPair<int, int> > QTimerInfoList::registeredTimers(QObject *object) const
 */
 int QTimerInfoList::activateTimers()
 {
-    if (isEmpty())
+    if (heap.isEmpty())
         return 0; // nothing to do
 
-    int n_act = 0, maxCount = 0;
-    firstTimerInfo = nullptr;
+    int n_act = 0;
 
     timeval currentTime = updateCurrentTime();
     repairTimersIfNeeded();
 
-
-    // Find out how many timer have expired
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (currentTime < (*it)->timeout)
-            break;
-        maxCount++;
-    }
+    // timers rescheduled from now on wait for the next call, this way every
+    // timer is activated at most once even if its interval is zero
+    const quint64 firstSequence = nextSequence;
 
     //fire the timers.
-    while (maxCount--) {
-        if (isEmpty())
-            break;
-
-        QTimerInfo *currentTimerInfo = first();
-        if (currentTime < currentTimerInfo->timeout)
+    while (!heap.isEmpty()) {
+        QTimerInfo *currentTimerInfo = heap.first();
+        if (currentTime < currentTimerInfo->timeout || currentTimerInfo->sequence >= firstSequence)
             break; // no timer has expired
 
-        if (!firstTimerInfo) {
-            firstTimerInfo = currentTimerInfo;
-        } else if (firstTimerInfo == currentTimerInfo) {
-            // avoid sending the same timer multiple times
-            break;
-        } else if (currentTimerInfo->interval <  firstTimerInfo->interval
-                   || currentTimerInfo->interval == firstTimerInfo->interval) {
-            firstTimerInfo = currentTimerInfo;
-        }
-
-        // remove from list
-        removeFirst();
+        // remove from heap while the event is sent, nested event loops
+        // skip it
+        heapRemove(currentTimerInfo);
 
         // determine next timeout time
         currentTimerInfo->timeout += currentTimerInfo->interval;
         if (currentTimerInfo->timeout < currentTime)
             currentTimerInfo->timeout = currentTime + currentTimerInfo->interval;
 
-        // reinsert timer
-        timerInsert(currentTimerInfo);
         if (currentTimerInfo->interval.tv_usec > 0 || currentTimerInfo->interval.tv_sec > 0)
             n_act++;
 
-        if (!currentTimerInfo->activateRef) {
-            // send event, but don't allow it to recurse
-            currentTimerInfo->activateRef = &currentTimerInfo;
+        // send event, but don't allow it to recurse
+        currentTimerInfo->activateRef = &currentTimerInfo;
 
-            QTimerEvent e(currentTimerInfo->id);
-            QCoreApplication::sendEvent(currentTimerInfo->obj, &e);
+        QTimerEvent e(currentTimerInfo->id);
+        QCoreApplication::sendEvent(currentTimerInfo->obj, &e);
 
-            if (currentTimerInfo)
-                currentTimerInfo->activateRef = nullptr;
+        // reinsert timer unless it was unregistered meanwhile
+        if (currentTimerInfo) {
+            currentTimerInfo->activateRef = nullptr;
+            timerInsert(currentTimerInfo);
         }
     }
 
-    firstTimerInfo = nullptr;
     return n_act;
 }
 
@@ -554,7 +843,6 @@ QSockNotType::QSockNotType()
 {
     FD_ZERO(&select_fds);
     FD_ZERO(&enabled_fds);
-    FD_ZERO(&pending_fds);
 }
 
 QSockNotType::~QSockNotType()
@@ -583,13 +871,55 @@ void QEventDispatcherUNIX::registerSocketNotifier(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (d->epoll_fd != -1) {
+        QSockNotFd *snfd = d->epoll_sockets.value(sockfd, nullptr);
+        if (!snfd) {
+            snfd = new QSockNotFd;
+            snfd->fd = sockfd;
+            snfd->events = 0;
+            snfd->regular = false;
+            d->epoll_sockets.insert(sockfd, snfd);
+        }
+        for (int i = 0; i < snfd->list.size(); ++i) {
+            if (snfd->list.at(i)->type == type) {
+                qWarning("QSocketNotifier: Multiple socket notifiers for "
+                          "same socket %d and type %s", sockfd, sockTypeString[type]);
+            }
+        }
+
+        QSockNot *sn = new QSockNot;
+        sn->obj = notifier;
+        sn->fd = sockfd;
+        sn->type = type;
+        sn->pending = false;
+        snfd->list.append(sn);
+
+        // the descriptor may have been reused since it was registered, always
+        // tell epoll about it
+        if (Q_UNLIKELY(!d->updateEpoll(snfd, true))) {
+            qWarning("QSocketNotifier: Invalid socket %d and type '%s', disabling...",
+                     sockfd, sockTypeString[type]);
+            d->removeEpoll(snfd, sn);
+        }
+        return;
+    }
+#endif
+
+    if (Q_UNLIKELY(sockfd >= FD_SETSIZE)) {
+        qWarning("QSocketNotifier: Socket %d is beyond the select() limit of %d descriptors",
+                 sockfd, FD_SETSIZE);
+        return;
+    }
+
     QSockNotType::List &list = d->sn_vec[type].list;
     fd_set *fds  = &d->sn_vec[type].enabled_fds;
- 
+
     QSockNot *sn = new QSockNot;
     sn->obj = notifier;
     sn->fd = sockfd;
-    sn->queue = &d->sn_vec[type].pending_fds;
+    sn->type = type;
+    sn->pending = false;
 
     int i;
     for (i = 0; i < list.size(); ++i) {
@@ -623,25 +953,32 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
+#ifdef QT_HAVE_EPOLL_CREATE1
+    if (d->epoll_fd != -1) {
+        QSockNot *sn = d->findSocketNotifier(notifier);
+        if (!sn) // not found
+            return;
+        d->removeEpoll(d->epoll_sockets.value(sockfd), sn);
+        return;
+    }
+#endif
+
     QSockNotType::List &list = d->sn_vec[type].list;
     fd_set *fds  =  &d->sn_vec[type].enabled_fds;
     QSockNot *sn = nullptr;
     int i;
     for (i = 0; i < list.size(); ++i) {
-        sn = list[i];
-        if(sn->obj == notifier && sn->fd == sockfd)
+        if (list[i]->obj == notifier && list[i]->fd == sockfd) {
+            sn = list[i];
             break;
+        }
     }
     if (!sn) // not found
         return;
 
     FD_CLR(sockfd, fds);                        // clear fd bit
-    FD_CLR(sockfd, sn->queue);
     // remove from activation list
-    for (int i = 0; i < d->sn_pending_list.count(); i++) {
-        if (d->sn_pending_list.at(i) == sn)
-            d->sn_pending_list.remove(i);
-    }
+    d->removeSocketNotifierPending(sn);
     list.remove(i);                                  // remove notifier found above
     delete sn;
 
@@ -658,9 +995,8 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
 void QEventDispatcherUNIX::setSocketNotifierPending(QSocketNotifier *notifier)
 {
     Q_ASSERT(notifier);
-    int sockfd = notifier->socket();
-    int type = notifier->type();
 #ifndef QT_NO_DEBUG
+    int sockfd = notifier->socket();
     if (Q_UNLIKELY(sockfd < 0 || sockfd >= maxOpenFiles)) {
         qWarning("QSocketNotifier: Internal error");
         return;
@@ -669,20 +1005,11 @@ void QEventDispatcherUNIX::setSocketNotifierPending(QSocketNotifier *notifier)
 #endif
 
     Q_D(QEventDispatcherUNIX);
-    QSockNotType::List &list = d->sn_vec[type].list;
-    QSockNot *sn = nullptr;
-    for (int i = 0; i < list.size(); ++i) {
-        sn = list[i];
-        if(sn->obj == notifier && sn->fd == sockfd)
-            break;
-    }
+    QSockNot *sn = d->findSocketNotifier(notifier);
     if (!sn) // not found
         return;
 
-    if (! FD_ISSET(sn->fd, sn->queue)) {
-        d->sn_pending_list.append(sn);
-        FD_SET(sn->fd, sn->queue);
-    }
+    d->setSocketNotifierPending(sn);
 }
 
 int QEventDispatcherUNIX::activateTimers()
@@ -704,8 +1031,8 @@ int QEventDispatcherUNIX::activateSocketNotifiers()
     while (!d->sn_pending_list.isEmpty()) {
         QSockNot *sn = d->sn_pending_list.value(0);
         d->sn_pending_list.remove(0);
-        if (FD_ISSET(sn->fd, sn->queue)) {
-            FD_CLR(sn->fd, sn->queue);
+        if (sn->pending) {
+            sn->pending = false;
             QCoreApplication::sendEvent(sn->obj, &event);
             ++n_act;
         }
@@ -760,15 +1087,21 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
 bool QEventDispatcherUNIX::hasPendingEvents()
 {
     QThreadData *currentThreadData = QThreadData::current();
-    return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
+    return (currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset)
+        || currentThreadData->postEventList.hasIncoming();
 }
 
 void QEventDispatcherUNIX::wakeUp()
 {
     Q_D(QEventDispatcherUNIX);
     if (d->wakeUps.testAndSetAcquire(0, 1)) {
+#ifdef QT_HAVE_EVENTFD
+        const quint64 value = 1;
+        qt_safe_write(d->thread_pipe[1], &value, sizeof(value));
+#else
         char c = 0;
-        qt_safe_write( d->thread_pipe[1], &c, 1);
+        qt_safe_write(d->thread_pipe[1], &c, 1);
+#endif
     }
 }
 
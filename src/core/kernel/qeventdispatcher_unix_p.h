@@ -37,6 +37,7 @@
 #include "qabstracteventdispatcher_p.h"
 #include "qcore_unix_p.h"
 #include "qstdcontainers_p.h"
+#include "qhash.h"
 
 #include <sys/time.h>
 #include <sys/select.h>
@@ -46,13 +47,17 @@ QT_BEGIN_NAMESPACE
 // internal timer info
 struct QTimerInfo {
     int id;           // - timer identifier
+    int heapIndex;    // - position in the timer heap, -1 while activated
+    quint64 sequence; // - orders timers with the same timeout
     timeval interval; // - timer interval
     timeval timeout;  // - when to sent event
     QObject *obj;     // - object to receive event
     QTimerInfo **activateRef; // - ref from activateTimers
 };
 
-class QTimerInfoList : public QList<QTimerInfo*>
+// timers in a binary heap ordered by timeout, timers with the same timeout
+// are activated in the order they were (re)scheduled
+class QTimerInfoList
 {
     timeval previousTime;
     clock_t previousTicks;
@@ -61,11 +66,19 @@ class QTimerInfoList : public QList<QTimerInfo*>
 
     bool timeChanged(timeval *delta);
 
-    // state variables used by activateTimers()
-    QTimerInfo *firstTimerInfo;
+    QStdVector<QTimerInfo*> heap;
+    QHash<int, QTimerInfo*> timers;
+    QMultiHash<QObject*, QTimerInfo*> objectTimers;
+    quint64 nextSequence;
+
+    void heapUp(int index);
+    void heapDown(int index);
+    void heapRemove(QTimerInfo *t);
+    void removeTimer(QTimerInfo *t);
 
 public:
     QTimerInfoList();
+    ~QTimerInfoList();
 
     timeval currentTime;
     timeval updateCurrentTime();
@@ -89,7 +102,8 @@ struct QSockNot
 {
     QSocketNotifier *obj;
     int fd;
-    fd_set *queue;
+    int type;
+    bool pending;
 };
 
 class QSockNotType
@@ -103,9 +117,20 @@ public:
     List list;
     fd_set select_fds;
     fd_set enabled_fds;
-    fd_set pending_fds;
+};
 
+#ifdef QT_HAVE_EPOLL_CREATE1
+// socket notifiers of all types for a single socket, registered with epoll
+struct QSockNotFd
+{
+    int fd;
+    QSockNotType::List list;
+    // events the socket is registered for, 0 if it is not registered
+    quint32 events;
+    // epoll does not support regular files, they are always ready like with select()
+    bool regular;
 };
+#endif
 
 class QEventDispatcherUNIXPrivate;
 
@@ -150,13 +175,29 @@ class Q_CORE_EXPORT QEventDispatcherUNIXPrivate : public QAbstractEventDispatche
     Q_DECLARE_PUBLIC(QEventDispatcherUNIX)
 
 public:
-    QEventDispatcherUNIXPrivate();
+    QEventDispatcherUNIXPrivate(bool allowepoll = true);
     ~QEventDispatcherUNIXPrivate();
 
     int doSelect(QEventLoop::ProcessEventsFlags flags, timeval *timeout);
     int initThreadWakeUp();
-    int processThreadWakeUp(int nsel);
+    int processThreadWakeUp();
+
+    QSockNot *findSocketNotifier(QSocketNotifier *notifier) const;
+    void setSocketNotifierPending(QSockNot *sn);
+    void removeSocketNotifierPending(QSockNot *sn);
+
+#ifdef QT_HAVE_EPOLL_CREATE1
+    int doEpoll(QEventLoop::ProcessEventsFlags flags, timeval *timeout);
+    bool updateEpoll(QSockNotFd *snfd, bool force);
+    void removeEpoll(QSockNotFd *snfd, QSockNot *sn);
+
+    // -1 if select() is used
+    int epoll_fd;
+    QHash<int, QSockNotFd*> epoll_sockets;
+    QStdVector<QSockNotFd*> epoll_regular;
+#endif
 
+    // both ends are the same descriptor if eventfd() is used
     int thread_pipe[2];
 
     // highest fd for all socket notifiers
@@ -24,12 +24,15 @@
 #include "qdatetime.h"
 #include "qbytearray.h"
 #include "qmutex.h"
+#include "qatomic.h"
 #include "qstring.h"
 #include "qstringlist.h"
 #include "qvector.h"
 #include "qlocale.h"
 #include "qstdcontainers_p.h"
 
+#include <atomic>
+
 #ifndef QT_BOOTSTRAPPED
 #  include "qeasingcurve.h"
 #  include "qjsondocument.h"
@@ -204,7 +207,7 @@ QT_BEGIN_NAMESPACE
     { STR, sizeof(STR) - 1, TP }
 
 /* Note: these MUST be in the order of the enums */
-static const struct MetaTypeTblData {
+static constexpr struct MetaTypeTblData {
     const char* typeName;
     const int typeNameLength;
     const QMetaType::Type type;
@@ -300,7 +303,52 @@ static const struct MetaTypeTblData {
     QT_ADD_STATIC_METATYPE("QMap<QString,QVariant>", QMetaType::QVariantMap),
     QT_ADD_STATIC_METATYPE("qreal", QMetaType::QReal),
 };
-static const qint16 MetaTypeTblSize = sizeof(MetaTypeTbl) / sizeof(MetaTypeTblData);
+static constexpr qint16 MetaTypeTblSize = sizeof(MetaTypeTbl) / sizeof(MetaTypeTblData);
+
+/*
+    Open addressing index of MetaTypeTbl built at compile time, each slot
+    holds an index into the table or -1 if it is free.
+*/
+static const int MetaTypeTblIndexSize = 256;
+
+struct MetaTypeTblIndex
+{
+    qint16 entries[MetaTypeTblIndexSize];
+    int maxProbes;
+};
+
+static constexpr uint qMetaTypeNameHash(const char *typeName, int length)
+{
+    // FNV-1a
+    uint hash = 2166136261u;
+    for (int i = 0; i < length; i++) {
+        hash ^= uchar(typeName[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static constexpr MetaTypeTblIndex qMetaTypeTblIndex()
+{
+    MetaTypeTblIndex index = { {}, 0 };
+    for (int i = 0; i < MetaTypeTblIndexSize; i++) {
+        index.entries[i] = -1;
+    }
+    for (qint16 i = 0; i < MetaTypeTblSize; i++) {
+        uint slot = qMetaTypeNameHash(MetaTypeTbl[i].typeName, MetaTypeTbl[i].typeNameLength) % MetaTypeTblIndexSize;
+        int probes = 1;
+        while (index.entries[slot] != -1) {
+            slot = (slot + 1) % MetaTypeTblIndexSize;
+            probes++;
+        }
+        index.entries[slot] = i;
+        index.maxProbes = qMax(index.maxProbes, probes);
+    }
+    return index;
+}
+
+static constexpr MetaTypeTblIndex MetaTypeTblHash = qMetaTypeTblIndex();
+static_assert(MetaTypeTblHash.maxProbes <= 4, "MetaTypeTbl index has too many collisions");
 
 struct QMetaTypeGuiHelper
 {
@@ -316,25 +364,183 @@ Q_CORE_EXPORT const QMetaTypeGuiHelper *qMetaTypeGuiHelper = nullptr;
 class QCustomTypeInfo
 {
 public:
-    QCustomTypeInfo() : constr(nullptr), destr(nullptr),
+    QCustomTypeInfo(const QByteArray &name, uint hash, QMetaType::Constructor constructor,
+                    QMetaType::Destructor destructor, int aliasId)
+        : typeName(name), typeNameHash(hash), constr(constructor), destr(destructor),
 #ifndef QT_NO_DATASTREAM
-    saveOp(nullptr), loadOp(nullptr),
+        saveOp(nullptr), loadOp(nullptr),
 #endif
-    alias(-1)
+        alias(aliasId), registered(true)
     {}
 
-    QByteArray typeName;
-    QMetaType::Constructor constr;
-    QMetaType::Destructor destr;
+    const QByteArray typeName;
+    const uint typeNameHash;
+    const QMetaType::Constructor constr;
+    const QMetaType::Destructor destr;
 #ifndef QT_NO_DATASTREAM
-    QMetaType::SaveOperator saveOp;
-    QMetaType::LoadOperator loadOp;
+    std::atomic<QMetaType::SaveOperator> saveOp;
+    std::atomic<QMetaType::LoadOperator> loadOp;
 #endif
-    int alias;
+    const int alias;
+    // entries are never removed, unregistering only clears this
+    std::atomic<bool> registered;
 };
 
-Q_DECLARE_TYPEINFO(QCustomTypeInfo, Q_MOVABLE_TYPE);
-Q_GLOBAL_STATIC(QStdVector<QCustomTypeInfo>, customTypes)
+/*
+    The custom types as seen by readers. The index maps name hashes to type
+    indexes (plus one, zero marks a free slot) and is kept at most half full.
+*/
+struct QCustomTypeSnapshot
+{
+    QCustomTypeSnapshot(int typesCapacity)
+        : capacity(typesCapacity),
+        types(new QCustomTypeInfo*[typesCapacity]),
+        index(new QAtomicInt[typesCapacity * 2])
+    {}
+    ~QCustomTypeSnapshot()
+    {
+        delete [] types;
+        delete [] index;
+    }
+
+    const int capacity;
+    QCustomTypeInfo **types;
+    QAtomicInt *index;
+};
+
+/*
+    Append-only table of custom types, lookups do not lock. Writers are
+    serialized by customTypesLock() and either fill the free capacity of the
+    current snapshot or publish a copy twice as big. Entries never move and
+    replaced snapshots are kept until exit since readers may still use them.
+*/
+class QCustomTypeTable
+{
+public:
+    QCustomTypeTable();
+    ~QCustomTypeTable();
+
+    QCustomTypeInfo *at(int idx) const;
+    int find(const char *typeName, int length, uint hash) const;
+
+    int count() const { return m_count.load(); }
+    int append(QCustomTypeInfo *info);
+
+private:
+    Q_DISABLE_COPY(QCustomTypeTable)
+
+    static void insert(QCustomTypeSnapshot *snapshot, int idx);
+
+    mutable QAtomicInt m_count;
+    mutable QAtomicPointer<QCustomTypeSnapshot> m_snapshot;
+    QStdVector<QCustomTypeSnapshot*> m_retired;
+};
+
+QCustomTypeTable::QCustomTypeTable()
+{
+}
+
+QCustomTypeTable::~QCustomTypeTable()
+{
+    QCustomTypeSnapshot *snapshot = m_snapshot.load();
+    if (snapshot) {
+        for (int i = 0; i < m_count.load(); i++) {
+            delete snapshot->types[i];
+        }
+        delete snapshot;
+    }
+    qDeleteAll(m_retired);
+}
+
+/*
+    Returns the entry for the custom type index \a idx (the type ID minus
+    QMetaType::User), or null if there is no such entry.
+*/
+inline QCustomTypeInfo *QCustomTypeTable::at(int idx) const
+{
+    // the snapshot is published before the count
+    if (idx < 0 || idx >= m_count.loadAcquire())
+        return nullptr;
+    return m_snapshot.loadAcquire()->types[idx];
+}
+
+/*
+    Returns the index of the registered custom type named \a typeName, or
+    -1 if there is no such type.
+*/
+int QCustomTypeTable::find(const char *typeName, int length, uint hash) const
+{
+    const QCustomTypeSnapshot *snapshot = m_snapshot.loadAcquire();
+    if (!snapshot)
+        return -1;
+
+    const int mask = snapshot->capacity * 2 - 1;
+    int slot = hash & mask;
+    forever {
+        const int value = snapshot->index[slot].loadAcquire();
+        if (value == 0)
+            return -1;
+        const QCustomTypeInfo *info = snapshot->types[value - 1];
+        if (info->typeNameHash == hash && info->typeName.size() == length
+            && ::memcmp(info->typeName.constData(), typeName, length) == 0) {
+            // there is one slot per name
+            return info->registered.load() ? value - 1 : -1;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+/*
+    Adds the slot for the type at \a idx, replacing the slot of an
+    unregistered type of the same name.
+*/
+void QCustomTypeTable::insert(QCustomTypeSnapshot *snapshot, int idx)
+{
+    const QCustomTypeInfo *info = snapshot->types[idx];
+    const int mask = snapshot->capacity * 2 - 1;
+    int slot = info->typeNameHash & mask;
+    forever {
+        const int value = snapshot->index[slot].load();
+        if (value == 0)
+            break;
+        const QCustomTypeInfo *other = snapshot->types[value - 1];
+        if (other->typeNameHash == info->typeNameHash && other->typeName == info->typeName)
+            break;
+        slot = (slot + 1) & mask;
+    }
+    snapshot->index[slot].storeRelease(idx + 1);
+}
+
+/*
+    Takes ownership of \a info and returns its index, customTypesLock() must
+    be locked.
+*/
+int QCustomTypeTable::append(QCustomTypeInfo *info)
+{
+    const int idx = m_count.load();
+    QCustomTypeSnapshot *snapshot = m_snapshot.load();
+    if (!snapshot || idx == snapshot->capacity) {
+        QCustomTypeSnapshot *grown = new QCustomTypeSnapshot(snapshot ? snapshot->capacity * 2 : 64);
+        for (int i = 0; i < idx; i++) {
+            grown->types[i] = snapshot->types[i];
+            // unregistered types are not looked up by name
+            if (grown->types[i]->registered.load())
+                insert(grown, i);
+        }
+        m_snapshot.storeRelease(grown);
+        if (snapshot)
+            m_retired.append(snapshot);
+        snapshot = grown;
+    }
+    // the entry must be reachable by index before its slot is published,
+    // find() may return the index as soon as the slot is visible
+    snapshot->types[idx] = info;
+    m_count.storeRelease(idx + 1);
+    insert(snapshot, idx);
+    return idx;
+}
+
+Q_GLOBAL_STATIC(QCustomTypeTable, customTypes)
 Q_GLOBAL_STATIC(QMutex, customTypesLock)
 
 #ifndef QT_NO_DATASTREAM
@@ -356,13 +562,11 @@ void QMetaType::registerStreamOperators(int idx, SaveOperator saveOp,
 {
     if (idx < User)
         return; //builtin types should not be registered;
-    QMutexLocker locker(customTypesLock());
-    QStdVector<QCustomTypeInfo> *ct = customTypes();
-    if (!ct)
+    QCustomTypeInfo *inf = customTypes()->at(idx - User);
+    if (!inf)
         return;
-    QCustomTypeInfo &inf = (*ct)[idx - User];
-    inf.saveOp = saveOp;
-    inf.loadOp = loadOp;
+    inf->saveOp.store(saveOp);
+    inf->loadOp.store(loadOp);
 }
 #endif // QT_NO_DATASTREAM
 
@@ -383,10 +587,8 @@ const char *QMetaType::typeName(int type)
     } else if (type >= FirstCoreExtType && type <= LastCoreExtType) {
         return MetaTypeTbl[type - FirstCoreExtType + GuiTypeCount + LastCoreType + 2].typeName;
     } else if (type >= User) {
-        QMutexLocker locker(customTypesLock());
-        const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-        return ct && ct->count() > type - User && !ct->at(type - User).typeName.isEmpty()
-                ? ct->at(type - User).typeName.constData() : nullptr;
+        const QCustomTypeInfo *inf = customTypes()->at(type - User);
+        return inf && inf->registered.load() ? inf->typeName.constData() : nullptr;
     }
 
     return nullptr;
@@ -395,36 +597,32 @@ const char *QMetaType::typeName(int type)
 /*! \internal
     Similar to QMetaType::type(), but only looks in the static set of types.
 */
-static inline int qMetaTypeStaticType(const char *typeName, int length)
+static inline int qMetaTypeStaticType(const char *typeName, int length, uint hash)
 {
-    for (qint16 i = 0; i < MetaTypeTblSize; i++) {
-        if (length == MetaTypeTbl[i].typeNameLength && strcmp(typeName, MetaTypeTbl[i].typeName) == 0) {
-            return MetaTypeTbl[i].type;
+    uint slot = hash % MetaTypeTblIndexSize;
+    while (MetaTypeTblHash.entries[slot] != -1) {
+        const MetaTypeTblData &data = MetaTypeTbl[MetaTypeTblHash.entries[slot]];
+        if (length == data.typeNameLength && ::memcmp(typeName, data.typeName, length) == 0) {
+            return data.type;
         }
-     }
+        slot = (slot + 1) % MetaTypeTblIndexSize;
+    }
     return 0;
 }
 
 /*! \internal
     Similar to QMetaType::type(), but only looks in the custom set of
-    types, and doesn't lock the mutex.
+    types.
 */
-static int qMetaTypeCustomType_unlocked(const char *typeName, int length)
+static int qMetaTypeCustomType(const char *typeName, int length, uint hash)
 {
-    const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-    if (!ct)
+    const int idx = customTypes()->find(typeName, length, hash);
+    if (idx < 0)
         return 0;
-
-    for (int v = 0; v < ct->count(); ++v) {
-        const QCustomTypeInfo &customInfo = ct->at(v);
-        if ((length == customInfo.typeName.size())
-            && strcmp(typeName, customInfo.typeName.constData()) == 0) {
-            if (customInfo.alias >= 0)
-                return customInfo.alias;
-            return v + QMetaType::User;
-        }
-    }
-    return 0;
+    const QCustomTypeInfo *inf = customTypes()->at(idx);
+    if (inf->alias >= 0)
+        return inf->alias;
+    return idx + QMetaType::User;
 }
 
 /*! \internal
@@ -445,23 +643,27 @@ int QMetaType::registerType(const char *typeName, Destructor destructor,
 #else
     NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
 #endif
+    const uint hash = qMetaTypeNameHash(normalizedTypeName.constData(),
+                                        normalizedTypeName.size());
 
     int idx = qMetaTypeStaticType(normalizedTypeName.constData(),
-                                  normalizedTypeName.size());
+                                  normalizedTypeName.size(), hash);
+
+    if (!idx) {
+        // types are registered over and over again, only lock when the
+        // type is not known yet
+        idx = qMetaTypeCustomType(normalizedTypeName.constData(),
+                                  normalizedTypeName.size(), hash);
+    }
 
     if (!idx) {
         QMutexLocker locker(customTypesLock());
-        QStdVector<QCustomTypeInfo> *ct = customTypes();
-        idx = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                           normalizedTypeName.size());
+        idx = qMetaTypeCustomType(normalizedTypeName.constData(),
+                                  normalizedTypeName.size(), hash);
         if (!idx) {
-            QCustomTypeInfo inf;
-            inf.typeName = normalizedTypeName;
-            inf.constr = constructor;
-            inf.destr = destructor;
-            inf.alias = -1;
-            idx = ct->size() + User;
-            ct->append(inf);
+            QCustomTypeInfo *inf = new QCustomTypeInfo(normalizedTypeName, hash,
+                                                       constructor, destructor, -1);
+            idx = customTypes()->append(inf) + User;
         }
     }
     return idx;
@@ -483,9 +685,11 @@ int QMetaType::registerTypedef(const char* typeName, int aliasId)
 #else
     NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
 #endif
+    const uint hash = qMetaTypeNameHash(normalizedTypeName.constData(),
+                                        normalizedTypeName.size());
 
     int idx = qMetaTypeStaticType(normalizedTypeName.constData(),
-                                  normalizedTypeName.size());
+                                  normalizedTypeName.size(), hash);
 
     if (idx) {
         Q_ASSERT(idx == aliasId);
@@ -493,19 +697,15 @@ int QMetaType::registerTypedef(const char* typeName, int aliasId)
     }
 
     QMutexLocker locker(customTypesLock());
-    QStdVector<QCustomTypeInfo> *ct = customTypes();
-    idx = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                       normalizedTypeName.size());
+    idx = qMetaTypeCustomType(normalizedTypeName.constData(),
+                              normalizedTypeName.size(), hash);
 
     if (idx)
         return idx;
 
-    QCustomTypeInfo inf;
-    inf.typeName = normalizedTypeName;
-    inf.alias = aliasId;
-    inf.constr = nullptr;
-    inf.destr = nullptr;
-    ct->append(inf);
+    QCustomTypeInfo *inf = new QCustomTypeInfo(normalizedTypeName, hash,
+                                               nullptr, nullptr, aliasId);
+    customTypes()->append(inf);
     return aliasId;
 }
 
@@ -528,14 +728,11 @@ void QMetaType::unregisterType(const char *typeName)
     NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
 #endif
     QMutexLocker locker(customTypesLock());
-    QStdVector<QCustomTypeInfo> *ct = customTypes();
+    QCustomTypeTable *ct = customTypes();
     for (int v = 0; v < ct->count(); ++v) {
-        if (ct->at(v).typeName == typeName) {
-            QCustomTypeInfo &inf = (*ct)[v];
-            inf.typeName.clear();
-            inf.constr = nullptr;
-            inf.destr = nullptr;
-            inf.alias = -1;
+        QCustomTypeInfo *inf = ct->at(v);
+        if (inf->typeName == normalizedTypeName) {
+            inf->registered.store(false, std::memory_order_release);
         }
     }
 }
@@ -554,9 +751,8 @@ bool QMetaType::isRegistered(int type)
     } else if (type < 0) {
         return false;
     }
-    QMutexLocker locker(customTypesLock());
-    const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-    return (ct && (ct->count() > type - User) && !ct->at(type - User).typeName.isEmpty());
+    const QCustomTypeInfo *inf = customTypes()->at(type - User);
+    return (inf && inf->registered.load());
 }
 
 /*!
@@ -570,18 +766,20 @@ int QMetaType::type(const char *typeName)
     int length = qstrlen(typeName);
     if (!length)
         return 0;
-    int type = qMetaTypeStaticType(typeName, length);
+    const uint hash = qMetaTypeNameHash(typeName, length);
+    int type = qMetaTypeStaticType(typeName, length, hash);
     if (!type) {
-        QMutexLocker locker(customTypesLock());
-        type = qMetaTypeCustomType_unlocked(typeName, length);
+        type = qMetaTypeCustomType(typeName, length, hash);
 #ifndef QT_NO_QOBJECT
         if (!type) {
             const NS(QByteArray) normalizedTypeName = QMetaObject::normalizedType(typeName);
+            const uint normalizedHash = qMetaTypeNameHash(normalizedTypeName.constData(),
+                                                          normalizedTypeName.size());
             type = qMetaTypeStaticType(normalizedTypeName.constData(),
-                                       normalizedTypeName.size());
+                                       normalizedTypeName.size(), normalizedHash);
             if (!type) {
-                type = qMetaTypeCustomType_unlocked(normalizedTypeName.constData(),
-                                                    normalizedTypeName.size());
+                type = qMetaTypeCustomType(normalizedTypeName.constData(),
+                                           normalizedTypeName.size(), normalizedHash);
             }
         }
 #endif
@@ -767,12 +965,11 @@ bool QMetaType::save(QDataStream &stream, int type, const void *data)
         qMetaTypeGuiHelper[type - FirstGuiType].saveOp(stream, data);
         break;
     default: {
-        QMutexLocker locker(customTypesLock());
-        const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-        if (!ct)
+        const QCustomTypeInfo *inf = customTypes()->at(type - User);
+        if (!inf)
             return false;
 
-        SaveOperator saveOp = ct->at(type - User).saveOp;
+        SaveOperator saveOp = inf->saveOp.load();
 
         if (!saveOp)
             return false;
@@ -965,12 +1162,11 @@ bool QMetaType::load(QDataStream &stream, int type, void *data)
         qMetaTypeGuiHelper[type - FirstGuiType].loadOp(stream, data);
         break;
     default: {
-        QMutexLocker locker(customTypesLock());
-        const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-        if (!ct)
+        const QCustomTypeInfo *inf = customTypes()->at(type - User);
+        if (!inf)
             return false;
 
-        LoadOperator loadOp = ct->at(type - User).loadOp;
+        LoadOperator loadOp = inf->loadOp.load();
 
         if (!loadOp)
             return false;
@@ -1194,13 +1390,10 @@ void *QMetaType::construct(int type, const void *copy)
             return nullptr;
         constr = qMetaTypeGuiHelper[type - FirstGuiType].constr;
     } else {
-        QMutexLocker locker(customTypesLock());
-        const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-        if (type < User || !ct || ct->count() <= type - User)
+        const QCustomTypeInfo *inf = customTypes()->at(type - User);
+        if (type < User || !inf || !inf->registered.load() || !inf->constr)
             return nullptr;
-        if (ct->at(type - User).typeName.isEmpty())
-            return nullptr;
-        constr = ct->at(type - User).constr;
+        constr = inf->constr;
     }
 
     return constr(copy);
@@ -1358,13 +1551,10 @@ void QMetaType::destroy(int type, void *data)
                 return;
             destr = qMetaTypeGuiHelper[type - FirstGuiType].destr;
         } else {
-            QMutexLocker locker(customTypesLock());
-            const QStdVector<QCustomTypeInfo> * const ct = customTypes();
-            if (type < User || !ct || ct->count() <= type - User)
-                break;
-            if (ct->at(type - User).typeName.isEmpty())
+            const QCustomTypeInfo *inf = customTypes()->at(type - User);
+            if (type < User || !inf || !inf->registered.load() || !inf->destr)
                 break;
-            destr = ct->at(type - User).destr;
+            destr = inf->destr;
         }
         destr(data);
         break; }
@@ -141,7 +141,8 @@ QObjectPrivate::~QObjectPrivate()
             threadData->eventDispatcher->unregisterTimers(q_ptr);
     }
 
-    if (postedEvents)
+    // events posted without locking are counted once they are in the list
+    if (postedEvents || (threadData && threadData->postEventList.hasIncoming()))
         QCoreApplication::removePostedEvents(q_ptr, 0);
 
     if (threadData)
@@ -1103,8 +1104,11 @@ void QObject::moveToThread(QThread *targetThread)
     // keep currentData alive (since we've got it locked)
     currentData->ref();
 
-    // move the object
+    // move the object, events posted to it without locking must be in the
+    // list by then
+    currentData->postEventList.closeIncoming();
     d_func()->setThreadData_helper(currentData, targetData);
+    currentData->postEventList.openIncoming();
 
     locker.unlock();
 
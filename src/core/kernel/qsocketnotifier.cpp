@@ -75,6 +75,14 @@ QT_BEGIN_NAMESPACE
     QTcpSocket and QUdpSocket provide notification through signals, so
     there is normally no need to use a QSocketNotifier on them.
 
+    On Linux the event dispatcher watches the descriptors with epoll,
+    which has no limit on the descriptor numbers and whose cost does not
+    grow with the number of idle descriptors. Descriptors that are
+    closed while a notifier is enabled for them are silently forgotten.
+    When the \c QT_NO_EPOLL environment variable is set select() is
+    used instead, it can not watch descriptors beyond \c FD_SETSIZE
+    but warns about and disables notifiers for closed descriptors.
+
     \sa QFile, QProcess, QTcpSocket, QUdpSocket
 */
 
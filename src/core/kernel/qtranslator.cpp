@@ -28,8 +28,11 @@
 #include "qlocale.h"
 #include "qdir.h"
 #include "qtextcodec.h"
-#include "qstdcontainers_p.h"
+#include "qendian.h"
 #include "qdebug.h"
+#include "qtranslator_p.h"
+
+#include <sys/mman.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -41,31 +44,202 @@ static bool isCharEqual(const char* const byteptr, const int bytelen, const char
     return (::memcmp(byteptr, charptr, charlen) == 0);
 }
 
-struct QTranslatorCache
+// checks that count entries of entrysize at offset fit into size bytes
+static inline bool isTableValid(const quint32 offset, const quint32 count, const quint32 entrysize,
+                                const qint64 size)
 {
-    QByteArray trmsgctxt;
-    QByteArray trmsgid;
-    QByteArray trmsgstr;
-    QByteArray trmsgid_plural;
-    QByteArray trmsgstr_plural;
-};
+    return ((offset % sizeof(quint32)) == 0
+        && (qint64(offset) + (qint64(count) * entrysize)) <= size);
+}
 
 class QTranslatorPrivate
 {
 public:
     QTranslatorPrivate();
-
-    QStdVector<QTranslatorCache> cache;
-    mutable QTextConverter converter;
+    ~QTranslatorPrivate();
+
+    void clear();
+    bool setData(const uchar *data, const qint64 size);
+    bool find(const char *context, const char *sourceText, const int sourcelen,
+              const char **trmsgstr, int *trmsgstrlen) const;
+    inline QString decode(const char *trmsgstr, const int trmsgstrlen) const;
+
+    QByteArray rawdata;
+    void *mapped;
+    qint64 mappedsize;
+
+    const QTranslatorHeader *header;
+    const QTranslatorMessage *messages;
+    const QTranslatorNode *nodes;
+    const quint32 *buckets;
+    const char *strings;
+    quint32 messagecount;
+    quint32 nodecount;
+    quint32 bucketcount;
+    quint32 stringsize;
+    // set once by load, decoding is stateless so lookups need no locking
+    QTextCodec *codec;
+    bool utf8;
 
 private:
+    inline bool string(const quint32 *string, const char **data, int *length) const;
+
     Q_DISABLE_COPY(QTranslatorPrivate);
 };
 
 QTranslatorPrivate::QTranslatorPrivate()
+    : mapped(nullptr),
+    mappedsize(0),
+    header(nullptr),
+    messages(nullptr),
+    nodes(nullptr),
+    buckets(nullptr),
+    strings(nullptr),
+    messagecount(0),
+    nodecount(0),
+    bucketcount(0),
+    stringsize(0),
+    codec(nullptr),
+    utf8(false)
 {
 }
 
+QTranslatorPrivate::~QTranslatorPrivate()
+{
+    clear();
+}
+
+void QTranslatorPrivate::clear()
+{
+    if (mapped) {
+        ::munmap(mapped, mappedsize);
+        mapped = nullptr;
+        mappedsize = 0;
+    }
+    rawdata.clear();
+    header = nullptr;
+    messages = nullptr;
+    nodes = nullptr;
+    buckets = nullptr;
+    strings = nullptr;
+    messagecount = 0;
+    nodecount = 0;
+    bucketcount = 0;
+    stringsize = 0;
+    codec = nullptr;
+    utf8 = false;
+}
+
+bool QTranslatorPrivate::setData(const uchar *data, const qint64 size)
+{
+    if (Q_UNLIKELY(size < qint64(sizeof(QTranslatorHeader)))) {
+        qWarning("QTranslator::load: Invalid magic");
+        return false;
+    }
+
+    const QTranslatorHeader *trheader = reinterpret_cast<const QTranslatorHeader*>(data);
+    if (Q_UNLIKELY(::memcmp(trheader->magic, QT_TRANSLATOR_MAGIC, sizeof(QT_TRANSLATOR_MAGIC)) != 0)) {
+        qWarning("QTranslator::load: Invalid magic");
+        return false;
+    }
+    if (Q_UNLIKELY(qFromLittleEndian(trheader->version) != QTranslatorVersion)) {
+        qWarning("QTranslator::load: Unsupported version %u", qFromLittleEndian(trheader->version));
+        return false;
+    }
+
+    const quint32 trmessagecount = qFromLittleEndian(trheader->messagecount);
+    const quint32 trmessageoffset = qFromLittleEndian(trheader->messageoffset);
+    const quint32 trnodecount = qFromLittleEndian(trheader->nodecount);
+    const quint32 trnodeoffset = qFromLittleEndian(trheader->nodeoffset);
+    const quint32 trbucketcount = qFromLittleEndian(trheader->bucketcount);
+    const quint32 trbucketoffset = qFromLittleEndian(trheader->bucketoffset);
+    const quint32 trstringsize = qFromLittleEndian(trheader->stringsize);
+    const quint32 trstringoffset = qFromLittleEndian(trheader->stringoffset);
+    if (Q_UNLIKELY(trbucketcount == 0 || (trbucketcount & (trbucketcount - 1)) != 0
+        || !isTableValid(trmessageoffset, trmessagecount, sizeof(QTranslatorMessage), size)
+        || !isTableValid(trnodeoffset, trnodecount, sizeof(QTranslatorNode), size)
+        || !isTableValid(trbucketoffset, trbucketcount, sizeof(quint32), size)
+        || (qint64(trstringoffset) + trstringsize) > size
+        || ::memchr(trheader->codec, '\0', sizeof(trheader->codec)) == nullptr)) {
+        qWarning("QTranslator::load: Corrupted data");
+        return false;
+    }
+
+    QTextCodec *trcodec = QTextCodec::codecForName(QByteArray(trheader->codec));
+    if (Q_UNLIKELY(!trcodec)) {
+        qWarning("QTranslator::load: Unsupported codec %s", trheader->codec);
+        return false;
+    }
+
+    header = trheader;
+    messages = reinterpret_cast<const QTranslatorMessage*>(data + trmessageoffset);
+    nodes = reinterpret_cast<const QTranslatorNode*>(data + trnodeoffset);
+    buckets = reinterpret_cast<const quint32*>(data + trbucketoffset);
+    strings = reinterpret_cast<const char*>(data + trstringoffset);
+    messagecount = trmessagecount;
+    nodecount = trnodecount;
+    bucketcount = trbucketcount;
+    stringsize = trstringsize;
+    codec = trcodec;
+    utf8 = (trcodec->mibEnum() == 106);
+    return true;
+}
+
+QString QTranslatorPrivate::decode(const char *trmsgstr, const int trmsgstrlen) const
+{
+    if (Q_LIKELY(utf8)) {
+        return QString::fromUtf8(trmsgstr, trmsgstrlen);
+    }
+    return codec->toUnicode(trmsgstr, trmsgstrlen);
+}
+
+bool QTranslatorPrivate::string(const quint32 *string, const char **data, int *length) const
+{
+    const quint32 offset = qFromLittleEndian(string[0]);
+    const quint32 size = qFromLittleEndian(string[1]);
+    if (Q_UNLIKELY((qint64(offset) + size) > stringsize)) {
+        return false;
+    }
+    *data = strings + offset;
+    *length = size;
+    return true;
+}
+
+bool QTranslatorPrivate::find(const char *context, const char *sourceText, const int sourcelen,
+                              const char **trmsgstr, int *trmsgstrlen) const
+{
+    const int contextlen = qstrlen(context);
+    const quint32 h = qt_translator_hash(context, contextlen, sourceText, sourcelen);
+    quint32 node = qFromLittleEndian(buckets[h & (bucketcount - 1)]);
+    // a chain visits every node at most once, more steps mean a corrupted loop
+    for (quint32 steps = 0; node < nodecount && steps < nodecount; steps++) {
+        const QTranslatorNode &it = nodes[node];
+        node = qFromLittleEndian(it.next);
+        if (qFromLittleEndian(it.hash) != h) {
+            continue;
+        }
+
+        const quint32 message = qFromLittleEndian(it.message);
+        if (Q_UNLIKELY(message >= messagecount)) {
+            continue;
+        }
+        const QTranslatorMessage &itmessage = messages[message];
+        const bool plural = (qFromLittleEndian(it.plural) != 0);
+        const char *trmsgctxt = nullptr;
+        int trmsgctxtlen = 0;
+        const char *trmsgid = nullptr;
+        int trmsgidlen = 0;
+        if (!string(itmessage.msgctxt, &trmsgctxt, &trmsgctxtlen)
+            || !string(plural ? itmessage.msgid_plural : itmessage.msgid, &trmsgid, &trmsgidlen)) {
+            continue;
+        }
+        if (isCharEqual(trmsgctxt, trmsgctxtlen, context, contextlen)
+            && isCharEqual(trmsgid, trmsgidlen, sourceText, sourcelen)) {
+            return string(plural ? itmessage.msgstr_plural : itmessage.msgstr, trmsgstr, trmsgstrlen);
+        }
+    }
+    return false;
+}
 
 /*!
     \class QTranslator
@@ -165,8 +339,7 @@ QTranslator::~QTranslator()
 bool QTranslator::load(const QString &domain, const QString &locale)
 {
     Q_D(QTranslator);
-    d->cache.clear();
-    d->converter = QTextConverter();
+    d->clear();
     if (domain.isEmpty()) {
         qWarning("QTranslator::load: Domain is empty");
         return false;
@@ -190,7 +363,24 @@ bool QTranslator::load(const QString &domain, const QString &locale)
         return false;
     }
 
-    return loadFromData(translationfile.readAll());
+    // the catalog is queried in place, pages are shared between processes
+    const qint64 translationfilesize = translationfile.size();
+    if (translationfilesize <= 0) {
+        qWarning("QTranslator::load: Empty data");
+        return false;
+    }
+    void* mapped = ::mmap(nullptr, translationfilesize, PROT_READ, MAP_SHARED, translationfile.handle(), 0);
+    if (Q_UNLIKELY(mapped == MAP_FAILED)) {
+        return loadFromData(translationfile.readAll());
+    }
+    d->mapped = mapped;
+    d->mappedsize = translationfilesize;
+
+    if (!d->setData(static_cast<const uchar*>(mapped), translationfilesize)) {
+        d->clear();
+        return false;
+    }
+    return true;
 }
 
 /*!
@@ -198,43 +388,26 @@ bool QTranslator::load(const QString &domain, const QString &locale)
     is successfully loaded; otherwise returns false.
 
     The previous contents of this translator object are discarded.
+    The data is not copied, \a data is referenced by the translator
+    until another translation is loaded or the translator is destroyed.
 
     \sa QLibraryInfo
 */
 bool QTranslator::loadFromData(const QByteArray &data)
 {
     Q_D(QTranslator);
-    d->cache.clear();
-    d->converter = QTextConverter();
+    d->clear();
 
     if (data.isEmpty()) {
         qWarning("QTranslator::load: Empty data");
         return false;
     }
 
-    QDataStream trdatastream(data);
-    QByteArray trmagic;
-    QByteArray trcodec;
-    trdatastream >> trmagic;
-    trdatastream >> trcodec;
-
-    if (Q_UNLIKELY(trmagic != "KATIE_TRANSLATION")) {
-        qWarning("QTranslator::load: Invalid magic");
+    d->rawdata = data;
+    if (!d->setData(reinterpret_cast<const uchar*>(d->rawdata.constData()), d->rawdata.size())) {
+        d->clear();
         return false;
     }
-
-    QIODevice* trdatadevice = trdatastream.device();
-    QTranslatorCache trcache;
-    while (!trdatadevice->atEnd()) {
-        trdatastream >> trcache.trmsgctxt;
-        trdatastream >> trcache.trmsgid;
-        trdatastream >> trcache.trmsgstr;
-        trdatastream >> trcache.trmsgid_plural;
-        trdatastream >> trcache.trmsgstr_plural;
-        d->cache.append(trcache);
-    }
-    d->converter = QTextConverter(trcodec);
-    // qDebug() << Q_FUNC_INFO << d->cache.size() << (d->cache.size() * sizeof(QTranslatorCache));
     return true;
 }
 
@@ -243,6 +416,9 @@ bool QTranslator::loadFromData(const QByteArray &data)
     The text will be translated depending on either the locale specified
     when the translation was loaded or the system locale.
 
+    Once loaded the translator is not modified by lookups, it is safe to
+    call this function from multiple threads at the same time.
+
     \sa load()
 */
 QString QTranslator::translate(const char *context, const char *sourceText) const
@@ -253,20 +429,10 @@ QString QTranslator::translate(const char *context, const char *sourceText) cons
     }
 
     Q_D(const QTranslator);
-    const int contextlen = qstrlen(context);
-    foreach (const QTranslatorCache &it, d->cache) {
-        // this search method assumes plurals and regular messages are unique strings
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid_plural.constData(), it.trmsgid_plural.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr_plural.constData(), it.trmsgstr_plural.size());
-        }
-
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid.constData(), it.trmsgid.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr.constData(), it.trmsgstr.size());
-        }
+    const char *trmsgstr = nullptr;
+    int trmsgstrlen = 0;
+    if (d->find(context, sourceText, sourcelen, &trmsgstr, &trmsgstrlen)) {
+        return d->decode(trmsgstr, trmsgstrlen);
     }
     return QString::fromUtf8(sourceText, sourcelen);
 }
@@ -276,7 +442,8 @@ QString QTranslator::translate(const char *context, const char *sourceText) cons
     The text will be translated depending on either the locale specified
     when the translation was loaded or the system locale.
 
-    If no translation is found empty string is returned.
+    If no translation is found empty string is returned. Like translate(),
+    this function is thread-safe once the translation is loaded.
 
     \sa load()
 */
@@ -287,21 +454,10 @@ QString QTranslator::translateStrict(const char *context, const char *sourceText
     }
 
     Q_D(const QTranslator);
-    const int contextlen = qstrlen(context);
-    const int sourcelen = qstrlen(sourceText);
-    foreach (const QTranslatorCache &it, d->cache) {
-        // this search method assumes plurals and regular messages are unique strings
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid_plural.constData(), it.trmsgid_plural.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr_plural.constData(), it.trmsgstr_plural.size());
-        }
-
-        if (isCharEqual(it.trmsgctxt.constData(), it.trmsgctxt.size(), context, contextlen)
-            && isCharEqual(it.trmsgid.constData(), it.trmsgid.size(), sourceText, sourcelen)) {
-            d->converter.reset();
-            return d->converter.toUnicode(it.trmsgstr.constData(), it.trmsgstr.size());
-        }
+    const char *trmsgstr = nullptr;
+    int trmsgstrlen = 0;
+    if (d->find(context, sourceText, qstrlen(sourceText), &trmsgstr, &trmsgstrlen)) {
+        return d->decode(trmsgstr, trmsgstrlen);
     }
     return QString();
 }
@@ -312,7 +468,7 @@ QString QTranslator::translateStrict(const char *context, const char *sourceText
 bool QTranslator::isEmpty() const
 {
     Q_D(const QTranslator);
-    return d->cache.isEmpty();
+    return (d->messagecount == 0);
 }
 
 QT_END_NAMESPACE
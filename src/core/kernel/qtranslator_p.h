@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2015 The Qt Company Ltd.
+** Copyright (C) 2016 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QTRANSLATOR_P_H
+#define QTRANSLATOR_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Katie API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "QtCore/qglobal.h"
+
+#include "xxhash.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Layout of the translation catalogs generated by trc, shared by the
+    compiler and QTranslator which queries the catalog in place (usually
+    memory-mapped). All words are stored in little-endian byte order:
+
+    - the header
+    - message table, QTranslatorMessage entries
+    - node table, QTranslatorNode entries chained per bucket
+    - bucket table, quint32 index of the first node or QTranslatorNoNode
+    - string pool, starting at page boundary and not NUL-terminated
+
+    Every message is indexed by (msgctxt, msgid) and, if it has plural
+    form, by (msgctxt, msgid_plural). The first message in the catalog
+    wins if the same key is present more than once.
+*/
+#define QT_TRANSLATOR_MAGIC "KATIE_TRANSLATION"
+
+static const quint32 QTranslatorVersion = 2;
+static const quint32 QTranslatorNoNode = 0xffffffff;
+static const int QTranslatorAlignment = 16;
+static const int QTranslatorPageSize = 4096;
+
+struct QTranslatorHeader
+{
+    char magic[20];
+    quint32 version;
+    char codec[32];
+    quint32 messagecount;
+    quint32 messageoffset;
+    quint32 nodecount;
+    quint32 nodeoffset;
+    quint32 bucketcount;
+    quint32 bucketoffset;
+    quint32 stringsize;
+    quint32 stringoffset;
+};
+
+// offset and length pairs into the string pool
+struct QTranslatorMessage
+{
+    quint32 msgctxt[2];
+    quint32 msgid[2];
+    quint32 msgstr[2];
+    quint32 msgid_plural[2];
+    quint32 msgstr_plural[2];
+};
+
+struct QTranslatorNode
+{
+    quint32 hash;
+    quint32 message;
+    quint32 plural;
+    quint32 next;
+};
+
+// hashes context and message without concatenating them, must not change
+// without bumping QTranslatorVersion since the hashes are stored in catalogs
+static inline quint32 qt_translator_hash(const char *context, const int contextlen,
+                                         const char *sourceText, const int sourcelen)
+{
+    const XXH64_hash_t contexthash = XXH3_64bits(context, contextlen);
+    const XXH64_hash_t h = XXH3_64bits_withSeed(sourceText, sourcelen, contexthash);
+    return quint32(h ^ (h >> 32));
+}
+
+// power of two number of buckets at least twice the number of nodes
+static inline quint32 qt_translator_buckets(const quint32 nodecount)
+{
+    quint32 bucketcount = 16;
+    while (bucketcount < nodecount * 2) {
+        bucketcount <<= 1;
+    }
+    return bucketcount;
+}
+
+QT_END_NAMESPACE
+
+#endif // QTRANSLATOR_P_H
@@ -25,7 +25,7 @@
 #include "qhash.h"
 #include "qdir.h"
 #include "qdebug.h"
-#include "qmutex.h"
+#include "qreadwritelock.h"
 #include "qplugin.h"
 #include "qpluginloader.h"
 #include "qcoreapplication_p.h"
@@ -34,7 +34,7 @@
 
 QT_BEGIN_NAMESPACE
 
-Q_GLOBAL_STATIC(QMutex, qGlobalFactoryLoaderMutex);
+Q_GLOBAL_STATIC(QReadWriteLock, qGlobalFactoryLoaderLock);
 Q_GLOBAL_STATIC(QStdVector<QFactoryLoader*>, qGlobalFactoryLoaders)
 
 class QFactoryLoaderPrivate
@@ -42,7 +42,7 @@ class QFactoryLoaderPrivate
 public:
     QFactoryLoaderPrivate(const QString &suffix);
 
-    QMutex mutex;
+    mutable QReadWriteLock lock;
     QHash<QString,QPluginLoader*> pluginMap;
     QHash<QString,QString> keyMap;
     const QString suffix;
@@ -56,7 +56,7 @@ QFactoryLoaderPrivate::QFactoryLoaderPrivate(const QString &asuffix)
 QFactoryLoader::QFactoryLoader(const QString &suffix)
     : d_ptr(new QFactoryLoaderPrivate(suffix))
 {
-    QMutexLocker locker(qGlobalFactoryLoaderMutex());
+    QWriteLocker locker(qGlobalFactoryLoaderLock());
     update();
     qGlobalFactoryLoaders()->append(this);
 }
@@ -64,7 +64,7 @@ QFactoryLoader::QFactoryLoader(const QString &suffix)
 void QFactoryLoader::update()
 {
     Q_D(QFactoryLoader);
-    QMutexLocker locker(&d->mutex);
+    QWriteLocker locker(&d->lock);
     d->keyMap.clear();
     foreach (const QString &pluginDir, QCoreApplication::pluginPaths()) {
         const QString path = pluginDir + d->suffix;
@@ -91,7 +91,7 @@ void QFactoryLoader::update()
 
 QFactoryLoader::~QFactoryLoader()
 {
-    QMutexLocker locker(qGlobalFactoryLoaderMutex());
+    QWriteLocker locker(qGlobalFactoryLoaderLock());
     qGlobalFactoryLoaders()->removeAll(this);
     delete d_ptr;
 }
@@ -99,14 +99,15 @@ QFactoryLoader::~QFactoryLoader()
 QStringList QFactoryLoader::keys() const
 {
     Q_D(const QFactoryLoader);
+    QReadLocker locker(&d->lock);
     return d->keyMap.keys();
 }
 
 QObject *QFactoryLoader::instance(const QString &key)
 {
     Q_D(QFactoryLoader);
-    QMutexLocker locker(&d->mutex);
-    QString lowered = key.toLower();
+    const QString lowered = key.toLower();
+    QReadLocker readlocker(&d->lock);
     QPluginLoader* loader = d->pluginMap.value(lowered, nullptr);
     if (loader) {
         if (qt_debug_component()) {
@@ -114,6 +115,14 @@ QObject *QFactoryLoader::instance(const QString &key)
         }
         return loader->instance();
     }
+    readlocker.unlock();
+
+    QWriteLocker locker(&d->lock);
+    // another thread may have loaded the plugin in the meantime
+    loader = d->pluginMap.value(lowered, nullptr);
+    if (loader) {
+        return loader->instance();
+    }
     if (qt_debug_component()) {
         qDebug() << "QFactoryLoader: attempting to load plugin" << lowered << d->keyMap.value(lowered);
     }
@@ -141,7 +150,7 @@ QObject *QFactoryLoader::instance(const QString &key)
 
 void QFactoryLoader::refreshAll()
 {
-    QMutexLocker locker(qGlobalFactoryLoaderMutex());
+    QReadLocker locker(qGlobalFactoryLoaderLock());
     QStdVector<QFactoryLoader*> *loaders = qGlobalFactoryLoaders();
     QStdVector<QFactoryLoader *>::const_iterator it = loaders->constBegin();
     while (it != loaders->constEnd()) {
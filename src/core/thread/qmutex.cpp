@@ -23,8 +23,172 @@
 
 #ifndef QT_NO_THREAD
 
+#include "qthread.h"
+
+#include <chrono>
+
+#ifdef Q_OS_LINUX
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <errno.h>
+#else
+#  include <condition_variable>
+#  include <mutex>
+#endif
+
 QT_BEGIN_NAMESPACE
 
+// upper bound of the spin phase, a few microseconds on current hardware
+static const int QMUTEX_MAX_SPINS = 100;
+
+static inline void qt_cpu_relax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+#ifdef Q_OS_LINUX
+static inline int *qt_futex_address(QAtomicInt *value)
+{
+    // QAtomicInt is a std::atomic<int> which has the layout of int
+    return reinterpret_cast<int *>(value);
+}
+
+// sleeps while *value == expected, a timeout of -1 sleeps until woken
+static inline void qt_futex_wait(QAtomicInt *value, int expected, qint64 timeout = -1)
+{
+    if (timeout < 0) {
+        ::syscall(SYS_futex, qt_futex_address(value), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+        return;
+    }
+    struct timespec ts;
+    ts.tv_sec = timeout / 1000000000;
+    ts.tv_nsec = timeout % 1000000000;
+    ::syscall(SYS_futex, qt_futex_address(value), FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+}
+
+static inline void qt_futex_wake_one(QAtomicInt *value)
+{
+    ::syscall(SYS_futex, qt_futex_address(value), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+#else
+// without futexes the waiters park on one of a few buckets chosen by the
+// address, the bucket lock orders the state check against the wake up
+struct QMutexParkingBucket
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+static QMutexParkingBucket qt_parking_buckets[64];
+
+static inline QMutexParkingBucket *qt_parking_bucket(QAtomicInt *value)
+{
+    return &qt_parking_buckets[(reinterpret_cast<quintptr>(value) >> 4) % 64];
+}
+
+static inline void qt_futex_wait(QAtomicInt *value, int expected, qint64 timeout = -1)
+{
+    QMutexParkingBucket *bucket = qt_parking_bucket(value);
+    std::unique_lock<std::mutex> locker(bucket->mutex);
+    if (value->load() != expected) {
+        return;
+    }
+    if (timeout < 0) {
+        bucket->condition.wait(locker);
+    } else {
+        bucket->condition.wait_for(locker, std::chrono::nanoseconds(timeout));
+    }
+}
+
+static inline void qt_futex_wake_one(QAtomicInt *value)
+{
+    // the bucket is shared with other mutexes so everyone is woken
+    QMutexParkingBucket *bucket = qt_parking_bucket(value);
+    std::lock_guard<std::mutex> locker(bucket->mutex);
+    bucket->condition.notify_all();
+}
+#endif
+
+/*
+    The state is Unlocked, Locked or Contended, the latter meaning that
+    threads may be sleeping on the mutex and unlock() has to wake one of
+    them. Locking and unlocking without contention is a single atomic
+    operation done inline.
+
+    A thread that finds the mutex locked spins for a while before going to
+    sleep since most critical sections are shorter than a sleep and wake
+    up. The spin count adapts to how long the mutex is usually held, it is
+    moved towards the number of spins the last lock took. Spinning is
+    pointless with a single CPU as the holder can not run meanwhile.
+*/
+bool QMutex::spin()
+{
+    static const bool multiCore = (QThread::idealThreadCount() > 1);
+    if (!multiCore) {
+        return false;
+    }
+
+    const int estimate = spins.load();
+    const int maxSpins = qMin(QMUTEX_MAX_SPINS, estimate * 2 + 10);
+    int count = 0;
+    for (; count < maxSpins; ++count) {
+        if (state.load() == Unlocked && state.testAndSetAcquire(Unlocked, Locked)) {
+            break;
+        }
+        qt_cpu_relax();
+    }
+    spins.storeRelease(estimate + (count - estimate) / 8);
+    return (count < maxSpins);
+}
+
+void QMutex::lockInternal()
+{
+    if (spin()) {
+        return;
+    }
+    // Contended is kept once stored so that unlock() does not miss the
+    // other sleepers, at worst unlock() wakes a thread that is not there
+    while (state.fetchAndStoreAcquire(Contended) != Unlocked) {
+        qt_futex_wait(&state, Contended);
+    }
+}
+
+bool QMutex::lockInternal(int timeout)
+{
+    if (timeout < 0) {
+        lockInternal();
+        return true;
+    }
+    if (timeout == 0) {
+        return false;
+    }
+    if (spin()) {
+        return true;
+    }
+
+    const std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    while (state.fetchAndStoreAcquire(Contended) != Unlocked) {
+        const qint64 remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) {
+            return false;
+        }
+        qt_futex_wait(&state, Contended, remaining);
+    }
+    return true;
+}
+
+void QMutex::unlockInternal()
+{
+    qt_futex_wake_one(&state);
+}
+
 /*!
     \class QMutex
     \brief The QMutex class provides access serialization between threads.
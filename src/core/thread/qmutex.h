@@ -22,9 +22,7 @@
 #ifndef QMUTEX_H
 #define QMUTEX_H
 
-#include <QtCore/qglobal.h>
-
-#include <mutex>
+#include <QtCore/qatomic.h>
 
 
 QT_BEGIN_NAMESPACE
@@ -34,29 +32,45 @@ QT_BEGIN_NAMESPACE
 class Q_CORE_EXPORT QMutex
 {
 public:
-    QMutex() { }
+    QMutex() : state(Unlocked), spins(0) { }
     ~QMutex() { }
 
     inline void lock() {
-        mutex.lock();
+        if (!state.testAndSetAcquire(Unlocked, Locked))
+            lockInternal();
     }
 
     inline bool tryLock() {
-        return mutex.try_lock();
+        return state.testAndSetAcquire(Unlocked, Locked);
     }
 
     inline bool tryLock(int timeout) {
-        return mutex.try_lock_for(std::chrono::milliseconds(timeout));
+        if (state.testAndSetAcquire(Unlocked, Locked))
+            return true;
+        return lockInternal(timeout);
     }
 
     inline void unlock() {
-        mutex.unlock();
+        if (state.fetchAndStoreRelease(Unlocked) == Contended)
+            unlockInternal();
     }
 
 private:
     Q_DISABLE_COPY(QMutex)
 
-    std::timed_mutex mutex;
+    enum State {
+        Unlocked = 0,
+        Locked = 1,
+        Contended = 2
+    };
+
+    void lockInternal();
+    bool lockInternal(int timeout);
+    void unlockInternal();
+    bool spin();
+
+    QAtomicInt state;
+    QAtomicInt spins;
 };
 
 class Q_CORE_EXPORT QMutexLocker
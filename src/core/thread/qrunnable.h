@@ -22,7 +22,7 @@
 #ifndef QRUNNABLE_H
 #define QRUNNABLE_H
 
-#include <QtCore/qglobal.h>
+#include <QtCore/qatomic.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -35,11 +35,11 @@ public:
     QRunnable() : ref(0) { }
     virtual ~QRunnable() { }
 
-    bool autoDelete() const { return ref != -1; }
-    void setAutoDelete(bool _autoDelete) { ref = _autoDelete ? 0 : -1; }
+    bool autoDelete() const { return ref.load() != -1; }
+    void setAutoDelete(bool _autoDelete) { ref.store(_autoDelete ? 0 : -1); }
 
 private:
-    int ref;
+    QAtomicInt ref;
 
     friend class QThreadPoolPrivate;
     friend class QThreadPoolThread;
@@ -33,6 +33,67 @@
 
 QT_BEGIN_NAMESPACE
 
+/*
+  QPostEventList
+*/
+
+bool QPostEventList::push(QThreadData * volatile *pdata, QThreadData *data, QPostEventNode *node)
+{
+    pushing.ref();
+    // closeIncoming() waits for the threads that did not see the stack
+    // closed, once it is open again the receiver may be in another thread
+    if (closed.load() || *pdata != data) {
+        pushing.deref();
+        return false;
+    }
+
+    QPostEventNode *head = nullptr;
+    do {
+        head = incoming.load();
+        node->next = head;
+    } while (!incoming.testAndSetRelease(head, node));
+
+    pushing.deref();
+    return true;
+}
+
+void QPostEventList::takeIncoming()
+{
+    QPostEventNode *node = incoming.fetchAndStoreAcquire(nullptr);
+    if (!node)
+        return;
+
+    // the stack has the last posted event on top
+    QPostEventNode *first = nullptr;
+    while (node) {
+        QPostEventNode *next = node->next;
+        node->next = first;
+        first = node;
+        node = next;
+    }
+
+    while (first) {
+        ++QObjectPrivate::get(first->pe.receiver)->postedEvents;
+        addEvent(first->pe);
+        QPostEventNode *next = first->next;
+        delete first;
+        first = next;
+    }
+}
+
+void QPostEventList::closeIncoming()
+{
+    closed.store(1);
+    while (pushing.load())
+        QThread::yieldCurrentThread();
+    takeIncoming();
+}
+
+void QPostEventList::openIncoming()
+{
+    closed.store(0);
+}
+
 /*
   QThreadData
 */
@@ -51,6 +112,7 @@ QThreadData::~QThreadData()
     delete thread;
     thread = nullptr;
 
+    postEventList.takeIncoming();
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
@@ -69,6 +69,13 @@ inline bool operator<(const QPostEvent &pe, int priority)
     return priority < pe.priority;
 }
 
+// node of the lock-free stack of incoming posted events
+struct QPostEventNode
+{
+    QPostEvent pe;
+    QPostEventNode *next;
+};
+
 // This class holds the list of posted events.
 //  The list has to be kept sorted by priority
 class QPostEventList : public QList<QPostEvent>
@@ -84,10 +91,31 @@ public:
 
     QMutex mutex;
 
+    // events with the default priority are pushed to a lock-free stack by
+    // the posting threads and moved to the list by the next thread that
+    // locks the mutex, threads posting at the same time do not contend
+    // on the mutex that way
+    QAtomicPointer<QPostEventNode> incoming;
+    // number of threads pushing to the stack and whether pushing is
+    // allowed, it is not while objects are moved to another thread
+    QAtomicInt pushing;
+    QAtomicInt closed;
+
     inline QPostEventList()
         : QList<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0)
     { }
 
+    inline bool hasIncoming() const {
+        return (incoming.load() != nullptr);
+    }
+
+    bool push(QThreadData * volatile *pdata, QThreadData *data, QPostEventNode *node);
+
+    // the mutex must be locked for these
+    void takeIncoming();
+    void closeIncoming();
+    void openIncoming();
+
     void addEvent(const QPostEvent &ev) {
         int priority = ev.priority;
         if (isEmpty() || last().priority >= priority) {
@@ -175,7 +203,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return (canWait && !postEventList.hasIncoming());
     }
 
     bool quitNow;
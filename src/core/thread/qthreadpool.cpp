@@ -53,54 +53,64 @@ public:
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    QThreadPoolQueue *queue;
 };
 
+// the pool thread running on the current thread, tasks it starts go to its own queue
+static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+
 /*
     QThreadPool private class.
 */
 QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
     : manager(manager),
-    runnable(nullptr)
+    runnable(nullptr),
+    queue(nullptr)
 {
 }
 
 void QThreadPoolThread::run()
 {
+    currentPoolThread = this;
     QMutexLocker locker(&manager->mutex);
+    manager->acquireQueue(this);
     for(;;) {
         QRunnable *r = runnable;
         runnable = nullptr;
+        locker.unlock();
 
         do {
             if (r) {
                 const bool autoDelete = r->autoDelete();
 
                 // run the task
-                locker.unlock();
                 QT_TRY {
                     r->run();
                 } QT_CATCH (...) {
                     qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
                              "This is not supported, exceptions thrown in worker threads must be\n"
                              "caught before control returns to Qt Concurrent.");
+                    locker.relock();
+                    manager->releaseQueue(this);
                     registerThreadInactive();
+                    currentPoolThread = nullptr;
                     QT_RETHROW;
                 }
-                locker.relock();
 
-                if (autoDelete && !--r->ref) {
+                if (autoDelete && !r->ref.deref()) {
                     delete r;
                 }
             }
 
             // if too many threads are active, expire this thread
-            if (manager->tooManyThreadsActive()) {
+            if (manager->tooManyActive.load()) {
                 break;
             }
 
-            r = !manager->queue.isEmpty() ? manager->queue.takeFirst().first : nullptr;
+            r = manager->takeTask(this, false);
         } while (r != nullptr);
 
+        locker.relock();
         if (manager->isExiting) {
             registerThreadInactive();
             break;
@@ -110,6 +120,14 @@ void QThreadPoolThread::run()
         bool expired = manager->tooManyThreadsActive();
         if (!expired) {
             manager->waitingThreads.enqueue(this);
+            manager->updateState();
+            // a task may have been queued before the pool knew about the waiting thread
+            runnable = manager->takeTask(this, true);
+            if (runnable) {
+                manager->waitingThreads.removeOne(this);
+                manager->updateState();
+                continue;
+            }
             registerThreadInactive();
             // wait for work, exiting after the expiry timeout is reached
             runnableReady.wait(locker.mutex(), manager->expiryTimeout);
@@ -120,10 +138,13 @@ void QThreadPoolThread::run()
         }
         if (expired) {
             manager->expiredThreads.enqueue(this);
+            manager->updateState();
             registerThreadInactive();
             break;
         }
     }
+    manager->releaseQueue(this);
+    currentPoolThread = nullptr;
 }
 
 void QThreadPoolThread::registerThreadInactive()
@@ -142,10 +163,30 @@ QThreadPoolPrivate:: QThreadPoolPrivate()
     expiryTimeout(30000),
     maxThreadCount(qAbs(QThread::idealThreadCount())),
     reservedThreads(0),
-    activeThreads(0)
+    activeThreads(0),
+    queuedTasks(0),
+    prioritizedTasks(0),
+    canStartThreads(1),
+    tooManyActive(0)
 {
 }
 
+QThreadPoolPrivate::~QThreadPoolPrivate()
+{
+    QThreadPoolTask *task = incoming.load();
+    while (task) {
+        QThreadPoolTask *next = task->next;
+        delete task;
+        task = next;
+    }
+    QThreadPoolQueue *queue = queues.load();
+    while (queue) {
+        QThreadPoolQueue *next = queue->next;
+        delete queue;
+        queue = next;
+    }
+}
+
 bool QThreadPoolPrivate::tryStart(QRunnable *task)
 {
     if (allThreads.isEmpty()) {
@@ -161,8 +202,13 @@ bool QThreadPoolPrivate::tryStart(QRunnable *task)
 
     if (waitingThreads.count() > 0) {
         // recycle an available thread
-        enqueueTask(task);
-        waitingThreads.takeFirst()->runnableReady.wakeOne();
+        QThreadPoolThread *thread = waitingThreads.takeFirst();
+        if (task && task->autoDelete()) {
+            task->ref.ref();
+        }
+        thread->runnable = task;
+        thread->runnableReady.wakeOne();
+        updateState();
         return true;
     }
 
@@ -173,10 +219,12 @@ bool QThreadPoolPrivate::tryStart(QRunnable *task)
 
         ++activeThreads;
 
-        if (task->autoDelete())
-            ++task->ref;
+        if (task && task->autoDelete()) {
+            task->ref.ref();
+        }
         thread->runnable = task;
         thread->start();
+        updateState();
         return true;
     }
 
@@ -188,12 +236,223 @@ bool QThreadPoolPrivate::tryStart(QRunnable *task)
 void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
 {
     if (runnable->autoDelete()) {
-        ++runnable->ref;
+        runnable->ref.ref();
     }
 
     // put it on the queue
     QList<QPair<QRunnable *, int> >::iterator at = qUpperBound(queue.begin(), queue.end(), priority);
     queue.insert(at, qMakePair(runnable, priority));
+    prioritizedTasks.ref();
+}
+
+/*!
+    \internal
+    Queues \a runnable without locking the mutex, to the queue of the current
+    thread if it is one of the pool threads and to the incoming tasks
+    otherwise.
+*/
+void QThreadPoolPrivate::pushTask(QRunnable *runnable)
+{
+    if (runnable->autoDelete()) {
+        runnable->ref.ref();
+    }
+    queuedTasks.ref();
+
+    QThreadPoolThread *current = currentPoolThread;
+    if (current && current->manager == this) {
+        QMutexLocker locker(&current->queue->mutex);
+        current->queue->tasks.enqueue(runnable);
+        current->queue->size.ref();
+        return;
+    }
+
+    QThreadPoolTask *task = new QThreadPoolTask;
+    task->runnable = runnable;
+    do {
+        task->next = incoming.load();
+    } while (!incoming.testAndSetOrdered(task->next, task));
+}
+
+/*!
+    \internal
+    Takes the next task for \a thread: prioritized tasks that must run before
+    the default ones, the thread's own queue, the incoming tasks and finally
+    tasks stolen from the other threads. \a locked tells whether the caller
+    holds the mutex.
+*/
+QRunnable *QThreadPoolPrivate::takeTask(QThreadPoolThread *thread, bool locked)
+{
+    QRunnable *r = nullptr;
+    if (prioritizedTasks.load() > 0) {
+        r = takePrioritizedTask(locked, true);
+        if (r) {
+            return r;
+        }
+    }
+
+    QThreadPoolQueue *own = thread->queue;
+    if (own->size.load() > 0) {
+        QMutexLocker locker(&own->mutex);
+        if (!own->tasks.isEmpty()) {
+            own->size.deref();
+            queuedTasks.deref();
+            return own->tasks.dequeue();
+        }
+    }
+
+    // take all incoming tasks at once, other threads steal from the queue
+    QThreadPoolTask *task = incoming.load() ? incoming.fetchAndStoreOrdered(nullptr) : nullptr;
+    if (task) {
+        // the stack is in reverse order
+        QThreadPoolTask *ordered = nullptr;
+        while (task) {
+            QThreadPoolTask *next = task->next;
+            task->next = ordered;
+            ordered = task;
+            task = next;
+        }
+        r = ordered->runnable;
+        task = ordered->next;
+        delete ordered;
+        if (task) {
+            QMutexLocker locker(&own->mutex);
+            int count = 0;
+            while (task) {
+                QThreadPoolTask *next = task->next;
+                own->tasks.enqueue(task->runnable);
+                delete task;
+                task = next;
+                ++count;
+            }
+            own->size.fetchAndAddOrdered(count);
+        }
+        queuedTasks.deref();
+        return r;
+    }
+
+    QThreadPoolQueue *victim = own->next;
+    for (QThreadPoolQueue *queue = queues.load(); queue; queue = queue->next) {
+        // start after the own queue so that threads do not all pick the same victim
+        if (!victim) {
+            victim = queues.load();
+        }
+        if (victim != own && victim->size.load() > 0) {
+            r = stealTask(victim, own);
+            if (r) {
+                return r;
+            }
+        }
+        victim = victim->next;
+    }
+
+    if (prioritizedTasks.load() > 0) {
+        return takePrioritizedTask(locked, false);
+    }
+    return nullptr;
+}
+
+QRunnable *QThreadPoolPrivate::takePrioritizedTask(bool locked, bool higherOnly)
+{
+    QMutexLocker locker(locked ? nullptr : &mutex);
+    if (queue.isEmpty() || (higherOnly && queue.first().second <= 0)) {
+        return nullptr;
+    }
+    prioritizedTasks.deref();
+    return queue.takeFirst().first;
+}
+
+/*!
+    \internal
+    Moves half of the tasks of \a victim to \a queue and returns the first
+    one of them. The queues are never locked at the same time.
+*/
+QRunnable *QThreadPoolPrivate::stealTask(QThreadPoolQueue *victim, QThreadPoolQueue *queue)
+{
+    QList<QRunnable *> stolen;
+    {
+        QMutexLocker locker(&victim->mutex);
+        const int count = (victim->tasks.count() + 1) / 2;
+        for (int i = 0; i < count; ++i) {
+            stolen.append(victim->tasks.dequeue());
+        }
+        victim->size.fetchAndAddOrdered(-count);
+    }
+    if (stolen.isEmpty()) {
+        return nullptr;
+    }
+
+    QRunnable *r = stolen.takeFirst();
+    if (!stolen.isEmpty()) {
+        QMutexLocker locker(&queue->mutex);
+        queue->tasks.append(stolen);
+        queue->size.fetchAndAddOrdered(stolen.count());
+    }
+    queuedTasks.deref();
+    return r;
+}
+
+/*!
+    \internal
+    Assigns a queue to \a thread, reusing the queue of an exited thread if
+    there is one. Queues are not deleted before the pool is so that other
+    threads can walk them without locking.
+*/
+void QThreadPoolPrivate::acquireQueue(QThreadPoolThread *thread)
+{
+    QThreadPoolQueue *queue = queues.load();
+    while (queue && queue->owner) {
+        queue = queue->next;
+    }
+    if (!queue) {
+        queue = new QThreadPoolQueue;
+        queue->next = queues.load();
+        queues.store(queue);
+    }
+    queue->owner = thread;
+    thread->queue = queue;
+}
+
+/*!
+    \internal
+    Hands the queue of \a thread back to the pool, tasks that are still on it
+    are pushed to the incoming tasks for the other threads.
+*/
+void QThreadPoolPrivate::releaseQueue(QThreadPoolThread *thread)
+{
+    QThreadPoolQueue *queue = thread->queue;
+    QMutexLocker locker(&queue->mutex);
+    while (!queue->tasks.isEmpty()) {
+        QThreadPoolTask *task = new QThreadPoolTask;
+        task->runnable = queue->tasks.dequeue();
+        do {
+            task->next = incoming.load();
+        } while (!incoming.testAndSetOrdered(task->next, task));
+        queue->size.deref();
+    }
+    queue->owner = nullptr;
+    thread->queue = nullptr;
+}
+
+void QThreadPoolPrivate::wakeWaitingThread()
+{
+    if (!waitingThreads.isEmpty()) {
+        waitingThreads.takeFirst()->runnableReady.wakeOne();
+        updateState();
+    }
+}
+
+/*!
+    \internal
+    Publishes whether start() has to lock the mutex to get a thread going
+    and whether threads should stop taking tasks because too many of them
+    are active. Must be called with the mutex locked whenever the thread
+    counts change.
+*/
+void QThreadPoolPrivate::updateState()
+{
+    canStartThreads.store(allThreads.isEmpty() || !waitingThreads.isEmpty()
+                          || activeThreadCount() < maxThreadCount);
+    tooManyActive.store(tooManyThreadsActive());
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -203,9 +462,17 @@ int QThreadPoolPrivate::activeThreadCount() const
 
 void QThreadPoolPrivate::tryToStartMoreThreads()
 {
+    updateState();
+
     // try to push tasks on the queue to any available threads
     while (!queue.isEmpty() && tryStart(queue.first().first)) {
         queue.removeFirst();
+        prioritizedTasks.deref();
+    }
+
+    // the threads take the other tasks themselves
+    int pending = queuedTasks.load();
+    while (pending-- > 0 && tryStart(nullptr)) {
     }
 }
 
@@ -224,9 +491,10 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     thread->setObjectName(QLatin1String("Thread (pooled)"));
     allThreads.insert(thread.data());
     ++activeThreads;
+    updateState();
 
-    if (runnable->autoDelete()) {
-        ++runnable->ref;
+    if (runnable && runnable->autoDelete()) {
+        runnable->ref.ref();
     }
     thread->runnable = runnable;
     thread.take()->start();
@@ -259,6 +527,7 @@ void QThreadPoolPrivate::reset()
 
     waitingThreads.clear();
     expiredThreads.clear();
+    updateState();
 
     isExiting = false;
 }
@@ -267,15 +536,15 @@ bool QThreadPoolPrivate::waitForDone(int msecs)
 {
     QMutexLocker locker(&mutex);
     if (msecs < 0) {
-        if (!queue.isEmpty() || activeThreads != 0) {
+        if (!queue.isEmpty() || queuedTasks.load() != 0 || activeThreads != 0) {
             noActiveThreads.wait(locker.mutex());
         }
     } else {
-        if (!queue.isEmpty() || activeThreads != 0) {
+        if (!queue.isEmpty() || queuedTasks.load() != 0 || activeThreads != 0) {
             noActiveThreads.wait(locker.mutex(), msecs);
         }
     }
-    return (queue.isEmpty() && activeThreads == 0);
+    return (queue.isEmpty() && queuedTasks.load() == 0 && activeThreads == 0);
 }
 
 /*!
@@ -379,14 +648,22 @@ void QThreadPool::start(QRunnable *runnable, int priority)
     }
 
     Q_D(QThreadPool);
-    QMutexLocker locker(&d->mutex);
+    if (priority == 0) {
+        // the mutex is locked only if there is a thread to wake up or start
+        d->pushTask(runnable);
+        if (d->canStartThreads.load()) {
+            QMutexLocker locker(&d->mutex);
+            if (d->queuedTasks.load() > 0 && !d->tryStart(nullptr)) {
+                d->wakeWaitingThread();
+            }
+        }
+        return;
+    }
 
+    QMutexLocker locker(&d->mutex);
     if (!d->tryStart(runnable)) {
         d->enqueueTask(runnable, priority);
-
-        if (!d->waitingThreads.isEmpty()) {
-            d->waitingThreads.takeFirst()->runnableReady.wakeOne();
-        }
+        d->wakeWaitingThread();
     }
 }
 
@@ -516,6 +793,7 @@ void QThreadPool::reserveThread()
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     ++d->reservedThreads;
+    d->updateState();
 }
 
 /*!
@@ -45,6 +45,27 @@
 QT_BEGIN_NAMESPACE
 
 class QThreadPoolThread;
+
+// node of the lock-free stack that tasks started from outside of the pool are pushed to
+struct QThreadPoolTask
+{
+    QRunnable *runnable;
+    QThreadPoolTask *next;
+};
+
+// per-worker task queue, the owner takes from it and other workers steal from it
+class QThreadPoolQueue
+{
+public:
+    QThreadPoolQueue() : size(0), owner(nullptr), next(nullptr) { }
+
+    QMutex mutex;
+    QQueue<QRunnable *> tasks;
+    QAtomicInt size;
+    QThreadPoolThread *owner; // guarded by the pool mutex
+    QThreadPoolQueue *next; // never changes once the queue is published
+};
+
 class QThreadPoolPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QThreadPool)
@@ -52,9 +73,18 @@ class QThreadPoolPrivate : public QObjectPrivate
 
 public:
     QThreadPoolPrivate();
+    ~QThreadPoolPrivate();
 
     bool tryStart(QRunnable *task);
     void enqueueTask(QRunnable *task, int priority = 0);
+    void pushTask(QRunnable *task);
+    QRunnable *takeTask(QThreadPoolThread *thread, bool locked);
+    QRunnable *takePrioritizedTask(bool locked, bool higherOnly);
+    QRunnable *stealTask(QThreadPoolQueue *victim, QThreadPoolQueue *queue);
+    void acquireQueue(QThreadPoolThread *thread);
+    void releaseQueue(QThreadPoolThread *thread);
+    void wakeWaitingThread();
+    void updateState();
     int activeThreadCount() const;
 
     void tryToStartMoreThreads();
@@ -71,6 +101,15 @@ public:
     QList<QPair<QRunnable *, int> > queue;
     QWaitCondition noActiveThreads;
 
+    // tasks started with the default priority never touch the mutex unless
+    // a thread has to be woken up or started for them
+    QAtomicPointer<QThreadPoolTask> incoming;
+    QAtomicPointer<QThreadPoolQueue> queues;
+    QAtomicInt queuedTasks;
+    QAtomicInt prioritizedTasks;
+    QAtomicInt canStartThreads;
+    QAtomicInt tooManyActive;
+
     bool isExiting;
     int expiryTimeout;
     int maxThreadCount;
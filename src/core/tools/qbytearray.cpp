@@ -3496,8 +3496,7 @@ QByteArray QByteArray::number(qlonglong n, int base)
         base = 10;
     }
 #endif
-    QLocale locale(QLocale::C);
-    return locale.d()->longLongToString(n, -1, base).toLatin1();
+    return QLocalePrivate::c()->longLongToString(n, -1, base).toLatin1();
 }
 
 /*!
@@ -3513,8 +3512,7 @@ QByteArray QByteArray::number(qulonglong n, int base)
         base = 10;
     }
 #endif
-    QLocale locale(QLocale::C);
-    return locale.d()->unsLongLongToString(n, -1, base).toLatin1();
+    return QLocalePrivate::c()->unsLongLongToString(n, -1, base).toLatin1();
 }
 
 /*! 
@@ -3578,8 +3576,7 @@ QByteArray QByteArray::number(double n, char f, int prec)
         }
     }
 
-    QLocale locale(QLocale::C);
-    return locale.d()->doubleToString(n, prec, form, -1, flags).toLatin1();
+    return QLocalePrivate::c()->doubleToString(n, prec, form, -1, flags).toLatin1();
 }
 
 /*!
@@ -25,61 +25,80 @@
 
 #include <stdlib.h>
 
-QT_BEGIN_NAMESPACE
-
+#include "xxhash.h"
 
-// ### Qt 5: see tests/benchmarks/corelib/tools/qhash/qhash_string.cpp
-// Hashing of the whole string is a waste of cycles.
+QT_BEGIN_NAMESPACE
 
 /*
-    These functions are based on Peter J. Weinberger's hash function
-    (from the Dragon Book). The constant 24 in the original function
-    was replaced with 23 to produce fewer collisions on input such as
-    "a", "aa", "aaa", "aaaa", ...
+    The seed is generated once per process so that the hash values
+    of strings and byte arrays can not be predicted by an attacker
+    trying to degrade QHash performance by flooding it with colliding
+    keys. Setting the QT_HASH_SEED environment variable to a number
+    makes the seed deterministic, 0 disables seeding altogether.
 */
-
-static inline uint hash(const uchar *p, int n)
+static XXH64_hash_t qt_create_hash_seed()
 {
-    uint h = 0;
-
-    while (n--) {
-        h = (h << 4) + *p++;
-        h ^= (h & 0xf0000000) >> 23;
-        h &= 0x0fffffff;
+#ifdef QT_BOOTSTRAPPED
+    // moc output must not depend on the hash order
+    return 0;
+#else
+    const QByteArray envseed = qgetenv("QT_HASH_SEED");
+    if (!envseed.isEmpty()) {
+        return envseed.toULongLong();
     }
-    return h;
+    return (XXH64_hash_t(qrand()) << 32) ^ XXH64_hash_t(qrand());
+#endif
 }
 
-static inline uint hash(const QChar *p, int n)
+static inline XXH64_hash_t& qt_hash_seed()
 {
-    uint h = 0;
+    static XXH64_hash_t seed = qt_create_hash_seed();
+    return seed;
+}
 
-    while (n--) {
-        h = (h << 4) + (*p++).unicode();
-        h ^= (h & 0xf0000000) >> 23;
-        h &= 0x0fffffff;
+/*
+    Code generators (moc, uic, trc, qdbuscpp2xml and qdbusxml2cpp)
+    call this first thing in main() so that their output does not
+    depend on the hash order and builds stay reproducible. It must
+    not be called once any hash has been computed.
+*/
+Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed)
+{
+    qt_hash_seed() = seed;
+}
+
+/*
+    XXH3 processes the input in vectorized stripes and has excellent
+    dispersion even for short keys, the 64-bit result is folded into
+    the unsigned int QHash uses for buckets. Empty keys hash to 0.
+*/
+static inline uint hash(const void *p, int n)
+{
+    if (n <= 0) {
+        return 0;
     }
-    return h;
+    const XXH64_hash_t h = XXH3_64bits_withSeed(p, size_t(n), qt_hash_seed());
+    return uint(h ^ (h >> 32));
 }
 
 uint qHash(const QByteArray &key)
 {
-    return hash(reinterpret_cast<const uchar *>(key.constData()), key.size());
+    return hash(key.constData(), key.size());
 }
 
 uint qHash(const QString &key)
 {
-    return hash(key.unicode(), key.size());
+    return hash(key.unicode(), key.size() * sizeof(QChar));
 }
 
 uint qHash(const QStringRef &key)
 {
-    return hash(key.unicode(), key.size());
+    return hash(key.unicode(), key.size() * sizeof(QChar));
 }
 
 uint qHash(const QBitArray &bitArray)
 {
-    return hash(reinterpret_cast<const uchar *>(bitArray.d.constData()), bitArray.d.size());
+    return hash(bitArray.d.constData(), bitArray.d.size());
 }
 
 /*
@@ -444,12 +463,19 @@ void QHashData::checkSanity()
     \relates QHash
 
     Returns the hash value for the \a key.
+
+    The value is seeded randomly once per process, set the
+    \c QT_HASH_SEED environment variable to get reproducible values.
 */
 
 /*! \fn uint qHash(const QString &key)
+    \fn uint qHash(const QStringRef &key)
     \relates QHash
 
     Returns the hash value for the \a key.
+
+    The value is seeded randomly once per process, set the
+    \c QT_HASH_SEED environment variable to get reproducible values.
 */
 
 /*! \fn uint qHash(const T *key)
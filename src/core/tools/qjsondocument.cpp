@@ -33,7 +33,7 @@ public:
     QJsonDocumentPrivate() : ref(1) { }
 
     QVariant jsonToVariant(const QByteArray &jsondata);
-    void variantToJson(const QVariant &jsonvariant, json_t *jroot, quint16 jdepth);
+    json_t* variantToJson(const QVariant &jsonvariant);
 
     QAtomicInt ref;
     QByteArray json;
@@ -41,6 +41,10 @@ public:
     QString error;
 
 private:
+    QVariant jsonValueToVariant(const json_t *jvalue);
+    json_t* variantToJsonValue(const QVariant &jsonvariant, quint16 jdepth);
+    template <typename T> json_t* variantToJsonObject(const T &jsonmap, quint16 jdepth);
+
     Q_DISABLE_COPY(QJsonDocumentPrivate);
 };
 
@@ -62,137 +66,10 @@ QVariant QJsonDocumentPrivate::jsonToVariant(const QByteArray &jsondata)
     }
 
     switch(json_typeof(jroot)) {
-        case JSON_OBJECT: {
-            QVariantMap mapresult;
-            const char *jkey;
-            json_t *jobject;
-            json_object_foreach(jroot, jkey, jobject) {
-                switch(json_typeof(jobject)) {
-                    case JSON_OBJECT: {
-                        char* jdata = json_dumps(jobject, 0);
-                        mapresult.insert(jkey, jsonToVariant(jdata));
-                        ::free(jdata);
-                        break;
-                    }
-                    case JSON_ARRAY: {
-                        QVariantList listvalue;
-                        for (size_t i = 0; i < json_array_size(jobject); i++) {
-                            json_t *jarray = json_array_get(jobject, i);
-                            switch(json_typeof(jarray)) {
-                                case JSON_OBJECT: {
-                                    char* jdata = json_dumps(jarray, 0);
-                                    listvalue.append(jsonToVariant(jdata));
-                                    ::free(jdata);
-                                    break;
-                                }
-                                case JSON_STRING: {
-                                    listvalue.append(QVariant(QString::fromUtf8(json_string_value(jarray), json_string_length(jarray))));
-                                    break;
-                                }
-                                case JSON_INTEGER: {
-                                    listvalue.append(QVariant(json_integer_value(jarray)));
-                                    break;
-                                }
-                                case JSON_REAL: {
-                                    listvalue.append(QVariant(json_real_value(jarray)));
-                                    break;
-                                }
-                                case JSON_TRUE: {
-                                    listvalue.append(QVariant(true));
-                                    break;
-                                }
-                                case JSON_FALSE: {
-                                    listvalue.append(QVariant(false));
-                                    break;
-                                }
-                                case JSON_NULL: {
-                                    listvalue.append(QVariant());
-                                    break;
-                                }
-                                default: {
-                                    error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type in array");
-                                    break;
-                                }
-                            }
-                        }
-                        mapresult.insert(jkey, listvalue);
-                        break;
-                    }
-                    case JSON_STRING: {
-                        mapresult.insert(jkey, QVariant(QString::fromUtf8(json_string_value(jobject), json_string_length(jobject))));
-                        break;
-                    }
-                    case JSON_INTEGER: {
-                        mapresult.insert(jkey, QVariant(json_integer_value(jobject)));
-                        break;
-                    }
-                    case JSON_REAL: {
-                        mapresult.insert(jkey, QVariant(json_real_value(jobject)));
-                        break;
-                    }
-                    case JSON_TRUE: {
-                        mapresult.insert(jkey, QVariant(true));
-                        break;
-                    }
-                    case JSON_FALSE: {
-                        mapresult.insert(jkey, QVariant(false));
-                        break;
-                    }
-                    case JSON_NULL: {
-                        mapresult.insert(jkey, QVariant());
-                        break;
-                    }
-                    default: {
-                        error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type");
-                        break;
-                    }
-                }
-            }
-            result = mapresult;
-            break;
-        }
+        case JSON_OBJECT:
         case JSON_ARRAY: {
-            QVariantList listvalue;
-            for (size_t i = 0; i < json_array_size(jroot); i++) {
-                json_t *jarray = json_array_get(jroot, i);
-                switch(json_typeof(jarray)) {
-                    case JSON_OBJECT: {
-                        char* jdata = json_dumps(jarray, 0);
-                        listvalue.append(jsonToVariant(jdata));
-                        ::free(jdata);
-                        break;
-                    }
-                    case JSON_STRING: {
-                        listvalue.append(QVariant(QString::fromUtf8(json_string_value(jarray), json_string_length(jarray))));
-                        break;
-                    }
-                    case JSON_INTEGER: {
-                        listvalue.append(QVariant(json_integer_value(jarray)));
-                        break;
-                    }
-                    case JSON_REAL: {
-                        listvalue.append(QVariant(json_real_value(jarray)));
-                        break;
-                    }
-                    case JSON_TRUE: {
-                        listvalue.append(QVariant(true));
-                        break;
-                    }
-                    case JSON_FALSE: {
-                        listvalue.append(QVariant(false));
-                        break;
-                    }
-                    case JSON_NULL: {
-                        listvalue.append(QVariant());
-                        break;
-                    }
-                    default: {
-                        error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type in array");
-                        break;
-                    }
-                }
-            }
-            result = listvalue;
+            // the parser limits the depth to JSON_PARSER_MAX_DEPTH, the tree is walked once
+            result = jsonValueToVariant(jroot);
             break;
         }
         default: {
@@ -208,106 +85,77 @@ QVariant QJsonDocumentPrivate::jsonToVariant(const QByteArray &jsondata)
     return result;
 }
 
-void QJsonDocumentPrivate::variantToJson(const QVariant &jsonvariant, json_t *jroot, quint16 jdepth)
+QVariant QJsonDocumentPrivate::jsonValueToVariant(const json_t *jvalue)
 {
+    switch(json_typeof(jvalue)) {
+        case JSON_OBJECT: {
+            QVariantMap mapresult;
+            const char *jkey;
+            json_t *jobject;
+            json_object_foreach(const_cast<json_t*>(jvalue), jkey, jobject) {
+                mapresult.insert(QString::fromUtf8(jkey), jsonValueToVariant(jobject));
+            }
+            return mapresult;
+        }
+        case JSON_ARRAY: {
+            const size_t jsize = json_array_size(jvalue);
+            QVariantList listresult;
+            listresult.reserve(jsize);
+            for (size_t i = 0; i < jsize; i++) {
+                listresult.append(jsonValueToVariant(json_array_get(jvalue, i)));
+            }
+            return listresult;
+        }
+        case JSON_STRING: {
+            return QVariant(QString::fromUtf8(json_string_value(jvalue), json_string_length(jvalue)));
+        }
+        case JSON_INTEGER: {
+            return QVariant(json_integer_value(jvalue));
+        }
+        case JSON_REAL: {
+            return QVariant(json_real_value(jvalue));
+        }
+        case JSON_TRUE: {
+            return QVariant(true);
+        }
+        case JSON_FALSE: {
+            return QVariant(false);
+        }
+        case JSON_NULL: {
+            return QVariant();
+        }
+        default: {
+            error = QCoreApplication::translate("QJsonDocument", "Unknown JSON type");
+            return QVariant();
+        }
+    }
+}
+
+json_t* QJsonDocumentPrivate::variantToJson(const QVariant &jsonvariant)
+{
+    json_t *jroot = nullptr;
     if (jsonvariant.isNull()) {
         error = QCoreApplication::translate("QJsonDocument", "Data variant is null");
-        return;
-    } else if (Q_UNLIKELY(jdepth >= JSON_PARSER_MAX_DEPTH)) {
-        error = QCoreApplication::translate("QJsonDocument", "Maximum depth reached");
-        return;
+        return jroot;
     }
 
     switch (jsonvariant.type()) {
-        case QVariant::Map:
-        case QVariant::Hash: {
+        case QVariant::Map: {
             const QVariantMap jsonmap = jsonvariant.toMap();
-            if (jdepth == 1 && jsonmap.isEmpty()) {
+            if (jsonmap.isEmpty()) {
                 error = QCoreApplication::translate("QJsonDocument", "Data variant is null");
-                return;
+                break;
             }
-            QVariantMap::const_iterator jsonmapit = jsonmap.constBegin();
-            while(jsonmapit != jsonmap.constEnd()) {
-                const QVariant value = jsonmapit.value();
-                const QByteArray bytearraykey = jsonmapit.key().toUtf8();
-                jsonmapit++;
-                switch(value.type()) {
-                    case QVariant::Invalid: {
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), json_null());
-                        break;
-                    }
-                    case QVariant::Bool: {
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), value.toBool() ? json_true() : json_false());
-                        break;
-                    }
-                    case QVariant::Int:
-                    case QVariant::LongLong: {
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), json_integer(value.toLongLong()));
-                        break;
-                    }
-                    case QVariant::UInt:
-                    case QVariant::ULongLong: {
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), json_integer(value.toULongLong()));
-                        break;
-                    }
-                    case QVariant::Float:
-                    case QVariant::Double: {
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), json_real(value.toReal()));
-                        break;
-                    }
-                    case QVariant::ByteArray:
-                    case QVariant::String: {
-                        const QByteArray bytearrayvalue = value.toByteArray();
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), json_string(bytearrayvalue.constData()));
-                        break;
-                    }
-                    case QVariant::List: {
-                        // mixed variant type lists are not supported
-                        bool isobject = true;
-                        const QVariantList valueaslist = value.toList();
-                        foreach (const QVariant &listvalue, valueaslist) {
-                            if (listvalue.type() != QVariant::Map && listvalue.type() != QVariant::Hash) {
-                                isobject = false;
-                                break;
-                            }
-                        }
-                        if (isobject) {
-                            json_t *jarray = json_array();
-                            foreach (const QVariant &listvalue, valueaslist) {
-                                jdepth++;
-                                json_t *jrootn = json_object();
-                                variantToJson(listvalue, jrootn, jdepth);
-                                json_array_append_new(jarray, jrootn);
-                                jdepth--;
-                            }
-                            json_object_set_new_nocheck(jroot, bytearraykey.constData(), jarray);
-                            break;
-                        }
-                    }
-                    case QVariant::StringList: {
-                        json_t *jarray = json_array();
-                        foreach(const QString &listvalue, value.toStringList()) {
-                            const QByteArray bytearrayvalue = listvalue.toUtf8();
-                            json_array_append_new(jarray, json_stringn_nocheck(bytearrayvalue.constData(), bytearrayvalue.size()));
-                        }
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), jarray);
-                        break;
-                    }
-                    case QVariant::Hash:
-                    case QVariant::Map: {
-                        jdepth++;
-                        json_t *jrootn = json_object();
-                        variantToJson(value.toMap(), jrootn, jdepth);
-                        json_object_set_new_nocheck(jroot, bytearraykey.constData(), jrootn);
-                        jdepth--;
-                        break;
-                    }
-                    default: {
-                        error = QCoreApplication::translate("QJsonDocument", "Unknown variant type");
-                        break;
-                    }
-                }
+            jroot = variantToJsonObject(jsonmap, 1);
+            break;
+        }
+        case QVariant::Hash: {
+            const QVariantHash jsonhash = jsonvariant.toHash();
+            if (jsonhash.isEmpty()) {
+                error = QCoreApplication::translate("QJsonDocument", "Data variant is null");
+                break;
             }
+            jroot = variantToJsonObject(jsonhash, 1);
             break;
         }
         case QVariant::Invalid:
@@ -334,7 +182,110 @@ void QJsonDocumentPrivate::variantToJson(const QVariant &jsonvariant, json_t *jr
         }
     }
 
-    // qDebug() << "converted" << jsonmap << "to" << json_dumps(jroot, 0);
+    // qDebug() << "converted" << jsonvariant << "to" << json_dumps(jroot, 0);
+
+    return jroot;
+}
+
+template <typename T>
+json_t* QJsonDocumentPrivate::variantToJsonObject(const T &jsonmap, quint16 jdepth)
+{
+    if (Q_UNLIKELY(jdepth >= JSON_PARSER_MAX_DEPTH)) {
+        error = QCoreApplication::translate("QJsonDocument", "Maximum depth reached");
+        return nullptr;
+    }
+
+    json_t *jobject = json_object();
+    typename T::const_iterator jsonmapit = jsonmap.constBegin();
+    while (jsonmapit != jsonmap.constEnd()) {
+        json_t *jvalue = variantToJsonValue(jsonmapit.value(), jdepth);
+        if (Q_UNLIKELY(!jvalue)) {
+            if (!error.isEmpty()) {
+                json_decref(jobject);
+                return nullptr;
+            }
+            // strings that are not valid UTF-8 are skipped
+            jsonmapit++;
+            continue;
+        }
+        const QByteArray bytearraykey = jsonmapit.key().toUtf8();
+        json_object_set_new_nocheck(jobject, bytearraykey.constData(), jvalue);
+        jsonmapit++;
+    }
+    return jobject;
+}
+
+json_t* QJsonDocumentPrivate::variantToJsonValue(const QVariant &jsonvariant, quint16 jdepth)
+{
+    switch(jsonvariant.type()) {
+        case QVariant::Invalid: {
+            return json_null();
+        }
+        case QVariant::Bool: {
+            return (jsonvariant.toBool() ? json_true() : json_false());
+        }
+        case QVariant::Int:
+        case QVariant::LongLong: {
+            return json_integer(jsonvariant.toLongLong());
+        }
+        case QVariant::UInt:
+        case QVariant::ULongLong: {
+            return json_integer(jsonvariant.toULongLong());
+        }
+        case QVariant::Float:
+        case QVariant::Double: {
+            return json_real(jsonvariant.toReal());
+        }
+        case QVariant::ByteArray:
+        case QVariant::String: {
+            const QByteArray bytearrayvalue = jsonvariant.toByteArray();
+            return json_stringn(bytearrayvalue.constData(), bytearrayvalue.size());
+        }
+        case QVariant::List: {
+            // mixed variant type lists are not supported
+            const QVariantList valueaslist = jsonvariant.toList();
+            bool isobject = true;
+            for (int i = 0; i < valueaslist.size(); i++) {
+                const QVariant::Type listtype = valueaslist.at(i).type();
+                if (listtype != QVariant::Map && listtype != QVariant::Hash) {
+                    isobject = false;
+                    break;
+                }
+            }
+            if (isobject) {
+                json_t *jarray = json_array();
+                for (int i = 0; i < valueaslist.size(); i++) {
+                    json_t *jobject = variantToJsonObject(valueaslist.at(i).toMap(), jdepth + 1);
+                    if (Q_UNLIKELY(!jobject)) {
+                        json_decref(jarray);
+                        return nullptr;
+                    }
+                    json_array_append_new(jarray, jobject);
+                }
+                return jarray;
+            }
+            // fallthrough
+        }
+        case QVariant::StringList: {
+            const QStringList valueasstringlist = jsonvariant.toStringList();
+            json_t *jarray = json_array();
+            for (int i = 0; i < valueasstringlist.size(); i++) {
+                const QByteArray bytearrayvalue = valueasstringlist.at(i).toUtf8();
+                json_array_append_new(jarray, json_stringn_nocheck(bytearrayvalue.constData(), bytearrayvalue.size()));
+            }
+            return jarray;
+        }
+        case QVariant::Hash: {
+            return variantToJsonObject(jsonvariant.toHash(), jdepth + 1);
+        }
+        case QVariant::Map: {
+            return variantToJsonObject(jsonvariant.toMap(), jdepth + 1);
+        }
+        default: {
+            error = QCoreApplication::translate("QJsonDocument", "Unknown variant type");
+            return nullptr;
+        }
+    }
 }
 
 QJsonDocument::QJsonDocument()
@@ -387,12 +338,13 @@ QJsonDocument QJsonDocument::fromVariant(const QVariant &variant)
 
     QScopedPointer<QJsonDocumentPrivate> d(new QJsonDocumentPrivate());
     d->variant = variant;
-    json_t *jroot = json_object();
-    d->variantToJson(d->variant, jroot, 1);
-    char *jdata = json_dumps(jroot, jflags);
-    d->json = jdata;
-    ::free(jdata);
-    json_decref(jroot);
+    json_t *jroot = d->variantToJson(d->variant);
+    if (jroot) {
+        char *jdata = json_dumps(jroot, jflags);
+        d->json = jdata;
+        ::free(jdata);
+        json_decref(jroot);
+    }
 
     QJsonDocument jd;
     if (Q_UNLIKELY(!d->error.isEmpty())) {
@@ -0,0 +1,1685 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qjsonstream.h"
+#include "qiodevice.h"
+#include "qstringlist.h"
+#include "qnumeric.h"
+#include "qlocale.h"
+#include "qcoreapplication.h"
+
+#include <jansson.h>
+
+QT_BEGIN_NAMESPACE
+
+// the device is read and written in chunks of this size
+static const int QJsonStreamChunkSize = 65536;
+
+static inline bool isJsonSpace(const char ch)
+{
+    return (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r');
+}
+
+static inline bool isJsonDigit(const char ch)
+{
+    return (ch >= '0' && ch <= '9');
+}
+
+static inline bool isJsonNumber(const char ch)
+{
+    return (isJsonDigit(ch) || ch == '-' || ch == '+' || ch == '.' || ch == 'e' || ch == 'E');
+}
+
+static inline int hexToInt(const char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return (ch - '0');
+    } else if (ch >= 'a' && ch <= 'f') {
+        return (ch - 'a' + 10);
+    } else if (ch >= 'A' && ch <= 'F') {
+        return (ch - 'A' + 10);
+    }
+    return -1;
+}
+
+static inline void appendUtf8(QByteArray &data, const uint codepoint)
+{
+    if (codepoint < 0x80) {
+        data.append(char(codepoint));
+    } else if (codepoint < 0x800) {
+        data.append(char(0xc0 | (codepoint >> 6)));
+        data.append(char(0x80 | (codepoint & 0x3f)));
+    } else if (codepoint < 0x10000) {
+        data.append(char(0xe0 | (codepoint >> 12)));
+        data.append(char(0x80 | ((codepoint >> 6) & 0x3f)));
+        data.append(char(0x80 | (codepoint & 0x3f)));
+    } else {
+        data.append(char(0xf0 | (codepoint >> 18)));
+        data.append(char(0x80 | ((codepoint >> 12) & 0x3f)));
+        data.append(char(0x80 | ((codepoint >> 6) & 0x3f)));
+        data.append(char(0x80 | (codepoint & 0x3f)));
+    }
+}
+
+// rejects overlong forms, surrogates and code points above U+10FFFF
+static bool isValidUtf8(const char *data, const int length)
+{
+    int i = 0;
+    while (i < length) {
+        const uchar ch = uchar(data[i]);
+        if (ch < 0x80) {
+            i++;
+            continue;
+        }
+
+        int count = 0;
+        uint codepoint = 0;
+        uint minimum = 0;
+        if ((ch & 0xe0) == 0xc0) {
+            count = 1;
+            codepoint = (ch & 0x1f);
+            minimum = 0x80;
+        } else if ((ch & 0xf0) == 0xe0) {
+            count = 2;
+            codepoint = (ch & 0x0f);
+            minimum = 0x800;
+        } else if ((ch & 0xf8) == 0xf0) {
+            count = 3;
+            codepoint = (ch & 0x07);
+            minimum = 0x10000;
+        } else {
+            return false;
+        }
+        if (length - i <= count) {
+            return false;
+        }
+        for (int j = 1; j <= count; j++) {
+            const uchar next = uchar(data[i + j]);
+            if ((next & 0xc0) != 0x80) {
+                return false;
+            }
+            codepoint = (codepoint << 6) | (next & 0x3f);
+        }
+        if (codepoint < minimum || codepoint > 0x10ffff
+            || (codepoint >= 0xd800 && codepoint <= 0xdfff)) {
+            return false;
+        }
+        i += (count + 1);
+    }
+    return true;
+}
+
+// checks the number grammar, the conversion functions are more relaxed
+static bool isValidNumber(const char *data, const int length, bool *isreal)
+{
+    int i = 0;
+    if (i < length && data[i] == '-') {
+        i++;
+    }
+    if (i >= length || !isJsonDigit(data[i])) {
+        return false;
+    }
+    if (data[i] == '0') {
+        i++;
+    } else {
+        while (i < length && isJsonDigit(data[i])) {
+            i++;
+        }
+    }
+    *isreal = false;
+    if (i < length && data[i] == '.') {
+        i++;
+        if (i >= length || !isJsonDigit(data[i])) {
+            return false;
+        }
+        while (i < length && isJsonDigit(data[i])) {
+            i++;
+        }
+        *isreal = true;
+    }
+    if (i < length && (data[i] == 'e' || data[i] == 'E')) {
+        i++;
+        if (i < length && (data[i] == '+' || data[i] == '-')) {
+            i++;
+        }
+        if (i >= length || !isJsonDigit(data[i])) {
+            return false;
+        }
+        while (i < length && isJsonDigit(data[i])) {
+            i++;
+        }
+        *isreal = true;
+    }
+    return (i == length);
+}
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum State {
+        ExpectRoot,
+        ExpectKeyOrEnd,
+        ExpectKey,
+        ExpectColon,
+        ExpectValueOrEnd,
+        ExpectValue,
+        ExpectCommaOrEnd
+    };
+
+    QJsonStreamReaderPrivate();
+
+    void reset();
+    void setError(const QString &message);
+    QJsonStreamReader::TokenType endOfData();
+
+    inline int peekChar();
+    inline void advance();
+    bool fill();
+    void skipWhitespace();
+
+    QJsonStreamReader::TokenType readValue(const int ch);
+    QJsonStreamReader::TokenType readString(const QJsonStreamReader::TokenType type);
+    QJsonStreamReader::TokenType readNumber();
+    QJsonStreamReader::TokenType readLiteral(const char *literal, const int length,
+                                             const QJsonStreamReader::TokenType type, const bool boolean);
+    QJsonStreamReader::TokenType endValue(const QJsonStreamReader::TokenType type);
+
+    QIODevice *device;
+    QByteArray buffer;
+    int bufferpos;
+    bool deviceend;
+    // where the token being read starts, it is read again from there if
+    // the device has no more data yet
+    int tokenstart;
+    qint64 tokenoffset;
+
+    State state;
+    // one '{' or '[' per open container
+    QByteArray stack;
+    QJsonStreamReader::TokenType token;
+    QByteArray tokendata;
+    qint64 integer;
+    double real;
+    bool boolean;
+
+    qint64 offset;
+    qint64 line;
+    qint64 linestart;
+    QJsonStreamReader::Error error;
+    QString errorstring;
+};
+
+QJsonStreamReaderPrivate::QJsonStreamReaderPrivate()
+    : device(nullptr),
+    bufferpos(0),
+    deviceend(false),
+    tokenstart(0),
+    tokenoffset(0),
+    state(ExpectRoot),
+    token(QJsonStreamReader::NoToken),
+    integer(0),
+    real(0.0),
+    boolean(false),
+    offset(0),
+    line(1),
+    linestart(0),
+    error(QJsonStreamReader::NoError)
+{
+}
+
+void QJsonStreamReaderPrivate::reset()
+{
+    buffer.clear();
+    bufferpos = 0;
+    deviceend = false;
+    tokenstart = 0;
+    tokenoffset = 0;
+    state = ExpectRoot;
+    stack.clear();
+    token = QJsonStreamReader::NoToken;
+    tokendata.clear();
+    integer = 0;
+    real = 0.0;
+    boolean = false;
+    offset = 0;
+    line = 1;
+    linestart = 0;
+    error = QJsonStreamReader::NoError;
+    errorstring.clear();
+}
+
+void QJsonStreamReaderPrivate::setError(const QString &message)
+{
+    token = QJsonStreamReader::Invalid;
+    error = QJsonStreamReader::NotWellFormedError;
+    errorstring = message;
+}
+
+// the data ended within a token, unless the device is done it is read again
+// once more data is available
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::endOfData()
+{
+    if (deviceend) {
+        setError(QCoreApplication::translate("QJsonDocument", "Unexpected end of data"));
+        return token;
+    }
+    bufferpos = tokenstart;
+    offset = tokenoffset;
+    token = QJsonStreamReader::Invalid;
+    error = QJsonStreamReader::PrematureEndOfDocumentError;
+    errorstring = QCoreApplication::translate("QJsonDocument", "Premature end of data");
+    return token;
+}
+
+bool QJsonStreamReaderPrivate::fill()
+{
+    if (deviceend || !device) {
+        return false;
+    } else if (!device->isOpen()) {
+        deviceend = true;
+        return false;
+    }
+    const QByteArray data = device->read(QJsonStreamChunkSize);
+    if (data.isEmpty()) {
+        // sequential devices, such as sockets, may receive more data later
+        if (!device->isSequential() && device->atEnd()) {
+            deviceend = true;
+        }
+        return false;
+    }
+    buffer.remove(0, tokenstart);
+    bufferpos -= tokenstart;
+    tokenstart = 0;
+    buffer.append(data);
+    return true;
+}
+
+inline int QJsonStreamReaderPrivate::peekChar()
+{
+    if (Q_UNLIKELY(bufferpos >= buffer.size()) && !fill()) {
+        return -1;
+    }
+    return uchar(buffer.at(bufferpos));
+}
+
+inline void QJsonStreamReaderPrivate::advance()
+{
+    bufferpos++;
+    offset++;
+}
+
+void QJsonStreamReaderPrivate::skipWhitespace()
+{
+    forever {
+        if (Q_UNLIKELY(bufferpos >= buffer.size()) && !fill()) {
+            return;
+        }
+        const char *data = buffer.constData();
+        const int size = buffer.size();
+        while (bufferpos < size) {
+            const char ch = data[bufferpos];
+            if (!isJsonSpace(ch)) {
+                return;
+            }
+            advance();
+            if (ch == '\n') {
+                line++;
+                linestart = offset;
+            }
+        }
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readValue(const int ch)
+{
+    switch (ch) {
+        case '{': {
+            if (Q_UNLIKELY(stack.size() >= JSON_PARSER_MAX_DEPTH)) {
+                setError(QCoreApplication::translate("QJsonDocument", "Maximum depth reached"));
+                return token;
+            }
+            advance();
+            stack.append('{');
+            state = ExpectKeyOrEnd;
+            token = QJsonStreamReader::StartObject;
+            return token;
+        }
+        case '[': {
+            if (Q_UNLIKELY(stack.size() >= JSON_PARSER_MAX_DEPTH)) {
+                setError(QCoreApplication::translate("QJsonDocument", "Maximum depth reached"));
+                return token;
+            }
+            advance();
+            stack.append('[');
+            state = ExpectValueOrEnd;
+            token = QJsonStreamReader::StartArray;
+            return token;
+        }
+        case '"': {
+            return readString(QJsonStreamReader::String);
+        }
+        case 't': {
+            return readLiteral("true", 4, QJsonStreamReader::Bool, true);
+        }
+        case 'f': {
+            return readLiteral("false", 5, QJsonStreamReader::Bool, false);
+        }
+        case 'n': {
+            return readLiteral("null", 4, QJsonStreamReader::Null, false);
+        }
+        default: {
+            if (ch == '-' || isJsonDigit(ch)) {
+                return readNumber();
+            }
+            setError(QCoreApplication::translate("QJsonDocument", "Unexpected character"));
+            return token;
+        }
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readString(const QJsonStreamReader::TokenType type)
+{
+    // skip the opening quote
+    advance();
+    tokendata.clear();
+    // escapes are always valid, only raw bytes need to be checked
+    bool isascii = true;
+    forever {
+        if (Q_UNLIKELY(bufferpos >= buffer.size()) && !fill()) {
+            return endOfData();
+        }
+
+        // copy runs of plain characters at once
+        const char *data = buffer.constData();
+        const int size = buffer.size();
+        const int start = bufferpos;
+        while (bufferpos < size) {
+            const uchar ch = uchar(data[bufferpos]);
+            if (ch == '"' || ch == '\\' || ch < 0x20) {
+                break;
+            } else if (ch >= 0x80) {
+                isascii = false;
+            }
+            bufferpos++;
+        }
+        tokendata.append(data + start, bufferpos - start);
+        offset += (bufferpos - start);
+        if (bufferpos >= size) {
+            continue;
+        }
+
+        const char ch = data[bufferpos];
+        if (ch == '"') {
+            advance();
+            if (Q_UNLIKELY(!isascii && !isValidUtf8(tokendata.constData(), tokendata.size()))) {
+                setError(QCoreApplication::translate("QJsonDocument", "Invalid UTF-8 string"));
+                return token;
+            }
+            token = type;
+            if (type == QJsonStreamReader::Key) {
+                state = ExpectColon;
+                return token;
+            }
+            return endValue(type);
+        } else if (ch != '\\') {
+            setError(QCoreApplication::translate("QJsonDocument", "Control character in string"));
+            return token;
+        }
+
+        advance();
+        const int escape = peekChar();
+        if (Q_UNLIKELY(escape < 0)) {
+            return endOfData();
+        }
+        advance();
+        switch (escape) {
+            case '"':
+            case '\\':
+            case '/': {
+                tokendata.append(char(escape));
+                break;
+            }
+            case 'b': {
+                tokendata.append('\b');
+                break;
+            }
+            case 'f': {
+                tokendata.append('\f');
+                break;
+            }
+            case 'n': {
+                tokendata.append('\n');
+                break;
+            }
+            case 'r': {
+                tokendata.append('\r');
+                break;
+            }
+            case 't': {
+                tokendata.append('\t');
+                break;
+            }
+            case 'u': {
+                uint codepoint = 0;
+                for (int i = 0; i < 4; i++) {
+                    const int digit = peekChar();
+                    if (Q_UNLIKELY(digit < 0)) {
+                        return endOfData();
+                    }
+                    const int hex = hexToInt(char(digit));
+                    if (Q_UNLIKELY(hex < 0)) {
+                        setError(QCoreApplication::translate("QJsonDocument", "Invalid escape"));
+                        return token;
+                    }
+                    codepoint = (codepoint << 4) | uint(hex);
+                    advance();
+                }
+                if (codepoint >= 0xd800 && codepoint <= 0xdbff) {
+                    // high surrogate, the low one must follow
+                    if (Q_UNLIKELY(peekChar() < 0)) {
+                        return endOfData();
+                    } else if (peekChar() != '\\') {
+                        setError(QCoreApplication::translate("QJsonDocument", "Invalid Unicode escape"));
+                        return token;
+                    }
+                    advance();
+                    if (Q_UNLIKELY(peekChar() < 0)) {
+                        return endOfData();
+                    } else if (peekChar() != 'u') {
+                        setError(QCoreApplication::translate("QJsonDocument", "Invalid Unicode escape"));
+                        return token;
+                    }
+                    advance();
+                    uint low = 0;
+                    for (int i = 0; i < 4; i++) {
+                        const int digit = peekChar();
+                        if (Q_UNLIKELY(digit < 0)) {
+                            return endOfData();
+                        }
+                        const int hex = hexToInt(char(digit));
+                        if (Q_UNLIKELY(hex < 0)) {
+                            setError(QCoreApplication::translate("QJsonDocument", "Invalid escape"));
+                            return token;
+                        }
+                        low = (low << 4) | uint(hex);
+                        advance();
+                    }
+                    if (low < 0xdc00 || low > 0xdfff) {
+                        setError(QCoreApplication::translate("QJsonDocument", "Invalid Unicode escape"));
+                        return token;
+                    }
+                    codepoint = 0x10000 + ((codepoint - 0xd800) << 10) + (low - 0xdc00);
+                } else if (codepoint >= 0xdc00 && codepoint <= 0xdfff) {
+                    setError(QCoreApplication::translate("QJsonDocument", "Invalid Unicode escape"));
+                    return token;
+                }
+                appendUtf8(tokendata, codepoint);
+                break;
+            }
+            default: {
+                setError(QCoreApplication::translate("QJsonDocument", "Invalid escape"));
+                return token;
+            }
+        }
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readNumber()
+{
+    tokendata.clear();
+    forever {
+        const int ch = peekChar();
+        if (ch < 0 && !deviceend) {
+            // the number may continue
+            return endOfData();
+        } else if (ch < 0 || !isJsonNumber(char(ch))) {
+            break;
+        }
+        tokendata.append(char(ch));
+        advance();
+    }
+
+    bool isreal = false;
+    if (Q_UNLIKELY(!isValidNumber(tokendata.constData(), tokendata.size(), &isreal))) {
+        setError(QCoreApplication::translate("QJsonDocument", "Invalid number"));
+        return token;
+    }
+
+    if (!isreal) {
+        // the grammar is already checked, only overflow remains
+        const char *data = tokendata.constData();
+        const bool negative = (data[0] == '-');
+        quint64 value = 0;
+        for (int i = (negative ? 1 : 0); i < tokendata.size(); i++) {
+            const quint64 digit = quint64(data[i] - '0');
+            if (Q_UNLIKELY(value > (Q_UINT64_C(9223372036854775808) - digit) / 10)) {
+                setError(QCoreApplication::translate("QJsonDocument", "Too big integer"));
+                return token;
+            }
+            value = (value * 10) + digit;
+        }
+        if (Q_UNLIKELY(!negative && value > quint64(Q_INT64_C(9223372036854775807)))) {
+            setError(QCoreApplication::translate("QJsonDocument", "Too big integer"));
+            return token;
+        }
+        integer = (negative ? qint64(0 - value) : qint64(value));
+        real = double(integer);
+        return endValue(QJsonStreamReader::Integer);
+    }
+
+    bool ok = false;
+    real = tokendata.toDouble(&ok);
+    if (Q_UNLIKELY(!ok || qIsInf(real))) {
+        setError(QCoreApplication::translate("QJsonDocument", "Real number overflow"));
+        return token;
+    }
+    integer = qint64(real);
+    return endValue(QJsonStreamReader::Real);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readLiteral(const char *literal, const int length,
+                                                                   const QJsonStreamReader::TokenType type,
+                                                                   const bool value)
+{
+    for (int i = 0; i < length; i++) {
+        const int ch = peekChar();
+        if (Q_UNLIKELY(ch < 0)) {
+            return endOfData();
+        } else if (ch != literal[i]) {
+            setError(QCoreApplication::translate("QJsonDocument", "Invalid literal"));
+            return token;
+        }
+        advance();
+    }
+    boolean = value;
+    return endValue(type);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::endValue(const QJsonStreamReader::TokenType type)
+{
+    token = type;
+    state = (stack.isEmpty() ? ExpectRoot : ExpectCommaOrEnd);
+    return token;
+}
+
+/*!
+    \class QJsonStreamReader
+
+    \brief The QJsonStreamReader class provides a fast parser for reading
+    JSON via a simple streaming API.
+    \since 4.14
+
+    \reentrant
+    \ingroup io
+
+    QJsonStreamReader reads JSON from a QIODevice in chunks and reports it
+    as a stream of tokens, one token per readNext() call. Unlike
+    QJsonDocument it never builds the whole document in memory, memory
+    stays bounded by the size of the largest string or number in the
+    input regardless of the size of the document.
+
+    A stream may contain any number of objects or arrays separated by
+    whitespace, such as JSON Lines logs. When all of them have been read
+    readNext() returns EndDocument.
+
+    \code
+    QJsonStreamReader reader(&file);
+    while (!reader.atEnd()) {
+        if (reader.readNext() == QJsonStreamReader::Key && reader.text() == "level") {
+            reader.readNext();
+            qDebug() << reader.value();
+        }
+    }
+    if (reader.hasError()) {
+        qWarning() << reader.errorString() << reader.lineNumber();
+    }
+    \endcode
+
+    Errors are reported the same way as QJsonDocument does and the nesting
+    is limited to the same depth. Once an error occurs readNext() returns
+    Invalid and errorString() describes the problem, lineNumber() and
+    columnNumber() point to the location of it.
+
+    Sequential devices, such as sockets, may not have received all of
+    the data yet. If the data runs out before the end of the document
+    readNext() reports PrematureEndOfDocumentError, reading continues
+    once readNext() is called again after more data arrived.
+
+    \sa QJsonStreamWriter, QJsonDocument
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum specifies the type of error the reader reports.
+
+    \value NoError No error has occurred.
+    \value NotWellFormedError The input is not valid JSON, reading can
+    not continue.
+    \value PrematureEndOfDocumentError The device has no more data yet,
+    reading continues once more data is available.
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token the reader just read.
+
+    \value NoToken The reader has not yet read anything.
+    \value Invalid An error has occurred, reported in errorString().
+    \value EndDocument The reader reached the end of the input.
+    \value StartObject The reader reports the start of an object.
+    \value EndObject The reader reports the end of an object.
+    \value StartArray The reader reports the start of an array.
+    \value EndArray The reader reports the end of an array.
+    \value Key The reader reports the key of an object member, the
+    name is available via text().
+    \value String The reader reports a string value, available via text().
+    \value Integer The reader reports an integer value, available via toInteger().
+    \value Real The reader reports a real value, available via toReal().
+    \value Bool The reader reports a boolean value, available via toBool().
+    \value Null The reader reports a null value.
+*/
+
+/*!
+    Constructs a stream reader.
+
+    \sa setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d_ptr(new QJsonStreamReaderPrivate())
+{
+}
+
+/*!
+    Creates a new stream reader that reads from \a device.
+
+    \sa setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d_ptr(new QJsonStreamReaderPrivate())
+{
+    setDevice(device);
+}
+
+/*!
+    Destructs the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+    delete d_ptr;
+}
+
+/*!
+    Sets the current device to \a device. Setting the device resets
+    the stream to its initial state.
+
+    \sa device()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    Q_D(QJsonStreamReader);
+    d->reset();
+    d->device = device;
+}
+
+/*!
+    Returns the current device associated with the QJsonStreamReader,
+    or 0 if no device has been assigned.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->device;
+}
+
+/*!
+    Returns true if the reader has read until the end of the input, or
+    if an error has occurred and reading has been aborted. Otherwise,
+    it returns false.
+
+    \sa hasError()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    Q_D(const QJsonStreamReader);
+    return (d->token == QJsonStreamReader::EndDocument || d->token == QJsonStreamReader::Invalid);
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    If the device has no more data before the end of the document,
+    error() returns PrematureEndOfDocumentError. The token that was
+    being read is discarded and it is read again by the next call of
+    this function, once the device has more data. Once any other error
+    is reported further reading of the stream is not possible, atEnd()
+    and hasError() return true and this function returns
+    QJsonStreamReader::Invalid.
+
+    \sa tokenType(), error()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    Q_D(QJsonStreamReader);
+    if (d->error == QJsonStreamReader::PrematureEndOfDocumentError) {
+        // more data may have arrived meanwhile
+        d->token = QJsonStreamReader::NoToken;
+        d->error = QJsonStreamReader::NoError;
+        d->errorstring.clear();
+        d->deviceend = false;
+    } else if (Q_UNLIKELY(atEnd())) {
+        return d->token;
+    }
+    if (Q_UNLIKELY(!d->device)) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "Data is empty"));
+        return d->token;
+    }
+
+    forever {
+        d->skipWhitespace();
+        d->tokenstart = d->bufferpos;
+        d->tokenoffset = d->offset;
+        const int ch = d->peekChar();
+        if (ch < 0) {
+            if (d->deviceend && d->state == QJsonStreamReaderPrivate::ExpectRoot) {
+                d->token = QJsonStreamReader::EndDocument;
+                return d->token;
+            }
+            return d->endOfData();
+        }
+
+        switch (d->state) {
+            case QJsonStreamReaderPrivate::ExpectRoot: {
+                if (ch != '{' && ch != '[') {
+                    d->setError(QCoreApplication::translate("QJsonDocument", "Rootless values are not supported"));
+                    return d->token;
+                }
+                return d->readValue(ch);
+            }
+            case QJsonStreamReaderPrivate::ExpectKeyOrEnd:
+            case QJsonStreamReaderPrivate::ExpectKey: {
+                if (ch == '"') {
+                    return d->readString(QJsonStreamReader::Key);
+                } else if (ch == '}' && d->state == QJsonStreamReaderPrivate::ExpectKeyOrEnd) {
+                    d->advance();
+                    d->stack.chop(1);
+                    return d->endValue(QJsonStreamReader::EndObject);
+                }
+                d->setError(QCoreApplication::translate("QJsonDocument", "String or '}' expected"));
+                return d->token;
+            }
+            case QJsonStreamReaderPrivate::ExpectColon: {
+                if (ch != ':') {
+                    d->setError(QCoreApplication::translate("QJsonDocument", "':' expected"));
+                    return d->token;
+                }
+                d->advance();
+                d->state = QJsonStreamReaderPrivate::ExpectValue;
+                break;
+            }
+            case QJsonStreamReaderPrivate::ExpectValueOrEnd: {
+                if (ch == ']') {
+                    d->advance();
+                    d->stack.chop(1);
+                    return d->endValue(QJsonStreamReader::EndArray);
+                }
+                return d->readValue(ch);
+            }
+            case QJsonStreamReaderPrivate::ExpectValue: {
+                return d->readValue(ch);
+            }
+            case QJsonStreamReaderPrivate::ExpectCommaOrEnd: {
+                const char container = d->stack.at(d->stack.size() - 1);
+                if (ch == ',') {
+                    d->advance();
+                    d->state = (container == '{' ? QJsonStreamReaderPrivate::ExpectKey : QJsonStreamReaderPrivate::ExpectValue);
+                    break;
+                } else if (ch == '}' && container == '{') {
+                    d->advance();
+                    d->stack.chop(1);
+                    return d->endValue(QJsonStreamReader::EndObject);
+                } else if (ch == ']' && container == '[') {
+                    d->advance();
+                    d->stack.chop(1);
+                    return d->endValue(QJsonStreamReader::EndArray);
+                }
+                if (container == '{') {
+                    d->setError(QCoreApplication::translate("QJsonDocument", "',' or '}' expected"));
+                } else {
+                    d->setError(QCoreApplication::translate("QJsonDocument", "',' or ']' expected"));
+                }
+                return d->token;
+            }
+        }
+    }
+}
+
+/*!
+    Reads until the end of the current object or array, skipping any
+    nested values. If the current token is a key, its value is skipped.
+    For any other token this function does nothing.
+*/
+void QJsonStreamReader::skipCurrentValue()
+{
+    Q_D(QJsonStreamReader);
+    int depth = 0;
+    switch (d->token) {
+        case QJsonStreamReader::StartObject:
+        case QJsonStreamReader::StartArray: {
+            depth = 1;
+            break;
+        }
+        case QJsonStreamReader::Key: {
+            switch (readNext()) {
+                case QJsonStreamReader::StartObject:
+                case QJsonStreamReader::StartArray: {
+                    depth = 1;
+                    break;
+                }
+                default: {
+                    return;
+                }
+            }
+            break;
+        }
+        default: {
+            return;
+        }
+    }
+
+    while (depth > 0) {
+        switch (readNext()) {
+            case QJsonStreamReader::StartObject:
+            case QJsonStreamReader::StartArray: {
+                depth++;
+                break;
+            }
+            case QJsonStreamReader::EndObject:
+            case QJsonStreamReader::EndArray: {
+                depth--;
+                break;
+            }
+            case QJsonStreamReader::Invalid:
+            case QJsonStreamReader::EndDocument: {
+                return;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+}
+
+/*!
+    Returns the type of the current token.
+
+    \sa readNext()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->token;
+}
+
+/*!
+    Returns the number of objects and arrays that are currently open.
+    The start of a object or array is reported at the depth it opened,
+    its end at the depth of the enclosing value.
+*/
+int QJsonStreamReader::depth() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->stack.size();
+}
+
+/*!
+    Returns the text of a Key or String token, otherwise returns an
+    empty string.
+*/
+QString QJsonStreamReader::text() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->token == QJsonStreamReader::Key || d->token == QJsonStreamReader::String) {
+        return QString::fromUtf8(d->tokendata.constData(), d->tokendata.size());
+    }
+    return QString();
+}
+
+/*!
+    Returns the value of an Integer or Real token, otherwise returns 0.
+    Real values are truncated.
+*/
+qint64 QJsonStreamReader::toInteger() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->token == QJsonStreamReader::Integer || d->token == QJsonStreamReader::Real) {
+        return d->integer;
+    }
+    return 0;
+}
+
+/*!
+    Returns the value of a Real or Integer token, otherwise returns 0.0.
+*/
+double QJsonStreamReader::toReal() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->token == QJsonStreamReader::Integer || d->token == QJsonStreamReader::Real) {
+        return d->real;
+    }
+    return 0.0;
+}
+
+/*!
+    Returns the value of a Bool token, otherwise returns false.
+*/
+bool QJsonStreamReader::toBool() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->token == QJsonStreamReader::Bool) {
+        return d->boolean;
+    }
+    return false;
+}
+
+/*!
+    Returns the value of the current token as QVariant of the type
+    QJsonDocument uses for it. For tokens that are not values, such as
+    StartObject, an invalid QVariant is returned.
+*/
+QVariant QJsonStreamReader::value() const
+{
+    Q_D(const QJsonStreamReader);
+    switch (d->token) {
+        case QJsonStreamReader::String: {
+            return QVariant(text());
+        }
+        case QJsonStreamReader::Integer: {
+            return QVariant(d->integer);
+        }
+        case QJsonStreamReader::Real: {
+            return QVariant(d->real);
+        }
+        case QJsonStreamReader::Bool: {
+            return QVariant(d->boolean);
+        }
+        default: {
+            return QVariant();
+        }
+    }
+}
+
+/*!
+    Returns the current line number, starting with 1.
+
+    \sa columnNumber(), characterOffset()
+*/
+qint64 QJsonStreamReader::lineNumber() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->line;
+}
+
+/*!
+    Returns the current column number, starting with 0.
+
+    \sa lineNumber(), characterOffset()
+*/
+qint64 QJsonStreamReader::columnNumber() const
+{
+    Q_D(const QJsonStreamReader);
+    return (d->offset - d->linestart);
+}
+
+/*!
+    Returns the number of bytes read from the device so far.
+
+    \sa lineNumber(), columnNumber()
+*/
+qint64 QJsonStreamReader::characterOffset() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->offset;
+}
+
+/*!
+    Returns the type of the current error, or NoError if no error
+    occurred.
+
+    \sa errorString(), hasError()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->error;
+}
+
+/*!
+    Returns true if an error has occurred, otherwise false.
+
+    \sa errorString(), error()
+*/
+bool QJsonStreamReader::hasError() const
+{
+    Q_D(const QJsonStreamReader);
+    return (d->error != QJsonStreamReader::NoError);
+}
+
+/*!
+    Returns the error message of the last error.
+
+    \sa hasError(), lineNumber(), columnNumber()
+*/
+QString QJsonStreamReader::errorString() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->errorstring;
+}
+
+
+class QJsonStreamWriterPrivate
+{
+public:
+    QJsonStreamWriterPrivate();
+
+    bool beginValue(const bool container);
+    void endValue();
+    void writeIndent();
+    void writeEscaped(const QByteArray &data);
+    bool writeBuffer();
+    void setError(const QString &message);
+
+    QIODevice *device;
+    QByteArray buffer;
+    // one '{' or '[' per open container
+    QByteArray stack;
+    bool empty;
+    bool haskey;
+    bool autoformatting;
+    QString error;
+};
+
+QJsonStreamWriterPrivate::QJsonStreamWriterPrivate()
+    : device(nullptr),
+    empty(true),
+    haskey(false),
+    autoformatting(false)
+{
+}
+
+void QJsonStreamWriterPrivate::setError(const QString &message)
+{
+    if (error.isEmpty()) {
+        error = message;
+    }
+}
+
+void QJsonStreamWriterPrivate::writeIndent()
+{
+    buffer.append('\n');
+    buffer.append(QByteArray(stack.size() * 4, ' '));
+}
+
+// prepares for a value, writes the separator if needed
+bool QJsonStreamWriterPrivate::beginValue(const bool container)
+{
+    if (Q_UNLIKELY(!error.isEmpty())) {
+        return false;
+    } else if (Q_UNLIKELY(!device)) {
+        setError(QCoreApplication::translate("QJsonDocument", "Data is empty"));
+        return false;
+    }
+
+    if (stack.isEmpty()) {
+        if (Q_UNLIKELY(!container)) {
+            setError(QCoreApplication::translate("QJsonDocument", "Rootless values are not supported"));
+            return false;
+        }
+        return true;
+    }
+
+    if (stack.at(stack.size() - 1) == '{') {
+        if (Q_UNLIKELY(!haskey)) {
+            setError(QCoreApplication::translate("QJsonDocument", "Key expected"));
+            return false;
+        }
+        haskey = false;
+        return true;
+    }
+
+    if (!empty) {
+        buffer.append(',');
+    }
+    if (autoformatting) {
+        writeIndent();
+    }
+    empty = false;
+    return true;
+}
+
+void QJsonStreamWriterPrivate::endValue()
+{
+    empty = false;
+    if (stack.isEmpty()) {
+        // one document per line
+        buffer.append('\n');
+    }
+    if (buffer.size() >= QJsonStreamChunkSize) {
+        writeBuffer();
+    }
+}
+
+void QJsonStreamWriterPrivate::writeEscaped(const QByteArray &data)
+{
+    static const char hexdigits[] = "0123456789abcdef";
+
+    buffer.append('"');
+    const char *chars = data.constData();
+    const int size = data.size();
+    int start = 0;
+    for (int i = 0; i < size; i++) {
+        const uchar ch = uchar(chars[i]);
+        if (ch >= 0x20 && ch != '"' && ch != '\\') {
+            continue;
+        }
+        buffer.append(chars + start, i - start);
+        start = i + 1;
+        buffer.append('\\');
+        switch (ch) {
+            case '"':
+            case '\\': {
+                buffer.append(char(ch));
+                break;
+            }
+            case '\b': {
+                buffer.append('b');
+                break;
+            }
+            case '\f': {
+                buffer.append('f');
+                break;
+            }
+            case '\n': {
+                buffer.append('n');
+                break;
+            }
+            case '\r': {
+                buffer.append('r');
+                break;
+            }
+            case '\t': {
+                buffer.append('t');
+                break;
+            }
+            default: {
+                const char unicode[] = { 'u', '0', '0', hexdigits[ch >> 4], hexdigits[ch & 0xf] };
+                buffer.append(unicode, sizeof(unicode));
+                break;
+            }
+        }
+    }
+    buffer.append(chars + start, size - start);
+    buffer.append('"');
+}
+
+bool QJsonStreamWriterPrivate::writeBuffer()
+{
+    if (buffer.isEmpty() || !device) {
+        return true;
+    }
+    const qint64 written = device->write(buffer);
+    const bool failed = (written != qint64(buffer.size()));
+    buffer.clear();
+    if (Q_UNLIKELY(failed)) {
+        setError(device->errorString());
+        return false;
+    }
+    return true;
+}
+
+/*!
+    \class QJsonStreamWriter
+
+    \brief The QJsonStreamWriter class provides a JSON writer with a
+    simple streaming API.
+    \since 4.14
+
+    \reentrant
+    \ingroup io
+
+    QJsonStreamWriter is the counterpart to QJsonStreamReader for
+    writing JSON. Values are appended to the device as they are written,
+    without building a QVariant tree first, so large documents and
+    JSON Lines logs can be produced with bounded memory.
+
+    Each top-level object or array is terminated by a new line. Members
+    of objects are written by calling writeKey() followed by the value:
+
+    \code
+    QJsonStreamWriter writer(&file);
+    writer.writeStartObject();
+    writer.writeKey("level");
+    writer.writeString("info");
+    writer.writeKey("elapsed");
+    writer.writeInteger(42);
+    writer.writeEndObject();
+    \endcode
+
+    Output is buffered, call flush() or destroy the writer to write any
+    remaining data to the device. Once an error occurs, such as a value
+    without a key inside an object or the nesting being deeper than
+    QJsonDocument allows, further writes are ignored and errorString()
+    describes the problem.
+
+    \sa QJsonStreamReader, QJsonDocument
+*/
+
+/*!
+    Constructs a stream writer.
+
+    \sa setDevice()
+*/
+QJsonStreamWriter::QJsonStreamWriter()
+    : d_ptr(new QJsonStreamWriterPrivate())
+{
+}
+
+/*!
+    Constructs a stream writer that writes to \a device.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : d_ptr(new QJsonStreamWriterPrivate())
+{
+    d_ptr->device = device;
+}
+
+/*!
+    Destructor, writes any buffered data to the device.
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    flush();
+    delete d_ptr;
+}
+
+/*!
+    Sets the current device to \a device, any data buffered for the
+    previous device is written to it first.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    Q_D(QJsonStreamWriter);
+    flush();
+    d->device = device;
+    d->stack.clear();
+    d->empty = true;
+    d->haskey = false;
+    d->error.clear();
+}
+
+/*!
+    Returns the current device associated with the QJsonStreamWriter,
+    or 0 if no device has been assigned.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->device;
+}
+
+/*!
+    Enables auto formatting if \a enable is true, otherwise disables
+    it. Auto formatting indents members and array items by four spaces,
+    like QJsonDocument::toJson() does.
+
+    The default value is false.
+*/
+void QJsonStreamWriter::setAutoFormatting(bool enable)
+{
+    Q_D(QJsonStreamWriter);
+    d->autoformatting = enable;
+}
+
+/*!
+    Returns true if auto formatting is enabled, otherwise false.
+*/
+bool QJsonStreamWriter::autoFormatting() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->autoformatting;
+}
+
+/*!
+    Writes the start of an object.
+
+    \sa writeEndObject(), writeKey()
+*/
+void QJsonStreamWriter::writeStartObject()
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(true)) {
+        return;
+    }
+    if (Q_UNLIKELY(d->stack.size() >= JSON_PARSER_MAX_DEPTH)) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "Maximum depth reached"));
+        return;
+    }
+    d->buffer.append('{');
+    d->stack.append('{');
+    d->empty = true;
+}
+
+/*!
+    Closes the object opened by writeStartObject().
+*/
+void QJsonStreamWriter::writeEndObject()
+{
+    Q_D(QJsonStreamWriter);
+    if (Q_UNLIKELY(!d->error.isEmpty())) {
+        return;
+    } else if (Q_UNLIKELY(d->stack.isEmpty() || d->stack.at(d->stack.size() - 1) != '{' || d->haskey)) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "No object to end"));
+        return;
+    }
+    d->stack.chop(1);
+    if (d->autoformatting && !d->empty) {
+        d->writeIndent();
+    }
+    d->buffer.append('}');
+    d->endValue();
+}
+
+/*!
+    Writes the start of an array.
+
+    \sa writeEndArray()
+*/
+void QJsonStreamWriter::writeStartArray()
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(true)) {
+        return;
+    }
+    if (Q_UNLIKELY(d->stack.size() >= JSON_PARSER_MAX_DEPTH)) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "Maximum depth reached"));
+        return;
+    }
+    d->buffer.append('[');
+    d->stack.append('[');
+    d->empty = true;
+}
+
+/*!
+    Closes the array opened by writeStartArray().
+*/
+void QJsonStreamWriter::writeEndArray()
+{
+    Q_D(QJsonStreamWriter);
+    if (Q_UNLIKELY(!d->error.isEmpty())) {
+        return;
+    } else if (Q_UNLIKELY(d->stack.isEmpty() || d->stack.at(d->stack.size() - 1) != '[')) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "No array to end"));
+        return;
+    }
+    d->stack.chop(1);
+    if (d->autoformatting && !d->empty) {
+        d->writeIndent();
+    }
+    d->buffer.append(']');
+    d->endValue();
+}
+
+/*!
+    Writes the \a key of an object member, the value of the member
+    must be written next.
+*/
+void QJsonStreamWriter::writeKey(const QString &key)
+{
+    Q_D(QJsonStreamWriter);
+    if (Q_UNLIKELY(!d->error.isEmpty())) {
+        return;
+    } else if (Q_UNLIKELY(d->stack.isEmpty() || d->stack.at(d->stack.size() - 1) != '{' || d->haskey)) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "Value expected"));
+        return;
+    }
+    if (!d->empty) {
+        d->buffer.append(',');
+    }
+    if (d->autoformatting) {
+        d->writeIndent();
+    }
+    d->writeEscaped(key.toUtf8());
+    d->buffer.append(d->autoformatting ? ": " : ":");
+    d->haskey = true;
+    d->empty = false;
+}
+
+/*!
+    Writes the string \a value.
+*/
+void QJsonStreamWriter::writeString(const QString &value)
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(false)) {
+        return;
+    }
+    d->writeEscaped(value.toUtf8());
+    d->endValue();
+}
+
+/*!
+    Writes the integer \a value.
+*/
+void QJsonStreamWriter::writeInteger(qint64 value)
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(false)) {
+        return;
+    }
+    d->buffer.append(QByteArray::number(value));
+    d->endValue();
+}
+
+/*!
+    Writes the real \a value using the shortest form that reads back to
+    the same value. Infinity and NaN can not be represented in JSON and
+    are reported as error.
+*/
+void QJsonStreamWriter::writeReal(double value)
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(false)) {
+        return;
+    }
+    if (Q_UNLIKELY(qIsInf(value) || qIsNaN(value))) {
+        d->setError(QCoreApplication::translate("QJsonDocument", "Invalid real number"));
+        return;
+    }
+    const QByteArray number = QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+    d->buffer.append(number);
+    // keep the value a real when read back
+    if (number.indexOf('.') < 0 && number.indexOf('e') < 0) {
+        d->buffer.append(".0");
+    }
+    d->endValue();
+}
+
+/*!
+    Writes the boolean \a value.
+*/
+void QJsonStreamWriter::writeBool(bool value)
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(false)) {
+        return;
+    }
+    if (value) {
+        d->buffer.append("true", 4);
+    } else {
+        d->buffer.append("false", 5);
+    }
+    d->endValue();
+}
+
+/*!
+    Writes a null value.
+*/
+void QJsonStreamWriter::writeNull()
+{
+    Q_D(QJsonStreamWriter);
+    if (!d->beginValue(false)) {
+        return;
+    }
+    d->buffer.append("null", 4);
+    d->endValue();
+}
+
+/*!
+    Writes \a value, maps, hashes and lists are written recursively.
+    The same types QJsonDocument::fromVariant() supports are supported.
+    Members of hashes are written sorted by key, like those of maps.
+*/
+void QJsonStreamWriter::writeValue(const QVariant &value)
+{
+    Q_D(QJsonStreamWriter);
+    switch (value.type()) {
+        case QVariant::Invalid: {
+            writeNull();
+            break;
+        }
+        case QVariant::Bool: {
+            writeBool(value.toBool());
+            break;
+        }
+        case QVariant::Int:
+        case QVariant::LongLong: {
+            writeInteger(value.toLongLong());
+            break;
+        }
+        case QVariant::UInt:
+        case QVariant::ULongLong: {
+            // values above the range of qint64 must not turn negative
+            if (!d->beginValue(false)) {
+                return;
+            }
+            d->buffer.append(QByteArray::number(value.toULongLong()));
+            d->endValue();
+            break;
+        }
+        case QVariant::Float:
+        case QVariant::Double: {
+            writeReal(value.toDouble());
+            break;
+        }
+        case QVariant::ByteArray:
+        case QVariant::String: {
+            writeString(value.toString());
+            break;
+        }
+        case QVariant::List: {
+            writeStartArray();
+            const QVariantList list = value.toList();
+            for (int i = 0; i < list.size() && d->error.isEmpty(); i++) {
+                writeValue(list.at(i));
+            }
+            writeEndArray();
+            break;
+        }
+        case QVariant::StringList: {
+            writeStartArray();
+            const QStringList list = value.toStringList();
+            for (int i = 0; i < list.size(); i++) {
+                writeString(list.at(i));
+            }
+            writeEndArray();
+            break;
+        }
+        case QVariant::Hash: {
+            writeStartObject();
+            const QVariantHash hash = value.toHash();
+            // hashes are not ordered, sort the keys to make the output reproducible
+            QStringList keys = hash.keys();
+            qSort(keys);
+            for (int i = 0; i < keys.size() && d->error.isEmpty(); i++) {
+                writeKey(keys.at(i));
+                writeValue(hash.value(keys.at(i)));
+            }
+            writeEndObject();
+            break;
+        }
+        case QVariant::Map: {
+            writeStartObject();
+            const QVariantMap map = value.toMap();
+            QVariantMap::const_iterator it = map.constBegin();
+            while (it != map.constEnd() && d->error.isEmpty()) {
+                writeKey(it.key());
+                writeValue(it.value());
+                it++;
+            }
+            writeEndObject();
+            break;
+        }
+        default: {
+            d->setError(QCoreApplication::translate("QJsonDocument", "Unknown variant type"));
+            break;
+        }
+    }
+}
+
+/*!
+    Writes any buffered data to the device. Returns true on success,
+    otherwise false.
+*/
+bool QJsonStreamWriter::flush()
+{
+    Q_D(QJsonStreamWriter);
+    return d->writeBuffer();
+}
+
+/*!
+    Returns true if an error has occurred, otherwise false.
+
+    \sa errorString()
+*/
+bool QJsonStreamWriter::hasError() const
+{
+    Q_D(const QJsonStreamWriter);
+    return !d->error.isEmpty();
+}
+
+/*!
+    Returns the error message of the last error.
+
+    \sa hasError()
+*/
+QString QJsonStreamWriter::errorString() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->error;
+}
+
+QT_END_NAMESPACE
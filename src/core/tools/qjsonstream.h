@@ -0,0 +1,130 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QJSONSTREAM_H
+#define QJSONSTREAM_H
+
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QJsonStreamReaderPrivate;
+class QJsonStreamWriterPrivate;
+
+class Q_CORE_EXPORT QJsonStreamReader
+{
+    Q_DECLARE_PRIVATE(QJsonStreamReader)
+public:
+    enum TokenType {
+        NoToken = 0,
+        Invalid,
+        EndDocument,
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Key,
+        String,
+        Integer,
+        Real,
+        Bool,
+        Null
+    };
+
+    enum Error {
+        NoError = 0,
+        NotWellFormedError,
+        PrematureEndOfDocumentError
+    };
+
+    QJsonStreamReader();
+    QJsonStreamReader(QIODevice *device);
+    ~QJsonStreamReader();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    bool atEnd() const;
+    TokenType readNext();
+    void skipCurrentValue();
+
+    TokenType tokenType() const;
+    int depth() const;
+
+    QString text() const;
+    qint64 toInteger() const;
+    double toReal() const;
+    bool toBool() const;
+    QVariant value() const;
+
+    qint64 lineNumber() const;
+    qint64 columnNumber() const;
+    qint64 characterOffset() const;
+
+    Error error() const;
+    bool hasError() const;
+    QString errorString() const;
+
+private:
+    Q_DISABLE_COPY(QJsonStreamReader);
+    QJsonStreamReaderPrivate *d_ptr;
+};
+
+class Q_CORE_EXPORT QJsonStreamWriter
+{
+    Q_DECLARE_PRIVATE(QJsonStreamWriter)
+public:
+    QJsonStreamWriter();
+    QJsonStreamWriter(QIODevice *device);
+    ~QJsonStreamWriter();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    void setAutoFormatting(bool enable);
+    bool autoFormatting() const;
+
+    void writeStartObject();
+    void writeEndObject();
+    void writeStartArray();
+    void writeEndArray();
+    void writeKey(const QString &key);
+
+    void writeString(const QString &value);
+    void writeInteger(qint64 value);
+    void writeReal(double value);
+    void writeBool(bool value);
+    void writeNull();
+    void writeValue(const QVariant &value);
+
+    bool flush();
+
+    bool hasError() const;
+    QString errorString() const;
+
+private:
+    Q_DISABLE_COPY(QJsonStreamWriter);
+    QJsonStreamWriterPrivate *d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAM_H
@@ -36,6 +36,10 @@
 #include "qcorecommon_p.h"
 #include "qcore_unix_p.h"
 
+#if __has_include(<charconv>)
+#  include <charconv>
+#endif
+
 #include <unicode/ulocdata.h>
 
 // #define QLOCALE_DEBUG
@@ -168,93 +172,161 @@ static const QLocalePrivate *defaultPrivate()
     return default_lp;
 }
 
-static inline QString getLocaleListData(const char * const* data, int index)
+// the strings are UTF-16 already and not copied
+static inline QString getLocaleData(quint16 index)
 {
-    return QString::fromUtf8(data[index]);
+    if (index == 0) {
+        return QString();
+    }
+    const localeStringTblData &data = localeStringTbl[index];
+    return QString::fromRawData(reinterpret_cast<const QChar *>(localeStrings + data.offset), data.size);
 }
 
-static inline QString getLocaleData(const char *data)
+static inline QString getLocaleListData(const quint16 *data, int index)
 {
-    return QString::fromUtf8(data);
+    return getLocaleData(data[index]);
 }
 
-QLocale::Language QLocalePrivate::codeToLanguage(const QByteArray &code)
+// the code tables are sorted indexes into languageTbl, scriptTbl and countryTbl
+template <typename T>
+static inline int findCodeIndex(const char *code, const T *table, const qint16 *codeTable, qint16 codeTableSize)
 {
-    QByteArray lower = code.toLower();
+    int low = 0;
+    int high = codeTableSize;
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        const int cmp = qstrcmp(table[codeTable[middle]].code, code);
+        if (cmp == 0) {
+            return codeTable[middle];
+        } else if (cmp < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return -1;
+}
 
-    for (qint16 i = 0; i < languageAliasTblSize; i++) {
-        if (languageAliasTbl[i].original == lower) {
-            lower = languageAliasTbl[i].substitute;
-            break;
+// the alias tables are sorted by the original code, the first entry wins if there are many
+template <typename T>
+static inline const char *findCodeAlias(const char *code, const T *table, qint16 tableSize)
+{
+    int low = 0;
+    int high = tableSize;
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        if (qstrcmp(table[middle].original, code) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
         }
     }
+    if (low < tableSize && qstrcmp(table[low].original, code) == 0) {
+        return table[low].substitute;
+    }
+    return code;
+}
+
+QLocale::Language QLocalePrivate::codeToLanguage(const QByteArray &code)
+{
+    if (code.isEmpty()) {
+        return QLocale::AnyLanguage;
+    }
 
-    for (qint16 i = 0; i < languageTblSize; i++) {
-        if (languageTbl[i].code == lower)
-            return languageTbl[i].language;
+    QSTACKARRAY(char, lower, 16);
+    if (code.size() >= int(sizeof(lower))) {
+        return QLocale::C;
+    }
+    for (int i = 0; i < code.size(); i++) {
+        lower[i] = qToLower(code.at(i));
     }
 
+    const char *substitute = findCodeAlias(lower, languageAliasTbl, languageAliasTblSize);
+    const int index = findCodeIndex(substitute, languageTbl, languageCodeTbl, languageCodeTblSize);
+    if (index >= 0)
+        return languageTbl[index].language;
+
     return QLocale::C;
 }
 
 QLocale::Script QLocalePrivate::codeToScript(const QByteArray &code)
 {
-    // script is titlecased in our data
-    QByteArray title = code.toLower();
-    if (title.size() > 0) {
-        title[0] = qToUpper(code.at(0));
+    QSTACKARRAY(char, title, 16);
+    if (code.isEmpty() || code.size() >= int(sizeof(title))) {
+        return QLocale::AnyScript;
     }
 
-    for (qint16 i = 0; i < scriptAliasTblSize; i++) {
-        if (scriptAliasTbl[i].original == title) {
-            title = scriptAliasTbl[i].substitute;
-            break;
-        }
+    // script is titlecased in our data
+    title[0] = qToUpper(code.at(0));
+    for (int i = 1; i < code.size(); i++) {
+        title[i] = qToLower(code.at(i));
     }
 
-    for (qint16 i = 0; i < scriptTblSize; i++) {
-        if (scriptTbl[i].code == title)
-            return scriptTbl[i].script;
-    }
+    const char *substitute = findCodeAlias(title, scriptAliasTbl, scriptAliasTblSize);
+    const int index = findCodeIndex(substitute, scriptTbl, scriptCodeTbl, scriptCodeTblSize);
+    if (index >= 0)
+        return scriptTbl[index].script;
+
     return QLocale::AnyScript;
 }
 
 QLocale::Country QLocalePrivate::codeToCountry(const QByteArray &code)
 {
-    QByteArray upper = code.toUpper();
-
-    for (qint16 i = 0; i < countryAliasTblSize; i++) {
-        if (countryAliasTbl[i].original == upper) {
-            upper = countryAliasTbl[i].substitute;
-            break;
-        }
+    QSTACKARRAY(char, upper, 16);
+    if (code.isEmpty() || code.size() >= int(sizeof(upper))) {
+        return QLocale::AnyCountry;
     }
 
-    for (qint16 i = 0; i < countryTblSize; i++) {
-        if (countryTbl[i].code == upper)
-            return countryTbl[i].country;
+    for (int i = 0; i < code.size(); i++) {
+        upper[i] = qToUpper(code.at(i));
     }
 
+    const char *substitute = findCodeAlias(upper, countryAliasTbl, countryAliasTblSize);
+    const int index = findCodeIndex(substitute, countryTbl, countryCodeTbl, countryCodeTblSize);
+    if (index >= 0)
+        return countryTbl[index].country;
+
     return QLocale::AnyCountry;
 }
 
 const QLocalePrivate *QLocalePrivate::findLocale(QLocale::Language language, QLocale::Script script, QLocale::Country country)
 {
-    // check likely substitutes first
-    for (qint16 i = 0; i < subtagAliasTblSize; i++) {
-        if (subtagAliasTbl[i].fromlanguage == language
-            && subtagAliasTbl[i].fromscript == script
-            && subtagAliasTbl[i].fromcountry == country) {
-            QLOCALEDEBUG << "from" << language << script << country;
-            language = subtagAliasTbl[i].tolanguage;
-            script = subtagAliasTbl[i].toscript;
-            country = subtagAliasTbl[i].tocountry;
-            QLOCALEDEBUG << "to" << language << script << country;
-            break;
+    // check likely substitutes first, the table is sorted by the enum values
+    int low = 0;
+    int high = subtagAliasTblSize;
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        const subtagAliasTblData &alias = subtagAliasTbl[middle];
+        if (alias.fromlanguage < language
+            || (alias.fromlanguage == language && (alias.fromscript < script
+            || (alias.fromscript == script && alias.fromcountry < country)))) {
+            low = middle + 1;
+        } else {
+            high = middle;
         }
     }
+    if (low < subtagAliasTblSize
+        && subtagAliasTbl[low].fromlanguage == language
+        && subtagAliasTbl[low].fromscript == script
+        && subtagAliasTbl[low].fromcountry == country) {
+        QLOCALEDEBUG << "from" << language << script << country;
+        language = subtagAliasTbl[low].tolanguage;
+        script = subtagAliasTbl[low].toscript;
+        country = subtagAliasTbl[low].tocountry;
+        QLOCALEDEBUG << "to" << language << script << country;
+    }
 
-    for (qint16 i = 0; i < localeTblSize; i++) {
+    // the entries of a language are next to each other
+    qint16 first = 0;
+    qint16 last = localeTblSize;
+    if (language != QLocale::AnyLanguage) {
+        if (Q_UNLIKELY(language < 0 || language >= languageTblSize))
+            return &localeTbl[0];
+        first = localeIndexTbl[language].first;
+        last = first + localeIndexTbl[language].count;
+    }
+
+    for (qint16 i = first; i < last; i++) {
         if ((language == QLocale::AnyLanguage || localeTbl[i].m_language == language)
             && (script == QLocale::AnyScript || localeTbl[i].m_script == QLocale::AnyScript || localeTbl[i].m_script == script)
             && (country == QLocale::AnyCountry || localeTbl[i].m_country == QLocale::AnyCountry || localeTbl[i].m_country == country)) {
@@ -264,11 +336,9 @@ const QLocalePrivate *QLocalePrivate::findLocale(QLocale::Language language, QLo
     }
 
     // for compatibility match invalid cases, e.g. en_zz, to the first match for that language
-    for (qint16 i = 0; i < localeTblSize; i++) {
-        if (localeTbl[i].m_language == language) {
-            QLOCALEDEBUG << "greedy match for" << language << script << country;
-            return &localeTbl[i];
-        }
+    if (first != last && language != QLocale::AnyLanguage) {
+        QLOCALEDEBUG << "greedy match for" << language << script << country;
+        return &localeTbl[first];
     }
 
     return &localeTbl[0];
@@ -293,13 +363,8 @@ QDataStream &operator>>(QDataStream &ds, QLocale &l)
 static quint16 localePrivateIndex(const QLocalePrivate *p)
 {
     if (Q_LIKELY(p)) {
-        for (qint16 i = 0; i < localeTblSize; i++) {
-            if (p->m_language == localeTbl[i].m_language
-                && p->m_country == localeTbl[i].m_country
-                && p->m_script == localeTbl[i].m_script) {
-                return i;
-            }
-        }
+        Q_ASSERT(p >= localeTbl && p < localeTbl + localeTblSize);
+        return quint16(p - localeTbl);
     }
     return 0;
 }
@@ -433,6 +498,11 @@ QLocale::QLocale(const QLocale &other)
     p = other.p;
 }
 
+const QLocalePrivate *QLocalePrivate::c()
+{
+    return &localeTbl[0];
+}
+
 const QLocalePrivate *QLocale::d() const
 {
     return &localeTbl[p.index];
@@ -1865,7 +1935,8 @@ QString QLocalePrivate::doubleToString(const QChar _zero, const QChar plus, cons
                                        int width,
                                        unsigned flags)
 {
-    if (precision == -1)
+    const bool shortest = (precision == QLocale::FloatingPointShortest);
+    if (precision < 0 && !shortest)
         precision = 6;
     if (width == -1)
         width = 0;
@@ -1886,58 +1957,47 @@ QString QLocalePrivate::doubleToString(const QChar _zero, const QChar plus, cons
 
     // Handle normal numbers
     if (!special_number) {
-        int decpt, sign;
+        int decpt;
+        bool sign;
         QString digits;
 
-        // NOT thread safe!
-        if (form == DFDecimal) {
-            QSTACKARRAY(char, qfcvtbuf, QECVT_BUFFSIZE);
-            digits = QString::fromLatin1(qFcvt(d, precision, &decpt, &sign, qfcvtbuf));
+        if (shortest) {
+            digits = qDoubleToDigits(d, DDShortest, 0, _zero, &decpt, &sign);
+        } else if (form == DFDecimal) {
+            digits = qDoubleToDigits(d, DDDecimalDigits, precision, _zero, &decpt, &sign);
         } else {
             int pr = precision;
             if (form == DFExponent)
                 ++pr;
             else if (form == DFSignificantDigits && pr == 0)
                 pr = 1;
-            QSTACKARRAY(char, qecvtbuf, QECVT_BUFFSIZE);
-            digits = QString::fromLatin1(qEcvt(d, pr, &decpt, &sign, qecvtbuf));
-
-            // Chop trailing zeros
-            if (digits.length() > 0) {
-                int last_nonzero_idx = digits.length() - 1;
-                while (last_nonzero_idx > 0
-                       && digits.unicode()[last_nonzero_idx] == QLatin1Char('0'))
-                    --last_nonzero_idx;
-                digits.truncate(last_nonzero_idx + 1);
-            }
-
-        }
-
-        if (_zero.unicode() != '0') {
-            ushort z = _zero.unicode() - '0';
-            for (int i = 0; i < digits.length(); ++i)
-                reinterpret_cast<ushort *>(digits.data())[i] += z;
+            digits = qDoubleToDigits(d, DDSignificantDigits, pr, _zero, &decpt, &sign);
         }
 
         bool always_show_decpt = (flags & ForcePoint);
         switch (form) {
             case DFExponent: {
                 num_str = exponentForm(_zero, decimal, exponential, group, plus, minus,
-                                       digits, decpt, precision, PMDecimalDigits,
+                                       digits, decpt, precision,
+                                       shortest ? PMChopTrailingZeros : PMDecimalDigits,
                                        always_show_decpt);
                 break;
             }
             case DFDecimal: {
                 num_str = decimalForm(_zero, decimal, group,
-                                      digits, decpt, precision, PMDecimalDigits,
+                                      digits, decpt, precision,
+                                      shortest ? PMChopTrailingZeros : PMDecimalDigits,
                                       always_show_decpt, flags & ThousandsGroup);
                 break;
             }
             case DFSignificantDigits: {
-                PrecisionMode mode = (flags & ForcePoint) ?
+                PrecisionMode mode = (flags & ForcePoint && !shortest) ?
                             PMSignificantDigits : PMChopTrailingZeros;
 
-                if (decpt != digits.length() && (decpt <= -4 || decpt > precision))
+                // the shortest digits switch to the exponent form like 17
+                // significant digits do
+                const int maxdecpt = shortest ? 17 : precision;
+                if (decpt != digits.length() && (decpt <= -4 || decpt > maxdecpt))
                     num_str = exponentForm(_zero, decimal, exponential, group, plus, minus,
                                            digits, decpt, precision, mode,
                                            always_show_decpt);
@@ -1949,7 +2009,7 @@ QString QLocalePrivate::doubleToString(const QChar _zero, const QChar plus, cons
             }
         }
 
-        negative = sign != 0 && !qIsZero(d);
+        negative = sign && !qIsZero(d);
     }
 
     // pad with zeros. LeftAdjusted overrides this flag). Also, we don't
@@ -2152,6 +2212,20 @@ QString QLocalePrivate::unsLongLongToString(const QChar zero, const QChar group,
     return num_str;
 }
 
+void QLocalePrivate::CharBuff::grow()
+{
+    const int capacity = m_capacity * 2;
+    if (m_data == m_inline) {
+        m_data = static_cast<char *>(::malloc(capacity));
+        Q_CHECK_PTR(m_data);
+        ::memcpy(m_data, m_inline, m_size);
+    } else {
+        m_data = static_cast<char *>(::realloc(m_data, capacity));
+        Q_CHECK_PTR(m_data);
+    }
+    m_capacity = capacity;
+}
+
 /*
     Converts a number in locale to its representation in the C locale.
     Only has to guarantee that a string that is a correct representation of
@@ -2416,6 +2490,26 @@ double QLocalePrivate::bytearrayToDouble(const char *num, bool *ok)
     if (qstrcmp(num, "-inf") == 0)
         return -qInf();
 
+#if defined(__cpp_lib_to_chars)
+    // from_chars() does not allocate nor depend on the C locale, anything it
+    // does not consume entirely (hex, whitespace, etc.) is left to strtod()
+    const char *first = num;
+    if (first[0] == '+' && (qIsDigit(first[1]) || first[1] == '.'))
+        first++;
+    const char *last = first + qstrlen(first);
+    double value = 0.0;
+    const std::from_chars_result result = std::from_chars(first, last, value);
+    if (result.ptr == last) {
+        if (result.ec == std::errc::result_out_of_range || (result.ec == std::errc() && qIsInf(value))) {
+            if (ok != nullptr)
+                *ok = false;
+            return 0.0;
+        }
+        if (result.ec == std::errc())
+            return value;
+    }
+#endif
+
     char *endptr;
     Q_RESET_ERRNO
     double ret = std::strtod(num, &endptr);
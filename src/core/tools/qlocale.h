@@ -1280,6 +1280,9 @@ public:
         RejectGroupSeparator = 0x02
     };
     Q_DECLARE_FLAGS(NumberOptions, NumberOption)
+    enum FloatingPointPrecisionOption {
+        FloatingPointShortest = -128
+    };
 
     QLocale();
     QLocale(const QString &name);
@@ -38,6 +38,8 @@
 #include "qlocale.h"
 #include "qstdcontainers_p.h"
 
+#include <stdlib.h>
+
 QT_BEGIN_NAMESPACE
 
 class Q_CORE_EXPORT QLocalePrivate
@@ -52,6 +54,7 @@ public:
     QChar minus() const { return QChar(m_minus); }
     QChar exponential() const { return QChar(m_exponential); }
 
+    static const QLocalePrivate *c();
     static QLocale::Language codeToLanguage(const QByteArray &code);
     static QLocale::Script codeToScript(const QByteArray &code);
     static QLocale::Country codeToCountry(const QByteArray &code);
@@ -124,7 +127,32 @@ public:
     static qint64 bytearrayToLongLong(const char *num, int base, bool *ok);
     static quint64 bytearrayToUnsLongLong(const char *num, int base, bool *ok);
 
-    typedef QStdVector<char> CharBuff;
+    // the C locale version of a number, small enough in the usual case to
+    // not allocate
+    class CharBuff
+    {
+    public:
+        inline CharBuff() : m_data(m_inline), m_size(0), m_capacity(sizeof(m_inline)) { }
+        inline ~CharBuff() { if (m_data != m_inline) ::free(m_data); }
+
+        inline void append(char c)
+        {
+            if (Q_UNLIKELY(m_size == m_capacity))
+                grow();
+            m_data[m_size++] = c;
+        }
+        inline char *data() { return m_data; }
+        inline const char *constData() const { return m_data; }
+
+    private:
+        Q_DISABLE_COPY(CharBuff)
+        void grow();
+
+        char *m_data;
+        int m_size;
+        int m_capacity;
+        char m_inline[64];
+    };
     bool numberToCLocale(const QString &num,
                          GroupSeparatorMode group_sep_mode,
                          CharBuff *result) const;
@@ -150,26 +178,26 @@ public:
     const ushort m_plus;
     const ushort m_exponential;
     const uint m_zero;
-    const char* m_language_endonym;
-    const char* m_country_endonym;
-    const char* m_short_date_format;
-    const char* m_long_date_format;
-    const char* m_short_time_format;
-    const char* m_long_time_format;
-    const char* m_am;
-    const char* m_pm;
-    const char* m_standalone_short_month_names[12];
-    const char* m_standalone_long_month_names[12];
-    const char* m_standalone_narrow_month_names[12];
-    const char* m_short_month_names[12];
-    const char* m_long_month_names[12];
-    const char* m_narrow_month_names[12];
-    const char* m_standalone_short_day_names[7];
-    const char* m_standalone_long_day_names[7];
-    const char* m_standalone_narrow_day_names[7];
-    const char* m_short_day_names[7];
-    const char* m_long_day_names[7];
-    const char* m_narrow_day_names[7];
+    const quint16 m_language_endonym;
+    const quint16 m_country_endonym;
+    const quint16 m_short_date_format;
+    const quint16 m_long_date_format;
+    const quint16 m_short_time_format;
+    const quint16 m_long_time_format;
+    const quint16 m_am;
+    const quint16 m_pm;
+    const quint16 m_standalone_short_month_names[12];
+    const quint16 m_standalone_long_month_names[12];
+    const quint16 m_standalone_narrow_month_names[12];
+    const quint16 m_short_month_names[12];
+    const quint16 m_long_month_names[12];
+    const quint16 m_narrow_month_names[12];
+    const quint16 m_standalone_short_day_names[7];
+    const quint16 m_standalone_long_day_names[7];
+    const quint16 m_standalone_narrow_day_names[7];
+    const quint16 m_short_day_names[7];
+    const quint16 m_long_day_names[7];
+    const quint16 m_narrow_day_names[7];
 };
 
 inline char QLocalePrivate::digitToCLocale(const QChar &in) const
@@ -25,8 +25,13 @@
 #include "qcorecommon_p.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if __has_include(<charconv>)
+#  include <charconv>
+#endif
+
 #include <unicode/ucol.h>
 #include <unicode/ustring.h>
 
@@ -297,67 +302,122 @@ bool qt_u_strToLower(const QString &str, QString *out, const QLocale &locale)
 }
 
 
-/*
-----------------------------------------------------------------------
-Copyright © 2005-2020 Rich Felker, et al.
-
-Permission is hereby granted, free of charge, to any person obtaining
-a copy of this software and associated documentation files (the
-"Software"), to deal in the Software without restriction, including
-without limitation the rights to use, copy, modify, merge, publish,
-distribute, sublicense, and/or sell copies of the Software, and to
-permit persons to whom the Software is furnished to do so, subject to
-the following conditions:
-
-The above copyright notice and this permission notice shall be
-included in all copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
-EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
-MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
-IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
-CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
-TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
-SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
-----------------------------------------------------------------------
-*/
-// the code bellow is copy from musl libc, modified to not use static buffer
-// and use snprintf() instead of sprintf()
-char *qFcvt(double x, int n, int *dp, int *sign, char* buf)
+#if defined(__cpp_lib_to_chars)
+static char *qt_to_chars(char *first, char *last, double d, DoubleDigitsMode mode, int precision)
 {
-    QSTACKARRAY(char, tmp, 1500);
-    int i, lz;
-
-    if (n > 1400) n = 1400;
-    ::snprintf(tmp, sizeof(tmp), "%.*f", n, x);
-    i = (tmp[0] == '-');
-    if (tmp[i] == '0') lz = strspn(tmp+i+2, "0");
-    else lz = -(int)strcspn(tmp+i, ".");
-
-    if (n<=lz) {
-        *sign = i;
-        *dp = 1;
-        if (n>14) n = 14;
-        return (char*)"000000000000000"+14-n;
+    std::to_chars_result result;
+    switch (mode) {
+        case DDDecimalDigits: {
+            result = std::to_chars(first, last, d, std::chars_format::fixed, precision);
+            break;
+        }
+        case DDSignificantDigits: {
+            result = std::to_chars(first, last, d, std::chars_format::scientific, precision - 1);
+            break;
+        }
+        case DDShortest: {
+            result = std::to_chars(first, last, d, std::chars_format::scientific);
+            break;
+        }
     }
-
-    return qEcvt(x, n-lz, dp, sign, buf);
+    if (result.ec != std::errc()) {
+        return nullptr;
+    }
+    return result.ptr;
 }
+#else
+static char *qt_to_chars(char *first, char *last, double d, DoubleDigitsMode mode, int precision)
+{
+    int result = 0;
+    switch (mode) {
+        case DDDecimalDigits: {
+            result = ::snprintf(first, last - first, "%.*f", precision, d);
+            break;
+        }
+        case DDSignificantDigits: {
+            result = ::snprintf(first, last - first, "%.*e", precision - 1, d);
+            break;
+        }
+        case DDShortest: {
+            // the shortest precision that converts back to the same value,
+            // 17 digits are always enough
+            for (int i = 0; i < 17; i++) {
+                result = ::snprintf(first, last - first, "%.*e", i, d);
+                if (result > 0 && result < last - first && ::strtod(first, nullptr) == d) {
+                    break;
+                }
+            }
+            break;
+        }
+    }
+    if (result <= 0 || result >= last - first) {
+        return nullptr;
+    }
+    return first + result;
+}
+#endif
 
-char *qEcvt(double x, int n, int *dp, int *sign, char* buf)
+QString qDoubleToDigits(double d, DoubleDigitsMode mode, int precision, QChar zero,
+                        int *decpt, bool *sign)
 {
-    QSTACKARRAY(char, tmp, 32);
-    int i, j;
-
-    if (n-1 > 15) n = 15;
-    ::snprintf(tmp, sizeof(tmp), "%.*e", n-1, x);
-    i = *sign = (tmp[0]=='-');
-    for (j=0; tmp[i]!='e'; j+=(tmp[i++]!='.'))
-        buf[j] = tmp[i];
-    buf[j] = 0;
-    *dp = atoi(tmp+i+1)+1;
-
-    return buf;
+    // most numbers fit, fixed notation of large numbers with large precision
+    // may need up to 309 digits before the decimal point
+    QSTACKARRAY(char, stackbuf, 128);
+    QByteArray heapbuf;
+    char *buf = stackbuf;
+    char *end = qt_to_chars(buf, buf + sizeof(stackbuf), d, mode, precision);
+    if (!end) {
+        heapbuf.resize(precision + 330);
+        buf = heapbuf.data();
+        end = qt_to_chars(buf, buf + heapbuf.size(), d, mode, precision);
+        Q_ASSERT(end);
+    }
+
+    const char *p = buf;
+    *sign = (*p == '-');
+    if (*sign) {
+        p++;
+    }
+
+    QString digits(int(end - p), Qt::Uninitialized);
+    ushort *out = reinterpret_cast<ushort *>(digits.data());
+    int count = 0;
+    int intdigits = 0;
+    bool point = false;
+    for (; p != end && *p != 'e'; p++) {
+        if (*p == '.') {
+            point = true;
+            continue;
+        }
+        if (!point) {
+            intdigits++;
+        }
+        if (count == 0 && *p == '0') {
+            // leading zero
+            intdigits--;
+            continue;
+        }
+        out[count++] = zero.unicode() + (*p - '0');
+    }
+
+    if (count == 0) {
+        out[count++] = zero.unicode();
+        *decpt = 1;
+    } else {
+        *decpt = intdigits;
+        if (p != end) {
+            // exponent
+            *decpt += ::atoi(p + 1);
+        }
+    }
+
+    if (mode == DDSignificantDigits) {
+        while (count > 1 && out[count - 1] == zero.unicode()) {
+            count--;
+        }
+    }
+    digits.truncate(count);
+    return digits;
 }
 
 QT_END_NAMESPACE
@@ -100,9 +100,17 @@ bool qt_ucol_strcoll(const QChar *source, int sourceLength, const QChar *target,
 bool qt_u_strToUpper(const QString &str, QString *out, const QLocale &locale);
 bool qt_u_strToLower(const QString &str, QString *out, const QLocale &locale);
 
-#define QECVT_BUFFSIZE 17
-char *qFcvt(double x, int n, int *dp, int *sign, char* buf);
-char *qEcvt(double x, int n, int *dp, int *sign, char* buf);
+enum DoubleDigitsMode {
+    DDDecimalDigits,
+    DDSignificantDigits,
+    DDShortest
+};
+
+// Returns the decimal digits of d without leading zeros, using zero as the
+// '0' digit. decpt is set to the position of the decimal point relative to
+// the digits and sign to whether d is negative.
+QString qDoubleToDigits(double d, DoubleDigitsMode mode, int precision, QChar zero,
+                        int *decpt, bool *sign);
 
 QT_END_NAMESPACE
 
@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the QtCore module of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QPARALLELALGORITHMS_H
+#define QPARALLELALGORITHMS_H
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qtconcurrent.h>
+
+#include <functional>
+#include <iterator>
+
+
+QT_BEGIN_NAMESPACE
+
+#ifndef QT_NO_THREAD
+
+namespace QAlgorithmsPrivate {
+
+// ranges shorter than this are sorted by the calling thread alone
+static const int qParallelSortThreshold = 8192;
+
+// sorts chunks of the range concurrently and merges neighbouring chunks in
+// rounds, std::inplace_merge keeps equal elements in order
+template <typename RandomAccessIterator, typename LessThan>
+inline void qParallelSortHelper(RandomAccessIterator start, RandomAccessIterator end,
+                                LessThan lessThan, bool stable)
+{
+    const int count = int(end - start);
+    int chunks = 1;
+    while (chunks < QThreadPool::globalInstance()->maxThreadCount()
+           && count / (chunks * 2) >= qParallelSortThreshold / 2) {
+        chunks *= 2;
+    }
+    if (chunks == 1) {
+        if (stable) {
+            std::stable_sort(start, end, lessThan);
+        } else {
+            std::sort(start, end, lessThan);
+        }
+        return;
+    }
+
+    const int chunkSize = (count + chunks - 1) / chunks;
+    QtConcurrent::forEachBlock(chunks, [&](int from, int to) {
+        for (int i = from; i < to; ++i) {
+            RandomAccessIterator first = start + qMin(i * chunkSize, count);
+            RandomAccessIterator last = start + qMin((i + 1) * chunkSize, count);
+            if (stable) {
+                std::stable_sort(first, last, lessThan);
+            } else {
+                std::sort(first, last, lessThan);
+            }
+        }
+    });
+
+    for (int width = chunkSize; width < count; width *= 2) {
+        const int merges = (count + width * 2 - 1) / (width * 2);
+        QtConcurrent::forEachBlock(merges, [&](int from, int to) {
+            for (int i = from; i < to; ++i) {
+                const int first = i * width * 2;
+                const int middle = qMin(first + width, count);
+                const int last = qMin(first + width * 2, count);
+                if (middle < last) {
+                    std::inplace_merge(start + first, start + middle, start + last, lessThan);
+                }
+            }
+        });
+    }
+}
+
+}
+
+template <typename RandomAccessIterator, typename LessThan>
+inline void qParallelSort(RandomAccessIterator start, RandomAccessIterator end, LessThan lessThan)
+{
+    if (start != end)
+        QAlgorithmsPrivate::qParallelSortHelper(start, end, lessThan, false);
+}
+
+template <typename RandomAccessIterator>
+inline void qParallelSort(RandomAccessIterator start, RandomAccessIterator end)
+{
+    if (start != end)
+        QAlgorithmsPrivate::qParallelSortHelper(start, end, std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>(), false);
+}
+
+template<typename Container>
+inline void qParallelSort(Container &c)
+{
+    if (!c.empty())
+        qParallelSort(c.begin(), c.end());
+}
+
+template <typename RandomAccessIterator, typename LessThan>
+inline void qParallelStableSort(RandomAccessIterator start, RandomAccessIterator end, LessThan lessThan)
+{
+    if (start != end)
+        QAlgorithmsPrivate::qParallelSortHelper(start, end, lessThan, true);
+}
+
+template <typename RandomAccessIterator>
+inline void qParallelStableSort(RandomAccessIterator start, RandomAccessIterator end)
+{
+    if (start != end)
+        QAlgorithmsPrivate::qParallelSortHelper(start, end, std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>(), true);
+}
+
+template<typename Container>
+inline void qParallelStableSort(Container &c)
+{
+    if (!c.empty())
+        qParallelStableSort(c.begin(), c.end());
+}
+
+#endif // QT_NO_THREAD
+
+QT_END_NAMESPACE
+
+
+#endif // QPARALLELALGORITHMS_H
@@ -510,7 +510,9 @@ static int findChar(const QChar *str, int len, QChar ch, int from,
     the 'e', 'E', and 'f' formats, the \e precision represents the
     number of digits \e after the decimal point. For the 'g' and 'G'
     formats, the \e precision represents the maximum number of
-    significant digits (trailing zeroes are omitted).
+    significant digits (trailing zeroes are omitted). A \e precision of
+    QLocale::FloatingPointShortest selects the least number of digits
+    that reads back to exactly the same number.
 
     \sa fromRawData(), QChar, QLatin1String, QByteArray, QStringRef
 */
@@ -3226,7 +3228,7 @@ QByteArray QString::toUtf8() const
     if (isNull())
         return QByteArray();
 
-    return QTextCodecPrivate::convertFrom(constData(), length(), "UTF-8");
+    return QTextCodecPrivate::toUtf8(constData(), length());
 }
 
 /*!
@@ -3267,9 +3269,7 @@ QString::Data *QString::fromLatin1_helper(const char *str, int size)
         d->capacity = 0;
         d->data = d->array;
         d->array[size] = '\0';
-        ushort *dst = d->data;
-        while (size--)
-            *dst++ = (uchar)*str++;
+        QTextCodecPrivate::fromLatin1(d->data, str, size);
     }
     return d;
 }
@@ -3307,10 +3307,7 @@ QString QString::fromLatin1(const char *str, int size)
     if (!str) {
         return QString();
     }
-    if (size < 0) {
-        size = qstrlen(str);
-    }
-    return QTextCodecPrivate::convertTo(str, size, "latin1");
+    return QString(fromLatin1_helper(str, size), 0);
 }
 
 /*!
@@ -3389,7 +3386,7 @@ QString QString::fromUtf8(const char *str, int size)
     if (size < 0) {
         size = qstrlen(str);
     }
-    return QTextCodecPrivate::convertTo(str, size, "UTF-8");
+    return QTextCodecPrivate::fromUtf8(str, size);
 }
 
 /*!
@@ -4416,7 +4413,7 @@ QString &QString::vsprintf(const char* cformat, va_list ap)
     }
 
     // Parse cformat
-    QLocale locale(QLocale::C);
+    const QLocalePrivate *locale = QLocalePrivate::c();
     QString result;
     const char *c = cformat;
     for (;;) {
@@ -4589,7 +4586,7 @@ QString &QString::vsprintf(const char* cformat, va_list ap)
                     case lm_t: i = va_arg(ap, int); break;
                     default: i = 0; break;
                 }
-                subst = locale.d()->longLongToString(i, precision, 10, width, flags);
+                subst = locale->longLongToString(i, precision, 10, width, flags);
                 ++c;
                 break;
             }
@@ -4631,7 +4628,7 @@ QString &QString::vsprintf(const char* cformat, va_list ap)
                     default:
                         break;
                 }
-                subst = locale.d()->unsLongLongToString(u, precision, base, width, flags);
+                subst = locale->unsLongLongToString(u, precision, base, width, flags);
                 ++c;
                 break;
             }
@@ -4674,7 +4671,7 @@ QString &QString::vsprintf(const char* cformat, va_list ap)
                     default:
                         break;
                 }
-                subst = locale.d()->doubleToString(d, precision, form, width, flags);
+                subst = locale->doubleToString(d, precision, form, width, flags);
                 ++c;
                 break;
             }
@@ -4704,7 +4701,7 @@ QString &QString::vsprintf(const char* cformat, va_list ap)
                 void *arg = va_arg(ap, void*);
                 quint64 i = reinterpret_cast<unsigned long>(arg);
                 flags |= QLocalePrivate::ForcePoint;
-                subst = locale.d()->unsLongLongToString(i, precision, 16, width, flags);
+                subst = locale->unsLongLongToString(i, precision, 16, width, flags);
                 ++c;
                 break;
             }
@@ -4795,9 +4792,7 @@ qint64 QString::toLongLong(bool *ok, int base) const
         return result;
     }
 
-    QLocale c_locale(QLocale::C);
-    c_locale.setNumberOptions(QLocale::RejectGroupSeparator);
-    return c_locale.toLongLong(*this, ok, base);
+    return QLocalePrivate::c()->stringToLongLong(*this, base, ok, QLocalePrivate::FailOnGroupSeparators);
 }
 
 /*!
@@ -4838,9 +4833,7 @@ quint64 QString::toULongLong(bool *ok, int base) const
         return result;
     }
 
-    QLocale c_locale(QLocale::C);
-    c_locale.setNumberOptions(QLocale::RejectGroupSeparator);
-    return c_locale.toULongLong(*this, ok, base);
+    return QLocalePrivate::c()->stringToUnsLongLong(*this, base, ok, QLocalePrivate::FailOnGroupSeparators);
 }
 
 /*!
@@ -5076,9 +5069,7 @@ double QString::toDouble(bool *ok) const
         return result;
     }
 
-    QLocale c_locale(QLocale::C);
-    c_locale.setNumberOptions(QLocale::RejectGroupSeparator);
-    return c_locale.toDouble(*this, ok);
+    return QLocalePrivate::c()->stringToDouble(*this, ok, QLocalePrivate::FailOnGroupSeparators);
 }
 
 /*!
@@ -5106,9 +5097,7 @@ float QString::toFloat(bool *ok) const
         return result;
     }
 
-    QLocale c_locale(QLocale::C);
-    c_locale.setNumberOptions(QLocale::RejectGroupSeparator);
-    return c_locale.toFloat(*this, ok);
+    return QLocalePrivate::c()->stringToFloat(*this, ok, QLocalePrivate::FailOnGroupSeparators);
 }
 
 /*! \fn QString &QString::setNum(int n, int base)
@@ -5273,8 +5262,7 @@ QString QString::number(qlonglong n, int base)
         base = 10;
     }
 #endif
-    QLocale locale(QLocale::C);
-    return locale.d()->longLongToString(n, -1, base);
+    return QLocalePrivate::c()->longLongToString(n, -1, base);
 }
 
 /*!
@@ -5288,8 +5276,7 @@ QString QString::number(qulonglong n, int base)
         base = 10;
     }
 #endif
-    QLocale locale(QLocale::C);
-    return locale.d()->unsLongLongToString(n, -1, base);
+    return QLocalePrivate::c()->unsLongLongToString(n, -1, base);
 }
 
 
@@ -5337,8 +5324,7 @@ QString QString::number(double n, char f, int prec)
         }
     }
 
-    QLocale locale(QLocale::C);
-    return locale.d()->doubleToString(n, prec, form, -1, flags);
+    return QLocalePrivate::c()->doubleToString(n, prec, form, -1, flags);
 }
 
 /*!
@@ -8149,7 +8135,7 @@ QByteArray QStringRef::toUtf8() const
 {
     if (isNull())
         return QByteArray();
-    return QTextCodecPrivate::convertFrom(constData(), length(), "UTF-8");
+    return QTextCodecPrivate::toUtf8(constData(), length());
 }
 
 /*!
@@ -48,6 +48,8 @@
 
 #include <dbus/dbus.h>
 
+#include <mutex>
+
 QT_BEGIN_NAMESPACE
 
 class QDBusMessage;
@@ -34,6 +34,8 @@
 
 #include <QtCore/qglobal.h>
 
+#include <mutex>
+
 
 QT_BEGIN_NAMESPACE
 
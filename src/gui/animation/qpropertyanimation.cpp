@@ -73,6 +73,8 @@
 #include "qpropertyanimation_p.h"
 #include "qmutex.h"
 
+#include <mutex>
+
 #ifndef QT_NO_ANIMATION
 
 QT_BEGIN_NAMESPACE
@@ -27,12 +27,17 @@
 #include "qstylehelper_p.h"
 #include "qguicommon_p.h"
 #include "qcore_unix_p.h"
+#include "qkathandler_p.h"
 #include "qdebug.h"
 
 #include <QtCore/QList>
 #include <QtCore/QHash>
+#include <QtCore/QDataStream>
 #include <QtCore/QDir>
 #include <QtCore/QSettings>
+#include <QtCore/QFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/qendian.h>
 #include <QtGui/QPainter>
 #include <QtGui/QImageReader>
 #include <QtGui/QPixmapCache>
@@ -40,6 +45,10 @@
 #include <QtGui/QStyleOption>
 
 #include <limits.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+#include "xxhash.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -51,9 +60,69 @@ Q_GLOBAL_STATIC(QIconLoader, iconLoaderInstance)
 /* Theme to use in last resort, if the theme does not have the icon, neither the parents  */
 static const QString fallbackTheme = QLatin1String("hicolor");
 
+// how often, in milliseconds, the theme directories are checked for changes
+static const qint64 themeCheckInterval = 5000;
+
+// icon-theme.cache as written by gtk-update-icon-cache, all values are
+// big-endian and the offsets are from the start of the file:
+//   header: major (16), minor (16), hash offset (32), directory list offset (32)
+//   directory list: count (32), directory name offsets (32)
+//   hash: bucket count (32), icon offsets (32)
+//   icon: next icon in the bucket offset (32), name offset (32), image list offset (32)
+//   image list: count (32), images of directory index (16), flags (16) and data offset (32)
+static const quint16 iconCacheMajorVersion = 1;
+static const quint16 iconCacheSvgFlag = 0x2;
+static const quint16 iconCachePngFlag = 0x4;
+static const quint32 iconCacheHeaderSize = 12;
+
+static inline quint32 qIconCacheHash(const char *name)
+{
+    // same as icon_name_hash() in GTK, the characters are signed
+    const signed char *p = reinterpret_cast<const signed char*>(name);
+    quint32 h = *p;
+    if (h) {
+        for (p += 1; *p != '\0'; p++) {
+            h = (h << 5) - h + *p;
+        }
+    }
+    return h;
+}
+
+// in nanoseconds, directories can be modified more than once per second
+static inline qint64 qModificationTime(const QT_STATBUF &statbuf)
+{
+    return (qint64(statbuf.st_mtim.tv_sec) * Q_INT64_C(1000000000) + statbuf.st_mtim.tv_nsec);
+}
+
+static inline qint64 qModificationTime(const QByteArray &path)
+{
+    QT_STATBUF statbuf;
+    if (QT_STAT(path.constData(), &statbuf) != 0) {
+        return 0;
+    }
+    return qModificationTime(statbuf);
+}
+
+// symbolic links are followed, dangling ones are not icons
+static inline bool qIsIconFile(const QByteArray &dirPath, const QT_DIRENT *dirent)
+{
+#ifdef QT_HAVE_DIRENT_D_TYPE
+    if (dirent->d_type == DT_REG) {
+        return true;
+    } else if (dirent->d_type != DT_LNK && dirent->d_type != DT_UNKNOWN) {
+        return false;
+    }
+#endif
+    QT_STATBUF statbuf;
+    const QByteArray filePath = dirPath + '/' + dirent->d_name;
+    return (QT_STAT(filePath.constData(), &statbuf) == 0
+        && (statbuf.st_mode & QT_STAT_MASK) == QT_STAT_REG);
+}
+
 QIconLoader::QIconLoader()
     : m_themeKey(1),
-    m_supportsSvg(false)
+    m_supportsSvg(false),
+    m_iconCacheChecked(false)
 {
     Q_ASSERT(qApp);
 
@@ -108,6 +177,373 @@ QStringList QIconLoader::themeSearchPaths() const
     return m_iconDirs;
 }
 
+QIconThemeIndex::QIconThemeIndex(const QString &contentDir, const QList<QIconDirInfo> &keyList)
+    : m_cache(nullptr),
+    m_cacheSize(0)
+{
+    // the theme directory is first, its modification time changes when the
+    // cache is regenerated
+    m_dirPaths.reserve(keyList.size() + 1);
+    m_dirPaths.append(QFile::encodeName(contentDir));
+    foreach (const QIconDirInfo &dirInfo, keyList) {
+        m_dirPaths.append(QFile::encodeName(contentDir + QLatin1Char('/') + dirInfo.path));
+    }
+    load();
+}
+
+QIconThemeIndex::~QIconThemeIndex()
+{
+    clear();
+}
+
+QIconIndexEntries QIconThemeIndex::lookup(const QString &iconName)
+{
+    if (m_checkTimer.elapsed() >= themeCheckInterval) {
+        if (isStale()) {
+            load();
+        } else {
+            m_checkTimer.restart();
+        }
+    }
+    if (m_cache) {
+        return lookupCache(iconName);
+    }
+    return m_index.value(iconName);
+}
+
+void QIconThemeIndex::load()
+{
+    clear();
+    m_dirTimes.resize(m_dirPaths.size());
+    for (int i = 0; i < m_dirPaths.size(); i++) {
+        m_dirTimes[i] = qModificationTime(m_dirPaths.at(i));
+    }
+    if (!loadCache()) {
+        buildIndex();
+    }
+    m_checkTimer.start();
+}
+
+void QIconThemeIndex::clear()
+{
+    if (m_cache) {
+        ::munmap(m_cache, m_cacheSize);
+        m_cache = nullptr;
+        m_cacheSize = 0;
+    }
+    m_cacheDirs.clear();
+    m_index.clear();
+}
+
+bool QIconThemeIndex::isStale() const
+{
+    for (int i = 0; i < m_dirPaths.size(); i++) {
+        if (qModificationTime(m_dirPaths.at(i)) != m_dirTimes.at(i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool QIconThemeIndex::loadCache()
+{
+    QFile cacheFile(QFile::decodeName(m_dirPaths.at(0)) + QLatin1String("/icon-theme.cache"));
+    if (!cacheFile.open(QFile::ReadOnly)) {
+        return false;
+    }
+
+    // the cache is not used if any of the directories changed after it was written
+    QT_STATBUF statbuf;
+    if (QT_FSTAT(cacheFile.handle(), &statbuf) != 0 || statbuf.st_size < QT_OFF_T(iconCacheHeaderSize)) {
+        return false;
+    }
+    const qint64 cacheTime = qModificationTime(statbuf);
+    foreach (const qint64 dirTime, m_dirTimes) {
+        if (dirTime > cacheTime) {
+            return false;
+        }
+    }
+
+    void* mapped = QT_MMAP(nullptr, statbuf.st_size, PROT_READ, MAP_SHARED, cacheFile.handle(), 0);
+    if (Q_UNLIKELY(mapped == MAP_FAILED)) {
+        return false;
+    }
+    m_cache = static_cast<uchar*>(mapped);
+    m_cacheSize = statbuf.st_size;
+
+    const quint32 hashOffset = qFromBigEndian<quint32>(m_cache + 4);
+    const quint32 dirListOffset = qFromBigEndian<quint32>(m_cache + 8);
+    if (qFromBigEndian<quint16>(m_cache) != iconCacheMajorVersion
+        || hashOffset > m_cacheSize - 4 || dirListOffset > m_cacheSize - 4) {
+        clear();
+        return false;
+    }
+
+    // map the key list directories to the cache directories
+    const quint32 dirCount = qFromBigEndian<quint32>(m_cache + dirListOffset);
+    if (dirCount > (m_cacheSize - dirListOffset - 4) / 4) {
+        clear();
+        return false;
+    }
+    QHash<QByteArray, qint32> cacheDirs;
+    for (quint32 i = 0; i < dirCount; i++) {
+        const char *dirName = nullptr;
+        if (!cacheString(qFromBigEndian<quint32>(m_cache + dirListOffset + 4 + i * 4), &dirName)) {
+            clear();
+            return false;
+        }
+        cacheDirs.insert(QByteArray::fromRawData(dirName, qstrlen(dirName)), i);
+    }
+    const int contentDirLength = m_dirPaths.at(0).size() + 1;
+    m_cacheDirs.resize(m_dirPaths.size() - 1);
+    for (int i = 1; i < m_dirPaths.size(); i++) {
+        m_cacheDirs[i - 1] = cacheDirs.value(m_dirPaths.at(i).mid(contentDirLength), -1);
+    }
+    return true;
+}
+
+void QIconThemeIndex::buildIndex()
+{
+    for (int i = 1; i < m_dirPaths.size(); i++) {
+        QT_DIR *dir = QT_OPENDIR(m_dirPaths.at(i).constData());
+        if (!dir) {
+            continue;
+        }
+        const short keyIndex = i - 1;
+        QT_DIRENT *dirent = QT_READDIR(dir);
+        while (dirent) {
+#ifdef QT_HAVE_DIRENT_D_TYPE
+            if (dirent->d_type == DT_DIR) {
+                dirent = QT_READDIR(dir);
+                continue;
+            }
+#endif
+            const int nameLength = qstrlen(dirent->d_name) - 4;
+            short flag = 0;
+            if (nameLength > 0) {
+                const char *suffix = dirent->d_name + nameLength;
+                if (qstrcmp(suffix, ".png") == 0) {
+                    flag = QIconIndexEntry::HasPng;
+                } else if (qstrcmp(suffix, ".svg") == 0) {
+                    flag = QIconIndexEntry::HasSvg;
+                }
+            }
+            if (flag != 0 && qIsIconFile(m_dirPaths.at(i), dirent)) {
+                QIconIndexEntries &entries = m_index[QFile::decodeName(QByteArray(dirent->d_name, nameLength))];
+                if (!entries.isEmpty() && entries.last().dir == keyIndex) {
+                    entries.last().flags |= flag;
+                } else {
+                    const QIconIndexEntry entry = { keyIndex, flag };
+                    entries.append(entry);
+                }
+            }
+            dirent = QT_READDIR(dir);
+        }
+        QT_CLOSEDIR(dir);
+    }
+}
+
+QIconIndexEntries QIconThemeIndex::lookupCache(const QString &iconName) const
+{
+    QIconIndexEntries entries;
+    const QByteArray name = QFile::encodeName(iconName);
+    const quint32 hashOffset = qFromBigEndian<quint32>(m_cache + 4);
+    const quint32 bucketCount = qFromBigEndian<quint32>(m_cache + hashOffset);
+    if (bucketCount == 0 || bucketCount > (m_cacheSize - hashOffset - 4) / 4) {
+        return entries;
+    }
+
+    // the chain length is limited in case the cache is corrupted
+    quint32 iconOffset = qFromBigEndian<quint32>(m_cache + hashOffset + 4 + (qIconCacheHash(name.constData()) % bucketCount) * 4);
+    bool found = false;
+    for (qint64 chainLimit = m_cacheSize / 12; !found && chainLimit > 0; chainLimit--) {
+        if (iconOffset > m_cacheSize - 12) {
+            return entries;
+        }
+        const char *cachedName = nullptr;
+        if (!cacheString(qFromBigEndian<quint32>(m_cache + iconOffset + 4), &cachedName)) {
+            return entries;
+        }
+        if (qstrcmp(cachedName, name.constData()) == 0) {
+            found = true;
+        } else {
+            iconOffset = qFromBigEndian<quint32>(m_cache + iconOffset);
+        }
+    }
+    if (!found) {
+        return entries;
+    }
+
+    const quint32 imageListOffset = qFromBigEndian<quint32>(m_cache + iconOffset + 8);
+    if (imageListOffset > m_cacheSize - 4) {
+        return entries;
+    }
+    const quint32 imageCount = qFromBigEndian<quint32>(m_cache + imageListOffset);
+    if (imageCount > (m_cacheSize - imageListOffset - 4) / 8) {
+        return entries;
+    }
+    const uchar *images = m_cache + imageListOffset + 4;
+
+    // in the order of the key list, as when the index is built
+    for (int i = 0; i < m_cacheDirs.size(); i++) {
+        const qint32 cacheDir = m_cacheDirs.at(i);
+        if (cacheDir < 0) {
+            continue;
+        }
+        for (quint32 j = 0; j < imageCount; j++) {
+            if (qFromBigEndian<quint16>(images + j * 8) != cacheDir) {
+                continue;
+            }
+            const quint16 cacheFlags = qFromBigEndian<quint16>(images + j * 8 + 2);
+            short flags = 0;
+            if (cacheFlags & iconCachePngFlag) {
+                flags |= QIconIndexEntry::HasPng;
+            }
+            if (cacheFlags & iconCacheSvgFlag) {
+                flags |= QIconIndexEntry::HasSvg;
+            }
+            if (flags != 0) {
+                const QIconIndexEntry entry = { short(i), flags };
+                entries.append(entry);
+            }
+            break;
+        }
+    }
+    return entries;
+}
+
+bool QIconThemeIndex::cacheString(quint32 offset, const char **string) const
+{
+    if (offset >= m_cacheSize
+        || !::memchr(m_cache + offset, '\0', m_cacheSize - offset)) {
+        return false;
+    }
+    *string = reinterpret_cast<const char*>(m_cache + offset);
+    return true;
+}
+
+// Returns the path of the file the image rendered from the scalable icon
+// fileName at size is cached in or empty string if it should not be cached,
+// the same icon and size always map to the same file
+QString QIconLoader::iconCacheFile(const QString &fileName, const QSize &size)
+{
+#ifndef QT_NO_IMAGEFORMAT_KAT
+    if (!fileName.endsWith(QLatin1String(".svg"))) {
+        return QString();
+    }
+
+    if (!m_iconCacheChecked) {
+        m_iconCacheChecked = true;
+        const QString cacheLocation = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        if (!cacheLocation.isEmpty()) {
+            const QString iconCacheDir = cacheLocation + QLatin1String("/katie/icons");
+            if (QDir().mkpath(iconCacheDir)) {
+                m_iconCacheDir = iconCacheDir;
+            }
+        }
+    }
+    if (m_iconCacheDir.isEmpty()) {
+        return QString();
+    }
+
+    QByteArray cacheKey = QFile::encodeName(fileName);
+    cacheKey += '\0';
+    cacheKey += QByteArray::number(size.width());
+    cacheKey += 'x';
+    cacheKey += QByteArray::number(size.height());
+    const XXH64_hash_t cacheHash = XXH3_64bits(cacheKey.constData(), cacheKey.size());
+    return m_iconCacheDir + QLatin1Char('/')
+        + QString::number(quint64(cacheHash), 16) + QLatin1String(".kat");
+#else
+    Q_UNUSED(fileName);
+    Q_UNUSED(size);
+    return QString();
+#endif // QT_NO_IMAGEFORMAT_KAT
+}
+
+#ifndef QT_NO_IMAGEFORMAT_KAT
+// written before the image, the image is rendered again and the file
+// replaced if the icon or the version that rendered it is not the same
+struct QIconCacheStamp
+{
+    quint32 version;
+    qint64 modificationTime;
+    qint64 size;
+};
+
+static bool qt_icon_cache_stamp(const QString &fileName, QIconCacheStamp *stamp)
+{
+    QT_STATBUF statbuf;
+    if (QT_STAT(QFile::encodeName(fileName).constData(), &statbuf) != 0) {
+        return false;
+    }
+    stamp->version = QT_VERSION;
+    stamp->modificationTime = qModificationTime(statbuf);
+    stamp->size = statbuf.st_size;
+    return true;
+}
+
+static QImage qt_read_icon_cache(const QString &cacheFile, const QIconCacheStamp &stamp)
+{
+    QImage image;
+    QFile file(cacheFile);
+    if (!file.open(QFile::ReadOnly)) {
+        return image;
+    }
+
+    QDataStream stream(&file);
+    QIconCacheStamp cachedStamp;
+    stream >> cachedStamp.version;
+    stream >> cachedStamp.modificationTime;
+    stream >> cachedStamp.size;
+    if (stream.status() == QDataStream::Ok
+        && (cachedStamp.version != stamp.version
+            || cachedStamp.modificationTime != stamp.modificationTime
+            || cachedStamp.size != stamp.size)) {
+        // stale, replaced once the icon is rendered again
+        return image;
+    }
+
+    QKatHandler handler;
+    handler.setDevice(&file);
+    if (stream.status() != QDataStream::Ok || !handler.read(&image)) {
+        // corrupted, removed in case the icon can not be rendered
+        file.remove();
+        image = QImage();
+    }
+    return image;
+}
+
+static void qt_write_icon_cache(const QString &cacheFile, const QIconCacheStamp &stamp, const QImage &image)
+{
+    // written to a temporary file first and then renamed so that other
+    // processes never read incomplete files
+    const QString tempFile = cacheFile + QLatin1Char('.')
+        + QString::number(QCoreApplication::applicationPid());
+    QFile file(tempFile);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return;
+    }
+    QDataStream stream(&file);
+    stream << stamp.version;
+    stream << stamp.modificationTime;
+    stream << stamp.size;
+    QKatHandler handler;
+    handler.setDevice(&file);
+    const bool written = (stream.status() == QDataStream::Ok && handler.write(image));
+    file.close();
+    if (!written) {
+        QFile::remove(tempFile);
+        return;
+    }
+    // QFile::rename() does not replace existing files, the stale or
+    // corrupted image is replaced atomically
+    if (::rename(QFile::encodeName(tempFile).constData(), QFile::encodeName(cacheFile).constData()) != 0) {
+        QFile::remove(tempFile);
+    }
+}
+#endif // QT_NO_IMAGEFORMAT_KAT
+
 QIconTheme::QIconTheme()
     : m_valid(false),
     m_supportsSvg(false)
@@ -163,6 +599,8 @@ QIconTheme::QIconTheme(const QString &themeName, const bool supportsSvg)
         if (!m_parents.contains(fallbackTheme)) {
             m_parents.append(fallbackTheme);
         }
+
+        m_index = new QIconThemeIndex(m_contentDir, m_keyList);
     }
 }
 
@@ -186,28 +624,24 @@ QThemeIconEntries QIconLoader::findIconHelper(const QString &themeName,
     }
 
     const QString contentDir = theme.contentDir() + QLatin1Char('/');
+    const QList<QIconDirInfo> keyList = theme.keyList();
 
-    // Add all relevant files
-    foreach (const QIconDirInfo &dirInfo, theme.keyList()) {
+    // Add all relevant files, the index lists only the directories that have the icon
+    foreach (const QIconIndexEntry &indexEntry, theme.lookup(iconName)) {
+        const QIconDirInfo &dirInfo = keyList.at(indexEntry.dir);
         const QString subDir = contentDir + dirInfo.path + QLatin1Char('/');
-        const QString pngPath = subDir + iconName + QLatin1String(".png");
-        const QStatInfo pnginfo(pngPath);
-        if (pnginfo.isFile()) {
+        if (indexEntry.flags & QIconIndexEntry::HasPng) {
             QIconLoaderEngineEntry *iconEntry = new QIconLoaderEngineEntry();
             iconEntry->dir = dirInfo;
-            iconEntry->filename = pngPath;
+            iconEntry->filename = subDir + iconName + QLatin1String(".png");
             // Notice we ensure that pixmap entries always come before
             // scalable to preserve search order afterwards
             entries.prepend(iconEntry);
-        } else if (m_supportsSvg) {
-            const QString svgPath = subDir + iconName + QLatin1String(".svg");
-            const QStatInfo svginfo(svgPath);
-            if (svginfo.isFile()) {
-                QIconLoaderEngineEntry *iconEntry = new QIconLoaderEngineEntry();
-                iconEntry->dir = dirInfo;
-                iconEntry->filename = svgPath;
-                entries.append(iconEntry);
-            }
+        } else if (m_supportsSvg && (indexEntry.flags & QIconIndexEntry::HasSvg)) {
+            QIconLoaderEngineEntry *iconEntry = new QIconLoaderEngineEntry();
+            iconEntry->dir = dirInfo;
+            iconEntry->filename = subDir + iconName + QLatin1String(".svg");
+            entries.append(iconEntry);
         }
     }
 
@@ -421,11 +855,31 @@ QPixmap QIconLoaderEngineEntry::pixmap(const QSize &size, QIcon::Mode mode, QIco
     // Ensure that the base pixmap is lazily initialized before generating the
     // key, otherwise the cache key is not unique
     if (m_basePixmap.isNull()) {
-        QImageReader baseReader(filename);
         QSize baseSize(size);
         baseSize.scale(size, Qt::KeepAspectRatio);
-        baseReader.setScaledSize(baseSize);
-        m_basePixmap = QPixmap::fromImage(baseReader.read());
+        // rendering scalable icons is expensive, the result is cached on
+        // disk and shared between processes
+        QString cacheFile = iconLoaderInstance()->iconCacheFile(filename, baseSize);
+#ifndef QT_NO_IMAGEFORMAT_KAT
+        QIconCacheStamp cacheStamp;
+        if (!cacheFile.isEmpty() && !qt_icon_cache_stamp(filename, &cacheStamp)) {
+            cacheFile.clear();
+        }
+        if (!cacheFile.isEmpty()) {
+            m_basePixmap = QPixmap::fromImage(qt_read_icon_cache(cacheFile, cacheStamp));
+        }
+#endif
+        if (m_basePixmap.isNull()) {
+            QImageReader baseReader(filename);
+            baseReader.setScaledSize(baseSize);
+            const QImage baseImage = baseReader.read();
+#ifndef QT_NO_IMAGEFORMAT_KAT
+            if (!cacheFile.isEmpty() && !baseImage.isNull()) {
+                qt_write_icon_cache(cacheFile, cacheStamp, baseImage);
+            }
+#endif
+            m_basePixmap = QPixmap::fromImage(baseImage);
+        }
     }
 
     int actualSize = qMin(size.width(), size.height());
@@ -35,6 +35,9 @@
 //
 
 #include <QtCore/QHash>
+#include <QtCore/QVector>
+#include <QtCore/QSharedData>
+#include <QtCore/QElapsedTimer>
 #include <QtGui/QIcon>
 #include <QtGui/QIconEngine>
 #include <QtGui/QPixmapCache>
@@ -107,6 +110,51 @@ private:
     uint m_key;
 };
 
+struct QIconIndexEntry
+{
+    enum Flag {
+        HasPng = 0x1,
+        HasSvg = 0x2
+    };
+
+    short dir; // index in the theme key list
+    short flags;
+};
+Q_DECLARE_TYPEINFO(QIconIndexEntry, Q_PRIMITIVE_TYPE);
+
+typedef QVector<QIconIndexEntry> QIconIndexEntries;
+
+// Maps icon names to the theme directories that have them, read from the
+// icon-theme.cache of the theme if it is up to date or built from the
+// directory listings otherwise
+class QIconThemeIndex : public QSharedData
+{
+public:
+    QIconThemeIndex(const QString &contentDir, const QList<QIconDirInfo> &keyList);
+    ~QIconThemeIndex();
+
+    QIconIndexEntries lookup(const QString &iconName);
+
+private:
+    Q_DISABLE_COPY(QIconThemeIndex);
+
+    void load();
+    void clear();
+    bool isStale() const;
+    bool loadCache();
+    void buildIndex();
+    QIconIndexEntries lookupCache(const QString &iconName) const;
+    bool cacheString(quint32 offset, const char **string) const;
+
+    QList<QByteArray> m_dirPaths;
+    QVector<qint64> m_dirTimes;
+    QElapsedTimer m_checkTimer;
+    uchar *m_cache;
+    qint64 m_cacheSize;
+    QVector<qint32> m_cacheDirs;
+    QHash<QString, QIconIndexEntries> m_index;
+};
+
 class QIconTheme
 {
 public:
@@ -116,11 +164,14 @@ public:
     QList <QIconDirInfo> keyList() { return m_keyList; }
     QString contentDir() { return m_contentDir; }
     bool isValid() { return m_valid; }
+    QIconIndexEntries lookup(const QString &iconName) const
+        { return m_index ? m_index->lookup(iconName) : QIconIndexEntries(); }
 
 private:
     QString m_contentDir;
     QList <QIconDirInfo> m_keyList;
     QStringList m_parents;
+    QExplicitlySharedDataPointer<QIconThemeIndex> m_index;
     bool m_valid;
     bool m_supportsSvg;
 };
@@ -140,6 +191,7 @@ public:
     static QIconLoader *instance();
     void updateSystemTheme();
     void invalidateKey() { m_themeKey++; }
+    QString iconCacheFile(const QString &fileName, const QSize &size);
 
 private:
     QThemeIconEntries findIconHelper(const QString &themeName,
@@ -152,6 +204,8 @@ private:
     QString m_systemTheme;
     mutable QStringList m_iconDirs;
     QHash <QString, QIconTheme> m_themeList;
+    QString m_iconCacheDir;
+    bool m_iconCacheChecked;
 };
 
 QT_END_NAMESPACE
@@ -33,6 +33,9 @@ class QEventDispatcherX11Private : public QEventDispatcherUNIXPrivate
 {
     Q_DECLARE_PUBLIC(QEventDispatcherX11)
 public:
+    // select() is reimplemented to wait for the X11 connection too
+    QEventDispatcherX11Private() : QEventDispatcherUNIXPrivate(false) { }
+
     QList<XEvent> queuedUserInputEvents;
 };
 
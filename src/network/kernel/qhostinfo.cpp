@@ -24,12 +24,62 @@
 #include "qcoreapplication.h"
 #include "qmetaobject.h"
 #include "qstringlist.h"
+#include "qatomic.h"
+#include "qthread.h"
 
 QT_BEGIN_NAMESPACE
 
 // #define QHOSTINFO_DEBUG
 
 Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
+Q_GLOBAL_STATIC(QHostInfoLookupManager, globalLookupManager)
+
+static QAtomicInt qt_lookup_id_counter = QAtomicInt(0);
+
+// lookups which are still resolving when the application exits are not
+// waited for longer than this, in milliseconds
+static const int QHostInfoExitTimeout = 1000;
+
+// the runnables of such lookups may outlive the manager and the cache, they
+// only use them while holding a reference and not at all once either of them
+// is destroyed
+static QAtomicInt qt_hostinfo_refs = QAtomicInt(0);
+static QAtomicInt qt_hostinfo_deleted = QAtomicInt(0);
+
+class QHostInfoLookupRef
+{
+public:
+    QHostInfoLookupRef()
+        : manager(nullptr),
+        cache(nullptr)
+    {
+        qt_hostinfo_refs.ref();
+        if (qt_hostinfo_deleted.load() == 0) {
+            manager = globalLookupManager();
+            cache = globalHostInfoCache();
+        }
+    }
+
+    ~QHostInfoLookupRef()
+    {
+        qt_hostinfo_refs.deref();
+    }
+
+    QHostInfoLookupManager *manager;
+    QHostInfoCache *cache;
+
+private:
+    Q_DISABLE_COPY(QHostInfoLookupRef)
+};
+
+// refuses new references and waits for the ones held by runnables
+static void qt_hostinfo_release()
+{
+    qt_hostinfo_deleted.store(1);
+    while (qt_hostinfo_refs.load() != 0) {
+        QThread::yieldCurrentThread();
+    }
+}
 
 /*!
     \class QHostInfo
@@ -42,17 +92,37 @@ Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
     QHostInfo uses the lookup mechanisms provided by the operating
     system to find the IP address(es) associated with a host name,
     or the host name associated with an IP address. The class
-    provides static method that blocks and returns a QHostInfo object.
+    provides two static convenience functions: one that works
+    asynchronously and emits a signal once the host is found, and
+    one that blocks and returns a QHostInfo object.
+
+    To look up a host's IP addresses asynchronously, call lookupHost(),
+    which takes the host name or IP address, a receiver object, and a slot
+    signature as arguments and returns an ID. You can abort the
+    lookup by calling abortHostLookup() with the lookup ID.
 
-    Call addresses() to get the list of IP addresses for the host, and
-    hostName() to get the host name that was looked up.
+    Example:
+
+    \code
+    // To find the IP address of qt.nokia.com
+    QHostInfo::lookupHost("qt.nokia.com",
+                          this, SLOT(printResults(QHostInfo)));
+
+    // To find the host name for 4.2.2.1
+    QHostInfo::lookupHost("4.2.2.1",
+                          this, SLOT(printResults(QHostInfo)));
+    \endcode
+
+    The slot is invoked when the results are ready. The results are
+    stored in a QHostInfo object. Call addresses() to get the list of
+    IP addresses for the host, and hostName() to get the host name
+    that was looked up.
 
     If the lookup failed, error() returns the type of error that
     occurred. errorString() gives a human-readable description of the
     lookup error.
 
-    If you want a non-blocking lookup, use the QHostInfo::fromName()
-    in a thread.
+    If you want a blocking lookup, use the QHostInfo::fromName() function.
 
     QHostInfo supports Internationalized Domain Names (IDNs) through the
     IDNA and Punycode standards.
@@ -60,13 +130,118 @@ Q_GLOBAL_STATIC(QHostInfoCache, globalHostInfoCache)
     To retrieve the name of the local host, use the static
     QHostInfo::localHostName() method.
 
-    \note Since 4.6.3 QHostInfo is using a small internal 60 second DNS cache
-    for performance improvements.
-    \note Since 4.9.0 QHostInfo is not using multiple threads for DNS lookup.
+    \note Since 4.6.3 QHostInfo is using a small internal DNS cache for
+    performance improvements. Its size and lifetime of the entries can be
+    changed with setCacheCapacity(), setCacheTimeout() and
+    setNegativeCacheTimeout().
+    \note Asynchronous lookups are done by a dedicated pool of up to 20
+    threads. Concurrent lookups of the same name result in a single
+    query to the resolver, all receivers get the same results.
 
     \sa QAbstractSocket, {http://www.rfc-editor.org/rfc/rfc3492.txt}{RFC 3492}
 */
 
+/*!
+    Looks up the IP address(es) associated with host name \a name, and
+    returns an ID for the lookup. When the result of the lookup is
+    ready, the slot or signal \a member in \a receiver is called with
+    a QHostInfo argument. The QHostInfo object can then be inspected
+    to get the results of the lookup.
+
+    The lookup is performed by a single function call, for example:
+
+    \code
+    QHostInfo::lookupHost("www.kde.org",
+                          this, SLOT(lookedUp(QHostInfo)));
+    \endcode
+
+    The implementation of the slot prints basic information about the
+    addresses returned by the lookup, or reports an error if it failed:
+
+    \code
+    void MyWidget::lookedUp(const QHostInfo &host)
+    {
+        if (host.error() != QHostInfo::NoError) {
+            qDebug() << "Lookup failed:" << host.errorString();
+            return;
+        }
+
+        foreach (const QHostAddress &address, host.addresses())
+            qDebug() << "Found address:" << address.toString();
+    }
+    \endcode
+
+    If you pass a literal IP address to \a name instead of a host name,
+    QHostInfo will search for the domain name for the IP (i.e., QHostInfo will
+    perform a \e reverse lookup). On success, the resulting QHostInfo will
+    contain both the resolved domain name and IP addresses for the host
+    name.
+
+    The slot is never invoked from within lookupHost(), even when the
+    result is already cached, but from the event loop of the thread that
+    called it.
+
+    \since 4.14
+
+    \sa abortHostLookup(), addresses(), error(), fromName()
+*/
+int QHostInfo::lookupHost(const QString &name, QObject *receiver, const char *member)
+{
+#if defined QHOSTINFO_DEBUG
+    qDebug("QHostInfo::lookupHost(\"%s\", %p, %s)",
+           name.toLatin1().constData(), receiver, member ? member + 1 : 0);
+#endif
+
+    if (Q_UNLIKELY(!receiver || !member)) {
+        qWarning("QHostInfo::lookupHost: both receiver and member must be set");
+        return -1;
+    }
+
+    qRegisterMetaType<QHostInfo>("QHostInfo");
+
+    QHostInfoLookupManager* manager = globalLookupManager();
+    const int id = qt_lookup_id_counter.fetchAndAddRelaxed(1) + 1;
+    QHostInfoResult *result = new QHostInfoResult(id);
+    QObject::connect(result, SIGNAL(resultsReady(QHostInfo)), receiver, member);
+
+    if (name.isEmpty()) {
+        QHostInfo info;
+        info.d->err = QHostInfo::HostNotFound;
+        info.d->errorStr = QCoreApplication::translate("QHostInfo", "No host name given");
+        manager->postResults(result, info);
+        return id;
+    }
+
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache && cache->isEnabled()) {
+        bool valid = false;
+        const QHostInfo info = cache->get(name, &valid);
+        if (valid) {
+            manager->postResults(result, info);
+            return id;
+        }
+    }
+
+    manager->startLookup(name, result);
+    return id;
+}
+
+/*!
+    Aborts the host lookup with the ID \a id, as returned by lookupHost().
+
+    The slot passed to lookupHost() is not invoked for an aborted
+    lookup, even if the results are already on their way. The query to
+    the resolver itself is not interrupted, its result is still cached.
+
+    \since 4.14
+
+    \sa lookupHost(), lookupId()
+*/
+void QHostInfo::abortHostLookup(int id)
+{
+    globalLookupManager()->abortLookup(id);
+}
+
 /*!
     Looks up the IP address(es) for the given host \a name. The
     method blocks during the lookup which means that execution of
@@ -116,13 +291,14 @@ QHostInfo QHostInfo::fromName(const QString &name)
 */
 
 /*!
-    Constructs an empty host info object.
+    Constructs an empty host info object with lookup ID \a id.
 
     \sa lookupId()
 */
-QHostInfo::QHostInfo()
+QHostInfo::QHostInfo(int id)
     : d(new QHostInfoPrivate())
 {
+    d->lookupId = id;
 }
 
 /*!
@@ -135,6 +311,7 @@ QHostInfo::QHostInfo(const QHostInfo &other)
     d->errorStr = other.d->errorStr;
     d->addrs = other.d->addrs;
     d->hostName = other.d->hostName;
+    d->lookupId = other.d->lookupId;
 }
 
 /*!
@@ -147,6 +324,7 @@ QHostInfo &QHostInfo::operator=(const QHostInfo &other)
     d->errorStr = other.d->errorStr;
     d->addrs = other.d->addrs;
     d->hostName = other.d->hostName;
+    d->lookupId = other.d->lookupId;
     return *this;
 }
 
@@ -205,6 +383,165 @@ QString QHostInfo::errorString() const
     return d->errorStr;
 }
 
+/*!
+    Returns the ID of this lookup.
+
+    \since 4.14
+
+    \sa setLookupId(), abortHostLookup(), hostName()
+*/
+int QHostInfo::lookupId() const
+{
+    return d->lookupId;
+}
+
+/*!
+    Sets the ID of this lookup to \a id.
+
+    \since 4.14
+
+    \sa lookupId(), lookupHost()
+*/
+void QHostInfo::setLookupId(int id)
+{
+    d->lookupId = id;
+}
+
+/*!
+    Returns the maximum number of host names kept in the lookup cache.
+    The default is 128.
+
+    \since 4.14
+
+    \sa setCacheCapacity(), cacheTimeout()
+*/
+int QHostInfo::cacheCapacity()
+{
+    QHostInfoCache* cache = globalHostInfoCache();
+    return (cache ? cache->capacity() : 0);
+}
+
+/*!
+    Sets the maximum number of host names kept in the lookup cache to
+    \a capacity. The least recently used names are dropped first.
+    Setting it to zero disables the cache.
+
+    \since 4.14
+
+    \sa cacheCapacity(), setCacheTimeout()
+*/
+void QHostInfo::setCacheCapacity(int capacity)
+{
+    if (Q_UNLIKELY(capacity < 0)) {
+        qWarning("QHostInfo::setCacheCapacity: capacity is less than zero");
+        return;
+    }
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache) {
+        cache->setCapacity(capacity);
+    }
+}
+
+/*!
+    Returns the number of seconds for which the results of successful
+    lookups are cached. The default is 60 seconds.
+
+    \since 4.14
+
+    \sa setCacheTimeout(), negativeCacheTimeout()
+*/
+int QHostInfo::cacheTimeout()
+{
+    QHostInfoCache* cache = globalHostInfoCache();
+    return (cache ? cache->timeoutFor(QHostInfo::NoError) : 0);
+}
+
+/*!
+    Sets the number of seconds for which the results of successful
+    lookups are cached to \a seconds.
+
+    Cached names that are still looked up during the last quarter of
+    that time are resolved again in the background, so that frequently
+    used names do not expire.
+
+    \since 4.14
+
+    \sa cacheTimeout(), setNegativeCacheTimeout()
+*/
+void QHostInfo::setCacheTimeout(int seconds)
+{
+    if (Q_UNLIKELY(seconds < 0)) {
+        qWarning("QHostInfo::setCacheTimeout: timeout is less than zero");
+        return;
+    }
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache) {
+        cache->setTimeoutFor(QHostInfo::NoError, seconds);
+    }
+}
+
+/*!
+    Returns the number of seconds for which host names that do not
+    exist are cached. The default is 10 seconds.
+
+    \since 4.14
+
+    \sa setNegativeCacheTimeout(), cacheTimeout()
+*/
+int QHostInfo::negativeCacheTimeout()
+{
+    QHostInfoCache* cache = globalHostInfoCache();
+    return (cache ? cache->timeoutFor(QHostInfo::HostNotFound) : 0);
+}
+
+/*!
+    Sets the number of seconds for which host names that do not exist
+    are cached to \a seconds. Setting it to zero disables caching of
+    such names. Lookups that failed for other reasons are never cached.
+
+    \since 4.14
+
+    \sa negativeCacheTimeout(), setCacheTimeout()
+*/
+void QHostInfo::setNegativeCacheTimeout(int seconds)
+{
+    if (Q_UNLIKELY(seconds < 0)) {
+        qWarning("QHostInfo::setNegativeCacheTimeout: timeout is less than zero");
+        return;
+    }
+    QHostInfoCache* cache = globalHostInfoCache();
+    if (cache) {
+        cache->setTimeoutFor(QHostInfo::HostNotFound, seconds);
+    }
+}
+
+/*!
+    Returns the number of lookups answered from the cache.
+
+    \since 4.14
+
+    \sa cacheMisses()
+*/
+qint64 QHostInfo::cacheHits()
+{
+    QHostInfoCache* cache = globalHostInfoCache();
+    return (cache ? cache->hitCount() : 0);
+}
+
+/*!
+    Returns the number of lookups that were not found in the cache or
+    whose cached results had expired.
+
+    \since 4.14
+
+    \sa cacheHits()
+*/
+qint64 QHostInfo::cacheMisses()
+{
+    QHostInfoCache* cache = globalHostInfoCache();
+    return (cache ? cache->missCount() : 0);
+}
+
 /*!
     \fn QString QHostInfo::localHostName()
 
@@ -224,6 +561,146 @@ QString QHostInfo::errorString() const
     \sa hostName()
 */
 
+void QHostInfoResult::postResults(const QHostInfo &info)
+{
+    QMetaObject::invokeMethod(this, "deliverResults", Qt::QueuedConnection,
+                              Q_ARG(QHostInfo, info));
+}
+
+void QHostInfoResult::deliverResults(const QHostInfo &info)
+{
+    if (!globalLookupManager()->takeResult(lookupId)) {
+        // aborted, deletion is pending
+        return;
+    }
+    QHostInfo result(info);
+    result.setLookupId(lookupId);
+    emit resultsReady(result);
+    deleteLater();
+}
+
+void QHostInfoRunnable::run()
+{
+    {
+        QHostInfoLookupRef ref;
+        if (!ref.manager || !ref.manager->isPending(hostName)) {
+            // cancelled while queued
+            return;
+        }
+    }
+
+    const QHostInfo info = QHostInfoPrivate::fromName(hostName);
+
+    QHostInfoLookupRef ref;
+    if (!ref.manager) {
+        return;
+    }
+    if (ref.cache->isEnabled()) {
+        ref.cache->put(hostName, info);
+    }
+    ref.manager->finishLookup(hostName, info);
+}
+
+QHostInfoLookupManager::QHostInfoLookupManager()
+    : threadPool(new QThreadPool())
+{
+    // do up to 20 DNS lookups in parallel
+    threadPool->setMaxThreadCount(20);
+}
+
+QHostInfoLookupManager::~QHostInfoLookupManager()
+{
+    // nobody is left to receive the results, queued lookups are cancelled
+    QMutexLocker locker(&mutex);
+    activeResults.clear();
+    pendingLookups.clear();
+    locker.unlock();
+
+    // the resolver can not be interrupted and may take long to time out
+    if (threadPool->waitForDone(QHostInfoExitTimeout)) {
+        delete threadPool;
+        return;
+    }
+
+    // the runnables still resolving finish on their own without the manager
+    qt_hostinfo_release();
+}
+
+void QHostInfoLookupManager::postResults(QHostInfoResult *result, const QHostInfo &info)
+{
+    QMutexLocker locker(&mutex);
+    activeResults.insert(result->lookupId, result);
+    result->postResults(info);
+}
+
+void QHostInfoLookupManager::startLookup(const QString &name, QHostInfoResult *result)
+{
+    QMutexLocker locker(&mutex);
+    activeResults.insert(result->lookupId, result);
+    QHash<QString, QList<QHostInfoResult*> >::iterator it = pendingLookups.find(name);
+    if (it != pendingLookups.end()) {
+        // same name is being looked up already, wait for its results
+        it.value().append(result);
+        return;
+    }
+    pendingLookups.insert(name, QList<QHostInfoResult*>() << result);
+    locker.unlock();
+
+    threadPool->start(new QHostInfoRunnable(name));
+}
+
+void QHostInfoLookupManager::refreshLookup(const QString &name)
+{
+    QMutexLocker locker(&mutex);
+    if (pendingLookups.contains(name)) {
+        return;
+    }
+    // nobody is waiting for the results, the runnable only updates the cache
+    pendingLookups.insert(name, QList<QHostInfoResult*>());
+    locker.unlock();
+
+    threadPool->start(new QHostInfoRunnable(name));
+}
+
+void QHostInfoLookupManager::finishLookup(const QString &name, const QHostInfo &info)
+{
+    // results are posted while locked so that they are not deleted meanwhile
+    QMutexLocker locker(&mutex);
+    foreach (QHostInfoResult *result, pendingLookups.take(name)) {
+        result->postResults(info);
+    }
+}
+
+void QHostInfoLookupManager::abortLookup(int id)
+{
+    QMutexLocker locker(&mutex);
+    QHostInfoResult *result = activeResults.take(id);
+    if (!result) {
+        return;
+    }
+    QHash<QString, QList<QHostInfoResult*> >::iterator it = pendingLookups.begin();
+    while (it != pendingLookups.end()) {
+        // the entry is kept even if empty, the lookup is still running
+        if (it.value().removeOne(result)) {
+            break;
+        }
+        it++;
+    }
+    result->deleteLater();
+}
+
+bool QHostInfoLookupManager::takeResult(int id)
+{
+    QMutexLocker locker(&mutex);
+    return (activeResults.remove(id) != 0);
+}
+
+bool QHostInfoLookupManager::isPending(const QString &name)
+{
+    QMutexLocker locker(&mutex);
+    return pendingLookups.contains(name);
+}
+
 void qt_qhostinfo_clear_cache()
 {
     QHostInfoCache* cache = globalHostInfoCache();
@@ -240,15 +717,27 @@ void Q_AUTOTEST_EXPORT qt_qhostinfo_enable_cache(bool e)
     }
 }
 
-// cache for 60 seconds
-// cache 128 items
-QHostInfoCache::QHostInfoCache() : max_age(60), enabled(true), cache(128)
+// cache 128 items, successful lookups for 60 seconds and names which do
+// not exist for 10 seconds
+QHostInfoCache::QHostInfoCache()
+    : enabled(true),
+    timeout(60),
+    negativeTimeout(10),
+    hits(0),
+    misses(0),
+    cache(128)
 {
 #ifdef QT_QHOSTINFO_CACHE_DISABLED_BY_DEFAULT
     enabled = false;
 #endif
 }
 
+QHostInfoCache::~QHostInfoCache()
+{
+    // runnables still resolving must not put their results into it
+    qt_hostinfo_release();
+}
+
 bool QHostInfoCache::isEnabled() const
 {
     return enabled;
@@ -261,30 +750,62 @@ void QHostInfoCache::setEnabled(bool e)
     enabled = e;
 }
 
-
-QHostInfo QHostInfoCache::get(const QString &name, bool *valid) const
+QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
 {
     *valid = false;
+
+    QMutexLocker locker(&this->mutex);
     QHostInfoCacheElement *element = cache.object(name);
-    if (element && element->age.elapsed() < max_age*1000) {
-        *valid = true;
-        return element->info;
+    if (!element) {
+        misses++;
+        return QHostInfo();
+    }
+
+    const bool found = (element->info.error() == QHostInfo::NoError);
+    const qint64 ttl = qint64(found ? timeout : negativeTimeout) * 1000;
+    const qint64 age = element->age.elapsed();
+    if (age >= ttl) {
+        cache.remove(name);
+        misses++;
+        return QHostInfo();
     }
 
-    return QHostInfo();
+    hits++;
+    *valid = true;
+    const QHostInfo info = element->info;
+    // entries still in use during the last quarter of their lifetime are
+    // looked up again in the background so that they never expire
+    bool refresh = false;
+    if (found && !element->refreshing && age >= (ttl - ttl / 4)) {
+        element->refreshing = true;
+        refresh = true;
+    }
+    locker.unlock();
+
+    if (refresh) {
+        globalLookupManager()->refreshLookup(name);
+    }
+    return info;
 }
 
 void QHostInfoCache::put(const QString &name, const QHostInfo &info)
 {
-    // if the lookup failed, don't cache
-    if (info.error() != QHostInfo::NoError)
+    QMutexLocker locker(&this->mutex);
+    // only authoritative answers are cached, not transient failures
+    if (info.error() == QHostInfo::UnknownError
+        || (info.error() == QHostInfo::HostNotFound && negativeTimeout <= 0)) {
+        QHostInfoCacheElement *element = cache.object(name);
+        if (element) {
+            // allow another refresh attempt
+            element->refreshing = false;
+        }
         return;
+    }
 
     QHostInfoCacheElement* element = new QHostInfoCacheElement();
     element->info = info;
-    element->age.restart();
-
-    QMutexLocker locker(&this->mutex);
+    element->age.start();
+    element->refreshing = false;
     cache.insert(name, element); // cache will take ownership
 }
 
@@ -294,4 +815,46 @@ void QHostInfoCache::clear()
     cache.clear();
 }
 
+int QHostInfoCache::capacity()
+{
+    QMutexLocker locker(&this->mutex);
+    return cache.maxCost();
+}
+
+void QHostInfoCache::setCapacity(int c)
+{
+    QMutexLocker locker(&this->mutex);
+    cache.setMaxCost(c);
+}
+
+int QHostInfoCache::timeoutFor(QHostInfo::HostInfoError error)
+{
+    QMutexLocker locker(&this->mutex);
+    return (error == QHostInfo::NoError ? timeout : negativeTimeout);
+}
+
+void QHostInfoCache::setTimeoutFor(QHostInfo::HostInfoError error, int seconds)
+{
+    QMutexLocker locker(&this->mutex);
+    if (error == QHostInfo::NoError) {
+        timeout = seconds;
+    } else {
+        negativeTimeout = seconds;
+    }
+}
+
+qint64 QHostInfoCache::hitCount()
+{
+    QMutexLocker locker(&this->mutex);
+    return hits;
+}
+
+qint64 QHostInfoCache::missCount()
+{
+    QMutexLocker locker(&this->mutex);
+    return misses;
+}
+
 QT_END_NAMESPACE
+
+#include "moc_qhostinfo_p.h"
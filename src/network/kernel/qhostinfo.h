@@ -29,6 +29,7 @@
 QT_BEGIN_NAMESPACE
 
 
+class QObject;
 class QHostInfoPrivate;
 
 class Q_NETWORK_EXPORT QHostInfo
@@ -40,7 +41,7 @@ public:
         UnknownError
     };
 
-    QHostInfo();
+    explicit QHostInfo(int lookupId = -1);
     QHostInfo(const QHostInfo &d);
     QHostInfo &operator=(const QHostInfo &d);
     ~QHostInfo();
@@ -52,7 +53,22 @@ public:
 
     QString errorString() const;
 
+    int lookupId() const;
+    void setLookupId(int id);
+
+    static int lookupHost(const QString &name, QObject *receiver, const char *member);
+    static void abortHostLookup(int lookupId);
+
     static QHostInfo fromName(const QString &name);
+
+    static int cacheCapacity();
+    static void setCacheCapacity(int capacity);
+    static int cacheTimeout();
+    static void setCacheTimeout(int seconds);
+    static int negativeCacheTimeout();
+    static void setNegativeCacheTimeout(int seconds);
+    static qint64 cacheHits();
+    static qint64 cacheMisses();
     static QString localHostName();
     static QString localDomainName();
 
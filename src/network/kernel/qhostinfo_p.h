@@ -40,6 +40,9 @@
 #include "QtCore/qobject.h"
 #include "QtCore/qpointer.h"
 #include "QtCore/qlist.h"
+#include "QtCore/qhash.h"
+#include "QtCore/qrunnable.h"
+#include "QtCore/qthreadpool.h"
 #include <QElapsedTimer>
 #include <QCache>
 
@@ -50,7 +53,8 @@ class QHostInfoPrivate
 public:
     inline QHostInfoPrivate()
         : err(QHostInfo::HostNotFound),
-          errorStr(QLatin1String(QT_TRANSLATE_NOOP("QHostInfo", "Host not found")))
+          errorStr(QLatin1String(QT_TRANSLATE_NOOP("QHostInfo", "Host not found"))),
+          lookupId(-1)
     {
     }
 
@@ -60,6 +64,61 @@ public:
     QString errorStr;
     QList<QHostAddress> addrs;
     QString hostName;
+    int lookupId;
+};
+
+// lives in the thread that started the lookup, the results are posted to
+// it so that an abort which races with the resolver is still honoured
+class QHostInfoResult : public QObject
+{
+    Q_OBJECT
+public:
+    QHostInfoResult(int id) : lookupId(id) { }
+
+    void postResults(const QHostInfo &info);
+
+    const int lookupId;
+
+Q_SIGNALS:
+    void resultsReady(const QHostInfo &info);
+
+private Q_SLOTS:
+    void deliverResults(const QHostInfo &info);
+};
+
+class QHostInfoRunnable : public QRunnable
+{
+public:
+    QHostInfoRunnable(const QString &name) : hostName(name) { }
+
+    void run();
+
+private:
+    const QString hostName;
+};
+
+// runs the blocking lookups in a dedicated thread pool, concurrent lookups
+// of the same name share a single resolver call
+class QHostInfoLookupManager
+{
+public:
+    QHostInfoLookupManager();
+    ~QHostInfoLookupManager();
+
+    void postResults(QHostInfoResult *result, const QHostInfo &info);
+    void startLookup(const QString &name, QHostInfoResult *result);
+    void refreshLookup(const QString &name);
+    void finishLookup(const QString &name, const QHostInfo &info);
+    void abortLookup(int id);
+    bool takeResult(int id);
+    bool isPending(const QString &name);
+
+private:
+    // leaked if lookups are still running on destruction
+    QThreadPool *threadPool;
+    QMutex mutex;
+    QHash<int, QHostInfoResult*> activeResults;
+    QHash<QString, QList<QHostInfoResult*> > pendingLookups;
 };
 
 // These functions are outside of the QHostInfo class and strictly internal.
@@ -71,19 +130,32 @@ class QHostInfoCache
 {
 public:
     QHostInfoCache();
-    const int max_age; // seconds
+    ~QHostInfoCache();
 
-    QHostInfo get(const QString &name, bool *valid) const;
+    QHostInfo get(const QString &name, bool *valid);
     void put(const QString &name, const QHostInfo &info);
     void clear();
 
     bool isEnabled() const;
     void setEnabled(bool e);
+
+    int capacity();
+    void setCapacity(int c);
+    int timeoutFor(QHostInfo::HostInfoError error);
+    void setTimeoutFor(QHostInfo::HostInfoError error, int seconds);
+    qint64 hitCount();
+    qint64 missCount();
+
 private:
     bool enabled;
+    int timeout; // seconds
+    int negativeTimeout; // seconds
+    qint64 hits;
+    qint64 misses;
     struct QHostInfoCacheElement {
         QHostInfo info;
         QElapsedTimer age;
+        bool refreshing;
     };
     QCache<QString,QHostInfoCacheElement> cache;
     QMutex mutex;
@@ -344,6 +344,7 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
       abortCalled(false),
       closeCalled(false),
       pendingClose(false),
+      hostLookupId(-1),
       port(0),
       localPort(0),
       peerPort(0),
@@ -652,6 +653,11 @@ void QAbstractSocketPrivate::_q_startConnecting(const QHostInfo &hostInfo)
     if (state != QAbstractSocket::HostLookupState) {
         return;
     }
+    if (hostLookupId != -1 && hostInfo.lookupId() != hostLookupId) {
+        // result of a lookup from previous connection attempt
+        return;
+    }
+    hostLookupId = -1;
 
     addresses = hostInfo.addresses();
 
@@ -1057,6 +1063,7 @@ void QAbstractSocket::connectToHost(const QString &hostName, quint16 port,
     }
 
     d->hostName = hostName;
+    d->hostLookupId = -1;
     d->port = port;
     d->state = UnconnectedState;
     d->readBuffer.clear();
@@ -1088,7 +1095,9 @@ void QAbstractSocket::connectToHost(const QString &hostName, quint16 port,
         d->_q_startConnecting(info);
     } else {
         if (d->threadData->eventDispatcher) {
-            d->_q_startConnecting(QHostInfo::fromName(hostName));
+            // either calls _q_startConnecting() once the lookup is done or
+            // waitForConnected() does a blocking lookup
+            d->hostLookupId = QHostInfo::lookupHost(hostName, this, SLOT(_q_startConnecting(QHostInfo)));
         }
     }
 
@@ -1396,6 +1405,8 @@ bool QAbstractSocket::waitForConnected(int msecs)
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug("QAbstractSocket::waitForConnected(%i) doing host name lookup", msecs);
 #endif
+        QHostInfo::abortHostLookup(d->hostLookupId);
+        d->hostLookupId = -1;
         d->_q_startConnecting(QHostInfo::fromName(d->hostName));
     }
     if (state() == UnconnectedState)
@@ -2047,6 +2058,10 @@ void QAbstractSocket::disconnectFromHost()
         return;
     }
 
+    if (d->state == HostLookupState) {
+        QHostInfo::abortHostLookup(d->hostLookupId);
+        d->hostLookupId = -1;
+    }
 
     // Disable and delete read notification
     if (d->socketEngine)
@@ -79,6 +79,7 @@ public:
     bool pendingClose;
 
     QString hostName;
+    int hostLookupId;
     quint16 port;
     QHostAddress host;
     QList<QHostAddress> addresses;
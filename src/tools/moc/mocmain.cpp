@@ -28,6 +28,9 @@
 
 QT_BEGIN_NAMESPACE
 
+// in qhash.cpp
+extern Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed);
+
 /*
     This function looks at two file names and returns the name of the
     infile with a path relative to outfile.
@@ -386,5 +389,6 @@ QT_END_NAMESPACE
 
 int main(int _argc, char **_argv)
 {
+    QT_PREPEND_NAMESPACE(qt_set_hash_seed)(0);
     return QT_PREPEND_NAMESPACE(runMoc)(_argc, _argv);
 }
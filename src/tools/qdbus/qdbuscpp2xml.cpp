@@ -45,6 +45,8 @@ static const char docTypeHeader[] =
 QT_BEGIN_NAMESPACE
 extern Q_DBUS_EXPORT QString qDBusGenerateMetaObjectXml(QString interface, const QMetaObject *mo,
                                                        const QMetaObject *base, int flags);
+// in qhash.cpp
+extern Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed);
 QT_END_NAMESPACE
 
 #define PROGRAMNAME     "qdbuscpp2xml"
@@ -358,6 +360,7 @@ static void parseCmdLine(QStringList &arguments)
 
 int main(int argc, char **argv)
 {
+    qt_set_hash_seed(0);
     QCoreApplication app(argc, argv);
     QStringList args = app.arguments();
 
@@ -49,6 +49,11 @@
 
 #define ANNOTATION_NO_WAIT      "org.freedesktop.DBus.Method.NoReply"
 
+// in qhash.cpp
+QT_BEGIN_NAMESPACE
+extern Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed);
+QT_END_NAMESPACE
+
 QT_USE_NAMESPACE
 
 static QString globalClassName;
@@ -1119,6 +1124,7 @@ static void writeAdaptor(const QString &filename, const QDBusIntrospection::Inte
 
 int main(int argc, char **argv)
 {
+    qt_set_hash_seed(0);
     QCoreApplication app(argc, argv);
     parseCmdLine(app.arguments());
 
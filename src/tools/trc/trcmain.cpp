@@ -19,12 +19,20 @@
 ****************************************************************************/
 
 #include <QFile>
+#include <QHash>
+#include <QVector>
+#include "qendian.h"
 #include <QDebug>
 
+#include "qtranslator_p.h"
+
 #include <gettext-po.h>
 
 QT_BEGIN_NAMESPACE
 
+// in qhash.cpp
+extern Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed);
+
 static void gettext_xerror(int severity,
                            po_message_t message,
                            const char *filename, size_t lineno, size_t column,
@@ -84,6 +92,148 @@ static const struct po_xerror_handler gettext_handler
     gettext_xerror2
 };
 
+struct TrcMessage
+{
+    QByteArray msgctxt;
+    QByteArray msgid;
+    QByteArray msgstr;
+    QByteArray msgid_plural;
+    QByteArray msgstr_plural;
+};
+
+class TrcStringPool
+{
+public:
+    // identical strings, mostly contexts, are stored only once
+    void add(const QByteArray &string, quint32 *entry)
+    {
+        QHash<QByteArray, quint32>::const_iterator it = m_offsets.constFind(string);
+        quint32 offset = 0;
+        if (it != m_offsets.constEnd()) {
+            offset = it.value();
+        } else {
+            offset = m_data.size();
+            m_data.append(string);
+            m_offsets.insert(string, offset);
+        }
+        entry[0] = qToLittleEndian(offset);
+        entry[1] = qToLittleEndian(quint32(string.size()));
+    }
+
+    QByteArray data() const { return m_data; }
+
+private:
+    QByteArray m_data;
+    QHash<QByteArray, quint32> m_offsets;
+};
+
+static inline int alignedSize(const int size, const int alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+static void insertNode(QVector<QTranslatorNode> &nodes, QVector<quint32> &buckets,
+                       const QList<TrcMessage> &messages, const int message, const bool plural)
+{
+    const TrcMessage &trmessage = messages.at(message);
+    const QByteArray &key = (plural ? trmessage.msgid_plural : trmessage.msgid);
+    const quint32 h = qt_translator_hash(
+        trmessage.msgctxt.constData(), trmessage.msgctxt.size(),
+        key.constData(), key.size()
+    );
+
+    quint32 *node = &buckets[h & (buckets.size() - 1)];
+    while (*node != QTranslatorNoNode) {
+        const QTranslatorNode &it = nodes.at(*node);
+        const TrcMessage &itmessage = messages.at(it.message);
+        // the first message wins, the same way it does when the catalog is searched linearly
+        if (it.hash == h && itmessage.msgctxt == trmessage.msgctxt
+            && (it.plural ? itmessage.msgid_plural : itmessage.msgid) == key) {
+            return;
+        }
+        node = &nodes[*node].next;
+    }
+
+    const QTranslatorNode newnode = { h, quint32(message), quint32(plural), QTranslatorNoNode };
+    *node = nodes.size();
+    nodes.append(newnode);
+}
+
+static QByteArray createCatalog(const QList<TrcMessage> &messages)
+{
+    TrcStringPool strings;
+    QVector<QTranslatorMessage> trmessages(messages.size());
+    for (int i = 0; i < messages.size(); i++) {
+        const TrcMessage &it = messages.at(i);
+        strings.add(it.msgctxt, trmessages[i].msgctxt);
+        strings.add(it.msgid, trmessages[i].msgid);
+        strings.add(it.msgstr, trmessages[i].msgstr);
+        strings.add(it.msgid_plural, trmessages[i].msgid_plural);
+        strings.add(it.msgstr_plural, trmessages[i].msgstr_plural);
+    }
+
+    // every message has a node and plural messages have one more
+    quint32 nodecount = messages.size();
+    for (int i = 0; i < messages.size(); i++) {
+        if (!messages.at(i).msgid_plural.isEmpty()) {
+            nodecount++;
+        }
+    }
+
+    QVector<QTranslatorNode> nodes;
+    nodes.reserve(nodecount);
+    QVector<quint32> buckets(qt_translator_buckets(nodecount), QTranslatorNoNode);
+    for (int i = 0; i < messages.size(); i++) {
+        // this search method assumes plurals and regular messages are unique strings
+        if (!messages.at(i).msgid_plural.isEmpty()) {
+            insertNode(nodes, buckets, messages, i, true);
+        }
+        insertNode(nodes, buckets, messages, i, false);
+    }
+    for (int i = 0; i < nodes.size(); i++) {
+        nodes[i].hash = qToLittleEndian(nodes.at(i).hash);
+        nodes[i].message = qToLittleEndian(nodes.at(i).message);
+        nodes[i].plural = qToLittleEndian(nodes.at(i).plural);
+        nodes[i].next = qToLittleEndian(nodes.at(i).next);
+    }
+    for (int i = 0; i < buckets.size(); i++) {
+        buckets[i] = qToLittleEndian(buckets.at(i));
+    }
+
+    const QByteArray stringdata = strings.data();
+    const int messageoffset = alignedSize(sizeof(QTranslatorHeader), QTranslatorAlignment);
+    const int messagesize = trmessages.size() * sizeof(QTranslatorMessage);
+    const int nodeoffset = alignedSize(messageoffset + messagesize, QTranslatorAlignment);
+    const int nodesize = nodes.size() * sizeof(QTranslatorNode);
+    const int bucketoffset = alignedSize(nodeoffset + nodesize, QTranslatorAlignment);
+    const int bucketsize = buckets.size() * sizeof(quint32);
+    const int stringoffset = alignedSize(bucketoffset + bucketsize, QTranslatorPageSize);
+
+    QTranslatorHeader header;
+    ::memset(&header, 0, sizeof(QTranslatorHeader));
+    ::memcpy(header.magic, QT_TRANSLATOR_MAGIC, sizeof(QT_TRANSLATOR_MAGIC));
+    header.version = qToLittleEndian(QTranslatorVersion);
+    // both Katie and Katana assume that the strings are UTF-8
+    ::memcpy(header.codec, "UTF-8", 6);
+    header.messagecount = qToLittleEndian(quint32(trmessages.size()));
+    header.messageoffset = qToLittleEndian(quint32(messageoffset));
+    header.nodecount = qToLittleEndian(quint32(nodes.size()));
+    header.nodeoffset = qToLittleEndian(quint32(nodeoffset));
+    header.bucketcount = qToLittleEndian(quint32(buckets.size()));
+    header.bucketoffset = qToLittleEndian(quint32(bucketoffset));
+    header.stringsize = qToLittleEndian(quint32(stringdata.size()));
+    header.stringoffset = qToLittleEndian(quint32(stringoffset));
+
+    QByteArray result(stringoffset + stringdata.size(), char(0));
+    char* resultdata = result.data();
+    ::memcpy(resultdata, &header, sizeof(QTranslatorHeader));
+    ::memcpy(resultdata + messageoffset, trmessages.constData(), messagesize);
+    ::memcpy(resultdata + nodeoffset, nodes.constData(), nodesize);
+    ::memcpy(resultdata + bucketoffset, buckets.constData(), bucketsize);
+    ::memcpy(resultdata + stringoffset, stringdata.constData(), stringdata.size());
+    return result;
+}
+
 void showHelp()
 {
     fprintf(stderr, "Usage:\n"
@@ -172,8 +322,7 @@ int runTrc(int argc, char *argv[])
 
     const char* gettext_domain_header = po_file_domain_header(gettext_file, NULL);
 
-    QByteArray trdata;
-    QDataStream trdatastream(&trdata, QIODevice::WriteOnly);
+    QList<TrcMessage> trmessages;
     po_message_iterator_t gettext_iterator = po_message_iterator(gettext_file, NULL);
     po_message_t gettext_message = po_next_message(gettext_iterator);
     while (gettext_message != NULL) {
@@ -186,38 +335,24 @@ int runTrc(int argc, char *argv[])
             continue;
         }
 
-        const QByteArray po_msgctxt = po_message_msgctxt(gettext_message);
-        const QByteArray po_msgid = po_message_msgid(gettext_message);
-        const QByteArray po_msgstr = po_message_msgstr(gettext_message);
-        if (po_msgstr == gettext_domain_header) {
+        TrcMessage trmessage;
+        trmessage.msgctxt = po_message_msgctxt(gettext_message);
+        trmessage.msgid = po_message_msgid(gettext_message);
+        trmessage.msgstr = po_message_msgstr(gettext_message);
+        if (trmessage.msgstr == gettext_domain_header) {
             gettext_message = po_next_message(gettext_iterator);
             continue;
         }
-        const QByteArray po_msgid_plural = po_message_msgid_plural(gettext_message);
-        const QByteArray po_msgstr_plural = po_message_msgstr_plural(gettext_message, 1);
-
-        trdatastream << po_msgctxt;
-        trdatastream << po_msgid;
-        trdatastream << po_msgstr;
-        trdatastream << po_msgid_plural;
-        trdatastream << po_msgstr_plural;
+        trmessage.msgid_plural = po_message_msgid_plural(gettext_message);
+        trmessage.msgstr_plural = po_message_msgstr_plural(gettext_message, 1);
+        trmessages.append(trmessage);
 
         gettext_message = po_next_message(gettext_iterator);
     }
     po_message_iterator_free(gettext_iterator);
     po_file_free(gettext_file);
 
-    QByteArray trheaderdata;
-    QDataStream trheaderstream(&trheaderdata, QIODevice::WriteOnly);
-    trheaderstream << QByteArray("KATIE_TRANSLATION");
-    // both Katie and Katana assume that the strings are UTF-8
-    trheaderstream << QByteArray("UTF-8");
-
-    if (outputfile.write(trheaderdata.constData(), trheaderdata.size()) != trheaderdata.size()) {
-        fprintf(stderr, "trc: Coult not write header %s\n", qPrintable(outputfile.errorString()));
-        return 4;
-    }
-
+    const QByteArray trdata = createCatalog(trmessages);
     if (outputfile.write(trdata.constData(), trdata.size()) != trdata.size()) {
         fprintf(stderr, "trc: Coult not write data %s\n", qPrintable(outputfile.errorString()));
         return 5;
@@ -230,5 +365,6 @@ QT_END_NAMESPACE
 
 int main(int argc, char *argv[])
 {
+    QT_PREPEND_NAMESPACE(qt_set_hash_seed)(0);
     return QT_PREPEND_NAMESPACE(runTrc)(argc, argv);
 }
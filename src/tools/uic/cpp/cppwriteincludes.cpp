@@ -274,6 +274,8 @@ static const struct ClassTblData {
     { QLatin1String("QItemSelectionModel"), QLatin1String("QtGui/qitemselectionmodel.h") },
     { QLatin1String("QItemSelectionRange"), QLatin1String("QtGui/qitemselectionmodel.h") },
     { QLatin1String("QJsonDocument"), QLatin1String("QtCore/qjsondocument.h") },
+    { QLatin1String("QJsonStreamReader"), QLatin1String("QtCore/qjsonstream.h") },
+    { QLatin1String("QJsonStreamWriter"), QLatin1String("QtCore/qjsonstream.h") },
     { QLatin1String("QKeyEvent"), QLatin1String("QtGui/qevent.h") },
     { QLatin1String("QKeySequence"), QLatin1String("QtGui/qkeysequence.h") },
     { QLatin1String("QLCDNumber"), QLatin1String("QtGui/qlcdnumber.h") },
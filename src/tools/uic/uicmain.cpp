@@ -29,6 +29,9 @@
 
 QT_BEGIN_NAMESPACE
 
+// in qhash.cpp
+extern Q_CORE_EXPORT void qt_set_hash_seed(quint64 seed);
+
 static const char *error = 0;
 
 void showHelp()
@@ -152,5 +155,6 @@ QT_END_NAMESPACE
 
 int main(int argc, char *argv[])
 {
+    QT_PREPEND_NAMESPACE(qt_set_hash_seed)(0);
     return QT_PREPEND_NAMESPACE(runUic)(argc, argv);
 }
@@ -36,6 +36,7 @@ private slots:
     void removePostedEvents();
 #ifndef QT_NO_THREAD
     void deliverInDefinedOrder();
+    void postEventFromThreads();
 #endif
     void applicationPid();
     void globalPostedEventsCount();
@@ -427,6 +428,95 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QTimer::singleShot(15000, &app, SLOT(quit()));
     app.exec();
 }
+
+class SequenceEvent : public QEvent
+{
+public:
+    SequenceEvent(int thread, int sequence)
+        : QEvent(QEvent::User), thread(thread), sequence(sequence)
+    { }
+
+    const int thread;
+    const int sequence;
+};
+
+class SequenceReceiver : public QObject
+{
+public:
+    SequenceReceiver(int threadCount)
+        : next(threadCount, 0), received(0), ordered(true)
+    { }
+
+    QVector<int> next;
+    int received;
+    bool ordered;
+
+    bool event(QEvent *event)
+    {
+        if (event->type() == QEvent::User) {
+            const SequenceEvent *sequenceEvent = static_cast<SequenceEvent *>(event);
+            if (sequenceEvent->sequence != next[sequenceEvent->thread])
+                ordered = false;
+            next[sequenceEvent->thread]++;
+            received++;
+            return true;
+        }
+        return QObject::event(event);
+    }
+};
+
+class SequencePostingThread : public QThread
+{
+public:
+    SequencePostingThread(QObject *receiver, int id, int count)
+        : receiver(receiver), id(id), count(count)
+    { }
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < count; ++i) {
+            QCoreApplication::postEvent(receiver, new SequenceEvent(id, i));
+            // posting with another priority takes the mutex
+            if (i % 100 == 0)
+                QCoreApplication::postEvent(receiver, new QEvent(QEvent::Type(QEvent::User + 1)), Qt::HighEventPriority);
+        }
+    }
+
+private:
+    QObject *receiver;
+    const int id;
+    const int count;
+};
+
+void tst_QCoreApplication::postEventFromThreads()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    QCoreApplication app(argc, argv);
+
+    // events posted by each thread are delivered in the order they were posted
+    const int threadCount = 4;
+    const int eventCount = 5000;
+    SequenceReceiver receiver(threadCount);
+    QList<SequencePostingThread *> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.append(new SequencePostingThread(&receiver, i, eventCount));
+        threads.last()->start();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    while (receiver.received < threadCount * eventCount && timer.elapsed() < 30000)
+        QCoreApplication::processEvents();
+
+    foreach (SequencePostingThread *thread, threads)
+        QVERIFY(thread->wait());
+    qDeleteAll(threads);
+
+    QCOMPARE(receiver.received, threadCount * eventCount);
+    QVERIFY(receiver.ordered);
+}
 #endif // QT_NO_QTHREAD
 
 void tst_QCoreApplication::applicationPid()
@@ -55,6 +55,8 @@ private slots:
 
     void removeFileAndUnWatch();
 
+    void inotify();
+
     void cleanup();
 
     void QTBUG15255_deadlock();
@@ -440,6 +442,9 @@ void tst_QFileSystemWatcher::cleanup()
     QFile::remove(testFileName);
     QFile::remove(secondFileName);
     QDir().rmdir("testDir");
+    QFile::remove("inotifyDir/inotifyFile.txt");
+    QFile::remove("inotifyDir/inotifyOther.txt");
+    QDir().rmdir("inotifyDir");
 }
 
 void tst_QFileSystemWatcher::nonExistingFileAndDirectory()
@@ -525,6 +530,76 @@ void tst_QFileSystemWatcher::removeFileAndUnWatch()
     watcher.addPath(filename);
 }
 
+void tst_QFileSystemWatcher::inotify()
+{
+    if (!qgetenv("QT_NO_INOTIFY").isEmpty()) {
+        QSKIP("inotify is disabled via QT_NO_INOTIFY", SkipAll);
+    }
+
+    QVERIFY(QDir().mkdir("inotifyDir"));
+    const QString fileName = QString::fromLatin1("inotifyDir/inotifyFile.txt");
+    const QString otherName = QString::fromLatin1("inotifyDir/inotifyOther.txt");
+    QFile testFile(fileName);
+    QVERIFY(testFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    testFile.write(QByteArray("hello"));
+    testFile.close();
+
+    // polling would not report anything before the test times out
+    QFileSystemWatcher watcher;
+    watcher.setInterval(60000);
+    watcher.addPath(fileName);
+    watcher.addPath("inotifyDir");
+    QCOMPARE(watcher.files(), QStringList(fileName));
+    QCOMPARE(watcher.directories(), QStringList("inotifyDir"));
+
+    QSignalSpy fileChangedSpy(&watcher, SIGNAL(fileChanged(const QString &)));
+    QSignalSpy dirChangedSpy(&watcher, SIGNAL(directoryChanged(const QString &)));
+
+    // writing to or changing the permissions of an entry does not change the directory
+    QVERIFY(testFile.open(QIODevice::WriteOnly | QIODevice::Append));
+    testFile.write(QByteArray(" world"));
+    testFile.close();
+    QVERIFY(testFile.setPermissions(QFile::ReadOwner | QFile::WriteOwner | QFile::ReadUser));
+    QTest::qWait(500);
+    QCOMPARE(fileChangedSpy.count(), 1);
+    QCOMPARE(fileChangedSpy.at(0).at(0).toString(), fileName);
+    QCOMPARE(dirChangedSpy.count(), 0);
+
+    // atomically replacing the file keeps it watched
+    fileChangedSpy.clear();
+    QFile otherFile(otherName);
+    QVERIFY(otherFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    otherFile.write(QByteArray("replaced"));
+    otherFile.close();
+    QCOMPARE(::rename(QFile::encodeName(otherName).constData(), QFile::encodeName(fileName).constData()), 0);
+    QTest::qWait(500);
+    QCOMPARE(fileChangedSpy.count(), 1);
+    QCOMPARE(dirChangedSpy.count(), 1);
+    QCOMPARE(dirChangedSpy.at(0).at(0).toString(), QString::fromLatin1("inotifyDir"));
+    QCOMPARE(watcher.files(), QStringList(fileName));
+
+    fileChangedSpy.clear();
+    QVERIFY(testFile.open(QIODevice::WriteOnly | QIODevice::Append));
+    testFile.write(QByteArray("!"));
+    testFile.close();
+    QTest::qWait(500);
+    QCOMPARE(fileChangedSpy.count(), 1);
+
+    // removing the file stops watching it
+    fileChangedSpy.clear();
+    dirChangedSpy.clear();
+    QVERIFY(testFile.remove());
+    QTest::qWait(500);
+    QCOMPARE(fileChangedSpy.count(), 1);
+    QCOMPARE(dirChangedSpy.count(), 1);
+    QCOMPARE(watcher.files(), QStringList());
+    QCOMPARE(watcher.directories(), QStringList("inotifyDir"));
+
+    QVERIFY(QDir().rmdir("inotifyDir"));
+    QTest::qWait(500);
+    QCOMPARE(watcher.directories(), QStringList());
+}
+
 class SomeSingleton : public QObject
 {
 public:
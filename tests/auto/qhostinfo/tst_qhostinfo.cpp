@@ -66,9 +66,20 @@ private slots:
 
     void raceCondition();
 
+    void asyncLookup_data();
+    void asyncLookup();
+    void coalescedLookups();
+    void abortHostLookup();
+    void cacheSettings();
+
+protected slots:
+    void resultsReady(const QHostInfo &info);
+
 private:
     bool ipv6Available;
     QHostInfo lookupResults;
+    QList<QHostInfo> asyncResults;
+    int expectedResults;
 };
 
 void tst_QHostInfo::staticInformation()
@@ -265,6 +276,149 @@ void tst_QHostInfo::raceCondition()
     }
 }
 
+void tst_QHostInfo::resultsReady(const QHostInfo &info)
+{
+    asyncResults.append(info);
+    if (asyncResults.count() == expectedResults) {
+        QTestEventLoop::instance().exitLoop();
+    }
+}
+
+void tst_QHostInfo::asyncLookup_data()
+{
+    QTest::addColumn<QString>("hostname");
+    QTest::addColumn<QString>("addresses");
+    QTest::addColumn<int>("err");
+
+    QTest::newRow("empty") << "" << "" << int(QHostInfo::HostNotFound);
+    QTest::newRow("literal_ip4") << "127.0.0.1" << "127.0.0.1" << int(QHostInfo::NoError);
+    QTest::newRow("localhost") << "localhost" << "" << int(QHostInfo::NoError);
+}
+
+void tst_QHostInfo::asyncLookup()
+{
+    QFETCH(QString, hostname);
+    QFETCH(int, err);
+    QFETCH(QString, addresses);
+
+    asyncResults.clear();
+    expectedResults = 1;
+    const int id = QHostInfo::lookupHost(hostname, this, SLOT(resultsReady(QHostInfo)));
+    QVERIFY(id != -1);
+    // delivered via queued connection even when cached
+    QCOMPARE(asyncResults.count(), 0);
+
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(asyncResults.count(), 1);
+
+    const QHostInfo info = asyncResults.first();
+    QCOMPARE(info.lookupId(), id);
+    QCOMPARE((int)info.error(), err);
+    if (!addresses.isEmpty()) {
+        QCOMPARE(info.addresses(), QList<QHostAddress>() << QHostAddress(addresses));
+    } else if (err == QHostInfo::NoError) {
+        QVERIFY(!info.addresses().isEmpty());
+    }
+}
+
+void tst_QHostInfo::coalescedLookups()
+{
+    asyncResults.clear();
+    expectedResults = 10;
+    QList<int> ids;
+    for (int i = 0; i < expectedResults; i++) {
+        ids.append(QHostInfo::lookupHost("localhost", this, SLOT(resultsReady(QHostInfo))));
+    }
+
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    QCOMPARE(asyncResults.count(), expectedResults);
+
+    foreach (const QHostInfo &info, asyncResults) {
+        QVERIFY(ids.removeOne(info.lookupId()));
+        QCOMPARE(info.error(), QHostInfo::NoError);
+        QCOMPARE(info.addresses(), asyncResults.first().addresses());
+    }
+    QVERIFY(ids.isEmpty());
+}
+
+void tst_QHostInfo::abortHostLookup()
+{
+    asyncResults.clear();
+    expectedResults = 1;
+    const int aborted = QHostInfo::lookupHost("localhost", this, SLOT(resultsReady(QHostInfo)));
+    const int id = QHostInfo::lookupHost("localhost", this, SLOT(resultsReady(QHostInfo)));
+    QHostInfo::abortHostLookup(aborted);
+
+    QTestEventLoop::instance().enterLoop(10);
+    QVERIFY(!QTestEventLoop::instance().timeout());
+    // give the aborted lookup a chance to show up
+    QTest::qWait(200);
+    QCOMPARE(asyncResults.count(), 1);
+    QCOMPARE(asyncResults.first().lookupId(), id);
+}
+
+void tst_QHostInfo::cacheSettings()
+{
+    QFETCH_GLOBAL(bool, cache);
+    if (!cache) {
+        QSKIP("Cache is disabled", SkipSingle);
+    }
+
+    const int capacity = QHostInfo::cacheCapacity();
+    const int timeout = QHostInfo::cacheTimeout();
+    const int negativeTimeout = QHostInfo::negativeCacheTimeout();
+    QCOMPARE(capacity, 128);
+    QCOMPARE(timeout, 60);
+    QCOMPARE(negativeTimeout, 10);
+
+    QTest::ignoreMessage(QtWarningMsg, "QHostInfo::setCacheCapacity: capacity is less than zero");
+    QHostInfo::setCacheCapacity(-1);
+    QCOMPARE(QHostInfo::cacheCapacity(), capacity);
+    QTest::ignoreMessage(QtWarningMsg, "QHostInfo::setCacheTimeout: timeout is less than zero");
+    QHostInfo::setCacheTimeout(-1);
+    QCOMPARE(QHostInfo::cacheTimeout(), timeout);
+
+    // first lookup is a miss, the second a hit
+    qint64 hits = QHostInfo::cacheHits();
+    qint64 misses = QHostInfo::cacheMisses();
+    QCOMPARE(QHostInfo::fromName("localhost").error(), QHostInfo::NoError);
+    QCOMPARE(QHostInfo::cacheMisses(), misses + 1);
+    QCOMPARE(QHostInfo::fromName("localhost").error(), QHostInfo::NoError);
+    QCOMPARE(QHostInfo::cacheHits(), hits + 1);
+
+    // least recently used entries are dropped
+    QHostInfo::setCacheCapacity(1);
+    QHostInfo::fromName("127.0.0.1");
+    misses = QHostInfo::cacheMisses();
+    QHostInfo::fromName("localhost");
+    QCOMPARE(QHostInfo::cacheMisses(), misses + 1);
+    QHostInfo::setCacheCapacity(capacity);
+
+    // entries expire
+    QHostInfo::setCacheTimeout(1);
+    QHostInfo::fromName("localhost");
+    QTest::qWait(1100);
+    misses = QHostInfo::cacheMisses();
+    QHostInfo::fromName("localhost");
+    QCOMPARE(QHostInfo::cacheMisses(), misses + 1);
+
+    // hot entries are refreshed before they expire
+    QHostInfo::setCacheTimeout(2);
+    qt_qhostinfo_clear_cache();
+    QHostInfo::fromName("localhost");
+    QTest::qWait(1600);
+    hits = QHostInfo::cacheHits();
+    QHostInfo::fromName("localhost");
+    QCOMPARE(QHostInfo::cacheHits(), hits + 1);
+    QTest::qWait(1000);
+    misses = QHostInfo::cacheMisses();
+    QHostInfo::fromName("localhost");
+    QCOMPARE(QHostInfo::cacheMisses(), misses);
+    QHostInfo::setCacheTimeout(timeout);
+}
+
 QTEST_MAIN(tst_QHostInfo)
 
 #include "moc_tst_qhostinfo.cpp"
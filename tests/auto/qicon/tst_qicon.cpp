@@ -0,0 +1,266 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtGui/QIcon>
+#include <QtGui/QImageReader>
+
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//TESTED_CLASS=QIcon
+//TESTED_FILES=qicon.cpp,qiconloader.cpp
+
+static const char* const themeFiles[] = {
+    "index.theme",
+    "16x16/apps/edit-copy.png",
+    "scalable/apps/edit-paste.svg"
+};
+
+class tst_QIcon : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_QIcon();
+
+public slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+private slots:
+    void themeIndex();
+    void corruptedThemeCache();
+    void iconCache();
+
+private:
+    bool copyTheme();
+    bool setModificationTime(const QString &path, int seconds);
+    void reloadTheme();
+
+    QString m_themePath;
+    QString m_themeDir;
+    QString m_iconCacheDir;
+    QStringList m_themeSearchPaths;
+    QString m_themeName;
+};
+
+tst_QIcon::tst_QIcon()
+{
+    m_themePath = QDir::tempPath() + QLatin1String("/tst_qicon_")
+        + QString::number(QCoreApplication::applicationPid());
+    m_themeDir = m_themePath + QLatin1String("/testtheme");
+    m_iconCacheDir = m_themePath + QLatin1String("/cache/katie/icons");
+}
+
+void tst_QIcon::initTestCase()
+{
+    // rendered scalable icons are cached in the cache location
+    qputenv("XDG_CACHE_HOME", QFile::encodeName(m_themePath + QLatin1String("/cache")));
+}
+
+void tst_QIcon::cleanupTestCase()
+{
+    QDir().rmpath(m_iconCacheDir);
+}
+
+void tst_QIcon::init()
+{
+    m_themeSearchPaths = QIcon::themeSearchPaths();
+    m_themeName = QIcon::themeName();
+    QVERIFY(copyTheme());
+    QIcon::setThemeName(QLatin1String("testtheme"));
+}
+
+void tst_QIcon::cleanup()
+{
+    QIcon::setThemeSearchPaths(m_themeSearchPaths);
+    QIcon::setThemeName(m_themeName);
+    for (size_t i = 0; i < sizeof(themeFiles) / sizeof(const char*); i++) {
+        QFile::remove(m_themeDir + QLatin1Char('/') + QLatin1String(themeFiles[i]));
+    }
+    QFile::remove(m_themeDir + QLatin1String("/16x16/apps/dangling.png"));
+    QFile::remove(m_themeDir + QLatin1String("/icon-theme.cache"));
+    QDir().rmpath(m_themeDir + QLatin1String("/16x16/apps"));
+    QDir().rmpath(m_themeDir + QLatin1String("/scalable/apps"));
+}
+
+bool tst_QIcon::copyTheme()
+{
+    if (!QDir().mkpath(m_themeDir + QLatin1String("/16x16/apps"))
+        || !QDir().mkpath(m_themeDir + QLatin1String("/scalable/apps"))) {
+        return false;
+    }
+    for (size_t i = 0; i < sizeof(themeFiles) / sizeof(const char*); i++) {
+        const QString fileName = QLatin1String(themeFiles[i]);
+        if (!QFile::copy(QLatin1String(SRCDIR "/icons/testtheme/") + fileName,
+                         m_themeDir + QLatin1Char('/') + fileName)) {
+            return false;
+        }
+    }
+    // dangling symbolic links are not icons
+    const QByteArray dangling = QFile::encodeName(m_themeDir + QLatin1String("/16x16/apps/dangling.png"));
+    return (::symlink("nonexistent.png", dangling.constData()) == 0);
+}
+
+// sets the modification time of path to now plus seconds
+bool tst_QIcon::setModificationTime(const QString &path, int seconds)
+{
+    struct timeval times[2];
+    ::gettimeofday(&times[0], nullptr);
+    times[0].tv_sec += seconds;
+    times[1] = times[0];
+    return (::utimes(QFile::encodeName(path).constData(), times) == 0);
+}
+
+// the themes are loaded again once the search paths are set
+void tst_QIcon::reloadTheme()
+{
+    QIcon::setThemeSearchPaths(QStringList() << m_themePath);
+}
+
+void tst_QIcon::themeIndex()
+{
+    const QString cacheFile = m_themeDir + QLatin1String("/icon-theme.cache");
+
+    // without a cache the directories are listed
+    reloadTheme();
+    QVERIFY(QIcon::hasThemeIcon(QLatin1String("edit-copy")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("dangling")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("cached-only")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("missing")));
+
+    // the cache lists an icon that is not on disk, it is only found if the
+    // cache is used
+    QVERIFY(QFile::copy(QLatin1String(SRCDIR "/icons/testtheme/icon-theme.cache"), cacheFile));
+    QVERIFY(setModificationTime(m_themeDir, -60));
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/16x16/apps"), -60));
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/scalable/apps"), -60));
+    QVERIFY(setModificationTime(cacheFile, 0));
+    reloadTheme();
+    QVERIFY(QIcon::hasThemeIcon(QLatin1String("edit-copy")));
+    QVERIFY(QIcon::hasThemeIcon(QLatin1String("cached-only")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("dangling")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("missing")));
+
+    // a directory modified after the cache was written makes it stale
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/16x16/apps"), 60));
+    reloadTheme();
+    QVERIFY(QIcon::hasThemeIcon(QLatin1String("edit-copy")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("cached-only")));
+
+    // a truncated cache is not used
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/16x16/apps"), -60));
+    QVERIFY(QFile::resize(cacheFile, 12));
+    QVERIFY(setModificationTime(cacheFile, 0));
+    reloadTheme();
+    QVERIFY(QIcon::hasThemeIcon(QLatin1String("edit-copy")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("cached-only")));
+}
+
+void tst_QIcon::corruptedThemeCache()
+{
+    // the icon chains loop and the image lists are out of bounds, lookups
+    // must finish without finding anything
+    const QString cacheFile = m_themeDir + QLatin1String("/icon-theme.cache");
+    QVERIFY(QFile::copy(QLatin1String(SRCDIR "/icons/corrupted-icon-theme.cache"), cacheFile));
+    QVERIFY(setModificationTime(m_themeDir, -60));
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/16x16/apps"), -60));
+    QVERIFY(setModificationTime(m_themeDir + QLatin1String("/scalable/apps"), -60));
+    QVERIFY(setModificationTime(cacheFile, 0));
+    reloadTheme();
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("edit-copy")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("nomatch")));
+    QVERIFY(!QIcon::hasThemeIcon(QLatin1String("missing")));
+}
+
+void tst_QIcon::iconCache()
+{
+    if (!QImageReader::supportedImageFormats().contains("svg")) {
+        QSKIP("SVG image format is not supported", SkipSingle);
+    }
+
+    const QString iconName = QLatin1String("edit-paste");
+    const QString iconFile = m_themeDir + QLatin1String("/scalable/apps/edit-paste.svg");
+    const QStringList cacheFilter = QStringList() << QLatin1String("*.kat");
+    const QDir cacheDir(m_iconCacheDir);
+    foreach (const QString &fileName, cacheDir.entryList(cacheFilter, QDir::Files)) {
+        QVERIFY(QFile::remove(cacheDir.filePath(fileName)));
+    }
+
+    reloadTheme();
+    QVERIFY(!QIcon::fromTheme(iconName).pixmap(16, 16).isNull());
+    QStringList cached = cacheDir.entryList(cacheFilter, QDir::Files);
+    QCOMPARE(cached.size(), 1);
+    const QString cacheFile = cacheDir.filePath(cached.at(0));
+    const qint64 cacheSize = QFileInfo(cacheFile).size();
+
+    // the icon can not be rendered once it is replaced with garbage of the
+    // same size and modification time, the image comes from the cache
+    struct stat iconstat;
+    QCOMPARE(::stat(QFile::encodeName(iconFile).constData(), &iconstat), 0);
+    QFile icon(iconFile);
+    QVERIFY(icon.open(QFile::WriteOnly));
+    QCOMPARE(icon.write(QByteArray(iconstat.st_size, 'x')), qint64(iconstat.st_size));
+    icon.close();
+    const struct timespec times[2] = { iconstat.st_atim, iconstat.st_mtim };
+    QCOMPARE(::utimensat(AT_FDCWD, QFile::encodeName(iconFile).constData(), times, 0), 0);
+    reloadTheme();
+    QVERIFY(!QIcon::fromTheme(iconName).pixmap(16, 16).isNull());
+
+    // a corrupted image is removed
+    QVERIFY(QFile::resize(cacheFile, 30));
+    reloadTheme();
+    QVERIFY(QIcon::fromTheme(iconName).pixmap(16, 16).isNull());
+    QVERIFY(!QFile::exists(cacheFile));
+
+    // and the icon is rendered again into the same file
+    QVERIFY(QFile::remove(iconFile));
+    QVERIFY(QFile::copy(QLatin1String(SRCDIR "/icons/testtheme/scalable/apps/edit-paste.svg"), iconFile));
+    reloadTheme();
+    QVERIFY(!QIcon::fromTheme(iconName).pixmap(16, 16).isNull());
+    QCOMPARE(cacheDir.entryList(cacheFilter, QDir::Files), cached);
+    QCOMPARE(QFileInfo(cacheFile).size(), cacheSize);
+
+    // modified icons replace the image instead of adding more files
+    QFile cache(cacheFile);
+    QVERIFY(cache.open(QFile::ReadOnly));
+    const QByteArray cacheData = cache.readAll();
+    cache.close();
+    QVERIFY(setModificationTime(iconFile, 60));
+    reloadTheme();
+    QVERIFY(!QIcon::fromTheme(iconName).pixmap(16, 16).isNull());
+    QCOMPARE(cacheDir.entryList(cacheFilter, QDir::Files), cached);
+    QVERIFY(cache.open(QFile::ReadOnly));
+    QVERIFY(cache.readAll() != cacheData);
+    cache.close();
+
+    QVERIFY(QFile::remove(cacheFile));
+}
+
+QTEST_MAIN(tst_QIcon)
+
+#include "moc_tst_qicon.cpp"
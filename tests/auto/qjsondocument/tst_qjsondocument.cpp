@@ -119,6 +119,14 @@ void tst_QJsonDocument::read()
     UTF8 = jsonmap.value("UTF8").toString();
     QCOMPARE(UTF8, QString::fromUtf8("УТФ"));
 
+    jsondoc = QJsonDocument::fromJson("{\"Nested\": [[1, 2], [{\"a\": {\"b\": null}}]]}");
+    QVERIFY(jsondoc.errorString().isEmpty());
+    const QVariantList Nested = jsondoc.toVariant().toMap().value("Nested").toList();
+    QCOMPARE(Nested.size(), 2);
+    QCOMPARE(Nested.at(0).toList(), QVariantList() << 1 << 2);
+    const QVariantMap NestedMap = Nested.at(1).toList().at(0).toMap();
+    QVERIFY(NestedMap.value("a").toMap().contains("b"));
+
     // TODO: test other types too
 }
 
@@ -0,0 +1,381 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QtCore>
+
+//TESTED_CLASS=QJsonStreamReader,QJsonStreamWriter
+//TESTED_FILES=qjsonstream.cpp,qjsonstream.h
+
+// has only the data fed to it so far, like a socket
+class SequentialBuffer : public QIODevice
+{
+public:
+    SequentialBuffer() { open(QIODevice::ReadOnly | QIODevice::Unbuffered); }
+
+    bool isSequential() const { return true; }
+    void feed(const QByteArray &data) { m_data.append(data); }
+
+protected:
+    qint64 readData(char *data, qint64 maxlen)
+    {
+        const int size = int(qMin(maxlen, qint64(m_data.size())));
+        ::memcpy(data, m_data.constData(), size);
+        m_data.remove(0, size);
+        return size;
+    }
+    qint64 writeData(const char *, qint64) { return -1; }
+
+private:
+    QByteArray m_data;
+};
+
+static QStringList readTokens(QJsonStreamReader &reader)
+{
+    QStringList tokens;
+    while (reader.readNext() != QJsonStreamReader::Invalid) {
+        if (reader.tokenType() == QJsonStreamReader::EndDocument) {
+            break;
+        }
+        tokens << QString::number(reader.tokenType()) + QLatin1Char(':')
+            + reader.text() + reader.value().toString();
+    }
+    return tokens;
+}
+
+class tst_QJsonStream : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void read();
+    void readLines();
+    void readEscapes();
+    void skipCurrentValue();
+    void readError_data();
+    void readError();
+    void readSequential();
+    void write();
+    void writeHash();
+    void writeError();
+    void roundtrip();
+};
+
+void tst_QJsonStream::read()
+{
+    QByteArray json("{\"a\": [1, -2.5, true, null], \"b\": {\"c\": \"d\"}, \"e\": false}");
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.text(), QString::fromLatin1("a"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.depth(), 2);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Integer);
+    QCOMPARE(reader.toInteger(), qint64(1));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Real);
+    QCOMPARE(reader.toReal(), -2.5);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.toBool(), true);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Null);
+    QVERIFY(!reader.value().isValid());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.text(), QString::fromLatin1("b"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.value(), QVariant(QString::fromLatin1("d")));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.toBool(), false);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.depth(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+}
+
+void tst_QJsonStream::readLines()
+{
+    QByteArray json("{\"line\": 1}\n{\"line\": 2}\n[3]\n");
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    QList<qint64> lines;
+    while (!reader.atEnd()) {
+        const QJsonStreamReader::TokenType token = reader.readNext();
+        if (token == QJsonStreamReader::Integer) {
+            lines.append(reader.toInteger());
+        }
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(lines, QList<qint64>() << 1 << 2 << 3);
+    QCOMPARE(reader.lineNumber(), qint64(4));
+}
+
+void tst_QJsonStream::readEscapes()
+{
+    QByteArray json("[\"\\\"\\\\\\/\\b\\f\\n\\r\\t\", \"\\u0444\\ud83d\\ude00\", \"\xd0\xa3\xd0\xa2\xd0\xa4\"]");
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), QString::fromLatin1("\"\\/\b\f\n\r\t"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), QString::fromUtf8("\xd1\x84\xf0\x9f\x98\x80"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.text(), QString::fromUtf8("УТФ"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QJsonStream::skipCurrentValue()
+{
+    QByteArray json("{\"skip\": {\"a\": [1, {\"b\": 2}]}, \"keep\": 3}");
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    reader.skipCurrentValue();
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Key);
+    QCOMPARE(reader.text(), QString::fromLatin1("keep"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Integer);
+    QCOMPARE(reader.toInteger(), qint64(3));
+}
+
+void tst_QJsonStream::readError_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("rootless") << QByteArray("\"string\"");
+    QTest::newRow("truncated") << QByteArray("{\"a\": [1, 2");
+    QTest::newRow("trailing comma") << QByteArray("[1, 2,]");
+    QTest::newRow("missing colon") << QByteArray("{\"a\" 1}");
+    QTest::newRow("mismatched") << QByteArray("{\"a\": 1]");
+    QTest::newRow("invalid number") << QByteArray("[01]");
+    QTest::newRow("invalid literal") << QByteArray("[tru]");
+    QTest::newRow("invalid escape") << QByteArray("[\"\\x\"]");
+    QTest::newRow("lone surrogate") << QByteArray("[\"\\udc00\"]");
+    QTest::newRow("overlong UTF-8") << QByteArray("[\"\xc0\xaf\"]");
+    QTest::newRow("continuation UTF-8") << QByteArray("[\"a\x80\"]");
+    QTest::newRow("truncated UTF-8") << QByteArray("[\"\xe2\x82\"]");
+    QTest::newRow("surrogate UTF-8") << QByteArray("[\"\xed\xa0\x80\"]");
+    QTest::newRow("out of range UTF-8") << QByteArray("[\"\xf4\x90\x80\x80\"]");
+    QTest::newRow("invalid UTF-8 key") << QByteArray("{\"\xff\": 1}");
+    QTest::newRow("control character") << QByteArray("[\"a\nb\"]");
+    QTest::newRow("too big integer") << QByteArray("[99999999999999999999]");
+    QTest::newRow("too deep") << QByteArray(4096, '[');
+}
+
+void tst_QJsonStream::readError()
+{
+    QFETCH(QByteArray, json);
+
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+
+    QJsonStreamReader reader(&buffer);
+    while (!reader.atEnd()) {
+        reader.readNext();
+    }
+    QVERIFY(reader.hasError());
+    QVERIFY(!reader.errorString().isEmpty());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+}
+
+void tst_QJsonStream::readSequential()
+{
+    QByteArray json("{\"key\": [\"text\\n\\u0444\\ud83d\\ude00\", -12.5e1, 1234, true, false, null, {}]}\n[\"\xd0\xa3\"]\n");
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader bufferreader(&buffer);
+    const QStringList expected = readTokens(bufferreader);
+    QVERIFY(!bufferreader.hasError());
+    QCOMPARE(expected.size(), 16);
+
+    // the data arrives one byte at a time, tokens split between the bytes
+    // are read again once the rest of them arrived
+    SequentialBuffer device;
+    QJsonStreamReader reader(&device);
+    QStringList tokens;
+    for (int i = 0; i < json.size(); i++) {
+        device.feed(json.mid(i, 1));
+        tokens << readTokens(reader);
+        QCOMPARE(reader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+        QVERIFY(reader.hasError());
+        QVERIFY(reader.atEnd());
+    }
+    QCOMPARE(tokens, expected);
+    QCOMPARE(reader.characterOffset(), qint64(json.size()));
+
+    // the end of a closed device is the end of the document
+    device.close();
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QCOMPARE(reader.error(), QJsonStreamReader::NoError);
+
+    // unless the device closes within one
+    SequentialBuffer truncated;
+    QJsonStreamReader truncatedreader(&truncated);
+    truncated.feed("[12");
+    QCOMPARE(truncatedreader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(truncatedreader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(truncatedreader.error(), QJsonStreamReader::PrematureEndOfDocumentError);
+    truncated.close();
+    QCOMPARE(truncatedreader.readNext(), QJsonStreamReader::Integer);
+    QCOMPARE(truncatedreader.toInteger(), qint64(12));
+    QCOMPARE(truncatedreader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(truncatedreader.error(), QJsonStreamReader::NotWellFormedError);
+    QCOMPARE(truncatedreader.readNext(), QJsonStreamReader::Invalid);
+}
+
+void tst_QJsonStream::write()
+{
+    QByteArray json;
+    {
+        QBuffer buffer(&json);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+        QJsonStreamWriter writer(&buffer);
+        writer.writeStartObject();
+        writer.writeKey(QString::fromLatin1("a"));
+        writer.writeStartArray();
+        writer.writeInteger(1);
+        writer.writeReal(2.0);
+        writer.writeReal(0.1);
+        writer.writeReal(-1e300);
+        writer.writeValue(QVariant(Q_UINT64_C(18446744073709551615)));
+        writer.writeValue(QVariant(uint(4294967295u)));
+        writer.writeBool(true);
+        writer.writeNull();
+        writer.writeString(QString::fromLatin1("\"\n\x01"));
+        writer.writeEndArray();
+        writer.writeKey(QString::fromUtf8("УТФ"));
+        writer.writeStartObject();
+        writer.writeEndObject();
+        writer.writeEndObject();
+        writer.writeStartArray();
+        writer.writeEndArray();
+        QVERIFY(!writer.hasError());
+    }
+    QCOMPARE(json, QByteArray("{\"a\":[1,2.0,0.1,-1e+300,18446744073709551615,4294967295,true,null,\"\\\"\\n\\u0001\"],\"УТФ\":{}}\n[]\n"));
+}
+
+void tst_QJsonStream::writeHash()
+{
+    QVariantHash hash;
+    for (int i = 0; i < 100; i++) {
+        hash.insert(QString::number(i), i);
+    }
+
+    QByteArray json;
+    {
+        QBuffer buffer(&json);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+        QJsonStreamWriter writer(&buffer);
+        writer.writeValue(hash);
+        QVERIFY(!writer.hasError());
+    }
+
+    QVariantMap map;
+    for (int i = 0; i < 100; i++) {
+        map.insert(QString::number(i), i);
+    }
+    QByteArray expected;
+    {
+        QBuffer buffer(&expected);
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+        QJsonStreamWriter writer(&buffer);
+        writer.writeValue(map);
+        QVERIFY(!writer.hasError());
+    }
+    QCOMPARE(json, expected);
+}
+
+void tst_QJsonStream::writeError()
+{
+    QByteArray json;
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+
+    QJsonStreamWriter writer(&buffer);
+    writer.writeString(QString::fromLatin1("rootless"));
+    QVERIFY(writer.hasError());
+
+    writer.setDevice(&buffer);
+    QVERIFY(!writer.hasError());
+    writer.writeStartObject();
+    writer.writeInteger(1);
+    QVERIFY(writer.hasError());
+
+    writer.setDevice(&buffer);
+    writer.writeStartArray();
+    writer.writeEndObject();
+    QVERIFY(writer.hasError());
+
+    writer.setDevice(&buffer);
+    writer.writeStartArray();
+    writer.writeReal(qInf());
+    QVERIFY(writer.hasError());
+}
+
+void tst_QJsonStream::roundtrip()
+{
+    QVariantMap nested;
+    nested.insert("MixedArray", QVariantList() << 2 << "b" << QVariantList());
+    QVariantMap variant;
+    variant.insert("Qt/doubleClickInterval", 400);
+    variant.insert("Qt/embedFonts", true);
+    variant.insert("Qt/style", "Cleanlooks");
+    variant.insert("NestedObject", nested);
+    variant.insert("UTF8", QString::fromUtf8("УТФ"));
+
+    QByteArray json;
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QJsonStreamWriter writer(&buffer);
+    writer.setAutoFormatting(true);
+    writer.writeValue(variant);
+    QVERIFY(writer.flush());
+    QVERIFY(!writer.hasError());
+    buffer.close();
+
+    QJsonDocument jsondoc = QJsonDocument::fromJson(json);
+    QVERIFY(jsondoc.errorString().isEmpty());
+    QCOMPARE(jsondoc.toVariant().toMap(), variant);
+}
+
+QTEST_MAIN(tst_QJsonStream)
+
+#include "moc_tst_qjsonstream.cpp"
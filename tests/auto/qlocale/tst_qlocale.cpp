@@ -60,6 +60,9 @@ private slots:
     void matchingLocales();
     void double_conversion_data();
     void double_conversion();
+    void double_formatting_data();
+    void double_formatting();
+    void double_shortest();
     void long_long_conversion_data();
     void long_long_conversion();
     void long_long_conversion_extra();
@@ -538,6 +541,16 @@ void tst_QLocale::double_conversion_data()
     QTest::newRow("C 1.")        << QString("C") << QString("1.")         << true  << 1.0;
     QTest::newRow("C 1.E10")     << QString("C") << QString("1.E10")      << true  << 1.0e10;
     QTest::newRow("C 1e+10")     << QString("C") << QString("1e+10")      << true  << 1.0e+10;
+    QTest::newRow("C +1.5")      << QString("C") << QString("+1.5")       << true  << 1.5;
+    QTest::newRow("C +.5")       << QString("C") << QString("+.5")        << true  << 0.5;
+    QTest::newRow("C +")         << QString("C") << QString("+")          << false << 0.0;
+    QTest::newRow("C +-1")       << QString("C") << QString("+-1")        << false << 0.0;
+    QTest::newRow("C 1e400")     << QString("C") << QString("1e400")      << false << 0.0;
+    QTest::newRow("C -1e400")    << QString("C") << QString("-1e400")     << false << 0.0;
+    QTest::newRow("C 1e-400")    << QString("C") << QString("1e-400")     << false << 0.0;
+    QTest::newRow("C 4.9e-324")  << QString("C") << QString("4.9e-324")   << true  << 4.9406564584124654e-324;
+    QTest::newRow("C 1e-310")    << QString("C") << QString("1e-310")     << true  << 1e-310;
+    QTest::newRow("C 0x1p3")     << QString("C") << QString("0x1p3")      << true  << 8.0;
 
     QTest::newRow("de_DE 1.")	    << QString("de_DE") << QString("1.")	 << false << 0.0;
     QTest::newRow("de_DE 1.2")	    << QString("de_DE") << QString("1.2")	 << false << 0.0;
@@ -626,6 +639,83 @@ void tst_QLocale::double_conversion()
     }
 }
 
+void tst_QLocale::double_formatting_data()
+{
+    QTest::addColumn<QString>("locale_name");
+    QTest::addColumn<double>("num");
+    QTest::addColumn<char>("format");
+    QTest::addColumn<int>("precision");
+    QTest::addColumn<QString>("num_str");
+
+    QTest::newRow("C 2.675 f 2")       << QString("C") << 2.675 << 'f' << 2 << QString("2.67");
+    QTest::newRow("C 1.005 f 2")       << QString("C") << 1.005 << 'f' << 2 << QString("1.00");
+    QTest::newRow("C 0.125 f 2")       << QString("C") << 0.125 << 'f' << 2 << QString("0.12");
+    QTest::newRow("C 2.5 f 0")         << QString("C") << 2.5 << 'f' << 0 << QString("2");
+    QTest::newRow("C 2.675 f 0")       << QString("C") << 2.675 << 'f' << 0 << QString("3");
+    QTest::newRow("C 1e-5 f 2")        << QString("C") << 1e-5 << 'f' << 2 << QString("0.00");
+    QTest::newRow("C 0.1 f 20")        << QString("C") << 0.1 << 'f' << 20 << QString("0.10000000000000000555");
+    QTest::newRow("C 1e21 f 2")        << QString("C") << 1e21 << 'f' << 2 << QString("1,000,000,000,000,000,000,000.00");
+    QTest::newRow("C 2.675 g 3")       << QString("C") << 2.675 << 'g' << 3 << QString("2.67");
+    QTest::newRow("C 1.005 g 3")       << QString("C") << 1.005 << 'g' << 3 << QString("1");
+    QTest::newRow("C 123456 g 3")      << QString("C") << 123456.0 << 'g' << 3 << QString("1.23e+05");
+    QTest::newRow("C 0.0001 g 3")      << QString("C") << 0.0001 << 'g' << 3 << QString("0.0001");
+    QTest::newRow("C 0.1 g 17")        << QString("C") << 0.1 << 'g' << 17 << QString("0.10000000000000001");
+    QTest::newRow("C 2.675 e 2")       << QString("C") << 2.675 << 'e' << 2 << QString("2.67e+00");
+    QTest::newRow("de_DE 2.675 f 2")   << QString("de_DE") << 2.675 << 'f' << 2 << QString("2,67");
+    QTest::newRow("de_DE 1234.5 f 1")  << QString("de_DE") << 1234.5 << 'f' << 1 << QString("1.234,5");
+
+    const int shortest = QLocale::FloatingPointShortest;
+    QTest::newRow("C 0.1 g shortest")      << QString("C") << 0.1 << 'g' << shortest << QString("0.1");
+    QTest::newRow("C 0.1 e shortest")      << QString("C") << 0.1 << 'e' << shortest << QString("1e-01");
+    QTest::newRow("C 0.1 f shortest")      << QString("C") << 0.1 << 'f' << shortest << QString("0.1");
+    QTest::newRow("C 1/3 g shortest")      << QString("C") << 1.0 / 3 << 'g' << shortest << QString("0.3333333333333333");
+    QTest::newRow("C 2.675 g shortest")    << QString("C") << 2.675 << 'g' << shortest << QString("2.675");
+    QTest::newRow("C 100 g shortest")      << QString("C") << 100.0 << 'g' << shortest << QString("100");
+    QTest::newRow("C 100 e shortest")      << QString("C") << 100.0 << 'e' << shortest << QString("1e+02");
+    QTest::newRow("C 1e21 g shortest")     << QString("C") << 1e21 << 'g' << shortest << QString("1e+21");
+    QTest::newRow("C 1e-5 g shortest")     << QString("C") << 1e-5 << 'g' << shortest << QString("1e-05");
+    QTest::newRow("C 1e-5 f shortest")     << QString("C") << 1e-5 << 'f' << shortest << QString("0.00001");
+    QTest::newRow("C 5e-324 g shortest")   << QString("C") << 4.9406564584124654e-324 << 'g' << shortest << QString("5e-324");
+    QTest::newRow("de_DE 0.1 g shortest")  << QString("de_DE") << 0.1 << 'g' << shortest << QString("0,1");
+    QTest::newRow("de_DE 1234.5 f shortest") << QString("de_DE") << 1234.5 << 'f' << shortest << QString("1.234,5");
+}
+
+void tst_QLocale::double_formatting()
+{
+    QFETCH(QString, locale_name);
+    QFETCH(double, num);
+    QFETCH(char, format);
+    QFETCH(int, precision);
+    QFETCH(QString, num_str);
+
+    QLocale locale(locale_name);
+    QCOMPARE(locale.toString(num, format, precision), num_str);
+}
+
+void tst_QLocale::double_shortest()
+{
+    // the shortest representation must read back to the same value
+    const double values[] = {
+        0.1, 0.2, 0.3, 1.0 / 3, 2.0 / 3, 2.675, 1.005, 123456789.123456789,
+        1.7976931348623157e308, 2.2250738585072014e-308, 4.9406564584124654e-324,
+        -0.1, -1e-300, 3.141592653589793, 1e22, 1e23
+    };
+    const char formats[] = { 'g', 'e', 'f' };
+    const QLocale locale(QLocale::C);
+    for (size_t i = 0; i < sizeof(values) / sizeof(double); i++) {
+        for (size_t j = 0; j < sizeof(formats); j++) {
+            const QString str = locale.toString(values[i], formats[j], QLocale::FloatingPointShortest);
+            bool ok = false;
+            QCOMPARE(locale.toDouble(str, &ok), values[i]);
+            QVERIFY(ok);
+        }
+        const QString str = QString::number(values[i], 'g', QLocale::FloatingPointShortest);
+        bool ok = false;
+        QCOMPARE(str.toDouble(&ok), values[i]);
+        QVERIFY(ok);
+    }
+}
+
 void tst_QLocale::long_long_conversion_data()
 {
     QTest::addColumn<QString>("locale_name");
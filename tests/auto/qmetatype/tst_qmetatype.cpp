@@ -42,6 +42,7 @@ private:
 private slots:
     void defined();
     void threadSafety();
+    void concurrentLookup();
     void namespaces();
     void qMetaTypeId();
     void properties();
@@ -146,6 +147,78 @@ void tst_QMetaType::threadSafety()
     QCOMPARE(Bar::failureCount, 0);
 }
 
+static const int concurrentTypeCount = 5000;
+
+static QByteArray concurrentTypeName(int i)
+{
+    return QByteArray("ConcurrentBar") + QByteArray::number(i);
+}
+
+class MetaTypeRegistrar: public QThread
+{
+    Q_OBJECT
+protected:
+    void run()
+    {
+        for (int i = 0; i < concurrentTypeCount; ++i) {
+            const QByteArray name = concurrentTypeName(i);
+            qRegisterMetaType<Bar>(name.constData());
+            registered.storeRelease(i + 1);
+        }
+    }
+public:
+    QAtomicInt registered;
+};
+
+class MetaTypeLookup: public QThread
+{
+    Q_OBJECT
+protected:
+    void run()
+    {
+        // look up the types that are being registered right now
+        while (registrar->registered.loadAcquire() < concurrentTypeCount) {
+            const int registered = registrar->registered.loadAcquire();
+            for (int i = registered; i < registered + 8 && i < concurrentTypeCount; ++i) {
+                const QByteArray name = concurrentTypeName(i);
+                const int tp = QMetaType::type(name.constData());
+                if (tp == 0) {
+                    continue;
+                }
+                if (QMetaType::typeName(tp) != name) {
+                    ++failureCount;
+                }
+            }
+        }
+    }
+public:
+    MetaTypeLookup(MetaTypeRegistrar *r) : registrar(r), failureCount(0) { }
+    MetaTypeRegistrar *registrar;
+    int failureCount;
+};
+
+void tst_QMetaType::concurrentLookup()
+{
+    MetaTypeRegistrar registrar;
+    MetaTypeLookup l1(&registrar);
+    MetaTypeLookup l2(&registrar);
+
+    l1.start();
+    l2.start();
+    registrar.start();
+
+    QVERIFY(registrar.wait());
+    QVERIFY(l1.wait());
+    QVERIFY(l2.wait());
+
+    QCOMPARE(l1.failureCount, 0);
+    QCOMPARE(l2.failureCount, 0);
+    for (int i = 0; i < concurrentTypeCount; ++i) {
+        const QByteArray name = concurrentTypeName(i);
+        QCOMPARE(QByteArray(QMetaType::typeName(QMetaType::type(name.constData()))), name);
+    }
+}
+
 namespace TestSpace
 {
     struct Foo { double d; };
@@ -326,6 +399,14 @@ void tst_QMetaType::unregisterType()
     QCOMPARE(QMetaType::isRegistered(typeId), true);
     QMetaType::unregisterType("RegUnreg");
     QCOMPARE(QMetaType::isRegistered(typeId), false);
+    QCOMPARE(QMetaType::type("RegUnreg"), 0);
+    QVERIFY(!QMetaType::typeName(typeId));
+    // registering again gives a new ID
+    int newTypeId = qRegisterMetaType<RegUnreg>("RegUnreg");
+    QVERIFY(newTypeId != typeId);
+    QCOMPARE(QMetaType::type("RegUnreg"), newTypeId);
+    QCOMPARE(QMetaType::isRegistered(newTypeId), true);
+    QCOMPARE(QMetaType::isRegistered(typeId), false);
 }
 
 void tst_QMetaType::QTBUG11316_registerStreamBuiltin()
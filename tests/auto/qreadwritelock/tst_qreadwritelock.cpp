@@ -0,0 +1,273 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+
+#include <qatomic.h>
+#include <qreadwritelock.h>
+#include <qthread.h>
+#include <qsemaphore.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+class tst_QReadWriteLock : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void readersShareLock();
+    void writerExcludesReaders();
+    void readerExcludesWriter();
+    void tryLockTimeout();
+    void lockers();
+    void stressTest();
+};
+
+void tst_QReadWriteLock::readersShareLock()
+{
+    QReadWriteLock lock;
+    lock.lockForRead();
+    QVERIFY(lock.tryLockForRead());
+    QVERIFY(!lock.tryLockForWrite());
+    lock.unlock();
+    lock.unlock();
+
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::writerExcludesReaders()
+{
+    QReadWriteLock lock;
+    QSemaphore testsTurn;
+    QSemaphore threadsTurn;
+
+    class Thread : public QThread
+    {
+    public:
+        QReadWriteLock *lock;
+        QSemaphore *testsTurn;
+        QSemaphore *threadsTurn;
+        bool readLocked;
+        bool writeLocked;
+
+        void run()
+        {
+            threadsTurn->acquire();
+            readLocked = lock->tryLockForRead();
+            writeLocked = lock->tryLockForWrite();
+            testsTurn->release();
+        }
+    };
+
+    Thread thread;
+    thread.lock = &lock;
+    thread.testsTurn = &testsTurn;
+    thread.threadsTurn = &threadsTurn;
+    thread.start();
+
+    lock.lockForWrite();
+    threadsTurn.release();
+    testsTurn.acquire();
+    lock.unlock();
+    QVERIFY(thread.wait());
+
+    QVERIFY(!thread.readLocked);
+    QVERIFY(!thread.writeLocked);
+}
+
+void tst_QReadWriteLock::readerExcludesWriter()
+{
+    QReadWriteLock lock;
+    QSemaphore testsTurn;
+    QSemaphore threadsTurn;
+
+    class Thread : public QThread
+    {
+    public:
+        QReadWriteLock *lock;
+        QSemaphore *testsTurn;
+        QSemaphore *threadsTurn;
+        bool readLocked;
+        bool writeLocked;
+
+        void run()
+        {
+            threadsTurn->acquire();
+            readLocked = lock->tryLockForRead();
+            if (readLocked) {
+                lock->unlock();
+            }
+            writeLocked = lock->tryLockForWrite();
+            testsTurn->release();
+        }
+    };
+
+    Thread thread;
+    thread.lock = &lock;
+    thread.testsTurn = &testsTurn;
+    thread.threadsTurn = &threadsTurn;
+    thread.start();
+
+    lock.lockForRead();
+    threadsTurn.release();
+    testsTurn.acquire();
+    lock.unlock();
+    QVERIFY(thread.wait());
+
+    QVERIFY(thread.readLocked);
+    QVERIFY(!thread.writeLocked);
+}
+
+void tst_QReadWriteLock::tryLockTimeout()
+{
+    QReadWriteLock lock;
+    lock.lockForRead();
+
+    class Thread : public QThread
+    {
+    public:
+        QReadWriteLock *lock;
+        bool writeLocked;
+        qint64 elapsed;
+
+        void run()
+        {
+            QElapsedTimer timer;
+            timer.start();
+            writeLocked = lock->tryLockForWrite(200);
+            elapsed = timer.elapsed();
+            if (writeLocked) {
+                lock->unlock();
+            }
+        }
+    };
+
+    Thread thread;
+    thread.lock = &lock;
+    thread.start();
+    QVERIFY(thread.wait());
+    QVERIFY(!thread.writeLocked);
+    QVERIFY(thread.elapsed >= 150);
+
+    // the writer gets the lock once the reader is gone
+    thread.start();
+    QTest::qWait(50);
+    lock.unlock();
+    QVERIFY(thread.wait());
+    QVERIFY(thread.writeLocked);
+
+    QVERIFY(lock.tryLockForRead(-1));
+    lock.unlock();
+    QVERIFY(lock.tryLockForWrite(-1));
+    lock.unlock();
+}
+
+void tst_QReadWriteLock::lockers()
+{
+    QReadWriteLock lock;
+    {
+        QReadLocker locker(&lock);
+        QCOMPARE(locker.readWriteLock(), &lock);
+        QVERIFY(!lock.tryLockForWrite());
+        locker.unlock();
+        QVERIFY(lock.tryLockForWrite());
+        lock.unlock();
+        locker.relock();
+        QVERIFY(!lock.tryLockForWrite());
+    }
+    {
+        QWriteLocker locker(&lock);
+        QCOMPARE(locker.readWriteLock(), &lock);
+        QVERIFY(!lock.tryLockForRead());
+        locker.unlock();
+        QVERIFY(lock.tryLockForRead());
+        lock.unlock();
+        locker.relock();
+        QVERIFY(!lock.tryLockForRead());
+    }
+    QVERIFY(lock.tryLockForWrite());
+    lock.unlock();
+
+    QReadLocker nullReadLocker(nullptr);
+    QVERIFY(!nullReadLocker.readWriteLock());
+    QWriteLocker nullWriteLocker(nullptr);
+    QVERIFY(!nullWriteLocker.readWriteLock());
+}
+
+void tst_QReadWriteLock::stressTest()
+{
+    // readers verify that the two values are always seen consistent while
+    // a writer keeps changing them
+    static QReadWriteLock lock;
+    static int first = 0;
+    static int second = 0;
+    static QAtomicInt inconsistent(0);
+    static QAtomicInt stop(0);
+
+    class ReaderThread : public QThread
+    {
+    public:
+        void run()
+        {
+            while (!stop.load()) {
+                QReadLocker locker(&lock);
+                if (first != second) {
+                    inconsistent.ref();
+                }
+            }
+        }
+    };
+
+    class WriterThread : public QThread
+    {
+    public:
+        void run()
+        {
+            for (int i = 0; i < 10000; ++i) {
+                QWriteLocker locker(&lock);
+                ++first;
+                ++second;
+            }
+        }
+    };
+
+    ReaderThread readers[4];
+    WriterThread writer;
+    for (int i = 0; i < 4; ++i) {
+        readers[i].start();
+    }
+    writer.start();
+    QVERIFY(writer.wait());
+    stop.store(1);
+    for (int i = 0; i < 4; ++i) {
+        QVERIFY(readers[i].wait());
+    }
+
+    QCOMPARE(inconsistent.load(), 0);
+    QCOMPARE(first, 10000);
+    QCOMPARE(second, 10000);
+}
+
+QTEST_MAIN(tst_QReadWriteLock)
+
+#include "moc_tst_qreadwritelock.cpp"
@@ -0,0 +1,202 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtScript/qscriptengine.h>
+#include <QtScript/qscriptvalue.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+class tst_QScriptRegExp : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void exec_data();
+    void exec();
+    void stringMethods_data();
+    void stringMethods();
+    void syntaxError_data();
+    void syntaxError();
+    void catastrophicPattern_data();
+    void catastrophicPattern();
+};
+
+void tst_QScriptRegExp::exec_data()
+{
+    QTest::addColumn<QString>("script");
+    QTest::addColumn<QString>("expected");
+
+    // the result of exec() is stringified, unmatched subpatterns are null
+    QTest::newRow("literal") << "/bar/.exec('foobarbaz')" << "[\"bar\"]";
+    QTest::newRow("no match") << "/qux/.exec('foobarbaz')" << "null";
+    QTest::newRow("index") << "/b.z/.exec('foobarbaz').index" << "6";
+    QTest::newRow("empty pattern") << "new RegExp('').exec('abc')" << "[\"\"]";
+    QTest::newRow("captures") << "/(\\d+)-(\\d+)/.exec('call 555-1234 now')" << "[\"555-1234\",\"555\",\"1234\"]";
+    QTest::newRow("unmatched capture") << "/a(x)?b/.exec('ab')" << "[\"ab\",null]";
+    QTest::newRow("alternation order") << "/a|ab/.exec('abc')" << "[\"a\"]";
+    QTest::newRow("leftmost") << "/b+|a+/.exec('xaabb')" << "[\"aa\"]";
+    QTest::newRow("greedy") << "/<.*>/.exec('<a><b>')" << "[\"<a><b>\"]";
+    QTest::newRow("lazy") << "/<.*?>/.exec('<a><b>')" << "[\"<a>\"]";
+    QTest::newRow("counted") << "/a{2,3}/.exec('aaaa')" << "[\"aaa\"]";
+    QTest::newRow("counted lazy") << "/a{2,3}?/.exec('aaaa')" << "[\"aa\"]";
+    QTest::newRow("exact count") << "/\\d{4}/.exec('12 12345')" << "[\"1234\"]";
+    QTest::newRow("literal brace") << "/a{,2}/.exec('a{,2}')" << "[\"a{,2}\"]";
+    QTest::newRow("last iteration capture") << "/(a|b)+/.exec('abab')" << "[\"abab\",\"b\"]";
+    QTest::newRow("iteration resets captures") << "/(?:(a)|b)+/.exec('ab')" << "[\"ab\",null]";
+    QTest::newRow("empty iteration") << "/(a*)*/.exec('b')" << "[\"\",null]";
+    QTest::newRow("empty loop body") << "/(a*)+/.exec('b')" << "[\"\",\"\"]";
+    QTest::newRow("lazy empty loop body") << "/(?:x?(b*?)c*?)*/.exec('xbc')" << "[\"xbc\",\"\"]";
+    QTest::newRow("nested quantifiers") << "/(a|ab)(c|bcd)(d*)/.exec('abcd')" << "[\"abcd\",\"a\",\"bcd\",\"\"]";
+    QTest::newRow("class") << "/[a-c]+/.exec('xxbcaz')" << "[\"bca\"]";
+    QTest::newRow("negated class") << "/[^a-c]+/.exec('abxyzc')" << "[\"xyz\"]";
+    QTest::newRow("class escapes") << "/[\\d\\s]+/.exec('ab1 2cd')" << "[\"1 2\"]";
+    QTest::newRow("class dash") << "/[\\w-]+/.exec('!foo-bar!')" << "[\"foo-bar\"]";
+    QTest::newRow("empty class") << "/a[]/.exec('a')" << "null";
+    QTest::newRow("any class") << "/a[^]b/.exec('a\\nb')" << "[\"a\\nb\"]";
+    QTest::newRow("dot") << "/a.b/.exec('a\\nb')" << "null";
+    QTest::newRow("word") << "/\\w+/.exec('  hello_42!')" << "[\"hello_42\"]";
+    QTest::newRow("non word") << "/\\W+/.exec('ab, cd')" << "[\", \"]";
+    QTest::newRow("boundary") << "/\\bcat\\b/.exec('concat cat')" << "[\"cat\"]";
+    QTest::newRow("boundary index") << "/\\bcat\\b/.exec('concat cat').index" << "7";
+    QTest::newRow("non boundary") << "/\\Bcat/.exec('cat concat').index" << "7";
+    QTest::newRow("anchors") << "/^abc$/.exec('abc')" << "[\"abc\"]";
+    QTest::newRow("anchored no match") << "/^b/.exec('ab')" << "null";
+    QTest::newRow("multiline") << "/^b$/m.exec('a\\nb\\nc')" << "[\"b\"]";
+    QTest::newRow("not multiline") << "/^b$/.exec('a\\nb\\nc')" << "null";
+    QTest::newRow("ignore case") << "/HeLLo/i.exec('say hello')" << "[\"hello\"]";
+    QTest::newRow("ignore case class") << "/[a-z]+/i.exec('12ABc')" << "[\"ABc\"]";
+    QTest::newRow("ignore case non latin1") << "/\\u0434/i.exec('\\u0414')[0].charCodeAt(0)" << "1044";
+    QTest::newRow("escapes") << "/\\x41\\u0042\\t/.exec('AB\\t')" << "[\"AB\\t\"]";
+    QTest::newRow("control escape") << "/\\cJ/.exec('a\\nb')" << "[\"\\n\"]";
+    QTest::newRow("octal escape") << "/\\101/.exec('A')" << "[\"A\"]";
+    QTest::newRow("backreference") << "/(\\w)\\1/.exec('abccd')" << "[\"cc\",\"c\"]";
+    QTest::newRow("backreference ignore case") << "/(a)\\1/i.exec('aA')" << "[\"aA\",\"a\"]";
+    QTest::newRow("backreference unset") << "/(a)?\\1b/.exec('b')" << "[\"b\",null]";
+    QTest::newRow("backreference quotes") << "/(['\"])(.*?)\\1/.exec('x = \"it\\'s\"')" << "[\"\\\"it's\\\"\",\"\\\"\",\"it's\"]";
+    QTest::newRow("lookahead") << "/\\w+(?=!)/.exec('hi you!')" << "[\"you\"]";
+    QTest::newRow("negative lookahead") << "/a(?!b)\\w/.exec('abac')" << "[\"ac\"]";
+    QTest::newRow("lookahead captures") << "/(?=(a+))a*b\\1/.exec('baaabac')" << "[\"aba\",\"a\"]";
+    QTest::newRow("negative lookahead captures") << "/(?!(a)b)a/.exec('aba')" << "[\"a\",null]";
+    QTest::newRow("start offset") << "(function() { var r = /o/g; r.exec('foo'); return r.exec('foo').index; })()" << "2";
+    QTest::newRow("anchored start offset") << "(function() { var r = /^o/g; r.lastIndex = 1; return r.exec('oo'); })()" << "null";
+}
+
+void tst_QScriptRegExp::exec()
+{
+    QFETCH(QString, script);
+    QFETCH(QString, expected);
+
+    QScriptEngine engine;
+    QScriptValue result = engine.evaluate(QString::fromLatin1("JSON.stringify(%1)").arg(script));
+    QVERIFY2(!engine.hasUncaughtException(), qPrintable(result.toString()));
+    QCOMPARE(result.toString(), expected);
+}
+
+void tst_QScriptRegExp::stringMethods_data()
+{
+    QTest::addColumn<QString>("script");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("match global") << "'a1b22c333'.match(/\\d+/g).join()" << "1,22,333";
+    QTest::newRow("match") << "'key=value'.match(/(\\w+)=(\\w+)/).join()" << "key=value,key,value";
+    QTest::newRow("replace") << "'a-b-c'.replace(/-/g, '+')" << "a+b+c";
+    QTest::newRow("replace captures") << "'John Smith'.replace(/(\\w+)\\s(\\w+)/, '$2, $1')" << "Smith, John";
+    QTest::newRow("replace function") << "'abc'.replace(/[ac]/g, function(m) { return m.toUpperCase(); })" << "AbC";
+    QTest::newRow("replace empty matches") << "'abc'.replace(/x*/g, '-')" << "-a-b-c-";
+    QTest::newRow("split") << "'a, b,c'.split(/\\s*,\\s*/).join('|')" << "a|b|c";
+    QTest::newRow("split captures") << "'a1b2c'.split(/(\\d)/).join('|')" << "a|1|b|2|c";
+    QTest::newRow("search") << "'hello world'.search(/o\\s/)" << "4";
+    QTest::newRow("test") << "/^[\\w.]+@[\\w.]+$/.test('user@example.com')" << "true";
+    QTest::newRow("multiline global") << "'a\\nb\\nc'.match(/^\\w$/gm).join()" << "a,b,c";
+}
+
+void tst_QScriptRegExp::stringMethods()
+{
+    QFETCH(QString, script);
+    QFETCH(QString, expected);
+
+    QScriptEngine engine;
+    QScriptValue result = engine.evaluate(script);
+    QVERIFY2(!engine.hasUncaughtException(), qPrintable(result.toString()));
+    QCOMPARE(result.toString(), expected);
+}
+
+void tst_QScriptRegExp::syntaxError_data()
+{
+    QTest::addColumn<QString>("pattern");
+
+    QTest::newRow("missing paren") << "(a";
+    QTest::newRow("unmatched paren") << "a)";
+    QTest::newRow("nothing to repeat") << "*a";
+    QTest::newRow("double quantifier") << "a**";
+    QTest::newRow("quantified assertion") << "^*";
+    QTest::newRow("missing bracket") << "[a";
+    QTest::newRow("range out of order") << "[z-a]";
+    QTest::newRow("quantifier out of order") << "a{3,2}";
+    QTest::newRow("quantifier too big") << "a{99999}";
+    QTest::newRow("trailing backslash") << "a\\";
+    QTest::newRow("unknown group") << "(?<a)";
+}
+
+void tst_QScriptRegExp::syntaxError()
+{
+    QFETCH(QString, pattern);
+
+    QScriptEngine engine;
+    engine.globalObject().setProperty("pattern", pattern);
+    QScriptValue result = engine.evaluate("new RegExp(pattern)");
+    QVERIFY(engine.hasUncaughtException());
+    QVERIFY(result.isError());
+    QCOMPARE(result.property("name").toString(), QString::fromLatin1("SyntaxError"));
+}
+
+void tst_QScriptRegExp::catastrophicPattern_data()
+{
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<bool>("expected");
+
+    // these take exponential time with a naive backtracking matcher
+    QTest::newRow("nested star") << "^(a*)*b$" << false;
+    QTest::newRow("nested plus") << "^(a+)+$" << true;
+    QTest::newRow("alternation") << "^(a|aa)+b" << false;
+    QTest::newRow("overlapping") << "(a|a?)+c" << false;
+}
+
+void tst_QScriptRegExp::catastrophicPattern()
+{
+    QFETCH(QString, pattern);
+    QFETCH(bool, expected);
+
+    QScriptEngine engine;
+    engine.globalObject().setProperty("pattern", pattern);
+    QElapsedTimer timer;
+    timer.start();
+    QScriptValue result = engine.evaluate("new RegExp(pattern).test(new Array(5001).join('a'))");
+    QVERIFY(!engine.hasUncaughtException());
+    QCOMPARE(result.toBool(), expected);
+    QVERIFY(timer.elapsed() < 5000);
+}
+
+QTEST_MAIN(tst_QScriptRegExp)
+
+#include "moc_tst_qscriptregexp.cpp"
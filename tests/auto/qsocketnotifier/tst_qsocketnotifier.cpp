@@ -24,6 +24,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QSocketNotifier>
+#include <QtCore/QThread>
 #include <QtCore/QTimer>
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
@@ -46,6 +47,7 @@ private slots:
     void mixingWithTimers();
     void posixSockets();
     void invalidFD();
+    void manyDescriptors();
 };
 
 tst_QSocketNotifier::tst_QSocketNotifier()
@@ -287,16 +289,59 @@ void tst_QSocketNotifier::posixSockets()
 
 void tst_QSocketNotifier::invalidFD()
 {
-    int posixSocket = qt_safe_socket(AF_INET, SOCK_STREAM, 0);
-    QSocketNotifier sn(posixSocket, QSocketNotifier::Write);
-    QCoreApplication::processEvents();
+    // epoll forgets about closed descriptors, only select() reports them
+    class Thread : public QThread
+    {
+    public:
+        void run()
+        {
+            int posixSocket = qt_safe_socket(AF_INET, SOCK_STREAM, 0);
+            QSocketNotifier sn(posixSocket, QSocketNotifier::Write);
+            QCoreApplication::processEvents();
+
+            qt_safe_close(posixSocket);
+            QByteArray errorbytes("QSocketNotifier: Invalid socket ");
+            errorbytes.append(QByteArray::number(posixSocket));
+            errorbytes.append(" and type 'Write', disabling...");
+            QTest::ignoreMessage(QtWarningMsg, errorbytes.constData());
+            QCoreApplication::processEvents();
+        }
+    };
+
+    const QByteArray noepoll = qgetenv("QT_NO_EPOLL");
+    qputenv("QT_NO_EPOLL", "1");
+    Thread thread;
+    thread.start();
+    QVERIFY(thread.wait());
+    qputenv("QT_NO_EPOLL", noepoll);
+}
 
-    qt_safe_close(posixSocket);
-    QByteArray errorbytes("QSocketNotifier: Invalid socket ");
-    errorbytes.append(QByteArray::number(posixSocket));
-    errorbytes.append(" and type 'Write', disabling...");
-    QTest::ignoreMessage(QtWarningMsg, errorbytes.constData());
-    QCoreApplication::processEvents();
+void tst_QSocketNotifier::manyDescriptors()
+{
+    if (!qgetenv("QT_NO_EPOLL").isEmpty())
+        QSKIP("select() can not wait for descriptors beyond FD_SETSIZE", SkipAll);
+
+    int pair[2];
+    QCOMPARE(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    const int highSocket = ::fcntl(pair[0], F_DUPFD, FD_SETSIZE + 100);
+    if (highSocket == -1) {
+        qt_safe_close(pair[0]);
+        qt_safe_close(pair[1]);
+        QSKIP("Can not open descriptors beyond FD_SETSIZE", SkipAll);
+    }
+
+    {
+        QSocketNotifier rn(highSocket, QSocketNotifier::Read);
+        connect(&rn, SIGNAL(activated(int)), &QTestEventLoop::instance(), SLOT(exitLoop()));
+        QSignalSpy readSpy(&rn, SIGNAL(activated(int)));
+
+        QCOMPARE(qt_safe_write(pair[1], "x", 1), qint64(1));
+        QTestEventLoop::instance().enterLoop(3);
+        QCOMPARE(readSpy.count(), 1);
+    }
+    qt_safe_close(highSocket);
+    qt_safe_close(pair[0]);
+    qt_safe_close(pair[1]);
 }
 
 QTEST_MAIN(tst_QSocketNotifier)
@@ -0,0 +1,360 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+
+#include <qtconcurrent.h>
+#include <qparallelalgorithms.h>
+#include <qsemaphore.h>
+
+//TESTED_CLASS=
+//TESTED_FILES=
+
+static void multiplyByTwo(int &value)
+{
+    value *= 2;
+}
+
+static int square(const int &value)
+{
+    return value * value;
+}
+
+static bool isEven(const int &value)
+{
+    return (value % 2) == 0;
+}
+
+static void sum(qint64 &result, const int &value)
+{
+    result += value;
+}
+
+class tst_QtConcurrent : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void blockingMap();
+    void map();
+    void blockingMapped();
+    void mapped();
+    void filtered();
+    void mappedReduced();
+    void run();
+    void promise();
+    void cancel();
+    void nested();
+    void parallelSort_data();
+    void parallelSort();
+    void parallelStableSort();
+};
+
+static QList<int> sequence(int count)
+{
+    QList<int> list;
+    for (int i = 0; i < count; ++i) {
+        list.append(i);
+    }
+    return list;
+}
+
+void tst_QtConcurrent::blockingMap()
+{
+    QList<int> list = sequence(10000);
+    QtConcurrent::blockingMap(list, multiplyByTwo);
+    for (int i = 0; i < list.size(); ++i) {
+        QCOMPARE(list.at(i), i * 2);
+    }
+
+    QVector<int> vector = sequence(1000).toVector();
+    QtConcurrent::blockingMap(vector, [](int &value) { value += 1; });
+    for (int i = 0; i < vector.size(); ++i) {
+        QCOMPARE(vector.at(i), i + 1);
+    }
+
+    QList<int> empty;
+    QtConcurrent::blockingMap(empty, multiplyByTwo);
+    QVERIFY(empty.isEmpty());
+}
+
+void tst_QtConcurrent::map()
+{
+    QList<int> list = sequence(10000);
+    QFuture<void> future = QtConcurrent::map(list, multiplyByTwo);
+    future.waitForFinished();
+    QVERIFY(future.isFinished());
+    QVERIFY(!future.isCanceled());
+    QCOMPARE(future.progressMinimum(), 0);
+    QCOMPARE(future.progressMaximum(), 10000);
+    QCOMPARE(future.progressValue(), 10000);
+    for (int i = 0; i < list.size(); ++i) {
+        QCOMPARE(list.at(i), i * 2);
+    }
+}
+
+void tst_QtConcurrent::blockingMapped()
+{
+    const QList<int> list = sequence(10000);
+    const QList<int> squares = QtConcurrent::blockingMapped(list, square);
+    QCOMPARE(squares.size(), list.size());
+    for (int i = 0; i < squares.size(); ++i) {
+        QCOMPARE(squares.at(i), i * i);
+    }
+
+    const QVector<QString> strings = QtConcurrent::blockingMapped(list.toVector(),
+        [](const int &value) { return QString::number(value); });
+    QCOMPARE(strings.size(), list.size());
+    QCOMPARE(strings.at(42), QString::fromLatin1("42"));
+
+    QStringList words;
+    words << QLatin1String("one") << QLatin1String("three");
+    const QList<int> lengths = QtConcurrent::blockingMapped(words,
+        [](const QString &word) { return word.length(); });
+    QCOMPARE(lengths, QList<int>() << 3 << 5);
+}
+
+void tst_QtConcurrent::mapped()
+{
+    const QList<int> list = sequence(10000);
+    QFuture<QList<int> > future = QtConcurrent::mapped(list, square);
+    const QList<int> squares = future.result();
+    QVERIFY(future.isFinished());
+    QCOMPARE(squares.size(), list.size());
+    for (int i = 0; i < squares.size(); ++i) {
+        QCOMPARE(squares.at(i), i * i);
+    }
+}
+
+void tst_QtConcurrent::filtered()
+{
+    const QList<int> list = sequence(10000);
+    const QList<int> evens = QtConcurrent::blockingFiltered(list, isEven);
+    QCOMPARE(evens.size(), 5000);
+    for (int i = 0; i < evens.size(); ++i) {
+        QCOMPARE(evens.at(i), i * 2);
+    }
+
+    QCOMPARE(QtConcurrent::filtered(list, isEven).result(), evens);
+
+    QList<int> inPlace = list;
+    QtConcurrent::blockingFilter(inPlace, isEven);
+    QCOMPARE(inPlace, evens);
+
+    inPlace = list;
+    QtConcurrent::filter(inPlace, isEven).waitForFinished();
+    QCOMPARE(inPlace, evens);
+}
+
+void tst_QtConcurrent::mappedReduced()
+{
+    const QList<int> list = sequence(10000);
+    const qint64 expected = qint64(9999) * 10000 * 19999 / 6;
+
+    QCOMPARE(QtConcurrent::blockingMappedReduced(list, square, sum), expected);
+    QCOMPARE(QtConcurrent::mappedReduced(list, square, sum).result(), expected);
+
+    // the reduce function sees the values in the order of the sequence
+    const QString joined = QtConcurrent::blockingMappedReduced<QString>(sequence(20),
+        [](const int &value) { return QString::number(value % 10); },
+        [](QString &result, const QString &value) { result += value; });
+    QCOMPARE(joined, QString::fromLatin1("01234567890123456789"));
+}
+
+void tst_QtConcurrent::run()
+{
+    QFuture<int> future = QtConcurrent::run([]() { return 42; });
+    QCOMPARE(future.result(), 42);
+    QVERIFY(future.isStarted());
+    QVERIFY(!future.isRunning());
+
+    QAtomicInt called(0);
+    QFuture<void> voidFuture = QtConcurrent::run([&called]() { called.ref(); });
+    voidFuture.waitForFinished();
+    QCOMPARE(called.load(), 1);
+
+    QFuture<int> defaultFuture;
+    QVERIFY(defaultFuture.isFinished());
+    QVERIFY(defaultFuture.isCanceled());
+}
+
+void tst_QtConcurrent::promise()
+{
+    QFuture<QString> future;
+    {
+        QPromise<QString> promise;
+        future = promise.future();
+        QVERIFY(!future.isStarted());
+        promise.start();
+        QVERIFY(future.isRunning());
+        promise.setProgressRange(0, 10);
+        promise.setProgressValue(5);
+        promise.setProgressValue(3);
+        QCOMPARE(future.progressValue(), 5);
+        promise.setResult(QString::fromLatin1("done"));
+        promise.finish();
+    }
+    QVERIFY(future.isFinished());
+    QVERIFY(!future.isCanceled());
+    QCOMPARE(future.result(), QString::fromLatin1("done"));
+
+    // a promise destroyed before finishing cancels the future
+    QPromise<int> *promise = new QPromise<int>();
+    QFuture<int> broken = promise->future();
+    QFuture<int> copy = broken;
+    QVERIFY(copy == broken);
+    promise->start();
+    QVERIFY(!broken.isFinished());
+    QVERIFY(!broken.isCanceled());
+    delete promise;
+    QVERIFY(copy.isFinished());
+    QVERIFY(copy.isCanceled());
+
+    QFuture<void> voidFuture;
+    {
+        QPromise<void> voidPromise;
+        voidFuture = voidPromise.future();
+        voidPromise.start();
+        QVERIFY(voidFuture.isRunning());
+        voidPromise.finish();
+    }
+    voidFuture.waitForFinished();
+    QVERIFY(voidFuture.isFinished());
+    QVERIFY(!voidFuture.isCanceled());
+}
+
+void tst_QtConcurrent::cancel()
+{
+    // block the map until the future is canceled, the remaining items are skipped
+    QSemaphore started;
+    QSemaphore canceled;
+    QAtomicInt calls(0);
+    QList<int> list = sequence(100000);
+    QFuture<void> future = QtConcurrent::map(list, [&](int &value) {
+        if (calls.fetchAndAddOrdered(1) == 0) {
+            started.release();
+            canceled.acquire();
+        }
+        value = -1;
+    });
+    started.acquire();
+    future.cancel();
+    canceled.release();
+    future.waitForFinished();
+    QVERIFY(future.isCanceled());
+    QVERIFY(future.isFinished());
+    QVERIFY(calls.load() < list.size());
+}
+
+void tst_QtConcurrent::nested()
+{
+    // algorithms called from pool threads do not wait for free threads
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int savedLimit = pool->maxThreadCount();
+    pool->setMaxThreadCount(2);
+
+    const QList<int> outer = sequence(16);
+    const QList<int> sums = QtConcurrent::blockingMapped(outer, [](const int &value) {
+        const QList<int> inner = QtConcurrent::blockingMapped(sequence(1000), square);
+        int total = 0;
+        foreach (int item, inner) {
+            total += item;
+        }
+        return total + value;
+    });
+    QCOMPARE(sums.size(), 16);
+    QCOMPARE(sums.at(3), 332833500 + 3);
+
+    pool->setMaxThreadCount(savedLimit);
+}
+
+void tst_QtConcurrent::parallelSort_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::newRow("empty") << 0;
+    QTest::newRow("one") << 1;
+    QTest::newRow("small") << 100;
+    QTest::newRow("large") << 100000;
+    QTest::newRow("odd") << 123457;
+}
+
+void tst_QtConcurrent::parallelSort()
+{
+    QFETCH(int, count);
+
+    // more threads than cores still sorts and merges chunks
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int savedLimit = pool->maxThreadCount();
+    pool->setMaxThreadCount(4);
+
+    qsrand(count);
+    QVector<int> vector;
+    for (int i = 0; i < count; ++i) {
+        vector.append(qrand() % 1000);
+    }
+    QList<int> list = vector.toList();
+
+    QVector<int> expected = vector;
+    qSort(expected);
+
+    qParallelSort(vector);
+    QCOMPARE(vector, expected);
+
+    qParallelSort(list.begin(), list.end());
+    QCOMPARE(list.toVector(), expected);
+
+    qParallelSort(vector.begin(), vector.end(), qGreater<int>());
+    std::reverse(expected.begin(), expected.end());
+    QCOMPARE(vector, expected);
+
+    pool->setMaxThreadCount(savedLimit);
+}
+
+void tst_QtConcurrent::parallelStableSort()
+{
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int savedLimit = pool->maxThreadCount();
+    pool->setMaxThreadCount(4);
+
+    // sort by the key only, equal keys keep their original order
+    QVector<QPair<int, int> > vector;
+    qsrand(1);
+    for (int i = 0; i < 100000; ++i) {
+        vector.append(qMakePair(qrand() % 100, i));
+    }
+    QVector<QPair<int, int> > expected = vector;
+
+    struct KeyLessThan {
+        bool operator()(const QPair<int, int> &first, const QPair<int, int> &second) const
+        {
+            return first.first < second.first;
+        }
+    };
+    qStableSort(expected.begin(), expected.end(), KeyLessThan());
+    qParallelStableSort(vector.begin(), vector.end(), KeyLessThan());
+    QCOMPARE(vector, expected);
+
+    pool->setMaxThreadCount(savedLimit);
+}
+
+QTEST_MAIN(tst_QtConcurrent)
+
+#include "moc_tst_qtconcurrent.cpp"
@@ -25,6 +25,23 @@
 //TESTED_CLASS=QTextCodec
 //TESTED_FILES=qtextcodec.cpp,qtextcodec.h,qtextcodec_p.h
 
+// converts text from a static destructor, after the converter cache of the
+// main thread is destroyed
+class ExitConversion
+{
+public:
+    ~ExitConversion()
+    {
+        if (QString::fromAscii("abc") != QLatin1String("abc")) {
+            ::abort();
+        }
+        if (QString::fromLatin1("abc").toAscii() != "abc") {
+            ::abort();
+        }
+    }
+};
+static ExitConversion exitconversion;
+
 class tst_QTextCodec : public QObject
 {
     Q_OBJECT
@@ -39,6 +56,12 @@ private slots:
 
     void hasFailure_data();
     void hasFailure();
+    void toUnicode_data();
+    void toUnicode();
+    void fromUnicode_data();
+    void fromUnicode();
+    void converterCache();
+    void toUnicodeOverflow();
 };
 
 void tst_QTextCodec::init()
@@ -93,6 +116,156 @@ void tst_QTextCodec::hasFailure()
     }
 }
 
+void tst_QTextCodec::toUnicode_data()
+{
+    QTest::addColumn<int>("mib");
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QString>("expected");
+    QTest::addColumn<bool>("hasfailure");
+
+    const QString longascii = QString::fromLatin1("abcdefghijklmnopqrstuvwxyz0123456789");
+    QTest::newRow("utf8-ascii") << int(106) << longascii.toLatin1() << longascii << false;
+    QTest::newRow("utf8-mixed") << int(106) << QByteArray("abcdefghijklmnop\xd0\x91\xe2\x82\xac\xf0\x9f\x98\x80q")
+        << (QString::fromLatin1("abcdefghijklmnop") + QChar(0x0411) + QChar(0x20ac) + QChar(0xd83d) + QChar(0xde00) + QLatin1Char('q')) << false;
+    QTest::newRow("utf8-bom") << int(106) << QByteArray("\xef\xbb\xbfx")
+        << (QString(QChar(0xfeff)) + QLatin1Char('x')) << false;
+    QTest::newRow("utf8-invalid-lead") << int(106) << QByteArray("a\xff" "b")
+        << (QLatin1Char('a') + QString(QChar::ReplacementCharacter) + QLatin1Char('b')) << true;
+    QTest::newRow("utf8-truncated") << int(106) << QByteArray("\xe2\x82" "z")
+        << (QString(QChar::ReplacementCharacter) + QLatin1Char('z')) << true;
+    QTest::newRow("utf8-overlong") << int(106) << QByteArray("\xe0\x80\x80")
+        << QString(3, QChar::ReplacementCharacter) << true;
+    QTest::newRow("utf8-surrogate") << int(106) << QByteArray("\xed\xa0\x80")
+        << QString(3, QChar::ReplacementCharacter) << true;
+    QTest::newRow("utf8-too-big") << int(106) << QByteArray("\xf4\x90\x80\x80")
+        << QString(4, QChar::ReplacementCharacter) << true;
+    QTest::newRow("latin1") << int(4) << QByteArray("abcdefghijklmnop\xe9\x80\xff")
+        << (QString::fromLatin1("abcdefghijklmnop") + QChar(0xe9) + QChar(0x80) + QChar(0xff)) << false;
+}
+
+void tst_QTextCodec::toUnicode()
+{
+    QFETCH(int, mib);
+    QFETCH(QByteArray, data);
+    QFETCH(QString, expected);
+    QFETCH(bool, hasfailure);
+
+    QTextConverter converter(mib);
+    QCOMPARE(converter.toUnicode(data), expected);
+    QCOMPARE(converter.hasFailure(), hasfailure);
+    QCOMPARE(QTextCodec::codecForMib(mib)->toUnicode(data), expected);
+    if (mib == 106) {
+        QCOMPARE(QString::fromUtf8(data.constData(), data.size()), expected);
+    } else {
+        QCOMPARE(QString::fromLatin1(data.constData(), data.size()), expected);
+    }
+}
+
+void tst_QTextCodec::fromUnicode_data()
+{
+    QTest::addColumn<int>("mib");
+    QTest::addColumn<QString>("data");
+    QTest::addColumn<QByteArray>("expected");
+    QTest::addColumn<QByteArray>("expectednull");
+    QTest::addColumn<bool>("hasfailure");
+
+    const QString longascii = QString::fromLatin1("abcdefghijklmnopqrstuvwxyz0123456789");
+    QTest::newRow("utf8-ascii") << int(106) << longascii << longascii.toLatin1() << longascii.toLatin1() << false;
+    QTest::newRow("utf8-mixed") << int(106)
+        << (QString::fromLatin1("abcdefghijklmnop") + QChar(0x0411) + QChar(0x20ac) + QChar(0xd83d) + QChar(0xde00))
+        << QByteArray("abcdefghijklmnop\xd0\x91\xe2\x82\xac\xf0\x9f\x98\x80")
+        << QByteArray("abcdefghijklmnop\xd0\x91\xe2\x82\xac\xf0\x9f\x98\x80") << false;
+    QTest::newRow("utf8-lone-surrogate") << int(106) << (QChar(0xd800) + QString::fromLatin1("a") + QChar(0xdc00))
+        << QByteArray("?a?") << QByteArray("\\0a\\0") << true;
+    QTest::newRow("latin1-pair") << int(4) << (QString::fromLatin1("abcdefghijklmnop") + QChar(0xd83d) + QChar(0xde00) + QChar(0xe9))
+        << QByteArray("abcdefghijklmnop?\xe9") << QByteArray("abcdefghijklmnop\\0\xe9") << true;
+    QTest::newRow("latin1-ignorable") << int(4) << (QLatin1Char('a') + QChar(0x200b) + QLatin1Char('b'))
+        << QByteArray("ab") << QByteArray("ab") << true;
+}
+
+void tst_QTextCodec::fromUnicode()
+{
+    QFETCH(int, mib);
+    QFETCH(QString, data);
+    QFETCH(QByteArray, expected);
+    QFETCH(QByteArray, expectednull);
+    QFETCH(bool, hasfailure);
+
+    QTextConverter converter(mib);
+    QCOMPARE(converter.fromUnicode(data), expected);
+    QCOMPARE(converter.hasFailure(), hasfailure);
+    QCOMPARE(QTextCodec::codecForMib(mib)->fromUnicode(data), expected);
+    if (mib == 106) {
+        QCOMPARE(data.toUtf8(), expected);
+    }
+
+    QTextConverter nullconverter(mib);
+    nullconverter.setFlags(QTextConverter::ConvertInvalidToNull);
+    QCOMPARE(nullconverter.fromUnicode(data), expectednull);
+    QCOMPARE(nullconverter.hasFailure(), hasfailure);
+}
+
+void tst_QTextCodec::converterCache()
+{
+    // more codecs than the converters each thread keeps, used in turns so
+    // that converters are evicted and opened again
+    static const char* const codecnames[] = {
+        "ISO-8859-2", "ISO-8859-4", "ISO-8859-5", "ISO-8859-9", "ISO-8859-10",
+        "ISO-8859-13", "ISO-8859-15", "KOI8-R", "KOI8-U", "windows-1250",
+        "windows-1251", "windows-1257", "IBM866"
+    };
+    QByteArray data;
+    for (int i = 0xe0; i <= 0xff; i++) {
+        data.append(char(i));
+    }
+
+    for (int round = 0; round < 3; round++) {
+        for (size_t i = 0; i < sizeof(codecnames) / sizeof(codecnames[0]); i++) {
+            const QByteArray codecname(codecnames[i]);
+            QTextCodec *codec = QTextCodec::codecForName(codecname);
+            QVERIFY2(codec, codecnames[i]);
+            // the converter of the QTextConverter is not cached
+            const QString expected = QTextConverter(codecname).toUnicode(data);
+            QCOMPARE(expected.size(), data.size());
+            const QString decoded = codec->toUnicode(data);
+            QCOMPARE(decoded, expected);
+            QCOMPARE(codec->fromUnicode(decoded), data);
+        }
+    }
+}
+
+void tst_QTextCodec::toUnicodeOverflow()
+{
+    // SCSU encodes supplementary characters in a window with one byte each,
+    // there are more UTF-16 characters than bytes and the conversion is
+    // done again with the size ICU reports
+    QTextCodec *codec = QTextCodec::codecForName("SCSU");
+    QVERIFY(codec);
+
+    QString text;
+    for (int i = 0; i < 100; i++) {
+        text.append(QChar(0xd83d));
+        text.append(QChar(0xde00 + (i % 64)));
+    }
+    const QByteArray encoded = codec->fromUnicode(text);
+    QVERIFY(encoded.size() > 0);
+    QVERIFY(encoded.size() < text.size());
+    QCOMPARE(codec->toUnicode(encoded), text);
+
+    QTextConverter converter("SCSU");
+    QCOMPARE(converter.toUnicode(encoded), text);
+    QVERIFY(!converter.hasFailure());
+
+    // same in the path without the scratch buffer
+    QString longtext;
+    for (int i = 0; i < 400; i++) {
+        longtext.append(text);
+    }
+    const QByteArray longencoded = codec->fromUnicode(longtext);
+    QVERIFY(longencoded.size() < longtext.size());
+    QCOMPARE(codec->toUnicode(longencoded), longtext);
+}
+
 QTEST_MAIN(tst_QTextCodec)
 
 #include "moc_tst_qtextcodec.cpp"
@@ -82,6 +82,8 @@ private slots:
     void waitForDone();
     void waitForDoneTimeout();
     void destroyingWaitsForTasksToFinish();
+    void startFromPoolThread();
+    void priorityStart();
     void stressTest();
 
 private:
@@ -911,6 +913,95 @@ void tst_QThreadPool::destroyingWaitsForTasksToFinish()
     }
 }
 
+void tst_QThreadPool::startFromPoolThread()
+{
+    // tasks started from pool threads are queued on the starting thread and
+    // stolen by the other threads
+    class SpawningTask : public QRunnable
+    {
+    public:
+        SpawningTask(QThreadPool *pool, int depth) : pool(pool), depth(depth) { }
+
+        void run()
+        {
+            count.ref();
+            if (depth > 0) {
+                for (int i = 0; i < 4; ++i) {
+                    pool->start(new SpawningTask(pool, depth - 1));
+                }
+            }
+        }
+
+    private:
+        QThreadPool *pool;
+        const int depth;
+    };
+
+    count = 0;
+    {
+        QThreadPool threadPool;
+        threadPool.setMaxThreadCount(4);
+        threadPool.start(new SpawningTask(&threadPool, 6));
+        threadPool.waitForDone();
+        // 1 + 4 + 16 + ... + 4096
+        QCOMPARE(int(count), 5461);
+    }
+}
+
+void tst_QThreadPool::priorityStart()
+{
+    class Holder : public QRunnable
+    {
+    public:
+        QSemaphore started;
+        QSemaphore release;
+
+        void run()
+        {
+            started.release();
+            release.acquire();
+        }
+    };
+
+    class Runner : public QRunnable
+    {
+    public:
+        QList<int> *order;
+        QMutex *mutex;
+        int value;
+
+        Runner(QList<int> *order, QMutex *mutex, int value)
+            : order(order), mutex(mutex), value(value)
+        { }
+
+        void run()
+        {
+            QMutexLocker locker(mutex);
+            order->append(value);
+        }
+    };
+
+    QList<int> order;
+    QMutex mutex;
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(1);
+    Holder *holder = new Holder;
+    holder->setAutoDelete(false);
+    threadPool.start(holder);
+    holder->started.acquire();
+
+    threadPool.start(new Runner(&order, &mutex, -1), -1);
+    threadPool.start(new Runner(&order, &mutex, 0));
+    threadPool.start(new Runner(&order, &mutex, 2), 2);
+    threadPool.start(new Runner(&order, &mutex, 0));
+    threadPool.start(new Runner(&order, &mutex, 1), 1);
+    holder->release.release();
+    threadPool.waitForDone();
+    delete holder;
+
+    QCOMPARE(order, QList<int>() << 2 << 1 << 0 << 0 << -1);
+}
+
 void tst_QThreadPool::stressTest()
 {
     class Task : public QRunnable
@@ -74,6 +74,7 @@ private slots:
 
     void QTBUG13633_dontBlockEvents();
     void postedEventsShouldNotStarveTimers();
+    void timersFireInTimeoutOrder();
 };
 
 class TimerHelper : public QObject
@@ -710,6 +711,55 @@ void tst_QTimer::postedEventsShouldNotStarveTimers()
     QVERIFY(timerHelper.count > 5);
 }
 
+class TimerOrderHelper : public QObject
+{
+public:
+    QList<int> fired;
+
+protected:
+    void timerEvent(QTimerEvent *event)
+    {
+        fired.append(event->timerId());
+        killTimer(event->timerId());
+    }
+};
+
+void tst_QTimer::timersFireInTimeoutOrder()
+{
+    TimerOrderHelper helper;
+    QList<int> timerIds;
+    QHash<int, int> intervals;
+    for (int i = 0; i < 300; ++i) {
+        const int interval = ((i * 7) % 5) * 20;
+        const int timerId = helper.startTimer(interval);
+        timerIds.append(timerId);
+        intervals.insert(timerId, interval);
+    }
+    // stopped timers never fire
+    QList<int> stoppedIds;
+    for (int i = 0; i < timerIds.size(); i += 3) {
+        helper.killTimer(timerIds.at(i));
+        stoppedIds.append(timerIds.at(i));
+    }
+
+    // all timers are due, a single pass activates each of them once
+    QTest::qSleep(150);
+    QCoreApplication::processEvents();
+    QCOMPARE(helper.fired.size(), 200);
+
+    for (int i = 0; i < helper.fired.size(); ++i) {
+        const int timerId = helper.fired.at(i);
+        QVERIFY(!stoppedIds.contains(timerId));
+        if (i > 0) {
+            // same interval means the earlier started timer fires first
+            const int previousId = helper.fired.at(i - 1);
+            QVERIFY(intervals.value(previousId) <= intervals.value(timerId));
+            if (intervals.value(previousId) == intervals.value(timerId))
+                QVERIFY(timerIds.indexOf(previousId) < timerIds.indexOf(timerId));
+        }
+    }
+}
+
 QTEST_MAIN(tst_QTimer)
 
 #include "moc_tst_qtimer.cpp"
@@ -36,6 +36,7 @@ public slots:
 
 private slots:
     void fromdata();
+    void loopedchain();
 };
 
 void tst_QTranslator::init()
@@ -55,6 +56,35 @@ void tst_QTranslator::fromdata()
     QVERIFY(translator.loadFromData(trfile.readAll()));
     QCOMPARE(translator.translate("", "foo"), QString::fromUtf8("фоо"));
     QCOMPARE(translator.translate("foo", "bar"), QString::fromUtf8("фообар"));
+    QCOMPARE(translator.translate("foo", "foo"), QString::fromUtf8("foo"));
+    QCOMPARE(translator.translateStrict("", "bar"), QString());
+    QCOMPARE(translator.translateStrict("foo", "bar"), QString::fromUtf8("фообар"));
+}
+
+void tst_QTranslator::loopedchain()
+{
+    const QString trfilepath = QFile::encodeName(SRCDIR "/test.tr");
+    QFile trfile(trfilepath);
+    QVERIFY(trfile.open(QFile::ReadOnly));
+    QByteArray trdata = trfile.readAll();
+    QVERIFY(trdata.size() > 80);
+
+    // point every bucket to the first node and the first node to itself,
+    // lookups must give up instead of following the chain forever
+    uchar *data = reinterpret_cast<uchar*>(trdata.data());
+    const quint32 nodeoffset = qFromLittleEndian<quint32>(data + 68);
+    const quint32 bucketcount = qFromLittleEndian<quint32>(data + 72);
+    const quint32 bucketoffset = qFromLittleEndian<quint32>(data + 76);
+    QVERIFY(qint64(bucketoffset) + bucketcount * 4 <= trdata.size());
+    for (quint32 i = 0; i < bucketcount; i++) {
+        qToLittleEndian<quint32>(0, data + bucketoffset + i * 4);
+    }
+    qToLittleEndian<quint32>(0, data + nodeoffset + 12);
+
+    QTranslator translator;
+    QVERIFY(translator.loadFromData(trdata));
+    QCOMPARE(translator.translate("", "missing"), QString::fromLatin1("missing"));
+    QCOMPARE(translator.translateStrict("foo", "missing"), QString());
 }
 
 QTEST_MAIN(tst_QTranslator)
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QUrl>
+
+#include "qtldurl_p.h"
+
+//TESTED_CLASS=QUrl
+//TESTED_FILES=qurl.cpp,qtldurl.cpp
+
+class tst_QUrl : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void topLevelDomain_data();
+    void topLevelDomain();
+    void effectiveTLD_data();
+    void effectiveTLD();
+};
+
+void tst_QUrl::topLevelDomain_data()
+{
+    QTest::addColumn<QString>("url");
+    QTest::addColumn<QString>("tld");
+
+    // wildcard rules match labels of any length, up to 63 characters in a host
+    const QString label = QString(63, QLatin1Char('a'));
+
+    QTest::newRow("co.uk") << QString::fromLatin1("https://www.bbc.co.uk/news/") << QString::fromLatin1(".co.uk");
+    QTest::newRow("deep co.uk") << QString::fromLatin1("https://a.b.c.d.example.co.uk/") << QString::fromLatin1(".co.uk");
+    QTest::newRow("upper case") << QString::fromLatin1("https://WWW.BBC.CO.UK/") << QString::fromLatin1(".co.uk");
+    QTest::newRow("private") << QString::fromLatin1("https://my-bucket.s3-eu-west-1.amazonaws.com/object")
+        << QString::fromLatin1(".s3-eu-west-1.amazonaws.com");
+    QTest::newRow("github.io") << QString::fromLatin1("https://user.github.io/project/") << QString::fromLatin1(".github.io");
+    QTest::newRow("wildcard") << QString::fromLatin1("https://foo.bar.kawasaki.jp/") << QString::fromLatin1(".bar.kawasaki.jp");
+    QTest::newRow("exception") << QString::fromLatin1("https://www.nic.ck/") << QString::fromLatin1(".nic.ck");
+    QTest::newRow("long wildcard label") << (QLatin1String("https://www.") + label + QLatin1String(".ck/"))
+        << (QLatin1Char('.') + label + QLatin1String(".ck"));
+    QTest::newRow("long nested wildcard label") << (QLatin1String("https://") + label + QLatin1String(".compute.amazonaws.com.cn/"))
+        << (QLatin1Char('.') + label + QLatin1String(".compute.amazonaws.com.cn"));
+    QTest::newRow("long label") << (QLatin1String("https://www.") + label + QLatin1String(".co.uk/"))
+        << QString::fromLatin1(".co.uk");
+    QTest::newRow("localhost") << QString::fromLatin1("https://localhost/") << QString();
+    QTest::newRow("address") << QString::fromLatin1("https://192.168.1.1/admin") << QString();
+    QTest::newRow("file") << QString::fromLatin1("file:///home/user/document.html") << QString();
+}
+
+void tst_QUrl::topLevelDomain()
+{
+    QFETCH(QString, url);
+    QFETCH(QString, tld);
+
+    QCOMPARE(QUrl(url).topLevelDomain(), tld);
+}
+
+void tst_QUrl::effectiveTLD_data()
+{
+    QTest::addColumn<QString>("domain");
+    QTest::addColumn<bool>("effective");
+
+    const QString label = QString(63, QLatin1Char('a'));
+    const QString overlong = QString(200, QLatin1Char('b'));
+
+    QTest::newRow("com") << QString::fromLatin1("com") << true;
+    QTest::newRow("co.uk") << QString::fromLatin1("co.uk") << true;
+    QTest::newRow("bbc.co.uk") << QString::fromLatin1("bbc.co.uk") << false;
+    QTest::newRow("private") << QString::fromLatin1("s3-eu-west-1.amazonaws.com") << true;
+    QTest::newRow("unicode") << QString::fromUtf8("公司.cn") << true;
+    QTest::newRow("wildcard") << QString::fromLatin1("nic.ck") << true;
+    QTest::newRow("wildcard only") << QString::fromLatin1("ck") << false;
+    QTest::newRow("exception") << QString::fromLatin1("www.ck") << false;
+    QTest::newRow("nested wildcard") << QString::fromLatin1("foo.kawasaki.jp") << true;
+    QTest::newRow("nested exception") << QString::fromLatin1("city.kawasaki.jp") << false;
+    QTest::newRow("long wildcard label") << (label + QLatin1String(".ck")) << true;
+    QTest::newRow("long nested wildcard label") << (label + QLatin1String(".kawasaki.jp")) << true;
+    QTest::newRow("overlong wildcard label") << (overlong + QLatin1String(".ck")) << true;
+    QTest::newRow("long label") << (label + QLatin1String(".com")) << false;
+    QTest::newRow("overlong label") << (overlong + QLatin1String(".com")) << false;
+    QTest::newRow("overlong levels") << (QLatin1String("a.") + overlong + QLatin1String(".ck")) << false;
+    QTest::newRow("empty") << QString() << false;
+    QTest::newRow("dot") << QString::fromLatin1(".") << false;
+}
+
+void tst_QUrl::effectiveTLD()
+{
+    QFETCH(QString, domain);
+    QFETCH(bool, effective);
+
+    QCOMPARE(qIsEffectiveTLD(domain), effective);
+}
+
+QTEST_MAIN(tst_QUrl)
+
+#include "moc_tst_qurl.cpp"
@@ -20,8 +20,11 @@
 ****************************************************************************/
 #include <QTextCodec>
 #include <QFile>
+#include <QVector>
 #include <qtest.h>
 
+#include <unicode/ucnv.h>
+
 Q_DECLARE_METATYPE(QList<QByteArray>)
 Q_DECLARE_METATYPE(QTextCodec *)
 
@@ -38,8 +41,66 @@ private slots:
     void fromUnicode() const;
     void toUnicode_data() const;
     void toUnicode() const;
+    void fromUtf8_data() const;
+    void fromUtf8() const;
+    void toUtf8_data() const;
+    void toUtf8() const;
+    void fromLatin1_data() const;
+    void fromLatin1() const;
 };
 
+static const UChar questionmarkchar[1] = { 0x3f };
+
+// the conversions as done before the native codecs, opening an ICU
+// converter for every call
+static QString icuToUnicode(const QByteArray &data, const char *codec)
+{
+    UErrorCode error = U_ZERO_ERROR;
+    UConverter *conv = ucnv_open(codec, &error);
+    ucnv_setSubstString(conv, questionmarkchar, 1, &error);
+    const int maxchars = UCNV_GET_MAX_BYTES_FOR_STRING(data.size(), ucnv_getMaxCharSize(conv));
+    QVector<UChar> result(maxchars);
+    error = U_ZERO_ERROR;
+    const int length = ucnv_toUChars(conv, result.data(), maxchars, data.constData(), data.size(), &error);
+    ucnv_close(conv);
+    return QString(reinterpret_cast<const QChar*>(result.constData()), length);
+}
+
+static QByteArray icuFromUnicode(const QString &string, const char *codec)
+{
+    UErrorCode error = U_ZERO_ERROR;
+    UConverter *conv = ucnv_open(codec, &error);
+    ucnv_setSubstString(conv, questionmarkchar, 1, &error);
+    const int maxbytes = UCNV_GET_MAX_BYTES_FOR_STRING(string.size(), ucnv_getMaxCharSize(conv));
+    QByteArray result(maxbytes, Qt::Uninitialized);
+    error = U_ZERO_ERROR;
+    const int length = ucnv_fromUChars(conv, result.data(), maxbytes,
+        reinterpret_cast<const UChar*>(string.unicode()), string.size(), &error);
+    ucnv_close(conv);
+    result.resize(length);
+    return result;
+}
+
+static QByteArray utf8Text()
+{
+    QFile file(QLatin1String(SRCDIR "utf-8.txt"));
+    if (!file.open(QFile::ReadOnly)) {
+        qFatal("Cannot open input file");
+    }
+    return file.readAll();
+}
+
+static QByteArray asciiText(int size)
+{
+    static const char json[] = "{\"path\": \"/usr/share/icons/hicolor/48x48/apps/katie.png\", \"size\": 4096},\n";
+    QByteArray result;
+    while (result.size() < size) {
+        result.append(json);
+    }
+    result.truncate(size);
+    return result;
+}
+
 void tst_QTextCodec::codecForName() const
 {
     QFETCH(QList<QByteArray>, codecs);
@@ -147,6 +208,96 @@ void tst_QTextCodec::toUnicode() const
     }
 }
 
+void tst_QTextCodec::fromUtf8_data() const
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<bool>("icu");
+
+    const QByteArray shortascii = asciiText(48);
+    const QByteArray longascii = asciiText(64 * 1024);
+    const QByteArray mixed = utf8Text();
+    QTest::newRow("short ascii") << shortascii << false;
+    QTest::newRow("short ascii icu") << shortascii << true;
+    QTest::newRow("long ascii") << longascii << false;
+    QTest::newRow("long ascii icu") << longascii << true;
+    QTest::newRow("mixed") << mixed << false;
+    QTest::newRow("mixed icu") << mixed << true;
+}
+
+void tst_QTextCodec::fromUtf8() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    QCOMPARE(QString::fromUtf8(data.constData(), data.size()), icuToUnicode(data, "UTF-8"));
+    if (icu) {
+        QBENCHMARK {
+            icuToUnicode(data, "UTF-8");
+        }
+    } else {
+        QBENCHMARK {
+            QString::fromUtf8(data.constData(), data.size());
+        }
+    }
+}
+
+void tst_QTextCodec::toUtf8_data() const
+{
+    fromUtf8_data();
+}
+
+void tst_QTextCodec::toUtf8() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    const QString string = QString::fromUtf8(data.constData(), data.size());
+    QCOMPARE(string.toUtf8(), icuFromUnicode(string, "UTF-8"));
+    if (icu) {
+        QBENCHMARK {
+            icuFromUnicode(string, "UTF-8");
+        }
+    } else {
+        QBENCHMARK {
+            string.toUtf8();
+        }
+    }
+}
+
+void tst_QTextCodec::fromLatin1_data() const
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<bool>("icu");
+
+    const QByteArray shortascii = asciiText(48);
+    const QByteArray longascii = asciiText(64 * 1024);
+    QByteArray latin1 = longascii;
+    for (int i = 0; i < latin1.size(); i += 7) {
+        latin1[i] = char(0xe9);
+    }
+    QTest::newRow("short ascii") << shortascii << false;
+    QTest::newRow("short ascii icu") << shortascii << true;
+    QTest::newRow("long latin1") << latin1 << false;
+    QTest::newRow("long latin1 icu") << latin1 << true;
+}
+
+void tst_QTextCodec::fromLatin1() const
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, icu);
+
+    QCOMPARE(QString::fromLatin1(data.constData(), data.size()), icuToUnicode(data, "ISO-8859-1"));
+    if (icu) {
+        QBENCHMARK {
+            icuToUnicode(data, "ISO-8859-1");
+        }
+    } else {
+        QBENCHMARK {
+            QString::fromLatin1(data.constData(), data.size());
+        }
+    }
+}
+
 QTEST_MAIN(tst_QTextCodec)
 
 #include "moc_main.cpp"
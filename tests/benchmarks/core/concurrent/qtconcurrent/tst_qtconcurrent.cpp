@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtCore/qparallelalgorithms.h>
+#include <QtTest/QtTest>
+
+#include <cmath>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=
+
+static const int itemCount = 1000000;
+
+// a few microseconds of work per item
+static double work(const int &value)
+{
+    double result = value;
+    for (int i = 0; i < 200; ++i) {
+        result = std::sqrt(result + i);
+    }
+    return result;
+}
+
+class tst_QtConcurrent : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanupTestCase();
+
+    void mapped_data();
+    void mapped();
+    void mappedReduced_data();
+    void mappedReduced();
+    void sort_data();
+    void sort();
+
+private:
+    void threadCountData();
+};
+
+void tst_QtConcurrent::init()
+{
+    QFETCH(int, threadCount);
+    if (threadCount > 0) {
+        QThreadPool::globalInstance()->setMaxThreadCount(threadCount);
+    }
+}
+
+void tst_QtConcurrent::cleanupTestCase()
+{
+    QThreadPool::globalInstance()->setMaxThreadCount(QThread::idealThreadCount());
+}
+
+void tst_QtConcurrent::threadCountData()
+{
+    QTest::addColumn<int>("threadCount");
+    // no thread count means the sequential version
+    QTest::newRow("sequential") << 0;
+    const int threadCounts[] = { 1, 2, 4, 8 };
+    for (int i = 0; i < 4; ++i) {
+        QTest::newRow(QByteArray::number(threadCounts[i]) + " threads") << threadCounts[i];
+    }
+}
+
+void tst_QtConcurrent::mapped_data()
+{
+    threadCountData();
+}
+
+void tst_QtConcurrent::mapped()
+{
+    QFETCH(int, threadCount);
+
+    QVector<int> input(itemCount / 10);
+    for (int i = 0; i < input.size(); ++i) {
+        input[i] = i;
+    }
+
+    QVector<double> output;
+    QBENCHMARK {
+        if (threadCount == 0) {
+            output.clear();
+            output.reserve(input.size());
+            foreach (int value, input) {
+                output.append(work(value));
+            }
+        } else {
+            output = QtConcurrent::blockingMapped(input, work);
+        }
+    }
+    QCOMPARE(output.size(), input.size());
+    QCOMPARE(output.at(42), work(42));
+}
+
+void tst_QtConcurrent::mappedReduced_data()
+{
+    threadCountData();
+}
+
+static void sum(double &result, const double &value)
+{
+    result += value;
+}
+
+void tst_QtConcurrent::mappedReduced()
+{
+    QFETCH(int, threadCount);
+
+    QList<int> input;
+    for (int i = 0; i < itemCount / 10; ++i) {
+        input.append(i);
+    }
+
+    double result = 0;
+    QBENCHMARK {
+        if (threadCount == 0) {
+            result = 0;
+            foreach (int value, input) {
+                sum(result, work(value));
+            }
+        } else {
+            result = QtConcurrent::blockingMappedReduced(input, work, sum);
+        }
+    }
+    QVERIFY(result > 0);
+}
+
+void tst_QtConcurrent::sort_data()
+{
+    threadCountData();
+}
+
+void tst_QtConcurrent::sort()
+{
+    QFETCH(int, threadCount);
+
+    QVector<int> input(itemCount);
+    qsrand(1);
+    for (int i = 0; i < input.size(); ++i) {
+        input[i] = qrand();
+    }
+
+    QVector<int> vector;
+    QBENCHMARK {
+        vector = input;
+        if (threadCount == 0) {
+            qSort(vector);
+        } else {
+            qParallelSort(vector);
+        }
+    }
+    for (int i = 1; i < vector.size(); ++i) {
+        QVERIFY(vector.at(i - 1) <= vector.at(i));
+    }
+}
+
+QTEST_MAIN(tst_QtConcurrent)
+
+#include "moc_tst_qtconcurrent.cpp"
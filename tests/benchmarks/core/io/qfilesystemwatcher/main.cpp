@@ -0,0 +1,175 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QEventLoop>
+#include <QTimer>
+#include <qtest.h>
+
+#include <sys/resource.h>
+
+QT_USE_NAMESPACE
+
+#ifndef QT_NO_FILESYSTEMWATCHER
+
+class tst_qfilesystemwatcher : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+
+    void idleCpuTime_data();
+    void idleCpuTime();
+    void latency_data();
+    void latency();
+
+private:
+    QStringList createFiles(int count);
+
+    QString m_dir;
+};
+
+static qint64 cpuTimeMSecs()
+{
+    struct rusage usage;
+    ::getrusage(RUSAGE_SELF, &usage);
+    return (qint64(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000)
+        + ((usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000);
+}
+
+void tst_qfilesystemwatcher::initTestCase()
+{
+    m_dir = QDir::tempPath() + QString::fromLatin1("/tst_bench_qfilesystemwatcher.%1")
+        .arg(QCoreApplication::applicationPid());
+    QVERIFY(QDir().mkpath(m_dir));
+}
+
+void tst_qfilesystemwatcher::cleanupTestCase()
+{
+    QDir dir(m_dir);
+    foreach (const QString &name, dir.entryList(QDir::Files)) {
+        dir.remove(name);
+    }
+    QDir().rmdir(m_dir);
+}
+
+void tst_qfilesystemwatcher::init()
+{
+    // the engine is chosen when the watcher is first used
+    QFETCH(bool, polling);
+    if (polling) {
+        qputenv("QT_NO_INOTIFY", "1");
+    } else {
+        qputenv("QT_NO_INOTIFY", QByteArray());
+    }
+}
+
+QStringList tst_qfilesystemwatcher::createFiles(int count)
+{
+    QStringList result;
+    for (int i = 0; i < count; ++i) {
+        const QString path = m_dir + QString::fromLatin1("/file%1").arg(i);
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            break;
+        }
+        file.write("hello");
+        result.append(path);
+    }
+    return result;
+}
+
+void tst_qfilesystemwatcher::idleCpuTime_data()
+{
+    QTest::addColumn<bool>("polling");
+    QTest::addColumn<int>("count");
+    QTest::newRow("inotify, 100") << false << 100;
+    QTest::newRow("polling, 100") << true << 100;
+    QTest::newRow("inotify, 1000") << false << 1000;
+    QTest::newRow("polling, 1000") << true << 1000;
+    QTest::newRow("inotify, 10000") << false << 10000;
+    QTest::newRow("polling, 10000") << true << 10000;
+}
+
+// reports the CPU time spent by the process while nothing changes on disk
+void tst_qfilesystemwatcher::idleCpuTime()
+{
+    QFETCH(int, count);
+
+    const QStringList paths = createFiles(count);
+    QCOMPARE(paths.count(), count);
+
+    QFileSystemWatcher watcher;
+    watcher.addPaths(paths);
+
+    QEventLoop loop;
+    QTimer::singleShot(5000, &loop, SLOT(quit()));
+    const qint64 start = cpuTimeMSecs();
+    loop.exec();
+    QTest::setBenchmarkResult(cpuTimeMSecs() - start, QTest::WalltimeMilliseconds);
+}
+
+void tst_qfilesystemwatcher::latency_data()
+{
+    QTest::addColumn<bool>("polling");
+    QTest::newRow("inotify") << false;
+    QTest::newRow("polling") << true;
+}
+
+// time from a file modification until fileChanged() is emitted
+void tst_qfilesystemwatcher::latency()
+{
+    const QStringList paths = createFiles(1000);
+    QCOMPARE(paths.count(), 1000);
+
+    QFileSystemWatcher watcher;
+    watcher.addPaths(paths);
+
+    QEventLoop loop;
+    QTimer timeout;
+    timeout.setSingleShot(true);
+    connect(&watcher, SIGNAL(fileChanged(QString)), &loop, SLOT(quit()));
+    connect(&timeout, SIGNAL(timeout()), &loop, SLOT(quit()));
+
+    QFile file(paths.at(paths.count() / 2));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Append));
+    QBENCHMARK {
+        file.write("world");
+        file.flush();
+        timeout.start(10000);
+        loop.exec();
+        QVERIFY(timeout.isActive());
+        timeout.stop();
+    }
+}
+
+QTEST_MAIN(tst_qfilesystemwatcher)
+
+#include "moc_main.cpp"
+
+#else // QT_NO_FILESYSTEMWATCHER
+
+QTEST_NOOP_MAIN
+
+#endif // QT_NO_FILESYSTEMWATCHER
@@ -45,6 +45,7 @@ private slots:
     void equality_data();
     void equality();
     void qmlPropertyWriteUseCase();
+    void topLevelDomain();
 
 private:
     void generateFirstRunData();
@@ -221,6 +222,72 @@ void tst_qurl::qmlPropertyWriteUseCase()
     }
 }
 
+// URLs as seen by a browser loading a few popular sites, including their
+// cookie, CDN and tracking hosts
+static const char* topLevelDomainUrls[] = {
+    "https://www.google.com/search?q=katie",
+    "https://fonts.gstatic.com/s/roboto/v30/font.woff2",
+    "https://www.youtube.com/watch?v=dQw4w9WgXcQ",
+    "https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg",
+    "https://en.wikipedia.org/wiki/Public_Suffix_List",
+    "https://upload.wikimedia.org/wikipedia/commons/a/a9/Example.jpg",
+    "https://www.bbc.co.uk/news/technology",
+    "https://static.files.bbci.co.uk/core/bundle.js",
+    "https://www.amazon.co.jp/dp/B000000000",
+    "https://images-fe.ssl-images-amazon.com/images/I/01.jpg",
+    "https://github.com/fluxer/katie",
+    "https://avatars.githubusercontent.com/u/1?v=4",
+    "https://raw.githubusercontent.com/fluxer/katie/master/README",
+    "https://fluxer.github.io/katie/",
+    "https://www.reddit.com/r/cpp/",
+    "https://styles.redditmedia.com/t5_2qhs0/styles/image.png",
+    "https://d1.awsstatic.com/logos/aws-logo.png",
+    "https://my-bucket.s3-eu-west-1.amazonaws.com/object",
+    "https://ec2-1-2-3-4.compute-1.amazonaws.com/",
+    "https://myapp.herokuapp.com/login",
+    "https://project.appspot.com/api",
+    "https://www.gov.uk/browse/tax",
+    "https://www.service-public.fr/particuliers",
+    "https://www.bundesregierung.de/breg-de",
+    "https://www.city.kawasaki.jp/",
+    "https://www.parliament.nz/en/",
+    "https://www.abc.net.au/news/",
+    "https://www.mercadolibre.com.ar/",
+    "https://www.uol.com.br/",
+    "https://www.baidu.com/s?wd=katie",
+    "https://www.xn--fiqs8s.cn/",
+    "https://www.sina.com.cn/",
+    "https://www.yandex.ru/search/",
+    "https://vk.com/feed",
+    "https://www.nic.ck/",
+    "https://www.mod.uk/",
+    "https://doubleclick.net/pixel?id=1",
+    "https://stats.g.doubleclick.net/r/collect",
+    "https://connect.facebook.net/en_US/sdk.js",
+    "https://www.googletagmanager.com/gtm.js?id=GTM-1",
+    "https://cdn.jsdelivr.net/npm/package/dist/lib.js",
+    "https://cdnjs.cloudflare.com/ajax/libs/jquery/3.6.0/jquery.min.js",
+    "https://blog.example.blogspot.com/2022/01/post.html",
+    "https://user.github.io/project/",
+    "https://a.b.c.d.example.co.uk/deep/path",
+    "https://localhost/",
+    "https://192.168.1.1/admin",
+    "file:///home/user/document.html"
+};
+
+void tst_qurl::topLevelDomain()
+{
+    QList<QUrl> urls;
+    for (size_t i = 0; i < sizeof(topLevelDomainUrls) / sizeof(const char*); i++) {
+        urls.append(QUrl(QLatin1String(topLevelDomainUrls[i])));
+    }
+    QBENCHMARK {
+        foreach (const QUrl &url, urls) {
+            url.topLevelDomain();
+        }
+    }
+}
+
 QTEST_MAIN(tst_qurl)
 
 #include "moc_main.cpp"
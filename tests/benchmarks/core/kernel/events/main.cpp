@@ -78,6 +78,42 @@ int EventTester::foo(int bar)
     return bar + 1;
 }
 
+class CountingReceiver : public QObject
+{
+public:
+    CountingReceiver() : received(0), expected(0) {}
+
+    int received;
+    int expected;
+
+protected:
+    bool event(QEvent *e)
+    {
+        if (e->type() != QEvent::User)
+            return QObject::event(e);
+        if (++received == expected)
+            QTestEventLoop::instance().exitLoop();
+        return true;
+    }
+};
+
+class PostingThread : public QThread
+{
+public:
+    PostingThread(QObject *receiver, int count) : m_receiver(receiver), m_count(count) {}
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < m_count; ++i)
+            QCoreApplication::postEvent(m_receiver, new QEvent(QEvent::User));
+    }
+
+private:
+    QObject *m_receiver;
+    int m_count;
+};
+
 class EventsBench : public QObject
 {
     Q_OBJECT
@@ -91,6 +127,8 @@ private slots:
     void sendEvent();
     void postEvent_data();
     void postEvent();
+    void postEventFromThreads_data();
+    void postEventFromThreads();
 };
 
 void EventsBench::initTestCase()
@@ -164,6 +202,36 @@ void EventsBench::postEvent()
     }
 }
 
+void EventsBench::postEventFromThreads_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+void EventsBench::postEventFromThreads()
+{
+    QFETCH(int, threadCount);
+    const int eventsPerThread = 100000;
+
+    QBENCHMARK {
+        CountingReceiver receiver;
+        receiver.expected = threadCount * eventsPerThread;
+        QList<PostingThread *> threads;
+        for (int i = 0; i < threadCount; ++i)
+            threads.append(new PostingThread(&receiver, eventsPerThread));
+        foreach (PostingThread *thread, threads)
+            thread->start();
+        QTestEventLoop::instance().enterLoop(60);
+        foreach (PostingThread *thread, threads)
+            thread->wait();
+        qDeleteAll(threads);
+        QVERIFY(receiver.received == receiver.expected);
+    }
+}
+
 QTEST_MAIN(EventsBench)
 
 #include "moc_main.cpp"
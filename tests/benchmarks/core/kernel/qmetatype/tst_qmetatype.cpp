@@ -21,6 +21,8 @@
 
 #include <qtest.h>
 #include <QtCore/qmetatype.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qvector.h>
 
 QT_USE_NAMESPACE
 
@@ -41,6 +43,7 @@ private slots:
     void typeBuiltinNotNormalized();
     void typeCustom();
     void typeCustomNotNormalized();
+    void typeCustomMany();
     void typeNotRegistered();
     void typeNotRegisteredNotNormalized();
 
@@ -58,6 +61,9 @@ private slots:
     void constructCoreType();
     void constructCoreTypeCopy_data();
     void constructCoreTypeCopy();
+
+    void customContended_data();
+    void customContended();
 };
 
 tst_QMetaType::tst_QMetaType()
@@ -128,6 +134,19 @@ void tst_QMetaType::typeCustomNotNormalized()
     }
 }
 
+// lookups should not depend on the number of registered types
+void tst_QMetaType::typeCustomMany()
+{
+    for (int i = 0; i < 1000; ++i) {
+        const QByteArray name = "Many" + QByteArray::number(i);
+        qRegisterMetaType<Foo>(name.constData());
+    }
+    QBENCHMARK {
+        for (int i = 0; i < 10000; ++i)
+            QMetaType::type("Many999");
+    }
+}
+
 void tst_QMetaType::typeNotRegistered()
 {
     Q_ASSERT(QMetaType::type("Bar") == 0);
@@ -263,6 +282,53 @@ void tst_QMetaType::constructCoreTypeCopy()
     }
 }
 
+class CustomLookupThread : public QThread
+{
+public:
+    CustomLookupThread(int typeId) : typeId(typeId) { }
+
+    void run()
+    {
+        for (int i = 0; i < 10000; ++i) {
+            QMetaType::type("Foo");
+            QMetaType::typeName(typeId);
+            void *data = QMetaType::construct(typeId);
+            QMetaType::destroy(typeId, data);
+        }
+    }
+
+private:
+    const int typeId;
+};
+
+void tst_QMetaType::customContended_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+// the custom types registry is read from every thread
+void tst_QMetaType::customContended()
+{
+    QFETCH(int, threadCount);
+    const int typeId = qRegisterMetaType<Foo>("Foo");
+    QBENCHMARK {
+        QVector<CustomLookupThread*> threads;
+        for (int i = 0; i < threadCount; ++i) {
+            threads.append(new CustomLookupThread(typeId));
+            threads.last()->start();
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            threads.at(i)->wait();
+        }
+        qDeleteAll(threads);
+    }
+}
+
 QTEST_MAIN(tst_QMetaType)
 
 #include "moc_tst_qmetatype.cpp"
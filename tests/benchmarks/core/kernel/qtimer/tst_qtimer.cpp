@@ -0,0 +1,122 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=
+
+static const int idleTimerCount = 50000;
+
+class TimerCounter : public QObject
+{
+public:
+    TimerCounter() : fired(0) { }
+
+    int fired;
+
+protected:
+    void timerEvent(QTimerEvent *)
+    {
+        fired++;
+    }
+};
+
+class tst_QTimer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void startStop();
+    void restart();
+    void activate_data();
+    void activate();
+};
+
+// idle timers such as per-connection timeouts, they never fire while benchmarked
+static QList<QTimer*> startIdleTimers(int count)
+{
+    QList<QTimer*> timers;
+    for (int i = 0; i < count; ++i) {
+        QTimer *timer = new QTimer();
+        timer->start(600000 + (i % 1000) * 10);
+        timers.append(timer);
+    }
+    return timers;
+}
+
+void tst_QTimer::startStop()
+{
+    QBENCHMARK {
+        QList<QTimer*> timers = startIdleTimers(idleTimerCount);
+        qDeleteAll(timers);
+    }
+}
+
+void tst_QTimer::restart()
+{
+    QList<QTimer*> timers = startIdleTimers(idleTimerCount);
+    QBENCHMARK {
+        // what an idle timeout does whenever its connection sees activity
+        foreach (QTimer *timer, timers) {
+            timer->start();
+        }
+    }
+    qDeleteAll(timers);
+}
+
+void tst_QTimer::activate_data()
+{
+    QTest::addColumn<int>("idleCount");
+
+    QTest::newRow("no idle timers") << 0;
+    QTest::newRow("1000 idle timers") << 1000;
+    QTest::newRow("50000 idle timers") << idleTimerCount;
+}
+
+void tst_QTimer::activate()
+{
+    QFETCH(int, idleCount);
+
+    QList<QTimer*> timers = startIdleTimers(idleCount);
+    TimerCounter counter;
+    QList<int> timerIds;
+    for (int i = 0; i < 100; ++i) {
+        timerIds.append(counter.startTimer(0));
+    }
+
+    QBENCHMARK {
+        counter.fired = 0;
+        while (counter.fired < 10000) {
+            QCoreApplication::processEvents();
+        }
+    }
+
+    foreach (int timerId, timerIds) {
+        counter.killTimer(timerId);
+    }
+    qDeleteAll(timers);
+}
+
+QTEST_MAIN(tst_QTimer)
+
+#include "moc_tst_qtimer.cpp"
@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=
+
+static const int translationsPerThread = 100000;
+
+class tst_QTranslator : public QObject
+{
+    Q_OBJECT
+
+public:
+    // barriers for the concurrent tests
+    static QSemaphore semaphore1, semaphore2, semaphore3, semaphore4;
+
+private slots:
+    void initTestCase();
+
+    void translate_data();
+    void translate();
+    void concurrent_data();
+    void concurrent();
+
+private:
+    QTranslator translator;
+};
+
+QSemaphore tst_QTranslator::semaphore1;
+QSemaphore tst_QTranslator::semaphore2;
+QSemaphore tst_QTranslator::semaphore3;
+QSemaphore tst_QTranslator::semaphore4;
+
+void tst_QTranslator::initTestCase()
+{
+    QFile trfile(SRCDIR "../../../../auto/qtranslator/test.tr");
+    QVERIFY(trfile.open(QFile::ReadOnly));
+    QVERIFY(translator.loadFromData(trfile.readAll()));
+}
+
+void tst_QTranslator::translate_data()
+{
+    QTest::addColumn<QByteArray>("context");
+    QTest::addColumn<QByteArray>("sourceText");
+
+    QTest::newRow("hit") << QByteArray() << QByteArray("foo");
+    QTest::newRow("hit with context") << QByteArray("foo") << QByteArray("bar");
+    QTest::newRow("miss") << QByteArray("baz") << QByteArray("Untranslated text");
+}
+
+void tst_QTranslator::translate()
+{
+    QFETCH(QByteArray, context);
+    QFETCH(QByteArray, sourceText);
+
+    QBENCHMARK {
+        translator.translate(context.constData(), sourceText.constData());
+    }
+}
+
+class TranslatorThread : public QThread
+{
+    const QTranslator *translator;
+public:
+    bool done;
+    int failures;
+    TranslatorThread(const QTranslator *translator)
+        : translator(translator), done(false), failures(0)
+    { }
+    void run() {
+        const QString foo = QString::fromUtf8("фоо");
+        const QString bar = QString::fromUtf8("фообар");
+        forever {
+            tst_QTranslator::semaphore1.release();
+            tst_QTranslator::semaphore2.acquire();
+            if (done)
+                break;
+            for (int i = 0; i < translationsPerThread; ++i) {
+                if (translator->translate(nullptr, "foo") != foo)
+                    failures++;
+                if (translator->translate("foo", "bar") != bar)
+                    failures++;
+            }
+            tst_QTranslator::semaphore3.release();
+            tst_QTranslator::semaphore4.acquire();
+        }
+    }
+};
+
+void tst_QTranslator::concurrent_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+    QTest::newRow("16 threads") << 16;
+}
+
+void tst_QTranslator::concurrent()
+{
+    QFETCH(int, threadCount);
+
+    QVector<TranslatorThread *> threads(threadCount);
+    for (int i = 0; i < threads.count(); ++i) {
+        threads[i] = new TranslatorThread(&translator);
+        threads[i]->start();
+    }
+
+    QBENCHMARK {
+        semaphore1.acquire(threadCount);
+        semaphore2.release(threadCount);
+        semaphore3.acquire(threadCount);
+        semaphore4.release(threadCount);
+    }
+
+    for (int i = 0; i < threads.count(); ++i)
+        threads[i]->done = true;
+    semaphore1.acquire(threadCount);
+    semaphore2.release(threadCount);
+    int failures = 0;
+    for (int i = 0; i < threads.count(); ++i) {
+        threads[i]->wait();
+        failures += threads[i]->failures;
+    }
+    qDeleteAll(threads);
+
+    QCOMPARE(failures, 0);
+}
+
+QTEST_MAIN(tst_QTranslator)
+
+#include "moc_tst_qtranslator.cpp"
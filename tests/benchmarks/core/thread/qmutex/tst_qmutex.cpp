@@ -24,6 +24,7 @@
 
 #include <math.h>
 #include <pthread.h>
+#include <mutex>
 
 typedef pthread_mutex_t NativeMutexType;
 void NativeMutexInitialize(NativeMutexType *mutex)
@@ -81,6 +82,9 @@ private slots:
     void contendedNative();
     void contendedQMutex();
     void contendedQMutexLocker();
+
+    void shortSections_data();
+    void shortSections();
 };
 
 QSemaphore tst_QMutex::semaphore1;
@@ -396,6 +400,126 @@ void tst_QMutex::contendedQMutexLocker()
     qDeleteAll(threads);
 }
 
+// the mutex QMutex wrapped before it was implemented on top of futexes
+class TimedMutex
+{
+public:
+    inline void lock() { mutex.lock(); }
+    inline void unlock() { mutex.unlock(); }
+
+private:
+    std::timed_mutex mutex;
+};
+
+class NativeMutex
+{
+public:
+    inline NativeMutex() { NativeMutexInitialize(&mutex); }
+    inline ~NativeMutex() { NativeMutexDestroy(&mutex); }
+    inline void lock() { NativeMutexLock(&mutex); }
+    inline void unlock() { NativeMutexUnlock(&mutex); }
+
+private:
+    NativeMutexType mutex;
+};
+
+enum MutexKind {
+    QMutexKind,
+    TimedMutexKind,
+    NativeMutexKind
+};
+Q_DECLARE_METATYPE(MutexKind)
+
+void tst_QMutex::shortSections_data()
+{
+    QTest::addColumn<MutexKind>("kind");
+    QTest::addColumn<int>("threads");
+
+    static const struct {
+        const char *name;
+        MutexKind kind;
+    } types[] = {
+        { "QMutex", QMutexKind },
+        { "std::timed_mutex", TimedMutexKind },
+        { "pthread_mutex_t", NativeMutexKind }
+    };
+    for (int i = 0; i < 3; ++i) {
+        for (int threads = 1; threads <= 64; threads *= 2) {
+            QTest::newRow(QByteArray(types[i].name) + ", " + QByteArray::number(threads) + " threads")
+                << types[i].kind << threads;
+        }
+    }
+}
+
+// each thread locks the mutex for a few hundred nanoseconds at a time, like
+// the signal/slot, posted event and thread pool locks do
+template <typename Mutex>
+class ShortSectionThread : public QThread
+{
+public:
+    ShortSectionThread(Mutex *mutex, qint64 *counter, int iterations)
+        : mutex(mutex), counter(counter), iterations(iterations)
+    { }
+
+    void run() {
+        for (int i = 0; i < iterations; ++i) {
+            mutex->lock();
+            for (int j = 0; j < 50; ++j) {
+                ++*counter;
+            }
+            mutex->unlock();
+        }
+    }
+
+private:
+    Mutex *mutex;
+    qint64 *counter;
+    const int iterations;
+};
+
+template <typename Mutex>
+static qint64 runShortSections(int threadCount)
+{
+    static const int totalIterations = 200000;
+    Mutex mutex;
+    qint64 counter = 0;
+    QVector<ShortSectionThread<Mutex> *> threads(threadCount);
+    for (int i = 0; i < threadCount; ++i) {
+        threads[i] = new ShortSectionThread<Mutex>(&mutex, &counter, totalIterations / threadCount);
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        threads[i]->start();
+    }
+    for (int i = 0; i < threadCount; ++i) {
+        threads[i]->wait();
+    }
+    qDeleteAll(threads);
+    return counter;
+}
+
+void tst_QMutex::shortSections()
+{
+    QFETCH(MutexKind, kind);
+    QFETCH(int, threads);
+
+    const qint64 expected = qint64(200000 / threads) * threads * 50;
+    qint64 counter = 0;
+    QBENCHMARK {
+        switch (kind) {
+            case QMutexKind:
+                counter = runShortSections<QMutex>(threads);
+                break;
+            case TimedMutexKind:
+                counter = runShortSections<TimedMutex>(threads);
+                break;
+            case NativeMutexKind:
+                counter = runShortSections<NativeMutex>(threads);
+                break;
+        }
+    }
+    QCOMPARE(counter, expected);
+}
+
 QTEST_MAIN(tst_QMutex)
 
 #include "moc_tst_qmutex.cpp"
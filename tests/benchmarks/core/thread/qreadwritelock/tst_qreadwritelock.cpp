@@ -0,0 +1,158 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=
+
+static const int lookupsPerThread = 100000;
+
+// read-mostly registry, one write every writeInterval lookups
+class Registry
+{
+public:
+    Registry()
+    {
+        for (int i = 0; i < 64; ++i) {
+            hash.insert(QByteArray::number(i), i);
+        }
+    }
+
+    QMutex mutex;
+    QReadWriteLock lock;
+    QHash<QByteArray, int> hash;
+};
+
+class RegistryThread : public QThread
+{
+public:
+    RegistryThread(Registry *registry, bool useReadWriteLock, int writeInterval)
+        : registry(registry), useReadWriteLock(useReadWriteLock), writeInterval(writeInterval)
+    { }
+
+    void run()
+    {
+        const QByteArray keys[4] = { "1", "13", "42", "63" };
+        for (int i = 0; i < lookupsPerThread; ++i) {
+            const QByteArray &key = keys[i % 4];
+            const bool write = (writeInterval > 0 && (i % writeInterval) == 0);
+            if (useReadWriteLock) {
+                if (write) {
+                    QWriteLocker locker(&registry->lock);
+                    registry->hash.insert(key, i);
+                } else {
+                    QReadLocker locker(&registry->lock);
+                    (void)registry->hash.value(key);
+                }
+            } else {
+                QMutexLocker locker(&registry->mutex);
+                if (write) {
+                    registry->hash.insert(key, i);
+                } else {
+                    (void)registry->hash.value(key);
+                }
+            }
+        }
+    }
+
+private:
+    Registry *registry;
+    const bool useReadWriteLock;
+    const int writeInterval;
+};
+
+class tst_QReadWriteLock : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void uncontendedRead();
+    void uncontendedWrite();
+
+    void contended_data();
+    void contended();
+};
+
+void tst_QReadWriteLock::uncontendedRead()
+{
+    QReadWriteLock lock;
+    QBENCHMARK {
+        for (int i = 0; i < lookupsPerThread; ++i) {
+            QReadLocker locker(&lock);
+        }
+    }
+}
+
+void tst_QReadWriteLock::uncontendedWrite()
+{
+    QReadWriteLock lock;
+    QBENCHMARK {
+        for (int i = 0; i < lookupsPerThread; ++i) {
+            QWriteLocker locker(&lock);
+        }
+    }
+}
+
+void tst_QReadWriteLock::contended_data()
+{
+    QTest::addColumn<int>("threadCount");
+    QTest::addColumn<bool>("useReadWriteLock");
+    QTest::addColumn<int>("writeInterval");
+
+    const int threadCounts[] = { 1, 2, 4, 8, 16 };
+    for (int i = 0; i < 5; ++i) {
+        const int threadCount = threadCounts[i];
+        QTest::newRow(QByteArray::number(threadCount) + " threads, QMutex, read only")
+            << threadCount << false << 0;
+        QTest::newRow(QByteArray::number(threadCount) + " threads, QReadWriteLock, read only")
+            << threadCount << true << 0;
+        QTest::newRow(QByteArray::number(threadCount) + " threads, QMutex, 1% writes")
+            << threadCount << false << 100;
+        QTest::newRow(QByteArray::number(threadCount) + " threads, QReadWriteLock, 1% writes")
+            << threadCount << true << 100;
+    }
+}
+
+void tst_QReadWriteLock::contended()
+{
+    QFETCH(int, threadCount);
+    QFETCH(bool, useReadWriteLock);
+    QFETCH(int, writeInterval);
+
+    Registry registry;
+    QBENCHMARK {
+        QVector<RegistryThread*> threads;
+        for (int i = 0; i < threadCount; ++i) {
+            threads.append(new RegistryThread(&registry, useReadWriteLock, writeInterval));
+            threads.last()->start();
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            threads.at(i)->wait();
+        }
+        qDeleteAll(threads);
+    }
+}
+
+QTEST_MAIN(tst_QReadWriteLock)
+
+#include "moc_tst_qreadwritelock.cpp"
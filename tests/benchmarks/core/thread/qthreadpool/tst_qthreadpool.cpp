@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=
+
+static const int runnableCount = 1000000;
+
+static QAtomicInt counter(0);
+
+class TinyRunnable : public QRunnable
+{
+public:
+    void run()
+    {
+        counter.ref();
+    }
+};
+
+// starts the tiny runnables from a pool thread
+class SpawningRunnable : public QRunnable
+{
+public:
+    SpawningRunnable(QThreadPool *pool, int count) : pool(pool), count(count) { }
+
+    void run()
+    {
+        for (int i = 0; i < count; ++i) {
+            pool->start(new TinyRunnable());
+        }
+    }
+
+private:
+    QThreadPool *pool;
+    const int count;
+};
+
+class tst_QThreadPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tinyRunnables_data();
+    void tinyRunnables();
+    void tinyRunnablesFromPoolThreads_data();
+    void tinyRunnablesFromPoolThreads();
+    void prioritizedRunnables();
+};
+
+void tst_QThreadPool::tinyRunnables_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    const int threadCounts[] = { 1, 2, 4, 8, 16, 32 };
+    for (int i = 0; i < 6; ++i) {
+        QTest::newRow(QByteArray::number(threadCounts[i]) + " threads") << threadCounts[i];
+    }
+}
+
+void tst_QThreadPool::tinyRunnables()
+{
+    QFETCH(int, threadCount);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount);
+    QBENCHMARK {
+        counter = 0;
+        for (int i = 0; i < runnableCount; ++i) {
+            pool.start(new TinyRunnable());
+        }
+        pool.waitForDone();
+    }
+    QCOMPARE(int(counter), runnableCount);
+}
+
+void tst_QThreadPool::tinyRunnablesFromPoolThreads_data()
+{
+    tinyRunnables_data();
+}
+
+void tst_QThreadPool::tinyRunnablesFromPoolThreads()
+{
+    QFETCH(int, threadCount);
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount);
+    QBENCHMARK {
+        counter = 0;
+        for (int i = 0; i < threadCount; ++i) {
+            pool.start(new SpawningRunnable(&pool, runnableCount / threadCount));
+        }
+        pool.waitForDone();
+    }
+    QCOMPARE(int(counter), (runnableCount / threadCount) * threadCount);
+}
+
+void tst_QThreadPool::prioritizedRunnables()
+{
+    QThreadPool pool;
+    QBENCHMARK {
+        counter = 0;
+        for (int i = 0; i < runnableCount / 10; ++i) {
+            pool.start(new TinyRunnable(), i % 3);
+        }
+        pool.waitForDone();
+    }
+    QCOMPARE(int(counter), runnableCount / 10);
+}
+
+QTEST_MAIN(tst_QThreadPool)
+
+#include "moc_tst_qthreadpool.cpp"
@@ -67,4 +67,17 @@ uint qHash(const String &str)
     return h;
 }
 
+uint qHash(const ElfString &str)
+{
+    const QChar *p = str.unicode();
+    int n = str.size();
+    uint h = 0;
+    while (n--) {
+        h = (h << 4) + (*p++).unicode();
+        h ^= (h & 0xf0000000) >> 23;
+        h &= 0x0fffffff;
+    }
+    return h;
+}
+
 QT_END_NAMESPACE
@@ -53,6 +53,7 @@ Totals: 4 passed, 0 failed, 0 skipped
 #include <QString>
 #include <QStringList>
 #include <QTest>
+#include <QVector>
 
 class tst_QHash : public QObject
 {
@@ -67,8 +68,17 @@ private slots:
     void qhash_vs_qchecksum_data();
     void qhash_vs_qchecksum();
 
+    void insert_data();
+    void insert();
+    void lookup_data();
+    void lookup();
+    void chains_data();
+    void chains();
+
 private:
     QString data();
+    void keys_data();
+    QStringList keys(const QByteArray &kind);
 };
 
 const int N = 1000000;
@@ -156,6 +166,156 @@ void tst_QHash::qhash_vs_qchecksum()
     }
 }
 
+///////////////////// realistic keys /////////////////////
+
+void tst_QHash::keys_data()
+{
+    QTest::addColumn<QByteArray>("kind");
+    QTest::addColumn<bool>("elf");
+
+    QTest::newRow("urls, xxh3") << QByteArray("urls") << false;
+    QTest::newRow("urls, elf") << QByteArray("urls") << true;
+    QTest::newRow("paths, xxh3") << QByteArray("paths") << false;
+    QTest::newRow("paths, elf") << QByteArray("paths") << true;
+    QTest::newRow("identifiers, xxh3") << QByteArray("identifiers") << false;
+    QTest::newRow("identifiers, elf") << QByteArray("identifiers") << true;
+}
+
+QStringList tst_QHash::keys(const QByteArray &kind)
+{
+    static const char* const hosts[] = {
+        "www.example.com", "api.example.org", "cdn.katie-project.net",
+        "mirror.kernel.org", "static.example.co.uk"
+    };
+    static const char* const dirs[] = {
+        "usr/share/icons/hicolor", "usr/lib/katie/plugins", "home/user/.cache",
+        "usr/include/katie/QtCore", "var/lib/dpkg/info"
+    };
+    static const char* const words[] = {
+        "current", "item", "model", "index", "widget", "value", "parent",
+        "child", "layout", "size", "hint", "changed", "row", "column"
+    };
+
+    QStringList result;
+    for (int i = 0; i < 20000; i++) {
+        if (kind == "urls") {
+            result.append(QString::fromLatin1("https://%1/v%2/resource/%3?page=%4")
+                .arg(QLatin1String(hosts[i % 5])).arg(i % 3).arg(i).arg(i % 17));
+        } else if (kind == "paths") {
+            result.append(QString::fromLatin1("/%1/%2/file_%3.png")
+                .arg(QLatin1String(dirs[i % 5])).arg(i / 100).arg(i));
+        } else {
+            result.append(QString::fromLatin1("%1%2%3")
+                .arg(QLatin1String(words[i % 14])).arg(QLatin1String(words[(i / 14) % 14]))
+                .arg(i / 196));
+        }
+    }
+    return result;
+}
+
+template <typename T>
+static void insertKeys(const QStringList &items)
+{
+    QList<T> keys;
+    foreach (const QString &s, items)
+        keys.append(s);
+
+    QBENCHMARK {
+        QHash<T, int> hash;
+        for (int i = 0, n = keys.size(); i != n; ++i) {
+            hash.insert(keys.at(i), i);
+        }
+    }
+}
+
+template <typename T>
+static void lookupKeys(const QStringList &items)
+{
+    QList<T> keys;
+    foreach (const QString &s, items)
+        keys.append(s);
+    QHash<T, int> hash;
+    for (int i = 0, n = keys.size(); i != n; ++i) {
+        hash.insert(keys.at(i), i);
+    }
+
+    int found = 0;
+    QBENCHMARK {
+        for (int i = 0, n = keys.size(); i != n; ++i) {
+            found += hash.contains(keys.at(i));
+        }
+    }
+    QVERIFY(found > 0);
+}
+
+// longest bucket chain for the keys in a table with the given number of buckets
+template <typename T>
+static int longestChain(const QStringList &items, int buckets)
+{
+    QVector<int> chains(buckets, 0);
+    int longest = 0;
+    foreach (const QString &s, items) {
+        const int chain = ++chains[qHash(T(s)) % buckets];
+        longest = qMax(longest, chain);
+    }
+    return longest;
+}
+
+void tst_QHash::insert_data()
+{
+    keys_data();
+}
+
+void tst_QHash::insert()
+{
+    QFETCH(QByteArray, kind);
+    QFETCH(bool, elf);
+
+    const QStringList items = keys(kind);
+    if (elf) {
+        insertKeys<ElfString>(items);
+    } else {
+        insertKeys<QString>(items);
+    }
+}
+
+void tst_QHash::lookup_data()
+{
+    keys_data();
+}
+
+void tst_QHash::lookup()
+{
+    QFETCH(QByteArray, kind);
+    QFETCH(bool, elf);
+
+    const QStringList items = keys(kind);
+    if (elf) {
+        lookupKeys<ElfString>(items);
+    } else {
+        lookupKeys<QString>(items);
+    }
+}
+
+void tst_QHash::chains_data()
+{
+    keys_data();
+}
+
+void tst_QHash::chains()
+{
+    QFETCH(QByteArray, kind);
+    QFETCH(bool, elf);
+
+    const QStringList items = keys(kind);
+    QHash<QString, int> hash;
+    hash.reserve(items.size());
+    const int buckets = hash.capacity();
+    const int longest = elf ? longestChain<ElfString>(items, buckets)
+        : longestChain<QString>(items, buckets);
+    QTest::setBenchmarkResult(longest, QTest::Events);
+}
+
 QTEST_MAIN(tst_QHash)
 
 #include "moc_qhash_string.cpp"
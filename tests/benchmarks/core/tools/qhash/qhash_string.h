@@ -32,8 +32,16 @@ struct String : QString
     String(const QString &s) : QString(s) {}
 };
 
+// hashed with the Peter J. Weinberger's function qHash() used before XXH3
+struct ElfString : QString
+{
+    ElfString() {}
+    ElfString(const QString &s) : QString(s) {}
+};
+
 QT_BEGIN_NAMESPACE
 uint qHash(const String &);
+uint qHash(const ElfString &);
 QT_END_NAMESPACE
 
 #endif
@@ -0,0 +1,198 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+QT_USE_NAMESPACE
+
+//TESTED_FILES=qjsondocument.cpp,qjsonstream.cpp
+
+class tst_QJsonDocument : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void fromJson_data();
+    void fromJson();
+    void fromVariant_data();
+    void fromVariant();
+    void streamReader_data() { fromJson_data(); }
+    void streamReader();
+    void streamWriter_data() { fromVariant_data(); }
+    void streamWriter();
+};
+
+static void reportThroughput(const int size, const int runs, const qint64 elapsed)
+{
+    if (elapsed > 0) {
+        const double megabytes = (double(size) * runs) / (1024.0 * 1024.0);
+        qDebug("%.2f MB/s", megabytes / (double(elapsed) / 1000000000.0));
+    }
+}
+
+static QVariantMap flatDocument(int count)
+{
+    QVariantMap result;
+    for (int i = 0; i < count; i++) {
+        const QString key = QString::fromLatin1("key%1").arg(i);
+        switch (i % 4) {
+            case 0: {
+                result.insert(key, QString::fromLatin1("value %1").arg(i));
+                break;
+            }
+            case 1: {
+                result.insert(key, i);
+                break;
+            }
+            case 2: {
+                result.insert(key, double(i) / 3.0);
+                break;
+            }
+            case 3: {
+                result.insert(key, bool(i % 2));
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static QVariantMap nestedDocument(int depth, int width)
+{
+    QVariantMap result = flatDocument(8);
+    if (depth > 0) {
+        QVariantList children;
+        for (int i = 0; i < width; i++) {
+            children.append(nestedDocument(depth - 1, width));
+        }
+        result.insert(QLatin1String("children"), children);
+    }
+    return result;
+}
+
+void tst_QJsonDocument::fromJson_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    const QByteArray flat = QJsonDocument::fromVariant(flatDocument(100000)).toJson();
+    const QByteArray nested = QJsonDocument::fromVariant(nestedDocument(7, 3)).toJson();
+    const QByteArray deep = QJsonDocument::fromVariant(nestedDocument(200, 1)).toJson();
+    qDebug("flat: %d bytes, nested: %d bytes, deep: %d bytes", flat.size(), nested.size(), deep.size());
+
+    QTest::newRow("flat") << flat;
+    QTest::newRow("nested") << nested;
+    QTest::newRow("deep") << deep;
+}
+
+void tst_QJsonDocument::fromJson()
+{
+    QFETCH(QByteArray, json);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int runs = 0;
+    QBENCHMARK {
+        timer.start();
+        QJsonDocument jsondoc = QJsonDocument::fromJson(json);
+        elapsed += timer.nsecsElapsed();
+        runs++;
+        Q_UNUSED(jsondoc);
+    }
+    reportThroughput(json.size(), runs, elapsed);
+}
+
+void tst_QJsonDocument::fromVariant_data()
+{
+    QTest::addColumn<QVariant>("variant");
+
+    QTest::newRow("flat") << QVariant(flatDocument(100000));
+    QTest::newRow("nested") << QVariant(nestedDocument(7, 3));
+    QTest::newRow("deep") << QVariant(nestedDocument(200, 1));
+}
+
+void tst_QJsonDocument::fromVariant()
+{
+    QFETCH(QVariant, variant);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int runs = 0;
+    int size = 0;
+    QBENCHMARK {
+        timer.start();
+        QJsonDocument jsondoc = QJsonDocument::fromVariant(variant);
+        elapsed += timer.nsecsElapsed();
+        runs++;
+        size = jsondoc.toJson().size();
+    }
+    reportThroughput(size, runs, elapsed);
+}
+
+void tst_QJsonDocument::streamReader()
+{
+    QFETCH(QByteArray, json);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int runs = 0;
+    QBENCHMARK {
+        timer.start();
+        QBuffer buffer(&json);
+        buffer.open(QIODevice::ReadOnly);
+        QJsonStreamReader reader(&buffer);
+        while (!reader.atEnd()) {
+            reader.readNext();
+        }
+        elapsed += timer.nsecsElapsed();
+        runs++;
+        QVERIFY(!reader.hasError());
+    }
+    reportThroughput(json.size(), runs, elapsed);
+}
+
+void tst_QJsonDocument::streamWriter()
+{
+    QFETCH(QVariant, variant);
+
+    QElapsedTimer timer;
+    qint64 elapsed = 0;
+    int runs = 0;
+    int size = 0;
+    QBENCHMARK {
+        timer.start();
+        QByteArray json;
+        QBuffer buffer(&json);
+        buffer.open(QIODevice::WriteOnly);
+        QJsonStreamWriter writer(&buffer);
+        writer.setAutoFormatting(true);
+        writer.writeValue(variant);
+        writer.flush();
+        elapsed += timer.nsecsElapsed();
+        runs++;
+        size = json.size();
+    }
+    reportThroughput(size, runs, elapsed);
+}
+
+QTEST_MAIN(tst_QJsonDocument)
+
+#include "moc_tst_qjsondocument.cpp"
@@ -0,0 +1,283 @@
+/****************************************************************************
+**
+** Copyright (C) 2022 Ivailo Monev
+**
+** This file is part of the test suite of the Katie Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+**
+** GNU Lesser General Public License Usage
+** This file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QLocale>
+#include <QStringList>
+#include <QDateTime>
+#include <qtest.h>
+
+QT_USE_NAMESPACE
+
+// values as found in measurements, prices and coordinates exports
+static QList<double> generateDoubles()
+{
+    QList<double> result;
+    qsrand(4);
+    for (int i = 0; i < 1000; i++) {
+        switch (i % 4) {
+            case 0:
+                result.append(double(qrand() % 100000) / 100.0);
+                break;
+            case 1:
+                result.append(double(qrand()) / double(RAND_MAX) * 360.0 - 180.0);
+                break;
+            case 2:
+                result.append(double(qrand()) * 1e-9);
+                break;
+            case 3:
+                result.append(double(qrand()) * double(qrand()));
+                break;
+        }
+    }
+    return result;
+}
+
+static QList<qlonglong> generateIntegers()
+{
+    QList<qlonglong> result;
+    qsrand(4);
+    for (int i = 0; i < 1000; i++) {
+        result.append(qlonglong(qrand()) * (i % 3 == 0 ? qrand() : 1) * (i % 2 ? 1 : -1));
+    }
+    return result;
+}
+
+class tst_qlocale : public QObject
+{
+    Q_OBJECT
+private slots:
+    void numberInteger();
+    void numberDouble_data();
+    void numberDouble();
+    void byteArrayNumberDouble();
+    void toStringGrouped_data();
+    void toStringGrouped();
+    void toInt();
+    void toDouble_data();
+    void toDouble();
+    void byteArrayToDouble();
+    void localeToDouble();
+    void constructByName();
+    void constructByLanguage();
+    void monthAndDayNames();
+    void dateTimeToString_data();
+    void dateTimeToString();
+};
+
+void tst_qlocale::numberInteger()
+{
+    const QList<qlonglong> values = generateIntegers();
+    QBENCHMARK {
+        foreach (const qlonglong value, values) {
+            QString::number(value);
+        }
+    }
+}
+
+void tst_qlocale::numberDouble_data()
+{
+    QTest::addColumn<char>("format");
+    QTest::addColumn<int>("precision");
+
+    QTest::newRow("'g', 6") << 'g' << 6;
+    QTest::newRow("'g', 17") << 'g' << 17;
+    QTest::newRow("'f', 2") << 'f' << 2;
+    QTest::newRow("'e', 6") << 'e' << 6;
+    QTest::newRow("'g', shortest") << 'g' << int(QLocale::FloatingPointShortest);
+}
+
+void tst_qlocale::numberDouble()
+{
+    QFETCH(char, format);
+    QFETCH(int, precision);
+
+    const QList<double> values = generateDoubles();
+    QBENCHMARK {
+        foreach (const double value, values) {
+            QString::number(value, format, precision);
+        }
+    }
+}
+
+void tst_qlocale::byteArrayNumberDouble()
+{
+    const QList<double> values = generateDoubles();
+    QBENCHMARK {
+        foreach (const double value, values) {
+            QByteArray::number(value, 'g', QLocale::FloatingPointShortest);
+        }
+    }
+}
+
+void tst_qlocale::toStringGrouped_data()
+{
+    QTest::addColumn<QLocale>("locale");
+
+    QTest::newRow("C") << QLocale::c();
+    QTest::newRow("German") << QLocale(QLocale::German, QLocale::Germany);
+    QTest::newRow("French") << QLocale(QLocale::French, QLocale::France);
+}
+
+void tst_qlocale::toStringGrouped()
+{
+    QFETCH(QLocale, locale);
+
+    const QList<qlonglong> integers = generateIntegers();
+    const QList<double> doubles = generateDoubles();
+    QBENCHMARK {
+        foreach (const qlonglong value, integers) {
+            locale.toString(value);
+        }
+        foreach (const double value, doubles) {
+            locale.toString(value, 'f', 2);
+        }
+    }
+}
+
+void tst_qlocale::toInt()
+{
+    QStringList strings;
+    foreach (const qlonglong value, generateIntegers()) {
+        strings.append(QString::number(int(value)));
+    }
+    QBENCHMARK {
+        foreach (const QString &string, strings) {
+            string.toInt();
+        }
+    }
+}
+
+void tst_qlocale::toDouble_data()
+{
+    QTest::addColumn<char>("format");
+    QTest::addColumn<int>("precision");
+
+    QTest::newRow("'g', 6") << 'g' << 6;
+    QTest::newRow("'g', 17") << 'g' << 17;
+    QTest::newRow("'f', 2") << 'f' << 2;
+}
+
+void tst_qlocale::toDouble()
+{
+    QFETCH(char, format);
+    QFETCH(int, precision);
+
+    QStringList strings;
+    foreach (const double value, generateDoubles()) {
+        strings.append(QString::number(value, format, precision));
+    }
+    QBENCHMARK {
+        foreach (const QString &string, strings) {
+            string.toDouble();
+        }
+    }
+}
+
+void tst_qlocale::byteArrayToDouble()
+{
+    QList<QByteArray> strings;
+    foreach (const double value, generateDoubles()) {
+        strings.append(QByteArray::number(value, 'g', 17));
+    }
+    QBENCHMARK {
+        foreach (const QByteArray &string, strings) {
+            string.toDouble();
+        }
+    }
+}
+
+void tst_qlocale::localeToDouble()
+{
+    const QLocale locale(QLocale::German, QLocale::Germany);
+    QStringList strings;
+    foreach (const double value, generateDoubles()) {
+        strings.append(locale.toString(value, 'f', 2));
+    }
+    QBENCHMARK {
+        foreach (const QString &string, strings) {
+            locale.toDouble(string);
+        }
+    }
+}
+
+void tst_qlocale::constructByName()
+{
+    const QStringList names = QStringList()
+        << QLatin1String("en_US") << QLatin1String("de_DE") << QLatin1String("fr_FR")
+        << QLatin1String("zh_Hant_TW") << QLatin1String("sr_Latn_RS") << QLatin1String("pt_BR")
+        << QLatin1String("iw_IL") << QLatin1String("ja") << QLatin1String("es_419")
+        << QLatin1String("uk_UA.UTF-8");
+    QBENCHMARK {
+        foreach (const QString &name, names) {
+            QLocale locale(name);
+        }
+    }
+}
+
+void tst_qlocale::constructByLanguage()
+{
+    QBENCHMARK {
+        for (int i = QLocale::C; i <= QLocale::LastLanguage; i += 7) {
+            QLocale locale(QLocale::Language(i), QLocale::AnyCountry);
+        }
+    }
+}
+
+void tst_qlocale::monthAndDayNames()
+{
+    const QLocale locale(QLocale::German, QLocale::Germany);
+    QBENCHMARK {
+        for (int i = 1; i <= 12; i++) {
+            locale.monthName(i, QLocale::LongFormat);
+            locale.monthName(i, QLocale::ShortFormat);
+            locale.standaloneMonthName(i, QLocale::LongFormat);
+        }
+        for (int i = 1; i <= 7; i++) {
+            locale.dayName(i, QLocale::LongFormat);
+            locale.dayName(i, QLocale::ShortFormat);
+        }
+        locale.amText();
+        locale.pmText();
+    }
+}
+
+void tst_qlocale::dateTimeToString_data()
+{
+    QTest::addColumn<QString>("format");
+
+    QTest::newRow("ISO like") << QString::fromLatin1("yyyy-MM-dd HH:mm:ss.zzz");
+    QTest::newRow("names") << QString::fromLatin1("ddd, d MMM yyyy hh:mm:ss AP");
+}
+
+void tst_qlocale::dateTimeToString()
+{
+    QFETCH(QString, format);
+
+    const QDateTime datetime(QDate(2022, 11, 27), QTime(13, 37, 42, 123));
+    QBENCHMARK {
+        for (int i = 0; i < 100; i++) {
+            datetime.toString(format);
+        }
+    }
+}
+
+QTEST_MAIN(tst_qlocale)
+
+#include "moc_main.cpp"
@@ -21,6 +21,8 @@
 #include <qtest.h>
 #include <QDebug>
 #include <QFile>
+#include <QDir>
+#include <QCoreApplication>
 #include <QIcon>
 #include <QPixmap>
 #include <QImageReader>
@@ -42,6 +44,9 @@ private slots:
     void iconFromTheme_data();
     void iconFromTheme();
 
+    void themeStartup();
+    void scalableFromTheme();
+
 private:
     QList< QPair<QString, QByteArray> > images; // filename, format
 };
@@ -107,6 +112,80 @@ void tst_QIcon::iconFromTheme()
     }
 }
 
+void tst_QIcon::themeStartup()
+{
+    // icons a typical application requests from the system theme on startup,
+    // the search paths are set on every iteration so the theme is loaded again
+    static const char* const startupIcons[] = {
+        "application-exit", "dialog-cancel", "dialog-close", "dialog-ok",
+        "document-new", "document-open", "document-open-recent", "document-print",
+        "document-properties", "document-save", "document-save-as", "edit-clear",
+        "edit-copy", "edit-cut", "edit-delete", "edit-find", "edit-paste",
+        "edit-redo", "edit-select-all", "edit-undo", "folder", "folder-new",
+        "go-down", "go-home", "go-next", "go-previous", "go-up", "help-about",
+        "help-contents", "list-add", "list-remove", "media-playback-start",
+        "preferences-system", "process-stop", "system-search", "text-x-generic",
+        "user-home", "view-refresh", "window-close", "zoom-in", "zoom-out"
+    };
+    const QStringList themeSearchPaths = QIcon::themeSearchPaths();
+
+    QBENCHMARK {
+        QIcon::setThemeSearchPaths(themeSearchPaths);
+        for (size_t i = 0; i < sizeof(startupIcons) / sizeof(startupIcons[0]); i++) {
+            QIcon icon = QIcon::fromTheme(QString::fromLatin1(startupIcons[i]));
+            Q_UNUSED(icon);
+        }
+    }
+}
+
+void tst_QIcon::scalableFromTheme()
+{
+    if (!QImageReader::supportedImageFormats().contains("svg")) {
+        QSKIP("SVG image format is not supported", SkipSingle);
+    }
+
+    // theme with a single scalable icon, the search paths are set on every
+    // iteration so the icon is loaded again, after the first iteration the
+    // rendered image comes from the on-disk icon cache
+    const QString themePath = QDir::tempPath() + QLatin1String("/tst_bench_qicon_")
+        + QString::number(QCoreApplication::applicationPid());
+    const QString iconPath = themePath + QLatin1String("/bench/scalable");
+    QVERIFY(QDir().mkpath(iconPath));
+    QFile indexFile(themePath + QLatin1String("/bench/index.theme"));
+    QVERIFY(indexFile.open(QFile::WriteOnly));
+    indexFile.write(
+        "[Icon Theme]\n"
+        "Name=bench\n"
+        "Directories=scalable\n"
+        "\n"
+        "[scalable]\n"
+        "Size=48\n"
+        "MinSize=8\n"
+        "MaxSize=512\n"
+        "Type=Scalable\n"
+    );
+    indexFile.close();
+    QVERIFY(QFile::copy(QLatin1String(SRCDIR "/images/bench.svg"), iconPath + QLatin1String("/bench.svg")));
+
+    const QStringList themeSearchPaths = QIcon::themeSearchPaths();
+    const QString themeName = QIcon::themeName();
+    QIcon::setThemeName(QLatin1String("bench"));
+
+    const QSize iconSize = QSize(48, 48);
+    QBENCHMARK {
+        QIcon::setThemeSearchPaths(QStringList() << themePath);
+        QIcon icon = QIcon::fromTheme(QLatin1String("bench"));
+        QPixmap pixmap = icon.pixmap(iconSize);
+        QVERIFY(!pixmap.isNull());
+    }
+
+    QIcon::setThemeSearchPaths(themeSearchPaths);
+    QIcon::setThemeName(themeName);
+    QFile::remove(iconPath + QLatin1String("/bench.svg"));
+    QFile::remove(themePath + QLatin1String("/bench/index.theme"));
+    QDir().rmpath(iconPath);
+}
+
 QTEST_MAIN(tst_QIcon)
 
 #include "moc_tst_qicon.cpp"
@@ -35,9 +35,17 @@ class tst_qhostinfo : public QObject
     Q_OBJECT
 public slots:
     void init();
+    void resultsReady(const QHostInfo &info);
 private slots:
     void lookupSpeed_data();
     void lookupSpeed();
+    void asyncLookupSpeed_data() { lookupSpeed_data(); }
+    void asyncLookupSpeed();
+
+private:
+    QStringList hostnames() const;
+
+    int pendingResults;
 };
 
 void tst_qhostinfo::init()
@@ -53,11 +61,17 @@ void tst_qhostinfo::lookupSpeed_data()
     QTest::newRow("WithoutCache") << false;
 }
 
-void tst_qhostinfo::lookupSpeed()
+void tst_qhostinfo::resultsReady(const QHostInfo &info)
 {
-    QFETCH(bool, cache);
-    qt_qhostinfo_enable_cache(cache);
+    Q_UNUSED(info);
+    pendingResults--;
+    if (pendingResults == 0) {
+        QTestEventLoop::instance().exitLoop();
+    }
+}
 
+QStringList tst_qhostinfo::hostnames() const
+{
     QStringList hostnameList;
     hostnameList << QLatin1String("www.nokia.com")
                  << QLatin1String("www.trolltech.com")
@@ -72,7 +86,15 @@ void tst_qhostinfo::lookupSpeed()
                  << QLatin1String("www.trolltech.com");
     // and some more
     hostnameList << hostnameList;
+    return hostnameList;
+}
+
+void tst_qhostinfo::lookupSpeed()
+{
+    QFETCH(bool, cache);
+    qt_qhostinfo_enable_cache(cache);
 
+    const QStringList hostnameList = hostnames();
     QBENCHMARK {
         for (int i = 0; i < hostnameList.size(); i++)
             (void)QHostInfo::fromName(hostnameList.at(i));
@@ -80,6 +102,20 @@ void tst_qhostinfo::lookupSpeed()
     }
 }
 
+// all lookups run concurrently and duplicates share one resolver call
+void tst_qhostinfo::asyncLookupSpeed()
+{
+    QFETCH(bool, cache);
+    qt_qhostinfo_enable_cache(cache);
+
+    const QStringList hostnameList = hostnames();
+    QBENCHMARK {
+        pendingResults = hostnameList.size();
+        for (int i = 0; i < hostnameList.size(); i++)
+            QHostInfo::lookupHost(hostnameList.at(i), this, SLOT(resultsReady(QHostInfo)));
+        QTestEventLoop::instance().enterLoop(30);
+    }
+}
 
 QTEST_MAIN(tst_qhostinfo)
 
@@ -20,21 +20,121 @@
 ****************************************************************************/
 
 #include <QTest>
+#include <QCoreApplication>
+#include <QSocketNotifier>
+#include <QThread>
 #include <qnet_unix_p.h>
 #include <qcore_unix_p.h>
 
+#include <sys/resource.h>
+
 QT_USE_NAMESPACE
 
 static const int timeout = 100;
 
+class DispatcherReceiver : public QObject
+{
+    Q_OBJECT
+public:
+    DispatcherReceiver() : activated(0) { }
+
+    int activated;
+
+public slots:
+    void readSocket(int socket)
+    {
+        char c;
+        qt_safe_read(socket, &c, 1);
+        activated++;
+    }
+};
+
+// socket notifiers are watched by the event dispatcher of the thread they live
+// in and the dispatcher of a thread picks select() or epoll when it is created
+class DispatcherThread : public QThread
+{
+public:
+    DispatcherThread(int idle, int active)
+        : idle(idle), active(active), failed(false)
+    { }
+
+    void run()
+    {
+        QList<int> sockets;
+        QList<int> activePeers;
+        QList<QSocketNotifier*> notifiers;
+        DispatcherReceiver receiver;
+
+        // both ends of the idle pairs are watched and nothing is ever written to them
+        for (int i = 0; i < idle / 2; i++) {
+            int pair[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == -1) {
+                failed = true;
+                break;
+            }
+            sockets << pair[0] << pair[1];
+            notifiers << new QSocketNotifier(pair[0], QSocketNotifier::Read);
+            notifiers << new QSocketNotifier(pair[1], QSocketNotifier::Read);
+        }
+        for (int i = 0; !failed && i < active; i++) {
+            int pair[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == -1) {
+                failed = true;
+                break;
+            }
+            sockets << pair[0] << pair[1];
+            activePeers << pair[1];
+            QSocketNotifier *notifier = new QSocketNotifier(pair[0], QSocketNotifier::Read);
+            QObject::connect(notifier, SIGNAL(activated(int)), &receiver, SLOT(readSocket(int)));
+            notifiers << notifier;
+        }
+
+        if (!failed) {
+            QBENCHMARK {
+                receiver.activated = 0;
+                foreach (int peer, activePeers) {
+                    qt_safe_write(peer, "x", 1);
+                }
+                while (receiver.activated < active) {
+                    QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+                }
+            }
+        }
+
+        qDeleteAll(notifiers);
+        foreach (int socket, sockets) {
+            qt_safe_close(socket);
+        }
+    }
+
+    const int idle;
+    const int active;
+    bool failed;
+};
+
 class tst_selectpoll : public QObject
 {
     Q_OBJECT
 private slots:
+    void initTestCase();
+
     void bench_select();
     void bench_poll();
+
+    void bench_dispatcher_data();
+    void bench_dispatcher();
 };
 
+void tst_selectpoll::initTestCase()
+{
+    // the dispatcher benchmark needs more than 10000 descriptors
+    struct rlimit limit;
+    if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        ::setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
 void tst_selectpoll::bench_select()
 {
     int posixSocket = qt_safe_socket(AF_INET, SOCK_STREAM, 0);
@@ -63,6 +163,43 @@ void tst_selectpoll::bench_poll()
     qt_safe_close(posixSocket);
 }
 
+void tst_selectpoll::bench_dispatcher_data()
+{
+    QTest::addColumn<bool>("useEpoll");
+    QTest::addColumn<int>("idle");
+    QTest::addColumn<int>("active");
+
+    // select() can not wait for descriptors beyond FD_SETSIZE (usually 1024)
+    QTest::newRow("select, 300 idle, 100 active") << false << 300 << 100;
+    QTest::newRow("epoll, 300 idle, 100 active") << true << 300 << 100;
+    QTest::newRow("epoll, 10000 idle, 100 active") << true << 10000 << 100;
+}
+
+void tst_selectpoll::bench_dispatcher()
+{
+    QFETCH(bool, useEpoll);
+    QFETCH(int, idle);
+    QFETCH(int, active);
+
+    const QByteArray noepoll = qgetenv("QT_NO_EPOLL");
+    if (useEpoll) {
+        if (!noepoll.isEmpty()) {
+            QSKIP("epoll is disabled via QT_NO_EPOLL", SkipSingle);
+        }
+        qputenv("QT_NO_EPOLL", QByteArray());
+    } else {
+        qputenv("QT_NO_EPOLL", "1");
+    }
+
+    DispatcherThread thread(idle, active);
+    thread.start();
+    QVERIFY(thread.wait());
+    qputenv("QT_NO_EPOLL", noepoll);
+    if (thread.failed) {
+        QSKIP("Not enough descriptors, raise the open files limit", SkipSingle);
+    }
+}
+
 QTEST_MAIN(tst_selectpoll)
 
 #include "moc_main.cpp"